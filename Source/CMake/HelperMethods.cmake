@@ -78,6 +78,7 @@ MACRO(add_imported_library LIB_NAME RELEASE_NAME DEBUG_NAME IS_SHARED)
 	if(CMAKE_CONFIGURATION_TYPES) # Multiconfig generator?
 		set_target_properties(${LIB_NAME} PROPERTIES IMPORTED_LOCATION_DEBUG "${DEBUG_NAME}")
 		set_target_properties(${LIB_NAME} PROPERTIES IMPORTED_LOCATION_OPTIMIZEDDEBUG "${RELEASE_NAME}")
+		set_target_properties(${LIB_NAME} PROPERTIES IMPORTED_LOCATION_PROFILE "${RELEASE_NAME}")
 		set_target_properties(${LIB_NAME} PROPERTIES IMPORTED_LOCATION_RELEASE "${RELEASE_NAME}")
 	else()
 		set_target_properties(${LIB_NAME} PROPERTIES IMPORTED_LOCATION "${RELEASE_NAME}")
@@ -192,7 +193,7 @@ MACRO(install_dependency_binaries FOLDER_NAME)
 		install(
 			FILES ${SRC_RELEASE}
 			DESTINATION ${DESTINATION_DIR}
-			CONFIGURATIONS Release OptimizedDebug
+			CONFIGURATIONS Release Profile OptimizedDebug
 			RENAME ${RELEASE_FILENAME}
 			OPTIONAL)
 			
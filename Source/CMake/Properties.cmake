@@ -1,6 +1,6 @@
 # Configuration types
 if(CMAKE_CONFIGURATION_TYPES) # Multiconfig generator?
-	set(CMAKE_CONFIGURATION_TYPES "Debug;OptimizedDebug;Release;" CACHE INTERNAL "")
+	set(CMAKE_CONFIGURATION_TYPES "Debug;OptimizedDebug;Profile;Release;" CACHE INTERNAL "")
 else()
 	if(NOT CMAKE_BUILD_TYPE)
 		message("Defaulting to release build.")
@@ -8,7 +8,7 @@ else()
 	endif()
 	set_property(CACHE CMAKE_BUILD_TYPE PROPERTY HELPSTRING "Choose the type of build")
 	# Set the valid options for cmake-gui drop-down list
-	set_property(CACHE CMAKE_BUILD_TYPE PROPERTY STRINGS Debug OptimizedDebug Release)
+	set_property(CACHE CMAKE_BUILD_TYPE PROPERTY STRINGS Debug OptimizedDebug Profile Release)
 endif()
 
 # Includes required for various find_package calls
@@ -37,10 +37,12 @@ if(MSVC)
 
 	set(BS_LINKER_FLAGS_DEBUG "${BS_LINKER_FLAGS_COMMON} /DEBUG")
 	set(BS_LINKER_FLAGS_OPTIMIZEDDEBUG "${BS_LINKER_FLAGS_COMMON} /LTCG:incremental /INCREMENTAL:NO /OPT:REF /DEBUG")
+	set(BS_LINKER_FLAGS_PROFILE "${BS_LINKER_FLAGS_COMMON} /DEBUG /LTCG /INCREMENTAL:NO /OPT:REF")
 	set(BS_LINKER_FLAGS_RELEASE "${BS_LINKER_FLAGS_COMMON} /DEBUG /LTCG /INCREMENTAL:NO /OPT:REF")
 
 	if(BS_64BIT)
 		set(BS_LINKER_FLAGS_OPTIMIZEDDEBUG "${BS_LINKER_FLAGS_OPTIMIZEDDEBUG} /OPT:ICF")
+		set(BS_LINKER_FLAGS_PROFILE "${BS_LINKER_FLAGS_PROFILE} /OPT:ICF")
 		set(BS_LINKER_FLAGS_RELEASE "${BS_LINKER_FLAGS_RELEASE} /OPT:ICF")
 	endif()
 
@@ -52,6 +54,10 @@ if(MSVC)
 	set(CMAKE_MODULE_LINKER_FLAGS_OPTIMIZEDDEBUG "/DLL ${BS_LINKER_FLAGS_OPTIMIZEDDEBUG}")
 	set(CMAKE_EXE_LINKER_FLAGS_OPTIMIZEDDEBUG ${BS_LINKER_FLAGS_OPTIMIZEDDEBUG})
 
+	set(CMAKE_SHARED_LINKER_FLAGS_PROFILE "/DLL ${BS_LINKER_FLAGS_PROFILE}")
+	set(CMAKE_MODULE_LINKER_FLAGS_PROFILE "/DLL ${BS_LINKER_FLAGS_PROFILE}")
+	set(CMAKE_EXE_LINKER_FLAGS_PROFILE ${BS_LINKER_FLAGS_PROFILE})
+
 	set(CMAKE_SHARED_LINKER_FLAGS_RELEASE "/DLL ${BS_LINKER_FLAGS_RELEASE}")
 	set(CMAKE_MODULE_LINKER_FLAGS_RELEASE "/DLL ${BS_LINKER_FLAGS_RELEASE}")
 	set(CMAKE_EXE_LINKER_FLAGS_RELEASE ${BS_LINKER_FLAGS_RELEASE})
@@ -69,6 +75,7 @@ if(MSVC)
 	endif()
 
 	set(CMAKE_CXX_FLAGS_OPTIMIZEDDEBUG "${BS_COMPILER_FLAGS_COMMON} /GL /Gy /Zi /O2 /Oi /MD -DDEBUG")
+	set(CMAKE_CXX_FLAGS_PROFILE "${BS_COMPILER_FLAGS_COMMON} /GL /Gy /Zi /O2 /Oi /MD -DNDEBUG -DBS_PROFILE_MODE")
 	set(CMAKE_CXX_FLAGS_RELEASE "${BS_COMPILER_FLAGS_COMMON} /GL /Gy /Zi /O2 /Oi /MD -DNDEBUG")
 
 	# Global defines
@@ -85,11 +92,13 @@ elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang" OR CMAKE_CXX_COMPILER_ID MATCHES "A
 
 	set(CMAKE_CXX_FLAGS_DEBUG "${BS_COMPILER_FLAGS_COMMON} -ggdb -O0 -DDEBUG")
 	set(CMAKE_CXX_FLAGS_OPTIMIZEDDEBUG "${BS_COMPILER_FLAGS_COMMON} -ggdb -O2 -DDEBUG -Wno-unused-variable")
+	set(CMAKE_CXX_FLAGS_PROFILE "${BS_COMPILER_FLAGS_COMMON} -ggdb -O2 -DNDEBUG -DBS_PROFILE_MODE -Wno-unused-variable")
 	set(CMAKE_CXX_FLAGS_RELEASE "${BS_COMPILER_FLAGS_COMMON} -ggdb -O2 -DNDEBUG -Wno-unused-variable")
 
 	if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
 		set(CMAKE_EXE_LINKER_FLAGS_DEBUG "-no-pie")
 		set(CMAKE_EXE_LINKER_FLAGS_OPTIMIZEDDEBUG "-no-pie")
+		set(CMAKE_EXE_LINKER_FLAGS_PROFILE "-no-pie")
 		set(CMAKE_EXE_LINKER_FLAGS_RELEASE "-no-pie")
 	endif()
 
@@ -99,10 +108,12 @@ elseif("${CMAKE_CXX_COMPILER_ID}" STREQUAL "GNU")
 
 	set(CMAKE_CXX_FLAGS_DEBUG "${BS_COMPILER_FLAGS_COMMON} -ggdb -O0 -DDEBUG")
 	set(CMAKE_CXX_FLAGS_OPTIMIZEDDEBUG "${BS_COMPILER_FLAGS_COMMON} -ggdb -O2 -DDEBUG -Wno-unused-variable")
+	set(CMAKE_CXX_FLAGS_PROFILE "${BS_COMPILER_FLAGS_COMMON} -ggdb -O2 -DNDEBUG -DBS_PROFILE_MODE -Wno-unused-variable")
 	set(CMAKE_CXX_FLAGS_RELEASE "${BS_COMPILER_FLAGS_COMMON} -ggdb -O2 -DNDEBUG -Wno-unused-variable")
 
 	set(CMAKE_EXE_LINKER_FLAGS_DEBUG "-no-pie")
 	set(CMAKE_EXE_LINKER_FLAGS_OPTIMIZEDDEBUG "-no-pie")
+	set(CMAKE_EXE_LINKER_FLAGS_PROFILE "-no-pie")
 	set(CMAKE_EXE_LINKER_FLAGS_RELEASE "-no-pie")
 else()
 # TODO_OTHER_COMPILERS_GO_HERE
@@ -123,14 +134,17 @@ set(BS_LIBRARY_OUTPUT_DIR ${PROJECT_SOURCE_DIR}/lib/${BS_OUTPUT_DIR_PREFIX})
 
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY_DEBUG ${BS_BINARY_OUTPUT_DIR}/Debug)
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY_OPTIMIZEDDEBUG ${BS_BINARY_OUTPUT_DIR}/OptimizedDebug)
+set(CMAKE_RUNTIME_OUTPUT_DIRECTORY_PROFILE ${BS_BINARY_OUTPUT_DIR}/Profile)
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY_RELEASE ${BS_BINARY_OUTPUT_DIR}/Release)
 
 set(CMAKE_LIBRARY_OUTPUT_DIRECTORY_DEBUG ${BS_BINARY_OUTPUT_DIR}/Debug)
 set(CMAKE_LIBRARY_OUTPUT_DIRECTORY_OPTIMIZEDDEBUG ${BS_BINARY_OUTPUT_DIR}/OptimizedDebug)
+set(CMAKE_LIBRARY_OUTPUT_DIRECTORY_PROFILE ${BS_BINARY_OUTPUT_DIR}/Profile)
 set(CMAKE_LIBRARY_OUTPUT_DIRECTORY_RELEASE ${BS_BINARY_OUTPUT_DIR}/Release)
 
 set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY_DEBUG ${BS_LIBRARY_OUTPUT_DIR}/Debug)
 set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY_OPTIMIZEDDEBUG ${BS_LIBRARY_OUTPUT_DIR}/OptimizedDebug)
+set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY_PROFILE ${BS_LIBRARY_OUTPUT_DIR}/Profile)
 set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY_RELEASE ${BS_LIBRARY_OUTPUT_DIR}/Release)
 
 set_property(GLOBAL PROPERTY USE_FOLDERS TRUE)
@@ -22,8 +22,8 @@ namespace bs
 	AnimationProxy::AnimationProxy(UINT64 id)
 		: id(id), layers(nullptr), numLayers(0), numSceneObjects(0), sceneObjectInfos(nullptr)
 		, sceneObjectTransforms(nullptr), morphChannelInfos(nullptr), morphShapeInfos(nullptr), numMorphChannels(0)
-		, numMorphShapes(0), numMorphVertices(0), morphChannelWeightsDirty(false), mCullEnabled(true), numGenericCurves(0)
-		, genericCurveOutputs(nullptr)
+		, numMorphShapes(0), numMorphVertices(0), morphChannelWeightsDirty(false), mCullEnabled(true), mLodTier(0)
+		, mHasLodMasks(false), numGenericCurves(0), genericCurveOutputs(nullptr)
 	{ }
 
 	AnimationProxy::~AnimationProxy()
@@ -438,12 +438,14 @@ namespace bs
 					if (isClipValid)
 					{
 						state.curves = clipInfo.clip->getCurves();
+						state.bakedCurves = clipInfo.clip->_getBakedSamples();
 						state.disabled = clipInfo.playbackType == AnimPlaybackType::None;
 					}
 					else
 					{
 						static SPtr<AnimationCurves> zeroCurves = bs_shared_ptr_new<AnimationCurves>();
 						state.curves = zeroCurves;
+						state.bakedCurves = nullptr;
 						state.disabled = true;
 					}
 
@@ -641,7 +643,8 @@ namespace bs
 	}
 
 	Animation::Animation()
-		: mDefaultWrapMode(AnimWrapMode::Loop), mDefaultSpeed(1.0f), mCull(true), mDirty(AnimDirtyStateFlag::All)
+		: mDefaultWrapMode(AnimWrapMode::Loop), mDefaultSpeed(1.0f), mCull(true), mHasLodMasks(false)
+		, mDirty(AnimDirtyStateFlag::All)
 		, mGenericCurveValuesValid(false)
 	{
 		mId = AnimationManager::instance().registerAnimation(this);
@@ -731,6 +734,15 @@ namespace bs
 		mDirty |= AnimDirtyStateFlag::Culling;
 	}
 
+	void Animation::setLodMasks(const SkeletonMask& mediumMask, const SkeletonMask& farMask)
+	{
+		mLodMasks[0] = mediumMask;
+		mLodMasks[1] = farMask;
+		mHasLodMasks = true;
+
+		mDirty |= AnimDirtyStateFlag::Culling;
+	}
+
 	void Animation::play(const HAnimationClip& clip)
 	{
 		AnimationClipInfo* clipInfo = addClip(clip, (UINT32)-1);
@@ -1262,6 +1274,19 @@ namespace bs
 		return animPtr;
 	}
 
+	void Animation::updateClipResidency(float prefetchMargin, float evictMargin)
+	{
+		for (auto& clipInfo : mClipInfos)
+		{
+			if (!clipInfo.clip.isLoaded() || !clipInfo.clip->isSegmented())
+				continue;
+
+			// Scale the look-ahead with playback speed so fast playback still prefetches far enough in advance
+			float speed = std::max(1.0f, fabsf(clipInfo.state.speed));
+			clipInfo.clip->_updateResidency(clipInfo.state.time, prefetchMargin * speed, evictMargin);
+		}
+	}
+
 	void Animation::updateAnimProxy(float timeDelta)
 	{
 		// Check if any of the clip curves are dirty and advance time, perform fading
@@ -1285,6 +1310,9 @@ namespace bs
 		{
 			mAnimProxy->mCullEnabled = mCull;
 			mAnimProxy->mBounds = mBounds;
+			mAnimProxy->mHasLodMasks = mHasLodMasks;
+			mAnimProxy->mLodMasks[0] = mLodMasks[0];
+			mAnimProxy->mLodMasks[1] = mLodMasks[1];
 
 			mDirty.unset(AnimDirtyStateFlag::Culling);
 		}
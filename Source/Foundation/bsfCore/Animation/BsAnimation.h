@@ -245,9 +245,12 @@ namespace bs
 		UINT32 numMorphVertices;
 		bool morphChannelWeightsDirty;
 
-		// Culling
+		// Culling & level of detail
 		AABox mBounds;
 		bool mCullEnabled;
+		UINT32 mLodTier;
+		bool mHasLodMasks;
+		SkeletonMask mLodMasks[2];
 
 		// Evaluation results
 		LocalSkeletonPose skeletonPose;
@@ -306,12 +309,23 @@ namespace bs
 		/** Sets bounds that will be used for animation culling, if enabled. Bounds must be in world space. */
 		void setBounds(const AABox& bounds);
 
-		/** 
+		/**
 		 * When enabled, animation that is not in a view of any camera will not be evaluated. View determination is done by
 		 * checking the bounds provided in setBounds().
 		 */
 		void setCulling(bool cull);
 
+		/**
+		 * Sets masks used for reducing the number of evaluated bones while the animation is far away from all cameras, as
+		 * determined by the distances provided to AnimationManager::setCrowdLod(). Caller must ensure the masks match the
+		 * skeleton assigned to the animation. Distance is measured using the bounds provided in setBounds(), so the masks
+		 * only apply when culling is enabled.
+		 *
+		 * @param[in]	mediumMask	Mask applied once the animation passes the medium level of detail distance.
+		 * @param[in]	farMask		Mask applied once the animation passes the far level of detail distance.
+		 */
+		void setLodMasks(const SkeletonMask& mediumMask, const SkeletonMask& farMask);
+
 		/** 
 		 * Plays the specified animation clip. 
 		 *
@@ -481,6 +495,15 @@ namespace bs
 		 */
 		void updateAnimProxy(float timeDelta);
 
+		/**
+		 * Updates which segments of any playing segmented clips are resident, based on the current playhead positions.
+		 * See AnimationClip::_updateResidency().
+		 *
+		 * @param[in]	prefetchMargin	How many seconds ahead of a playhead to keep segments loaded.
+		 * @param[in]	evictMargin		How many seconds behind a playhead before a segment is released.
+		 */
+		void updateClipResidency(float prefetchMargin, float evictMargin);
+
 		/**
 		 * Applies any outputs stored in the animation proxy (as written by the animation thread), and uses them to update
 		 * the animation state on the simulation thread. Caller must ensure that the animation thread has finished
@@ -509,6 +532,8 @@ namespace bs
 		float mDefaultSpeed;
 		AABox mBounds;
 		bool mCull;
+		bool mHasLodMasks;
+		SkeletonMask mLodMasks[2];
 		AnimDirtyState mDirty;
 
 		SPtr<Skeleton> mSkeleton;
@@ -1,6 +1,7 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Animation/BsAnimationClip.h"
+#include "Animation/BsBakedAnimationCurves.h"
 #include "Resources/BsResources.h"
 #include "Animation/BsSkeleton.h"
 #include "Private/RTTI/BsAnimationClipRTTI.h"
@@ -136,12 +137,121 @@ namespace bs
 		return newClip;
 	}
 
+	SPtr<AnimationCurves> AnimationClip::getCurves() const
+	{
+		if (mActiveSegment != (UINT32)-1 && mSegments[mActiveSegment].isLoaded(false))
+			return mSegments[mActiveSegment]->getCurves();
+
+		return mCurves;
+	}
+
+	SPtr<BakedAnimationCurves> AnimationClip::_getBakedSamples() const
+	{
+		if (mActiveSegment != (UINT32)-1 && mSegments[mActiveSegment].isLoaded(false))
+			return mSegments[mActiveSegment]->_getBakedSamples();
+
+		return mBakedSamples;
+	}
+
+	void AnimationClip::setSegments(const Vector<WeakResourceHandle<AnimationClip>>& segments, float segmentLength)
+	{
+		mSegments = segments;
+		mSegmentLength = segmentLength;
+		mSegmentRefs.assign(mSegments.size(), false);
+		mActiveSegment = (UINT32)-1;
+
+		// The clip itself usually carries no curves, so derive the length from the segment index instead
+		mLength = std::max(mLength, segmentLength * (float)mSegments.size());
+		mVersion++;
+	}
+
+	void AnimationClip::_updateResidency(float time, float prefetchMargin, float evictMargin)
+	{
+		if (mSegments.empty() || mSegmentLength <= 0.0f)
+			return;
+
+		UINT32 numSegments = (UINT32)mSegments.size();
+		if (mSegmentRefs.size() != numSegments)
+			mSegmentRefs.assign(numSegments, false);
+
+		float length = std::max(mLength, mSegmentLength);
+		auto wrap = [length](float t)
+		{
+			t = fmod(t, length);
+			if (t < 0.0f)
+				t += length;
+
+			return t;
+		};
+
+		auto segmentAt = [this, numSegments](float t)
+		{
+			return std::min((UINT32)(t / mSegmentLength), numSegments - 1);
+		};
+
+		time = wrap(time);
+
+		UINT32 activeIdx = segmentAt(time);
+		UINT32 lastPrefetchIdx = segmentAt(wrap(time + prefetchMargin));
+		UINT32 lastEvictIdx = segmentAt(wrap(time - evictMargin));
+
+		UINT32 numAhead = ((lastPrefetchIdx + numSegments - activeIdx) % numSegments) + 1;
+		UINT32 numBehind = (activeIdx + numSegments - lastEvictIdx) % numSegments;
+
+		// If the margins cover the entire clip just keep everything resident
+		if ((prefetchMargin + evictMargin + mSegmentLength) >= length)
+		{
+			numAhead = numSegments;
+			numBehind = 0;
+		}
+
+		for (UINT32 i = 0; i < numSegments; i++)
+		{
+			UINT32 distAhead = (i + numSegments - activeIdx) % numSegments;
+			UINT32 distBehind = (activeIdx + numSegments - i) % numSegments;
+
+			bool wantResident = distAhead < numAhead;
+			bool keepResident = wantResident || distBehind <= numBehind;
+
+			if (wantResident && !mSegmentRefs[i])
+			{
+				gResources().loadFromUUID(mSegments[i].getUUID(), true);
+				mSegmentRefs[i] = true;
+			}
+			else if (!keepResident && mSegmentRefs[i])
+			{
+				gResources().release(mSegments[i]);
+				mSegmentRefs[i] = false;
+			}
+		}
+
+		// Swap the active curve data once the segment under the playhead is resident. Bumping the version makes any
+		// animation proxy referencing the clip rebuild with the new curves.
+		if (activeIdx != mActiveSegment && mSegments[activeIdx].isLoaded(false))
+		{
+			mActiveSegment = activeIdx;
+			mVersion++;
+		}
+	}
+
 	void AnimationClip::setCurves(const AnimationCurves& curves)
 	{
 		*mCurves = curves;
 
 		buildNameMapping();
 		calculateLength();
+		buildBakedSamples();
+		mVersion++;
+	}
+
+	void AnimationClip::setUseBakedSamples(bool enabled)
+	{
+		if (mUseBakedSamples == enabled)
+			return;
+
+		mUseBakedSamples = enabled;
+
+		buildBakedSamples();
 		mVersion++;
 	}
 
@@ -226,9 +336,18 @@ namespace bs
 		}
 	}
 
+	void AnimationClip::buildBakedSamples()
+	{
+		if (mUseBakedSamples)
+			mBakedSamples = bs_shared_ptr_new<BakedAnimationCurves>(*mCurves, mSampleRate, mLength);
+		else
+			mBakedSamples = nullptr;
+	}
+
 	void AnimationClip::initialize()
 	{
 		buildNameMapping();
+		buildBakedSamples();
 
 		Resource::initialize();
 	}
@@ -246,6 +365,13 @@ namespace bs
 
 	void AnimationClip::getCurveMapping(const String& name, AnimationCurveMapping& mapping) const
 	{
+		// Segmented clips carry no curves of their own, so look the name up in the resident segment instead
+		if (mActiveSegment != (UINT32)-1 && mSegments[mActiveSegment].isLoaded(false))
+		{
+			mSegments[mActiveSegment]->getCurveMapping(name, mapping);
+			return;
+		}
+
 		auto iterFind = mNameMapping.find(name);
 		if (iterFind != mNameMapping.end())
 		{
@@ -261,6 +387,12 @@ namespace bs
 
 	void AnimationClip::getMorphMapping(const String& name, UINT32& frameIdx, UINT32& weightIdx) const
 	{
+		if (mActiveSegment != (UINT32)-1 && mSegments[mActiveSegment].isLoaded(false))
+		{
+			mSegments[mActiveSegment]->getMorphMapping(name, frameIdx, weightIdx);
+			return;
+		}
+
 		auto iterFind = mNameMapping.find(name);
 		if (iterFind != mNameMapping.end())
 		{
@@ -15,6 +15,7 @@ namespace bs
 	 */
 
 	struct AnimationCurveMapping;
+	class BakedAnimationCurves;
 
 	/** A set of animation curves representing translation/rotation/scale and generic animation. */
 	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Animation) AnimationCurves
@@ -151,9 +152,14 @@ namespace bs
 	public:
 		virtual ~AnimationClip() { }
 
-		/** @copydoc setCurves() */
+		/**
+		 * A set of all curves stored in the animation. Returned value will not be updated if the animation clip curves
+		 * are added or removed, as it is a copy of clip's internal values. For segmented clips (see setSegments()) this
+		 * returns the curves of the resident segment containing the playhead, or the clip's own (typically empty) curve
+		 * set while no segment is resident.
+		 */
 		BS_SCRIPT_EXPORT(n:Curves,pr:getter)
-		SPtr<AnimationCurves> getCurves() const { return mCurves; }
+		SPtr<AnimationCurves> getCurves() const;
 
 		/** 
 		 * A set of all curves stored in the animation. Returned value will not be updated if the animation clip curves are
@@ -236,7 +242,48 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:SampleRate,pr:setter)
 		void setSampleRate(UINT32 sampleRate) { mSampleRate = sampleRate; }
 
-		/** 
+		/** @copydoc setUseBakedSamples() */
+		BS_SCRIPT_EXPORT(n:UseBakedSamples,pr:getter)
+		bool getUseBakedSamples() const { return mUseBakedSamples; }
+
+		/**
+		 * When enabled the clip generates a version of its curves resampled at getSampleRate() samples per second, and the
+		 * animation system will evaluate the resampled data instead of the original curves. Evaluation of resampled curves
+		 * is significantly cheaper (an index calculation and a linear interpolation instead of a keyframe search and cubic
+		 * hermite math), at the cost of extra memory and some precision between samples. Intended to be chosen during
+		 * import, primarily for clips that animate many bones.
+		 */
+		BS_SCRIPT_EXPORT(n:UseBakedSamples,pr:setter)
+		void setUseBakedSamples(bool enabled);
+
+		/** Checks whether the clip stores its curve data in time-sliced segments loaded on demand. See setSegments(). */
+		bool isSegmented() const { return !mSegments.empty(); }
+
+		/**
+		 * Splits the clip into time-sliced segments that are loaded on demand, instead of keeping all curve data
+		 * resident. Each segment is a separate AnimationClip resource containing only the keyframes of its time slice
+		 * (in clip-local time, so no remapping happens during evaluation), plus duplicated boundary keys so values at
+		 * slice edges evaluate identically. All segments must contain the same set of curves so curve indices and bone
+		 * mappings stay stable as the playhead crosses segment boundaries.
+		 *
+		 * Segments are referenced weakly: saving this clip doesn't embed them and loading it doesn't load them. Instead
+		 * AnimationManager loads segments ahead of the playhead of any animation playing the clip and releases them once
+		 * the playhead moves far enough past them (see AnimationManager::setSegmentMargins()). Intended for long
+		 * cinematic clips of which only a small window is ever needed at once.
+		 *
+		 * @param[in]	segments		Clips containing the curve data of each consecutive time slice.
+		 * @param[in]	segmentLength	Length of a single time slice, in seconds. All slices are of uniform length
+		 *								except the last, which covers the remainder of the clip.
+		 */
+		void setSegments(const Vector<WeakResourceHandle<AnimationClip>>& segments, float segmentLength);
+
+		/** Returns the clips containing the time-sliced segment curve data. See setSegments(). */
+		const Vector<WeakResourceHandle<AnimationClip>>& getSegments() const { return mSegments; }
+
+		/** Returns the length of a single time-sliced segment, in seconds. See setSegments(). */
+		float getSegmentLength() const { return mSegmentLength; }
+
+		/**
 		 * Returns a version that can be used for detecting modifications on the clip by external systems. Whenever the clip
 		 * is modified the version is increased by one.
 		 */
@@ -270,9 +317,30 @@ namespace bs
 		 */
 
 		/** Creates a new AnimationClip without initializing it. Use create() for normal use. */
-		static SPtr<AnimationClip> _createPtr(const SPtr<AnimationCurves>& curves, bool isAdditive = false, 
+		static SPtr<AnimationClip> _createPtr(const SPtr<AnimationCurves>& curves, bool isAdditive = false,
 			UINT32 sampleRate = 1, const SPtr<RootMotion>& rootMotion = nullptr);
 
+		/**
+		 * Returns a version of the clip curves resampled at uniform intervals, or null if setUseBakedSamples() is
+		 * disabled. The returned object is immutable and may be used on other threads. For segmented clips the baked
+		 * samples of the resident segment containing the playhead are returned.
+		 */
+		SPtr<BakedAnimationCurves> _getBakedSamples() const;
+
+		/**
+		 * Updates which segments of the clip are resident based on the provided playhead position. Issues asynchronous
+		 * loads for segments within @p prefetchMargin seconds ahead of @p time, and releases segments more than
+		 * @p evictMargin seconds behind it so they may be unloaded. Both margins wrap around the clip ends so looping
+		 * playback prefetches the first segments again as the playhead approaches the end. Once the segment containing
+		 * @p time finishes loading its curves become the ones returned by getCurves() and the clip version is bumped so
+		 * animation proxies rebuild with the new data.
+		 *
+		 * Only relevant for segmented clips. Called automatically by AnimationManager for all playing clips. Residency
+		 * follows a single playhead, so a segmented clip shouldn't be played by multiple animations at different times.
+		 * Sim thread only.
+		 */
+		void _updateResidency(float time, float prefetchMargin, float evictMargin);
+
 		/** @} */
 
 	protected:
@@ -286,6 +354,9 @@ namespace bs
 		/** Creates a name -> curve index mapping for quicker curve lookup by name. */
 		void buildNameMapping();
 
+		/** Rebuilds the resampled version of the clip curves, if enabled. */
+		void buildBakedSamples();
+
 		/** Calculate the length of the clip based on assigned curves. */
 		void calculateLength();
 
@@ -310,8 +381,25 @@ namespace bs
 		 */
 		UnorderedMap<String, UINT32[(int)CurveType::Count]> mNameMapping;
 
+		/**
+		 * Version of the clip curves resampled at uniform intervals. Only available when mUseBakedSamples is enabled.
+		 * Derived from mCurves and rebuilt whenever they change. Immutable, so it may be used on other threads.
+		 */
+		SPtr<BakedAnimationCurves> mBakedSamples;
+
+		/**
+		 * Clips containing time-sliced segments of this clip's curve data, loaded on demand. When non-empty the clip
+		 * acts as a lightweight index and getCurves() returns the data of the resident segment under the playhead.
+		 */
+		Vector<WeakResourceHandle<AnimationClip>> mSegments;
+		float mSegmentLength = 0.0f; /**< Length of a single time-sliced segment, in seconds. */
+
+		Vector<bool> mSegmentRefs; /**< Segments the clip currently holds a load reference for. Not serialized. */
+		UINT32 mActiveSegment = (UINT32)-1; /**< Resident segment the playhead is in, or -1 if none. Not serialized. */
+
 		Vector<AnimationEvent> mEvents;
 		bool mIsAdditive;
+		bool mUseBakedSamples = false;
 		float mLength;
 		UINT32 mSampleRate;
 
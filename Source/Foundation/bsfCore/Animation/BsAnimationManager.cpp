@@ -3,6 +3,7 @@
 #include "Animation/BsAnimationManager.h"
 #include "Animation/BsAnimation.h"
 #include "Animation/BsAnimationClip.h"
+#include "Animation/BsBakedAnimationCurves.h"
 #include "Threading/BsTaskScheduler.h"
 #include "Utility/BsTime.h"
 #include "Scene/BsSceneManager.h"
@@ -10,6 +11,9 @@
 #include "Animation/BsMorphShapes.h"
 #include "Mesh/BsMeshData.h"
 #include "Mesh/BsMeshUtility.h"
+#include "Math/BsSIMD.h"
+#include "Renderer/BsRenderer.h"
+#include "Renderer/BsRendererManager.h"
 
 namespace bs
 {
@@ -35,6 +39,19 @@ namespace bs
 		mUpdateRate = 1.0f / fps;
 	}
 
+	void AnimationManager::setSegmentMargins(float prefetchAhead, float evictBehind)
+	{
+		mSegmentPrefetch = std::max(0.0f, prefetchAhead);
+		mSegmentEvict = std::max(0.0f, evictBehind);
+	}
+
+	void AnimationManager::setCrowdLod(bool enable, float mediumDistance, float farDistance)
+	{
+		mCrowdLodEnabled = enable;
+		mCrowdLodMediumDist = std::max(0.0f, mediumDistance);
+		mCrowdLodFarDist = std::max(mCrowdLodMediumDist, farDistance);
+	}
+
 	const EvaluatedAnimationData* AnimationManager::update(bool async)
 	{
 		// Wait for any workers to complete
@@ -76,6 +93,15 @@ namespace bs
 			}
 		}
 
+		// Check if the active renderer wants to blend morph shapes itself, in which case we skip generating the blended
+		// vertices and only provide it with shape weights
+		const SPtr<ct::Renderer>& renderer = RendererManager::instance().getActive();
+		mGpuMorphBlending = renderer != nullptr && renderer->usesGpuMorphBlending();
+
+		// Queue loads for segmented clip data needed ahead of each playhead
+		for (auto& anim : mAnimations)
+			anim.second->updateClipResidency(mSegmentPrefetch, mSegmentEvict);
+
 		// Update animation proxies from the latest data
 		mProxies.clear();
 		for (auto& anim : mAnimations)
@@ -86,6 +112,7 @@ namespace bs
 
 		// Build frustums for culling
 		mCullFrustums.clear();
+		mCameraPositions.clear();
 
 		auto& allCameras = gSceneManager().getAllCameras();
 		for(auto& entry : allCameras)
@@ -97,6 +124,29 @@ namespace bs
 			// TODO: Not checking if camera and animation renderable's layers match. If we checked more animations could
 			// be culled.
 			mCullFrustums.push_back(entry.second->getWorldFrustum());
+			mCameraPositions.push_back(entry.second->getTransform().getPosition());
+		}
+
+		// Assign crowd level of detail tiers depending on the distance from the nearest camera
+		mUpdateIdx++;
+		mSharedPoses.clear();
+
+		for (auto& anim : mProxies)
+		{
+			UINT32 lodTier = 0;
+			if (mCrowdLodEnabled && anim->mCullEnabled && !mCameraPositions.empty())
+			{
+				float distSqrd = std::numeric_limits<float>::max();
+				for (auto& cameraPos : mCameraPositions)
+					distSqrd = std::min(distSqrd, anim->mBounds.getCenter().squaredDistance(cameraPos));
+
+				if (distSqrd >= mCrowdLodFarDist * mCrowdLodFarDist)
+					lodTier = 2;
+				else if (distSqrd >= mCrowdLodMediumDist * mCrowdLodMediumDist)
+					lodTier = 1;
+			}
+
+			anim->mLodTier = lodTier;
 		}
 
 		// Prepare the write buffer
@@ -112,19 +162,77 @@ namespace bs
 		renderData.transforms.resize(totalNumBones);
 		renderData.infos.clear();
 
+		// Group animations into evaluation batches. One complex rig is a batch on its own, while tiny rigs share a batch
+		// so task overhead doesn't eat the benefit of evaluating them on worker threads.
+		struct EvalBatch
+		{
+			UINT32 proxyStart;
+			UINT32 proxyEnd;
+			UINT32 boneOffset;
+		};
+
+		// Number of bones at which a batch is considered complex enough to be evaluated on its own task. Animations
+		// without a skeleton count as a small fixed cost.
+		constexpr UINT32 BATCH_COST_THRESHOLD = 64;
+		constexpr UINT32 NO_SKELETON_COST = 8;
+
+		Vector<EvalBatch> batches;
+
+		UINT32 curBoneIdx = 0;
+		UINT32 batchStart = 0;
+		UINT32 batchBoneOffset = 0;
+		UINT32 batchCost = 0;
+		UINT32 numProxies = (UINT32)mProxies.size();
+		for (UINT32 i = 0; i < numProxies; i++)
+		{
+			const SPtr<AnimationProxy>& anim = mProxies[i];
+
+			if (anim->skeleton != nullptr)
+			{
+				UINT32 numBones = anim->skeleton->getNumBones();
+
+				batchCost += numBones;
+				curBoneIdx += numBones;
+			}
+			else
+				batchCost += NO_SKELETON_COST;
+
+			if (batchCost >= BATCH_COST_THRESHOLD)
+			{
+				batches.push_back({ batchStart, i + 1, batchBoneOffset });
+
+				batchStart = i + 1;
+				batchBoneOffset = curBoneIdx;
+				batchCost = 0;
+			}
+		}
+
+		if (batchStart < numProxies)
+			batches.push_back({ batchStart, numProxies, batchBoneOffset });
+
 		// Queue animation evaluation tasks
 		{
 			Lock lock(mMutex);
-			mNumActiveWorkers = (UINT32)mProxies.size();
+			mNumActiveWorkers = (UINT32)batches.size();
 		}
 
-		UINT32 curBoneIdx = 0;
-		for (auto& anim : mProxies)
+		for (auto& batch : batches)
 		{
-			auto evaluateAnimWorker = [this, anim, curBoneIdx]()
+			auto evaluateAnimWorker = [this, batch]()
 			{
-				UINT32 boneIdx = curBoneIdx;
-				evaluateAnimation(anim.get(), boneIdx);
+				UINT32 boneIdx = batch.boneOffset;
+				for (UINT32 i = batch.proxyStart; i < batch.proxyEnd; i++)
+				{
+					const SPtr<AnimationProxy>& anim = mProxies[i];
+
+					UINT32 curIdx = boneIdx;
+					evaluateAnimation(anim.get(), curIdx);
+
+					// Advance manually, since evaluateAnimation() doesn't advance the index for culled animations but
+					// the offsets were assigned assuming every skeleton occupies its slots
+					if (anim->skeleton != nullptr)
+						boneIdx += anim->skeleton->getNumBones();
+				}
 
 				Lock lock(mMutex);
 				{
@@ -137,9 +245,6 @@ namespace bs
 
 			SPtr<Task> task = Task::create("AnimWorker", evaluateAnimWorker);
 			TaskScheduler::instance().addTask(task);
-
-			if (anim->skeleton != nullptr)
-				curBoneIdx += anim->skeleton->getNumBones();
 		}
 
 		// Wait for tasks to complete
@@ -184,10 +289,41 @@ namespace bs
 		}
 
 		EvaluatedAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
-		
+
 		UINT32 prevPoseBufferIdx = (mPoseWriteBufferIdx + CoreThread::NUM_SYNC_BUFFERS) % (CoreThread::NUM_SYNC_BUFFERS + 1);
 		EvaluatedAnimationData& prevRenderData = mAnimData[prevPoseBufferIdx];
 
+		// Animations in a reduced level of detail tier refresh at a reduced rate, reusing the pose evaluated on a
+		// previous update in-between. Instances are staggered by ID so the whole crowd doesn't refresh on the same update.
+		constexpr UINT32 LOD_RATE_DIVISORS[] = { 1, 2, 4 };
+		const UINT32 rateDivisor = LOD_RATE_DIVISORS[anim->mLodTier];
+		if (rateDivisor > 1 && anim->skeleton != nullptr)
+		{
+			bool refresh = ((mUpdateIdx + (UINT32)anim->id) % rateDivisor) == 0;
+			if (!refresh)
+			{
+				auto iterFind = prevRenderData.infos.find(anim->id);
+				if (iterFind != prevRenderData.infos.end() &&
+					iterFind->second.poseInfo.numBones == anim->skeleton->getNumBones())
+				{
+					EvaluatedAnimationData::AnimInfo animInfo = iterFind->second;
+
+					UINT32 numBones = animInfo.poseInfo.numBones;
+					memcpy(renderData.transforms.data() + curBoneIdx,
+						prevRenderData.transforms.data() + animInfo.poseInfo.startIdx, sizeof(Matrix4) * numBones);
+
+					animInfo.poseInfo.startIdx = curBoneIdx;
+					curBoneIdx += numBones;
+
+					Lock lock(mMutex);
+					renderData.infos[anim->id] = animInfo;
+					return;
+				}
+
+				// No valid pose from the previous update (e.g. the instance was culled), evaluate in full
+			}
+		}
+
 		EvaluatedAnimationData::AnimInfo animInfo;
 		bool hasAnimInfo = false;
 
@@ -201,25 +337,81 @@ namespace bs
 			poseInfo.startIdx = curBoneIdx;
 			poseInfo.numBones = numBones;
 
-			memset(anim->skeletonPose.hasOverride, 0, sizeof(bool) * anim->skeletonPose.numBones);
+			// Reduced level of detail tiers can evaluate with a mask that disables less important bones
+			const SkeletonMask* mask = &anim->skeletonMask;
+			if (anim->mLodTier > 0 && anim->mHasLodMasks)
+				mask = &anim->mLodMasks[anim->mLodTier - 1];
+
 			Matrix4* boneDst = renderData.transforms.data() + curBoneIdx;
 
-			// Copy transforms from mapped scene objects
-			UINT32 boneTfrmIdx = 0;
-			for (UINT32 i = 0; i < anim->numSceneObjects; i++)
+			// Far instances playing the same clip at a similar phase share an evaluated pose. Only instances with a
+			// single clip and no bone-mapped scene objects are eligible, as those are the only external inputs to the
+			// pose other than time.
+			size_t shareHash = 0;
+			bool shareable = false;
+			bool sharedPose = false;
+			if (anim->mLodTier >= 2 && anim->numSceneObjects == 0 && anim->numLayers == 1 &&
+				anim->layers[0].numStates == 1 && !anim->layers[0].states[0].disabled)
 			{
-				const AnimatedSceneObjectInfo& soInfo = anim->sceneObjectInfos[i];
-
-				if (soInfo.boneIdx == -1)
-					continue;
+				const AnimationState& state = anim->layers[0].states[0];
+
+				// Quantize the phase to the effective far-tier sample interval, so the sharing error stays within the
+				// error already introduced by the reduced update rate
+				float quantum = mUpdateRate * LOD_RATE_DIVISORS[2];
+				auto phase = (UINT32)(Math::abs(state.time) / quantum);
+
+				hash_combine(shareHash, (void*)anim->skeleton.get());
+				hash_combine(shareHash, (void*)state.curves.get());
+				hash_combine(shareHash, phase);
+				hash_combine(shareHash, state.weight);
+				hash_combine(shareHash, state.loop);
+				hash_combine(shareHash, mask->getHash());
+				shareable = true;
+
+				UINT32 donorStartIdx = 0;
+				{
+					Lock lock(mMutex);
+					auto iterFind = mSharedPoses.find(shareHash);
+					if (iterFind != mSharedPoses.end() && iterFind->second.second == numBones)
+					{
+						donorStartIdx = iterFind->second.first;
+						sharedPose = true;
+					}
+				}
 
-				boneDst[soInfo.boneIdx] = anim->sceneObjectTransforms[boneTfrmIdx];
-				anim->skeletonPose.hasOverride[soInfo.boneIdx] = true;
-				boneTfrmIdx++;
+				// Donor transforms were fully written before the entry was registered under the lock, so they can be
+				// safely copied outside of it
+				if (sharedPose)
+					memcpy(boneDst, renderData.transforms.data() + donorStartIdx, sizeof(Matrix4) * numBones);
 			}
 
-			// Animate bones
-			anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers, anim->numLayers);
+			if (!sharedPose)
+			{
+				memset(anim->skeletonPose.hasOverride, 0, sizeof(bool) * anim->skeletonPose.numBones);
+
+				// Copy transforms from mapped scene objects
+				UINT32 boneTfrmIdx = 0;
+				for (UINT32 i = 0; i < anim->numSceneObjects; i++)
+				{
+					const AnimatedSceneObjectInfo& soInfo = anim->sceneObjectInfos[i];
+
+					if (soInfo.boneIdx == -1)
+						continue;
+
+					boneDst[soInfo.boneIdx] = anim->sceneObjectTransforms[boneTfrmIdx];
+					anim->skeletonPose.hasOverride[soInfo.boneIdx] = true;
+					boneTfrmIdx++;
+				}
+
+				// Animate bones
+				anim->skeleton->getPose(boneDst, anim->skeletonPose, *mask, anim->layers, anim->numLayers);
+
+				if (shareable)
+				{
+					Lock lock(mMutex);
+					mSharedPoses[shareHash] = std::make_pair(curBoneIdx, numBones);
+				}
+			}
 
 			curBoneIdx += numBones;
 			hasAnimInfo = true;
@@ -298,11 +490,17 @@ namespace bs
 			const AnimationState& state = anim->layers[0].states[0];
 			if (!state.disabled)
 			{
-				UINT32 numCurves = (UINT32)state.curves->generic.size();
-				for (UINT32 i = 0; i < numCurves; i++)
+				// Clips with baked samples evaluate all generic curves in one pass over contiguous data
+				if (state.bakedCurves != nullptr)
+					state.bakedCurves->evaluateGeneric(state.time, state.loop, anim->genericCurveOutputs);
+				else
 				{
-					const TAnimationCurve<float>& curve = state.curves->generic[i].curve;
-					anim->genericCurveOutputs[i] = curve.evaluate(state.time, state.genericCaches[i], state.loop);
+					UINT32 numCurves = (UINT32)state.curves->generic.size();
+					for (UINT32 i = 0; i < numCurves; i++)
+					{
+						const TAnimationCurve<float>& curve = state.curves->generic[i].curve;
+						anim->genericCurveOutputs[i] = curve.evaluate(state.time, state.genericCaches[i], state.loop);
+					}
 				}
 			}
 		}
@@ -427,66 +625,100 @@ namespace bs
 			// Generate morph shape vertices
 			if (anim->morphChannelWeightsDirty || hasMorphCurves)
 			{
-				SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
+				// Each shape contributes to the final blend according to its resolved weight. When the renderer blends
+				// shapes on the GPU it only needs the weights, otherwise we blend the vertices here.
+				animInfo.morphShapeInfo.shapeWeights.resize(anim->numMorphShapes);
+				for (UINT32 i = 0; i < anim->numMorphShapes; i++)
+					animInfo.morphShapeInfo.shapeWeights[i] = anim->morphShapeInfos[i].finalWeight;
 
-				UINT8* bufferData = meshData->getData();
-				memset(bufferData, 0, meshData->getSize());
+				if (mGpuMorphBlending)
+					animInfo.morphShapeInfo.meshData = nullptr;
+				else
+				{
+					SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
 
-				UINT32 tempDataSize = (sizeof(Vector3) + sizeof(float)) * anim->numMorphVertices;
-				UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
-				memset(tempData, 0, tempDataSize);
+					UINT8* bufferData = meshData->getData();
+					memset(bufferData, 0, meshData->getSize());
 
-				Vector3* tempNormals = (Vector3*)tempData;
-				float* accumulatedWeight = (float*)(tempData + sizeof(Vector3) * anim->numMorphVertices);
+					// Scratch accumulation buffers, with position/normal entries padded to four floats so the blend kernel
+					// below can use vector operations
+					UINT32 tempDataSize = (sizeof(float) * 4 * 2 + sizeof(float)) * anim->numMorphVertices;
+					UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
+					memset(tempData, 0, tempDataSize);
 
-				UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
-				UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
+					float* tempPositions = (float*)tempData;
+					float* tempNormals = (float*)(tempData + sizeof(float) * 4 * anim->numMorphVertices);
+					float* accumulatedWeight = (float*)(tempData + sizeof(float) * 4 * 2 * anim->numMorphVertices);
 
-				UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
+					UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
+					UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
 
-				for (UINT32 i = 0; i < anim->numMorphShapes; i++)
-				{
-					const MorphShapeInfo& info = anim->morphShapeInfos[i];
-					float absWeight = Math::abs(info.finalWeight);
+					UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
 
-					if (absWeight < 0.0001f)
-						continue;
-
-					const Vector<MorphVertex>& morphVertices = info.shape->getVertices();
-					UINT32 numVertices = (UINT32)morphVertices.size();
-					for (UINT32 j = 0; j < numVertices; j++)
+					for (UINT32 i = 0; i < anim->numMorphShapes; i++)
 					{
-						const MorphVertex& vertex = morphVertices[j];
+						const MorphShapeInfo& info = anim->morphShapeInfos[i];
+						float absWeight = Math::abs(info.finalWeight);
+
+						if (absWeight < 0.0001f)
+							continue;
+
+						simd::float32x4 weight = simd::make_float(info.finalWeight);
+
+						// Note: Shapes store only the vertices they affect and scatter them according to the source vertex
+						// index, so the kernel blends one vertex per iteration, four components at a time. The delta loads
+						// read one float past each Vector3, which always lands on the following struct member and is
+						// therefore in bounds. The extra lane accumulates garbage into the unused fourth float of the
+						// scratch entries.
+						const Vector<MorphVertex>& morphVertices = info.shape->getVertices();
+						UINT32 numVertices = (UINT32)morphVertices.size();
+						for (UINT32 j = 0; j < numVertices; j++)
+						{
+							const MorphVertex& vertex = morphVertices[j];
+							float* posAccum = tempPositions + vertex.sourceIdx * 4;
+							float* nrmAccum = tempNormals + vertex.sourceIdx * 4;
 
-						Vector3* destPos = (Vector3*)(positions + vertex.sourceIdx * stride);
-						*destPos += vertex.deltaPosition * info.finalWeight;
+							simd::float32x4 deltaPos = simd::load_u((const float*)&vertex.deltaPosition);
+							simd::float32x4 posAccumVec = simd::load_u(posAccum);
+							simd::float32x4 newPos = posAccumVec + deltaPos * weight;
+							simd::store_u(posAccum, newPos);
 
-						tempNormals[vertex.sourceIdx] += vertex.deltaNormal * info.finalWeight;
-						accumulatedWeight[vertex.sourceIdx] += absWeight;
-					}
-				}
+							simd::float32x4 deltaNrm = simd::load_u((const float*)&vertex.deltaNormal);
+							simd::float32x4 nrmAccumVec = simd::load_u(nrmAccum);
+							simd::float32x4 newNrm = nrmAccumVec + deltaNrm * weight;
+							simd::store_u(nrmAccum, newNrm);
 
-				for (UINT32 i = 0; i < anim->numMorphVertices; i++)
-				{
-					PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
+							accumulatedWeight[vertex.sourceIdx] += absWeight;
+						}
+					}
 
-					if (accumulatedWeight[i] > 0.0001f)
+					// Resolve the accumulated values straight into the vertex upload buffer
+					for (UINT32 i = 0; i < anim->numMorphVertices; i++)
 					{
-						Vector3 normal = tempNormals[i] / accumulatedWeight[i];
-						normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
+						Vector3* destPos = (Vector3*)(positions + i * stride);
+						memcpy(destPos, tempPositions + i * 4, sizeof(Vector3));
 
-						MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
-						destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
-					}
-					else
-					{
-						*destNrm = { { 127, 127, 127, 0 } };
+						PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
+
+						if (accumulatedWeight[i] > 0.0001f)
+						{
+							Vector3 normal(tempNormals[i * 4 + 0], tempNormals[i * 4 + 1], tempNormals[i * 4 + 2]);
+							normal /= accumulatedWeight[i];
+							normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
+
+							MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
+							destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
+						}
+						else
+						{
+							*destNrm = { { 127, 127, 127, 0 } };
+						}
 					}
-				}
 
-				bs_stack_free(tempData);
+					bs_stack_free(tempData);
 
-				animInfo.morphShapeInfo.meshData = meshData;
+					animInfo.morphShapeInfo.meshData = meshData;
+				}
 
 				animInfo.morphShapeInfo.version++;
 				anim->morphChannelWeightsDirty = false;
@@ -30,7 +30,12 @@ namespace bs
 		/** Contains data about a calculated morph shape. */
 		struct MorphShapeInfo
 		{
+			/** Blended morph vertices, ready for upload. Null when the renderer blends morph shapes on the GPU. */
 			SPtr<MeshData> meshData;
+
+			/** Final blend weight of every morph shape. Used by renderers that blend morph shapes on the GPU. */
+			Vector<float> shapeWeights;
+
 			UINT32 version;
 		};
 
@@ -70,6 +75,31 @@ namespace bs
 		 */
 		void setUpdateRate(UINT32 fps);
 
+		/**
+		 * Determines how far around each playing clip's playhead segments of segmented clips are kept resident.
+		 * Segments within @p prefetchAhead seconds in front of a playhead are loaded in advance, while segments more
+		 * than @p evictBehind seconds behind it are released so they may be unloaded. See AnimationClip::setSegments().
+		 *
+		 * @param[in]	prefetchAhead	Seconds ahead of the playhead to keep loaded. Default is 2.
+		 * @param[in]	evictBehind		Seconds behind the playhead before a segment is released. Default is 1.
+		 */
+		void setSegmentMargins(float prefetchAhead, float evictBehind);
+
+		/**
+		 * Enables or disables crowd animation level of detail. When enabled, animations far away from all cameras are
+		 * evaluated at a reduced rate, reusing the previously evaluated pose in-between, and animations past the far
+		 * distance additionally share evaluated poses with other instances playing the same clip at a similar phase.
+		 * Distance is measured using the bounds provided through Animation::setBounds(), so only animations with culling
+		 * enabled are affected. Use Animation::setLodMasks() to also reduce the number of evaluated bones per tier.
+		 *
+		 * @param[in]	enable			Enables the crowd level of detail when true. Default is off.
+		 * @param[in]	mediumDistance	Distance from the nearest camera at which animation starts updating at half the
+		 *								regular rate. Default is 30 units.
+		 * @param[in]	farDistance		Distance from the nearest camera at which animation updates at a quarter of the
+		 *								regular rate and poses may be shared between instances. Default is 60 units.
+		 */
+		void setCrowdLod(bool enable, float mediumDistance = 30.0f, float farDistance = 60.0f);
+
 		/**
 		 * Evaluates animations for all animated objects, and returns the evaluated skeleton bone poses and morph shape
 		 * meshes that can be passed along to the renderer.
@@ -121,16 +151,26 @@ namespace bs
 		UnorderedMap<UINT64, Animation*> mAnimations;
 		
 		float mUpdateRate;
+		float mSegmentPrefetch = 2.0f;
+		float mSegmentEvict = 1.0f;
 		float mAnimationTime;
 		float mLastAnimationUpdateTime;
 		float mNextAnimationUpdateTime;
 		bool mPaused;
 
+		bool mCrowdLodEnabled = false;
+		float mCrowdLodMediumDist = 30.0f;
+		float mCrowdLodFarDist = 60.0f;
+		UINT32 mUpdateIdx = 0;
+
 		SPtr<VertexDataDesc> mBlendShapeVertexDesc;
+		bool mGpuMorphBlending = false;
 
 		// Animation thread
 		Vector<SPtr<AnimationProxy>> mProxies;
 		Vector<ConvexVolume> mCullFrustums;
+		Vector<Vector3> mCameraPositions;
+		UnorderedMap<size_t, std::pair<UINT32, UINT32>> mSharedPoses;
 		EvaluatedAnimationData mAnimData[CoreThread::NUM_SYNC_BUFFERS + 1];
 
 		UINT32 mPoseReadBufferIdx;
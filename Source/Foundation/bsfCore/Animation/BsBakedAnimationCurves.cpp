@@ -0,0 +1,160 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Animation/BsBakedAnimationCurves.h"
+#include "Animation/BsAnimationClip.h"
+#include "Animation/BsAnimationUtility.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	BakedAnimationCurves::BakedAnimationCurves(const AnimationCurves& curves, UINT32 sampleRate, float length)
+		: mNumPositionCurves((UINT32)curves.position.size())
+		, mNumRotationCurves((UINT32)curves.rotation.size())
+		, mNumScaleCurves((UINT32)curves.scale.size())
+		, mNumGenericCurves((UINT32)curves.generic.size())
+		, mSampleRate(std::max(1U, sampleRate))
+		, mLength(length)
+	{
+		mNumSamples = std::max(2U, (UINT32)(length * mSampleRate) + 1);
+
+		mPositions.resize((size_t)mNumSamples * mNumPositionCurves * 3);
+		mRotations.resize((size_t)mNumSamples * mNumRotationCurves * 4);
+		mScales.resize((size_t)mNumSamples * mNumScaleCurves * 3);
+		mGeneric.resize((size_t)mNumSamples * mNumGenericCurves);
+
+		UINT32 positionStride = mNumPositionCurves * 3;
+		UINT32 rotationStride = mNumRotationCurves * 4;
+		UINT32 scaleStride = mNumScaleCurves * 3;
+
+		for (UINT32 i = 0; i < mNumSamples; i++)
+		{
+			float time = std::min(i / (float)mSampleRate, length);
+
+			float* positionDst = mPositions.data() + (size_t)i * positionStride;
+			for (UINT32 j = 0; j < mNumPositionCurves; j++)
+			{
+				Vector3 value = curves.position[j].curve.evaluate(time, false);
+				memcpy(positionDst + j * 3, &value, sizeof(Vector3));
+			}
+
+			float* rotationDst = mRotations.data() + (size_t)i * rotationStride;
+			for (UINT32 j = 0; j < mNumRotationCurves; j++)
+			{
+				Quaternion value = curves.rotation[j].curve.evaluate(time, false);
+
+				// Ensure neighboring samples lie on the same hemisphere so a raw component lerp between them yields the
+				// shortest path
+				if (i > 0)
+				{
+					Quaternion prev;
+					memcpy(&prev, rotationDst - rotationStride + j * 4, sizeof(Quaternion));
+
+					if (value.dot(prev) < 0.0f)
+						value = -value;
+				}
+
+				memcpy(rotationDst + j * 4, &value, sizeof(Quaternion));
+			}
+
+			float* scaleDst = mScales.data() + (size_t)i * scaleStride;
+			for (UINT32 j = 0; j < mNumScaleCurves; j++)
+			{
+				Vector3 value = curves.scale[j].curve.evaluate(time, false);
+				memcpy(scaleDst + j * 3, &value, sizeof(Vector3));
+			}
+
+			float* genericDst = mGeneric.data() + (size_t)i * mNumGenericCurves;
+			for (UINT32 j = 0; j < mNumGenericCurves; j++)
+				genericDst[j] = curves.generic[j].curve.evaluate(time, false);
+		}
+	}
+
+	void BakedAnimationCurves::evaluatePosition(float time, bool loop, Vector3* output) const
+	{
+		if (mNumPositionCurves == 0)
+			return;
+
+		UINT32 leftSample, rightSample;
+		float t;
+		findSamples(time, loop, leftSample, rightSample, t);
+
+		UINT32 stride = mNumPositionCurves * 3;
+		lerpBatch(mPositions.data() + (size_t)leftSample * stride, mPositions.data() + (size_t)rightSample * stride,
+			t, stride, (float*)output);
+	}
+
+	void BakedAnimationCurves::evaluateRotation(float time, bool loop, Quaternion* output) const
+	{
+		if (mNumRotationCurves == 0)
+			return;
+
+		UINT32 leftSample, rightSample;
+		float t;
+		findSamples(time, loop, leftSample, rightSample, t);
+
+		UINT32 stride = mNumRotationCurves * 4;
+		lerpBatch(mRotations.data() + (size_t)leftSample * stride, mRotations.data() + (size_t)rightSample * stride,
+			t, stride, (float*)output);
+
+		for (UINT32 i = 0; i < mNumRotationCurves; i++)
+			output[i].normalize();
+	}
+
+	void BakedAnimationCurves::evaluateScale(float time, bool loop, Vector3* output) const
+	{
+		if (mNumScaleCurves == 0)
+			return;
+
+		UINT32 leftSample, rightSample;
+		float t;
+		findSamples(time, loop, leftSample, rightSample, t);
+
+		UINT32 stride = mNumScaleCurves * 3;
+		lerpBatch(mScales.data() + (size_t)leftSample * stride, mScales.data() + (size_t)rightSample * stride,
+			t, stride, (float*)output);
+	}
+
+	void BakedAnimationCurves::evaluateGeneric(float time, bool loop, float* output) const
+	{
+		if (mNumGenericCurves == 0)
+			return;
+
+		UINT32 leftSample, rightSample;
+		float t;
+		findSamples(time, loop, leftSample, rightSample, t);
+
+		lerpBatch(mGeneric.data() + (size_t)leftSample * mNumGenericCurves,
+			mGeneric.data() + (size_t)rightSample * mNumGenericCurves, t, mNumGenericCurves, output);
+	}
+
+	void BakedAnimationCurves::findSamples(float time, bool loop, UINT32& leftSample, UINT32& rightSample, float& t) const
+	{
+		AnimationUtility::wrapTime(time, 0.0f, mLength, loop);
+
+		float samplePos = time * mSampleRate;
+
+		leftSample = std::min((UINT32)samplePos, mNumSamples - 1);
+		rightSample = std::min(leftSample + 1, mNumSamples - 1);
+
+		t = Math::clamp01(samplePos - leftSample);
+	}
+
+	void BakedAnimationCurves::lerpBatch(const float* left, const float* right, float t, UINT32 count, float* output)
+	{
+		UINT32 i = 0;
+		UINT32 vecCount = count - (count % 4);
+
+		simd::float32x4 vecT = simd::make_float(t);
+		for (; i < vecCount; i += 4)
+		{
+			simd::float32x4 a = simd::load_u(left + i);
+			simd::float32x4 b = simd::load_u(right + i);
+
+			simd::float32x4 result = a + (b - a) * vecT;
+			simd::store_u(output + i, result);
+		}
+
+		for (; i < count; i++)
+			output[i] = left[i] + (right[i] - left[i]) * t;
+	}
+}
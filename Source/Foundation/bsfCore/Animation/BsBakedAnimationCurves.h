@@ -0,0 +1,110 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsVector3.h"
+#include "Math/BsQuaternion.h"
+
+namespace bs
+{
+	struct AnimationCurves;
+
+	/** @addtogroup Animation-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Contains a set of animation curves resampled at uniform time intervals and stored in structure-of-arrays form.
+	 * Evaluation of a single curve becomes an index calculation followed by a linear interpolation, and all curves of a
+	 * single type are evaluated together for one point in time in vectorized batches. This trades memory and some
+	 * precision (the cubic hermite spline between keyframes is approximated by linear segments) for significantly cheaper
+	 * evaluation. Samples are laid out per time step, so data accessed when evaluating a single time is contiguous.
+	 *
+	 * Baked curves are expected to be immutable once created so they may be freely used on multiple threads.
+	 */
+	class BS_CORE_EXPORT BakedAnimationCurves
+	{
+	public:
+		BakedAnimationCurves() = default;
+
+		/**
+		 * Creates a baked version of the provided set of animation curves.
+		 *
+		 * @param[in]	curves		Curves to resample.
+		 * @param[in]	sampleRate	Number of samples per second to bake the curves at.
+		 * @param[in]	length		Length of the curves, in seconds.
+		 */
+		BakedAnimationCurves(const AnimationCurves& curves, UINT32 sampleRate, float length);
+
+		/**
+		 * Evaluates all position curves at the specified time.
+		 *
+		 * @param[in]	time	Time to evaluate the curves at.
+		 * @param[in]	loop	If true the time will loop (wrap) past curve start/end, otherwise it will be clamped.
+		 * @param[out]	output	Pre-allocated buffer receiving one value per position curve, in the same order as the
+		 *						curves in the set this object was created from.
+		 */
+		void evaluatePosition(float time, bool loop, Vector3* output) const;
+
+		/**
+		 * Evaluates all rotation curves at the specified time. Output quaternions are normalized.
+		 *
+		 * @see		evaluatePosition
+		 */
+		void evaluateRotation(float time, bool loop, Quaternion* output) const;
+
+		/**
+		 * Evaluates all scale curves at the specified time.
+		 *
+		 * @see		evaluatePosition
+		 */
+		void evaluateScale(float time, bool loop, Vector3* output) const;
+
+		/**
+		 * Evaluates all generic curves at the specified time.
+		 *
+		 * @see		evaluatePosition
+		 */
+		void evaluateGeneric(float time, bool loop, float* output) const;
+
+		/** Returns the number of samples per second the curves were baked at. */
+		UINT32 getSampleRate() const { return mSampleRate; }
+
+		/** Returns the number of uniformly spaced samples each curve was baked into. */
+		UINT32 getNumSamples() const { return mNumSamples; }
+
+	private:
+		/**
+		 * Converts a time value into a pair of sample indices to interpolate between, along with the interpolation
+		 * factor between them.
+		 */
+		void findSamples(float time, bool loop, UINT32& leftSample, UINT32& rightSample, float& t) const;
+
+		/** Linearly interpolates between two contiguous batches of floats, in vectorized chunks. */
+		static void lerpBatch(const float* left, const float* right, float t, UINT32 count, float* output);
+
+		/** Per-sample blocks of float triplets, one per position curve. */
+		Vector<float> mPositions;
+
+		/** Per-sample blocks of float quadruplets, one per rotation curve. Neighboring samples share a hemisphere. */
+		Vector<float> mRotations;
+
+		/** Per-sample blocks of float triplets, one per scale curve. */
+		Vector<float> mScales;
+
+		/** Per-sample blocks of floats, one per generic curve. */
+		Vector<float> mGeneric;
+
+		UINT32 mNumPositionCurves = 0;
+		UINT32 mNumRotationCurves = 0;
+		UINT32 mNumScaleCurves = 0;
+		UINT32 mNumGenericCurves = 0;
+
+		UINT32 mNumSamples = 0;
+		UINT32 mSampleRate = 1;
+		float mLength = 0.0f;
+	};
+
+	/** @} */
+}
@@ -1,7 +1,9 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Animation/BsSkeleton.h"
+#include "Math/BsSIMD.h"
 #include "Animation/BsAnimationClip.h"
+#include "Animation/BsBakedAnimationCurves.h"
 #include "Animation/BsSkeletonMask.h"
 #include "Private/RTTI/BsSkeletonRTTI.h"
 
@@ -98,6 +100,35 @@ namespace bs
 			mBoneInfo[i].name = bones[i].name;
 			mBoneInfo[i].parent = bones[i].parent;
 		}
+
+		buildBoneOrder();
+	}
+
+	void Skeleton::buildBoneOrder()
+	{
+		mBoneOrder.clear();
+		mBoneOrder.reserve(mNumBones);
+
+		Vector<bool> added(mNumBones, false);
+		Vector<UINT32> chain;
+		for (UINT32 i = 0; i < mNumBones; i++)
+		{
+			// Walk up the hierarchy collecting any bones not yet in the order, then append them parent-first
+			chain.clear();
+
+			UINT32 current = i;
+			while (current != (UINT32)-1 && !added[current])
+			{
+				chain.push_back(current);
+				current = mBoneInfo[current].parent;
+			}
+
+			for (auto iter = chain.rbegin(); iter != chain.rend(); ++iter)
+			{
+				mBoneOrder.push_back(*iter);
+				added[*iter] = true;
+			}
+		}
 	}
 
 	Skeleton::~Skeleton()
@@ -128,6 +159,7 @@ namespace bs
 
 			AnimationState state;
 			state.curves = clip.getCurves();
+			state.bakedCurves = clip._getBakedSamples();
 			state.boneToCurveMapping = boneToCurveMapping.data();
 			state.loop = loop;
 			state.weight = 1.0f;
@@ -204,6 +236,43 @@ namespace bs
 				if (Math::approxEquals(normWeight, 0.0f))
 					continue;
 
+				// Evaluate all curves of the state for the current time in one pass, so the per-bone loop below only
+				// needs to blend already-evaluated values. Clips with baked samples get evaluated in vectorized batches.
+				UINT32 numPosCurves = (UINT32)state.curves->position.size();
+				UINT32 numRotCurves = (UINT32)state.curves->rotation.size();
+				UINT32 numScaleCurves = (UINT32)state.curves->scale.size();
+
+				Vector3* evalPositions = bs_stack_alloc<Vector3>(numPosCurves);
+				Quaternion* evalRotations = bs_stack_alloc<Quaternion>(numRotCurves);
+				Vector3* evalScales = bs_stack_alloc<Vector3>(numScaleCurves);
+
+				if (state.bakedCurves != nullptr)
+				{
+					state.bakedCurves->evaluatePosition(state.time, state.loop, evalPositions);
+					state.bakedCurves->evaluateRotation(state.time, state.loop, evalRotations);
+					state.bakedCurves->evaluateScale(state.time, state.loop, evalScales);
+				}
+				else
+				{
+					for (UINT32 k = 0; k < numPosCurves; k++)
+					{
+						evalPositions[k] =
+							state.curves->position[k].curve.evaluate(state.time, state.positionCaches[k], state.loop);
+					}
+
+					for (UINT32 k = 0; k < numRotCurves; k++)
+					{
+						evalRotations[k] =
+							state.curves->rotation[k].curve.evaluate(state.time, state.rotationCaches[k], state.loop);
+					}
+
+					for (UINT32 k = 0; k < numScaleCurves; k++)
+					{
+						evalScales[k] =
+							state.curves->scale[k].curve.evaluate(state.time, state.scaleCaches[k], state.loop);
+					}
+				}
+
 				for (UINT32 k = 0; k < mNumBones; k++)
 				{
 					if (!mask.isEnabled(k))
@@ -213,8 +282,7 @@ namespace bs
 					UINT32 curveIdx = mapping.position;
 					if (curveIdx != (UINT32)-1)
 					{
-						const TAnimationCurve<Vector3>& curve = state.curves->position[curveIdx].curve;
-						localPose.positions[k] += curve.evaluate(state.time, state.positionCaches[curveIdx], state.loop) * normWeight;
+						localPose.positions[k] += evalPositions[curveIdx] * normWeight;
 
 						localPose.hasOverride[k] = false;
 						hasAnimCurve[k] = true;
@@ -223,8 +291,7 @@ namespace bs
 					curveIdx = mapping.scale;
 					if (curveIdx != (UINT32)-1)
 					{
-						const TAnimationCurve<Vector3>& curve = state.curves->scale[curveIdx].curve;
-						localPose.scales[k] *= curve.evaluate(state.time, state.scaleCaches[curveIdx], state.loop) * normWeight;
+						localPose.scales[k] *= evalScales[curveIdx] * normWeight;
 
 						localPose.hasOverride[k] = false;
 						hasAnimCurve[k] = true;
@@ -239,10 +306,7 @@ namespace bs
 							if (!isAssigned)
 								localPose.rotations[k] = Quaternion::IDENTITY;
 
-							const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
-
-							Quaternion value = curve.evaluate(state.time, state.rotationCaches[curveIdx], state.loop);
-							value = Quaternion::lerp(normWeight, Quaternion::IDENTITY, value);
+							Quaternion value = Quaternion::lerp(normWeight, Quaternion::IDENTITY, evalRotations[curveIdx]);
 
 							localPose.rotations[k] *= value;
 							localPose.hasOverride[k] = false;
@@ -254,8 +318,7 @@ namespace bs
 						curveIdx = mapping.rotation;
 						if (curveIdx != (UINT32)-1)
 						{
-							const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
-							Quaternion value = curve.evaluate(state.time, state.rotationCaches[curveIdx], state.loop) * normWeight;
+							Quaternion value = evalRotations[curveIdx] * normWeight;
 
 							if (value.dot(localPose.rotations[k]) < 0.0f)
 								value = -value;
@@ -266,6 +329,10 @@ namespace bs
 						}
 					}
 				}
+
+				bs_stack_free(evalScales);
+				bs_stack_free(evalRotations);
+				bs_stack_free(evalPositions);
 			}
 		}
 
@@ -281,10 +348,6 @@ namespace bs
 		}
 
 		// Calculate local pose matrices
-		UINT32 isGlobalBytes = sizeof(bool) * mNumBones;
-		bool* isGlobal = (bool*)bs_stack_alloc(isGlobalBytes);
-		memset(isGlobal, 0, isGlobalBytes);
-
 		for(UINT32 i = 0; i < mNumBones; i++)
 		{
 			bool isAssigned = localPose.rotations[i].w != 0.0f;
@@ -293,44 +356,30 @@ namespace bs
 			else
 				localPose.rotations[i].normalize();
 
+			// Overriden bones are provided in global space by the caller
 			if (localPose.hasOverride[i])
-			{
-				isGlobal[i] = true;
 				continue;
-			}
 
 			pose[i] = Matrix4::TRS(localPose.positions[i], localPose.rotations[i], localPose.scales[i]);
 		}
 
-		// Calculate global poses
-		// Note: For a possible performance improvement consider sorting bones in such order so that parents (and overrides)
-		// always come before children, we no isGlobal check is needed.
-		std::function<void(UINT32)> calcGlobal = [&](UINT32 boneIdx)
+		// Calculate global poses. Bones are visited in an order where parents (and overrides) always come before
+		// children, so a single linear pass suffices.
+		for (UINT32 i = 0; i < mNumBones; i++)
 		{
+			UINT32 boneIdx = mBoneOrder[i];
+			if (localPose.hasOverride[boneIdx])
+				continue;
+
 			UINT32 parentBoneIdx = mBoneInfo[boneIdx].parent;
 			if (parentBoneIdx == (UINT32)-1)
-			{
-				isGlobal[boneIdx] = true;
-				return;
-			}
-
-			if (!isGlobal[parentBoneIdx])
-				calcGlobal(parentBoneIdx);
-
-			pose[boneIdx] = pose[parentBoneIdx] * pose[boneIdx];
-			isGlobal[boneIdx] = true;
-		};
+				continue;
 
-		for (UINT32 i = 0; i < mNumBones; i++)
-		{
-			if (!isGlobal[i])
-				calcGlobal(i);
+			pose[boneIdx] = simd::concat(pose[parentBoneIdx], pose[boneIdx]);
 		}
 
-		for (UINT32 i = 0; i < mNumBones; i++)
-			pose[i] = pose[i] * mInvBindPoses[i];
+		simd::concat(pose, mInvBindPoses, mNumBones, pose);
 
-		bs_stack_free(isGlobal);
 		bs_stack_free(hasAnimCurve);
 	}
 
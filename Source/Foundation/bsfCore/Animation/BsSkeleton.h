@@ -13,6 +13,7 @@
 namespace bs
 {
 	class SkeletonMask;
+	class BakedAnimationCurves;
 
 	/** @addtogroup Animation-Internal
 	 *  @{
@@ -43,6 +44,7 @@ namespace bs
 	struct AnimationState
 	{
 		SPtr<AnimationCurves> curves; /**< All curves in the animation clip. */
+		SPtr<BakedAnimationCurves> bakedCurves; /**< Resampled version of @p curves, if the clip has baking enabled. */
 		AnimationCurveMapping* boneToCurveMapping; /**< Mapping of bone indices to curve indices for quick lookup .*/
 		AnimationCurveMapping* soToCurveMapping; /**< Mapping of scene object indices to curve indices for quick lookup. */
 
@@ -177,10 +179,17 @@ namespace bs
 		Skeleton();
 		Skeleton(BONE_DESC* bones, UINT32 numBones);
 
+		/**
+		 * Builds a bone traversal order in which parents are always visited before their children, allowing global
+		 * poses to be resolved in a single linear pass.
+		 */
+		void buildBoneOrder();
+
 		UINT32 mNumBones = 0;
 		Transform* mBoneTransforms = nullptr;
 		Matrix4* mInvBindPoses = nullptr;
 		SkeletonBoneInfo* mBoneInfo = nullptr;
+		Vector<UINT32> mBoneOrder;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -17,6 +17,21 @@ namespace bs
 		return !mIsDisabled[boneIdx];
 	}
 
+	size_t SkeletonMask::getHash() const
+	{
+		size_t hash = 0;
+
+		// Trailing enabled bones don't affect the mask, skip them so masks of different lengths can still match
+		UINT32 numBones = (UINT32)mIsDisabled.size();
+		while (numBones > 0 && !mIsDisabled[numBones - 1])
+			numBones--;
+
+		for (UINT32 i = 0; i < numBones; i++)
+			hash_combine(hash, (bool)mIsDisabled[i]);
+
+		return hash;
+	}
+
 	SkeletonMaskBuilder::SkeletonMaskBuilder(const SPtr<Skeleton>& skeleton)
 		:mSkeleton(skeleton), mMask(skeleton->getNumBones())
 	{ }
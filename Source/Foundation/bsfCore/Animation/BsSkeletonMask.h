@@ -20,12 +20,15 @@ namespace bs
 		SkeletonMask() {}
 		SkeletonMask(UINT32 numBones);
 
-		/** 
+		/**
 		 * Checks is the bone at the specified index enabled. Caller is expected to know which skeleton is the skeleton
-		 * mask tied with, in order to determine the bone index. 
+		 * mask tied with, in order to determine the bone index.
 		 */
 		bool isEnabled(UINT32 boneIdx) const;
 
+		/** Returns a hash of the mask contents. Masks disabling the same set of bones hash identically. */
+		size_t getHash() const;
+
 	private:
 		friend class SkeletonMaskBuilder;
 
@@ -66,6 +66,14 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:AllDevices,pr:getter)
 		virtual const Vector<AudioDevice>& getAllDevices() const = 0;
 
+		/**
+		 * Determines the maximum number of audio sources that are mixed at once. If more sources are playing than this,
+		 * the least audible ones (ranked by priority, then by distance-attenuated volume) become virtual: they continue
+		 * tracking playback time so they can resume seamlessly when they become audible again, but consume no mixing
+		 * resources. Zero (the default) mixes all playing sources. Not all backends support this setting.
+		 */
+		virtual void setMaxRealVoices(UINT32 numVoices) { }
+
 		/** @name Internal
 		 *  @{
 		 */
@@ -26,9 +26,12 @@
 #include "Managers/BsGpuProgramManager.h"
 #include "Managers/BsMeshManager.h"
 #include "Material/BsMaterialManager.h"
+#include "Material/BsShaderPrewarm.h"
 #include "Managers/BsRenderWindowManager.h"
 #include "Renderer/BsRenderer.h"
 #include "Utility/BsDeferredCallManager.h"
+#include "Utility/BsGpuReadback.h"
+#include "Utility/BsScreenCapture.h"
 #include "CoreThread/BsCoreThread.h"
 #include "Localization/BsStringTableManager.h"
 #include "Profiling/BsProfilingManager.h"
@@ -38,6 +41,7 @@
 #include "Threading/BsThreadPool.h"
 #include "Threading/BsTaskScheduler.h"
 #include "Profiling/BsRenderStats.h"
+#include "RenderAPI/BsGpuMemoryBudget.h"
 #include "Utility/BsMessageHandler.h"
 #include "Managers/BsResourceListenerManager.h"
 #include "Managers/BsRenderStateManager.h"
@@ -47,6 +51,7 @@
 #include "Audio/BsAudioManager.h"
 #include "Audio/BsAudio.h"
 #include "Animation/BsAnimationManager.h"
+#include "Particles/BsParticleManager.h"
 #include "Renderer/BsParamBlocks.h"
 
 namespace bs
@@ -54,7 +59,7 @@ namespace bs
 	constexpr UINT32 CoreApplication::MAX_FIXED_UPDATES_PER_FRAME;
 
 	CoreApplication::CoreApplication(START_UP_DESC desc)
-		: mPrimaryWindow(nullptr), mStartUpDesc(desc), mRendererPlugin(nullptr), mIsFrameRenderingFinished(true)
+		: mPrimaryWindow(nullptr), mStartUpDesc(desc), mRendererPlugin(nullptr)
 		, mSimThreadId(BS_THREAD_CURRENT_ID), mRunMainLoop(false)
 	{
 		// Ensure all errors are reported properly
@@ -67,6 +72,7 @@ namespace bs
 		mPrimaryWindow = nullptr;
 
 		Importer::shutDown();
+		ShaderPrewarm::shutDown();
 		MaterialManager::shutDown();
 		MeshManager::shutDown();
 		ProfilerGPU::shutDown();
@@ -83,9 +89,13 @@ namespace bs
 		// Audio manager must be released before the ResourceListenerManager, as any one-shot audio sources need to be
 		// destroyed since they implement the IResourceListener interface
 		AudioManager::shutDown();
+		ScreenCapture::shutDown();
+		GpuReadback::shutDown();
 		ResourceListenerManager::shutDown();
 		RenderStateManager::shutDown();
 
+		ParticleManager::shutDown();
+
 		// This must be done after all resources are released since it will unload the physics plugin, and some resources
 		// might be instances of types from that plugin.
 		AnimationManager::shutDown();
@@ -111,6 +121,7 @@ namespace bs
 		DeferredCallManager::shutDown();
 
 		CoreThread::shutDown();
+		GpuMemoryBudget::shutDown();
 		RenderStats::shutDown();
 		TaskScheduler::shutDown();
 		ThreadPool::shutDown();
@@ -140,6 +151,7 @@ namespace bs
 		TaskScheduler::startUp();
 		TaskScheduler::instance().removeWorker();
 		RenderStats::startUp();
+		GpuMemoryBudget::startUp();
 		CoreThread::startUp();
 		StringTableManager::startUp();
 		DeferredCallManager::startUp();
@@ -149,6 +161,8 @@ namespace bs
 		GameObjectManager::startUp();
 		Resources::startUp();
 		ResourceListenerManager::startUp();
+		GpuReadback::startUp();
+		ScreenCapture::startUp();
 		GpuProgramManager::startUp();
 		RenderStateManager::startUp();
 		ct::GpuProgramManager::startUp();
@@ -169,10 +183,12 @@ namespace bs
 		ProfilerGPU::startUp();
 		MeshManager::startUp();
 		MaterialManager::startUp();
+		ShaderPrewarm::startUp();
 		Importer::startUp();
 		AudioManager::startUp(mStartUpDesc.audio);
 		PhysicsManager::startUp(mStartUpDesc.physics, isEditor());
 		AnimationManager::startUp();
+		ParticleManager::startUp();
 
 		for (auto& importerName : mStartUpDesc.importers)
 			loadPlugin(importerName);
@@ -209,7 +225,13 @@ namespace bs
 					}
 				}
 
-				mLastFrameTime = currentTime;
+				// If we're keeping up with the requested cadence, advance the schedule by exactly one step instead of
+				// using the measured time. This prevents sleep/spin inaccuracies from accumulating into drift, keeping
+				// frame starts locked to the cadence. If we fell behind, reset the schedule to the current time.
+				if (currentTime - nextFrameTime < mFrameStep)
+					mLastFrameTime = nextFrameTime;
+				else
+					mLastFrameTime = currentTime;
 			}
 
 			gProfilerCPU().beginThread("Sim");
@@ -256,6 +278,9 @@ namespace bs
 						float stepSeconds = step / 1000000.0f;
 
 						PROFILE_CALL(gSceneManager()._fixedUpdate(), "Scene fixed update");
+
+						// Deliver any transform changes made during fixed update before stepping the simulation
+						gSceneManager()._flushTransformJournal();
 						gPhysics().fixedUpdate(stepSeconds);
 
 						simulationAmount -= step;
@@ -265,6 +290,11 @@ namespace bs
 			}
 
 			PROFILE_CALL(gSceneManager()._update(), "Scene update");
+
+			// Deliver transform changes made during component updates before audio/physics consume them. Changes made
+			// later in the frame (plugins, postUpdate, animation) are delivered with the end-of-tick flush in
+			// SceneManager::_updateCoreObjectTransforms().
+			gSceneManager()._flushTransformJournal();
 			gAudio()._update();
 			gPhysics().update();
 
@@ -278,9 +308,17 @@ namespace bs
 			// animation we sent on the previous frame, and we want the scene information to match to what is displayed.
 			const EvaluatedAnimationData* animData = AnimationManager::instance().update();
 
+			// Simulate particles alongside the animation, for the same reason as above
+			ParticleManager::instance().simulate(gTime().getFrameDelta());
+
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
+			// Capture a frame of any in-progress screen capture, then advance queued GPU readbacks and deliver any
+			// that completed
+			ScreenCapture::instance()._update();
+			GpuReadback::instance()._update();
+
 			// Trigger any renderer task callbacks (should be done before scene object update, or core sync, so objects have
 			// a chance to respond to the callback).
 			RendererManager::instance().getActive()->update();
@@ -288,21 +326,21 @@ namespace bs
 			gSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(animData), "Render");
 
-			// Core and sim thread run in lockstep. This will result in a larger input latency than if I was 
-			// running just a single thread. Latency becomes worse if the core thread takes longer than sim 
-			// thread, in which case sim thread needs to wait. Optimal solution would be to get an average 
-			// difference between sim/core thread and start the sim thread a bit later so they finish at nearly the same time.
+			// Core and sim thread run in lockstep by default (mMaxQueuedFrames is 1). This will result in a larger
+			// input latency than if I was running just a single thread. Latency becomes worse if the core thread
+			// takes longer than sim thread, in which case sim thread needs to wait. Raising mMaxQueuedFrames lets
+			// the sim thread queue additional frames before waiting, trading further latency for throughput.
 			{
 				Lock lock(mFrameRenderingFinishedMutex);
 
-				while(!mIsFrameRenderingFinished)
+				while(mNumQueuedFrames >= mMaxQueuedFrames)
 				{
 					TaskScheduler::instance().addWorker();
 					mFrameRenderingFinishedCondition.wait(lock);
 					TaskScheduler::instance().removeWorker();
 				}
 
-				mIsFrameRenderingFinished = false;
+				mNumQueuedFrames++;
 			}
 
 			gCoreThread().queueCommand(std::bind(&CoreApplication::beginCoreProfiling, this), CTQF_InternalQueue);
@@ -315,17 +353,18 @@ namespace bs
 			gCoreThread().queueCommand(std::bind(&CoreApplication::frameRenderingFinishedCallback, this), CTQF_InternalQueue);
 
 			gCoreThread().queueCommand(std::bind(&ct::QueryManager::_update, ct::QueryManager::instancePtr()), CTQF_InternalQueue);
+			gCoreThread().queueCommand(std::bind(&GpuMemoryBudget::_update, GpuMemoryBudget::instancePtr()), CTQF_InternalQueue);
 			gCoreThread().queueCommand(std::bind(&CoreApplication::endCoreProfiling, this), CTQF_InternalQueue);
 
 			gProfilerCPU().endThread();
 			gProfiler()._update();
 		}
 
-		// Wait until last core frame is finished before exiting
+		// Wait until all queued core frames are finished before exiting
 		{
 			Lock lock(mFrameRenderingFinishedMutex);
 
-			while (!mIsFrameRenderingFinished)
+			while (mNumQueuedFrames > 0)
 			{
 				TaskScheduler::instance().addWorker();
 				mFrameRenderingFinishedCondition.wait(lock);
@@ -360,11 +399,17 @@ namespace bs
 		mFrameStep = (UINT64)1000000 / limit;
 	}
 
+	void CoreApplication::setMaxQueuedFrames(UINT32 numFrames)
+	{
+		mMaxQueuedFrames = Math::clamp(numFrames, 1U, 3U);
+	}
+
 	void CoreApplication::frameRenderingFinishedCallback()
 	{
 		Lock lock(mFrameRenderingFinishedMutex);
 
-		mIsFrameRenderingFinished = true;
+		assert(mNumQueuedFrames > 0);
+		mNumQueuedFrames--;
 		mFrameRenderingFinishedCondition.notify_one();
 	}
 
@@ -54,6 +54,14 @@ namespace bs
 			/** Changes the maximum FPS the application is allowed to run in. Zero means unlimited. */
 			void setFPSLimit(UINT32 limit);
 
+			/**
+			 * Determines how many rendered frames the simulation thread is allowed to run ahead of the core thread
+			 * before it is made to wait. One (the default) runs the threads in lockstep, which minimizes input latency.
+			 * Higher values improve throughput when frame times on the two threads are uneven, at the cost of one
+			 * additional frame of latency per queued frame. Clamped to [1, 3]. Only call from the simulation thread.
+			 */
+			void setMaxQueuedFrames(UINT32 numFrames);
+
 			/** 
 			 * Returns the step (in seconds) between fixed frame updates. This value should be used as frame delta within
 			 * fixed update calls.
@@ -136,7 +144,8 @@ namespace bs
 
 		Map<DynLib*, UpdatePluginFunc> mPluginUpdateFunctions;
 
-		bool mIsFrameRenderingFinished;
+		UINT32 mNumQueuedFrames = 0;
+		UINT32 mMaxQueuedFrames = 1;
 		Mutex mFrameRenderingFinishedMutex;
 		Signal mFrameRenderingFinishedCondition;
 		ThreadId mSimThreadId;
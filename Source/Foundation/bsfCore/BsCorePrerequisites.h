@@ -365,6 +365,7 @@ namespace bs
 	class ResourceManifest;
 	class Texture;
 	class Mesh;
+	class MeshBVH;
 	class MeshBase;
 	class TransientMesh;
 	class MeshHeap;
@@ -600,6 +601,7 @@ namespace bs
 		TID_DepthStencilStateDesc = 1152,
 		TID_SerializedGpuProgramData = 1153,
 		TID_SubShader = 1154,
+		TID_MeshBVH = 1155,
 
 		// Moved from Engine layer
 		TID_CCamera = 30000,
@@ -615,7 +617,9 @@ namespace bs
 		TID_DepthOfFieldSettings = 30020,
 		TID_AmbientOcclusionSettings = 30021,
 		TID_ScreenSpaceReflectionsSettings = 30022,
-		TID_ShadowSettings = 30023
+		TID_ShadowSettings = 30023,
+		TID_DynamicResolutionSettings = 30024,
+		TID_ShaderPrewarmManifest = 30025
 	};
 }
 
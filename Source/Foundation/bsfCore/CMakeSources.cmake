@@ -57,6 +57,7 @@ set(BS_CORE_INC_CORETHREAD
 	"bsfCore/CoreThread/BsCoreObjectManager.h"
 	"bsfCore/CoreThread/BsCoreObject.h"
 	"bsfCore/CoreThread/BsCommandQueue.h"
+	"bsfCore/CoreThread/BsCommandQueueMPSC.h"
 	"bsfCore/CoreThread/BsCoreObjectCore.h"
 )
 
@@ -77,6 +78,8 @@ set(BS_CORE_INC_SCENE
 	"bsfCore/Scene/BsGameObjectManager.h"
 	"bsfCore/Scene/BsSceneObject.h"
 	"bsfCore/Scene/BsSceneManager.h"
+	"bsfCore/Scene/BsSceneTransformUpdater.h"
+	"bsfCore/Scene/BsSceneSpatialIndex.h"
 	"bsfCore/Scene/BsPrefab.h"
 	"bsfCore/Scene/BsPrefabDiff.h"
 	"bsfCore/Scene/BsPrefabUtility.h"
@@ -142,6 +145,7 @@ set(BS_CORE_INC_RENDERAPI
 	"bsfCore/RenderAPI/BsOcclusionQuery.h"
 	"bsfCore/RenderAPI/BsIndexBuffer.h"
 	"bsfCore/RenderAPI/BsHardwareBuffer.h"
+	"bsfCore/RenderAPI/BsGpuMemoryBudget.h"
 	"bsfCore/RenderAPI/BsGpuProgram.h"
 	"bsfCore/RenderAPI/BsGpuParams.h"
 	"bsfCore/RenderAPI/BsGpuParamDesc.h"
@@ -176,6 +180,7 @@ set(BS_CORE_INC_RENDERAPI_MANAGERS
 
 set(BS_CORE_SRC_CORETHREAD
 	"bsfCore/CoreThread/BsCommandQueue.cpp"
+	"bsfCore/CoreThread/BsCommandQueueMPSC.cpp"
 	"bsfCore/CoreThread/BsCoreObject.cpp"
 	"bsfCore/CoreThread/BsCoreObjectManager.cpp"
 	"bsfCore/CoreThread/BsCoreThread.cpp"
@@ -200,11 +205,13 @@ set(BS_CORE_INC_MATERIAL
 	"bsfCore/Material/BsGpuParamsSet.h"
 	"bsfCore/Material/BsShaderInclude.h"
 	"bsfCore/Material/BsShaderVariation.h"
+	"bsfCore/Material/BsShaderPrewarm.h"
 )
 
 set(BS_CORE_INC_RESOURCES
 	"bsfCore/Resources/BsResources.h"
 	"bsfCore/Resources/BsResourceManifest.h"
+	"bsfCore/Resources/BsResourceArchive.h"
 	"bsfCore/Resources/BsResourceHandle.h"
 	"bsfCore/Resources/BsResource.h"
 	"bsfCore/Resources/BsGpuResourceData.h"
@@ -220,10 +227,12 @@ set(BS_CORE_INC_MESH
 	"bsfCore/Mesh/BsMeshBase.h"
 	"bsfCore/Mesh/BsMesh.h"
 	"bsfCore/Mesh/BsMeshUtility.h"
+	"bsfCore/Mesh/BsMeshBVH.h"
 )
 
 set(BS_CORE_INC_IMAGE
 	"bsfCore/Image/BsTexture.h"
+	"bsfCore/Image/BsTextureUploadBatch.h"
 	"bsfCore/Image/BsPixelData.h"
 	"bsfCore/Image/BsPixelUtil.h"
 	"bsfCore/Image/BsPixelVolume.h"
@@ -233,6 +242,8 @@ set(BS_CORE_SRC_UTILITY
 	"bsfCore/Utility/BsUtility.cpp"
 	"bsfCore/Utility/BsDeferredCallManager.cpp"
 	"bsfCore/Utility/BsIconUtility.cpp"
+	"bsfCore/Utility/BsGpuReadback.cpp"
+	"bsfCore/Utility/BsScreenCapture.cpp"
 )
 
 set(BS_CORE_INC_TEXT
@@ -291,6 +302,8 @@ set(BS_CORE_INC_UTILITY
 	"bsfCore/Utility/BsUtility.h"
 	"bsfCore/Utility/BsDeferredCallManager.h"
 	"bsfCore/Utility/BsIconUtility.h"
+	"bsfCore/Utility/BsGpuReadback.h"
+	"bsfCore/Utility/BsScreenCapture.h"
 )
 
 set(BS_CORE_INC_RTTI
@@ -331,6 +344,7 @@ set(BS_CORE_INC_RTTI
 	"bsfCore/Private/RTTI/BsStringTableRTTI.h"
 	"bsfCore/Private/RTTI/BsMaterialParamsRTTI.h"
 	"bsfCore/Private/RTTI/BsMeshRTTI.h"
+	"bsfCore/Private/RTTI/BsMeshBVHRTTI.h"
 	"bsfCore/Private/RTTI/BsPhysicsMaterialRTTI.h"
 	"bsfCore/Private/RTTI/BsCBoxColliderRTTI.h"
 	"bsfCore/Private/RTTI/BsCColliderRTTI.h"
@@ -375,6 +389,7 @@ set(BS_CORE_INC_RTTI
 	"bsfCore/Private/RTTI/BsAudioListenerRTTI.h"
 	"bsfCore/Private/RTTI/BsAudioSourceRTTI.h"
 	"bsfCore/Private/RTTI/BsShaderVariationRTTI.h"
+	"bsfCore/Private/RTTI/BsShaderPrewarmRTTI.h"
 )
 
 set(BS_CORE_SRC_RENDERER
@@ -398,6 +413,7 @@ set(BS_CORE_SRC_RESOURCES
 	"bsfCore/Resources/BsResource.cpp"
 	"bsfCore/Resources/BsResourceHandle.cpp"
 	"bsfCore/Resources/BsResourceManifest.cpp"
+	"bsfCore/Resources/BsResourceArchive.cpp"
 	"bsfCore/Resources/BsResources.cpp"
 	"bsfCore/Resources/BsResourceMetaData.cpp"
 	"bsfCore/Resources/BsSavedResourceData.cpp"
@@ -411,11 +427,13 @@ set(BS_CORE_SRC_MESH
 	"bsfCore/Mesh/BsMeshHeap.cpp"
 	"bsfCore/Mesh/BsTransientMesh.cpp"
 	"bsfCore/Mesh/BsMeshUtility.cpp"
+	"bsfCore/Mesh/BsMeshBVH.cpp"
 )
 
 set(BS_CORE_SRC_IMAGE
 	"bsfCore/Image/BsPixelData.cpp"
 	"bsfCore/Image/BsTexture.cpp"
+	"bsfCore/Image/BsTextureUploadBatch.cpp"
 	"bsfCore/Image/BsPixelUtil.cpp"
 )
 
@@ -431,6 +449,7 @@ set(BS_CORE_SRC_MATERIAL
 	"bsfCore/Material/BsGpuParamsSet.cpp"
 	"bsfCore/Material/BsShaderInclude.cpp"
 	"bsfCore/Material/BsShaderVariation.cpp"
+	"bsfCore/Material/BsShaderPrewarm.cpp"
 )
 
 set(BS_CORE_SRC_INPUT
@@ -472,6 +491,7 @@ set(BS_CORE_SRC_RENDERAPI
 	"bsfCore/RenderAPI/BsVertexDeclaration.cpp"
 	"bsfCore/RenderAPI/BsVideoModeInfo.cpp"
 	"bsfCore/RenderAPI/BsRenderAPI.cpp"
+	"bsfCore/RenderAPI/BsGpuMemoryBudget.cpp"
 	"bsfCore/RenderAPI/BsRenderAPICapabilities.cpp"
 	"bsfCore/RenderAPI/BsViewport.cpp"
 	"bsfCore/RenderAPI/BsCommandBuffer.cpp"
@@ -529,6 +549,8 @@ set(BS_CORE_SRC_SCENE
 	"bsfCore/Scene/BsGameObjectManager.cpp"
 	"bsfCore/Scene/BsSceneObject.cpp"
 	"bsfCore/Scene/BsSceneManager.cpp"
+	"bsfCore/Scene/BsSceneTransformUpdater.cpp"
+	"bsfCore/Scene/BsSceneSpatialIndex.cpp"
 	"bsfCore/Scene/BsPrefab.cpp"
 	"bsfCore/Scene/BsPrefabDiff.cpp"
 	"bsfCore/Scene/BsPrefabUtility.cpp"
@@ -558,6 +580,7 @@ set(BS_CORE_SRC_AUDIO
 
 set(BS_CORE_INC_ANIMATION
 	"bsfCore/Animation/BsAnimationCurve.h"
+	"bsfCore/Animation/BsBakedAnimationCurves.h"
 	"bsfCore/Animation/BsAnimationClip.h"
 	"bsfCore/Animation/BsSkeleton.h"
 	"bsfCore/Animation/BsAnimation.h"
@@ -570,6 +593,7 @@ set(BS_CORE_INC_ANIMATION
 
 set(BS_CORE_SRC_ANIMATION
 	"bsfCore/Animation/BsAnimationCurve.cpp"
+	"bsfCore/Animation/BsBakedAnimationCurves.cpp"
 	"bsfCore/Animation/BsAnimationClip.cpp"
 	"bsfCore/Animation/BsSkeleton.cpp"
 	"bsfCore/Animation/BsAnimation.cpp"
@@ -581,10 +605,12 @@ set(BS_CORE_SRC_ANIMATION
 
 set(BS_CORE_INC_PARTICLES
 	"bsfCore/Particles/BsParticleSystem.h"
+	"bsfCore/Particles/BsParticleManager.h"
 )
 
 set(BS_CORE_SRC_PARTICLES
 	"bsfCore/Particles/BsParticleSystem.cpp"
+	"bsfCore/Particles/BsParticleManager.cpp"
 )
 
 set(BS_CORE_INC_PLATFORM
@@ -57,6 +57,14 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:Layers,pr:getter)
 		UINT64 getLayer() const { return mInternal->getLayer(); }
 
+		/** @copydoc Renderable::setVelocity */
+		BS_SCRIPT_EXPORT(n:Velocity,pr:setter)
+		void setVelocity(const Vector3& velocity) { mInternal->setVelocity(velocity); }
+
+		/** @copydoc Renderable::getVelocity */
+		BS_SCRIPT_EXPORT(n:Velocity,pr:getter)
+		const Vector3& getVelocity() const { return mInternal->getVelocity(); }
+
 		/**	Gets world bounds of the mesh rendered by this object. */
 		BS_SCRIPT_EXPORT(n:Bounds,pr:getter)
 		Bounds getBounds() const;
@@ -41,14 +41,14 @@ namespace bs
 		}
 	}
 
-	AsyncOp CommandQueueBase::queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
+	AsyncOp CommandQueueBase::queueReturn(SmallFunction<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
 	{
 #if BS_DEBUG_MODE
 		breakIfNeeded(mCommandQueueIdx, mMaxDebugIdx);
 
-		QueuedCommand newCommand(commandCallback, mMaxDebugIdx++, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), mMaxDebugIdx++, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
 #else
-		QueuedCommand newCommand(commandCallback, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
 #endif
 
 		mCommands->push(newCommand);
@@ -61,14 +61,14 @@ namespace bs
 		return newCommand.asyncOp;
 	}
 
-	void CommandQueueBase::queue(std::function<void()> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
+	void CommandQueueBase::queue(SmallFunction<void()> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
 	{
 #if BS_DEBUG_MODE
 		breakIfNeeded(mCommandQueueIdx, mMaxDebugIdx);
 
-		QueuedCommand newCommand(commandCallback, mMaxDebugIdx++, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), mMaxDebugIdx++, _notifyWhenComplete, _callbackId);
 #else
-		QueuedCommand newCommand(commandCallback, _notifyWhenComplete, _callbackId);
+		QueuedCommand newCommand(std::move(commandCallback), _notifyWhenComplete, _callbackId);
 #endif
 
 		mCommands->push(newCommand);
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Threading/BsAsyncOp.h"
+#include "Utility/BsSmallFunction.h"
 #include <functional>
 
 namespace bs
@@ -70,27 +71,27 @@ namespace bs
 	struct QueuedCommand
 	{
 #if BS_DEBUG_MODE
-		QueuedCommand(std::function<void(AsyncOp&)> _callback, UINT32 _debugId, const SPtr<AsyncOpSyncData>& asyncOpSyncData,
+		QueuedCommand(SmallFunction<void(AsyncOp&)> _callback, UINT32 _debugId, const SPtr<AsyncOpSyncData>& asyncOpSyncData,
 			bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: debugId(_debugId), callbackWithReturnValue(_callback), asyncOp(asyncOpSyncData), returnsValue(true)
+			: debugId(_debugId), callbackWithReturnValue(std::move(_callback)), asyncOp(asyncOpSyncData), returnsValue(true)
 			, callbackId(_callbackId), notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
-		QueuedCommand(std::function<void()> _callback, UINT32 _debugId, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			:debugId(_debugId), callback(_callback), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
+		QueuedCommand(SmallFunction<void()> _callback, UINT32 _debugId, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+			:debugId(_debugId), callback(std::move(_callback)), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
 			, notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
 		UINT32 debugId;
 #else
-		QueuedCommand(std::function<void(AsyncOp&)> _callback, const SPtr<AsyncOpSyncData>& asyncOpSyncData, 
+		QueuedCommand(SmallFunction<void(AsyncOp&)> _callback, const SPtr<AsyncOpSyncData>& asyncOpSyncData,
 			bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: callbackWithReturnValue(_callback), asyncOp(asyncOpSyncData), returnsValue(true), callbackId(_callbackId)
+			: callbackWithReturnValue(std::move(_callback)), asyncOp(asyncOpSyncData), returnsValue(true), callbackId(_callbackId)
 			, notifyWhenComplete(_notifyWhenComplete)
 		{ }
 
-		QueuedCommand(std::function<void()> _callback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
-			: callback(_callback), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
+		QueuedCommand(SmallFunction<void()> _callback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+			: callback(std::move(_callback)), asyncOp(AsyncOpEmpty()), returnsValue(false), callbackId(_callbackId)
 			, notifyWhenComplete(_notifyWhenComplete)
 		{ }
 #endif
@@ -128,8 +129,8 @@ namespace bs
 			return *this;
 		}
 
-		std::function<void()> callback;
-		std::function<void(AsyncOp&)> callbackWithReturnValue;
+		SmallFunction<void()> callback;
+		SmallFunction<void(AsyncOp&)> callbackWithReturnValue;
 		AsyncOp asyncOp;
 		bool returnsValue;
 		UINT32 callbackId;
@@ -201,7 +202,7 @@ namespace bs
 		 * Callback method also needs to call AsyncOp::markAsResolved once it is done processing. (If it doesn't it will 
 		 * still be called automatically, but the return value will default to nullptr)
 		 */
-		AsyncOp queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+		AsyncOp queueReturn(SmallFunction<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
 
 		/**
 		 * Queue up a new command to execute. Make sure the provided function has all of its parameters properly bound. 
@@ -214,7 +215,7 @@ namespace bs
 		 * @param[in]	_callbackId		   	(optional) Identifier for the callback so you can then later find
 		 * 									it if needed.
 		 */
-		void queue(std::function<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+		void queue(SmallFunction<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
 
 		/**
 		 * Returns a copy of all queued commands and makes room for new ones. Must be called from the thread that created 
@@ -300,7 +301,7 @@ namespace bs
 		{ }
 
 		/** @copydoc CommandQueueBase::queueReturn */
-		AsyncOp queueReturn(std::function<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		AsyncOp queueReturn(SmallFunction<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
 		{
 #if BS_DEBUG_MODE
 #if BS_THREAD_SUPPORT != 0
@@ -310,14 +311,14 @@ namespace bs
 #endif
 
 			this->lock();
-			AsyncOp asyncOp = CommandQueueBase::queueReturn(commandCallback, _notifyWhenComplete, _callbackId);
+			AsyncOp asyncOp = CommandQueueBase::queueReturn(std::move(commandCallback), _notifyWhenComplete, _callbackId);
 			this->unlock();
 
 			return asyncOp;
 		}
 
 		/** @copydoc CommandQueueBase::queue */
-		void queue(std::function<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
+		void queue(SmallFunction<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0)
 		{
 #if BS_DEBUG_MODE
 #if BS_THREAD_SUPPORT != 0
@@ -327,7 +328,7 @@ namespace bs
 #endif
 
 			this->lock();
-			CommandQueueBase::queue(commandCallback, _notifyWhenComplete, _callbackId);
+			CommandQueueBase::queue(std::move(commandCallback), _notifyWhenComplete, _callbackId);
 			this->unlock();
 		}
 
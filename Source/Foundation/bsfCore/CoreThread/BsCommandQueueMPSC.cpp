@@ -0,0 +1,194 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "CoreThread/BsCommandQueueMPSC.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	CommandQueueMPSC::CommandQueueMPSC(ThreadId threadId, UINT32 capacity)
+		:mCapacity(capacity), mMask(capacity - 1), mMyThreadId(threadId)
+	{
+		assert((capacity & (capacity - 1)) == 0 && "Command queue capacity must be a power of two.");
+
+		mAsyncOpSyncData = bs_shared_ptr_new<AsyncOpSyncData>();
+		mSlots = (Slot*)bs_alloc(sizeof(Slot) * capacity);
+
+		for (UINT32 i = 0; i < capacity; i++)
+			new (&mSlots[i].sequence) std::atomic<UINT32>(i);
+	}
+
+	CommandQueueMPSC::~CommandQueueMPSC()
+	{
+		cancelAll();
+
+		bs_free(mSlots);
+	}
+
+	UINT32 CommandQueueMPSC::claimSlot()
+	{
+		UINT32 pos = mEnqueuePos.load(std::memory_order_relaxed);
+		while(true)
+		{
+			Slot* slot = &mSlots[pos & mMask];
+			UINT32 sequence = slot->sequence.load(std::memory_order_acquire);
+			INT32 dif = (INT32)(sequence - pos);
+
+			if(dif == 0)
+			{
+				// Slot is free, try to claim it
+				if(mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					// Track the deepest the queue ever got, for diagnostics. The depth is approximate as the consumer
+					// may be draining concurrently, which is fine for its purpose.
+					UINT32 depth = (pos + 1) - mDequeuePos.load(std::memory_order_relaxed);
+					UINT32 peak = mPeakDepth.load(std::memory_order_relaxed);
+					while(depth > peak && !mPeakDepth.compare_exchange_weak(peak, depth, std::memory_order_relaxed))
+					{ }
+
+					return pos;
+				}
+			}
+			else if(dif < 0)
+			{
+				// Queue is full, wait for the consumer to free up space
+				std::this_thread::yield();
+				pos = mEnqueuePos.load(std::memory_order_relaxed);
+			}
+			else
+			{
+				// Another producer claimed this slot before us, retry with a fresh position
+				pos = mEnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void CommandQueueMPSC::publishSlot(UINT32 pos)
+	{
+		mSlots[pos & mMask].sequence.store(pos + 1, std::memory_order_release);
+	}
+
+	AsyncOp CommandQueueMPSC::queueReturn(SmallFunction<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete,
+		UINT32 _callbackId)
+	{
+		UINT32 pos = claimSlot();
+		Slot* slot = &mSlots[pos & mMask];
+
+#if BS_DEBUG_MODE
+		QueuedCommand* command = new (&slot->storage)
+			QueuedCommand(std::move(commandCallback), mMaxDebugIdx++, mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+#else
+		QueuedCommand* command = new (&slot->storage)
+			QueuedCommand(std::move(commandCallback), mAsyncOpSyncData, _notifyWhenComplete, _callbackId);
+#endif
+
+		AsyncOp asyncOp = command->asyncOp;
+		publishSlot(pos);
+
+		return asyncOp;
+	}
+
+	void CommandQueueMPSC::queue(SmallFunction<void()> commandCallback, bool _notifyWhenComplete, UINT32 _callbackId)
+	{
+		UINT32 pos = claimSlot();
+		Slot* slot = &mSlots[pos & mMask];
+
+#if BS_DEBUG_MODE
+		new (&slot->storage) QueuedCommand(std::move(commandCallback), mMaxDebugIdx++, _notifyWhenComplete, _callbackId);
+#else
+		new (&slot->storage) QueuedCommand(std::move(commandCallback), _notifyWhenComplete, _callbackId);
+#endif
+
+		publishSlot(pos);
+	}
+
+	QueuedCommand* CommandQueueMPSC::tryPeek()
+	{
+		UINT32 dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+		Slot* slot = &mSlots[dequeuePos & mMask];
+		UINT32 sequence = slot->sequence.load(std::memory_order_acquire);
+
+		if((INT32)(sequence - (dequeuePos + 1)) < 0)
+			return nullptr; // Not yet published
+
+		return (QueuedCommand*)&slot->storage;
+	}
+
+	void CommandQueueMPSC::popFront()
+	{
+		UINT32 dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+		Slot* slot = &mSlots[dequeuePos & mMask];
+
+		((QueuedCommand*)&slot->storage)->~QueuedCommand();
+
+		// Free the slot for the producer that will next wrap around to it
+		slot->sequence.store(dequeuePos + mCapacity, std::memory_order_release);
+		mDequeuePos.store(dequeuePos + 1, std::memory_order_relaxed);
+	}
+
+	UINT32 CommandQueueMPSC::playback(std::function<void(UINT32)> notifyCallback)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		UINT32 numExecuted = 0;
+		QueuedCommand* command;
+		while((command = tryPeek()) != nullptr)
+		{
+			if(command->returnsValue)
+			{
+				AsyncOp& op = command->asyncOp;
+				command->callbackWithReturnValue(op);
+
+				if(!command->asyncOp.hasCompleted())
+				{
+					LOGDBG("Async operation return value wasn't resolved properly. Resolving automatically to nullptr. " \
+						"Make sure to complete the operation before returning from the command callback method.");
+					command->asyncOp._completeOperation(nullptr);
+				}
+			}
+			else
+			{
+				command->callback();
+			}
+
+			bool notify = command->notifyWhenComplete;
+			UINT32 callbackId = command->callbackId;
+
+			popFront();
+			numExecuted++;
+
+			if(notify && notifyCallback != nullptr)
+				notifyCallback(callbackId);
+		}
+
+		return numExecuted;
+	}
+
+	void CommandQueueMPSC::cancelAll()
+	{
+		while(tryPeek() != nullptr)
+			popFront();
+	}
+
+	bool CommandQueueMPSC::isEmpty() const
+	{
+		UINT32 dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+		Slot* slot = &mSlots[dequeuePos & mMask];
+		UINT32 sequence = slot->sequence.load(std::memory_order_acquire);
+
+		return (INT32)(sequence - (dequeuePos + 1)) < 0;
+	}
+
+	UINT32 CommandQueueMPSC::getNumQueuedCommands() const
+	{
+		return mEnqueuePos.load(std::memory_order_relaxed) - mDequeuePos.load(std::memory_order_relaxed);
+	}
+
+	UINT32 CommandQueueMPSC::getPeakQueuedCommands(bool reset)
+	{
+		if (reset)
+			return mPeakDepth.exchange(getNumQueuedCommands(), std::memory_order_relaxed);
+
+		return mPeakDepth.load(std::memory_order_relaxed);
+	}
+}
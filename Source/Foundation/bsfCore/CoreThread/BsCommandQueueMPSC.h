@@ -0,0 +1,136 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "CoreThread/BsCommandQueue.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup CoreThread-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Lock-free bounded multiple-producer single-consumer command queue. Producers claim ring buffer slots through an
+	 * atomic counter and therefore never block each other, unlike CommandQueue<CommandQueueSync> which serializes every
+	 * queue operation on a mutex. The consumer drains all available commands in a batch.
+	 *
+	 * @note
+	 * Producers may queue from any thread, but playback() and cancelAll() must only be called from a single (consumer)
+	 * thread. When the ring buffer is full producers spin-wait until the consumer frees up space, providing natural
+	 * backpressure instead of unbounded growth.
+	 */
+	class BS_CORE_EXPORT CommandQueueMPSC
+	{
+	public:
+		/**
+		 * Constructor.
+		 *
+		 * @param[in]	threadId	Identifier for the thread the queued commands will be executed on.
+		 * @param[in]	capacity	Maximum number of in-flight commands. Must be a power of two.
+		 */
+		CommandQueueMPSC(ThreadId threadId, UINT32 capacity = 16384);
+		~CommandQueueMPSC();
+
+		/** Gets the thread identifier the queued commands get executed on. */
+		ThreadId getThreadId() const { return mMyThreadId; }
+
+		/** @copydoc CommandQueueBase::queueReturn */
+		AsyncOp queueReturn(SmallFunction<void(AsyncOp&)> commandCallback, bool _notifyWhenComplete = false,
+			UINT32 _callbackId = 0);
+
+		/** @copydoc CommandQueueBase::queue */
+		void queue(SmallFunction<void()> commandCallback, bool _notifyWhenComplete = false, UINT32 _callbackId = 0);
+
+		/**
+		 * Executes all commands available at the time of the call, in the order they were queued. Must be called from the
+		 * consumer thread.
+		 *
+		 * @param[in]	notifyCallback  	Callback that will be called for any executed command that has the
+		 * 									@p notifyWhenComplete flag set. Receives the @p callbackId of the command.
+		 * @return							Number of commands that were executed.
+		 */
+		UINT32 playback(std::function<void(UINT32)> notifyCallback);
+
+		/** Removes all currently queued commands without executing them. Must be called from the consumer thread. */
+		void cancelAll();
+
+		/**	Returns true if no commands are queued. */
+		bool isEmpty() const;
+
+		/**
+		 * Returns the approximate number of commands currently in the queue. Intended for diagnostics; the value can be
+		 * slightly stale while producers or the consumer are active. Thread safe.
+		 */
+		UINT32 getNumQueuedCommands() const;
+
+		/**
+		 * Returns the highest number of commands that were in the queue at any single point since the last reset of the
+		 * peak. Thread safe.
+		 *
+		 * @param[in]	reset	If true the peak is reset to the current queue depth after being read.
+		 */
+		UINT32 getPeakQueuedCommands(bool reset = false);
+
+		/**
+		 * Sets a soft cap on the number of queued commands, used for producer backpressure. The queue itself only
+		 * enforces its hard capacity - the soft cap is advisory and producers are expected to query isAboveSoftCap()
+		 * (directly or through CoreThread) and adapt. Set to zero to disable. Thread safe.
+		 */
+		void setSoftCap(UINT32 numCommands) { mSoftCap.store(numCommands, std::memory_order_relaxed); }
+
+		/** Returns the soft cap on the number of queued commands, or zero if disabled. Thread safe. */
+		UINT32 getSoftCap() const { return mSoftCap.load(std::memory_order_relaxed); }
+
+		/** Checks if the number of queued commands currently exceeds the soft cap. Thread safe. */
+		bool isAboveSoftCap() const
+		{
+			UINT32 softCap = mSoftCap.load(std::memory_order_relaxed);
+			return softCap != 0 && getNumQueuedCommands() >= softCap;
+		}
+
+	private:
+		/** Single ring buffer entry, holding command storage and a sequence number used for synchronization. */
+		struct Slot
+		{
+			std::atomic<UINT32> sequence;
+			std::aligned_storage<sizeof(QueuedCommand), alignof(QueuedCommand)>::type storage;
+		};
+
+		/**
+		 * Claims a slot for a new command, spin-waiting if the ring buffer is currently full, and returns the unmasked
+		 * ring position of the claimed slot. Thread safe.
+		 */
+		UINT32 claimSlot();
+
+		/** Publishes the slot claimed at the provided position, making the command visible to the consumer. */
+		void publishSlot(UINT32 pos);
+
+		/** Returns the next queued command without removing it, or null if none are available. Consumer thread only. */
+		QueuedCommand* tryPeek();
+
+		/** Destroys the command last returned by tryPeek() and frees up its slot for producers. Consumer thread only. */
+		void popFront();
+
+		Slot* mSlots;
+		UINT32 mCapacity;
+		UINT32 mMask;
+
+		std::atomic<UINT32> mEnqueuePos{0};
+		std::atomic<UINT32> mDequeuePos{0}; // Only written by the consumer thread
+
+		std::atomic<UINT32> mPeakDepth{0};
+		std::atomic<UINT32> mSoftCap{0};
+
+		SPtr<AsyncOpSyncData> mAsyncOpSyncData;
+		ThreadId mMyThreadId;
+
+#if BS_DEBUG_MODE
+		std::atomic<UINT32> mMaxDebugIdx{0};
+#endif
+	};
+
+	/** @} */
+}
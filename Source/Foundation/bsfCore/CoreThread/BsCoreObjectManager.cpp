@@ -6,6 +6,7 @@
 #include "Error/BsException.h"
 #include "Math/BsMath.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -30,6 +31,15 @@ namespace bs
 				"engine objects before shutdown.");
 		}
 #endif
+
+		for (auto& allocSet : mSyncWorkerAllocs)
+		{
+			for (auto& alloc : allocSet)
+			{
+				alloc->setOwnerThread(BS_THREAD_CURRENT_ID);
+				bs_delete(alloc);
+			}
+		}
 	}
 
 	UINT64 CoreObjectManager::generateId()
@@ -333,20 +343,32 @@ namespace bs
 		}
 
 		bs_frame_clear();
-		
-		// Order in which objects are recursed in matters, ones with lower ID will have been created before
-		// ones with higher ones and should be updated first.
-		for (auto& objectData : mDirtyObjects)
+
+		// Flatten the dirty objects into an ordered list (dependencies before dependants), so the expensive per-object
+		// serialization below can be split across worker threads. Only entries for live objects are filled by the
+		// workers, destroyed object data was already serialized.
+		bs_frame_mark();
 		{
-			std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
+			struct SyncWorkItem
 			{
-				if (!curObj->isCoreDirty())
+				CoreObject* object;
+				INT32 destroyedIdx;
+			};
+
+			FrameVector<SyncWorkItem> workItems;
+			FrameSet<CoreObject*> visited;
+
+			std::function<void(CoreObject*)> flattenObject = [&](CoreObject* curObj)
+			{
+				if (!curObj->isCoreDirty() || visited.find(curObj) != visited.end())
 					return; // We already processed it as some other object's dependency
 
+				visited.insert(curObj);
+
 				// Sync dependencies before dependants
 				// Note: I don't check for recursion. Possible infinite loop if two objects
 				// are dependent on one another.
-				
+
 				UINT64 id = curObj->getInternalID();
 				auto iterFind = mDependencies.find(id);
 
@@ -354,33 +376,102 @@ namespace bs
 				{
 					const Vector<CoreObject*>& dependencies = iterFind->second;
 					for (auto& dependency : dependencies)
-						syncObject(dependency);
+						flattenObject(dependency);
 				}
 
-				SPtr<ct::CoreObject> objectCore = curObj->getCore();
-				if (objectCore == nullptr)
+				workItems.push_back({ curObj, -1 });
+			};
+
+			for (auto& objectData : mDirtyObjects)
+			{
+				CoreObject* object = objectData.second.object;
+				if (object != nullptr)
+					flattenObject(object);
+				else
 				{
-					curObj->markCoreClean();
-					return;
+					// Object was destroyed but we still need to sync its modifications before it was destroyed
+					if (objectData.second.syncDataId != -1)
+						workItems.push_back({ nullptr, objectData.second.syncDataId });
 				}
+			}
 
-				CoreSyncData objSyncData = curObj->syncToCore(allocator);
-				curObj->markCoreClean();
+			const UINT32 numItems = (UINT32)workItems.size();
+			syncData.entries.resize(numItems);
+
+			// Serializes a contiguous range of work items, writing sync data into the provided allocator
+			auto processRange = [this, &workItems, &syncData](UINT32 begin, UINT32 end, FrameAlloc* rangeAlloc,
+				bool isWorker)
+			{
+				if (isWorker)
+					rangeAlloc->setOwnerThread(BS_THREAD_CURRENT_ID);
 
-				syncData.entries.push_back(CoreStoredSyncObjData(objectCore,
-					curObj->getInternalID(), objSyncData));
+				for (UINT32 i = begin; i < end; i++)
+				{
+					SyncWorkItem& item = workItems[i];
+					if (item.object == nullptr)
+					{
+						syncData.entries[i] = mDestroyedSyncData[item.destroyedIdx];
+						continue;
+					}
+
+					SPtr<ct::CoreObject> objectCore = item.object->getCore();
+					if (objectCore == nullptr)
+					{
+						item.object->markCoreClean();
+						continue; // Entry stays empty and gets skipped on upload
+					}
+
+					CoreSyncData objSyncData = item.object->syncToCore(rangeAlloc);
+					item.object->markCoreClean();
+
+					syncData.entries[i] = CoreStoredSyncObjData(objectCore, item.object->getInternalID(), objSyncData);
+
+					if (isWorker)
+						syncData.entries[i].alloc = rangeAlloc;
+				}
 			};
 
-			CoreObject* object = objectData.second.object;
-			if (object != nullptr)
-				syncObject(object);
-			else
+			if (numItems >= PARALLEL_SYNC_THRESHOLD && TaskScheduler::instancePtr() != nullptr)
 			{
-				// Object was destroyed but we still need to sync its modifications before it was destroyed
-				if (objectData.second.syncDataId != -1)
-					syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+				UINT32 numBuckets = std::min(TaskScheduler::instance().getNumWorkers(),
+					Math::divideAndRoundUp(numItems, PARALLEL_SYNC_THRESHOLD));
+
+				// Each bucket writes into its own frame allocator. Allocator sets are double buffered because the data
+				// is freed by the core thread, which can be a frame behind.
+				Vector<FrameAlloc*>& workerAllocs = mSyncWorkerAllocs[mActiveSyncAllocSet];
+				mActiveSyncAllocSet = (mActiveSyncAllocSet + 1) % NUM_SYNC_ALLOC_SETS;
+
+				while ((UINT32)workerAllocs.size() < numBuckets)
+					workerAllocs.push_back(bs_new<FrameAlloc>());
+
+				UINT32 itemsPerBucket = Math::divideAndRoundUp(numItems, numBuckets);
+
+				Vector<SPtr<Task>> tasks;
+				for (UINT32 i = 0; i < numBuckets; i++)
+				{
+					UINT32 begin = i * itemsPerBucket;
+					UINT32 end = std::min(begin + itemsPerBucket, numItems);
+
+					if (begin >= end)
+						break;
+
+					FrameAlloc* workerAlloc = workerAllocs[i];
+					syncData.workerAllocs.push_back(workerAlloc);
+
+					SPtr<Task> task = Task::create("CoreObjectSync",
+						[&processRange, begin, end, workerAlloc]() { processRange(begin, end, workerAlloc, true); });
+
+					tasks.push_back(task);
+					TaskScheduler::instance().addTask(task);
+				}
+
+				for (auto& task : tasks)
+					task->wait();
 			}
+			else
+				processRange(0, numItems, allocator, false);
 		}
+		bs_frame_clear();
 
 		mDirtyObjects.clear();
 		mDestroyedSyncData.clear();
@@ -404,7 +495,17 @@ namespace bs
 			UINT8* data = objSyncData.syncData.getBuffer();
 
 			if (data != nullptr)
-				syncData.alloc->free(data);
+			{
+				FrameAlloc* alloc = objSyncData.alloc != nullptr ? objSyncData.alloc : syncData.alloc;
+				alloc->free(data);
+			}
+		}
+
+		// All worker-allocated data has been consumed, reclaim the allocators for the next sync
+		for (auto& workerAlloc : syncData.workerAllocs)
+		{
+			workerAlloc->setOwnerThread(BS_THREAD_CURRENT_ID);
+			workerAlloc->clear();
 		}
 
 		syncData.entries.clear();
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "CoreThread/BsCoreObjectCore.h"
 #include "Utility/BsModule.h"
+#include "Utility/BsFlatHashMap.h"
 
 namespace bs
 {
@@ -40,6 +41,7 @@ namespace bs
 			SPtr<ct::CoreObject> destinationObj;
 			CoreSyncData syncData;
 			UINT64 internalId;
+			FrameAlloc* alloc = nullptr; /**< Allocator the sync data was allocated from, when not the per-frame default. */
 		};
 
 		/**
@@ -50,6 +52,7 @@ namespace bs
 		{
 			FrameAlloc* alloc = nullptr;
 			Vector<CoreStoredSyncObjData> entries;
+			Vector<FrameAlloc*> workerAllocs; /**< Worker allocators to clear once the data is uploaded. */
 		};
 
 		/** Contains information about a dirty CoreObject that requires syncing to the core thread. */	
@@ -124,15 +127,27 @@ namespace bs
 		 */
 		void updateDependencies(CoreObject* object, Vector<CoreObject*>* dependencies);
 
+		/** Number of dirty objects at which syncDownload() partitions the work across TaskScheduler workers. */
+		static constexpr UINT32 PARALLEL_SYNC_THRESHOLD = 256;
+
+		/**
+		 * Number of worker allocator sets to cycle through. Matches CoreThread::NUM_SYNC_BUFFERS, as the sim thread may
+		 * be at most one frame ahead of the core thread that frees the data.
+		 */
+		static constexpr UINT32 NUM_SYNC_ALLOC_SETS = 2;
+
 		UINT64 mNextAvailableID;
-		Map<UINT64, CoreObject*> mObjects;
-		Map<UINT64, DirtyObjectData> mDirtyObjects;
-		Map<UINT64, Vector<CoreObject*>> mDependencies;
-		Map<UINT64, Vector<CoreObject*>> mDependants;
+		FlatHashMap<UINT64, CoreObject*> mObjects;
+		FlatHashMap<UINT64, DirtyObjectData> mDirtyObjects;
+		FlatHashMap<UINT64, Vector<CoreObject*>> mDependencies;
+		FlatHashMap<UINT64, Vector<CoreObject*>> mDependants;
 
 		Vector<CoreStoredSyncObjData> mDestroyedSyncData;
 		List<CoreStoredSyncData> mCoreSyncData;
 
+		Vector<FrameAlloc*> mSyncWorkerAllocs[NUM_SYNC_ALLOC_SETS];
+		UINT32 mActiveSyncAllocSet = 0;
+
 		Mutex mObjectsMutex;
 	};
 
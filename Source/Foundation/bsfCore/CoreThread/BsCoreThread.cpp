@@ -27,7 +27,7 @@ namespace bs
 
 		mSimThreadId = BS_THREAD_CURRENT_ID;
 		mCoreThreadId = mSimThreadId; // For now
-		mCommandQueue = bs_new<CommandQueue<CommandQueueSync>>(BS_THREAD_CURRENT_ID);
+		mCommandQueue = bs_new<CommandQueueMPSC>(BS_THREAD_CURRENT_ID);
 
 		initCoreThread();
 	}
@@ -93,7 +93,6 @@ namespace bs
 		while(true)
 		{
 			// Wait until we get some ready commands
-			Queue<QueuedCommand>* commands = nullptr;
 			{
 				Lock lock(mCommandQueueMutex);
 
@@ -109,12 +108,10 @@ namespace bs
 					mCommandReadyCondition.wait(lock);
 					TaskScheduler::instance().removeWorker();
 				}
-
-				commands = mCommandQueue->flush();
 			}
 
-			// Play commands
-			mCommandQueue->playbackWithNotify(commands, std::bind(&CoreThread::commandCompletedNotify, this, _1)); 
+			// Play all available commands in a batch, without holding any locks so producers can keep queuing
+			mCommandQueue->playback(std::bind(&CoreThread::commandCompletedNotify, this, _1));
 		}
 #endif
 	}
@@ -183,28 +180,37 @@ namespace bs
 		getQueue()->submitToCoreThread(blockUntilComplete);
 	}
 
-	AsyncOp CoreThread::queueReturnCommand(std::function<void(AsyncOp&)> commandCallback, CoreThreadQueueFlags flags)
+	AsyncOp CoreThread::queueReturnCommand(SmallFunction<void(AsyncOp&)> commandCallback, CoreThreadQueueFlags flags)
 	{
 		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
 
+		if (flags.isSet(CTQF_BlockOnSoftCap))
+		{
+			while (isCommandQueueSaturated())
+				std::this_thread::yield();
+		}
+
 		if (!flags.isSet(CTQF_InternalQueue))
-			return getQueue()->queueReturnCommand(commandCallback);
+			return getQueue()->queueReturnCommand(std::move(commandCallback));
 		else
 		{
 			bool blockUntilComplete = flags.isSet(CTQF_BlockUntilComplete);
 
 			AsyncOp op;
 			UINT32 commandId = -1;
+
+			// The command queue is lock-free, producers only need to synchronize with the condition the core thread
+			// sleeps on, to avoid a missed wake-up
+			if (blockUntilComplete)
 			{
-				Lock lock(mCommandQueueMutex);
+				commandId = mMaxCommandNotifyId++;
+				op = mCommandQueue->queueReturn(std::move(commandCallback), true, commandId);
+			}
+			else
+				op = mCommandQueue->queueReturn(std::move(commandCallback));
 
-				if (blockUntilComplete)
-				{
-					commandId = mMaxCommandNotifyId++;
-					op = mCommandQueue->queueReturn(commandCallback, true, commandId);
-				}
-				else
-					op = mCommandQueue->queueReturn(commandCallback);
+			{
+				Lock lock(mCommandQueueMutex);
 			}
 
 			mCommandReadyCondition.notify_all();
@@ -216,27 +222,34 @@ namespace bs
 		}
 	}
 
-	void CoreThread::queueCommand(std::function<void()> commandCallback, CoreThreadQueueFlags flags)
+	void CoreThread::queueCommand(SmallFunction<void()> commandCallback, CoreThreadQueueFlags flags)
 	{
 		assert(BS_THREAD_CURRENT_ID != getCoreThreadId() && "Cannot queue commands on the core thread for the core thread");
 
+		if (flags.isSet(CTQF_BlockOnSoftCap))
+		{
+			while (isCommandQueueSaturated())
+				std::this_thread::yield();
+		}
+
 		if (!flags.isSet(CTQF_InternalQueue))
-			getQueue()->queueCommand(commandCallback);
+			getQueue()->queueCommand(std::move(commandCallback));
 		else
 		{
 			bool blockUntilComplete = flags.isSet(CTQF_BlockUntilComplete);
 
 			UINT32 commandId = -1;
+
+			if (blockUntilComplete)
 			{
-				Lock lock(mCommandQueueMutex);
+				commandId = mMaxCommandNotifyId++;
+				mCommandQueue->queue(std::move(commandCallback), true, commandId);
+			}
+			else
+				mCommandQueue->queue(std::move(commandCallback));
 
-				if (blockUntilComplete)
-				{
-					commandId = mMaxCommandNotifyId++;
-					mCommandQueue->queue(commandCallback, true, commandId);
-				}
-				else
-					mCommandQueue->queue(commandCallback);
+			{
+				Lock lock(mCommandQueueMutex);
 			}
 
 			mCommandReadyCondition.notify_all();
@@ -246,6 +259,18 @@ namespace bs
 		}
 	}
 
+	bool CoreThread::tryQueueCommand(SmallFunction<void()> commandCallback, CoreThreadQueueFlags flags)
+	{
+		if (isCommandQueueSaturated())
+			return false;
+
+		// Blocking makes no sense when the caller opted into rejection instead
+		flags.unset(CTQF_BlockOnSoftCap);
+
+		queueCommand(std::move(commandCallback), flags);
+		return true;
+	}
+
 	void CoreThread::update()
 	{
 		for (UINT32 i = 0; i < NUM_SYNC_BUFFERS; i++)
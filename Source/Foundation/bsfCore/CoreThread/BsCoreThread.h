@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
 #include "CoreThread/BsCommandQueue.h"
+#include "CoreThread/BsCommandQueueMPSC.h"
 #include "CoreThread/BsCoreThreadQueue.h"
 #include "Threading/BsThreadPool.h"
 
@@ -25,7 +26,8 @@ namespace bs
 		/** 
 		 * Specifies that the queued command should be executed on the internal queue. Internal queue doesn't require
 		 * a separate CoreThread::submit() call, and the queued command is instead immediately visible to the core thread.
-		 * The downside is that the queue requires additional synchronization and is slower than the normal queue.
+		 * The internal queue is a bounded lock-free ring buffer, so producers never block each other, but commands
+		 * queued this way cannot be interleaved with commands on the per-thread queues.
 		 */
 		CTQF_InternalQueue = 1 << 0,
 		/**
@@ -33,7 +35,14 @@ namespace bs
 		 * internal queue commands since contents of the normal queue won't be submitted to the core thread until the
 		 * CoreThread::submit() call.
 		 */
-		CTQF_BlockUntilComplete = 1 << 1
+		CTQF_BlockUntilComplete = 1 << 1,
+		/**
+		 * If the internal command queue is above its soft cap (see CoreThread::setCommandQueueSoftCap()) the method
+		 * will wait for the core thread to drain the queue below the cap before queuing the command. This smooths out
+		 * load spikes by applying backpressure to the producer instead of letting queued commands balloon memory and
+		 * then stall the core thread in one giant flush.
+		 */
+		CTQF_BlockOnSoftCap = 1 << 2
 	};
 
 	typedef Flags<CoreThreadQueueFlag> CoreThreadQueueFlags;
@@ -96,7 +105,7 @@ namespace bs
 		 * @see		CommandQueue::queueReturn()
 		 * @note	Thread safe
 		 */
-		AsyncOp queueReturnCommand(std::function<void(AsyncOp&)> commandCallback, CoreThreadQueueFlags flags = CTQF_Default);
+		AsyncOp queueReturnCommand(SmallFunction<void(AsyncOp&)> commandCallback, CoreThreadQueueFlags flags = CTQF_Default);
 
 		/**
 		 * Queues a new command that will be added to the global command queue. 
@@ -107,7 +116,61 @@ namespace bs
 		 * @see		CommandQueue::queue()
 		 * @note	Thread safe
 		 */
-		void queueCommand(std::function<void()> commandCallback, CoreThreadQueueFlags flags = CTQF_Default);
+		void queueCommand(SmallFunction<void()> commandCallback, CoreThreadQueueFlags flags = CTQF_Default);
+
+		/**
+		 * Attempts to queue a new command on the global command queue, failing instead of queuing if the queue is above
+		 * its soft cap (see setCommandQueueSoftCap()). Use for producers that can adapt when the core thread falls
+		 * behind (e.g. defer non-critical work to a later frame) rather than growing the queue further. Note the check
+		 * and the queuing are not atomic - the soft cap can be slightly overshot with many concurrent producers.
+		 *
+		 * @param[in]	commandCallback		Command to queue.
+		 * @param[in]	flags				Flags that further control command submission.
+		 * @return							True if the command was queued, false if rejected due to the soft cap.
+		 *
+		 * @note	Thread safe
+		 */
+		bool tryQueueCommand(SmallFunction<void()> commandCallback, CoreThreadQueueFlags flags = CTQF_Default);
+
+		/**
+		 * Returns the approximate number of commands currently waiting in the global command queue. Intended for
+		 * diagnostics.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 getNumQueuedCommands() const { return mCommandQueue->getNumQueuedCommands(); }
+
+		/**
+		 * Returns the highest number of commands that were waiting in the global command queue at any single point
+		 * since the peak was last reset.
+		 *
+		 * @param[in]	reset	If true the peak is reset to the current queue depth after being read.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 getPeakQueuedCommands(bool reset = false) { return mCommandQueue->getPeakQueuedCommands(reset); }
+
+		/**
+		 * Returns the approximate memory used by commands currently waiting in the global command queue. Only the fixed
+		 * per-command storage is counted - command callbacks whose captures don't fit the inline storage allocate
+		 * additional heap memory that isn't tracked. Intended for diagnostics.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT64 getQueuedCommandBytes() const { return (UINT64)getNumQueuedCommands() * sizeof(QueuedCommand); }
+
+		/**
+		 * Sets a soft cap on the number of commands in the global command queue, used for producer backpressure. The
+		 * cap is advisory - commands queued without one of the backpressure options still get accepted until the hard
+		 * queue capacity - but producers using CTQF_BlockOnSoftCap or tryQueueCommand() will adapt once the queue
+		 * grows past it. Set to zero to disable.
+		 *
+		 * @note	Thread safe.
+		 */
+		void setCommandQueueSoftCap(UINT32 numCommands) { mCommandQueue->setSoftCap(numCommands); }
+
+		/** Checks if the global command queue is currently above its soft cap. Thread safe. */
+		bool isCommandQueueSaturated() const { return mCommandQueue->isAboveSoftCap(); }
 
 		/**
 		 * Called once every frame.
@@ -166,9 +229,9 @@ namespace bs
 		Mutex mThreadStartedMutex;
 		Signal mCoreThreadStartedCondition;
 
-		CommandQueue<CommandQueueSync>* mCommandQueue;
+		CommandQueueMPSC* mCommandQueue;
 
-		UINT32 mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
+		std::atomic<UINT32> mMaxCommandNotifyId; /**< ID that will be assigned to the next command with a notifier callback. */
 		Vector<UINT32> mCommandsCompleted; /**< Completed commands that have notifier callbacks set up */
 
 		/** Starts the core thread worker method. Should only be called once. */
@@ -18,14 +18,14 @@ namespace bs
 		bs_delete(mCommandQueue);
 	}
 
-	AsyncOp CoreThreadQueueBase::queueReturnCommand(std::function<void(AsyncOp&)> commandCallback)
+	AsyncOp CoreThreadQueueBase::queueReturnCommand(SmallFunction<void(AsyncOp&)> commandCallback)
 	{
-		return mCommandQueue->queueReturn(commandCallback);
+		return mCommandQueue->queueReturn(std::move(commandCallback));
 	}
 
-	void CoreThreadQueueBase::queueCommand(std::function<void()> commandCallback)
+	void CoreThreadQueueBase::queueCommand(SmallFunction<void()> commandCallback)
 	{
-		mCommandQueue->queue(commandCallback);
+		mCommandQueue->queue(std::move(commandCallback));
 	}
 
 	void CoreThreadQueueBase::submitToCoreThread(bool blockUntilComplete)
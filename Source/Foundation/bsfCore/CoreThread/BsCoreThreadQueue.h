@@ -23,10 +23,10 @@ namespace bs
 		 * Queues a new generic command that will be added to the command queue. Returns an async operation object that you 
 		 * may use to check if the operation has finished, and to retrieve the return value once finished.
 		 */
-		AsyncOp queueReturnCommand(std::function<void(AsyncOp&)> commandCallback);
+		AsyncOp queueReturnCommand(SmallFunction<void(AsyncOp&)> commandCallback);
 
 		/** Queues a new generic command that will be added to the command queue. */
-		void queueCommand(std::function<void()> commandCallback);
+		void queueCommand(SmallFunction<void()> commandCallback);
 
 		/**
 		 * Makes all the currently queued commands available to the core thread. They will be executed as soon as the core 
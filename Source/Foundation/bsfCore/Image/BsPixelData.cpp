@@ -82,7 +82,7 @@ namespace bs
 
 		rval.setExternalBuffer(((UINT8*)getData()) + ((volume.left - getLeft())*elemSize)
 			+ ((volume.top - getTop())*mRowPitch*elemSize)
-			+ ((volume.front - getFront())*mSlicePitch*elemSize));
+			+ ((volume.front - getFront())*mSlicePitch*elemSize), getBufferLifetimeToken());
 
 		rval.mFormat = mFormat;
 		PixelUtil::getPitch(volume.getWidth(), volume.getHeight(), volume.getDepth(), mFormat, rval.mRowPitch,
@@ -133,6 +133,8 @@ namespace bs
 
 	Color PixelData::getColorAt(UINT32 x, UINT32 y, UINT32 z) const
 	{
+		BS_ASSERT_CHECKED(x < mExtents.getWidth() && y < mExtents.getHeight() && z < mExtents.getDepth());
+
 		Color cv;
 
 		UINT32 pixelSize = PixelUtil::getNumElemBytes(mFormat);
@@ -144,6 +146,8 @@ namespace bs
 
 	void PixelData::setColorAt(const Color& color, UINT32 x, UINT32 y, UINT32 z)
 	{
+		BS_ASSERT_CHECKED(x < mExtents.getWidth() && y < mExtents.getHeight() && z < mExtents.getDepth());
+
 		UINT32 pixelSize = PixelUtil::getNumElemBytes(mFormat);
 		UINT32 pixelOffset = pixelSize * (z * mSlicePitch + y * mRowPitch + x);
 		PixelUtil::packColor(color, mFormat, (unsigned char *)getData() + pixelOffset);
@@ -324,6 +328,24 @@ namespace bs
 		return pixelData;
 	}
 
+	SPtr<PixelData> PixelData::createView(const PixelVolume& extents, PixelFormat pixelFormat, UINT8* data,
+		SPtr<const void> lifetimeToken)
+	{
+		SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(extents, pixelFormat);
+		pixelData->setExternalBuffer(data, std::move(lifetimeToken));
+
+		return pixelData;
+	}
+
+	SPtr<PixelData> PixelData::createView(UINT32 width, UINT32 height, UINT32 depth, PixelFormat pixelFormat,
+		UINT8* data, SPtr<const void> lifetimeToken)
+	{
+		SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(width, height, depth, pixelFormat);
+		pixelData->setExternalBuffer(data, std::move(lifetimeToken));
+
+		return pixelData;
+	}
+
 	UINT32 PixelData::getInternalBufferSize() const
 	{
 		return getSize();
@@ -400,6 +400,30 @@ namespace bs
 		 */
 		static SPtr<PixelData> create(UINT32 width, UINT32 height, UINT32 depth, PixelFormat pixelFormat);
 
+		/**
+		 * Constructs a new object that wraps externally owned memory instead of allocating an internal buffer. No data
+		 * is copied. The memory must contain tightly packed pixels of the specified format, covering the specified
+		 * extents.
+		 *
+		 * @param[in]	extents			Extents of the pixel volume the memory holds.
+		 * @param[in]	pixelFormat		Format of the pixels in the memory.
+		 * @param[in]	data			Externally owned memory to wrap, of at least getConsecutiveSize() bytes for the
+		 *								provided parameters.
+		 * @param[in]	lifetimeToken	Shared pointer that keeps @p data alive for as long as the returned object (or
+		 *								any copy of it) references the memory. See
+		 *								GpuResourceData::setExternalBuffer(UINT8*, SPtr<const void>).
+		 */
+		static SPtr<PixelData> createView(const PixelVolume& extents, PixelFormat pixelFormat, UINT8* data,
+			SPtr<const void> lifetimeToken);
+
+		/**
+		 * @copydoc	createView(const PixelVolume&, PixelFormat, UINT8*, SPtr<const void>)
+		 *
+		 * Extents are constructed from the provided width, height and depth.
+		 */
+		static SPtr<PixelData> createView(UINT32 width, UINT32 height, UINT32 depth, PixelFormat pixelFormat,
+			UINT8* data, SPtr<const void> lifetimeToken);
+
 	private:
 		/**
 		 * Initializes the internal buffer with the provided set of colors. The array should be of width * height * depth 
@@ -4,8 +4,10 @@
 #include "Utility/BsBitwise.h"
 #include "Image/BsColor.h"
 #include "Math/BsMath.h"
+#include "Math/BsSIMD.h"
 #include "Error/BsException.h"
 #include "Image/BsTexture.h"
+#include "Threading/BsTaskScheduler.h"
 #include <nvtt.h>
 
 namespace bs
@@ -1865,6 +1867,160 @@ namespace bs
 		}
 	}
 
+	/** Splits a workload of @p count entries into ranges and executes them in parallel across worker threads. */
+	static void processRangeParallel(UINT32 count, UINT32 minEntriesPerTask, std::function<void(UINT32, UINT32)> worker)
+	{
+		UINT32 numTasks = 0;
+		if (minEntriesPerTask > 0)
+			numTasks = count / minEntriesPerTask;
+
+		numTasks = std::min(numTasks, TaskScheduler::instance().getNumWorkers());
+
+		if (numTasks <= 1)
+		{
+			worker(0, count);
+			return;
+		}
+
+		UINT32 entriesPerTask = count / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			UINT32 start = i * entriesPerTask;
+			UINT32 end = (i == (numTasks - 1)) ? count : (start + entriesPerTask);
+
+			tasks.push_back(Task::create("PixelUtil", std::bind(worker, start, end)));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	/** Type of a function that converts a run of consecutive pixels between two formats. */
+	typedef void(*PixelConversionFunc)(const UINT8* src, UINT8* dst, UINT32 numPixels);
+
+	/** Swaps the red and blue channels of a run of 4-byte RGBA/BGRA pixels, four pixels at a time. */
+	static void pixelConvertSwapRB8(const UINT8* src, UINT8* dst, UINT32 numPixels)
+	{
+		simd::uint8x16 mask;
+		mask = simd::make_shuffle_bytes16_mask<2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15>(mask);
+
+		UINT32 numBlocks = numPixels / 4;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			simd::uint8x16 pixels = simd::load_u(src);
+			pixels = simd::permute_bytes16(pixels, mask);
+			simd::store_u(dst, pixels);
+
+			src += 16;
+			dst += 16;
+		}
+
+		for (UINT32 i = numBlocks * 4; i < numPixels; i++)
+		{
+			dst[0] = src[2];
+			dst[1] = src[1];
+			dst[2] = src[0];
+			dst[3] = src[3];
+
+			src += 4;
+			dst += 4;
+		}
+	}
+
+	/** Converts a run of RGBA8 pixels into RGBA16F pixels, using a lookup table for the normalization. */
+	static void pixelConvertRGBA8ToRGBA16F(const UINT8* src, UINT8* dst, UINT32 numPixels)
+	{
+		struct HalfLookup
+		{
+			HalfLookup()
+			{
+				for (UINT32 i = 0; i < 256; i++)
+					table[i] = Bitwise::floatToHalf(i / 255.0f);
+			}
+
+			UINT16 table[256];
+		};
+
+		static const HalfLookup lookup;
+
+		UINT16* dst16 = (UINT16*)dst;
+
+		UINT32 count = numPixels * 4;
+		for (UINT32 i = 0; i < count; i++)
+			dst16[i] = lookup.table[src[i]];
+	}
+
+	/** Converts a run of pixels with @p numComponents 32-bit float channels into their 16-bit float equivalents. */
+	template<UINT32 numComponents>
+	static void pixelConvertFloatToHalf(const UINT8* src, UINT8* dst, UINT32 numPixels)
+	{
+		const float* srcFloat = (const float*)src;
+		UINT16* dstHalf = (UINT16*)dst;
+
+		Bitwise::floatToHalf(srcFloat, dstHalf, numPixels * numComponents);
+	}
+
+	/** Converts a run of pixels with @p numComponents 16-bit float channels into their 32-bit float equivalents. */
+	template<UINT32 numComponents>
+	static void pixelConvertHalfToFloat(const UINT8* src, UINT8* dst, UINT32 numPixels)
+	{
+		const UINT16* srcHalf = (const UINT16*)src;
+		float* dstFloat = (float*)dst;
+
+		Bitwise::halfToFloat(srcHalf, dstFloat, numPixels * numComponents);
+	}
+
+	/**
+	 * Returns a function that can convert a run of consecutive pixels between the two provided formats, without going
+	 * through the generic per-pixel pack/unpack. Null if no such fast path exists for the format pair.
+	 */
+	static PixelConversionFunc getFastConversionFunc(PixelFormat srcFormat, PixelFormat dstFormat)
+	{
+		switch (srcFormat)
+		{
+		case PF_RGBA8:
+			if (dstFormat == PF_BGRA8)
+				return &pixelConvertSwapRB8;
+
+			if (dstFormat == PF_RGBA16F)
+				return &pixelConvertRGBA8ToRGBA16F;
+
+			break;
+		case PF_BGRA8:
+			if (dstFormat == PF_RGBA8)
+				return &pixelConvertSwapRB8;
+
+			break;
+		case PF_R32F:
+			if (dstFormat == PF_R16F)
+				return &pixelConvertFloatToHalf<1>;
+
+			break;
+		case PF_RGBA32F:
+			if (dstFormat == PF_RGBA16F)
+				return &pixelConvertFloatToHalf<4>;
+
+			break;
+		case PF_R16F:
+			if (dstFormat == PF_R32F)
+				return &pixelConvertHalfToFloat<1>;
+
+			break;
+		case PF_RGBA16F:
+			if (dstFormat == PF_RGBA32F)
+				return &pixelConvertHalfToFloat<4>;
+
+			break;
+		default:
+			break;
+		}
+
+		return nullptr;
+	}
+
 	void PixelUtil::bulkPixelConversion(const PixelData &src, PixelData &dst)
 	{
 		assert(src.getWidth() == dst.getWidth() &&
@@ -1955,33 +2111,61 @@ namespace bs
 			+ (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
 
 		// Calculate pitches+skips in bytes
-		UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
-		UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
-		UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
-		UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
+		UINT32 srcRowPitchBytes = src.getRowPitch()*srcPixelSize;
+		UINT32 srcSlicePitchBytes = src.getSlicePitch()*srcPixelSize;
+		UINT32 dstRowPitchBytes = dst.getRowPitch()*dstPixelSize;
+		UINT32 dstSlicePitchBytes = dst.getSlicePitch()*dstPixelSize;
 
-		// The brute force fallback
-		float r, g, b, a;
-		for (UINT32 z = src.getFront(); z < src.getBack(); z++)
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
+		const UINT32 totalRows = height * src.getDepth();
+
+		// Check if a fast conversion path exists for this format pair
+		PixelConversionFunc fastConvert = getFastConversionFunc(src.getFormat(), dst.getFormat());
+		if (fastConvert != nullptr)
 		{
-			for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
+			processRangeParallel(totalRows, 512, [&](UINT32 start, UINT32 end)
 			{
-				for (UINT32 x = src.getLeft(); x < src.getRight(); x++)
+				for (UINT32 i = start; i < end; i++)
 				{
-					unpackColor(&r, &g, &b, &a, src.getFormat(), srcptr);
-					packColor(r, g, b, a, dst.getFormat(), dstptr);
+					UINT32 z = i / height;
+					UINT32 y = i % height;
 
-					srcptr += srcPixelSize;
-					dstptr += dstPixelSize;
-				}
+					const UINT8* srcRow = srcptr + z * srcSlicePitchBytes + y * srcRowPitchBytes;
+					UINT8* dstRow = dstptr + z * dstSlicePitchBytes + y * dstRowPitchBytes;
 
-				srcptr += srcRowSkipBytes;
-				dstptr += dstRowSkipBytes;
-			}
+					fastConvert(srcRow, dstRow, width);
+				}
+			});
 
-			srcptr += srcSliceSkipBytes;
-			dstptr += dstSliceSkipBytes;
+			return;
 		}
+
+		// The brute force fallback
+		const PixelFormat srcFormat = src.getFormat();
+		const PixelFormat dstFormat = dst.getFormat();
+
+		processRangeParallel(totalRows, 64, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				UINT32 z = i / height;
+				UINT32 y = i % height;
+
+				const UINT8* srcRow = srcptr + z * srcSlicePitchBytes + y * srcRowPitchBytes;
+				UINT8* dstRow = dstptr + z * dstSlicePitchBytes + y * dstRowPitchBytes;
+
+				float r, g, b, a;
+				for (UINT32 x = 0; x < width; x++)
+				{
+					unpackColor(&r, &g, &b, &a, srcFormat, srcRow);
+					packColor(r, g, b, a, dstFormat, dstRow);
+
+					srcRow += srcPixelSize;
+					dstRow += dstPixelSize;
+				}
+			}
+		});
 	}
 
 	void PixelUtil::flipComponentOrder(PixelData& data)
@@ -2402,40 +2586,63 @@ namespace bs
 		interimData.allocateInternalBuffer();
 		bulkPixelConversion(src, interimData);
 
-		nvtt::InputOptions io;
-		io.setTextureLayout(nvtt::TextureType_2D, src.getWidth(), src.getHeight());
-		io.setMipmapGeneration(false);
-		io.setAlphaMode(toNVTTAlphaMode(options.alphaMode));
-		io.setNormalMap(options.isNormalMap);
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
 
-		if (interimFormat == PF_RGBA32F)
-			io.setFormat(nvtt::InputFormat_RGBA_32F);
-		else
-			io.setFormat(nvtt::InputFormat_BGRA_8UB);
+		// Each row of 4x4 blocks compresses independently, so split large images into slabs of block rows and
+		// compress them in parallel on worker threads
+		const UINT32 numBlockRows = (height + 3) / 4;
+		const UINT32 blockRowPitch = getMemorySize(width, 4, 1, options.format);
+		const UINT32 interimRowPitch = width * getNumElemBytes(interimFormat);
 
-		if (options.isSRGB)
-			io.setGamma(2.2f, 2.2f);
-		else
-			io.setGamma(1.0f, 1.0f);
+		UINT8* interimBase = interimData.getData();
+		UINT8* dstData = dst.getData();
+		const UINT32 dstSize = dst.getConsecutiveSize();
 
-		io.setMipmapData(interimData.getData(), src.getWidth(), src.getHeight());
+		std::atomic<bool> success(true);
+		processRangeParallel(numBlockRows, 16, [&](UINT32 start, UINT32 end)
+		{
+			UINT32 slabTop = start * 4;
+			UINT32 slabHeight = std::min(height - slabTop, (end - start) * 4);
 
-		nvtt::CompressionOptions co;
-		co.setFormat(toNVTTFormat(options.format));
-		co.setQuality(toNVTTQuality(options.quality));
+			nvtt::InputOptions io;
+			io.setTextureLayout(nvtt::TextureType_2D, width, slabHeight);
+			io.setMipmapGeneration(false);
+			io.setAlphaMode(toNVTTAlphaMode(options.alphaMode));
+			io.setNormalMap(options.isNormalMap);
 
-		NVTTCompressOutputHandler outputHandler(dst.getData(), dst.getConsecutiveSize());
+			if (interimFormat == PF_RGBA32F)
+				io.setFormat(nvtt::InputFormat_RGBA_32F);
+			else
+				io.setFormat(nvtt::InputFormat_BGRA_8UB);
 
-		nvtt::OutputOptions oo;
-		oo.setOutputHeader(false);
-		oo.setOutputHandler(&outputHandler);
+			if (options.isSRGB)
+				io.setGamma(2.2f, 2.2f);
+			else
+				io.setGamma(1.0f, 1.0f);
 
-		nvtt::Compressor compressor;
-		if (!compressor.process(io, co, oo))
-		{
+			io.setMipmapData(interimBase + slabTop * interimRowPitch, width, slabHeight);
+
+			nvtt::CompressionOptions co;
+			co.setFormat(toNVTTFormat(options.format));
+			co.setQuality(toNVTTQuality(options.quality));
+
+			UINT32 dstOffset = start * blockRowPitch;
+			UINT32 slabSize = std::min(dstSize - dstOffset, (end - start) * blockRowPitch);
+
+			NVTTCompressOutputHandler outputHandler(dstData + dstOffset, slabSize);
+
+			nvtt::OutputOptions oo;
+			oo.setOutputHeader(false);
+			oo.setOutputHandler(&outputHandler);
+
+			nvtt::Compressor compressor;
+			if (!compressor.process(io, co, oo))
+				success = false;
+		});
+
+		if (!success)
 			LOGERR("Compression failed. Internal error.");
-			return;
-		}
 	}
 
 	Vector<SPtr<PixelData>> PixelUtil::genMipmaps(const PixelData& src, const MipMapGenOptions& options)
@@ -9,6 +9,7 @@
 #include "Threading/BsAsyncOp.h"
 #include "Resources/BsResources.h"
 #include "Image/BsPixelUtil.h"
+#include "RenderAPI/BsGpuMemoryBudget.h"
 
 namespace bs 
 {
@@ -329,8 +330,45 @@ namespace bs
 		:mProperties(desc), mInitData(initData)
 	{ }
 
+	Texture::~Texture()
+	{
+		if (mAccountedMemory > 0 && GpuMemoryBudget::isStarted())
+		{
+			GpuMemoryCategory category = (mProperties.getUsage() & (TU_RENDERTARGET | TU_DEPTHSTENCIL)) != 0
+				? GpuMemoryCategory::RenderTarget : GpuMemoryCategory::Texture;
+
+			GpuMemoryBudget::instance().notifyFreed(category, mAccountedMemory);
+		}
+	}
+
 	void Texture::initialize()
 	{
+		if (GpuMemoryBudget::isStarted())
+		{
+			// Estimate based on dimensions and format - actual driver-side consumption will be somewhat higher due to
+			// alignment and padding
+			UINT64 numBytes = 0;
+			for (UINT32 mip = 0; mip <= mProperties.getNumMipmaps(); mip++)
+			{
+				UINT32 mipWidth, mipHeight, mipDepth;
+				PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+					mip, mipWidth, mipHeight, mipDepth);
+
+				numBytes += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, mProperties.getFormat());
+			}
+
+			numBytes *= mProperties.getNumFaces();
+
+			if (mProperties.getNumSamples() > 1)
+				numBytes *= mProperties.getNumSamples();
+
+			GpuMemoryCategory category = (mProperties.getUsage() & (TU_RENDERTARGET | TU_DEPTHSTENCIL)) != 0
+				? GpuMemoryCategory::RenderTarget : GpuMemoryCategory::Texture;
+
+			GpuMemoryBudget::instance().notifyAllocated(category, numBytes);
+			mAccountedMemory = numBytes;
+		}
+
 		if (mInitData != nullptr)
 		{
 			writeData(*mInitData, 0, 0, true);
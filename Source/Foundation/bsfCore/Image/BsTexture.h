@@ -177,6 +177,7 @@ namespace bs
 	protected:
 		friend class TextureRTTI;
 		friend class Texture;
+		friend class TextureUploadBatch;
 
 		/**
 		 * Maps a sub-resource index to an exact face and mip level. Sub-resource indexes are used when reading or writing
@@ -299,6 +300,7 @@ namespace bs
 
 	protected:
 		friend class TextureManager;
+		friend class TextureUploadBatch;
 
 		Texture(const TEXTURE_DESC& desc);
 		Texture(const TEXTURE_DESC& desc, const SPtr<PixelData>& pixelData);
@@ -355,7 +357,7 @@ namespace bs
 	{
 	public:
 		Texture(const TEXTURE_DESC& desc, const SPtr<PixelData>& initData, GpuDeviceFlags deviceMask);
-		virtual ~Texture() {}
+		virtual ~Texture();
 
 
 		/** @copydoc CoreObject::initialize */
@@ -513,6 +515,7 @@ namespace bs
 		UnorderedMap<TEXTURE_VIEW_DESC, SPtr<TextureView>, TextureView::HashFunction, TextureView::EqualFunction> mTextureViews;
 		TextureProperties mProperties;
 		SPtr<PixelData> mInitData;
+		UINT64 mAccountedMemory = 0;
 	};
 
 	/** @} */
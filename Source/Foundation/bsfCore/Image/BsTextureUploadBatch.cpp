@@ -0,0 +1,126 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Image/BsTextureUploadBatch.h"
+#include "Image/BsTexture.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Threading/BsAsyncOp.h"
+#include "Debug/BsDebug.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	TextureUploadBatch::~TextureUploadBatch()
+	{
+		// Any writes queued but never flushed are discarded
+		if (mStagingBuffer != nullptr)
+			bs_free(mStagingBuffer);
+	}
+
+	void TextureUploadBatch::writeData(const HTexture& texture, const PixelData& data, UINT32 face, UINT32 mipLevel,
+		bool discardEntireBuffer)
+	{
+		if (!texture.isLoaded())
+		{
+			LOGERR("Attempting to batch a write to a texture that hasn't been loaded.");
+			return;
+		}
+
+		UINT32 subresourceIdx = texture->getProperties().mapToSubresourceIdx(face, mipLevel);
+		texture->updateCPUBuffers(subresourceIdx, data);
+
+		const UINT32 size = data.getSize();
+
+		BatchEntry entry;
+		entry.texture = texture->getCore();
+		entry.face = face;
+		entry.mipLevel = mipLevel;
+		entry.discardEntireBuffer = discardEntireBuffer;
+		entry.offset = 0;
+		entry.size = size;
+
+		if (data.getBufferLifetimeToken() != nullptr)
+		{
+			// Token-backed view over foreign memory - reference it and hold the token instead of staging a copy
+			entry.sourceData = data.getData();
+			entry.sourceToken = data.getBufferLifetimeToken();
+		}
+		else
+		{
+			// Keep entries 16-byte aligned so pixel rows remain friendly to any SIMD copies done by the backend
+			const UINT32 offset = Math::divideAndRoundUp(mStagingSize, 16U) * 16;
+
+			reserveStaging(offset + size);
+			memcpy(mStagingBuffer + offset, data.getData(), size);
+			mStagingSize = offset + size;
+
+			entry.offset = offset;
+		}
+		entry.extents = data.getExtents();
+		entry.format = data.getFormat();
+		entry.rowPitch = data.getRowPitch();
+		entry.slicePitch = data.getSlicePitch();
+
+		mEntries.push_back(entry);
+	}
+
+	AsyncOp TextureUploadBatch::flush()
+	{
+		if (mEntries.empty())
+		{
+			AsyncOp noOp;
+			noOp._completeOperation();
+
+			return noOp;
+		}
+
+		// The command takes ownership of both the entry list and the staging buffer, so queueing new writes right
+		// after the flush doesn't touch memory the core thread may still be reading.
+		Vector<BatchEntry> entries = std::move(mEntries);
+		UINT8* staging = mStagingBuffer;
+
+		mEntries.clear();
+		mStagingBuffer = nullptr;
+		mStagingCapacity = 0;
+		mStagingSize = 0;
+
+		auto executeBatch = [entries = std::move(entries), staging](AsyncOp& asyncOp)
+		{
+			for (auto& entry : entries)
+			{
+				PixelData pixelData(entry.extents, entry.format);
+				pixelData.setRowPitch(entry.rowPitch);
+				pixelData.setSlicePitch(entry.slicePitch);
+
+				if (entry.sourceData != nullptr)
+					pixelData.setExternalBuffer(entry.sourceData, entry.sourceToken);
+				else
+					pixelData.setExternalBuffer(staging + entry.offset);
+
+				entry.texture->writeData(pixelData, entry.mipLevel, entry.face, entry.discardEntireBuffer);
+			}
+
+			bs_free(staging);
+			asyncOp._completeOperation();
+		};
+
+		return gCoreThread().queueReturnCommand(std::move(executeBatch));
+	}
+
+	void TextureUploadBatch::reserveStaging(UINT32 numBytes)
+	{
+		if (numBytes <= mStagingCapacity)
+			return;
+
+		UINT32 newCapacity = std::max(mStagingCapacity * 2, numBytes);
+		UINT8* newBuffer = (UINT8*)bs_alloc(newCapacity);
+
+		if (mStagingBuffer != nullptr)
+		{
+			memcpy(newBuffer, mStagingBuffer, mStagingSize);
+			bs_free(mStagingBuffer);
+		}
+
+		mStagingBuffer = newBuffer;
+		mStagingCapacity = newCapacity;
+	}
+}
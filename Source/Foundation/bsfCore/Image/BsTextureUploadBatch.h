@@ -0,0 +1,92 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Image/BsPixelData.h"
+
+namespace bs
+{
+	/** @addtogroup Resources
+	 *  @{
+	 */
+
+	/**
+	 * Accumulates writes to multiple texture subresources and submits them all to the core thread as a single command.
+	 * Compared to calling Texture::writeData() once per subresource this queues a single core thread command and packs
+	 * the pixel data of all writes into one staging allocation, avoiding per-write queueing and allocation overhead.
+	 * Useful when texture streaming loads in many small subresources (e.g. mip tails) during a single frame.
+	 *
+	 * @note	Sim thread.
+	 */
+	class BS_CORE_EXPORT TextureUploadBatch
+	{
+	public:
+		~TextureUploadBatch();
+
+		/**
+		 * Queues a write to a subresource of a texture. The pixel data is copied into an internal staging buffer
+		 * immediately, meaning the caller is free to modify or release @p data as soon as the call returns. No GPU
+		 * data is modified until the next flush().
+		 *
+		 * As an exception, if @p data is a view over foreign memory with a lifetime token (see
+		 * PixelData::createView()), its buffer is referenced instead of copied and the token is held until the write
+		 * has executed on the core thread. The caller must not modify the referenced memory until the operation
+		 * returned from flush() completes.
+		 *
+		 * @param[in]	texture				Texture to write to.
+		 * @param[in]	data				Pixel data to write. User must ensure it is in format and size compatible
+		 *									with the texture subresource.
+		 * @param[in]	face				Texture face to write to.
+		 * @param[in]	mipLevel			Mipmap level to write to.
+		 * @param[in]	discardEntireBuffer	When true the existing contents of the subresource will be discarded. This
+		 *									can make the operation faster.
+		 */
+		void writeData(const HTexture& texture, const PixelData& data, UINT32 face = 0, UINT32 mipLevel = 0,
+			bool discardEntireBuffer = false);
+
+		/**
+		 * Submits all writes queued since the last flush to the core thread as a single command, then clears the
+		 * batch. Ownership of the staging buffer is passed to the command, which releases it once all the writes have
+		 * executed, so flushing once per frame results in a single allocation per frame regardless of the number of
+		 * queued writes.
+		 *
+		 * @return	Async operation object you can use to track completion of all the queued writes. Returns a
+		 *			completed operation if the batch is empty.
+		 *
+		 * @note This is an @ref asyncMethod "asynchronous method".
+		 */
+		AsyncOp flush();
+
+		/** Returns the number of writes queued since the last flush. */
+		UINT32 getNumPending() const { return (UINT32)mEntries.size(); }
+
+	private:
+		/**	Describes a single queued subresource write. */
+		struct BatchEntry
+		{
+			SPtr<ct::Texture> texture;
+			UINT32 face;
+			UINT32 mipLevel;
+			bool discardEntireBuffer;
+			UINT32 offset; /**< Offset into the staging buffer at which the pixel data of this entry begins. */
+			UINT32 size;
+			UINT8* sourceData = nullptr; /**< When non-null the entry references foreign memory instead of the staging buffer. */
+			SPtr<const void> sourceToken; /**< Keeps the foreign memory referenced by sourceData alive. */
+			PixelVolume extents;
+			PixelFormat format;
+			UINT32 rowPitch;
+			UINT32 slicePitch;
+		};
+
+		/** Ensures the staging buffer can hold at least @p numBytes, reallocating and preserving contents if needed. */
+		void reserveStaging(UINT32 numBytes);
+
+		Vector<BatchEntry> mEntries;
+		UINT8* mStagingBuffer = nullptr;
+		UINT32 mStagingCapacity = 0;
+		UINT32 mStagingSize = 0;
+	};
+
+	/** @} */
+}
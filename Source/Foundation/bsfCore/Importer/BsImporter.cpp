@@ -129,6 +129,48 @@ namespace bs
 		return output;
 	}
 
+	Vector<AsyncOp> Importer::importBatchAsync(const Vector<BatchImportEntry>& entries, TaskPriority priority, bool handle)
+	{
+		Vector<AsyncOp> output;
+		output.reserve(entries.size());
+
+		for(auto& entry : entries)
+		{
+			AsyncOp op;
+
+			SPtr<const ImportOptions> importOptions = entry.importOptions;
+			SpecificImporter* importer = prepareForImport(entry.filePath, importOptions);
+			if(!importer)
+			{
+				if(entry.importAll)
+					op._completeOperation(Vector<SubResource>());
+				else
+					op._completeOperation(HResource());
+
+				output.push_back(op);
+				continue;
+			}
+
+			// Fall back on sync if not supported
+			ImporterAsyncMode asyncMode = importer->getAsyncMode();
+			if(asyncMode == ImporterAsyncMode::None)
+			{
+				if(entry.importAll)
+					op._completeOperation(importAll(entry.filePath, importOptions));
+				else
+					op._completeOperation(import(entry.filePath, importOptions, entry.uuid));
+
+				output.push_back(op);
+				continue;
+			}
+
+			queueForImport(importer, entry.filePath, importOptions, entry.importAll, entry.uuid, handle, op, priority);
+			output.push_back(op);
+		}
+
+		return output;
+	}
+
 	SPtr<Resource> Importer::_import(const Path& inputFilePath, SPtr<const ImportOptions> importOptions) const
 	{
 		SpecificImporter* importer = prepareForImport(inputFilePath, importOptions);
@@ -196,8 +238,9 @@ namespace bs
 		}
 	}
 
-	void Importer::queueForImport(SpecificImporter* importer, const Path& inputFilePath, 
-		SPtr<const ImportOptions> importOptions, bool importAll, const UUID& uuid, bool handle, AsyncOp& op)
+	void Importer::queueForImport(SpecificImporter* importer, const Path& inputFilePath,
+		SPtr<const ImportOptions> importOptions, bool importAll, const UUID& uuid, bool handle, AsyncOp& op,
+		TaskPriority priority)
 	{
 		ImporterAsyncMode asyncMode = importer->getAsyncMode();
 
@@ -269,7 +312,7 @@ namespace bs
 				mTaskCompleted.notify_one();
 			}
 
-		}, TaskPriority::Normal, dependency);
+		}, priority, dependency);
 
 		if(asyncMode == ImporterAsyncMode::Single)
 		{
@@ -6,6 +6,7 @@
 #include "Utility/BsModule.h"
 #include "Importer/BsSpecificImporter.h"
 #include "Threading/BsAsyncOp.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -23,6 +24,28 @@ namespace bs
 		HResource value; /**< Contents of the sub-resource. */
 	};
 
+	/** A single file in a batch import request. See Importer::importBatchAsync(). */
+	struct BatchImportEntry
+	{
+		Path filePath; /**< Pathname of the input file. */
+
+		/**
+		 * Optional options for controlling the import. Caller must ensure import options actually match the type of the
+		 * importer used for the file type.
+		 */
+		SPtr<const ImportOptions> importOptions;
+
+		/**
+		 * If true all resources in the file are imported (see importAll()). The file is decoded just once, and all its
+		 * outputs (for example an FBX mesh and its animation clips) are produced from the shared decoded data. If false
+		 * only the primary resource is imported.
+		 */
+		bool importAll = false;
+
+		/** Specific UUID to assign to the primary resource. If empty a randomly generated UUID will be assigned. */
+		UUID uuid = UUID::EMPTY;
+	};
+
 	/** Module responsible for importing various asset types and converting them to types usable by the engine. */
 	class BS_CORE_EXPORT Importer : public Module<Importer>
 	{
@@ -83,9 +106,27 @@ namespace bs
 		 * contain a Vector<SubResource> containing the imported resources, after the import ends. If @p handle is true, 
 		 * the returned object will be a resource handle, otherwise it will be a SPtr to the resource.
 		 */
-		AsyncOp importAllAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions = nullptr, 
+		AsyncOp importAllAsync(const Path& inputFilePath, SPtr<const ImportOptions> importOptions = nullptr,
 			bool handle = true);
 
+		/**
+		 * Imports a set of files without blocking the main thread. Files are distributed across worker threads and
+		 * imported in parallel where their importers allow it, which is significantly faster than importing them one by
+		 * one. Entries that import multiple outputs from the same file (see BatchImportEntry::importAll) decode the file
+		 * only once.
+		 *
+		 * @param[in]	entries		Files to import.
+		 * @param[in]	priority	Priority at which the batch executes, relative to other queued imports. Use higher
+		 *							priorities for imports the requester is actively waiting on (for example a resource
+		 *							needed by the current scene) and lower ones for background cooks.
+		 * @param[in]	handle		If true the returned objects will contain resource handles, otherwise SPtr-s to the
+		 *							resources.
+		 * @return					One AsyncOp per input entry, in the same order. Each contains the same result its
+		 *							importAsync()/importAllAsync() equivalent would produce.
+		 */
+		Vector<AsyncOp> importBatchAsync(const Vector<BatchImportEntry>& entries,
+			TaskPriority priority = TaskPriority::Normal, bool handle = true);
+
 		/**
 		 * Automatically detects the importer needed for the provided file and returns valid type of import options for 
 		 * that importer.
@@ -180,8 +221,8 @@ namespace bs
 		 * Queues resource for import on a secondary thread. The system will execute the import as soon as possible
 		 * and write the resulting resource to the provided @p op object. 
 		 */
-		void queueForImport(SpecificImporter* importer, const Path& inputFilePath, SPtr<const ImportOptions> importOptions, 
-			bool importAll, const UUID& uuid, bool handle, AsyncOp& op);
+		void queueForImport(SpecificImporter* importer, const Path& inputFilePath, SPtr<const ImportOptions> importOptions,
+			bool importAll, const UUID& uuid, bool handle, AsyncOp& op, TaskPriority priority = TaskPriority::Normal);
 
 		/**
 		 * Prepares for import of a file at the specified path. Returns the type of importer the file can be imported with,
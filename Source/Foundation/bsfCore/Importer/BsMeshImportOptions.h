@@ -165,6 +165,48 @@ namespace bs
 		 */
 		bool getImportRootMotion() const { return mImportRootMotion; }
 
+		/**
+		 * Sets the number of level of detail versions to generate for the imported mesh, not counting the base level.
+		 * Each level contains progressively simplified geometry that the renderer can use when the mesh takes up a small
+		 * portion of the screen. Set to zero to disable LOD generation.
+		 */
+		void setGenerateLodLevels(UINT32 numLevels) { mGenerateLodLevels = numLevels; }
+
+		/**
+		 * Returns the number of level of detail versions to generate for the imported mesh.
+		 *
+		 * @see	setGenerateLodLevels
+		 */
+		UINT32 getGenerateLodLevels() const { return mGenerateLodLevels; }
+
+		/**
+		 * Enables or disables the post-import mesh optimization pass, which reorders triangles for better GPU vertex
+		 * cache usage and reduced overdraw, and vertices for better fetch locality. Enabled by default, with no effect
+		 * on the visual result.
+		 */
+		void setOptimizeMesh(bool optimize) { mOptimizeMesh = optimize; }
+
+		/**
+		 * Checks if the post-import mesh optimization pass is enabled.
+		 *
+		 * @see	setOptimizeMesh
+		 */
+		bool getOptimizeMesh() const { return mOptimizeMesh; }
+
+		/**
+		 * Enables or disables generation of a bounding volume hierarchy over the mesh triangles during import. The
+		 * hierarchy is stored with the mesh resource and accelerates triangle-accurate ray casts against the mesh (e.g.
+		 * mouse picking), at the cost of additional memory and import time. Disabled by default.
+		 */
+		void setGenerateBVH(bool generate) { mGenerateBVH = generate; }
+
+		/**
+		 * Checks if a bounding volume hierarchy will be generated during import.
+		 *
+		 * @see	setGenerateBVH
+		 */
+		bool getGenerateBVH() const { return mGenerateBVH; }
+
 		/** Creates a new import options object that allows you to customize how are meshes imported. */
 		static SPtr<MeshImportOptions> create();
 
@@ -177,6 +219,9 @@ namespace bs
 		bool mImportAnimation;
 		bool mReduceKeyFrames;
 		bool mImportRootMotion;
+		bool mOptimizeMesh;
+		bool mGenerateBVH;
+		UINT32 mGenerateLodLevels;
 		float mImportScale;
 		CollisionMeshType mCollisionMeshType;
 		Vector<AnimationSplitInfo> mAnimationSplits;
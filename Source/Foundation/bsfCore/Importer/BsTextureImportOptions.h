@@ -39,6 +39,13 @@ namespace bs
 		 */
 		void setSRGB(bool sRGB) { mSRGB = sRGB; }
 
+		/**
+		 * Sets the quality to use when compressing the texture into a block compressed format. Lower quality levels
+		 * compress significantly faster, which is useful for iteration builds. Only relevant if the import format is a
+		 * compressed format.
+		 */
+		void setCompressionQuality(CompressionQuality quality) { mCompressionQuality = quality; }
+
 		/** Gets the pixel format to import as. */
 		PixelFormat getFormat() const { return mFormat; }
 
@@ -60,6 +67,9 @@ namespace bs
 		 */
 		bool getSRGB() const { return mSRGB; }
 
+		/** Retrieves the quality to use when compressing the texture into a block compressed format. */
+		CompressionQuality getCompressionQuality() const { return mCompressionQuality; }
+
 		/** 
 		 * Determines should the texture be imported as a cubemap. See setCubemapSource to choose how will the source
 		 * texture be converted to a cubemap.
@@ -100,6 +110,7 @@ namespace bs
 		bool mSRGB;
 		bool mCubemap;
 		CubemapSourceType mCubemapSourceType;
+		CompressionQuality mCompressionQuality;
 	};
 
 	/** @} */
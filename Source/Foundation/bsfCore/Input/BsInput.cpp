@@ -8,6 +8,7 @@
 #include "Math/BsMath.h"
 #include "Managers/BsRenderWindowManager.h"
 #include "BsCoreApplication.h"
+#include "Debug/BsDebug.h"
 
 using namespace std::placeholders;
 
@@ -26,7 +27,7 @@ namespace bs
 	}
 
 	Input::Input()
-		: mPointerDoubleClicked(false), mLastPositionSet(false), mMouseScroll(0.0f), mMouseSmoothingEnabled(false)
+		: mPointerDoubleClicked(false), mLastPositionSet(false), mMouseSmoothingEnabled(false)
 		, mMouse(nullptr), mKeyboard(nullptr)
 	{
 		SPtr<RenderWindow> primaryWindow = gCoreApplication().getPrimaryWindow();
@@ -145,52 +146,75 @@ namespace bs
 
 	void Input::_triggerCallbacks()
 	{
-		Vector2I pointerPos;
-		float mouseScroll;
-		OSPointerButtonStates pointerState;
+		// Button events are queued during raw input capture, which happens on this thread, so no locking is required
+		std::swap(mQueuedEvents[0], mQueuedEvents[1]);
+		std::swap(mButtonDownEvents[0], mButtonDownEvents[1]);
+		std::swap(mButtonUpEvents[0], mButtonUpEvents[1]);
 
-		{
-			Lock lock(mMutex);
-
-			std::swap(mQueuedEvents[0], mQueuedEvents[1]);
-
-			std::swap(mButtonDownEvents[0], mButtonDownEvents[1]);
-			std::swap(mButtonUpEvents[0], mButtonUpEvents[1]);
-
-			std::swap(mPointerPressedEvents[0], mPointerPressedEvents[1]);
-			std::swap(mPointerReleasedEvents[0], mPointerReleasedEvents[1]);
-			std::swap(mPointerDoubleClickEvents[0], mPointerDoubleClickEvents[1]);
+		mPointerMoveHistory.clear();
 
-			std::swap(mTextInputEvents[0], mTextInputEvents[1]);
-			std::swap(mCommandEvents[0], mCommandEvents[1]);
+		// Drain OS events queued by the platform message thread, coalescing consecutive pointer moves into a single
+		// per-frame event. High-polling-rate mice can report thousands of moves per frame, and nothing downstream wants
+		// a callback per sample - those that do can opt in to the full history instead.
+		bool pointerMoved = false;
+		float mouseScroll = 0.0f;
+		PointerEvent moveEvent;
 
-			pointerPos = mPointerPosition;
-			mouseScroll = mMouseScroll;
-			pointerState = mPointerState;
+		OSInputEvent osEvent;
+		while (mOSEventQueue.pop(osEvent))
+		{
+			switch (osEvent.type)
+			{
+			case EventType::PointerMoved:
+				mouseScroll += osEvent.pointer.mouseWheelScrollAmount;
+				moveEvent = osEvent.pointer;
+				pointerMoved = true;
 
-			mMouseScroll = 0.0f;
+				if (mPointerMoveHistoryEnabled)
+					mPointerMoveHistory.push_back(osEvent.pointer);
+				break;
+			case EventType::PointerDown:
+				mQueuedEvents[1].push_back(QueuedEvent(EventType::PointerDown, (UINT32)mPointerPressedEvents.size()));
+				mPointerPressedEvents.push_back(osEvent.pointer);
+				break;
+			case EventType::PointerUp:
+				mQueuedEvents[1].push_back(QueuedEvent(EventType::PointerUp, (UINT32)mPointerReleasedEvents.size()));
+				mPointerReleasedEvents.push_back(osEvent.pointer);
+				break;
+			case EventType::PointerDoubleClick:
+				mQueuedEvents[1].push_back(QueuedEvent(EventType::PointerDoubleClick, (UINT32)mPointerDoubleClickEvents.size()));
+				mPointerDoubleClickEvents.push_back(osEvent.pointer);
+				break;
+			case EventType::TextInput:
+				mQueuedEvents[1].push_back(QueuedEvent(EventType::TextInput, (UINT32)mTextInputEvents.size()));
+				mTextInputEvents.push_back(osEvent.text);
+				break;
+			case EventType::Command:
+				mQueuedEvents[1].push_back(QueuedEvent(EventType::Command, (UINT32)mCommandEvents.size()));
+				mCommandEvents.push_back(osEvent.command);
+				break;
+			default:
+				break;
+			}
 		}
 
-		if(pointerPos != mLastPointerPosition || mouseScroll != 0.0f)
+		if (pointerMoved)
+			mPointerPosition = moveEvent.screenPos;
+
+		if ((pointerMoved && moveEvent.screenPos != mLastPointerPosition) || mouseScroll != 0.0f)
 		{
-			PointerEvent event;
-			event.alt = false;
-			event.shift = pointerState.shift;
-			event.control = pointerState.ctrl;
-			event.buttonStates[0] = pointerState.mouseButtons[0];
-			event.buttonStates[1] = pointerState.mouseButtons[1];
-			event.buttonStates[2] = pointerState.mouseButtons[2];
-			event.mouseWheelScrollAmount = mouseScroll;
+			if (!pointerMoved)
+				moveEvent.screenPos = mLastPointerPosition;
 
-			event.type = PointerEventType::CursorMoved;
-			event.screenPos = pointerPos;
+			moveEvent.type = PointerEventType::CursorMoved;
+			moveEvent.mouseWheelScrollAmount = mouseScroll;
 
-			onPointerMoved(event);
+			onPointerMoved(moveEvent);
 
 			if (mLastPositionSet)
-				mPointerDelta = event.screenPos - mLastPointerPosition;
+				mPointerDelta = moveEvent.screenPos - mLastPointerPosition;
 
-			mLastPointerPosition = event.screenPos;
+			mLastPointerPosition = moveEvent.screenPos;
 			mLastPositionSet = true;
 		}
 
@@ -223,7 +247,7 @@ namespace bs
 				break;
 			case EventType::PointerDown:
 			{
-				const PointerEvent& eventData = mPointerPressedEvents[1][event.idx];
+				const PointerEvent& eventData = mPointerPressedEvents[event.idx];
 				mPointerButtonStates[(UINT32)eventData.button] = ButtonState::ToggledOn;
 
 				onPointerPressed(eventData);
@@ -231,7 +255,7 @@ namespace bs
 				break;
 			case EventType::PointerUp:
 			{
-				const PointerEvent& eventData = mPointerReleasedEvents[1][event.idx];
+				const PointerEvent& eventData = mPointerReleasedEvents[event.idx];
 
 				if (mPointerButtonStates[(UINT32)eventData.button] == ButtonState::ToggledOn)
 					mPointerButtonStates[(UINT32)eventData.button] = ButtonState::ToggledOnOff;
@@ -243,13 +267,13 @@ namespace bs
 				break;
 			case EventType::PointerDoubleClick:
 				mPointerDoubleClicked = true;
-				onPointerDoubleClick(mPointerDoubleClickEvents[1][event.idx]);
+				onPointerDoubleClick(mPointerDoubleClickEvents[event.idx]);
 				break;
 			case EventType::TextInput:
-				onCharInput(mTextInputEvents[1][event.idx]);
+				onCharInput(mTextInputEvents[event.idx]);
 				break;
 			case EventType::Command:
-				onInputCommand(mCommandEvents[1][event.idx]);
+				onInputCommand(mCommandEvents[event.idx]);
 				break;
 			default:
 				break;
@@ -259,11 +283,11 @@ namespace bs
 		mQueuedEvents[1].clear();
 		mButtonDownEvents[1].clear();
 		mButtonUpEvents[1].clear();
-		mPointerPressedEvents[1].clear();
-		mPointerReleasedEvents[1].clear();
-		mPointerDoubleClickEvents[1].clear();
-		mTextInputEvents[1].clear();
-		mCommandEvents[1].clear();
+		mPointerPressedEvents.clear();
+		mPointerReleasedEvents.clear();
+		mPointerDoubleClickEvents.clear();
+		mTextInputEvents.clear();
+		mCommandEvents.clear();
 	}
 
 	void Input::inputWindowChanged(RenderWindow& win)
@@ -332,8 +356,7 @@ namespace bs
 
 	void Input::buttonDown(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp)
 	{
-		Lock lock(mMutex);
-
+		// Raw input is captured from the sim thread, same thread the events are dispatched from, so no locking needed
 		while (deviceIdx >= (UINT32)mDevices.size())
 			mDevices.push_back(DeviceData());
 
@@ -348,8 +371,6 @@ namespace bs
 
 	void Input::buttonUp(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp)
 	{
-		Lock lock(mMutex);
-
 		ButtonEvent btnEvent;
 		btnEvent.buttonCode = code;
 		btnEvent.timestamp = timestamp;
@@ -374,15 +395,28 @@ namespace bs
 
 	void Input::cursorMoved(const Vector2I& cursorPos, const OSPointerButtonStates& btnStates)
 	{
-		Lock lock(mMutex);
+		mOSPointerPosition = cursorPos;
+		mOSPointerState = btnStates;
+
+		OSInputEvent osEvent;
+		osEvent.type = EventType::PointerMoved;
+		osEvent.pointer.alt = false;
+		osEvent.pointer.shift = btnStates.shift;
+		osEvent.pointer.control = btnStates.ctrl;
+		osEvent.pointer.buttonStates[0] = btnStates.mouseButtons[0];
+		osEvent.pointer.buttonStates[1] = btnStates.mouseButtons[1];
+		osEvent.pointer.buttonStates[2] = btnStates.mouseButtons[2];
+		osEvent.pointer.screenPos = cursorPos;
+		osEvent.pointer.type = PointerEventType::CursorMoved;
 
-		mPointerPosition = cursorPos;
-		mPointerState = btnStates;
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping a pointer move event.");
 	}
 
 	void Input::cursorPressed(const Vector2I& cursorPos, OSMouseButton button, const OSPointerButtonStates& btnStates)
 	{
-		Lock lock(mMutex);
+		mOSPointerPosition = cursorPos;
+		mOSPointerState = btnStates;
 
 		PointerEvent event;
 		event.alt = false;
@@ -410,13 +444,18 @@ namespace bs
 		event.screenPos = cursorPos;
 		event.type = PointerEventType::ButtonPressed;
 
-		mQueuedEvents[0].push_back(QueuedEvent(EventType::PointerDown, (UINT32)mPointerPressedEvents[0].size()));
-		mPointerPressedEvents[0].push_back(event);
+		OSInputEvent osEvent;
+		osEvent.type = EventType::PointerDown;
+		osEvent.pointer = event;
+
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping a pointer press event.");
 	}
 
 	void Input::cursorReleased(const Vector2I& cursorPos, OSMouseButton button, const OSPointerButtonStates& btnStates)
 	{
-		Lock lock(mMutex);
+		mOSPointerPosition = cursorPos;
+		mOSPointerState = btnStates;
 
 		PointerEvent event;
 		event.alt = false;
@@ -444,14 +483,16 @@ namespace bs
 		event.screenPos = cursorPos;
 		event.type = PointerEventType::ButtonReleased;
 
-		mQueuedEvents[0].push_back(QueuedEvent(EventType::PointerUp, (UINT32)mPointerReleasedEvents[0].size()));
-		mPointerReleasedEvents[0].push_back(event);
+		OSInputEvent osEvent;
+		osEvent.type = EventType::PointerUp;
+		osEvent.pointer = event;
+
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping a pointer release event.");
 	}
 
 	void Input::cursorDoubleClick(const Vector2I& cursorPos, const OSPointerButtonStates& btnStates)
 	{
-		Lock lock(mMutex);
-
 		PointerEvent event;
 		event.alt = false;
 		event.shift = btnStates.shift;
@@ -463,34 +504,50 @@ namespace bs
 		event.screenPos = cursorPos;
 		event.type = PointerEventType::DoubleClick;
 
-		mQueuedEvents[0].push_back(QueuedEvent(EventType::PointerDoubleClick, (UINT32)mPointerDoubleClickEvents[0].size()));
-		mPointerDoubleClickEvents[0].push_back(event);
+		OSInputEvent osEvent;
+		osEvent.type = EventType::PointerDoubleClick;
+		osEvent.pointer = event;
+
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping a double-click event.");
 	}
 
 	void Input::inputCommandEntered(InputCommandType commandType)
 	{
-		Lock lock(mMutex);
+		OSInputEvent osEvent;
+		osEvent.type = EventType::Command;
+		osEvent.command = commandType;
 
-		mQueuedEvents[0].push_back(QueuedEvent(EventType::Command, (UINT32)mCommandEvents[0].size()));
-		mCommandEvents[0].push_back(commandType);
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping an input command event.");
 	}
 
 	void Input::mouseWheelScrolled(float scrollPos)
 	{
-		Lock lock(mMutex);
+		// Scroll is reported as a pointer move with no position change, so it coalesces with other moves this frame
+		OSInputEvent osEvent;
+		osEvent.type = EventType::PointerMoved;
+		osEvent.pointer.shift = mOSPointerState.shift;
+		osEvent.pointer.control = mOSPointerState.ctrl;
+		osEvent.pointer.buttonStates[0] = mOSPointerState.mouseButtons[0];
+		osEvent.pointer.buttonStates[1] = mOSPointerState.mouseButtons[1];
+		osEvent.pointer.buttonStates[2] = mOSPointerState.mouseButtons[2];
+		osEvent.pointer.screenPos = mOSPointerPosition;
+		osEvent.pointer.type = PointerEventType::CursorMoved;
+		osEvent.pointer.mouseWheelScrollAmount = scrollPos;
 
-		mMouseScroll = scrollPos;
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping a mouse scroll event.");
 	}
 
 	void Input::charInput(UINT32 chr)
 	{
-		Lock lock(mMutex);
-
-		TextInputEvent textInputEvent;
-		textInputEvent.textChar = chr;
+		OSInputEvent osEvent;
+		osEvent.type = EventType::TextInput;
+		osEvent.text.textChar = chr;
 
-		mQueuedEvents[0].push_back(QueuedEvent(EventType::TextInput, (UINT32)mTextInputEvents[0].size()));
-		mTextInputEvents[0].push_back(textInputEvent);
+		if (!mOSEventQueue.push(osEvent))
+			LOGWRN("Input event queue full, dropping a text input event.");
 	}
 
 	float Input::getAxisValue(UINT32 type, UINT32 deviceIdx) const
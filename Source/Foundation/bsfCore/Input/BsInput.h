@@ -6,6 +6,7 @@
 #include "Utility/BsModule.h"
 #include "Platform/BsPlatform.h"
 #include "Input/BsInputFwd.h"
+#include "Threading/BsSpscQueue.h"
 
 namespace bs
 {
@@ -60,6 +61,20 @@ namespace bs
 			UINT32 idx;
 		};
 
+		/**
+		 * OS input event as reported by the platform message thread. Carried to the sim thread through a lock-free
+		 * queue. Only the field relevant for the event type is valid.
+		 */
+		struct OSInputEvent
+		{
+			OSInputEvent() = default;
+
+			EventType type = EventType::PointerMoved;
+			PointerEvent pointer;
+			TextInputEvent text;
+			InputCommandType command = InputCommandType::Escape;
+		};
+
 	public:
 		Input();
 		~Input();
@@ -130,6 +145,23 @@ namespace bs
 		/** Enables or disables mouse smoothing. Smoothing makes the changes to mouse axes more gradual. */
 		void setMouseSmoothing(bool enabled);
 
+		/**
+		 * Enables or disables recording of the full pointer move history. Consecutive pointer move events are normally
+		 * coalesced into a single event per frame, which loses the individual samples reported by high-polling-rate
+		 * devices. When enabled every sample received during the frame is additionally recorded and can be retrieved
+		 * through getPointerMoveHistory(). Disabled by default.
+		 */
+		void setPointerMoveHistoryEnabled(bool enabled) { mPointerMoveHistoryEnabled = enabled; }
+
+		/** @copydoc setPointerMoveHistoryEnabled */
+		bool getPointerMoveHistoryEnabled() const { return mPointerMoveHistoryEnabled; }
+
+		/**
+		 * Returns all pointer move samples received during the current frame, in the order they were reported. Only
+		 * populated if setPointerMoveHistoryEnabled() was turned on, empty otherwise.
+		 */
+		const Vector<PointerEvent>& getPointerMoveHistory() const { return mPointerMoveHistory; }
+
 		/** Returns the number of detected devices of the specified type. */
 		UINT32 getDeviceCount(InputDevice device) const;
 
@@ -280,28 +312,35 @@ namespace bs
 		void inputFocusLost();
 
 	private:
-		Mutex mMutex;
-
 		Vector<DeviceData> mDevices;
 		Vector2I mLastPointerPosition;
 		Vector2I mPointerDelta;
 		ButtonState mPointerButtonStates[3];
 		bool mPointerDoubleClicked;
 		bool mLastPositionSet;
-
-		// Thread safe
 		Vector2I mPointerPosition;
-		float mMouseScroll;
-		OSPointerButtonStates mPointerState;
+
+		bool mPointerMoveHistoryEnabled = false;
+		Vector<PointerEvent> mPointerMoveHistory;
+
+		// Written only by the platform message thread, drained by the sim thread in _triggerCallbacks()
+		SpscQueue<OSInputEvent> mOSEventQueue;
+
+		// Only ever touched by the platform message thread. Tracks the last reported pointer state so scroll events can
+		// be tagged with a position.
+		Vector2I mOSPointerPosition;
+		OSPointerButtonStates mOSPointerState;
 
 		Vector<QueuedEvent> mQueuedEvents[2];
 
-		Vector<TextInputEvent> mTextInputEvents[2];
-		Vector<InputCommandType> mCommandEvents[2];
-		Vector<PointerEvent> mPointerDoubleClickEvents[2];
-		Vector<PointerEvent> mPointerReleasedEvents[2];
-		Vector<PointerEvent> mPointerPressedEvents[2];
+		// Filled from the OS event queue during dispatch. Sim thread only.
+		Vector<TextInputEvent> mTextInputEvents;
+		Vector<InputCommandType> mCommandEvents;
+		Vector<PointerEvent> mPointerDoubleClickEvents;
+		Vector<PointerEvent> mPointerReleasedEvents;
+		Vector<PointerEvent> mPointerPressedEvents;
 
+		// Queued during raw input capture, which happens on the sim thread as well
 		Vector<ButtonEvent> mButtonDownEvents[2];
 		Vector<ButtonEvent> mButtonUpEvents[2];
 
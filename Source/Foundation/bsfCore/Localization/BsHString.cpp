@@ -9,7 +9,11 @@ namespace bs
 	HString::HString(UINT32 stringTableId)
 		:mParameters(nullptr), mIsDirty(true), mStringPtr(nullptr)
 	{
-		mStringData = StringTableManager::instance().getTable(stringTableId)->getStringData(u8"");
+		mTable = StringTableManager::instance().getTable(stringTableId).getInternalPtr();
+		mIdentifier = u8"";
+
+		mStringData = mTable->getStringData(mIdentifier);
+		mTableVersion = mTable->getVersion();
 
 		if (mStringData->numParameters > 0)
 			mParameters = bs_newN<String>(mStringData->numParameters);
@@ -18,7 +22,11 @@ namespace bs
 	HString::HString(const String& identifierString, UINT32 stringTableId)
 		:mParameters(nullptr), mIsDirty(true), mStringPtr(nullptr)
 	{
-		mStringData = StringTableManager::instance().getTable(stringTableId)->getStringData(identifierString);
+		mTable = StringTableManager::instance().getTable(stringTableId).getInternalPtr();
+		mIdentifier = identifierString;
+
+		mStringData = mTable->getStringData(mIdentifier);
+		mTableVersion = mTable->getVersion();
 
 		if (mStringData->numParameters > 0)
 			mParameters = bs_newN<String>(mStringData->numParameters);
@@ -27,10 +35,13 @@ namespace bs
 	HString::HString(const String& identifierString, const String& defaultString, UINT32 stringTableId)
 		:mParameters(nullptr), mIsDirty(true), mStringPtr(nullptr)
 	{
-		HStringTable table = StringTableManager::instance().getTable(stringTableId);
-		table->setString(identifierString, StringTable::DEFAULT_LANGUAGE, defaultString);
+		mTable = StringTableManager::instance().getTable(stringTableId).getInternalPtr();
+		mIdentifier = identifierString;
+
+		mTable->setString(identifierString, StringTable::DEFAULT_LANGUAGE, defaultString);
 
-		mStringData = table->getStringData(identifierString);
+		mStringData = mTable->getStringData(mIdentifier);
+		mTableVersion = mTable->getVersion();
 
 		if (mStringData->numParameters > 0)
 			mParameters = bs_newN<String>(mStringData->numParameters);
@@ -38,7 +49,10 @@ namespace bs
 
 	HString::HString(const HString& copy)
 	{
+		mTable = copy.mTable;
+		mIdentifier = copy.mIdentifier;
 		mStringData = copy.mStringData;
+		mTableVersion = copy.mTableVersion;
 		mIsDirty = copy.mIsDirty;
 		mCachedString = copy.mCachedString;
 
@@ -79,7 +93,10 @@ namespace bs
 			mParameters = nullptr;
 		}
 
+		mTable = rhs.mTable;
+		mIdentifier = rhs.mIdentifier;
 		mStringData = rhs.mStringData;
+		mTableVersion = rhs.mTableVersion;
 		mIsDirty = rhs.mIsDirty;
 		mCachedString = rhs.mCachedString;
 
@@ -105,6 +122,8 @@ namespace bs
 
 	const String& HString::getValue() const
 	{
+		refreshStringData();
+
 		if (mIsDirty)
 		{
 			if (mParameters != nullptr)
@@ -125,6 +144,8 @@ namespace bs
 
 	void HString::setParameter(UINT32 idx, const String& value)
 	{
+		refreshStringData();
+
 		if (idx >= mStringData->numParameters)
 			return;
 
@@ -132,10 +153,45 @@ namespace bs
 		mIsDirty = true;
 	}
 
+	void HString::refreshStringData() const
+	{
+		// Cheap early-out that's hit on every access but the first one after a table change. Avoids hashing the
+		// identifier on every access, which adds up during GUI-heavy frames that resolve many strings.
+		if (mTable == nullptr || mTable->getVersion() == mTableVersion)
+			return;
+
+		mTableVersion = mTable->getVersion();
+
+		SPtr<LocalizedStringData> newData = mTable->getStringData(mIdentifier);
+		if (newData == mStringData)
+			return;
+
+		// Preserve any assigned parameter values across the switch
+		UINT32 oldNumParameters = mStringData != nullptr ? mStringData->numParameters : 0;
+		String* oldParameters = mParameters;
+
+		mStringData = newData;
+		mParameters = nullptr;
+
+		if (mStringData->numParameters > 0)
+		{
+			mParameters = bs_newN<String>(mStringData->numParameters);
+
+			UINT32 numToCopy = std::min(oldNumParameters, mStringData->numParameters);
+			for (UINT32 i = 0; i < numToCopy; i++)
+				mParameters[i] = oldParameters[i];
+		}
+
+		if (oldParameters != nullptr)
+			bs_deleteN(oldParameters, oldNumParameters);
+
+		mIsDirty = true;
+	}
+
 	const HString& HString::dummy()
 	{
 		static HString dummyVal;
 
 		return dummyVal;
 	}
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
 
 namespace bs
 {
+	class StringTable;
+
 	/** @addtogroup Localization
 	 *  @{
 	 */
@@ -11,10 +13,15 @@ namespace bs
 	/**
 	 * String handle. Provides a wrapper around an Unicode string, primarily for localization purposes.
 	 * 			
-	 * Actual value for this string is looked up in a global string table based on the provided identifier string and 
+	 * Actual value for this string is looked up in a global string table based on the provided identifier string and
 	 * currently active language. If such value doesn't exist then the identifier is used as is.
-	 *			
+	 *
 	 * Use {0}, {1}, etc. in the string value for values that might change dynamically.
+	 *
+	 * @note
+	 * The string is resolved against the string table once, and the resolved data is cached. The cache is refreshed
+	 * lazily when the table reports a newer version (translations added/removed or active language changed), so accessing the
+	 * value in a tight loop doesn't involve any hash-map lookups.
 	 */
 	class BS_CORE_EXPORT HString
 	{
@@ -64,8 +71,18 @@ namespace bs
 		/** Returns an empty string. */
 		static const HString& dummy();
 	private:
-		SPtr<LocalizedStringData> mStringData;
-		String* mParameters;
+		/**
+		 * Re-resolves the cached string data if the string table changed since the data was last resolved. Existing
+		 * parameter values are preserved.
+		 */
+		void refreshStringData() const;
+
+		SPtr<StringTable> mTable;
+		String mIdentifier;
+
+		mutable SPtr<LocalizedStringData> mStringData;
+		mutable String* mParameters;
+		mutable UINT32 mTableVersion;
 
 		mutable bool mIsDirty;
 		mutable String mCachedString;
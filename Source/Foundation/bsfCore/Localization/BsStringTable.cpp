@@ -185,6 +185,7 @@ namespace bs
 
 		mActiveLanguageData = &(mAllLanguages[(UINT32)language]);
 		mActiveLanguage = language;
+		mVersion++;
 	}
 
 	bool StringTable::contains(const String& identifier)
@@ -220,6 +221,7 @@ namespace bs
 
 		mIdentifiers.insert(identifier);
 		stringData->updateString(value);
+		mVersion++;
 	}
 
 	String StringTable::getString(const String& identifier, Language language)
@@ -241,6 +243,7 @@ namespace bs
 		}
 
 		mIdentifiers.erase(identifier);
+		mVersion++;
 	}
 
 	SPtr<LocalizedStringData> StringTable::getStringData(const String& identifier, bool insertIfNonExisting)
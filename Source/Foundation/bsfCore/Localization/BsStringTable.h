@@ -341,7 +341,15 @@ namespace bs
 		/** Changes the currently active language. Any newly created strings will use this value. */
 		void setActiveLanguage(Language language);
 
+		/**
+		 * Returns a number that increments whenever the table contents or the active language change. Localized strings
+		 * compare this against a cached value to determine if their resolved string data is stale, avoiding a hash-map
+		 * lookup on every access.
+		 */
+		UINT32 getVersion() const { return mVersion; }
+
 		Language mActiveLanguage;
+		UINT32 mVersion = 0;
 		LanguageData* mActiveLanguageData;
 		LanguageData* mDefaultLanguageData;
 
@@ -2,6 +2,9 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Managers/BsGpuProgramManager.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Reflection/BsRTTIType.h"
 
 namespace bs
 {
@@ -148,5 +151,47 @@ namespace bs
 		GpuProgramFactory* factory = getFactory(desc.language);
 		return factory->compileBytecode(desc);
 	}
+
+	SPtr<GpuProgramBytecode> GpuProgramManager::getBytecode(const GPU_PROGRAM_DESC& desc, const String& compilerId,
+		UINT32 compilerVersion)
+	{
+		Path cachePath = getBytecodeCachePath(desc);
+		if (FileSystem::exists(cachePath))
+		{
+			FileDecoder decoder(cachePath);
+			SPtr<IReflectable> obj = decoder.decode();
+
+			if (obj != nullptr && rtti_is_of_type<GpuProgramBytecode>(obj))
+			{
+				SPtr<GpuProgramBytecode> bytecode = std::static_pointer_cast<GpuProgramBytecode>(obj);
+
+				// Entries from an outdated compiler are treated as misses and overwritten below
+				if (bytecode->compilerId == compilerId && bytecode->compilerVersion == compilerVersion)
+					return bytecode;
+			}
+		}
+
+		SPtr<GpuProgramBytecode> bytecode = compileBytecode(desc);
+
+		// Only successful compiles are cached, so compile errors keep getting reported on every run
+		if (bytecode != nullptr && bytecode->instructions.data != nullptr)
+		{
+			FileEncoder encoder(cachePath);
+			encoder.encode(bytecode.get());
+		}
+
+		return bytecode;
+	}
+
+	Path GpuProgramManager::getBytecodeCachePath(const GPU_PROGRAM_DESC& desc) const
+	{
+		String uniqueKey = desc.language + "@" + toString((UINT32)desc.type) + "@" +
+			toString(desc.requiresAdjacency ? 1 : 0) + "@" + desc.entryPoint + "@" + desc.source;
+
+		Path path = FileSystem::getTempDirectoryPath();
+		path.setFilename("bsfBytecode_" + md5(uniqueKey) + ".asset");
+
+		return path;
+	}
 	}
 }
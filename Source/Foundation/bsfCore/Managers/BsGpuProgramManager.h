@@ -84,9 +84,23 @@ namespace bs
 		/** @copydoc GpuProgram::compileBytecode */
 		SPtr<GpuProgramBytecode> compileBytecode(const GPU_PROGRAM_DESC& desc);
 
+		/**
+		 * Returns compiled bytecode for the GPU program described by @p desc, preferring a previously cached copy over
+		 * compiling from scratch. Bytecode is stored in an on-disk cache keyed on a hash of the program source and
+		 * compilation options, together with the program language, allowing later runs of the application to skip
+		 * compilation entirely. If no cached copy exists, or the cached copy was produced by a different compiler than
+		 * the one described by @p compilerId and @p compilerVersion, the program is compiled and the result is added
+		 * to the cache.
+		 */
+		SPtr<GpuProgramBytecode> getBytecode(const GPU_PROGRAM_DESC& desc, const String& compilerId,
+			UINT32 compilerVersion = 0);
+
 	protected:
 		friend class bs::GpuProgram;
 
+		/** Returns the path to the on-disk bytecode cache entry for the GPU program described by @p desc. */
+		Path getBytecodeCachePath(const GPU_PROGRAM_DESC& desc) const;
+
 		/**
 		 * Creates a GPU program without initializing it.
 		 *
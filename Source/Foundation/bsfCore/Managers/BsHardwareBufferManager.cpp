@@ -18,14 +18,59 @@ namespace bs
 	{
 	}
 
+	VertexDeclarationKey::VertexDeclarationKey(const Vector<VertexElement>& elements)
+		:elements(elements)
+	{ }
+
+	size_t VertexDeclarationKey::HashFunction::operator()(const VertexDeclarationKey& v) const
+	{
+		size_t hash = 0;
+		for(auto& entry : v.elements)
+			hash_combine(hash, VertexElement::getHash(entry));
+
+		return hash;
+	}
+
+	bool VertexDeclarationKey::EqualFunction::operator()(const VertexDeclarationKey& lhs,
+		const VertexDeclarationKey& rhs) const
+	{
+		if (lhs.elements.size() != rhs.elements.size())
+			return false;
+
+		size_t numElements = lhs.elements.size();
+		auto iterLeft = lhs.elements.begin();
+		auto iterRight = rhs.elements.begin();
+		for(size_t i = 0; i < numElements; i++)
+		{
+			if (*iterLeft != *iterRight)
+				return false;
+
+			++iterLeft;
+			++iterRight;
+		}
+
+		return true;
+	}
+
 	SPtr<VertexDeclaration> HardwareBufferManager::createVertexDeclaration(const SPtr<VertexDataDesc>& desc)
 	{
-		VertexDeclaration* decl = new (bs_alloc<VertexDeclaration>()) VertexDeclaration(desc->createElements());
+		Vector<VertexElement> elements = desc->createElements();
+
+		// Declarations are hash-consed so every layout maps to a single canonical instance, allowing render backends to
+		// cache resolved pipeline bindings per declaration ID
+		VertexDeclarationKey key(elements);
+
+		auto iterFind = mCachedDeclarations.find(key);
+		if (iterFind != mCachedDeclarations.end())
+			return iterFind->second;
+
+		VertexDeclaration* decl = new (bs_alloc<VertexDeclaration>()) VertexDeclaration(elements);
 
 		SPtr<VertexDeclaration> declPtr = bs_core_ptr<VertexDeclaration>(decl);
 		declPtr->_setThisPtr(declPtr);
 		declPtr->initialize();
 
+		mCachedDeclarations[key] = declPtr;
 		return declPtr;
 	}
 
@@ -76,42 +121,7 @@ namespace bs
 	namespace ct
 	{
 
-	HardwareBufferManager::VertexDeclarationKey::VertexDeclarationKey(const Vector<VertexElement>& elements)
-		:elements(elements)
-	{ }
-
-
-	size_t HardwareBufferManager::VertexDeclarationKey::HashFunction::operator()(const VertexDeclarationKey& v) const
-	{
-		size_t hash = 0;
-		for(auto& entry : v.elements)
-			hash_combine(hash, VertexElement::getHash(entry));
-
-		return hash;
-	}
-
-	bool HardwareBufferManager::VertexDeclarationKey::EqualFunction::operator()(const VertexDeclarationKey& lhs, 
-		const VertexDeclarationKey& rhs) const
-	{
-		if (lhs.elements.size() != rhs.elements.size())
-			return false;
-
-		size_t numElements = lhs.elements.size();
-		auto iterLeft = lhs.elements.begin();
-		auto iterRight = rhs.elements.begin();
-		for(size_t i = 0; i < numElements; i++)
-		{
-			if (*iterLeft != *iterRight)
-				return false;
-
-			++iterLeft;
-			++iterRight;
-		}
-
-		return true;
-	}
-
-	SPtr<IndexBuffer> HardwareBufferManager::createIndexBuffer(const INDEX_BUFFER_DESC& desc, 
+	SPtr<IndexBuffer> HardwareBufferManager::createIndexBuffer(const INDEX_BUFFER_DESC& desc,
 		GpuDeviceFlags deviceMask)
 	{
 		SPtr<IndexBuffer> ibuf = createIndexBufferInternal(desc, deviceMask);
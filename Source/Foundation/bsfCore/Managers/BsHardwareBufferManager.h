@@ -17,6 +17,26 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Key that uniquely identifies a vertex declaration layout, used for caching canonical declaration instances. */
+	struct VertexDeclarationKey
+	{
+		VertexDeclarationKey(const Vector<VertexElement>& elements);
+
+		class HashFunction
+		{
+		public:
+			size_t operator()(const VertexDeclarationKey& key) const;
+		};
+
+		class EqualFunction
+		{
+		public:
+			bool operator()(const VertexDeclarationKey& lhs, const VertexDeclarationKey& rhs) const;
+		};
+
+		Vector<VertexElement> elements;
+	};
+
 	/**
 	 * Handles creation of various hardware buffers.
 	 *
@@ -62,15 +82,23 @@ namespace bs
 		 */
 		SPtr<GpuBuffer> createGpuBuffer(const GPU_BUFFER_DESC& desc);
 
-		/** 
-		 * Creates a new vertex declaration from a list of vertex elements. 
-		 * 
+		/**
+		 * Creates a new vertex declaration from a list of vertex elements. Declarations are cached, and if a declaration
+		 * with an identical layout was created before the same canonical instance is returned, so identical layouts share
+		 * a single declaration (and a single core thread declaration ID).
+		 *
 		 * @param[in]	desc	Description of the object to create.
 		 */
 		SPtr<VertexDeclaration> createVertexDeclaration(const SPtr<VertexDataDesc>& desc);
 
 		/** @copydoc GpuParams::create(const SPtr<GpuPipelineParamInfo>&) */
 		SPtr<GpuParams> createGpuParams(const SPtr<GpuPipelineParamInfo>& paramInfo);
+
+	protected:
+		typedef UnorderedMap<VertexDeclarationKey, SPtr<VertexDeclaration>,
+			VertexDeclarationKey::HashFunction, VertexDeclarationKey::EqualFunction> DeclarationMap;
+
+		DeclarationMap mCachedDeclarations;
 	};
 
 	namespace ct
@@ -140,26 +168,6 @@ namespace bs
 		friend class bs::GpuBuffer;
 		friend class GpuBuffer;
 
-		/** Key for use in the vertex declaration map. */
-		struct VertexDeclarationKey
-		{
-			VertexDeclarationKey(const Vector<VertexElement>& elements);
-
-			class HashFunction
-			{
-			public:
-				size_t operator()(const VertexDeclarationKey& key) const;
-			};
-
-			class EqualFunction
-			{
-			public:
-				bool operator()(const VertexDeclarationKey& lhs, const VertexDeclarationKey& rhs) const;
-			};
-
-			Vector<VertexElement> elements;
-		};
-
 		/** @copydoc createVertexBuffer */
 		virtual SPtr<VertexBuffer> createVertexBufferInternal(const VERTEX_BUFFER_DESC& desc, 
 			GpuDeviceFlags deviceMask = GDF_DEFAULT) = 0;
@@ -14,25 +14,39 @@ namespace bs { namespace ct
 	}
 
 	QueryManager::~QueryManager()
+	{
+		processRemainingQueries();
+	}
+
+	void QueryManager::processRemainingQueries()
 	{
 		// Trigger all remaining queries, whether they completed or not
 
 		for (auto& query : mEventQueries)
 		{
 			if (query->isActive())
+			{
 				query->onTriggered();
+				query->setActive(false);
+			}
 		}
 
 		for (auto& query : mTimerQueries)
 		{
 			if (query->isActive())
+			{
 				query->onTriggered(query->getTimeMs());
+				query->setActive(false);
+			}
 		}
 
 		for (auto& query : mOcclusionQueries)
 		{
 			if (query->isActive())
+			{
 				query->onComplete(query->getNumSamples());
+				query->setActive(false);
+			}
 		}
 
 		processDeletedQueue();
@@ -49,8 +49,15 @@ namespace bs { namespace ct
 		 */
 		virtual SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const = 0;
 
-		/** Triggers completed queries. Should be called every frame. */
-		void _update();
+		/**
+		 * Triggers completed queries. Should be called every frame.
+		 *
+		 * @note
+		 * Query results are resolved asynchronously and generally become available one or two frames after the query was
+		 * issued. Implementations must never block waiting on the GPU - a query that hasn't completed yet is simply
+		 * checked again the next frame.
+		 */
+		virtual void _update();
 
 	protected:
 		friend class EventQuery;
@@ -78,6 +85,20 @@ namespace bs { namespace ct
 		/** Deletes any queued queries. */
 		void processDeletedQueue();
 
+		/** Checks is a query still waiting to be completed. Usable by derived managers, which queries don't befriend. */
+		template<class T>
+		static bool isQueryActive(const T* query) { return query->isActive(); }
+
+		/** Changes the active state of a query. Usable by derived managers, which queries don't befriend. */
+		template<class T>
+		static void setQueryActive(T* query, bool active) { query->setActive(active); }
+
+		/**
+		 * Triggers all still active queries, whether they completed or not, then deletes any queued queries. Called on
+		 * shut-down so no query callbacks are left hanging. Safe to call multiple times.
+		 */
+		void processRemainingQueries();
+
 	protected:
 		mutable Vector<EventQuery*> mEventQueries;
 		mutable Vector<TimerQuery*> mTimerQueries;
@@ -10,32 +10,56 @@ namespace bs
 {
 	SPtr<SamplerState> RenderStateManager::createSamplerState(const SAMPLER_STATE_DESC& desc) const
 	{
-		SPtr<SamplerState> state = _createSamplerStatePtr(desc);
-		state->initialize();
+		SPtr<SamplerState> state = findCachedState(desc);
+		if (state == nullptr)
+		{
+			state = _createSamplerStatePtr(desc);
+			state->initialize();
+
+			notifySamplerStateCreated(desc, state);
+		}
 
 		return state;
 	}
 
 	SPtr<DepthStencilState> RenderStateManager::createDepthStencilState(const DEPTH_STENCIL_STATE_DESC& desc) const
 	{
-		SPtr<DepthStencilState> state = _createDepthStencilStatePtr(desc);
-		state->initialize();
+		SPtr<DepthStencilState> state = findCachedState(desc);
+		if (state == nullptr)
+		{
+			state = _createDepthStencilStatePtr(desc);
+			state->initialize();
+
+			notifyDepthStencilStateCreated(desc, state);
+		}
 
 		return state;
 	}
 
 	SPtr<RasterizerState> RenderStateManager::createRasterizerState(const RASTERIZER_STATE_DESC& desc) const
 	{
-		SPtr<RasterizerState> state = _createRasterizerStatePtr(desc);
-		state->initialize();
+		SPtr<RasterizerState> state = findCachedState(desc);
+		if (state == nullptr)
+		{
+			state = _createRasterizerStatePtr(desc);
+			state->initialize();
+
+			notifyRasterizerStateCreated(desc, state);
+		}
 
 		return state;
 	}
 
 	SPtr<BlendState> RenderStateManager::createBlendState(const BLEND_STATE_DESC& desc) const
 	{
-		SPtr<BlendState> state = _createBlendStatePtr(desc);
-		state->initialize();
+		SPtr<BlendState> state = findCachedState(desc);
+		if (state == nullptr)
+		{
+			state = _createBlendStatePtr(desc);
+			state->initialize();
+
+			notifyBlendStateCreated(desc, state);
+		}
 
 		return state;
 	}
@@ -138,6 +162,95 @@ namespace bs
 		return mDefaultDepthStencilState; 
 	}
 
+	void RenderStateManager::onShutDown()
+	{
+		mDefaultBlendState = nullptr;
+		mDefaultDepthStencilState = nullptr;
+		mDefaultRasterizerState = nullptr;
+		mDefaultSamplerState = nullptr;
+	}
+
+	void RenderStateManager::notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, const SPtr<SamplerState>& state) const
+	{
+		Lock lock(mMutex);
+
+		mCachedSamplerStates[desc] = state;
+	}
+
+	void RenderStateManager::notifyBlendStateCreated(const BLEND_STATE_DESC& desc, const SPtr<BlendState>& state) const
+	{
+		Lock lock(mMutex);
+
+		mCachedBlendStates[desc] = state;
+	}
+
+	void RenderStateManager::notifyRasterizerStateCreated(const RASTERIZER_STATE_DESC& desc, const SPtr<RasterizerState>& state) const
+	{
+		Lock lock(mMutex);
+
+		mCachedRasterizerStates[desc] = state;
+	}
+
+	void RenderStateManager::notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, const SPtr<DepthStencilState>& state) const
+	{
+		Lock lock(mMutex);
+
+		mCachedDepthStencilStates[desc] = state;
+	}
+
+	void RenderStateManager::notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mCachedSamplerStates.find(desc);
+		if (iterFind != mCachedSamplerStates.end() && iterFind->second.expired())
+			mCachedSamplerStates.erase(iterFind);
+	}
+
+	SPtr<SamplerState> RenderStateManager::findCachedState(const SAMPLER_STATE_DESC& desc) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mCachedSamplerStates.find(desc);
+		if (iterFind != mCachedSamplerStates.end())
+			return iterFind->second.lock();
+
+		return nullptr;
+	}
+
+	SPtr<BlendState> RenderStateManager::findCachedState(const BLEND_STATE_DESC& desc) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mCachedBlendStates.find(desc);
+		if (iterFind != mCachedBlendStates.end())
+			return iterFind->second.lock();
+
+		return nullptr;
+	}
+
+	SPtr<RasterizerState> RenderStateManager::findCachedState(const RASTERIZER_STATE_DESC& desc) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mCachedRasterizerStates.find(desc);
+		if (iterFind != mCachedRasterizerStates.end())
+			return iterFind->second.lock();
+
+		return nullptr;
+	}
+
+	SPtr<DepthStencilState> RenderStateManager::findCachedState(const DEPTH_STENCIL_STATE_DESC& desc) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mCachedDepthStencilStates.find(desc);
+		if (iterFind != mCachedDepthStencilStates.end())
+			return iterFind->second.lock();
+
+		return nullptr;
+	}
+
 	namespace ct
 	{
 	RenderStateManager::RenderStateManager()
@@ -215,11 +328,19 @@ namespace bs
 		return state;
 	}
 
-	SPtr<GraphicsPipelineState> RenderStateManager::createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc, 
+	SPtr<GraphicsPipelineState> RenderStateManager::createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc,
 		GpuDeviceFlags deviceMask) const
 	{
-		SPtr<GraphicsPipelineState> state = _createGraphicsPipelineState(desc, deviceMask);
-		state->initialize();
+		GraphicsPipelineKey key = buildGraphicsPipelineKey(desc, deviceMask);
+
+		SPtr<GraphicsPipelineState> state = findCachedState(key);
+		if (state == nullptr)
+		{
+			state = createGraphicsPipelineStateInternal(desc, deviceMask);
+			state->initialize();
+
+			notifyGraphicsPipelineStateCreated(key, state);
+		}
 
 		return state;
 	}
@@ -310,13 +431,17 @@ namespace bs
 	SPtr<GraphicsPipelineState> RenderStateManager::_createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc,
 		GpuDeviceFlags deviceMask) const
 	{
-		SPtr<GraphicsPipelineState> pipelineState =
-			bs_shared_ptr<GraphicsPipelineState>(new (bs_alloc<GraphicsPipelineState>()) 
-			GraphicsPipelineState(desc, deviceMask));
+		GraphicsPipelineKey key = buildGraphicsPipelineKey(desc, deviceMask);
 
-		pipelineState->_setThisPtr(pipelineState);
+		SPtr<GraphicsPipelineState> state = findCachedState(key);
+		if (state == nullptr)
+		{
+			state = createGraphicsPipelineStateInternal(desc, deviceMask);
 
-		return pipelineState;
+			notifyGraphicsPipelineStateCreated(key, state);
+		}
+
+		return state;
 	}
 
 	SPtr<ComputePipelineState> RenderStateManager::_createComputePipelineState(const SPtr<GpuProgram>& program,
@@ -524,5 +649,63 @@ namespace bs
 
 		return state;
 	}
+
+	SPtr<GraphicsPipelineState> RenderStateManager::createGraphicsPipelineStateInternal(const PIPELINE_STATE_DESC& desc,
+		GpuDeviceFlags deviceMask) const
+	{
+		SPtr<GraphicsPipelineState> pipelineState =
+			bs_shared_ptr<GraphicsPipelineState>(new (bs_alloc<GraphicsPipelineState>())
+			GraphicsPipelineState(desc, deviceMask));
+
+		pipelineState->_setThisPtr(pipelineState);
+
+		return pipelineState;
+	}
+
+	void RenderStateManager::notifyGraphicsPipelineStateCreated(const GraphicsPipelineKey& key,
+		const SPtr<GraphicsPipelineState>& state) const
+	{
+		Lock lock(mMutex);
+
+		mCachedGraphicsPipelineStates[key] = state;
+	}
+
+	void RenderStateManager::notifyGraphicsPipelineStateDestroyed(const GraphicsPipelineKey& key) const
+	{
+		Lock lock(mMutex);
+
+		// Only remove the entry if it wasn't re-populated by an identical pipeline in the meantime
+		auto iterFind = mCachedGraphicsPipelineStates.find(key);
+		if (iterFind != mCachedGraphicsPipelineStates.end() && iterFind->second.expired())
+			mCachedGraphicsPipelineStates.erase(iterFind);
+	}
+
+	SPtr<GraphicsPipelineState> RenderStateManager::findCachedState(const GraphicsPipelineKey& key) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mCachedGraphicsPipelineStates.find(key);
+		if (iterFind != mCachedGraphicsPipelineStates.end())
+			return iterFind->second.lock();
+
+		return nullptr;
+	}
+
+	RenderStateManager::GraphicsPipelineKey RenderStateManager::buildGraphicsPipelineKey(
+		const PIPELINE_STATE_DESC& desc, GpuDeviceFlags deviceMask)
+	{
+		GraphicsPipelineKey key;
+		key.blendState = desc.blendState.get();
+		key.rasterizerState = desc.rasterizerState.get();
+		key.depthStencilState = desc.depthStencilState.get();
+		key.vertexProgram = desc.vertexProgram.get();
+		key.fragmentProgram = desc.fragmentProgram.get();
+		key.geometryProgram = desc.geometryProgram.get();
+		key.hullProgram = desc.hullProgram.get();
+		key.domainProgram = desc.domainProgram.get();
+		key.deviceMask = (UINT32)deviceMask;
+
+		return key;
+	}
 	}
 }
\ No newline at end of file
@@ -81,16 +81,68 @@ namespace bs
 		/**	Gets a depth stencil state initialized with default options. */
 		const SPtr<DepthStencilState>& getDefaultDepthStencilState() const;
 
+	protected:
+		/** @copydoc Module::onShutDown */
+		void onShutDown() override;
+
 	private:
 		friend class SamplerState;
 		friend class BlendState;
 		friend class RasterizerState;
 		friend class DepthStencilState;
 
+		/**	Triggered when a new sampler state is created. */
+		void notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, const SPtr<SamplerState>& state) const;
+
+		/**	Triggered when a new blend state is created. */
+		void notifyBlendStateCreated(const BLEND_STATE_DESC& desc, const SPtr<BlendState>& state) const;
+
+		/**	Triggered when a new rasterizer state is created. */
+		void notifyRasterizerStateCreated(const RASTERIZER_STATE_DESC& desc, const SPtr<RasterizerState>& state) const;
+
+		/**	Triggered when a new depth-stencil state is created. */
+		void notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, const SPtr<DepthStencilState>& state) const;
+
+		/**
+		 * Triggered when the last reference to a specific sampler state is destroyed, which means we must clear our cached
+		 * version as well.
+		 */
+		void notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc) const;
+
+		/**
+		 * Attempts to find a cached sampler state corresponding to the provided descriptor. Returns null if one doesn't
+		 * exist.
+		 */
+		SPtr<SamplerState> findCachedState(const SAMPLER_STATE_DESC& desc) const;
+
+		/**
+		 * Attempts to find a cached blend state corresponding to the provided descriptor. Returns null if one doesn't exist.
+		 */
+		SPtr<BlendState> findCachedState(const BLEND_STATE_DESC& desc) const;
+
+		/**
+		 * Attempts to find a cached rasterizer state corresponding to the provided descriptor. Returns null if one doesn't
+		 * exist.
+		 */
+		SPtr<RasterizerState> findCachedState(const RASTERIZER_STATE_DESC& desc) const;
+
+		/**
+		 * Attempts to find a cached depth-stencil state corresponding to the provided descriptor. Returns null if one
+		 * doesn't exist.
+		 */
+		SPtr<DepthStencilState> findCachedState(const DEPTH_STENCIL_STATE_DESC& desc) const;
+
 		mutable SPtr<SamplerState> mDefaultSamplerState;
 		mutable SPtr<BlendState> mDefaultBlendState;
 		mutable SPtr<RasterizerState> mDefaultRasterizerState;
 		mutable SPtr<DepthStencilState> mDefaultDepthStencilState;
+
+		mutable UnorderedMap<SAMPLER_STATE_DESC, std::weak_ptr<SamplerState>> mCachedSamplerStates;
+		mutable UnorderedMap<BLEND_STATE_DESC, std::weak_ptr<BlendState>> mCachedBlendStates;
+		mutable UnorderedMap<RASTERIZER_STATE_DESC, std::weak_ptr<RasterizerState>> mCachedRasterizerStates;
+		mutable UnorderedMap<DEPTH_STENCIL_STATE_DESC, std::weak_ptr<DepthStencilState>> mCachedDepthStencilStates;
+
+		mutable Mutex mMutex;
 	};
 
 	namespace ct
@@ -144,6 +196,52 @@ namespace bs
 			UINT32 id;
 		};
 
+		/**
+		 * Identifies a unique graphics pipeline configuration by the objects it is composed of. Since all the referenced
+		 * objects are themselves hash-consed, comparing their addresses is sufficient.
+		 */
+		struct GraphicsPipelineKey
+		{
+			BlendState* blendState;
+			RasterizerState* rasterizerState;
+			DepthStencilState* depthStencilState;
+			GpuProgram* vertexProgram;
+			GpuProgram* fragmentProgram;
+			GpuProgram* geometryProgram;
+			GpuProgram* hullProgram;
+			GpuProgram* domainProgram;
+			UINT32 deviceMask;
+
+			bool operator==(const GraphicsPipelineKey& rhs) const
+			{
+				return blendState == rhs.blendState && rasterizerState == rhs.rasterizerState &&
+					depthStencilState == rhs.depthStencilState && vertexProgram == rhs.vertexProgram &&
+					fragmentProgram == rhs.fragmentProgram && geometryProgram == rhs.geometryProgram &&
+					hullProgram == rhs.hullProgram && domainProgram == rhs.domainProgram &&
+					deviceMask == rhs.deviceMask;
+			}
+		};
+
+		/**	Generates a hash for GraphicsPipelineKey. */
+		struct GraphicsPipelineKeyHash
+		{
+			size_t operator()(const GraphicsPipelineKey& key) const
+			{
+				size_t hash = 0;
+				bs::hash_combine(hash, key.blendState);
+				bs::hash_combine(hash, key.rasterizerState);
+				bs::hash_combine(hash, key.depthStencilState);
+				bs::hash_combine(hash, key.vertexProgram);
+				bs::hash_combine(hash, key.fragmentProgram);
+				bs::hash_combine(hash, key.geometryProgram);
+				bs::hash_combine(hash, key.hullProgram);
+				bs::hash_combine(hash, key.domainProgram);
+				bs::hash_combine(hash, key.deviceMask);
+
+				return hash;
+			}
+		};
+
 	public:
 		RenderStateManager();
 
@@ -195,7 +293,7 @@ namespace bs
 		SPtr<BlendState> _createBlendState(const BLEND_STATE_DESC& desc) const;
 
 		/**	Creates an uninitialized GraphicsPipelineState. Requires manual initialization after creation. */
-		virtual SPtr<GraphicsPipelineState> _createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc, 
+		SPtr<GraphicsPipelineState> _createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc,
 			GpuDeviceFlags deviceMask = GDF_DEFAULT) const;
 
 		/**	Creates an uninitialized ComputePipelineState. Requires manual initialization after creation. */
@@ -227,6 +325,7 @@ namespace bs
 		friend class BlendState;
 		friend class RasterizerState;
 		friend class DepthStencilState;
+		friend class GraphicsPipelineState;
 
 		/** @copydoc Module::onShutDown */
 		void onShutDown() override;
@@ -243,6 +342,10 @@ namespace bs
 		/** @copydoc createDepthStencilState */
 		virtual SPtr<DepthStencilState> createDepthStencilStateInternal(const DEPTH_STENCIL_STATE_DESC& desc, UINT32 id) const;
 
+		/** @copydoc createGraphicsPipelineState */
+		virtual SPtr<GraphicsPipelineState> createGraphicsPipelineStateInternal(const PIPELINE_STATE_DESC& desc,
+			GpuDeviceFlags deviceMask) const;
+
 	private:
 		/**	Triggered when a new sampler state is created. */
 		void notifySamplerStateCreated(const SAMPLER_STATE_DESC& desc, const SPtr<SamplerState>& state) const;
@@ -256,12 +359,22 @@ namespace bs
 		/**	Triggered when a new sampler state is created. */
 		void notifyDepthStencilStateCreated(const DEPTH_STENCIL_STATE_DESC& desc, const CachedDepthStencilState& state) const;
 
+		/**	Triggered when a new graphics pipeline state is created. */
+		void notifyGraphicsPipelineStateCreated(const GraphicsPipelineKey& key,
+			const SPtr<GraphicsPipelineState>& state) const;
+
 		/**
 		 * Triggered when the last reference to a specific sampler state is destroyed, which means we must clear our cached
 		 * version as well.
 		 */
 		void notifySamplerStateDestroyed(const SAMPLER_STATE_DESC& desc) const;
 
+		/**
+		 * Triggered when the last reference to a specific graphics pipeline state is destroyed, which means we must clear
+		 * our cached version as well.
+		 */
+		void notifyGraphicsPipelineStateDestroyed(const GraphicsPipelineKey& key) const;
+
 		/**
 		 * Attempts to find a cached sampler state corresponding to the provided descriptor. Returns null if one doesn't 
 		 * exist.
@@ -285,6 +398,15 @@ namespace bs
 		 */
 		SPtr<DepthStencilState> findCachedState(const DEPTH_STENCIL_STATE_DESC& desc, UINT32& id) const;
 
+		/**
+		 * Attempts to find a cached graphics pipeline state corresponding to the provided key. Returns null if one
+		 * doesn't exist.
+		 */
+		SPtr<GraphicsPipelineState> findCachedState(const GraphicsPipelineKey& key) const;
+
+		/** Builds a lookup key identifying the unique configuration described by the provided pipeline descriptor. */
+		static GraphicsPipelineKey buildGraphicsPipelineKey(const PIPELINE_STATE_DESC& desc, GpuDeviceFlags deviceMask);
+
 		mutable SPtr<SamplerState> mDefaultSamplerState;
 		mutable SPtr<BlendState> mDefaultBlendState;
 		mutable SPtr<RasterizerState> mDefaultRasterizerState;
@@ -294,6 +416,8 @@ namespace bs
 		mutable UnorderedMap<BLEND_STATE_DESC, CachedBlendState> mCachedBlendStates;
 		mutable UnorderedMap<RASTERIZER_STATE_DESC, CachedRasterizerState> mCachedRasterizerStates;
 		mutable UnorderedMap<DEPTH_STENCIL_STATE_DESC, CachedDepthStencilState> mCachedDepthStencilStates;
+		mutable UnorderedMap<GraphicsPipelineKey, std::weak_ptr<GraphicsPipelineState>, GraphicsPipelineKeyHash>
+			mCachedGraphicsPipelineStates;
 
 		mutable UINT32 mNextBlendStateId;
 		mutable UINT32 mNextRasterizerStateId;
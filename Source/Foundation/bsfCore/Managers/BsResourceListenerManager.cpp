@@ -42,6 +42,19 @@ namespace bs
 		mDirtyListeners.erase(listener);
 
 		clearDependencies(listener);
+
+		{
+			// Remove any queued notifications so a destroyed listener is never notified
+			RecursiveLock lock(mMutex);
+
+			auto eraseStart = std::remove_if(mPendingNotifications.begin(), mPendingNotifications.end(),
+				[listener](const PendingNotification& entry)
+			{
+				return entry.listener == listener;
+			});
+
+			mPendingNotifications.erase(eraseStart, mPendingNotifications.end());
+		}
 	}
 
 	void ResourceListenerManager::markListenerDirty(IResourceListener* listener)
@@ -63,13 +76,15 @@ namespace bs
 			RecursiveLock lock(mMutex);
 
 			for (auto& entry : mLoadedResources)
-				sendResourceLoaded(entry.second);
+				dispatchResourceEvent(entry.second, true);
 
 			for (auto& entry : mModifiedResources)
-				sendResourceModified(entry.second);
+				dispatchResourceEvent(entry.second, false);
 
 			mLoadedResources.clear();
 			mModifiedResources.clear();
+
+			processPendingNotifications();
 		}
 	}
 
@@ -80,7 +95,7 @@ namespace bs
 		auto iterFindLoaded = mLoadedResources.find(resourceUUID);
 		if (iterFindLoaded != mLoadedResources.end())
 		{
-			sendResourceLoaded(iterFindLoaded->second);
+			dispatchResourceEvent(iterFindLoaded->second, true);
 
 			mLoadedResources.erase(iterFindLoaded);
 		}
@@ -88,7 +103,7 @@ namespace bs
 		auto iterFindModified = mModifiedResources.find(resourceUUID);
 		if (iterFindModified != mModifiedResources.end())
 		{
-			sendResourceModified(iterFindModified->second);
+			dispatchResourceEvent(iterFindModified->second, false);
 
 			mModifiedResources.erase(iterFindModified);
 		}
@@ -146,6 +161,85 @@ namespace bs
 		}
 	}
 
+	void ResourceListenerManager::dispatchResourceEvent(const HResource& resource, bool loaded)
+	{
+		if (mNotificationBudget == 0)
+		{
+			if (loaded)
+				sendResourceLoaded(resource);
+			else
+				sendResourceModified(resource);
+
+			return;
+		}
+
+		queueNotifications(resource, loaded);
+	}
+
+	void ResourceListenerManager::queueNotifications(const HResource& resource, bool loaded)
+	{
+		UINT64 handleId = (UINT64)resource.getHandleData().get();
+
+		auto iterFind = mResourceToListenerMap.find(handleId);
+		if (iterFind == mResourceToListenerMap.end())
+			return;
+
+		for (auto& listener : iterFind->second)
+		{
+			auto iterFindPending = std::find_if(mPendingNotifications.begin(), mPendingNotifications.end(),
+				[&](const PendingNotification& entry)
+			{
+				return entry.listener == listener && entry.loaded == loaded &&
+					entry.resource.getHandleData() == resource.getHandleData();
+			});
+
+			if (iterFindPending != mPendingNotifications.end())
+				continue;
+
+			PendingNotification notification;
+			notification.listener = listener;
+			notification.resource = resource;
+			notification.loaded = loaded;
+			notification.priority = listener->getListenerPriority();
+			notification.order = mNextNotificationOrder++;
+
+			mPendingNotifications.push_back(notification);
+		}
+	}
+
+	void ResourceListenerManager::processPendingNotifications()
+	{
+		if (mPendingNotifications.empty())
+			return;
+
+		std::sort(mPendingNotifications.begin(), mPendingNotifications.end(),
+			[](const PendingNotification& a, const PendingNotification& b)
+		{
+			if (a.priority != b.priority)
+				return a.priority > b.priority;
+
+			return a.order < b.order;
+		});
+
+		UINT32 numToSend = std::min(mNotificationBudget, (UINT32)mPendingNotifications.size());
+		for (UINT32 i = 0; i < numToSend; i++)
+		{
+			PendingNotification& notification = mPendingNotifications[i];
+
+#if BS_DEBUG_MODE
+			assert(mActiveListeners.find(notification.listener) != mActiveListeners.end() &&
+				"Attempting to notify a destroyed IResourceListener");
+#endif
+
+			if (notification.loaded)
+				notification.listener->notifyResourceLoaded(notification.resource);
+			else
+				notification.listener->notifyResourceChanged(notification.resource);
+		}
+
+		mPendingNotifications.erase(mPendingNotifications.begin(), mPendingNotifications.begin() + numToSend);
+	}
+
 	void ResourceListenerManager::clearDependencies(IResourceListener* listener)
 	{
 		auto iterFind = mListenerToResourceMap.find(listener);
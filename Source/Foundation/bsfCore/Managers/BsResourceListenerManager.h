@@ -39,12 +39,33 @@ namespace bs
 		void update();
 
 		/**
-		 * Forces the listener to send out events about the specified resource immediately, instead of waiting for the 
+		 * Forces the listener to send out events about the specified resource immediately, instead of waiting for the
 		 * next update() call.
+		 *
+		 * @note	If a notification budget is set the events are queued instead of sent immediately.
 		 */
 		void notifyListeners(const UUID& resourceUUID);
 
+		/**
+		 * Sets the maximum number of listener notifications sent out per update() call. When a resource with many
+		 * dependents is reloaded (e.g. a shader referenced by hundreds of materials) the notifications are then
+		 * spread over multiple frames instead of stalling a single frame, with higher priority listeners
+		 * (IResourceListener::getListenerPriority()) notified first. Set to zero to send all notifications
+		 * immediately (the default).
+		 */
+		void setNotificationBudget(UINT32 numPerFrame) { mNotificationBudget = numPerFrame; }
+
 	private:
+		/**	A notification for a single listener waiting to be sent out. */
+		struct PendingNotification
+		{
+			IResourceListener* listener;
+			HResource resource;
+			bool loaded;
+			INT32 priority;
+			UINT64 order;
+		};
+
 		/**	Triggered by the resources system when a resource has finished loading. */
 		void onResourceLoaded(const HResource& resource);
 
@@ -57,6 +78,18 @@ namespace bs
 		/**	Sends resource modified event to all listeners referencing this resource. */
 		void sendResourceModified(const HResource& resource);
 
+		/**
+		 * Either sends an event about a resource to all relevant listeners immediately, or queues per-listener
+		 * notifications if a notification budget is set.
+		 */
+		void dispatchResourceEvent(const HResource& resource, bool loaded);
+
+		/**	Queues a notification for every listener referencing the provided resource. */
+		void queueNotifications(const HResource& resource, bool loaded);
+
+		/**	Sends out queued notifications, up to the notification budget. */
+		void processPendingNotifications();
+
 		/**	Clears all the stored dependencies for the listener. */
 		void clearDependencies(IResourceListener* listener);
 
@@ -75,6 +108,10 @@ namespace bs
 
 		Vector<HResource> mTempResourceBuffer;
 
+		Vector<PendingNotification> mPendingNotifications;
+		UINT32 mNotificationBudget = 0;
+		UINT64 mNextNotificationOrder = 0;
+
 		RecursiveMutex mMutex;
 
 #if BS_DEBUG_MODE
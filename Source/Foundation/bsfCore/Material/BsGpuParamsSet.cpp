@@ -601,6 +601,10 @@ namespace bs
 			}
 		}
 
+		// Sort by material parameter index so relevant entries can be quickly located when doing sparse updates
+		std::sort(mDataParamInfos.begin(), mDataParamInfos.end(),
+			[](const DataParamInfo& lhs, const DataParamInfo& rhs) { return lhs.paramIdx < rhs.paramIdx; });
+
 		// Add buffers defined in shader but not actually used by GPU programs (so we can check if user is providing a
 		// valid buffer name)
 		auto& allParamBlocks = shader->getParamBlocks();
@@ -878,109 +882,167 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
+	void TGpuParamsSet<Core>::writeDataParam(const SPtr<MaterialParamsType>& params, const DataParamInfo& paramInfo,
+		bool transposeMatrices)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
+		const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
 
-		// Update data params
-		for(auto& paramInfo : mDataParamInfos)
-		{
-			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
-			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
-				continue;
+		UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
+		const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+		UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
 
-			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			if (materialParamInfo->version <= mParamVersion && !updateAll)
-				continue;
+		UINT8* data = params->getData(materialParamInfo->index);
 
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
-			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+		if (transposeMatrices)
+		{
+			auto writeTransposed = [&](auto& temp)
+			{
+				for (UINT32 i = 0; i < arraySize; i++)
+				{
+					UINT32 arrayOffset = i * paramSize;
+					memcpy(&temp, data + arrayOffset, paramSize);
+					auto transposed = temp.transpose();
 
-			UINT8* data = params->getData(materialParamInfo->index);
+					paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &transposed, paramSize);
+				}
+			};
 
-			bool transposeMatrices = ct::RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
-			if (transposeMatrices)
+			switch (materialParamInfo->dataType)
 			{
-				auto writeTransposed = [&](auto& temp)
-				{
-					for (UINT32 i = 0; i < arraySize; i++)
-					{
-						UINT32 arrayOffset = i * paramSize;
-						memcpy(&temp, data + arrayOffset, paramSize);
-						auto transposed = temp.transpose();
+			case GPDT_MATRIX_2X2:
+			{
+				MatrixNxM<2, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_2X3:
+			{
+				MatrixNxM<2, 3> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_2X4:
+			{
+				MatrixNxM<2, 4> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X2:
+			{
+				MatrixNxM<3, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X3:
+			{
+				Matrix3 matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X4:
+			{
+				MatrixNxM<3, 4> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X2:
+			{
+				MatrixNxM<4, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X3:
+			{
+				MatrixNxM<4, 3> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X4:
+			{
+				Matrix4 matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			default:
+			{
+				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+				break;
+			}
+			}
+		}
+		else
+			paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+	}
 
-						paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &transposed, paramSize);
-					}
-				};
+	template<bool Core>
+	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
+	{
+		UINT64 newVersion = params->getParamVersion();
+		if (newVersion == mParamVersion && !updateAll)
+			return;
 
-				switch (materialParamInfo->dataType)
-				{
-				case GPDT_MATRIX_2X2:
-				{
-					MatrixNxM<2, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X3:
-				{
-					MatrixNxM<2, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X4:
-				{
-					MatrixNxM<2, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X2:
-				{
-					MatrixNxM<3, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X3:
-				{
-					Matrix3 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X4:
-				{
-					MatrixNxM<3, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X2:
-				{
-					MatrixNxM<4, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X3:
-				{
-					MatrixNxM<4, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X4:
+		bool transposeMatrices = ct::RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
+
+		// Attempt to avoid iterating over every parameter by retrieving just those that were actually modified
+		mDirtyParamIndices.clear();
+		bool sparse = !updateAll && params->getDirtyParamIndices(mParamVersion, mDirtyParamIndices);
+		if (sparse)
+		{
+			// The same parameter can be reported multiple times if it was modified more than once
+			std::sort(mDirtyParamIndices.begin(), mDirtyParamIndices.end());
+			auto iterEnd = std::unique(mDirtyParamIndices.begin(), mDirtyParamIndices.end());
+
+			bool objectParamsDirty = false;
+			for (auto iter = mDirtyParamIndices.begin(); iter != iterEnd; ++iter)
+			{
+				UINT32 paramIdx = *iter;
+
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramIdx);
+				if (materialParamInfo->type != MaterialParams::ParamType::Data)
 				{
-					Matrix4 matrix;
-					writeTransposed(matrix);
+					objectParamsDirty = true;
+					continue;
 				}
-					break;
-				default:
+
+				// Update all data param mappings for this parameter (mDataParamInfos is sorted by parameter index)
+				auto iterInfo = std::lower_bound(mDataParamInfos.begin(), mDataParamInfos.end(), paramIdx,
+					[](const DataParamInfo& info, UINT32 idx) { return info.paramIdx < idx; });
+
+				for (; iterInfo != mDataParamInfos.end() && iterInfo->paramIdx == paramIdx; ++iterInfo)
 				{
-					paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
-					break;
-				}
+					const DataParamInfo& paramInfo = *iterInfo;
+
+					ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
+					if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
+						continue;
+
+					writeDataParam(params, paramInfo, transposeMatrices);
 				}
 			}
-			else
-				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+
+			// Object parameters haven't changed, no need to touch the GpuParams objects at all
+			if (!objectParamsDirty)
+			{
+				mParamVersion = newVersion;
+				return;
+			}
+		}
+		else
+		{
+			// Update data params
+			for (auto& paramInfo : mDataParamInfos)
+			{
+				ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
+				if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
+					continue;
+
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+				if (materialParamInfo->version <= mParamVersion && !updateAll)
+					continue;
+
+				writeDataParam(params, paramInfo, transposeMatrices);
+			}
 		}
 
 		// Update object params
@@ -1056,7 +1118,7 @@ namespace bs
 			paramPtr->_markCoreDirty();
 		}
 
-		mParamVersion = params->getParamVersion();
+		mParamVersion = newVersion;
 	}
 
 	template class TGpuParamsSet <false>;
@@ -173,13 +173,22 @@ namespace bs
 	private:
 		template<bool Core2> friend class TMaterial;
 
+		/**
+		 * Writes the value of a single data parameter from the material parameters object into its mapped parameter
+		 * block buffer.
+		 */
+		void writeDataParam(const SPtr<MaterialParamsType>& params, const DataParamInfo& paramInfo,
+			bool transposeMatrices);
+
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
-		Vector<DataParamInfo> mDataParamInfos;
+		Vector<DataParamInfo> mDataParamInfos; // Sorted by material parameter index
 		PassParamInfo* mPassParamInfos;
 
 		UINT64 mParamVersion;
 		UINT8* mData;
+
+		Vector<UINT32> mDirtyParamIndices; // Scratch buffer reused between update() calls
 	};
 
 	/** Sim thread version of TGpuParamsSet<Core>. */
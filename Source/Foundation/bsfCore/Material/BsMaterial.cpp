@@ -14,6 +14,7 @@
 #include "Serialization/BsMemorySerializer.h"
 #include "Material/BsMaterialParams.h"
 #include "Material/BsGpuParamsSet.h"
+#include "Material/BsShaderPrewarm.h"
 
 namespace bs
 {
@@ -62,6 +63,19 @@ namespace bs
 	template<bool Core>
 	UINT32 TMaterial<Core>::findTechnique(const FIND_TECHNIQUE_DESC& desc) const
 	{
+		// Check if an identical query was already resolved. Renderers repeat the same queries every time a renderable
+		// is (re)registered, so after the first resolve the lookup is just a single hash map access.
+		size_t queryHash = 0;
+		for (UINT32 i = 0; i < desc.numTags; i++)
+			hash_combine(queryHash, String(desc.tags[i].cstr()));
+
+		if (desc.variation)
+			hash_combine(queryHash, desc.variation->getHash());
+
+		auto iterCached = mTechniqueLookupCache.find(queryHash);
+		if (iterCached != mTechniqueLookupCache.end())
+			return iterCached->second;
+
 		for(UINT32 i = 0; i < (UINT32)mTechniques.size(); i++)
 		{
 			bool foundMatch = true;
@@ -102,11 +116,15 @@ namespace bs
 			}
 
 			if(foundMatch)
+			{
+				mTechniqueLookupCache[queryHash] = i;
 				return i;
+			}
 		}
 
+		mTechniqueLookupCache[queryHash] = (UINT32)-1;
 		return (UINT32)-1;
-		
+
 	}
 
 	template<bool Core>
@@ -192,6 +210,7 @@ namespace bs
 	void TMaterial<Core>::initializeTechniques(bool allVariations, const ShaderVariation& variation)
 	{
 		mTechniques.clear();
+		mTechniqueLookupCache.clear();
 
 		if (isShaderValid(mShader))
 		{
@@ -208,6 +227,7 @@ namespace bs
 			for(auto& entry : mTechniques)
 				entry->compile();
 
+			recordPermutationsUsed();
 			initDefaultParameters();
 		}
 		else
@@ -348,6 +368,53 @@ namespace bs
 		output = TMaterialDataParam<T, Core>(name, getMaterialPtr(this));
 	}
 
+	template<bool Core>
+	void TMaterial<Core>::setTexture(UINT32 handle, const TextureType& value, const TextureSurface& surface)
+	{
+		const MaterialParamsBase::ParamData* data = getHandleParamData(handle, MaterialParamsBase::ParamType::Texture,
+			GPDT_UNKNOWN, 0);
+
+		if (data == nullptr)
+			return;
+
+		// If there is a default value, assign that instead of null
+		TextureType newValue = value;
+		if (newValue == nullptr)
+			mParams->getDefaultTexture(*data, newValue);
+
+		mParams->setTexture(*data, newValue, surface);
+		_markCoreDirty();
+		_markDependenciesDirty();
+		_markResourcesDirty();
+	}
+
+	template<bool Core>
+	const MaterialParamsBase::ParamData* TMaterial<Core>::getHandleParamData(UINT32 handle,
+		MaterialParamsBase::ParamType type, GpuParamDataType dataType, UINT32 arrayIdx) const
+	{
+		if (handle == (UINT32)-1 || handle >= mParams->getNumParams())
+		{
+			LOGWRN("Attempting to access a material parameter through an invalid handle.");
+			return nullptr;
+		}
+
+		const MaterialParamsBase::ParamData* data = mParams->getParamData(handle);
+		if (data->type != type || (type == MaterialParamsBase::ParamType::Data && data->dataType != dataType))
+		{
+			LOGWRN("Type of the provided material parameter handle doesn't match the requested parameter type.");
+			return nullptr;
+		}
+
+		if (arrayIdx >= data->arraySize)
+		{
+			LOGWRN("Array index out of range. Provided index was " + toString(arrayIdx) +
+				" but array length is " + toString(data->arraySize));
+			return nullptr;
+		}
+
+		return data;
+	}
+
 	template<bool Core>
 	void TMaterial<Core>::throwIfNotInitialized() const
 	{
@@ -362,6 +429,23 @@ namespace bs
 		}
 	}
 
+	template<>
+	void TMaterial<false>::recordPermutationsUsed()
+	{
+		if (!ShaderPrewarm::isStarted() || !gShaderPrewarm().isCaptureEnabled())
+			return;
+
+		const UUID& shaderUUID = mShader.getUUID();
+		for (auto& technique : mTechniques)
+			gShaderPrewarm()._notifyPermutationUsed(shaderUUID, technique->getVariation());
+	}
+
+	template<>
+	void TMaterial<true>::recordPermutationsUsed()
+	{
+		// Capture only concerns sim thread materials, where resource identity is known
+	}
+
 	template class TMaterial < false > ;
 	template class TMaterial < true > ;
 
@@ -428,6 +512,7 @@ namespace bs
 
 		mShader = shader;
 		mTechniques.clear();
+		mTechniqueLookupCache.clear();
 		mLoadFlags = Load_None;
 
 		// Make sure to clear params, because the default behaviour is to re-apply them (which won't work due to changed
@@ -472,7 +557,11 @@ namespace bs
 			for (UINT32 i = 0; i < (UINT32)mTechniques.size(); i++)
 				techniques[i] = mTechniques[i]->getCore();
 			
-			SPtr<ct::MaterialParams> materialParams = bs_shared_ptr_new<ct::MaterialParams>(shader, mParams);
+			SPtr<ct::MaterialParams> materialParams;
+			if (mParentMaterial != nullptr)
+				materialParams = bs_shared_ptr_new<ct::MaterialParams>(mParentMaterial->getCore()->_getInternalParams());
+			else
+				materialParams = bs_shared_ptr_new<ct::MaterialParams>(shader, mParams);
 
 			material = new (bs_alloc<ct::Material>()) ct::Material(shader, techniques, materialParams);
 		}
@@ -490,6 +579,14 @@ namespace bs
 	{
 		bool syncAllParams = (getCoreDirtyFlags() & (UINT32)MaterialDirtyFlags::ResourceChanged) != 0;
 
+		// Parameters inherited from the parent are synced through the parent's core object, so an instance only ever
+		// needs to re-send its own overrides
+		if (syncAllParams && mParentMaterial != nullptr)
+		{
+			mParams->rewindLastSyncVersion();
+			syncAllParams = false;
+		}
+
 		UINT32 paramsSize = 0;
 		if (mParams != nullptr)
 			mParams->getSyncData(nullptr, paramsSize, syncAllParams);
@@ -561,6 +658,20 @@ namespace bs
 			{
 				mLoadFlags = Load_All;
 
+				if (mParentMaterial != nullptr)
+				{
+					// Instances share techniques with their parent and overlay its parameters, rather than building
+					// their own copies
+					mParentMaterial->initializeIfLoaded();
+
+					mTechniques = mParentMaterial->mTechniques;
+					mTechniqueLookupCache.clear();
+					mParams = bs_shared_ptr_new<MaterialParams>(mParentMaterial->mParams);
+
+					markCoreDirty();
+					return;
+				}
+
 				// Shader about to change, so save parameters, rebuild material and restore parameters
 				SPtr<MaterialParams> oldParams = mParams;
 
@@ -619,6 +730,19 @@ namespace bs
 		return static_resource_cast<Material>(gResources()._createResourceHandle(cloneObj));
 	}
 
+	HMaterial Material::createInstance()
+	{
+		if (mParams == nullptr) // Not initialized, nothing to share yet
+			return clone();
+
+		SPtr<Material> instance = bs_core_ptr<Material>(new (bs_alloc<Material>()) Material(mShader));
+		instance->mParentMaterial = std::static_pointer_cast<Material>(getThisPtr());
+		instance->_setThisPtr(instance);
+		instance->initialize();
+
+		return static_resource_cast<Material>(gResources()._createResourceHandle(instance));
+	}
+
 	template<class T>
 	void copyParam(const SPtr<MaterialParams>& from, Material* to, const String& name, 
 		const MaterialParams::ParamData& paramRef, UINT32 arraySize)
@@ -849,6 +973,7 @@ namespace bs
 		dataPtr = rttiReadElem(numTechniques, dataPtr);
 
 		mTechniques.resize(numTechniques);
+		mTechniqueLookupCache.clear();
 		for(UINT32 i = 0; i < numTechniques; i++)
 		{
 			SPtr<Technique>* technique = (SPtr<Technique>*)dataPtr;
@@ -274,6 +274,65 @@ namespace bs
 		/** Assigns a sampler state to the shader parameter with the specified name. */
 		void setSamplerState(const String& name, const SamplerStateType& value) { return getParamSamplerState(name).set(value); }
 
+		/**
+		 * Resolves the parameter with the specified name into a handle. The handle may be passed to the handle-based
+		 * set/get methods in order to access the parameter without incurring a name lookup on every call, which is
+		 * noticeably faster when many parameters are updated every frame. Returns an invalid handle if the parameter
+		 * cannot be found, in which case the handle-based methods will quietly do nothing.
+		 *
+		 * @note	The handle is invalidated if the material's shader changes.
+		 */
+		UINT32 getParamHandle(const String& name) const { return mParams->getParamIndex(name); }
+
+		/**
+		 * @copydoc getParamHandle(const String&) const
+		 *
+		 * Accepts a hashed parameter name, as generated by bs_hash_string(). Since hashes of name literals can be
+		 * evaluated at compile time this version avoids runtime string hashing entirely.
+		 */
+		UINT32 getParamHandle(UINT32 nameHash) const { return mParams->getParamIndex(nameHash); }
+
+		/**
+		 * Assigns a value to a data parameter through a handle previously returned by getParamHandle(). Equivalent to
+		 * the name-based set* methods, minus the per-call name lookup.
+		 *
+		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
+		 */
+		template <typename T>
+		void setParam(UINT32 handle, const T& value, UINT32 arrayIdx = 0)
+		{
+			const MaterialParamsBase::ParamData* data = getHandleParamData(handle, MaterialParamsBase::ParamType::Data,
+				(GpuParamDataType)TGpuDataParamInfo<T>::TypeId, arrayIdx);
+
+			if (data == nullptr)
+				return;
+
+			mParams->setDataParam(*data, arrayIdx, value);
+			_markCoreDirty();
+		}
+
+		/**
+		 * Returns the value of a data parameter through a handle previously returned by getParamHandle().
+		 *
+		 * Optionally if the parameter is an array you may provide an array index to retrieve.
+		 */
+		template <typename T>
+		T getParam(UINT32 handle, UINT32 arrayIdx = 0) const
+		{
+			T output{};
+			const MaterialParamsBase::ParamData* data = getHandleParamData(handle, MaterialParamsBase::ParamType::Data,
+				(GpuParamDataType)TGpuDataParamInfo<T>::TypeId, arrayIdx);
+
+			if (data == nullptr)
+				return output;
+
+			mParams->getDataParam(*data, arrayIdx, output);
+			return output;
+		}
+
+		/** Assigns a texture to a parameter through a handle previously returned by getParamHandle(). */
+		void setTexture(UINT32 handle, const TextureType& value, const TextureSurface& surface = TextureSurface::COMPLETE);
+
 		/**
 		 * Returns a float value assigned with the parameter with the specified name.
 		 *
@@ -577,15 +636,31 @@ namespace bs
 		 */
 		void initializeTechniques(bool allVariations = true, const ShaderVariation& variation = ShaderVariation());
 
+		/**
+		 * Records the variations of the material's compiled techniques with the shader permutation capture, if it is
+		 * active. Only relevant for sim thread materials, the core thread version is a no-op.
+		 */
+		void recordPermutationsUsed();
+
 		/** Assigns all the default parameters specified in the shader to the material. */
 		void initDefaultParameters();
 
 		/** Throw an exception if no shader is set, or no acceptable technique was found. */
 		void throwIfNotInitialized() const;
 
+		/**
+		 * Checks that the provided parameter handle is valid, that the parameter has the specified type and that the
+		 * array index is in range, returning the parameter data if so. Returns null and logs a warning otherwise.
+		 */
+		const MaterialParamsBase::ParamData* getHandleParamData(UINT32 handle, MaterialParamsBase::ParamType type,
+			GpuParamDataType dataType, UINT32 arrayIdx) const;
+
 		ShaderType mShader;
 		SPtr<MaterialParamsType> mParams;
 		Vector<SPtr<TechniqueType>> mTechniques;
+
+		/** Caches results of findTechnique() queries, keyed by a hash of the query. Must be cleared along with mTechniques. */
+		mutable UnorderedMap<size_t, UINT32> mTechniqueLookupCache;
 	};
 
 	/** @} */
@@ -617,6 +692,16 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:Clone)
 		HMaterial clone();
 
+		/**
+		 * Creates a lightweight instance of the material. The instance shares the shader, techniques and parameter values
+		 * with this material, and only allocates storage for parameters that are actually overridden on it, making both
+		 * its memory cost and its core thread sync cost proportional to the number of overridden parameters rather than
+		 * the total parameter count. Changes made to this material remain visible on the instance for any parameter kind
+		 * the instance hasn't overridden yet. If the instance gets serialized it is saved as a standalone material.
+		 */
+		BS_SCRIPT_EXPORT(n:CreateInstance)
+		HMaterial createInstance();
+
 		/**
 		 * Creates a new empty material.
 		 * 			
@@ -683,7 +768,10 @@ namespace bs
 		void setParams(const SPtr<MaterialParams>& params);
 
 		UINT32 mLoadFlags;
-		
+
+		/** Material this object is an instance of, if it was created through createInstance(). */
+		SPtr<Material> mParentMaterial;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
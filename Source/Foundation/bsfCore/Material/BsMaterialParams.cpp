@@ -45,7 +45,7 @@ namespace bs
 
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			registerParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -66,7 +66,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			registerParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -83,7 +83,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			registerParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -100,7 +100,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			registerParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -114,9 +114,19 @@ namespace bs
 		}
 	}
 
+	void MaterialParamsBase::detachDataBuffer() const
+	{
+		UINT8* ownedBuffer = mAlloc.alloc(mDataSize);
+		memcpy(ownedBuffer, mDataParamsBuffer, mDataSize);
+
+		mDataParamsBuffer = ownedBuffer;
+		mOwnsDataBuffer = true;
+	}
+
 	MaterialParamsBase::~MaterialParamsBase()
 	{
-		mAlloc.free(mDataParamsBuffer);
+		if (mOwnsDataBuffer)
+			mAlloc.free(mDataParamsBuffer);
 		
 		mAlloc.clear();
 	}
@@ -130,6 +140,15 @@ namespace bs
 		return iterFind->second;
 	}
 
+	UINT32 MaterialParamsBase::getParamIndex(UINT32 nameHash) const
+	{
+		auto iterFind = mParamHashLookup.find(nameHash);
+		if (iterFind == mParamHashLookup.end())
+			return (UINT32)-1;
+
+		return iterFind->second;
+	}
+
 	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const String& name, ParamType type,
 		GpuParamDataType dataType, UINT32 arrayIdx, UINT32& output) const
 	{
@@ -188,6 +207,25 @@ namespace bs
 		}
 	}
 
+	bool MaterialParamsBase::getDirtyParamIndices(UINT64 sinceVersion, Vector<UINT32>& output) const
+	{
+		if (mLostDirtyVersion > sinceVersion)
+			return false;
+
+		// Iterate from the most recently recorded entry backwards, until we reach entries the caller has already seen
+		UINT64 numEntries = std::min(mNumDirtyParams, (UINT64)DIRTY_PARAM_LIST_SIZE);
+		for (UINT64 i = 0; i < numEntries; i++)
+		{
+			UINT32 entryIdx = (UINT32)((mNumDirtyParams - 1 - i) % DIRTY_PARAM_LIST_SIZE);
+			if (mDirtyParamVersions[entryIdx] <= sinceVersion)
+				break;
+
+			output.push_back(mDirtyParamList[entryIdx]);
+		}
+
+		return true;
+	}
+
 	RTTITypeBase* MaterialParamStructData::getRTTIStatic()
 	{
 		return MaterialParamStructDataRTTI::instance();
@@ -267,27 +305,131 @@ namespace bs
 		}
 	}
 
+	template<bool Core>
+	TMaterialParams<Core>::TMaterialParams(const SPtr<TMaterialParams<Core>>& parent)
+		:mParentParams(parent)
+	{
+		// Copy the small per-parameter metadata so versions and dirty state are tracked per instance, but share the
+		// actual parameter storage with the parent until a value of the relevant kind is first written
+		mParamLookup = parent->mParamLookup;
+		mParamHashLookup = parent->mParamHashLookup;
+		mParams = parent->mParams;
+		mParamVersion = parent->mParamVersion;
+
+		mDataSize = parent->mDataSize;
+		mNumStructParams = parent->mNumStructParams;
+		mNumTextureParams = parent->mNumTextureParams;
+		mNumBufferParams = parent->mNumBufferParams;
+		mNumSamplerParams = parent->mNumSamplerParams;
+
+		mDataParamsBuffer = parent->mDataParamsBuffer;
+		mOwnsDataBuffer = false;
+
+		mStructParams = parent->mStructParams;
+		mOwnsStructParams = false;
+
+		mTextureParams = parent->mTextureParams;
+		mOwnsTextureParams = false;
+
+		mBufferParams = parent->mBufferParams;
+		mOwnsBufferParams = false;
+
+		mSamplerStateParams = parent->mSamplerStateParams;
+		mOwnsSamplerParams = false;
+
+		// Defaults are immutable so they remain shared for the lifetime of the instance
+		mDefaultTextureParams = parent->mDefaultTextureParams;
+		mDefaultSamplerStateParams = parent->mDefaultSamplerStateParams;
+	}
+
 	template<bool Core>
 	TMaterialParams<Core>::~TMaterialParams()
 	{
-		if (mStructParams != nullptr)
+		if (mStructParams != nullptr && mOwnsStructParams)
 		{
 			for (UINT32 i = 0; mNumStructParams; i++)
 				mAlloc.free(mStructParams[i].data);
 		}
 
-		mAlloc.destruct(mStructParams, mNumStructParams);
-		mAlloc.destruct(mTextureParams, mNumTextureParams);
-		mAlloc.destruct(mBufferParams, mNumBufferParams);
-		mAlloc.destruct(mSamplerStateParams, mNumSamplerParams);
+		if (mOwnsStructParams)
+			mAlloc.destruct(mStructParams, mNumStructParams);
+
+		if (mOwnsTextureParams)
+			mAlloc.destruct(mTextureParams, mNumTextureParams);
+
+		if (mOwnsBufferParams)
+			mAlloc.destruct(mBufferParams, mNumBufferParams);
+
+		if (mOwnsSamplerParams)
+			mAlloc.destruct(mSamplerStateParams, mNumSamplerParams);
 
-		if(mDefaultTextureParams != nullptr)
+		if(mDefaultTextureParams != nullptr && mParentParams == nullptr)
 			mAlloc.destruct(mDefaultTextureParams, mNumTextureParams);
 
-		if (mDefaultSamplerStateParams != nullptr)
+		if (mDefaultSamplerStateParams != nullptr && mParentParams == nullptr)
 			mAlloc.destruct(mDefaultSamplerStateParams, mNumSamplerParams);
 	}
 
+	template<bool Core>
+	void TMaterialParams<Core>::ensureStructParamsOwned()
+	{
+		if (mOwnsStructParams)
+			return;
+
+		ParamStructDataType* owned = mAlloc.construct<ParamStructDataType>(mNumStructParams);
+		for (UINT32 i = 0; i < mNumStructParams; i++)
+		{
+			owned[i].dataSize = mStructParams[i].dataSize;
+			owned[i].data = mAlloc.alloc(owned[i].dataSize);
+			memcpy(owned[i].data, mStructParams[i].data, owned[i].dataSize);
+		}
+
+		mStructParams = owned;
+		mOwnsStructParams = true;
+	}
+
+	template<bool Core>
+	void TMaterialParams<Core>::ensureTextureParamsOwned()
+	{
+		if (mOwnsTextureParams)
+			return;
+
+		ParamTextureDataType* owned = mAlloc.construct<ParamTextureDataType>(mNumTextureParams);
+		for (UINT32 i = 0; i < mNumTextureParams; i++)
+			owned[i] = mTextureParams[i];
+
+		mTextureParams = owned;
+		mOwnsTextureParams = true;
+	}
+
+	template<bool Core>
+	void TMaterialParams<Core>::ensureBufferParamsOwned()
+	{
+		if (mOwnsBufferParams)
+			return;
+
+		ParamBufferDataType* owned = mAlloc.construct<ParamBufferDataType>(mNumBufferParams);
+		for (UINT32 i = 0; i < mNumBufferParams; i++)
+			owned[i] = mBufferParams[i];
+
+		mBufferParams = owned;
+		mOwnsBufferParams = true;
+	}
+
+	template<bool Core>
+	void TMaterialParams<Core>::ensureSamplerParamsOwned()
+	{
+		if (mOwnsSamplerParams)
+			return;
+
+		ParamSamplerStateDataType* owned = mAlloc.construct<ParamSamplerStateDataType>(mNumSamplerParams);
+		for (UINT32 i = 0; i < mNumSamplerParams; i++)
+			owned[i] = mSamplerStateParams[i];
+
+		mSamplerStateParams = owned;
+		mOwnsSamplerParams = true;
+	}
+
 	template<bool Core>
 	void TMaterialParams<Core>::getStructData(const String& name, void* value, UINT32 size, UINT32 arrayIdx) const
 	{
@@ -453,8 +595,10 @@ namespace bs
 			return;
 		}
 
-		memcpy(structParam.data, value, structParam.dataSize);
-		param.version = ++mParamVersion;
+		ensureStructParamsOwned();
+
+		memcpy(mStructParams[param.index + arrayIdx].data, value, size);
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -475,12 +619,14 @@ namespace bs
 	template<bool Core>
 	void TMaterialParams<Core>::setTexture(const ParamData& param, const TextureType& value, const TextureSurface& surface)
 	{
+		ensureTextureParamsOwned();
+
 		ParamTextureDataType& textureParam = mTextureParams[param.index];
 		textureParam.value = value;
 		textureParam.isLoadStore = false;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -492,9 +638,11 @@ namespace bs
 	template<bool Core>
 	void TMaterialParams<Core>::setBuffer(const ParamData& param, const BufferType& value)
 	{
+		ensureBufferParamsOwned();
+
 		mBufferParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -508,12 +656,14 @@ namespace bs
 	template<bool Core>
 	void TMaterialParams<Core>::setLoadStoreTexture(const ParamData& param, const TextureType& value, const TextureSurface& surface)
 	{
+		ensureTextureParamsOwned();
+
 		ParamTextureDataType& textureParam = mTextureParams[param.index];
 		textureParam.value = value;
 		textureParam.isLoadStore = true;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -531,9 +681,11 @@ namespace bs
 	template<bool Core>
 	void TMaterialParams<Core>::setSamplerState(const ParamData& param, const SamplerType& value)
 	{
+		ensureSamplerParamsOwned();
+
 		mSamplerStateParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -555,6 +707,14 @@ namespace bs
 		:TMaterialParams(shader), mLastSyncVersion(1)
 	{ }
 
+	MaterialParams::MaterialParams(const SPtr<MaterialParams>& parent)
+		:TMaterialParams(parent), mLastSyncVersion(parent->mParamVersion)
+	{
+		// Values inherited from the parent are synced through the parent's own core object, so the instance only ever
+		// needs to sync parameters written after this point
+		mBaseVersion = parent->mParamVersion;
+	}
+
 	void MaterialParams::getSyncData(UINT8* buffer, UINT32& size, bool forceAll)
 	{
 		// Note: Not syncing struct data
@@ -776,6 +936,10 @@ namespace bs
 		:TMaterialParams(shader)
 	{ }
 
+	MaterialParams::MaterialParams(const SPtr<MaterialParams>& parent)
+		:TMaterialParams(parent)
+	{ }
+
 	MaterialParams::MaterialParams(const SPtr<Shader>& shader, const SPtr<bs::MaterialParams>& params)
 		: TMaterialParams(shader)
 	{
@@ -837,6 +1001,15 @@ namespace bs
 		sourceData = rttiReadElem(numDirtyBufferParams, sourceData);
 		sourceData = rttiReadElem(numDirtySamplerParams, sourceData);
 
+		if (numDirtyDataParams > 0)
+			ensureDataBufferOwned();
+		if (numDirtyTextureParams > 0)
+			ensureTextureParamsOwned();
+		if (numDirtyBufferParams > 0)
+			ensureBufferParamsOwned();
+		if (numDirtySamplerParams > 0)
+			ensureSamplerParamsOwned();
+
 		mParamVersion++;
 
 		for(UINT32 i = 0; i < numDirtyDataParams; i++)
@@ -846,6 +1019,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx, mParamVersion);
 
 			UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = bs::GpuParams::PARAM_SIZES.lookup[(int)param.dataType];
@@ -863,6 +1037,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx, mParamVersion);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -878,6 +1053,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx, mParamVersion);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -893,6 +1069,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(paramIdx, mParamVersion);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
@@ -110,6 +110,7 @@ namespace bs
 			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[dataType];
 			UINT32 paramTypeSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
 
+			ensureDataBufferOwned();
 			memcpy(&mDataParamsBuffer[param->index + arrayIdx * paramTypeSize], input, sizeof(paramTypeSize));
 		}
 
@@ -122,7 +123,17 @@ namespace bs
 		 */
 		UINT32 getParamIndex(const String& name) const;
 
-		/** 
+		/**
+		 * Returns an index of the parameter whose name hashes to the provided value, as generated by bs_hash_string().
+		 * Since hashes of name literals can be computed at compile time, this avoids per-call string hashing and
+		 * comparison. Index can be used in a call to getParamData(UINT32) to get the actual parameter data.
+		 *
+		 * @param[in]	nameHash	bs_hash_string() hash of the shader parameter name.
+		 * @return					Index of the parameter, or -1 if not found.
+		 */
+		UINT32 getParamIndex(UINT32 nameHash) const;
+
+		/**
 		 * Returns an index of the parameter with the specified name. Index can be used in a call to getParamData(UINT32) to
 		 * get the actual parameter data.
 		 *
@@ -204,9 +215,11 @@ namespace bs
 			UINT32 paramTypeSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
 
 			assert(sizeof(input) == paramTypeSize);
+
+			ensureDataBufferOwned();
 			memcpy(&mDataParamsBuffer[param.index + arrayIdx * paramTypeSize], &input, paramTypeSize);
 
-			param.version = ++mParamVersion;
+			markParamDirty(param);
 		}
 
 		/** Returns pointer to the internal data buffer for a data parameter at the specified index. */
@@ -218,13 +231,64 @@ namespace bs
 		/** Returns a counter that gets incremented whenever a parameter gets updated. */
 		UINT64 getParamVersion() const { return mParamVersion; }
 
+		/**
+		 * Populates the provided buffer with global indices of all parameters that were modified after the provided
+		 * version number, as reported by getParamVersion(). Returns false if that information is no longer available
+		 * (too many parameters were modified since), in which case the caller should assume every parameter has
+		 * potentially been modified. The same index may be reported multiple times if the parameter was modified
+		 * more than once.
+		 */
+		bool getDirtyParamIndices(UINT64 sinceVersion, Vector<UINT32>& output) const;
+
 	protected:
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
+		const static UINT32 DIRTY_PARAM_LIST_SIZE = 64;
+
+		/** Assigns the parameter a new version number and records it in the dirty parameter list. */
+		void markParamDirty(const ParamData& param) const
+		{
+			param.version = ++mParamVersion;
+			recordDirtyParam((UINT32)(&param - mParams.data()), mParamVersion);
+		}
+
+		/** Records an entry in the dirty parameter list, as returned by getDirtyParamIndices(). */
+		void recordDirtyParam(UINT32 paramIdx, UINT64 version) const
+		{
+			UINT32 entryIdx = (UINT32)(mNumDirtyParams % DIRTY_PARAM_LIST_SIZE);
+			if(mNumDirtyParams >= DIRTY_PARAM_LIST_SIZE)
+				mLostDirtyVersion = mDirtyParamVersions[entryIdx];
+
+			mDirtyParamList[entryIdx] = paramIdx;
+			mDirtyParamVersions[entryIdx] = version;
+			mNumDirtyParams++;
+		}
+
+		/** Registers the parameter at the specified index in the name and hashed-name lookup maps. */
+		void registerParamLookup(const String& name, UINT32 index)
+		{
+			mParamLookup[name] = index;
+			mParamHashLookup[bs_hash_string(name.c_str())] = index;
+		}
+
+		/**
+		 * Allocates an owned copy of the data parameter buffer if it is currently shared with a parent object. Must be
+		 * called before any write into the buffer. See TMaterialParams(const SPtr<TMaterialParams>&).
+		 */
+		void ensureDataBufferOwned() const
+		{
+			if (!mOwnsDataBuffer)
+				detachDataBuffer();
+		}
+
+		/** Replaces the shared data parameter buffer with an owned copy. */
+		void detachDataBuffer() const;
 
 		UnorderedMap<String, UINT32> mParamLookup;
+		UnorderedMap<UINT32, UINT32> mParamHashLookup;
 		Vector<ParamData> mParams;
 
-		UINT8* mDataParamsBuffer = nullptr;
+		mutable UINT8* mDataParamsBuffer = nullptr;
+		mutable bool mOwnsDataBuffer = true; /**< False if the data buffer is shared with a parent until first write. */
 
 		UINT32 mDataSize = 0;
 		UINT32 mNumStructParams = 0;
@@ -233,6 +297,15 @@ namespace bs
 		UINT32 mNumSamplerParams = 0;
 
 		mutable UINT64 mParamVersion = 1;
+
+		mutable UINT32 mDirtyParamList[DIRTY_PARAM_LIST_SIZE];
+		mutable UINT64 mDirtyParamVersions[DIRTY_PARAM_LIST_SIZE];
+		mutable UINT64 mNumDirtyParams = 0;
+
+		// Parameters receive version 1 on construction without being recorded in the dirty list, so any caller that
+		// hasn't yet observed version 1 must do a full update
+		mutable UINT64 mLostDirtyVersion = 1;
+
 		mutable StaticAlloc<STATIC_BUFFER_SIZE> mAlloc;
 	};
 
@@ -354,6 +427,18 @@ namespace bs
 		/** Creates a new material params object and initializes enough room for parameters from the provided shader. */
 		TMaterialParams(const ShaderType& shader);
 
+		/**
+		 * Creates a new object that initially shares all parameter values with the provided parent. Shared storage is
+		 * only copied when a parameter of the relevant kind is first written, making unmodified instances
+		 * O(overridden parameters) in memory instead of a full copy of the parent's backing store. The parent is kept
+		 * alive for the lifetime of this object.
+		 *
+		 * Parent values written after construction remain visible through this object for parameter kinds that haven't
+		 * been overridden yet, so instances are primarily meant for cheap per-instance overrides rather than live
+		 * editing of the parent.
+		 */
+		TMaterialParams(const SPtr<TMaterialParams<Core>>& parent);
+
 		/** Constructor for serialization use only. */
 		TMaterialParams() { }
 
@@ -554,12 +639,31 @@ namespace bs
 		void getDefaultSamplerState(const ParamData& param, SamplerType& value) const;
 
 	protected:
+		/** Replaces shared struct parameter storage with an owned copy. Must be called before any struct write. */
+		void ensureStructParamsOwned();
+
+		/** Replaces shared texture parameter storage with an owned copy. Must be called before any texture write. */
+		void ensureTextureParamsOwned();
+
+		/** Replaces shared buffer parameter storage with an owned copy. Must be called before any buffer write. */
+		void ensureBufferParamsOwned();
+
+		/** Replaces shared sampler parameter storage with an owned copy. Must be called before any sampler write. */
+		void ensureSamplerParamsOwned();
+
 		ParamStructDataType* mStructParams = nullptr;
 		ParamTextureDataType* mTextureParams = nullptr;
 		ParamBufferDataType* mBufferParams = nullptr;
 		ParamSamplerStateDataType* mSamplerStateParams = nullptr;
 		TextureType* mDefaultTextureParams = nullptr;
 		SamplerType* mDefaultSamplerStateParams = nullptr;
+
+		/** Parent whose parameter storage is shared until overridden, if the object was created as an instance. */
+		SPtr<TMaterialParams<Core>> mParentParams;
+		bool mOwnsStructParams = true;
+		bool mOwnsTextureParams = true;
+		bool mOwnsBufferParams = true;
+		bool mOwnsSamplerParams = true;
 	};
 
 	/** 
@@ -583,7 +687,17 @@ namespace bs
 		/** @copydoc TMaterialParams::TMaterialParams(const ShaderType&) */
 		MaterialParams(const HShader& shader);
 
-		/** 
+		/** @copydoc TMaterialParams::TMaterialParams(const SPtr<TMaterialParams>&) */
+		MaterialParams(const SPtr<MaterialParams>& parent);
+
+		/**
+		 * Rewinds the last sync version so every parameter modified since construction gets re-synced by the next
+		 * getSyncData() call. Used instead of a full sync for params created as an instance of a parent, whose
+		 * core-thread counterpart starts out sharing the parent's values and only needs the overrides.
+		 */
+		void rewindLastSyncVersion() { mLastSyncVersion = mBaseVersion; }
+
+		/**
 		 * Populates the provided buffer with parameters that can be used for syncing this object with its core-thread
 		 * counterpart. Can be applied by calling ct::MaterialParams::setSyncData.
 		 *
@@ -606,6 +720,7 @@ namespace bs
 		friend class ct::MaterialParams;
 
 		UINT64 mLastSyncVersion;
+		UINT64 mBaseVersion = 1; /**< Parameter version at construction time, before any local overrides. */
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -630,7 +745,10 @@ namespace bs
 		/** @copydoc TMaterialParams::TMaterialParams(const ShaderType&) */
 		MaterialParams(const SPtr<Shader>& shader);
 
-		/** 
+		/** @copydoc TMaterialParams::TMaterialParams(const SPtr<TMaterialParams>&) */
+		MaterialParams(const SPtr<MaterialParams>& parent);
+
+		/**
 		 * Updates the stored parameters from the provided buffer, allowing changes to be transfered between the sim and 
 		 * core thread material param objects. Buffer must be retrieved from bs::MaterialParams::getSyncData. 
 		 *
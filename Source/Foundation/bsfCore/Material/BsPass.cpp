@@ -46,6 +46,43 @@ namespace bs
 		return transparent;
 	}
 
+	template<bool Core>
+	bool TPass<Core>::hasCommutativeBlending() const
+	{
+		if (!hasBlending())
+			return false;
+
+		for (UINT32 i = 0; i < BS_MAX_MULTIPLE_RENDER_TARGETS; i++)
+		{
+			const RENDER_TARGET_BLEND_STATE_DESC& rtDesc = mData.blendStateDesc.renderTargetDesc[i];
+			if (!rtDesc.blendEnable)
+				continue;
+
+			// Additive: destination is kept as-is and the source factor doesn't read the destination
+			bool additive = rtDesc.blendOp == BO_ADD && rtDesc.dstBlend == BF_ONE &&
+				(rtDesc.srcBlend == BF_ONE || rtDesc.srcBlend == BF_SOURCE_ALPHA);
+
+			// Modulative: destination is multiplied by the source color
+			bool modulative = rtDesc.blendOp == BO_ADD && rtDesc.srcBlend == BF_ZERO &&
+				rtDesc.dstBlend == BF_SOURCE_COLOR;
+
+			if (!additive && !modulative)
+				return false;
+
+			// Same requirement for the alpha channel, but only if the pass writes it
+			if ((rtDesc.renderTargetWriteMask & 0x8) != 0)
+			{
+				bool additiveAlpha = rtDesc.blendOpAlpha == BO_ADD && rtDesc.dstBlendAlpha == BF_ONE &&
+					(rtDesc.srcBlendAlpha == BF_ONE || rtDesc.srcBlendAlpha == BF_SOURCE_ALPHA);
+
+				if (!additiveAlpha)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
 	template<bool Core>
 	const GPU_PROGRAM_DESC& TPass<Core>::getProgramDesc(bs::GpuProgramType type) const
 	{
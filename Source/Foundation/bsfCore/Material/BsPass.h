@@ -85,6 +85,12 @@ namespace bs
 		/**	Returns true if this pass has some element of transparency. */
 		bool hasBlending() const;
 
+		/**
+		 * Returns true if the blending performed by this pass is order independent (e.g. additive), meaning geometry
+		 * rendered with it yields the same output regardless of the order it is drawn in relative to other such geometry.
+		 */
+		bool hasCommutativeBlending() const;
+
 		/** Returns true if the pass executes a compute program. */
 		bool isCompute() const { return !mData.computeProgramDesc.source.empty(); }
 
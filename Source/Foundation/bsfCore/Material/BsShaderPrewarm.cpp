@@ -0,0 +1,131 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Material/BsShaderPrewarm.h"
+#include "Material/BsShader.h"
+#include "Material/BsTechnique.h"
+#include "Private/RTTI/BsShaderPrewarmRTTI.h"
+#include "Resources/BsResources.h"
+#include "Serialization/BsFileSerializer.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	void ShaderPrewarmManifest::registerPermutation(const UUID& shaderUUID, const ShaderVariation& variation)
+	{
+		UINT64 hash = variation.getHash();
+
+		UINT32 numEntries = (UINT32)mShaderUUIDs.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			if (mShaderUUIDs[i] == shaderUUID && mVariations[i]->getHash() == hash)
+				return;
+		}
+
+		mShaderUUIDs.push_back(shaderUUID);
+		mVariations.push_back(bs_shared_ptr_new<ShaderVariation>(variation));
+	}
+
+	void ShaderPrewarmManifest::save(const SPtr<ShaderPrewarmManifest>& manifest, const Path& path)
+	{
+		FileEncoder fs(path);
+		fs.encode(manifest.get());
+	}
+
+	SPtr<ShaderPrewarmManifest> ShaderPrewarmManifest::load(const Path& path)
+	{
+		FileDecoder fs(path);
+
+		SPtr<IReflectable> obj = fs.decode();
+		if (obj == nullptr || !rtti_is_of_type<ShaderPrewarmManifest>(obj))
+			return nullptr;
+
+		return std::static_pointer_cast<ShaderPrewarmManifest>(obj);
+	}
+
+	RTTITypeBase* ShaderPrewarmManifest::getRTTIStatic()
+	{
+		return ShaderPrewarmManifestRTTI::instance();
+	}
+
+	RTTITypeBase* ShaderPrewarmManifest::getRTTI() const
+	{
+		return getRTTIStatic();
+	}
+
+	SPtr<ShaderPrewarmManifest> ShaderPrewarm::generateManifest() const
+	{
+		Lock lock(mMutex);
+
+		if (mCaptured == nullptr)
+			return bs_shared_ptr_new<ShaderPrewarmManifest>();
+
+		return bs_shared_ptr_new<ShaderPrewarmManifest>(*mCaptured);
+	}
+
+	void ShaderPrewarm::prewarm(const SPtr<ShaderPrewarmManifest>& manifest)
+	{
+		if (manifest == nullptr)
+			return;
+
+		UINT32 numEntries = manifest->getNumEntries();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			UUID uuid = manifest->getShaderUUID(i);
+			ShaderVariation variation = manifest->getVariation(i);
+
+			// Each permutation gets its own task so compilation spreads over all worker threads. The actual
+			// backend pipeline creation is queued to the core thread, which processes it while load proceeds.
+			SPtr<Task> task = Task::create("ShaderPrewarm", [uuid, variation]()
+			{
+				HShader shader = static_resource_cast<Shader>(gResources().loadFromUUID(uuid));
+				if (shader == nullptr || !shader.isLoaded())
+					return;
+
+				Vector<SPtr<Technique>> techniques = shader->getCompatibleTechniques(variation);
+				for (auto& technique : techniques)
+					technique->compile();
+			});
+
+			TaskScheduler::instance().addTask(task);
+
+			{
+				Lock lock(mMutex);
+				mPrewarmTasks.push_back(task);
+			}
+		}
+	}
+
+	void ShaderPrewarm::waitUntilComplete()
+	{
+		Vector<SPtr<Task>> tasks;
+		{
+			Lock lock(mMutex);
+			tasks.swap(mPrewarmTasks);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	void ShaderPrewarm::_notifyPermutationUsed(const UUID& shaderUUID, const ShaderVariation& variation)
+	{
+		if (!isCaptureEnabled() || shaderUUID.empty())
+			return;
+
+		Lock lock(mMutex);
+
+		UnorderedSet<UINT64>& hashes = mCapturedHashes[shaderUUID];
+		if (!hashes.insert(variation.getHash()).second)
+			return;
+
+		if (mCaptured == nullptr)
+			mCaptured = bs_shared_ptr_new<ShaderPrewarmManifest>();
+
+		mCaptured->registerPermutation(shaderUUID, variation);
+	}
+
+	ShaderPrewarm& gShaderPrewarm()
+	{
+		return ShaderPrewarm::instance();
+	}
+}
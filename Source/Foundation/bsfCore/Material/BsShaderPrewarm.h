@@ -0,0 +1,118 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Material/BsShaderVariation.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Material
+	 *  @{
+	 */
+
+	/**
+	 * Contains a set of shader permutations (shader resource + variation pairs) observed in use during a capture
+	 * session (e.g. a QA run). The manifest can be saved to a file, shipped with the application and handed to
+	 * ShaderPrewarm::prewarm() on startup or level load, so the relevant GPU pipelines get compiled up-front instead
+	 * of on first use.
+	 */
+	class BS_CORE_EXPORT ShaderPrewarmManifest : public IReflectable
+	{
+	public:
+		ShaderPrewarmManifest() = default;
+
+		/** Registers a shader permutation with the manifest. Duplicates are ignored. */
+		void registerPermutation(const UUID& shaderUUID, const ShaderVariation& variation);
+
+		/** Returns the number of registered permutations. */
+		UINT32 getNumEntries() const { return (UINT32)mShaderUUIDs.size(); }
+
+		/** Returns the UUID of the shader resource of the permutation at the specified index. */
+		const UUID& getShaderUUID(UINT32 idx) const { return mShaderUUIDs[idx]; }
+
+		/** Returns the variation of the permutation at the specified index. */
+		const ShaderVariation& getVariation(UINT32 idx) const { return *mVariations[idx]; }
+
+		/** Saves the manifest at the specified location. */
+		static void save(const SPtr<ShaderPrewarmManifest>& manifest, const Path& path);
+
+		/** Loads a manifest previously saved with save(). Returns null if the file contains no manifest. */
+		static SPtr<ShaderPrewarmManifest> load(const Path& path);
+
+	private:
+		Vector<UUID> mShaderUUIDs;
+		Vector<SPtr<ShaderVariation>> mVariations;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class ShaderPrewarmManifestRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/**
+	 * Allows the set of shader permutations used by the application to be captured into a manifest during development,
+	 * and pre-warmed from such a manifest in shipped builds. Pre-warming compiles the GPU pipelines of the manifest's
+	 * permutations on worker threads, so they don't need to be compiled at first draw, eliminating hitches when a
+	 * level area is first traversed.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ShaderPrewarm : public Module<ShaderPrewarm>
+	{
+	public:
+		/**
+		 * Enables or disables permutation capture. While enabled, any shader permutation that gets compiled is
+		 * recorded, and can be retrieved via generateManifest() at the end of the session.
+		 */
+		void setCaptureEnabled(bool enabled) { mCaptureEnabled.store(enabled, std::memory_order_relaxed); }
+
+		/** Checks is permutation capture currently enabled. */
+		bool isCaptureEnabled() const { return mCaptureEnabled.load(std::memory_order_relaxed); }
+
+		/** Returns a manifest containing all permutations captured so far. */
+		SPtr<ShaderPrewarmManifest> generateManifest() const;
+
+		/**
+		 * Queues compilation of the GPU pipelines of all permutations in the provided manifest on worker threads.
+		 * Returns immediately while compilation proceeds in the background - use waitUntilComplete() if you need to
+		 * ensure it finished (e.g. before hiding a loading screen). Permutations whose shader cannot be resolved
+		 * through the resource system are skipped.
+		 */
+		void prewarm(const SPtr<ShaderPrewarmManifest>& manifest);
+
+		/** Blocks the calling thread until all pipelines queued by prewarm() have been compiled. */
+		void waitUntilComplete();
+
+	public: // ***** INTERNAL ******
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Notifies the module that a shader permutation was compiled for use. Called internally whenever a material
+		 * compiles its techniques.
+		 */
+		void _notifyPermutationUsed(const UUID& shaderUUID, const ShaderVariation& variation);
+
+		/** @} */
+
+	private:
+		std::atomic<bool> mCaptureEnabled{ false };
+
+		UnorderedMap<UUID, UnorderedSet<UINT64>> mCapturedHashes;
+		SPtr<ShaderPrewarmManifest> mCaptured;
+		Vector<SPtr<Task>> mPrewarmTasks;
+		mutable Mutex mMutex;
+	};
+
+	/** Provides easier access to ShaderPrewarm. */
+	BS_CORE_EXPORT ShaderPrewarm& gShaderPrewarm();
+
+	/** @} */
+}
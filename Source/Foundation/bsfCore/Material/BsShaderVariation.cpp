@@ -31,6 +31,12 @@ namespace bs
 			mParams[entry.name] = entry;
 	}
 
+	ShaderVariation::ShaderVariation(const Vector<Param>& params)
+	{
+		for (auto& entry : params)
+			mParams[entry.name] = entry;
+	}
+
 	INT32 ShaderVariation::getInt(const StringID& name)
 	{
 		auto iterFind = mParams.find(name);
@@ -90,6 +96,29 @@ namespace bs
 		return defines;
 	}
 
+	UINT64 ShaderVariation::getHash() const
+	{
+		if (mHashValid)
+			return mHash;
+
+		// Individual entries are combined using XOR so the final hash doesn't depend on the order in which the
+		// parameters are iterated over
+		UINT64 hash = 0;
+		for (auto& entry : mParams)
+		{
+			size_t entryHash = 0;
+			hash_combine(entryHash, String(entry.first.cstr()));
+			hash_combine(entryHash, entry.second.i);
+
+			hash ^= (UINT64)entryHash;
+		}
+
+		mHash = hash;
+		mHashValid = true;
+
+		return mHash;
+	}
+
 	bool ShaderVariation::operator==(const ShaderVariation& rhs) const
 	{
 		for(auto& entry : mParams)
@@ -91,6 +91,9 @@ namespace bs
 		/** Creates a new shader variation with the specified parameters. */
 		ShaderVariation(const SmallVector<Param, 4>& params);
 
+		/** @copydoc ShaderVariation(const SmallVector<Param, 4>&) */
+		ShaderVariation(const Vector<Param>& params);
+
 		/** 
 		 * Returns the value of a signed integer parameter with the specified name. Returns 0 if the parameter cannot be 
 		 * found.
@@ -124,11 +127,17 @@ namespace bs
 		void setIdx(UINT32 idx) const { mIdx = idx; }
 
 		/** Registers a new parameter that controls the variation. */
-		void addParam(const Param& param) { mParams[param.name] = param; }
+		void addParam(const Param& param) { mParams[param.name] = param; mHashValid = false; }
 
 		/** Returns all the variation parameters. */
 		const UnorderedMap<StringID, Param>& getParams() const { return mParams; }
 
+		/**
+		 * Returns a canonical 64-bit hash of all the variation parameters. The hash doesn't depend on the order in
+		 * which the parameters were registered. Computed on first use and cached afterwards.
+		 */
+		UINT64 getHash() const;
+
 		bool operator==(const ShaderVariation& rhs) const;
 
 	private:
@@ -136,6 +145,8 @@ namespace bs
 
 		UnorderedMap<StringID, Param> mParams;
 		mutable UINT32 mIdx = -1;
+		mutable UINT64 mHash = 0;
+		mutable bool mHashValid = false;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
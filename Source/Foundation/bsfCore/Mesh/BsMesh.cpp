@@ -3,6 +3,7 @@
 #include "Mesh/BsMesh.h"
 #include "Private/RTTI/BsMeshRTTI.h"
 #include "Mesh/BsMeshData.h"
+#include "Mesh/BsMeshBVH.h"
 #include "Debug/BsDebug.h"
 #include "Managers/BsHardwareBufferManager.h"
 #include "Managers/BsMeshManager.h"
@@ -11,6 +12,8 @@
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Resources/BsResources.h"
 #include "RenderAPI/BsRenderAPI.h"
+#include "Profiling/BsRenderStats.h"
+#include "Utility/BsUtil.h"
 
 namespace bs
 {
@@ -20,7 +23,8 @@ namespace bs
 		:MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexDesc(desc.vertexDesc), mUsage(desc.usage),
 		mIndexType(desc.indexType), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLodSubMeshes = desc.lodSubMeshes;
+		mProperties.mLodScreenSizes = desc.lodScreenSizes;
 	}
 
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc)
@@ -29,7 +33,8 @@ namespace bs
 		mUsage(desc.usage), mIndexType(initialMeshData->getIndexType()), mSkeleton(desc.skeleton),
 		mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLodSubMeshes = desc.lodSubMeshes;
+		mProperties.mLodScreenSizes = desc.lodScreenSizes;
 	}
 
 	Mesh::Mesh()
@@ -120,6 +125,8 @@ namespace bs
 		desc.numIndices = mProperties.mNumIndices;
 		desc.vertexDesc = mVertexDesc;
 		desc.subMeshes = mProperties.mSubMeshes;
+		desc.lodSubMeshes = mProperties.mLodSubMeshes;
+		desc.lodScreenSizes = mProperties.mLodScreenSizes;
 		desc.usage = mUsage;
 		desc.indexType = mIndexType;
 		desc.skeleton = mSkeleton;
@@ -191,6 +198,31 @@ namespace bs
 		memcpy(destPtr, srcPtr, dest.getSize());
 	}
 
+	void Mesh::generateBVH()
+	{
+		if (mBVH != nullptr)
+			return;
+
+		if ((mUsage & MU_CPUCACHED) == 0 || mCPUData == nullptr)
+		{
+			LOGERR("Attempting to generate a BVH for a mesh that is created without CPU caching.");
+			return;
+		}
+
+		mBVH = MeshBVH::create(*mCPUData);
+	}
+
+	std::pair<bool, float> Mesh::rayCast(const Ray& ray, UINT32* outTriangleIdx) const
+	{
+		if (mBVH != nullptr)
+			return mBVH->rayCast(ray, outTriangleIdx);
+
+		if (mCPUData != nullptr)
+			return mCPUData->rayCast(ray, outTriangleIdx);
+
+		return std::make_pair(false, 0.0f);
+	}
+
 	void Mesh::createCPUBuffer()
 	{
 		mCPUData = allocBuffer();
@@ -293,17 +325,70 @@ namespace bs
 
 	namespace ct
 	{
+	/** GPU buffers shared by meshes created from byte-identical data, tracked through a content-hash registry. */
+	struct SharedMeshBuffers
+	{
+		std::weak_ptr<VertexData> vertexData;
+		std::weak_ptr<IndexBuffer> indexBuffer;
+		UINT32 bufferSize = 0;
+	};
+
+	/**
+	 * Maps mesh content hashes to the GPU buffers created for them, so meshes created from identical data can share a
+	 * single GPU allocation. Entries hold weak references only and get replaced once all sharing meshes are destroyed.
+	 *
+	 * @note	Core thread only.
+	 */
+	static UnorderedMap<size_t, SharedMeshBuffers> gSharedMeshBufferRegistry;
+
+	/**
+	 * Computes a hash over the provided mesh contents, as well as the structural properties determining the layout of
+	 * the GPU buffers created from it. Two meshes with equal hashes can share the same GPU buffers. Note the (remote)
+	 * possibility of a 64-bit hash collision is accepted here - mixing the structural fields into the data hash makes
+	 * an undetected collision between real mesh assets exceedingly unlikely.
+	 */
+	static size_t computeMeshContentHash(const MeshData& meshData, const SPtr<VertexDataDesc>& vertexDesc,
+		IndexType indexType, GpuDeviceFlags deviceMask)
+	{
+		size_t hash = (size_t)bs_hash_data(meshData.getData(), meshData.getSize());
+
+		hash_combine(hash, meshData.getNumVertices());
+		hash_combine(hash, meshData.getNumIndices());
+		hash_combine(hash, (UINT32)indexType);
+		hash_combine(hash, (UINT32)deviceMask);
+
+		UINT32 numElements = vertexDesc->getNumElements();
+		hash_combine(hash, numElements);
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			hash_combine(hash, (UINT32)element.getType());
+			hash_combine(hash, (UINT32)element.getSemantic());
+			hash_combine(hash, (UINT32)element.getSemanticIdx());
+			hash_combine(hash, (UINT32)element.getStreamIdx());
+		}
+
+		return hash;
+	}
+
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc, GpuDeviceFlags deviceMask)
 		: MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr)
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType), mDeviceMask(deviceMask)
 		, mTempInitialMeshData(initialMeshData), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 
-	{ }
+	{
+		mProperties.mLodSubMeshes = desc.lodSubMeshes;
+		mProperties.mLodScreenSizes = desc.lodScreenSizes;
+	}
 
 	Mesh::~Mesh()
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		if (mSharedBufferSize > 0)
+			RenderStats::instance().subMeshSharedMem(mSharedBufferSize);
+
 		mVertexData = nullptr;
 		mIndexBuffer = nullptr;
 		mVertexDesc = nullptr;
@@ -317,6 +402,40 @@ namespace bs
 		bool isDynamic = (mUsage & MU_DYNAMIC) != 0;
 		int usage = isDynamic ? GBU_DYNAMIC : GBU_STATIC;
 
+		// Static meshes created from initial data can share GPU buffers with byte-identical meshes (common when
+		// modular assets get re-exported into many separate files)
+		bool canShareBuffers = !isDynamic && mTempInitialMeshData != nullptr;
+		size_t contentHash = 0;
+		if (canShareBuffers)
+		{
+			contentHash = computeMeshContentHash(*mTempInitialMeshData, mVertexDesc, mIndexType, mDeviceMask);
+
+			auto iterFind = gSharedMeshBufferRegistry.find(contentHash);
+			if (iterFind != gSharedMeshBufferRegistry.end())
+			{
+				SPtr<VertexData> sharedVertexData = iterFind->second.vertexData.lock();
+				SPtr<IndexBuffer> sharedIndexBuffer = iterFind->second.indexBuffer.lock();
+
+				if (sharedVertexData != nullptr && sharedIndexBuffer != nullptr)
+				{
+					mVertexData = sharedVertexData;
+					mIndexBuffer = sharedIndexBuffer;
+					mSharedBufferSize = iterFind->second.bufferSize;
+
+					RenderStats::instance().addMeshSharedMem(mSharedBufferSize);
+
+					updateBounds(*mTempInitialMeshData);
+					mTempInitialMeshData = nullptr;
+
+					MeshBase::initialize();
+					return;
+				}
+
+				// All meshes that shared the buffers have been destroyed, reclaim the entry below
+				gSharedMeshBufferRegistry.erase(iterFind);
+			}
+		}
+
 		INDEX_BUFFER_DESC ibDesc;
 		ibDesc.indexType = mIndexType;
 		ibDesc.numIndices = mProperties.mNumIndices;
@@ -350,9 +469,65 @@ namespace bs
 			mTempInitialMeshData = nullptr;
 		}
 
+		if (canShareBuffers)
+		{
+			UINT32 bufferSize = mIndexBuffer->getSize();
+			for (auto& entry : mVertexData->getBuffers())
+				bufferSize += entry.second->getSize();
+
+			SharedMeshBuffers sharedEntry;
+			sharedEntry.vertexData = mVertexData;
+			sharedEntry.indexBuffer = mIndexBuffer;
+			sharedEntry.bufferSize = bufferSize;
+
+			gSharedMeshBufferRegistry[contentHash] = sharedEntry;
+		}
+
 		MeshBase::initialize();
 	}
 
+	void Mesh::detachSharedBuffers()
+	{
+		if (mSharedBufferSize == 0)
+			return;
+
+		// Replace the shared buffers with private copies, preserving current contents in case the caller only
+		// overwrites part of them
+		INDEX_BUFFER_DESC ibDesc;
+		ibDesc.indexType = mIndexType;
+		ibDesc.numIndices = mProperties.mNumIndices;
+		ibDesc.usage = GBU_STATIC;
+
+		SPtr<IndexBuffer> indexBuffer = IndexBuffer::create(ibDesc, mDeviceMask);
+		indexBuffer->copyData(*mIndexBuffer);
+
+		SPtr<VertexData> vertexData = bs_shared_ptr_new<VertexData>();
+		vertexData->vertexCount = mProperties.mNumVertices;
+		vertexData->vertexDeclaration = mVertexData->vertexDeclaration;
+
+		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+		{
+			if (!mVertexDesc->hasStream(i))
+				continue;
+
+			VERTEX_BUFFER_DESC vbDesc;
+			vbDesc.vertexSize = vertexData->vertexDeclaration->getProperties().getVertexSize(i);
+			vbDesc.numVerts = vertexData->vertexCount;
+			vbDesc.usage = GBU_STATIC;
+
+			SPtr<VertexBuffer> vertexBuffer = VertexBuffer::create(vbDesc, mDeviceMask);
+			vertexBuffer->copyData(*mVertexData->getBuffer(i));
+
+			vertexData->setBuffer(i, vertexBuffer);
+		}
+
+		mIndexBuffer = indexBuffer;
+		mVertexData = vertexData;
+
+		RenderStats::instance().subMeshSharedMem(mSharedBufferSize);
+		mSharedBufferSize = 0;
+	}
+
 	SPtr<VertexData> Mesh::getVertexData() const
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -378,6 +553,9 @@ namespace bs
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		// Writes may not affect other meshes sharing the same buffers
+		detachSharedBuffers();
+
 		if (discardEntireBuffer)
 		{
 			if ((mUsage & MU_STATIC) != 0)
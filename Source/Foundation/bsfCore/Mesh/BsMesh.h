@@ -39,6 +39,16 @@ namespace bs
 		 */
 		Vector<SubMesh> subMeshes;
 
+		/**
+		 * Optional sub-meshes of lower level of detail versions of the mesh geometry, grouped by level. Must contain
+		 * (number of LOD levels - 1) * subMeshes.size() entries. All levels share the mesh vertex buffers and only
+		 * differ in the index range they cover.
+		 */
+		Vector<SubMesh> lodSubMeshes;
+
+		/** Screen size thresholds, one per level in @p lodSubMeshes. See MeshProperties::getLodScreenSize(). */
+		Vector<float> lodScreenSizes;
+
 		/** Optimizes performance depending on planned usage of the mesh. */
 		INT32 usage = MU_STATIC; 
 
@@ -125,6 +135,37 @@ namespace bs
 		BS_SCRIPT_EXPORT(pr:getter,n:MorphShapes)
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/**
+		 * Returns the bounding volume hierarchy usable for accelerated ray casts against the mesh triangles, if one is
+		 * available. Built during import when enabled through mesh import options, or manually via generateBVH(), and
+		 * serialized with the mesh.
+		 */
+		SPtr<MeshBVH> getBVH() const { return mBVH; }
+
+		/**
+		 * Builds a bounding volume hierarchy over the mesh triangles, speeding up subsequent rayCast() calls. Requires
+		 * CPU cached mesh data, meaning the mesh must have been created with MU_CPUCACHED usage. Does nothing if a
+		 * hierarchy already exists. Normally the hierarchy is built during import instead, where mesh data is available
+		 * regardless of usage flags.
+		 */
+		void generateBVH();
+
+		/**
+		 * Casts a ray against the triangles of the mesh, in mesh local space. Uses the bounding volume hierarchy if one
+		 * is available, and otherwise falls back to iterating all triangles of the CPU cached mesh data. Returns no
+		 * intersection if neither is available.
+		 *
+		 * @param[in]	ray				Ray to cast, in mesh local space.
+		 * @param[out]	outTriangleIdx	If not null and an intersection is found, receives the index of the intersected
+		 *								triangle.
+		 * @return						Boolean result if an intersection happened and distance to the nearest
+		 *								intersection point.
+		 */
+		std::pair<bool, float> rayCast(const Ray& ray, UINT32* outTriangleIdx = nullptr) const;
+
+		/** Sets the bounding volume hierarchy to be used for ray casts against the mesh. For internal use. */
+		void _setBVH(const SPtr<MeshBVH>& bvh) { mBVH = bvh; }
+
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<ct::Mesh> getCore() const;
 
@@ -160,6 +201,7 @@ namespace bs
 		IndexType mIndexType;
 		SPtr<Skeleton> mSkeleton; // Immutable
 		SPtr<MorphShapes> mMorphShapes; // Immutable
+		SPtr<MeshBVH> mBVH;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -386,8 +428,15 @@ namespace bs
 		/** Updates bounds by calculating them from the vertices in the provided mesh data object. */
 		void updateBounds(const MeshData& meshData);
 
+		/**
+		 * If the mesh currently shares its GPU buffers with other meshes of identical content, replaces them with a
+		 * private copy so the mesh can be written to without affecting the others. Does nothing otherwise.
+		 */
+		void detachSharedBuffers();
+
 		SPtr<VertexData> mVertexData;
 		SPtr<IndexBuffer> mIndexBuffer;
+		UINT32 mSharedBufferSize = 0;
 
 		SPtr<VertexDataDesc> mVertexDesc;
 		int mUsage;
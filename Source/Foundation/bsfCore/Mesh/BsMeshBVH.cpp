@@ -0,0 +1,231 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Mesh/BsMeshBVH.h"
+#include "Mesh/BsMeshData.h"
+#include "Private/RTTI/BsMeshBVHRTTI.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Math/BsAABox.h"
+
+namespace bs
+{
+	namespace
+	{
+		/** Triangle information gathered before the hierarchy is built. */
+		struct BuildTriangle
+		{
+			Vector3 corners[3];
+			Vector3 centroid;
+			UINT32 sourceIdx;
+		};
+
+		/** Range of triangles a node is built over, used on the build stack. */
+		struct BuildEntry
+		{
+			UINT32 nodeIdx;
+			UINT32 start;
+			UINT32 count;
+		};
+	}
+
+	SPtr<MeshBVH> MeshBVH::create(const MeshData& meshData)
+	{
+		UINT32 numTriangles = meshData.getNumIndices() / 3;
+		if (numTriangles == 0)
+			return nullptr;
+
+		// Find a position element to read triangle corners from
+		UINT8* positionData = nullptr;
+		UINT32 positionStride = 0;
+
+		SPtr<VertexDataDesc> vertexDesc = meshData.getVertexDesc();
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& curElement = vertexDesc->getElement(i);
+
+			if (curElement.getSemantic() != VES_POSITION || (curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+				continue;
+
+			positionData = meshData.getElementData(curElement.getSemantic(), curElement.getSemanticIdx(),
+				curElement.getStreamIdx());
+			positionStride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+			break;
+		}
+
+		if (positionData == nullptr)
+			return nullptr;
+
+		auto readPosition = [positionData, positionStride](UINT32 vertexIdx)
+		{
+			return *(Vector3*)(positionData + positionStride * vertexIdx);
+		};
+
+		Vector<BuildTriangle> triangles(numTriangles);
+
+		UINT16* indices16 = meshData.getIndexType() == IT_16BIT ? meshData.getIndices16() : nullptr;
+		UINT32* indices32 = meshData.getIndexType() == IT_32BIT ? meshData.getIndices32() : nullptr;
+
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			BuildTriangle& triangle = triangles[i];
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = indices16 != nullptr ? indices16[i * 3 + j] : indices32[i * 3 + j];
+				triangle.corners[j] = readPosition(vertexIdx);
+			}
+
+			triangle.centroid = (triangle.corners[0] + triangle.corners[1] + triangle.corners[2]) / 3.0f;
+			triangle.sourceIdx = i;
+		}
+
+		SPtr<MeshBVH> bvh = bs_shared_ptr_new<MeshBVH>();
+		bvh->mNodes.reserve(numTriangles * 2);
+
+		// Top-down median split over the longest centroid axis, with an explicit stack
+		Stack<BuildEntry> todo;
+
+		bvh->mNodes.push_back(Node());
+		todo.push({ 0, 0, numTriangles });
+
+		while (!todo.empty())
+		{
+			BuildEntry entry = todo.top();
+			todo.pop();
+
+			Vector3 boundsMin = triangles[entry.start].corners[0];
+			Vector3 boundsMax = boundsMin;
+			Vector3 centroidMin = triangles[entry.start].centroid;
+			Vector3 centroidMax = centroidMin;
+
+			for (UINT32 i = entry.start; i < entry.start + entry.count; i++)
+			{
+				const BuildTriangle& triangle = triangles[i];
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					boundsMin = Vector3::min(boundsMin, triangle.corners[j]);
+					boundsMax = Vector3::max(boundsMax, triangle.corners[j]);
+				}
+
+				centroidMin = Vector3::min(centroidMin, triangle.centroid);
+				centroidMax = Vector3::max(centroidMax, triangle.centroid);
+			}
+
+			Node& node = bvh->mNodes[entry.nodeIdx];
+			node.boundsMin = boundsMin;
+			node.boundsMax = boundsMax;
+
+			Vector3 centroidExtent = centroidMax - centroidMin;
+			UINT32 splitAxis = 0;
+			if (centroidExtent.y > centroidExtent.x)
+				splitAxis = 1;
+			if (centroidExtent.z > centroidExtent[splitAxis])
+				splitAxis = 2;
+
+			// Emit a leaf when small enough, or when all centroids coincide and no split is possible
+			if (entry.count <= MAX_LEAF_TRIANGLES || centroidExtent[splitAxis] <= 0.0f)
+			{
+				node.start = (UINT32)bvh->mTriangleIndices.size();
+				node.count = entry.count;
+
+				for (UINT32 i = entry.start; i < entry.start + entry.count; i++)
+				{
+					const BuildTriangle& triangle = triangles[i];
+					for (UINT32 j = 0; j < 3; j++)
+						bvh->mTrianglePositions.push_back(triangle.corners[j]);
+
+					bvh->mTriangleIndices.push_back(triangle.sourceIdx);
+				}
+
+				continue;
+			}
+
+			UINT32 mid = entry.start + entry.count / 2;
+			std::nth_element(triangles.begin() + entry.start, triangles.begin() + mid,
+				triangles.begin() + entry.start + entry.count,
+				[splitAxis](const BuildTriangle& a, const BuildTriangle& b)
+			{
+				return a.centroid[splitAxis] < b.centroid[splitAxis];
+			});
+
+			UINT32 childIdx = (UINT32)bvh->mNodes.size();
+			bvh->mNodes[entry.nodeIdx].start = childIdx;
+			bvh->mNodes[entry.nodeIdx].count = 0;
+
+			bvh->mNodes.push_back(Node());
+			bvh->mNodes.push_back(Node());
+
+			todo.push({ childIdx, entry.start, mid - entry.start });
+			todo.push({ childIdx + 1, mid, entry.start + entry.count - mid });
+		}
+
+		return bvh;
+	}
+
+	std::pair<bool, float> MeshBVH::rayCast(const Ray& ray, UINT32* outTriangleIdx) const
+	{
+		if (mNodes.empty())
+			return std::make_pair(false, 0.0f);
+
+		bool hit = false;
+		float nearestDist = std::numeric_limits<float>::max();
+		UINT32 nearestTriangle = 0;
+
+		Stack<UINT32> todo;
+		todo.push(0);
+
+		while (!todo.empty())
+		{
+			const Node& node = mNodes[todo.top()];
+			todo.pop();
+
+			auto boundsResult = ray.intersects(AABox(node.boundsMin, node.boundsMax));
+			if (!boundsResult.first || boundsResult.second >= nearestDist)
+				continue;
+
+			if (node.count == 0)
+			{
+				todo.push(node.start);
+				todo.push(node.start + 1);
+				continue;
+			}
+
+			for (UINT32 i = node.start; i < node.start + node.count; i++)
+			{
+				const Vector3& a = mTrianglePositions[i * 3 + 0];
+				const Vector3& b = mTrianglePositions[i * 3 + 1];
+				const Vector3& c = mTrianglePositions[i * 3 + 2];
+
+				Vector3 normal = (b - a).cross(c - a);
+				auto triangleResult = ray.intersects(a, b, c, normal);
+
+				if (triangleResult.first && triangleResult.second < nearestDist)
+				{
+					hit = true;
+					nearestDist = triangleResult.second;
+					nearestTriangle = mTriangleIndices[i];
+				}
+			}
+		}
+
+		if (!hit)
+			return std::make_pair(false, 0.0f);
+
+		if (outTriangleIdx != nullptr)
+			*outTriangleIdx = nearestTriangle;
+
+		return std::make_pair(true, nearestDist);
+	}
+
+	/************************************************************************/
+	/* 								SERIALIZATION                      		*/
+	/************************************************************************/
+
+	RTTITypeBase* MeshBVH::getRTTIStatic()
+	{
+		return MeshBVHRTTI::instance();
+	}
+
+	RTTITypeBase* MeshBVH::getRTTI() const
+	{
+		return MeshBVH::getRTTIStatic();
+	}
+}
@@ -0,0 +1,87 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsIReflectable.h"
+#include "Math/BsVector3.h"
+#include "Math/BsRay.h"
+
+namespace bs
+{
+	/** @addtogroup Mesh-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy built over the triangles of a mesh, allowing triangle-accurate ray casts against large
+	 * meshes without iterating every triangle. The hierarchy is stored as flat arrays with no internal pointers, so it
+	 * serializes with the mesh resource as-is and requires no fix-up on load. Triangle positions are stored within the
+	 * hierarchy itself, meaning queries don't require CPU cached mesh data to be available.
+	 */
+	class BS_CORE_EXPORT MeshBVH : public IReflectable
+	{
+	public:
+		/** Single node of the hierarchy. Leaf nodes reference a range of triangles, inner nodes their two children. */
+		struct Node
+		{
+			Vector3 boundsMin = Vector3::ZERO;
+			Vector3 boundsMax = Vector3::ZERO;
+
+			/** Index of the first triangle if a leaf, or index of the first of two adjacent child nodes otherwise. */
+			UINT32 start = 0;
+
+			/** Number of triangles in the leaf, or zero if an inner node. */
+			UINT32 count = 0;
+		};
+
+		MeshBVH() = default;
+
+		/**
+		 * Casts a ray against the triangles of the hierarchy.
+		 *
+		 * @param[in]	ray				Ray to cast, in the same space the mesh vertices are in (usually mesh local
+		 *								space - transform the ray rather than the mesh for world space queries).
+		 * @param[out]	outTriangleIdx	If not null and an intersection is found, receives the index of the intersected
+		 *								triangle as defined by the source mesh index buffer ordering.
+		 * @return						Boolean result if an intersection happened and distance to the nearest
+		 *								intersection point.
+		 */
+		std::pair<bool, float> rayCast(const Ray& ray, UINT32* outTriangleIdx = nullptr) const;
+
+		/** Returns the number of triangles the hierarchy was built over. */
+		UINT32 getNumTriangles() const { return (UINT32)mTriangleIndices.size(); }
+
+		/**
+		 * Builds a new hierarchy over the triangles of the provided mesh data. Assumes the index buffer represents a
+		 * triangle list. Returns null if the mesh data contains no triangles or no position element.
+		 */
+		static SPtr<MeshBVH> create(const MeshData& meshData);
+
+	private:
+		/** Number of triangles at which subdivision stops and a leaf is emitted. */
+		static constexpr UINT32 MAX_LEAF_TRIANGLES = 4;
+
+		Vector<Node> mNodes;
+
+		/** Triangle corner positions, three entries per triangle, ordered as referenced by leaf nodes. */
+		Vector<Vector3> mTrianglePositions;
+
+		/** Maps the hierarchy's triangle ordering back to source index buffer triangle indices. */
+		Vector<UINT32> mTriangleIndices;
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class MeshBVHRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+
+	/** @cond SPECIALIZATIONS */
+	BS_ALLOW_MEMCPY_SERIALIZATION(MeshBVH::Node);
+	/** @endcond */
+}
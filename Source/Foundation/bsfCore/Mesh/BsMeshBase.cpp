@@ -40,6 +40,34 @@ namespace bs
 		return (UINT32)mSubMeshes.size();
 	}
 
+	UINT32 MeshProperties::getNumLodLevels() const
+	{
+		return 1 + (UINT32)mLodScreenSizes.size();
+	}
+
+	const SubMesh& MeshProperties::getLodSubMesh(UINT32 subMeshIdx, UINT32 lodLevel) const
+	{
+		if (lodLevel == 0)
+			return getSubMesh(subMeshIdx);
+
+		UINT32 entryIdx = (lodLevel - 1) * (UINT32)mSubMeshes.size() + subMeshIdx;
+		if (lodLevel >= getNumLodLevels() || subMeshIdx >= mSubMeshes.size() || entryIdx >= mLodSubMeshes.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid LOD sub-mesh index: " + toString(subMeshIdx) + ", level: "
+				+ toString(lodLevel) + ". Number of levels available: " + toString(getNumLodLevels()));
+		}
+
+		return mLodSubMeshes[entryIdx];
+	}
+
+	float MeshProperties::getLodScreenSize(UINT32 lodLevel) const
+	{
+		if (lodLevel == 0 || lodLevel >= getNumLodLevels())
+			return 1.0f;
+
+		return mLodScreenSizes[lodLevel - 1];
+	}
+
 	MeshBase::MeshBase(UINT32 numVertices, UINT32 numIndices, DrawOperationType drawOp)
 		:mProperties(numVertices, numIndices, drawOp)
 	{ }
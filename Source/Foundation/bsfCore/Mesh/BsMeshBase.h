@@ -48,6 +48,26 @@ namespace bs
 		/** Retrieves a total number of sub-meshes in this mesh. */
 		UINT32 getNumSubMeshes() const;
 
+		/**
+		 * Returns the number of levels in the mesh's level of detail chain. Always at least one, representing the base
+		 * (most detailed) geometry.
+		 */
+		UINT32 getNumLodLevels() const;
+
+		/**
+		 * Retrieves the sub-mesh to use for rendering a certain portion of the mesh at the specified level of detail.
+		 * Level zero returns the base sub-mesh. All levels reference the same vertex buffers and only differ in the
+		 * index range they cover.
+		 */
+		const SubMesh& getLodSubMesh(UINT32 subMeshIdx, UINT32 lodLevel) const;
+
+		/**
+		 * Returns the screen size threshold for the specified level of detail, as a fraction of the view height. The
+		 * level is meant to be used for rendering once the projected size of the mesh bounds falls below the threshold
+		 * of the previous level. Level zero has no threshold and always returns 1.
+		 */
+		float getLodScreenSize(UINT32 lodLevel) const;
+
 		/**	Returns maximum number of vertices the mesh may store. */
 		UINT32 getNumVertices() const { return mNumVertices; }
 
@@ -67,6 +87,8 @@ namespace bs
 		friend class MeshBaseRTTI;
 
 		Vector<SubMesh> mSubMeshes;
+		Vector<SubMesh> mLodSubMeshes; /**< Sub-meshes of the LOD levels beyond the base level, grouped by level. */
+		Vector<float> mLodScreenSizes; /**< Screen size thresholds, one per LOD level beyond the base level. */
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		Bounds mBounds;
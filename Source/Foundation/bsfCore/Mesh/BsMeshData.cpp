@@ -57,6 +57,19 @@ namespace bs
 		return getIndexBufferSize() + getStreamSize();
 	}
 
+	SPtr<MeshData> MeshData::createView(UINT32 numVertices, UINT32 numIndexes, const SPtr<VertexDataDesc>& vertexData,
+		UINT8* data, SPtr<const void> lifetimeToken, IndexType indexType)
+	{
+		SPtr<MeshData> meshData = bs_shared_ptr<MeshData>(new (bs_alloc<MeshData>()) MeshData());
+		meshData->mNumVertices = numVertices;
+		meshData->mNumIndices = numIndexes;
+		meshData->mIndexType = indexType;
+		meshData->mVertexData = vertexData;
+		meshData->setExternalBuffer(data, std::move(lifetimeToken));
+
+		return meshData;
+	}
+
 	// TODO - This doesn't handle the case where multiple elements in same slot have different data types
 	SPtr<MeshData> MeshData::combine(const Vector<SPtr<MeshData>>& meshes, const Vector<Vector<SubMesh>>& allSubMeshes, 
 		Vector<SubMesh>& subMeshes)
@@ -402,6 +415,65 @@ namespace bs
 		return bounds;
 	}
 
+	std::pair<bool, float> MeshData::rayCast(const Ray& ray, UINT32* outTriangleIdx) const
+	{
+		// Find a position element to read triangle corners from
+		UINT8* positionData = nullptr;
+		UINT32 positionStride = 0;
+
+		SPtr<VertexDataDesc> vertexDesc = getVertexDesc();
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& curElement = vertexDesc->getElement(i);
+
+			if (curElement.getSemantic() != VES_POSITION || (curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+				continue;
+
+			positionData = getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), curElement.getStreamIdx());
+			positionStride = vertexDesc->getVertexStride(curElement.getStreamIdx());
+			break;
+		}
+
+		if (positionData == nullptr)
+			return std::make_pair(false, 0.0f);
+
+		UINT16* indices16 = mIndexType == IT_16BIT ? getIndices16() : nullptr;
+		UINT32* indices32 = mIndexType == IT_32BIT ? getIndices32() : nullptr;
+
+		bool hit = false;
+		float nearestDist = std::numeric_limits<float>::max();
+		UINT32 nearestTriangle = 0;
+
+		UINT32 numTriangles = getNumIndices() / 3;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			Vector3 corners[3];
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = indices16 != nullptr ? indices16[i * 3 + j] : indices32[i * 3 + j];
+				corners[j] = *(Vector3*)(positionData + positionStride * vertexIdx);
+			}
+
+			Vector3 normal = (corners[1] - corners[0]).cross(corners[2] - corners[0]);
+			auto result = ray.intersects(corners[0], corners[1], corners[2], normal);
+
+			if (result.first && result.second < nearestDist)
+			{
+				hit = true;
+				nearestDist = result.second;
+				nearestTriangle = i;
+			}
+		}
+
+		if (!hit)
+			return std::make_pair(false, 0.0f);
+
+		if (outTriangleIdx != nullptr)
+			*outTriangleIdx = nearestTriangle;
+
+		return std::make_pair(true, nearestDist);
+	}
+
 	/************************************************************************/
 	/* 								SERIALIZATION                      		*/
 	/************************************************************************/
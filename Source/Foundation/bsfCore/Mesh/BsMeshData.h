@@ -9,6 +9,7 @@
 #include "RenderAPI/BsVertexDeclaration.h"
 #include "RenderAPI/BsSubMesh.h"
 #include "Math/BsBounds.h"
+#include "Math/BsRay.h"
 
 namespace bs
 {
@@ -214,6 +215,19 @@ namespace bs
 		/**	Calculates the bounds of all vertices stored in the internal buffer. */
 		Bounds calculateBounds() const;
 
+		/**
+		 * Casts a ray against every triangle in the internal buffer, assuming the indices represent a triangle list.
+		 * The ray is expected in the same space the vertices are in. Iterates all triangles - for repeated queries on
+		 * large meshes prefer a MeshBVH.
+		 *
+		 * @param[in]	ray				Ray to cast.
+		 * @param[out]	outTriangleIdx	If not null and an intersection is found, receives the index of the intersected
+		 *								triangle.
+		 * @return						Boolean result if an intersection happened and distance to the nearest
+		 *								intersection point.
+		 */
+		std::pair<bool, float> rayCast(const Ray& ray, UINT32* outTriangleIdx = nullptr) const;
+
 		/**
 		 * Combines a number of submeshes and their mesh data into one large mesh data buffer.
 		 *
@@ -233,12 +247,30 @@ namespace bs
 		 * Constructs a new object that can hold number of vertices described by the provided vertex data description. As 
 		 * well as a number of indices of the provided type.
 		 */
-		static SPtr<MeshData> create(UINT32 numVertices, UINT32 numIndexes, const SPtr<VertexDataDesc>& vertexData, 
+		static SPtr<MeshData> create(UINT32 numVertices, UINT32 numIndexes, const SPtr<VertexDataDesc>& vertexData,
 			IndexType indexType = IT_32BIT)
 		{
 			return bs_shared_ptr_new<MeshData>(numVertices, numIndexes, vertexData, indexType);
 		}
 
+		/**
+		 * Constructs a new object that wraps externally owned memory instead of allocating an internal buffer. No data
+		 * is copied. The memory must already be laid out the way an equivalent internally allocated buffer would be
+		 * (vertex streams followed by the index buffer).
+		 *
+		 * @param[in]	numVertices		Number of vertices the buffer holds.
+		 * @param[in]	numIndexes		Number of indices the buffer holds.
+		 * @param[in]	vertexData		Description of the vertex layout.
+		 * @param[in]	data			Externally owned memory to wrap, of at least the size reported by
+		 *								getInternalBufferSize() for the provided parameters.
+		 * @param[in]	lifetimeToken	Shared pointer that keeps @p data alive for as long as the returned object (or
+		 *								any copy of it) references the memory. See
+		 *								GpuResourceData::setExternalBuffer(UINT8*, SPtr<const void>).
+		 * @param[in]	indexType		Type of the indices in the buffer.
+		 */
+		static SPtr<MeshData> createView(UINT32 numVertices, UINT32 numIndexes, const SPtr<VertexDataDesc>& vertexData,
+			UINT8* data, SPtr<const void> lifetimeToken, IndexType indexType = IT_32BIT);
+
 	protected:
 		/**	Returns the size of the internal buffer in bytes. */
 		UINT32 getInternalBufferSize() const override;
@@ -81,15 +81,17 @@ namespace bs
 	namespace ct
 	{
 	const float MeshHeap::GrowPercent = 1.5f;
+	const UINT32 MeshHeap::DefragMovesPerAlloc = 2;
 
 	MeshHeap::MeshHeap(UINT32 numVertices, UINT32 numIndices,
 		const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType, GpuDeviceFlags deviceMask)
-		: mNumVertices(numVertices), mNumIndices(numIndices), mCPUIndexData(nullptr), mVertexDesc(vertexDesc)
-		, mIndexType(indexType), mDeviceMask(deviceMask), mNextQueryId(0)
+		: mNumVertices(numVertices), mNumIndices(numIndices), mCPUIndexData(nullptr), mCPUIndexDataSize(0)
+		, mVertexDesc(vertexDesc), mIndexType(indexType), mDeviceMask(deviceMask), mNextQueryId(0), mNextRegionId(0)
 	{
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
 			mCPUVertexData.push_back(nullptr);
+			mCPUVertexDataSizes.push_back(0);
 		}
 	}
 
@@ -97,11 +99,14 @@ namespace bs
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
-		for (auto& cpuVertBuffer : mCPUVertexData)
-			bs_free(cpuVertBuffer);
+		for (UINT32 i = 0; i < (UINT32)mCPUVertexData.size(); i++)
+		{
+			if (mCPUVertexData[i] != nullptr)
+				bs_free_large(mCPUVertexData[i], mCPUVertexDataSizes[i]);
+		}
 
 		if (mCPUIndexData != nullptr)
-			bs_free(mCPUIndexData);
+			bs_free_large(mCPUIndexData, mCPUIndexDataSize);
 
 		mVertexData = nullptr;
 		mIndexBuffer = nullptr;
@@ -120,6 +125,12 @@ namespace bs
 
 	void MeshHeap::alloc(SPtr<TransientMesh> mesh, const SPtr<MeshData>& meshData)
 	{
+		// Opportunistically compact free memory, a little bit at a time. Only a single batch of moves may be in
+		// flight, which throttles the compaction to the rate at which the GPU confirms it is done with the moved
+		// regions.
+		if (mPendingFreeRegions.empty())
+			defragmentStep(DefragMovesPerAlloc);
+
 		// Find free vertex chunk and grow if needed
 		UINT32 smallestVertFit = 0;
 		UINT32 smallestVertFitIdx = 0;
@@ -358,6 +369,8 @@ namespace bs
 
 	void MeshHeap::growVertexBuffer(UINT32 numVertices)
 	{
+		SPtr<VertexData> oldVertexData = mVertexData;
+
 		mNumVertices = numVertices;
 		mVertexData = SPtr<VertexData>(bs_new<VertexData>());
 
@@ -380,13 +393,16 @@ namespace bs
 			SPtr<VertexBuffer> vertexBuffer = VertexBuffer::create(desc, mDeviceMask);
 			mVertexData->setBuffer(i, vertexBuffer);
 
-			// Copy all data to the new buffer
+			// Copy all data to the new buffer. Staging copies are megabytes in size and scanned in bulk, so they get
+			// backed by large pages where the platform supports it.
 			UINT8* oldBuffer = mCPUVertexData[i];
-			UINT8* buffer = (UINT8*)bs_alloc(vertSize * numVertices);
+			UINT8* buffer = (UINT8*)bs_alloc_large(vertSize * numVertices);
 
 			UINT32 destOffset = 0;
 			if (oldBuffer != nullptr)
 			{
+				SPtr<VertexBuffer> oldVertexBuffer = oldVertexData->getBuffer(i);
+
 				for (auto& allocData : mMeshAllocData)
 				{
 					ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
@@ -394,16 +410,19 @@ namespace bs
 					UINT8* oldData = oldBuffer + oldChunk.start * vertSize;
 					memcpy(buffer + destOffset * vertSize, oldData, oldChunk.size * vertSize);
 
+					// Migrate the data between the buffers directly on the GPU, avoiding a re-upload of the
+					// entire heap from the CPU
+					vertexBuffer->copyData(*oldVertexBuffer, oldChunk.start * vertSize, destOffset * vertSize,
+						oldChunk.size * vertSize);
+
 					destOffset += oldChunk.size;
 				}
 
-				bs_free(oldBuffer);
+				bs_free_large(oldBuffer, mCPUVertexDataSizes[i]);
 			}
 
-			if (destOffset > 0)
-				vertexBuffer->writeData(0, destOffset * vertSize, buffer, BTW_NO_OVERWRITE);
-
 			mCPUVertexData[i] = buffer;
+			mCPUVertexDataSizes[i] = vertSize * numVertices;
 		}
 
 		// Reorder chunks
@@ -441,10 +460,15 @@ namespace bs
 
 		while (!mEmptyVertChunks.empty())
 			mEmptyVertChunks.pop();
+
+		// Regions pending a free reference the old chunk layout, and the space they guard wasn't carried over
+		discardPendingRegions(true);
 	}
 
 	void MeshHeap::growIndexBuffer(UINT32 numIndices)
 	{
+		SPtr<IndexBuffer> oldIndexBuffer = mIndexBuffer;
+
 		mNumIndices = numIndices;
 
 		INDEX_BUFFER_DESC ibDesc;
@@ -460,7 +484,7 @@ namespace bs
 		UINT32 idxSize = ibProps.getIndexSize();
 
 		UINT8* oldBuffer = mCPUIndexData;
-		UINT8* buffer = (UINT8*)bs_alloc(idxSize * numIndices);
+		UINT8* buffer = (UINT8*)bs_alloc_large(idxSize * numIndices);
 
 		UINT32 destOffset = 0;
 		if (oldBuffer != nullptr)
@@ -472,16 +496,19 @@ namespace bs
 				UINT8* oldData = oldBuffer + oldChunk.start * idxSize;
 				memcpy(buffer + destOffset * idxSize, oldData, oldChunk.size * idxSize);
 
+				// Migrate the data between the buffers directly on the GPU, avoiding a re-upload of the
+				// entire heap from the CPU
+				mIndexBuffer->copyData(*oldIndexBuffer, oldChunk.start * idxSize, destOffset * idxSize,
+					oldChunk.size * idxSize);
+
 				destOffset += oldChunk.size;
 			}
 
-			bs_free(oldBuffer);
+			bs_free_large(oldBuffer, mCPUIndexDataSize);
 		}
 
-		if (destOffset > 0)
-			mIndexBuffer->writeData(0, destOffset * idxSize, buffer, BTW_NO_OVERWRITE);
-
 		mCPUIndexData = buffer;
+		mCPUIndexDataSize = idxSize * numIndices;
 
 		// Reorder chunks
 		destOffset = 0;
@@ -518,6 +545,9 @@ namespace bs
 
 		while (!mEmptyIdxChunks.empty())
 			mEmptyIdxChunks.pop();
+
+		// Regions pending a free reference the old chunk layout, and the space they guard wasn't carried over
+		discardPendingRegions(false);
 	}
 
 	UINT32 MeshHeap::createEventQuery()
@@ -637,7 +667,12 @@ namespace bs
 
 	void MeshHeap::mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx)
 	{
-		// Merge vertex chunks
+		mergeNearbyVertChunks(chunkVertIdx);
+		mergeNearbyIdxChunks(chunkIdxIdx);
+	}
+
+	void MeshHeap::mergeNearbyVertChunks(UINT32 chunkVertIdx)
+	{
 		ChunkData& vertChunk = mVertChunks[chunkVertIdx];
 		for (auto& freeChunkIdx : mFreeVertChunks)
 		{
@@ -672,8 +707,10 @@ namespace bs
 				mEmptyVertChunks.push(freeChunkIdx);
 			}
 		}
+	}
 
-		// Merge index chunks
+	void MeshHeap::mergeNearbyIdxChunks(UINT32 chunkIdxIdx)
+	{
 		ChunkData& idxChunk = mIdxChunks[chunkIdxIdx];
 		for (auto& freeChunkIdx : mFreeIdxChunks)
 		{
@@ -709,5 +746,234 @@ namespace bs
 			}
 		}
 	}
+
+	UINT32 MeshHeap::defragmentStep(UINT32 maxMoves)
+	{
+		Vector<UINT32> vacatedVertChunks;
+		Vector<UINT32> vacatedIdxChunks;
+
+		UINT32 numMoves = 0;
+		while (numMoves < maxMoves)
+		{
+			bool moved = false;
+
+			// Move a vertex chunk. Find the lowest positioned free chunk with any space remaining, then among the
+			// allocations positioned after it pick the last one that fits within it. Since the destination always
+			// precedes the source and the allocation fits in front of it, the two regions can never overlap.
+			{
+				UINT32 freeChunkIdx = (UINT32)-1;
+				for (auto& chunkIdx : mFreeVertChunks)
+				{
+					ChunkData& chunk = mVertChunks[chunkIdx];
+					if (chunk.size == 0)
+						continue;
+
+					if (freeChunkIdx == (UINT32)-1 || chunk.start < mVertChunks[freeChunkIdx].start)
+						freeChunkIdx = chunkIdx;
+				}
+
+				UINT32 meshChunkIdx = (UINT32)-1;
+				if (freeChunkIdx != (UINT32)-1)
+				{
+					ChunkData& freeChunk = mVertChunks[freeChunkIdx];
+					for (auto& entry : mMeshAllocData)
+					{
+						ChunkData& chunk = mVertChunks[entry.second.vertChunkIdx];
+						if (chunk.start <= freeChunk.start || chunk.size > freeChunk.size)
+							continue;
+
+						if (meshChunkIdx == (UINT32)-1 || chunk.start > mVertChunks[meshChunkIdx].start)
+							meshChunkIdx = entry.second.vertChunkIdx;
+					}
+				}
+
+				if (meshChunkIdx != (UINT32)-1)
+				{
+					UINT32 srcStart = mVertChunks[meshChunkIdx].start;
+					UINT32 dstStart = mVertChunks[freeChunkIdx].start;
+					UINT32 numElements = mVertChunks[meshChunkIdx].size;
+
+					for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
+					{
+						if (!mVertexDesc->hasStream(i))
+							continue;
+
+						UINT32 vertSize = mVertexData->vertexDeclaration->getProperties().getVertexSize(i);
+						SPtr<VertexBuffer> vertexBuffer = mVertexData->getBuffer(i);
+
+						vertexBuffer->copyData(*vertexBuffer, srcStart * vertSize, dstStart * vertSize,
+							numElements * vertSize);
+
+						memcpy(mCPUVertexData[i] + dstStart * vertSize, mCPUVertexData[i] + srcStart * vertSize,
+							numElements * vertSize);
+					}
+
+					// Vacated region may only be reused once the GPU is done with it, so track it in a
+					// separate chunk that isn't added to the free list just yet
+					ChunkData vacatedChunk;
+					vacatedChunk.start = srcStart;
+					vacatedChunk.size = numElements;
+
+					mVertChunks.push_back(vacatedChunk);
+					vacatedVertChunks.push_back((UINT32)(mVertChunks.size() - 1));
+
+					mVertChunks[meshChunkIdx].start = dstStart;
+					mVertChunks[freeChunkIdx].start = dstStart + numElements;
+					mVertChunks[freeChunkIdx].size -= numElements;
+
+					if (mVertChunks[freeChunkIdx].size == 0)
+					{
+						mVertChunks[freeChunkIdx].start = 0;
+						mEmptyVertChunks.push(freeChunkIdx);
+					}
+
+					moved = true;
+				}
+			}
+
+			// Move an index chunk, in the same manner
+			{
+				UINT32 freeChunkIdx = (UINT32)-1;
+				for (auto& chunkIdx : mFreeIdxChunks)
+				{
+					ChunkData& chunk = mIdxChunks[chunkIdx];
+					if (chunk.size == 0)
+						continue;
+
+					if (freeChunkIdx == (UINT32)-1 || chunk.start < mIdxChunks[freeChunkIdx].start)
+						freeChunkIdx = chunkIdx;
+				}
+
+				UINT32 meshChunkIdx = (UINT32)-1;
+				if (freeChunkIdx != (UINT32)-1)
+				{
+					ChunkData& freeChunk = mIdxChunks[freeChunkIdx];
+					for (auto& entry : mMeshAllocData)
+					{
+						ChunkData& chunk = mIdxChunks[entry.second.idxChunkIdx];
+						if (chunk.start <= freeChunk.start || chunk.size > freeChunk.size)
+							continue;
+
+						if (meshChunkIdx == (UINT32)-1 || chunk.start > mIdxChunks[meshChunkIdx].start)
+							meshChunkIdx = entry.second.idxChunkIdx;
+					}
+				}
+
+				if (meshChunkIdx != (UINT32)-1)
+				{
+					UINT32 srcStart = mIdxChunks[meshChunkIdx].start;
+					UINT32 dstStart = mIdxChunks[freeChunkIdx].start;
+					UINT32 numElements = mIdxChunks[meshChunkIdx].size;
+
+					UINT32 idxSize = mIndexBuffer->getProperties().getIndexSize();
+					mIndexBuffer->copyData(*mIndexBuffer, srcStart * idxSize, dstStart * idxSize,
+						numElements * idxSize);
+
+					memcpy(mCPUIndexData + dstStart * idxSize, mCPUIndexData + srcStart * idxSize,
+						numElements * idxSize);
+
+					ChunkData vacatedChunk;
+					vacatedChunk.start = srcStart;
+					vacatedChunk.size = numElements;
+
+					mIdxChunks.push_back(vacatedChunk);
+					vacatedIdxChunks.push_back((UINT32)(mIdxChunks.size() - 1));
+
+					mIdxChunks[meshChunkIdx].start = dstStart;
+					mIdxChunks[freeChunkIdx].start = dstStart + numElements;
+					mIdxChunks[freeChunkIdx].size -= numElements;
+
+					if (mIdxChunks[freeChunkIdx].size == 0)
+					{
+						mIdxChunks[freeChunkIdx].start = 0;
+						mEmptyIdxChunks.push(freeChunkIdx);
+					}
+
+					moved = true;
+				}
+			}
+
+			if (!moved)
+				break;
+
+			numMoves++;
+		}
+
+		if (vacatedVertChunks.empty() && vacatedIdxChunks.empty())
+			return 0;
+
+		// Guard all the vacated regions with a single query, since the GPU processes our copies in order
+		UINT32 regionId = mNextRegionId++;
+
+		PendingFreeRegions regions;
+		regions.vertChunks = std::move(vacatedVertChunks);
+		regions.idxChunks = std::move(vacatedIdxChunks);
+		regions.eventQueryIdx = createEventQuery();
+
+		SPtr<MeshHeap> thisPtr = std::static_pointer_cast<MeshHeap>(getThisPtr());
+
+		QueryData& queryData = mEventQueries[regions.eventQueryIdx];
+		queryData.queryId = mNextQueryId++;
+		queryData.query->onTriggered.clear();
+		queryData.query->onTriggered.connect(std::bind(&MeshHeap::defragRegionsFreed, thisPtr, regionId, queryData.queryId));
+		queryData.query->begin();
+
+		regions.queryId = queryData.queryId;
+		mPendingFreeRegions[regionId] = regions;
+
+		return numMoves;
+	}
+
+	// Note: Need to use a shared ptr here to ensure MeshHeap doesn't get deallocated sometime during this callback
+	void MeshHeap::defragRegionsFreed(SPtr<MeshHeap> thisPtr, UINT32 regionId, UINT32 queryId)
+	{
+		auto findIter = thisPtr->mPendingFreeRegions.find(regionId);
+		if (findIter == thisPtr->mPendingFreeRegions.end())
+			return; // Regions were discarded due to a buffer resize
+
+		PendingFreeRegions& regions = findIter->second;
+
+		QueryData& queryData = thisPtr->mEventQueries[regions.eventQueryIdx];
+		if (queryId == queryData.queryId)
+		{
+			for (auto& chunkIdx : regions.vertChunks)
+			{
+				thisPtr->mFreeVertChunks.push_back(chunkIdx);
+				thisPtr->mergeNearbyVertChunks(chunkIdx);
+			}
+
+			for (auto& chunkIdx : regions.idxChunks)
+			{
+				thisPtr->mFreeIdxChunks.push_back(chunkIdx);
+				thisPtr->mergeNearbyIdxChunks(chunkIdx);
+			}
+
+			thisPtr->freeEventQuery(regions.eventQueryIdx);
+			thisPtr->mPendingFreeRegions.erase(findIter);
+		}
+		else
+			queryData.query->onTriggered.clear();
+	}
+
+	void MeshHeap::discardPendingRegions(bool vertRegions)
+	{
+		for (auto iter = mPendingFreeRegions.begin(); iter != mPendingFreeRegions.end();)
+		{
+			PendingFreeRegions& regions = iter->second;
+
+			if (vertRegions)
+				regions.vertChunks.clear();
+			else
+				regions.idxChunks.clear();
+
+			if (regions.vertChunks.empty() && regions.idxChunks.empty())
+			{
+				freeEventQuery(regions.eventQueryIdx);
+				iter = mPendingFreeRegions.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
 	}
 }
\ No newline at end of file
@@ -124,6 +124,19 @@ namespace bs
 			UINT32 queryId;
 		};
 
+		/**
+		 * A set of regions vacated by defragmentation moves. The regions may not be reused until the GPU is done with
+		 * any draws that might still be reading them, as determined by the associated query.
+		 */
+		struct PendingFreeRegions
+		{
+			Vector<UINT32> vertChunks;
+			Vector<UINT32> idxChunks;
+
+			UINT32 eventQueryIdx;
+			UINT32 queryId;
+		};
+
 	public:
 		~MeshHeap();
 
@@ -195,17 +208,46 @@ namespace bs
 		/**
 		 * Attempts to reorganize the vertex and index buffer chunks in order to in order to make free memory contigous.
 		 *
-		 * @note	
+		 * @note
 		 * This will not actually copy any data from index/vertex buffers, and will only modify the chunk descriptors.
 		 */
 		void mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx);
 
+		/** Merges the free vertex chunk with the specified index with any neighboring free chunks. */
+		void mergeNearbyVertChunks(UINT32 chunkIdx);
+
+		/** Merges the free index chunk with the specified index with any neighboring free chunks. */
+		void mergeNearbyIdxChunks(UINT32 chunkIdx);
+
+		/**
+		 * Moves up to @p maxMoves allocations into free chunks closer to the start of the buffers, using GPU to GPU
+		 * copies. This gradually compacts free memory into a single contiguous chunk, without stalling or involving the
+		 * CPU. Vacated regions are returned to the free lists once the GPU reports it is done with them.
+		 *
+		 * @return	Number of allocations that were actually moved.
+		 */
+		UINT32 defragmentStep(UINT32 maxMoves);
+
+		/**
+		 * Called by a GPU event query when the GPU is done with the regions vacated by a defragmentation step, meaning
+		 * they may be returned to the free lists.
+		 */
+		static void defragRegionsFreed(SPtr<MeshHeap> thisPtr, UINT32 regionId, UINT32 queryId);
+
+		/**
+		 * Discards vertex (if @p vertRegions is true) or index regions pending a free, without returning them to the
+		 * free lists. Called when the relevant buffers are resized, as the chunk layout they reference is rebuilt.
+		 */
+		void discardPendingRegions(bool vertRegions);
+
 	private:
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 
 		Vector<UINT8*> mCPUVertexData;
+		Vector<UINT32> mCPUVertexDataSizes;
 		UINT8* mCPUIndexData;
+		UINT32 mCPUIndexDataSize;
 
 		SPtr<VertexData> mVertexData;
 		SPtr<IndexBuffer> mIndexBuffer;
@@ -225,12 +267,16 @@ namespace bs
 		List<UINT32> mFreeVertChunks;
 		List<UINT32> mFreeIdxChunks;
 
-		Vector<QueryData> mEventQueries; 
+		Vector<QueryData> mEventQueries;
 		Stack<UINT32> mFreeEventQueries;
 
+		Map<UINT32, PendingFreeRegions> mPendingFreeRegions;
+
 		UINT32 mNextQueryId;
+		UINT32 mNextRegionId;
 
 		static const float GrowPercent;
+		static const UINT32 DefragMovesPerAlloc;
 	};
 
 	/** @} */
@@ -1,13 +1,260 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Mesh/BsMeshUtility.h"
+#include "Mesh/BsMeshData.h"
 #include "Math/BsVector4.h"
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
+#include "Math/BsSIMD.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Debug/BsDebug.h"
+#include <queue>
 
 namespace bs
 {
+	/**
+	 * Splits the provided range into roughly equal chunks and processes them on the task scheduler's worker threads.
+	 * Runs inline on the calling thread when the range is too small to be worth distributing. Blocks until all chunks
+	 * are processed.
+	 */
+	static void processRangeParallel(UINT32 count, UINT32 minEntriesPerTask, std::function<void(UINT32, UINT32)> worker)
+	{
+		UINT32 numTasks = 0;
+		if (minEntriesPerTask > 0)
+			numTasks = count / minEntriesPerTask;
+
+		numTasks = std::min(numTasks, TaskScheduler::instance().getNumWorkers());
+
+		if (numTasks <= 1)
+		{
+			worker(0, count);
+			return;
+		}
+
+		UINT32 entriesPerTask = count / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			UINT32 start = i * entriesPerTask;
+			UINT32 end = (i == (numTasks - 1)) ? count : (start + entriesPerTask);
+
+			tasks.push_back(Task::create("MeshUtility", std::bind(worker, start, end)));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	/**
+	 * Computes normalized face normals for the provided range of triangles. Gathers triangle edges into
+	 * structure-of-arrays scratch buffers and processes four triangles per iteration using SIMD.
+	 */
+	static void calculateFaceNormals(Vector3* vertices, UINT8* indices, UINT32 indexSize, UINT32 rangeStart,
+		UINT32 rangeEnd, Vector3* faceNormals)
+	{
+		using namespace simd;
+
+		SIMDPP_ALIGN(16) float ax[4], ay[4], az[4];
+		SIMDPP_ALIGN(16) float bx[4], by[4], bz[4];
+		SIMDPP_ALIGN(16) float fx[4], fy[4], fz[4];
+
+		UINT32 simdEnd = rangeStart + ((rangeEnd - rangeStart) / 4) * 4;
+		for (UINT32 i = rangeStart; i < simdEnd; i += 4)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				UINT32 triangle[3];
+				memcpy(&triangle[0], indices + ((i + j) * 3 + 0) * indexSize, indexSize);
+				memcpy(&triangle[1], indices + ((i + j) * 3 + 1) * indexSize, indexSize);
+				memcpy(&triangle[2], indices + ((i + j) * 3 + 2) * indexSize, indexSize);
+
+				const Vector3& v0 = vertices[triangle[0]];
+				const Vector3& v1 = vertices[triangle[1]];
+				const Vector3& v2 = vertices[triangle[2]];
+
+				ax[j] = v1.x - v0.x; ay[j] = v1.y - v0.y; az[j] = v1.z - v0.z;
+				bx[j] = v2.x - v0.x; by[j] = v2.y - v0.y; bz[j] = v2.z - v0.z;
+			}
+
+			float32x4 eax = load<float32x4>(ax);
+			float32x4 eay = load<float32x4>(ay);
+			float32x4 eaz = load<float32x4>(az);
+			float32x4 ebx = load<float32x4>(bx);
+			float32x4 eby = load<float32x4>(by);
+			float32x4 ebz = load<float32x4>(bz);
+
+			float32x4 nx = sub(mul(eay, ebz), mul(eaz, eby));
+			float32x4 ny = sub(mul(eaz, ebx), mul(eax, ebz));
+			float32x4 nz = sub(mul(eax, eby), mul(eay, ebx));
+
+			// Same normalization rule as Vector3::normalize(): degenerate triangles keep their (zero) vector
+			float32x4 one = make_float(1.0f);
+			float32x4 eps = make_float(1e-08f);
+
+			float32x4 len = sqrt(add(add(mul(nx, nx), mul(ny, ny)), mul(nz, nz)));
+			float32x4 invLen = div(one, len);
+			mask_float32x4 degenerate = cmp_le(len, eps);
+
+			nx = blend(nx, mul(nx, invLen), degenerate);
+			ny = blend(ny, mul(ny, invLen), degenerate);
+			nz = blend(nz, mul(nz, invLen), degenerate);
+
+			store(fx, nx);
+			store(fy, ny);
+			store(fz, nz);
+
+			for (UINT32 j = 0; j < 4; j++)
+				faceNormals[i + j] = Vector3(fx[j], fy[j], fz[j]);
+		}
+
+		for (UINT32 i = simdEnd; i < rangeEnd; i++)
+		{
+			UINT32 triangle[3];
+			memcpy(&triangle[0], indices + (i * 3 + 0) * indexSize, indexSize);
+			memcpy(&triangle[1], indices + (i * 3 + 1) * indexSize, indexSize);
+			memcpy(&triangle[2], indices + (i * 3 + 2) * indexSize, indexSize);
+
+			Vector3 edgeA = vertices[triangle[1]] - vertices[triangle[0]];
+			Vector3 edgeB = vertices[triangle[2]] - vertices[triangle[0]];
+			faceNormals[i] = Vector3::normalize(Vector3::cross(edgeA, edgeB));
+		}
+	}
+
+	/**
+	 * Computes normalized face tangents and bitangents for the provided range of triangles. Gathers triangle data into
+	 * structure-of-arrays scratch buffers and processes four triangles per iteration using SIMD.
+	 */
+	static void calculateFaceTangents(UINT8* positionBytes, UINT8* uvBytes, UINT8* indices, UINT32 indexSize,
+		UINT32 vec3Stride, UINT32 vec2Stride, UINT32 rangeStart, UINT32 rangeEnd, Vector3* faceTangents,
+		Vector3* faceBitangents)
+	{
+		using namespace simd;
+
+		SIMDPP_ALIGN(16) float q0x[4], q0y[4], q0z[4];
+		SIMDPP_ALIGN(16) float q1x[4], q1y[4], q1z[4];
+		SIMDPP_ALIGN(16) float s1x[4], s1y[4], s2x[4], s2y[4];
+		SIMDPP_ALIGN(16) float fx[4], fy[4], fz[4];
+		SIMDPP_ALIGN(16) float gx[4], gy[4], gz[4];
+
+		UINT32 simdEnd = rangeStart + ((rangeEnd - rangeStart) / 4) * 4;
+		for (UINT32 i = rangeStart; i < simdEnd; i += 4)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				UINT32 triangle[3];
+				memcpy(&triangle[0], indices + ((i + j) * 3 + 0) * indexSize, indexSize);
+				memcpy(&triangle[1], indices + ((i + j) * 3 + 1) * indexSize, indexSize);
+				memcpy(&triangle[2], indices + ((i + j) * 3 + 2) * indexSize, indexSize);
+
+				Vector3 p0 = *(Vector3*)&positionBytes[triangle[0] * vec3Stride];
+				Vector3 p1 = *(Vector3*)&positionBytes[triangle[1] * vec3Stride];
+				Vector3 p2 = *(Vector3*)&positionBytes[triangle[2] * vec3Stride];
+
+				Vector2 uv0 = *(Vector2*)&uvBytes[triangle[0] * vec2Stride];
+				Vector2 uv1 = *(Vector2*)&uvBytes[triangle[1] * vec2Stride];
+				Vector2 uv2 = *(Vector2*)&uvBytes[triangle[2] * vec2Stride];
+
+				q0x[j] = p1.x - p0.x; q0y[j] = p1.y - p0.y; q0z[j] = p1.z - p0.z;
+				q1x[j] = p2.x - p0.x; q1y[j] = p2.y - p0.y; q1z[j] = p2.z - p0.z;
+
+				s1x[j] = uv1.x - uv0.x; s1y[j] = uv1.y - uv0.y;
+				s2x[j] = uv2.x - uv0.x; s2y[j] = uv2.y - uv0.y;
+			}
+
+			float32x4 eq0x = load<float32x4>(q0x);
+			float32x4 eq0y = load<float32x4>(q0y);
+			float32x4 eq0z = load<float32x4>(q0z);
+			float32x4 eq1x = load<float32x4>(q1x);
+			float32x4 eq1y = load<float32x4>(q1y);
+			float32x4 eq1z = load<float32x4>(q1z);
+			float32x4 est1x = load<float32x4>(s1x);
+			float32x4 est1y = load<float32x4>(s1y);
+			float32x4 est2x = load<float32x4>(s2x);
+			float32x4 est2y = load<float32x4>(s2y);
+
+			float32x4 one = make_float(1.0f);
+			float32x4 eps = make_float(1e-08f);
+
+			float32x4 r = div(one, sub(mul(est1x, est2y), mul(est2x, est1y)));
+
+			float32x4 tx = mul(sub(mul(est2y, eq0x), mul(est1y, eq1x)), r);
+			float32x4 ty = mul(sub(mul(est2y, eq0y), mul(est1y, eq1y)), r);
+			float32x4 tz = mul(sub(mul(est2y, eq0z), mul(est1y, eq1z)), r);
+
+			float32x4 btx = mul(sub(mul(est1x, eq1x), mul(est2x, eq0x)), r);
+			float32x4 bty = mul(sub(mul(est1x, eq1y), mul(est2x, eq0y)), r);
+			float32x4 btz = mul(sub(mul(est1x, eq1z), mul(est2x, eq0z)), r);
+
+			// Same normalization rule as Vector3::normalize(): degenerate triangles keep their vector
+			float32x4 tangentLen = sqrt(add(add(mul(tx, tx), mul(ty, ty)), mul(tz, tz)));
+			float32x4 invTangentLen = div(one, tangentLen);
+			mask_float32x4 degenerateTangent = cmp_le(tangentLen, eps);
+
+			tx = blend(tx, mul(tx, invTangentLen), degenerateTangent);
+			ty = blend(ty, mul(ty, invTangentLen), degenerateTangent);
+			tz = blend(tz, mul(tz, invTangentLen), degenerateTangent);
+
+			float32x4 bitangentLen = sqrt(add(add(mul(btx, btx), mul(bty, bty)), mul(btz, btz)));
+			float32x4 invBitangentLen = div(one, bitangentLen);
+			mask_float32x4 degenerateBitangent = cmp_le(bitangentLen, eps);
+
+			btx = blend(btx, mul(btx, invBitangentLen), degenerateBitangent);
+			bty = blend(bty, mul(bty, invBitangentLen), degenerateBitangent);
+			btz = blend(btz, mul(btz, invBitangentLen), degenerateBitangent);
+
+			store(fx, tx);
+			store(fy, ty);
+			store(fz, tz);
+			store(gx, btx);
+			store(gy, bty);
+			store(gz, btz);
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				faceTangents[i + j] = Vector3(fx[j], fy[j], fz[j]);
+				faceBitangents[i + j] = Vector3(gx[j], gy[j], gz[j]);
+			}
+		}
+
+		for (UINT32 i = simdEnd; i < rangeEnd; i++)
+		{
+			UINT32 triangle[3];
+			memcpy(&triangle[0], indices + (i * 3 + 0) * indexSize, indexSize);
+			memcpy(&triangle[1], indices + (i * 3 + 1) * indexSize, indexSize);
+			memcpy(&triangle[2], indices + (i * 3 + 2) * indexSize, indexSize);
+
+			Vector3 p0 = *(Vector3*)&positionBytes[triangle[0] * vec3Stride];
+			Vector3 p1 = *(Vector3*)&positionBytes[triangle[1] * vec3Stride];
+			Vector3 p2 = *(Vector3*)&positionBytes[triangle[2] * vec3Stride];
+
+			Vector2 uv0 = *(Vector2*)&uvBytes[triangle[0] * vec2Stride];
+			Vector2 uv1 = *(Vector2*)&uvBytes[triangle[1] * vec2Stride];
+			Vector2 uv2 = *(Vector2*)&uvBytes[triangle[2] * vec2Stride];
+
+			Vector3 q0 = p1 - p0;
+			Vector3 q1 = p2 - p0;
+
+			Vector2 st1 = uv1 - uv0;
+			Vector2 st2 = uv2 - uv0;
+
+			float denom = st1.x * st2.y - st2.x * st1.y;
+			if (fabs(denom) >= 0e-8f)
+			{
+				float r = 1.0f / denom;
+
+				faceTangents[i] = (st2.y * q0 - st1.y * q1) * r;
+				faceBitangents[i] = (st1.x * q1 - st2.x * q0) * r;
+
+				faceTangents[i].normalize();
+				faceBitangents[i].normalize();
+			}
+		}
+	}
+
 	struct VertexFaces
 	{
 		UINT32* faces;
@@ -729,36 +976,33 @@ namespace bs
 	{
 		UINT32 numFaces = numIndices / 3;
 
+		// Note: Potentially don't normalize face normals in order to weigh the normals by triangle size
+
+		// Each face normal only depends on its own triangle, and each vertex normal only on its own connectivity list,
+		// so both passes can be chunked over worker threads
 		Vector3* faceNormals = bs_newN<Vector3>(numFaces);
-		for (UINT32 i = 0; i < numFaces; i++)
+		processRangeParallel(numFaces, 8192, [&](UINT32 start, UINT32 end)
 		{
-			UINT32 triangle[3];
-			memcpy(&triangle[0], indices + (i * 3 + 0) * indexSize, indexSize);
-			memcpy(&triangle[1], indices + (i * 3 + 1) * indexSize, indexSize);
-			memcpy(&triangle[2], indices + (i * 3 + 2) * indexSize, indexSize);
-
-			Vector3 edgeA = vertices[triangle[1]] - vertices[triangle[0]];
-			Vector3 edgeB = vertices[triangle[2]] - vertices[triangle[0]];
-			faceNormals[i] = Vector3::normalize(Vector3::cross(edgeA, edgeB));
-
-			// Note: Potentially don't normalize here in order to weigh the normals
-			// by triangle size
-		}
+			calculateFaceNormals(vertices, indices, indexSize, start, end, faceNormals);
+		});
 
 		VertexConnectivity connectivity(indices, numVertices, numFaces, indexSize);
-		for (UINT32 i = 0; i < numVertices; i++)
+		processRangeParallel(numVertices, 8192, [&](UINT32 start, UINT32 end)
 		{
-			VertexFaces& faces = connectivity.vertexFaces[i];
-
-			normals[i] = Vector3::ZERO;
-			for (UINT32 j = 0; j < faces.numFaces; j++)
+			for (UINT32 i = start; i < end; i++)
 			{
-				UINT32 faceIdx = faces.faces[j];
-				normals[i] += faceNormals[faceIdx];
-			}
+				VertexFaces& faces = connectivity.vertexFaces[i];
 
-			normals[i].normalize();
-		}
+				normals[i] = Vector3::ZERO;
+				for (UINT32 j = 0; j < faces.numFaces; j++)
+				{
+					UINT32 faceIdx = faces.faces[j];
+					normals[i] += faceNormals[faceIdx];
+				}
+
+				normals[i].normalize();
+			}
+		});
 
 		bs_deleteN(faceNormals, numFaces);
 	}
@@ -774,86 +1018,765 @@ namespace bs
 		UINT8* normalBytes = (UINT8*)normals;
 		UINT8* uvBytes = (UINT8*)uv;
 
+		// Note: Potentially don't normalize face tangents in order to weight the tangents by triangle size
+
+		// Each face tangent only depends on its own triangle, and each vertex tangent only on its own connectivity
+		// list, so both passes can be chunked over worker threads
 		Vector3* faceTangents = bs_newN<Vector3>(numFaces);
 		Vector3* faceBitangents = bs_newN<Vector3>(numFaces);
-		for (UINT32 i = 0; i < numFaces; i++)
+		processRangeParallel(numFaces, 8192, [&](UINT32 start, UINT32 end)
 		{
-			UINT32 triangle[3];
-			memcpy(&triangle[0], indices + (i * 3 + 0) * indexSize, indexSize);
-			memcpy(&triangle[1], indices + (i * 3 + 1) * indexSize, indexSize);
-			memcpy(&triangle[2], indices + (i * 3 + 2) * indexSize, indexSize);
+			calculateFaceTangents(positionBytes, uvBytes, indices, indexSize, vec3Stride, vec2Stride, start, end,
+				faceTangents, faceBitangents);
+		});
 
-			Vector3 p0 = *(Vector3*)&positionBytes[triangle[0] * vec3Stride];
-			Vector3 p1 = *(Vector3*)&positionBytes[triangle[1] * vec3Stride];
-			Vector3 p2 = *(Vector3*)&positionBytes[triangle[2] * vec3Stride];
+		VertexConnectivity connectivity(indices, numVertices, numFaces, indexSize);
+		processRangeParallel(numVertices, 8192, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				VertexFaces& faces = connectivity.vertexFaces[i];
 
-			Vector2 uv0 = *(Vector2*)&uvBytes[triangle[0] * vec2Stride];
-			Vector2 uv1 = *(Vector2*)&uvBytes[triangle[1] * vec2Stride];
-			Vector2 uv2 = *(Vector2*)&uvBytes[triangle[2] * vec2Stride];
+				tangents[i] = Vector3::ZERO;
+				bitangents[i] = Vector3::ZERO;
 
-			Vector3 q0 = p1 - p0;
-			Vector3 q1 = p2 - p0;
+				for (UINT32 j = 0; j < faces.numFaces; j++)
+				{
+					UINT32 faceIdx = faces.faces[j];
+					tangents[i] += faceTangents[faceIdx];
+					bitangents[i] += faceBitangents[faceIdx];
+				}
 
-			Vector2 st1 = uv1 - uv0;
-			Vector2 st2 = uv2 - uv0;
+				tangents[i].normalize();
+				bitangents[i].normalize();
 
-			float denom = st1.x * st2.y - st2.x * st1.y;
-			if (fabs(denom) >= 0e-8f)
+				Vector3 normal = *(Vector3*)&normalBytes[i * vec3Stride];
+
+				// Orthonormalize
+				float dot0 = normal.dot(tangents[i]);
+				tangents[i] -= dot0*normal;
+				tangents[i].normalize();
+
+				float dot1 = tangents[i].dot(bitangents[i]);
+				dot0 = normal.dot(bitangents[i]);
+				bitangents[i] -= dot0*normal + dot1*tangents[i];
+				bitangents[i].normalize();
+			}
+		});
+
+		bs_deleteN(faceTangents, numFaces);
+		bs_deleteN(faceBitangents, numFaces);
+
+		// TODO - Consider weighing tangents by triangle size and/or edge angles
+	}
+
+	void MeshUtility::calculateTangentSpace(Vector3* vertices, Vector2* uv, UINT8* indices, UINT32 numVertices,
+		UINT32 numIndices, Vector3* normals, Vector3* tangents, Vector3* bitangents, UINT32 indexSize)
+	{
+		calculateNormals(vertices, indices, numVertices, numIndices, normals, indexSize);
+		calculateTangents(vertices, normals, uv, indices, numVertices, numIndices, tangents, bitangents, indexSize);
+	}
+
+	/**
+	 * Symmetric 4x4 matrix representing the sum of squared distances from a point to a set of planes. Since the matrix
+	 * is symmetric only the unique coefficients are stored.
+	 */
+	struct ErrorQuadric
+	{
+		/** Accumulates a plane with the provided unit normal and distance from origin into the quadric. */
+		void addPlane(const Vector3& n, float d)
+		{
+			a2 += n.x * n.x; ab += n.x * n.y; ac += n.x * n.z; ad += n.x * d;
+			b2 += n.y * n.y; bc += n.y * n.z; bd += n.y * d;
+			c2 += n.z * n.z; cd += n.z * d;
+			d2 += d * d;
+		}
+
+		/** Returns the sum of squared distances from the provided point to all planes in the quadric. */
+		float evaluate(const Vector3& p) const
+		{
+			return a2 * p.x * p.x + 2.0f * ab * p.x * p.y + 2.0f * ac * p.x * p.z + 2.0f * ad * p.x +
+				b2 * p.y * p.y + 2.0f * bc * p.y * p.z + 2.0f * bd * p.y +
+				c2 * p.z * p.z + 2.0f * cd * p.z + d2;
+		}
+
+		ErrorQuadric& operator+= (const ErrorQuadric& rhs)
+		{
+			a2 += rhs.a2; ab += rhs.ab; ac += rhs.ac; ad += rhs.ad;
+			b2 += rhs.b2; bc += rhs.bc; bd += rhs.bd;
+			c2 += rhs.c2; cd += rhs.cd;
+			d2 += rhs.d2;
+
+			return *this;
+		}
+
+		float a2 = 0.0f, ab = 0.0f, ac = 0.0f, ad = 0.0f;
+		float b2 = 0.0f, bc = 0.0f, bd = 0.0f;
+		float c2 = 0.0f, cd = 0.0f;
+		float d2 = 0.0f;
+	};
+
+	UINT32 MeshUtility::simplify(UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, const UINT32* indices,
+		UINT32 numIndices, UINT32 targetNumIndices, UINT32* output)
+	{
+		if (vertexStride == 0)
+			vertexStride = sizeof(Vector3);
+
+		UINT32 numTriangles = numIndices / 3;
+
+		auto getPosition = [&](UINT32 idx)
+		{
+			return *(Vector3*)(vertices + idx * vertexStride);
+		};
+
+		// Each collapse redirects a vertex to one of its neighbors. Resolves such redirects, including any chains
+		// formed by further collapses of the target vertex.
+		Vector<UINT32> remap(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			remap[i] = i;
+
+		auto resolve = [&](UINT32 idx)
+		{
+			while (remap[idx] != idx)
 			{
-				float r = 1.0f / denom;
+				remap[idx] = remap[remap[idx]];
+				idx = remap[idx];
+			}
 
-				faceTangents[i] = (st2.y * q0 - st1.y * q1) * r;
-				faceBitangents[i] = (st1.x * q1 - st2.x * q0) * r;
+			return idx;
+		};
 
-				faceTangents[i].normalize();
-				faceBitangents[i].normalize();
+		auto addNeighbor = [](Vector<UINT32>& list, UINT32 idx)
+		{
+			if (std::find(list.begin(), list.end(), idx) == list.end())
+				list.push_back(idx);
+		};
+
+		// Build per-vertex quadrics from the planes of incident triangles, along with connectivity information
+		Vector<ErrorQuadric> quadrics(numVertices);
+		Vector<Vector<UINT32>> neighbors(numVertices);
+		Vector<Vector<UINT32>> vertexTris(numVertices);
+		Vector<bool> triangleAlive(numTriangles, false);
+
+		UINT32 numLiveTriangles = 0;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			UINT32 v[3] = { indices[i * 3 + 0], indices[i * 3 + 1], indices[i * 3 + 2] };
+			if (v[0] == v[1] || v[1] == v[2] || v[0] == v[2])
+				continue;
+
+			triangleAlive[i] = true;
+			numLiveTriangles++;
+
+			Vector3 p0 = getPosition(v[0]);
+			Vector3 normal = (getPosition(v[1]) - p0).cross(getPosition(v[2]) - p0);
+
+			float length = normal.length();
+			if (length > 1e-08f)
+			{
+				normal /= length;
+
+				float d = -normal.dot(p0);
+				for (UINT32 j = 0; j < 3; j++)
+					quadrics[v[j]].addPlane(normal, d);
 			}
 
-			// Note: Potentially don't normalize here in order to weight the normals by triangle size
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				vertexTris[v[j]].push_back(i);
+				addNeighbor(neighbors[v[j]], v[(j + 1) % 3]);
+				addNeighbor(neighbors[v[j]], v[(j + 2) % 3]);
+			}
 		}
 
-		VertexConnectivity connectivity(indices, numVertices, numFaces, indexSize);
+		// Candidate collapses ordered by the error they introduce. Stale entries are detected through per-vertex
+		// version numbers and discarded when popped, rather than being removed eagerly.
+		struct CollapseCandidate
+		{
+			float cost;
+			UINT32 src, dst;
+			UINT32 srcVersion, dstVersion;
+		};
+
+		auto candidateCompare = [](const CollapseCandidate& a, const CollapseCandidate& b) { return a.cost > b.cost; };
+		std::priority_queue<CollapseCandidate, Vector<CollapseCandidate>, decltype(candidateCompare)>
+			candidates(candidateCompare);
+
+		Vector<UINT32> versions(numVertices, 0);
+
+		auto pushCandidates = [&](UINT32 vertexIdx, bool bothDirections)
+		{
+			for (auto& neighbor : neighbors[vertexIdx])
+			{
+				UINT32 other = resolve(neighbor);
+				if (other == vertexIdx)
+					continue;
+
+				ErrorQuadric combined = quadrics[vertexIdx];
+				combined += quadrics[other];
+
+				candidates.push({ combined.evaluate(getPosition(other)), vertexIdx, other,
+					versions[vertexIdx], versions[other] });
+
+				if (bothDirections)
+				{
+					candidates.push({ combined.evaluate(getPosition(vertexIdx)), other, vertexIdx,
+						versions[other], versions[vertexIdx] });
+				}
+			}
+		};
+
 		for (UINT32 i = 0; i < numVertices; i++)
+			pushCandidates(i, false);
+
+		while (numLiveTriangles * 3 > targetNumIndices && !candidates.empty())
 		{
-			VertexFaces& faces = connectivity.vertexFaces[i];
+			CollapseCandidate candidate = candidates.top();
+			candidates.pop();
+
+			UINT32 src = candidate.src;
+			UINT32 dst = candidate.dst;
+
+			if (remap[src] != src || remap[dst] != dst)
+				continue;
+
+			if (versions[src] != candidate.srcVersion || versions[dst] != candidate.dstVersion)
+				continue;
 
-			tangents[i] = Vector3::ZERO;
-			bitangents[i] = Vector3::ZERO;
+			// Reject collapses that would flip the orientation of any surviving triangle
+			Vector3 dstPosition = getPosition(dst);
 
-			for (UINT32 j = 0; j < faces.numFaces; j++)
+			bool flipsTriangle = false;
+			for (auto& triIdx : vertexTris[src])
 			{
-				UINT32 faceIdx = faces.faces[j];
-				tangents[i] += faceTangents[faceIdx];
-				bitangents[i] += faceBitangents[faceIdx];
+				if (!triangleAlive[triIdx])
+					continue;
+
+				UINT32 t[3];
+				for (UINT32 j = 0; j < 3; j++)
+					t[j] = resolve(indices[triIdx * 3 + j]);
+
+				if (t[0] == dst || t[1] == dst || t[2] == dst)
+					continue; // Will be removed by the collapse
+
+				Vector3 before[3];
+				Vector3 after[3];
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					before[j] = getPosition(t[j]);
+					after[j] = t[j] == src ? dstPosition : before[j];
+				}
+
+				Vector3 normalBefore = (before[1] - before[0]).cross(before[2] - before[0]);
+				Vector3 normalAfter = (after[1] - after[0]).cross(after[2] - after[0]);
+
+				if (normalBefore.dot(normalAfter) < 0.0f)
+				{
+					flipsTriangle = true;
+					break;
+				}
 			}
 
-			tangents[i].normalize();
-			bitangents[i].normalize();
+			if (flipsTriangle)
+				continue;
+
+			// Perform the collapse
+			remap[src] = dst;
+			quadrics[dst] += quadrics[src];
+			versions[src]++;
+			versions[dst]++;
 
-			Vector3 normal = *(Vector3*)&normalBytes[i * vec3Stride];
+			for (auto& triIdx : vertexTris[src])
+			{
+				if (!triangleAlive[triIdx])
+					continue;
+
+				UINT32 t[3];
+				for (UINT32 j = 0; j < 3; j++)
+					t[j] = resolve(indices[triIdx * 3 + j]);
+
+				if (t[0] == t[1] || t[1] == t[2] || t[0] == t[2])
+				{
+					triangleAlive[triIdx] = false;
+					numLiveTriangles--;
+				}
+				else
+					vertexTris[dst].push_back(triIdx);
+			}
+
+			vertexTris[src].clear();
+
+			for (auto& neighbor : neighbors[src])
+			{
+				UINT32 other = resolve(neighbor);
+				if (other != dst)
+					addNeighbor(neighbors[dst], other);
+			}
 
-			// Orthonormalize
-			float dot0 = normal.dot(tangents[i]);
-			tangents[i] -= dot0*normal;
-			tangents[i].normalize();
+			neighbors[src].clear();
 
-			float dot1 = tangents[i].dot(bitangents[i]);
-			dot0 = normal.dot(bitangents[i]);
-			bitangents[i] -= dot0*normal + dot1*tangents[i];
-			bitangents[i].normalize();
+			pushCandidates(dst, true);
 		}
 
-		bs_deleteN(faceTangents, numFaces);
-		bs_deleteN(faceBitangents, numFaces);
+		// Write out the surviving triangles, in their original order
+		UINT32 numOutputIndices = 0;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			if (!triangleAlive[i])
+				continue;
 
-		// TODO - Consider weighing tangents by triangle size and/or edge angles
+			for (UINT32 j = 0; j < 3; j++)
+				output[numOutputIndices++] = resolve(indices[i * 3 + j]);
+		}
+
+		return numOutputIndices;
 	}
 
-	void MeshUtility::calculateTangentSpace(Vector3* vertices, Vector2* uv, UINT8* indices, UINT32 numVertices,
-		UINT32 numIndices, Vector3* normals, Vector3* tangents, Vector3* bitangents, UINT32 indexSize)
+	SPtr<MeshData> MeshUtility::generateLodChain(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+		UINT32 numLodLevels, float reductionFactor, Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes)
 	{
-		calculateNormals(vertices, indices, numVertices, numIndices, normals, indexSize);
-		calculateTangents(vertices, normals, uv, indices, numVertices, numIndices, tangents, bitangents, indexSize);
+		lodSubMeshes.clear();
+		lodScreenSizes.clear();
+
+		if (numLodLevels == 0)
+			return meshData;
+
+		if (meshData->getIndexType() != IT_32BIT)
+		{
+			LOGWRN("LOD chain generation is only supported for meshes with 32-bit indices.");
+			return meshData;
+		}
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+		if (positionElement == nullptr)
+		{
+			LOGWRN("LOD chain generation requires a mesh with vertex positions.");
+			return meshData;
+		}
+
+		UINT8* positionData = meshData->getElementData(VES_POSITION);
+		UINT32 positionStride = vertexDesc->getVertexStride(positionElement->getStreamIdx());
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32* srcIndices = meshData->getIndices32();
+
+		Vector<SubMesh> baseSubMeshes = subMeshes;
+		if (baseSubMeshes.empty())
+			baseSubMeshes.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+
+		reductionFactor = Math::clamp(reductionFactor, 0.01f, 0.99f);
+
+		Vector<UINT32> lodIndices;
+		Vector<UINT32> scratch(numIndices);
+		for (UINT32 level = 1; level <= numLodLevels; level++)
+		{
+			float fraction = Math::pow(reductionFactor, (float)level);
+			for (auto& subMesh : baseSubMeshes)
+			{
+				// Non-triangle geometry cannot be simplified, reference the base range instead
+				if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				{
+					lodSubMeshes.push_back(subMesh);
+					continue;
+				}
+
+				UINT32 targetNumIndices = std::max(3U, ((UINT32)(subMesh.indexCount * fraction) / 3) * 3);
+				UINT32 numGenerated = simplify(positionData, numVertices, positionStride,
+					srcIndices + subMesh.indexOffset, subMesh.indexCount, targetNumIndices, scratch.data());
+
+				lodSubMeshes.push_back(SubMesh(numIndices + (UINT32)lodIndices.size(), numGenerated, DOT_TRIANGLE_LIST));
+				lodIndices.insert(lodIndices.end(), scratch.begin(), scratch.begin() + numGenerated);
+			}
+
+			// Heuristic: assume a level reduced to half the triangles remains acceptable at half the on-screen size
+			lodScreenSizes.push_back(Math::pow(0.5f, (float)level));
+		}
+
+		if (lodIndices.empty())
+		{
+			lodSubMeshes.clear();
+			lodScreenSizes.clear();
+
+			return meshData;
+		}
+
+		// Create a copy of the mesh data with the generated levels appended to the index buffer. Vertices are shared
+		// by all levels.
+		SPtr<MeshData> newMeshData = bs_shared_ptr_new<MeshData>(numVertices,
+			numIndices + (UINT32)lodIndices.size(), vertexDesc);
+
+		UINT32* dstIndices = newMeshData->getIndices32();
+		memcpy(dstIndices, srcIndices, numIndices * sizeof(UINT32));
+		memcpy(dstIndices + numIndices, lodIndices.data(), (UINT32)lodIndices.size() * sizeof(UINT32));
+
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+
+			UINT8* srcData = meshData->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+			UINT8* dstData = newMeshData->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+
+			UINT32 vertexStride = vertexDesc->getVertexStride(element.getStreamIdx());
+			UINT32 elementSize = vertexDesc->getElementSize(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+
+			for (UINT32 j = 0; j < numVertices; j++)
+			{
+				memcpy(dstData, srcData, elementSize);
+				srcData += vertexStride;
+				dstData += vertexStride;
+			}
+		}
+
+		return newMeshData;
+	}
+
+	/** Constants used by the vertex cache optimizer, as tuned in Forsyth's original article. */
+	static constexpr UINT32 VCACHE_SIZE = 32;
+	static constexpr float VCACHE_DECAY_POWER = 1.5f;
+	static constexpr float VCACHE_LAST_TRI_SCORE = 0.75f;
+	static constexpr float VCACHE_VALENCE_BOOST_SCALE = 2.0f;
+	static constexpr float VCACHE_VALENCE_BOOST_POWER = 0.5f;
+
+	/** Returns the priority of a vertex for the vertex cache optimizer, depending on cache position and valence. */
+	static float vertexCacheScore(INT32 cachePos, UINT32 activeTris)
+	{
+		if (activeTris == 0)
+			return -1.0f; // No remaining triangles, never pick this vertex again
+
+		float score = 0.0f;
+		if (cachePos < 0)
+			score = 0.0f; // Not in cache
+		else if (cachePos < 3)
+			score = VCACHE_LAST_TRI_SCORE; // Used by the last drawn triangle
+		else
+		{
+			float scaler = 1.0f / (VCACHE_SIZE - 3);
+			score = 1.0f - (cachePos - 3) * scaler;
+			score = Math::pow(score, VCACHE_DECAY_POWER);
+		}
+
+		// Boost vertices with few remaining triangles, so lone vertices don't get stranded until the very end
+		score += VCACHE_VALENCE_BOOST_SCALE * Math::pow((float)activeTris, -VCACHE_VALENCE_BOOST_POWER);
+
+		return score;
+	}
+
+	void MeshUtility::optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		// Build per-vertex triangle lists
+		Vector<UINT32> triCounts(numVertices, 0);
+		for (UINT32 i = 0; i < numIndices; i++)
+			triCounts[indices[i]]++;
+
+		Vector<UINT32> triListOffsets(numVertices);
+		UINT32 offset = 0;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			triListOffsets[i] = offset;
+			offset += triCounts[i];
+		}
+
+		Vector<UINT32> triLists(numIndices);
+		{
+			Vector<UINT32> cursors = triListOffsets;
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+					triLists[cursors[indices[i * 3 + j]]++] = i;
+			}
+		}
+
+		Vector<UINT32> activeTris = triCounts;
+		Vector<INT32> cachePositions(numVertices, -1);
+		Vector<float> vertexScores(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexScores[i] = vertexCacheScore(-1, activeTris[i]);
+
+		Vector<float> triScores(numTriangles);
+		Vector<bool> triDrawn(numTriangles, false);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			triScores[i] = vertexScores[indices[i * 3 + 0]] + vertexScores[indices[i * 3 + 1]] +
+				vertexScores[indices[i * 3 + 2]];
+		}
+
+		// Simulated LRU cache, with extra room for the three vertices pushed by the triangle being drawn
+		UINT32 cache[VCACHE_SIZE + 3];
+		UINT32 cacheSize = 0;
+
+		Vector<UINT32> newIndices(numIndices);
+		UINT32 outputPos = 0;
+		UINT32 scanPos = 0;
+
+		// Pick the initial triangle through a full scan, further ones are tracked incrementally
+		INT32 bestTri = -1;
+		float bestScore = std::numeric_limits<float>::lowest();
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			if (triScores[i] > bestScore)
+			{
+				bestScore = triScores[i];
+				bestTri = (INT32)i;
+			}
+		}
+
+		for (UINT32 numDrawn = 0; numDrawn < numTriangles; numDrawn++)
+		{
+			if (bestTri < 0)
+			{
+				// No candidate among recently touched triangles, fall back to a linear scan for the next undrawn one
+				while (triDrawn[scanPos])
+					scanPos++;
+
+				bestTri = (INT32)scanPos;
+			}
+
+			UINT32 tri = (UINT32)bestTri;
+			triDrawn[tri] = true;
+
+			UINT32 v[3];
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				v[j] = indices[tri * 3 + j];
+				newIndices[outputPos++] = v[j];
+				activeTris[v[j]]--;
+			}
+
+			// Move the triangle's vertices to the front of the cache, preserving order of the remaining entries
+			UINT32 newCache[VCACHE_SIZE + 3];
+			UINT32 newCacheSize = 0;
+			for (UINT32 j = 0; j < 3; j++)
+				newCache[newCacheSize++] = v[j];
+
+			for (UINT32 i = 0; i < cacheSize; i++)
+			{
+				UINT32 entry = cache[i];
+				if (entry == v[0] || entry == v[1] || entry == v[2])
+					continue;
+
+				newCache[newCacheSize++] = entry;
+			}
+
+			// Update scores of all touched vertices, and of their remaining triangles
+			for (UINT32 i = 0; i < newCacheSize; i++)
+			{
+				UINT32 vertexIdx = newCache[i];
+				INT32 newPos = i < VCACHE_SIZE ? (INT32)i : -1; // Entries past the cache size got evicted
+
+				cachePositions[vertexIdx] = newPos;
+
+				float newScore = vertexCacheScore(newPos, activeTris[vertexIdx]);
+				float scoreDiff = newScore - vertexScores[vertexIdx];
+				vertexScores[vertexIdx] = newScore;
+
+				for (UINT32 j = 0; j < triCounts[vertexIdx]; j++)
+					triScores[triLists[triListOffsets[vertexIdx] + j]] += scoreDiff;
+			}
+
+			// Pick the next triangle among those referencing the cached vertices
+			bestTri = -1;
+			bestScore = std::numeric_limits<float>::lowest();
+			for (UINT32 i = 0; i < newCacheSize; i++)
+			{
+				UINT32 vertexIdx = newCache[i];
+				for (UINT32 j = 0; j < triCounts[vertexIdx]; j++)
+				{
+					UINT32 triIdx = triLists[triListOffsets[vertexIdx] + j];
+					if (!triDrawn[triIdx] && triScores[triIdx] > bestScore)
+					{
+						bestScore = triScores[triIdx];
+						bestTri = (INT32)triIdx;
+					}
+				}
+			}
+
+			cacheSize = std::min(newCacheSize, VCACHE_SIZE);
+			memcpy(cache, newCache, cacheSize * sizeof(UINT32));
+		}
+
+		memcpy(indices, newIndices.data(), numIndices * sizeof(UINT32));
+	}
+
+	void MeshUtility::optimizeOverdraw(UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, UINT32* indices,
+		UINT32 numIndices, UINT32 trianglesPerCluster)
+	{
+		if (vertexStride == 0)
+			vertexStride = sizeof(Vector3);
+
+		UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0 || trianglesPerCluster == 0 || numTriangles <= trianglesPerCluster)
+			return;
+
+		auto getPosition = [&](UINT32 idx)
+		{
+			return *(Vector3*)(vertices + idx * vertexStride);
+		};
+
+		Vector3 meshCentroid = Vector3::ZERO;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			meshCentroid += (getPosition(indices[i * 3 + 0]) + getPosition(indices[i * 3 + 1]) +
+				getPosition(indices[i * 3 + 2])) / 3.0f;
+		}
+
+		meshCentroid /= (float)numTriangles;
+
+		// Sort clusters of consecutive triangles by how much they face away from the mesh center. Outward facing
+		// clusters get drawn first, which for mostly-convex objects roughly corresponds to front-to-back order from
+		// any viewpoint outside the object.
+		struct Cluster
+		{
+			UINT32 firstTri;
+			UINT32 numTris;
+			float sortKey;
+		};
+
+		UINT32 numClusters = (numTriangles + trianglesPerCluster - 1) / trianglesPerCluster;
+		Vector<Cluster> clusters(numClusters);
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			Cluster& cluster = clusters[i];
+			cluster.firstTri = i * trianglesPerCluster;
+			cluster.numTris = std::min(trianglesPerCluster, numTriangles - cluster.firstTri);
+
+			Vector3 normalSum = Vector3::ZERO;
+			Vector3 centroidSum = Vector3::ZERO;
+			for (UINT32 j = cluster.firstTri; j < cluster.firstTri + cluster.numTris; j++)
+			{
+				Vector3 p0 = getPosition(indices[j * 3 + 0]);
+				Vector3 p1 = getPosition(indices[j * 3 + 1]);
+				Vector3 p2 = getPosition(indices[j * 3 + 2]);
+
+				normalSum += (p1 - p0).cross(p2 - p0); // Area weighted
+				centroidSum += (p0 + p1 + p2) / 3.0f;
+			}
+
+			Vector3 outwardDir = centroidSum / (float)cluster.numTris - meshCentroid;
+
+			float normalLength = normalSum.length();
+			float outwardLength = outwardDir.length();
+			if (normalLength > 1e-08f && outwardLength > 1e-08f)
+				cluster.sortKey = normalSum.dot(outwardDir) / (normalLength * outwardLength);
+			else
+				cluster.sortKey = 0.0f;
+		}
+
+		std::stable_sort(clusters.begin(), clusters.end(),
+			[](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+		Vector<UINT32> newIndices(numIndices);
+		UINT32 outputPos = 0;
+		for (auto& cluster : clusters)
+		{
+			memcpy(&newIndices[outputPos], indices + cluster.firstTri * 3, cluster.numTris * 3 * sizeof(UINT32));
+			outputPos += cluster.numTris * 3;
+		}
+
+		memcpy(indices, newIndices.data(), numIndices * sizeof(UINT32));
+	}
+
+	void MeshUtility::optimizeVertexFetch(const SPtr<MeshData>& meshData)
+	{
+		if (meshData->getIndexType() != IT_32BIT)
+		{
+			LOGWRN("Vertex fetch optimization is only supported for meshes with 32-bit indices.");
+			return;
+		}
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32* indices = meshData->getIndices32();
+
+		// Assign new vertex positions in order of first use by the index buffer
+		static constexpr UINT32 UNUSED = 0xFFFFFFFF;
+		Vector<UINT32> remap(numVertices, UNUSED);
+
+		UINT32 nextIdx = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32& mapped = remap[indices[i]];
+			if (mapped == UNUSED)
+				mapped = nextIdx++;
+
+			indices[i] = mapped;
+		}
+
+		// Unreferenced vertices keep their relative order, at the end of the buffer
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			if (remap[i] == UNUSED)
+				remap[i] = nextIdx++;
+		}
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		Vector<UINT8> scratch;
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+
+			UINT8* data = meshData->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+			UINT32 vertexStride = vertexDesc->getVertexStride(element.getStreamIdx());
+			UINT32 elementSize = vertexDesc->getElementSize(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+
+			scratch.resize(numVertices * elementSize);
+			for (UINT32 j = 0; j < numVertices; j++)
+				memcpy(&scratch[remap[j] * elementSize], data + j * vertexStride, elementSize);
+
+			for (UINT32 j = 0; j < numVertices; j++)
+				memcpy(data + j * vertexStride, &scratch[j * elementSize], elementSize);
+		}
+	}
+
+	void MeshUtility::optimizeForRendering(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+		bool reorderVertices)
+	{
+		if (meshData->getIndexType() != IT_32BIT)
+		{
+			LOGWRN("Mesh optimization is only supported for meshes with 32-bit indices.");
+			return;
+		}
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+
+		UINT8* positionData = nullptr;
+		UINT32 positionStride = 0;
+		if (positionElement != nullptr)
+		{
+			positionData = meshData->getElementData(VES_POSITION);
+			positionStride = vertexDesc->getVertexStride(positionElement->getStreamIdx());
+		}
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32* indices = meshData->getIndices32();
+
+		Vector<SubMesh> ranges = subMeshes;
+		if (ranges.empty())
+			ranges.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+
+		for (auto& subMesh : ranges)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				continue;
+
+			optimizeVertexCache(indices + subMesh.indexOffset, subMesh.indexCount, numVertices);
+
+			if (positionData != nullptr)
+			{
+				optimizeOverdraw(positionData, numVertices, positionStride, indices + subMesh.indexOffset,
+					subMesh.indexCount);
+			}
+		}
+
+		if (reorderVertices)
+			optimizeVertexFetch(meshData);
 	}
 
 	void MeshUtility::clip2D(UINT8* vertices, UINT8* uvs, UINT32 numTris, UINT32 vertexStride, const Vector<Plane>& clipPlanes,
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Math/BsVector3.h"
+#include "RenderAPI/BsSubMesh.h"
 
 namespace bs
 {
@@ -97,9 +98,104 @@ namespace bs
 		 * a corner of a cube should be split into three vertices used by three triangles in order for the normals to be
 		 * valid.)
 		 */
-		static void calculateTangentSpace(Vector3* vertices, Vector2* uv, UINT8* indices, UINT32 numVertices, 
+		static void calculateTangentSpace(Vector3* vertices, Vector2* uv, UINT8* indices, UINT32 numVertices,
 			UINT32 numIndices, Vector3* normals, Vector3* tangents, Vector3* bitangents, UINT32 indexSize = 4);
 
+		/**
+		 * Simplifies triangle geometry by iteratively collapsing the edges that introduce the least amount of error, as
+		 * measured by a quadric error metric. Collapses only ever snap a vertex onto one of its neighbours, meaning the
+		 * vertex buffer remains untouched and the output indices keep referencing the original vertices.
+		 *
+		 * @param[in]	vertices			Set of vertices containing vertex positions.
+		 * @param[in]	numVertices			Number of vertices in the @p vertices array.
+		 * @param[in]	vertexStride		Number of bytes between two vertices in the @p vertices array. If zero the
+		 *									vertices are assumed to be tightly packed.
+		 * @param[in]	indices				Set of 32-bit indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numIndices			Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	targetNumIndices	Number of indices to attempt to reduce the geometry to. The output may end up
+		 *									slightly above this value since indices are only removed in whole triangles,
+		 *									or below it if further collapses were free of error.
+		 * @param[out]	output				Pre-allocated buffer that will receive the simplified indices. Must be large
+		 *									enough to hold @p numIndices entries.
+		 * @return							Number of indices written to the @p output buffer.
+		 */
+		static UINT32 simplify(UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, const UINT32* indices,
+			UINT32 numIndices, UINT32 targetNumIndices, UINT32* output);
+
+		/**
+		 * Generates a level of detail chain for the provided mesh data by appending simplified versions of its index
+		 * geometry to the index buffer. Vertex data is left untouched, meaning all levels share the same vertex buffers.
+		 *
+		 * @param[in]	meshData			Mesh data containing the vertices and 32-bit indices to generate the chain
+		 *									from. Not modified.
+		 * @param[in]	subMeshes			Sub-meshes determining index ranges of the base (most detailed) level. If
+		 *									empty the entire index buffer is treated as a single sub-mesh.
+		 * @param[in]	numLodLevels		Number of additional levels to generate, not counting the base level.
+		 * @param[in]	reductionFactor		Fraction of indices in range (0, 1) that each level should contain, relative
+		 *									to the previous level.
+		 * @param[out]	lodSubMeshes		Sub-mesh ranges of the generated levels, grouped by level. Contains
+		 *									@p numLodLevels * (number of sub-meshes) entries.
+		 * @param[out]	lodScreenSizes		Screen size thresholds, one per generated level. A level should be used for
+		 *									rendering when the on-screen size of the mesh bounds, relative to the view
+		 *									height, falls below the threshold of the previous level.
+		 * @return							New mesh data containing the base geometry followed by the generated levels,
+		 *									or the unmodified input if no levels could be generated.
+		 */
+		static SPtr<MeshData> generateLodChain(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			UINT32 numLodLevels, float reductionFactor, Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes);
+
+		/**
+		 * Reorders triangles so vertices shared between nearby triangles are close together in the draw sequence,
+		 * improving hits in the GPU's post-transform vertex cache. Based on Forsyth's linear-speed vertex cache
+		 * optimization. Operates in-place and only changes the order of triangles, never their contents.
+		 *
+		 * @param[in]	indices		Set of 32-bit indices containing indexes into vertex array for each triangle.
+		 *							Reordered in-place.
+		 * @param[in]	numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	numVertices	Number of vertices in the vertex array the indices point to.
+		 */
+		static void optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices);
+
+		/**
+		 * Reorders clusters of consecutive triangles so outward-facing geometry is drawn first, reducing overdraw for
+		 * mostly-convex objects viewed from the outside. Meant to run after optimizeVertexCache(), whose ordering is
+		 * preserved within each cluster. Operates in-place.
+		 *
+		 * @param[in]	vertices			Set of vertices containing vertex positions.
+		 * @param[in]	numVertices			Number of vertices in the @p vertices array.
+		 * @param[in]	vertexStride		Number of bytes between two vertices in the @p vertices array. If zero the
+		 *									vertices are assumed to be tightly packed.
+		 * @param[in]	indices				Set of 32-bit indices containing indexes into vertex array for each
+		 *									triangle. Reordered in-place.
+		 * @param[in]	numIndices			Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	trianglesPerCluster	Number of consecutive triangles to sort as a unit.
+		 */
+		static void optimizeOverdraw(UINT8* vertices, UINT32 numVertices, UINT32 vertexStride, UINT32* indices,
+			UINT32 numIndices, UINT32 trianglesPerCluster = 128);
+
+		/**
+		 * Reorders the vertices of the provided mesh data by their first use in the index buffer, improving memory
+		 * access locality during vertex fetch. All vertex streams are permuted and all indices remapped, in-place.
+		 * External data referencing vertices by index (for example morph shapes) is invalidated by this.
+		 *
+		 * @param[in]	meshData	Mesh data with 32-bit indices to reorder.
+		 */
+		static void optimizeVertexFetch(const SPtr<MeshData>& meshData);
+
+		/**
+		 * Runs the full set of index and vertex buffer optimizations on the provided mesh data, as a post-import or
+		 * post-generation pass. Each triangle list sub-mesh is reordered for vertex cache efficiency and reduced
+		 * overdraw, and optionally the vertex buffers are reordered for fetch locality.
+		 *
+		 * @param[in]	meshData		Mesh data with 32-bit indices to optimize, in-place.
+		 * @param[in]	subMeshes		Sub-meshes determining the index ranges to optimize separately. If empty the
+		 *								entire index buffer is treated as a single triangle list.
+		 * @param[in]	reorderVertices	True to also reorder vertices for fetch locality. Disable when external data
+		 *								references vertices by index (for example morph shapes).
+		 */
+		static void optimizeForRendering(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			bool reorderVertices = true);
+
 		/**
 		 * Clips a set of two-dimensional vertices and uv coordinates against a set of arbitrary planes.
 		 *
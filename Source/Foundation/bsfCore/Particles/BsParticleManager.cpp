@@ -0,0 +1,69 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Particles/BsParticleManager.h"
+#include "Particles/BsParticleSystem.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	void ParticleManager::simulate(float timeDelta)
+	{
+		Vector<ParticleSystem*> systems;
+		systems.reserve(mSystems.size());
+
+		for (auto& system : mSystems)
+		{
+			// GPU simulated systems are advanced by the renderer instead
+			if (system->getGpuSimulated())
+				continue;
+
+			systems.push_back(system);
+		}
+
+		if (systems.empty())
+			return;
+
+		// Group systems into one task per worker rather than one task per system. Scenes commonly contain many small
+		// systems (sparks, smoke puffs) whose simulation is cheaper than the task scheduling around it, so per-system
+		// tasks mostly measure scheduler overhead.
+		const UINT32 numWorkers = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+		const UINT32 numTasks = std::min((UINT32)systems.size(), numWorkers);
+		const UINT32 systemsPerTask = ((UINT32)systems.size() + numTasks - 1) / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		tasks.reserve(numTasks);
+
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			const UINT32 start = i * systemsPerTask;
+			const UINT32 end = std::min(start + systemsPerTask, (UINT32)systems.size());
+
+			SPtr<Task> task = Task::create("ParticleSimulation", [&systems, start, end, timeDelta]()
+			{
+				for (UINT32 j = start; j < end; j++)
+					systems[j]->_simulate(timeDelta);
+			});
+
+			tasks.push_back(task);
+			TaskScheduler::instance().addTask(task);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	void ParticleManager::registerParticleSystem(ParticleSystem* system)
+	{
+		mSystems.insert(system);
+	}
+
+	void ParticleManager::unregisterParticleSystem(ParticleSystem* system)
+	{
+		mSystems.erase(system);
+	}
+
+	ParticleManager& gParticles()
+	{
+		return ParticleManager::instance();
+	}
+}
@@ -0,0 +1,43 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	class ParticleSystem;
+
+	/** @addtogroup Particles-Internal
+	 *  @{
+	 */
+
+	/** Keeps track of all active particle systems and advances their simulation on worker threads. */
+	class BS_CORE_EXPORT ParticleManager : public Module<ParticleManager>
+	{
+	public:
+		/**
+		 * Advances the simulation of all active particle systems by the specified amount of time. Every system is
+		 * simulated as a separate task, since systems are fully independent of one another. Blocks until all systems
+		 * have finished simulating.
+		 */
+		void simulate(float timeDelta);
+
+	private:
+		friend class ParticleSystem;
+
+		/** Must be called by a ParticleSystem upon construction. */
+		void registerParticleSystem(ParticleSystem* system);
+
+		/** Must be called by a ParticleSystem before destruction. */
+		void unregisterParticleSystem(ParticleSystem* system);
+
+		UnorderedSet<ParticleSystem*> mSystems;
+	};
+
+	/** Provides easier access to ParticleManager. */
+	BS_CORE_EXPORT ParticleManager& gParticles();
+
+	/** @} */
+}
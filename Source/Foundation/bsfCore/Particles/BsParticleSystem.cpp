@@ -4,189 +4,81 @@
 #include "Mesh/BsMesh.h"
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "Mesh/BsMeshUtility.h"
+#include "Particles/BsParticleManager.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
-	/** Handles buffers containing particle data and their allocation/deallocation. */
-	struct ParticleSetData
+	void ColorDistribution::bakeLookupTable(UINT32 numSamples, bool lerpSamples)
 	{
-		/** Creates a new set and allocates enough space for @p capacity particles. */
-		ParticleSetData(UINT32 capacity)
-			:capacity(capacity)
-		{
-			allocate();
-		}
+		clearLookupTable();
 
-		/** 
-		 * Creates a new set, allocates enough space for @p capacity particles and initializes the particles by copying
-		 * them from the @p other set. 
-		 */
-		ParticleSetData(UINT32 capacity, const ParticleSetData& other)
-			:capacity(capacity)
-		{
-			allocate();
-			copy(other);
-		}
+		if (mType != PDT_Curve && mType != PDT_RandomCurveRange)
+			return;
 
-		/** Moves data from @p other to this set. */
-		ParticleSetData(ParticleSetData&& other) noexcept
-		{
-			move(other);
-		}
+		numSamples = std::max(numSamples, 2U);
+		mLUTLerp = lerpSamples;
 
-		/** Moves data from @p other to this set. */
-		ParticleSetData& operator=(ParticleSetData&& other) noexcept
-		{
-			if(this != &other)
-			{
-				free();
-				move(other);
-			}
-			
-			return *this;
-		}
-
-		~ParticleSetData()
-		{
-			free();
-		}
+		// Gradient times are normalized, so the table covers the [0, 1] range
+		const float step = 1.0f / (float)(numSamples - 1);
 
-		UINT32 capacity = 0;
+		mMinLUT.resize(numSamples);
+		for (UINT32 i = 0; i < numSamples; i++)
+			mMinLUT[i] = mMinGradient.evaluate(i * step);
 
-		Vector3* position = nullptr;
-		Vector3* velocity = nullptr;
-		Vector3* size = nullptr;
-		float* lifetime = nullptr;
-		RGBA* color = nullptr;
-
-	private:
-		/** 
-		 * Allocates a new set of buffers with enough space to store number of particles equal to the current capacity. *
-		 * Called must ensure any previously allocated buffer is freed by calling free().
-		 */
-		void allocate()
-		{
-			alloc.
-				reserve<Vector3>(capacity).
-				reserve<Vector3>(capacity).
-				reserve<Vector3>(capacity).
-				reserve<float>(capacity).
-				reserve<RGBA>(capacity);
-
-			position = alloc.alloc<Vector3>(capacity);
-			velocity = alloc.alloc<Vector3>(capacity);
-			size = alloc.alloc<Vector3>(capacity);
-			lifetime = alloc.alloc<float>(capacity);
-			color = alloc.alloc<RGBA>(capacity);
-		}
-
-		/** Frees the internal buffers. */
-		void free()
-		{
-			if(position) alloc.free(position);
-			if(velocity) alloc.free(velocity);
-			if(size) alloc.free(size);
-			if(lifetime) alloc.free(lifetime);
-			if(color) alloc.free(color);
-		}
-
-		/** Transfers ownership of @p other internal buffers to this object. */
-		void move(ParticleSetData& other)
-		{
-			position = other.position; other.position = nullptr;
-			velocity = other.velocity; other.velocity = nullptr;
-			size = other.size; other.size = nullptr;
-			lifetime = other.lifetime; other.lifetime = nullptr;
-			color = other.color; other.color = nullptr;
-			capacity = other.capacity; other.capacity = 0;
-			alloc = std::move(other.alloc);
-		}
-
-		/** Copies data from @p other buffers to this object. */
-		void copy(const ParticleSetData& other)
+		if (mType == PDT_RandomCurveRange)
 		{
-			assert(capacity >= other.capacity);
-
-			memcpy(position, other.position, other.capacity * sizeof(Vector3));
-			memcpy(velocity, other.velocity, other.capacity * sizeof(Vector3));
-			memcpy(size, other.size, other.capacity * sizeof(Vector3));
-			memcpy(lifetime, other.lifetime, other.capacity * sizeof(float));
-			memcpy(color, other.color, other.capacity * sizeof(Color));
+			mMaxLUT.resize(numSamples);
+			for (UINT32 i = 0; i < numSamples; i++)
+				mMaxLUT[i] = mMaxGradient.evaluate(i * step);
 		}
+	}
 
-		GroupAlloc alloc;
-	};
+	void ColorDistribution::clearLookupTable()
+	{
+		mMinLUT.clear();
+		mMaxLUT.clear();
+	}
 
-	/** Provides a simple and fast way to allocate and deallocate particles. */
-	class ParticleSet : public INonCopyable
+	void FloatDistribution::bakeLookupTable(UINT32 numSamples, bool lerpSamples)
 	{
-		/** Determines how much to increase capacity once the cap is reached, in percent. */
-		static constexpr float CAPACITY_SCALE = 1.2f; // 20%
+		clearLookupTable();
 
-	public:
-		/** 
-		 * Constructs a new particle set with enough space to hold @p capacity particles. The set will automatically 
-		 * grow to larger capacity if the limit is reached. 
-		 */
-		ParticleSet(UINT32 capacity)
-			:mParticles(capacity)
-		{ }
+		if (mType != PDT_Curve && mType != PDT_RandomCurveRange)
+			return;
 
-		/** 
-		 * Allocates a number of new particles and returns the index to the particle. Note that the returned index is not
-		 * persistent and can become invalid after a call to freeParticle(). Returns the index to the first allocated
-		 * particle.
-		 */
-		UINT32 allocParticles(UINT32 count)
-		{
-			const UINT32 particleIdx = mCount;
-			mCount += count;
+		numSamples = std::max(numSamples, 2U);
+		mLUTLerp = lerpSamples;
 
-			if(mCount > mParticles.capacity)
-			{
-				const auto newCapacity = (UINT32)(mCount * CAPACITY_SCALE);
-				ParticleSetData newData(newCapacity, mParticles);
-				mParticles = std::move(newData);
-			}
+		mLUTLength = mMinCurve.getLength();
+		if (mType == PDT_RandomCurveRange)
+			mLUTLength = std::max(mLUTLength, mMaxCurve.getLength());
 
-			return particleIdx;
-		}
+		mLUTScale = mLUTLength > 0.0f ? (float)(numSamples - 1) / mLUTLength : 0.0f;
 
-		/** Deallocates a particle. Can invalidate particle indices. */
-		void freeParticle(UINT32 idx)
-		{
-			// Note: We always keep the active particles sequential. This makes it faster to iterate over all particles, but
-			// increases the cost when removing particles. Considering iteration should happen many times per-particle,
-			// while removal will happen only once, this should be the more performant approach, but will likely be worth
-			// profiling in the future. An alternative approach is to flag dead particles without moving them.
+		const float step = mLUTLength / (float)(numSamples - 1);
 
-			assert(idx < mCount);
+		mMinLUT.resize(numSamples);
+		for (UINT32 i = 0; i < numSamples; i++)
+			mMinLUT[i] = mMinCurve.evaluate(i * step);
 
-			const UINT32 lastIdx = mCount - 1;
-			if(idx != lastIdx)
-			{
-				std::swap(mParticles.position[idx], mParticles.position[lastIdx]);
-				std::swap(mParticles.velocity[idx], mParticles.velocity[lastIdx]);
-				std::swap(mParticles.size[idx], mParticles.size[lastIdx]);
-				std::swap(mParticles.lifetime[idx], mParticles.lifetime[lastIdx]);
-				std::swap(mParticles.color[idx], mParticles.color[lastIdx]);
-			}
-
-			mCount--;
+		if (mType == PDT_RandomCurveRange)
+		{
+			mMaxLUT.resize(numSamples);
+			for (UINT32 i = 0; i < numSamples; i++)
+				mMaxLUT[i] = mMaxCurve.evaluate(i * step);
 		}
+	}
 
-		/** Returns all data about the particles. Active particles are always sequential at the start of the buffer. */
-		ParticleSetData& getParticles() { return mParticles; }
-
-		/** Returns the number of particles that are currently active. */
-		UINT32 getParticleCount() const { return mCount; }
-
-	private:
-		ParticleSetData mParticles;
-		UINT32 mCount = 0;
-	};
+	void FloatDistribution::clearLookupTable()
+	{
+		mMinLUT.clear();
+		mMaxLUT.clear();
+		mLUTScale = 0.0f;
+		mLUTLength = 0.0f;
+	}
 
-	/** 
+	/**
 	 * Calculates and stores per-triangle weights that can be used for easily picking a random triangle on a mesh, ensuring
 	 * larger triangles are picked more likely.
 	 */
@@ -1349,4 +1241,124 @@ namespace bs
 		return bs_unique_ptr(output);
 	}
 
+
+	void ParticleEmitter::spawn(float timeDelta, float time, const Random& random, ParticleSet& particles,
+		const ParticleEmitterState& state) const
+	{
+		if (mShape == nullptr)
+			return;
+
+		mEmitAccumulator += mEmissionRate.evaluate(time, random.getUNorm()) * timeDelta;
+		auto numToSpawn = (UINT32)mEmitAccumulator;
+		mEmitAccumulator -= (float)numToSpawn;
+
+		if (numToSpawn == 0)
+			return;
+
+		const UINT32 firstIdx = particles.getParticleCount();
+		mShape->spawn(random, particles, numToSpawn, state);
+
+		ParticleSetData& particleData = particles.getParticles();
+		const UINT32 end = firstIdx + numToSpawn;
+		for (UINT32 i = firstIdx; i < end; i++)
+		{
+			const float factor = random.getUNorm();
+
+			// Shapes output the spawn normal in the velocity entry, convert it to a velocity using the initial speed
+			particleData.velocity[i] *= mInitialSpeed.evaluate(time, factor);
+			particleData.lifetime[i] = mInitialLifetime.evaluate(time, factor);
+
+			const float size = mInitialSize.evaluate(time, factor);
+			particleData.size[i] = Vector3(size, size, size);
+
+			particleData.color[i] = mInitialColor.evaluate(time, factor);
+		}
+	}
+
+	ParticleSystem::ParticleSystem()
+		:mParticleSet(INITIAL_CAPACITY)
+	{
+		ParticleManager::instance().registerParticleSystem(this);
+	}
+
+	ParticleSystem::~ParticleSystem()
+	{
+		ParticleManager::instance().unregisterParticleSystem(this);
+
+		for (auto& emitter : mEmitters)
+			bs_delete(emitter);
+	}
+
+	UINT32 ParticleSystem::addEmitter(ParticleEmitter* emitter)
+	{
+		mEmitters.push_back(emitter);
+		return (UINT32)mEmitters.size() - 1;
+	}
+
+	void ParticleSystem::_simulate(float timeDelta)
+	{
+		mTime += timeDelta;
+
+		ParticleEmitterState emitterState;
+		bs_zero_out(emitterState);
+
+		for (auto& emitter : mEmitters)
+			emitter->spawn(timeDelta, mTime, mRandom, mParticleSet, emitterState);
+
+		UINT32 numParticles = mParticleSet.getParticleCount();
+		ParticleSetData& particleData = mParticleSet.getParticles();
+
+		integrate(particleData, numParticles, timeDelta);
+
+		// Free expired particles. The set swaps in the last particle on free, so only advance when the current particle
+		// survives.
+		for (UINT32 i = 0; i < numParticles;)
+		{
+			if (particleData.lifetime[i] <= 0.0f)
+			{
+				mParticleSet.freeParticle(i);
+				numParticles--;
+			}
+			else
+				i++;
+		}
+	}
+
+	void ParticleSystem::integrate(ParticleSetData& particles, UINT32 count, float timeDelta)
+	{
+		// Positions and velocities are tightly packed float triplets, so they can be integrated as one long float array,
+		// four entries at a time
+		auto* positions = (float*)particles.position;
+		const auto* velocities = (const float*)particles.velocity;
+
+		const UINT32 numEntries = count * 3;
+		const simd::float32x4 dt = simd::make_float(timeDelta);
+
+		UINT32 i = 0;
+		for (; i + 4 <= numEntries; i += 4)
+		{
+			simd::float32x4 velocity = simd::load_u(velocities + i);
+			simd::float32x4 position = simd::load_u(positions + i);
+
+			simd::float32x4 newPosition = position + velocity * dt;
+			simd::store_u(positions + i, newPosition);
+		}
+
+		for (; i < numEntries; i++)
+			positions[i] += velocities[i] * timeDelta;
+
+		float* lifetimes = particles.lifetime;
+
+		i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			simd::float32x4 lifetime = simd::load_u(lifetimes + i);
+
+			simd::float32x4 newLifetime = lifetime - dt;
+			simd::store_u(lifetimes + i, newLifetime);
+		}
+
+		for (; i < count; i++)
+			lifetimes[i] -= timeDelta;
+	}
 }
@@ -75,9 +75,15 @@ namespace bs
 			case PDT_RandomRange:
 				return Color::lerp(byteFactor, mMinColor, mMaxColor);
 			case PDT_Curve:
+				if (!mMinLUT.empty())
+					return sampleLUT(mMinLUT, t);
+
 				return mMinGradient.evaluate(t);
 			case PDT_RandomCurveRange:
 				{
+					if (!mMinLUT.empty())
+						return Color::lerp(byteFactor, sampleLUT(mMinLUT, t), sampleLUT(mMaxLUT, t));
+
 					const RGBA minColor = mMinGradient.evaluate(t);
 					const RGBA maxColor = mMaxGradient.evaluate(t);
 
@@ -86,12 +92,48 @@ namespace bs
 			}
 		}
 
+		/**
+		 * Bakes the distribution's gradients into fixed-resolution lookup tables, turning subsequent evaluations
+		 * into an indexed load instead of a control-point search. Useful when the distribution is evaluated many
+		 * times per frame (e.g. per particle). The tables are a snapshot - re-bake if the distribution changes.
+		 * Has no effect on constant or random-range distributions.
+		 *
+		 * @param[in]	numSamples	Resolution of the tables. Higher values follow the gradient more accurately but
+		 *							use more memory.
+		 * @param[in]	lerpSamples	If true neighboring samples are linearly interpolated, otherwise the nearest
+		 *							sample is returned. Nearest sampling is cheaper but produces visibly stepped
+		 *							output at lower resolutions.
+		 */
+		void bakeLookupTable(UINT32 numSamples = 128, bool lerpSamples = true);
+
+		/** Frees any tables created by bakeLookupTable(), returning evaluation to the gradient control points. */
+		void clearLookupTable();
+
 	private:
+		/** Samples a baked lookup table at the specified normalized time. */
+		RGBA sampleLUT(const Vector<RGBA>& lut, float t) const
+		{
+			const UINT32 numSamples = (UINT32)lut.size();
+			const float x = Math::clamp01(t) * (float)(numSamples - 1);
+			const UINT32 idx = (UINT32)x;
+
+			if (!mLUTLerp)
+				return lut[std::min((UINT32)(x + 0.5f), numSamples - 1)];
+
+			const UINT32 nextIdx = std::min(idx + 1, numSamples - 1);
+			const UINT32 byteFrac = Bitwise::unormToUint<8>(x - (float)idx);
+
+			return Color::lerp(byteFrac, lut[idx], lut[nextIdx]);
+		}
+
 		PropertyDistributionType mType;
 		RGBA mMinColor;
 		RGBA mMaxColor;
 		ColorGradient mMinGradient;
 		ColorGradient mMaxGradient;
+		Vector<RGBA> mMinLUT;
+		Vector<RGBA> mMaxLUT;
+		bool mLUTLerp = true;
 	};
 
 	/**  Specifies a floating point value as a distribution, which can include a constant value, random range or a curve. */
@@ -138,9 +180,15 @@ namespace bs
 			case PDT_RandomRange:
 				return Math::lerp(factor, mMinValue, mMaxValue);
 			case PDT_Curve:
+				if (!mMinLUT.empty())
+					return sampleLUT(mMinLUT, t);
+
 				return mMinCurve.evaluate(t);
 			case PDT_RandomCurveRange:
 				{
+					if (!mMinLUT.empty())
+						return Math::lerp(factor, sampleLUT(mMinLUT, t), sampleLUT(mMaxLUT, t));
+
 					const float minValue = mMinCurve.evaluate(t);
 					const float maxValue = mMaxCurve.evaluate(t);
 
@@ -148,15 +196,243 @@ namespace bs
 				}
 			}
 		}
+
+		/**
+		 * Bakes the distribution's curves into fixed-resolution lookup tables, turning subsequent evaluations into
+		 * an indexed load instead of a keyframe search. Useful when the distribution is evaluated many times per
+		 * frame (e.g. per particle). The tables are a snapshot - re-bake if the distribution changes. Has no effect
+		 * on constant or random-range distributions.
+		 *
+		 * @param[in]	numSamples	Resolution of the tables. Higher values follow the curve more accurately but use
+		 *							more memory.
+		 * @param[in]	lerpSamples	If true neighboring samples are linearly interpolated, otherwise the nearest
+		 *							sample is returned. Nearest sampling is cheaper but produces visibly stepped
+		 *							output at lower resolutions.
+		 */
+		void bakeLookupTable(UINT32 numSamples = 128, bool lerpSamples = true);
+
+		/** Frees any tables created by bakeLookupTable(), returning evaluation to the curve keyframes. */
+		void clearLookupTable();
+
 	private:
+		/** Samples a baked lookup table at the specified time, with the same looping behavior as the source curve. */
+		float sampleLUT(const Vector<float>& lut, float t) const
+		{
+			if (mLUTLength > 0.0f)
+			{
+				// Matches the looping behavior of TAnimationCurve::evaluate()
+				if (t < 0.0f || t > mLUTLength)
+				{
+					t = fmod(t, mLUTLength);
+					if (t < 0.0f)
+						t += mLUTLength;
+				}
+			}
+			else
+				t = 0.0f;
+
+			const UINT32 numSamples = (UINT32)lut.size();
+			const float x = t * mLUTScale;
+			const UINT32 idx = (UINT32)x;
+
+			if (!mLUTLerp)
+				return lut[std::min((UINT32)(x + 0.5f), numSamples - 1)];
+
+			const UINT32 nextIdx = std::min(idx + 1, numSamples - 1);
+			return Math::lerp(x - (float)idx, lut[idx], lut[nextIdx]);
+		}
+
 		PropertyDistributionType mType;
 		float mMinValue;
 		float mMaxValue;
 		TAnimationCurve<float> mMinCurve;
 		TAnimationCurve<float> mMaxCurve;
+		Vector<float> mMinLUT;
+		Vector<float> mMaxLUT;
+		float mLUTScale = 0.0f;
+		float mLUTLength = 0.0f;
+		bool mLUTLerp = true;
+	};
+
+	/** Handles buffers containing particle data and their allocation/deallocation. */
+	struct ParticleSetData
+	{
+		/** Creates a new set and allocates enough space for @p capacity particles. */
+		ParticleSetData(UINT32 capacity)
+			:capacity(capacity)
+		{
+			allocate();
+		}
+
+		/** 
+		 * Creates a new set, allocates enough space for @p capacity particles and initializes the particles by copying
+		 * them from the @p other set. 
+		 */
+		ParticleSetData(UINT32 capacity, const ParticleSetData& other)
+			:capacity(capacity)
+		{
+			allocate();
+			copy(other);
+		}
+
+		/** Moves data from @p other to this set. */
+		ParticleSetData(ParticleSetData&& other) noexcept
+		{
+			move(other);
+		}
+
+		/** Moves data from @p other to this set. */
+		ParticleSetData& operator=(ParticleSetData&& other) noexcept
+		{
+			if(this != &other)
+			{
+				free();
+				move(other);
+			}
+			
+			return *this;
+		}
+
+		~ParticleSetData()
+		{
+			free();
+		}
+
+		UINT32 capacity = 0;
+
+		Vector3* position = nullptr;
+		Vector3* velocity = nullptr;
+		Vector3* size = nullptr;
+		float* lifetime = nullptr;
+		RGBA* color = nullptr;
+
+	private:
+		/** 
+		 * Allocates a new set of buffers with enough space to store number of particles equal to the current capacity. *
+		 * Called must ensure any previously allocated buffer is freed by calling free().
+		 */
+		void allocate()
+		{
+			alloc.
+				reserve<Vector3>(capacity).
+				reserve<Vector3>(capacity).
+				reserve<Vector3>(capacity).
+				reserve<float>(capacity).
+				reserve<RGBA>(capacity);
+
+			position = alloc.alloc<Vector3>(capacity);
+			velocity = alloc.alloc<Vector3>(capacity);
+			size = alloc.alloc<Vector3>(capacity);
+			lifetime = alloc.alloc<float>(capacity);
+			color = alloc.alloc<RGBA>(capacity);
+		}
+
+		/** Frees the internal buffers. */
+		void free()
+		{
+			if(position) alloc.free(position);
+			if(velocity) alloc.free(velocity);
+			if(size) alloc.free(size);
+			if(lifetime) alloc.free(lifetime);
+			if(color) alloc.free(color);
+		}
+
+		/** Transfers ownership of @p other internal buffers to this object. */
+		void move(ParticleSetData& other)
+		{
+			position = other.position; other.position = nullptr;
+			velocity = other.velocity; other.velocity = nullptr;
+			size = other.size; other.size = nullptr;
+			lifetime = other.lifetime; other.lifetime = nullptr;
+			color = other.color; other.color = nullptr;
+			capacity = other.capacity; other.capacity = 0;
+			alloc = std::move(other.alloc);
+		}
+
+		/** Copies data from @p other buffers to this object. */
+		void copy(const ParticleSetData& other)
+		{
+			assert(capacity >= other.capacity);
+
+			memcpy(position, other.position, other.capacity * sizeof(Vector3));
+			memcpy(velocity, other.velocity, other.capacity * sizeof(Vector3));
+			memcpy(size, other.size, other.capacity * sizeof(Vector3));
+			memcpy(lifetime, other.lifetime, other.capacity * sizeof(float));
+			memcpy(color, other.color, other.capacity * sizeof(Color));
+		}
+
+		GroupAlloc alloc;
+	};
+
+	/** Provides a simple and fast way to allocate and deallocate particles. */
+	class ParticleSet : public INonCopyable
+	{
+		/** Determines how much to increase capacity once the cap is reached, in percent. */
+		static constexpr float CAPACITY_SCALE = 1.2f; // 20%
+
+	public:
+		/** 
+		 * Constructs a new particle set with enough space to hold @p capacity particles. The set will automatically 
+		 * grow to larger capacity if the limit is reached. 
+		 */
+		ParticleSet(UINT32 capacity)
+			:mParticles(capacity)
+		{ }
+
+		/** 
+		 * Allocates a number of new particles and returns the index to the particle. Note that the returned index is not
+		 * persistent and can become invalid after a call to freeParticle(). Returns the index to the first allocated
+		 * particle.
+		 */
+		UINT32 allocParticles(UINT32 count)
+		{
+			const UINT32 particleIdx = mCount;
+			mCount += count;
+
+			if(mCount > mParticles.capacity)
+			{
+				const auto newCapacity = (UINT32)(mCount * CAPACITY_SCALE);
+				ParticleSetData newData(newCapacity, mParticles);
+				mParticles = std::move(newData);
+			}
+
+			return particleIdx;
+		}
+
+		/** Deallocates a particle. Can invalidate particle indices. */
+		void freeParticle(UINT32 idx)
+		{
+			// Note: We always keep the active particles sequential. This makes it faster to iterate over all particles, but
+			// increases the cost when removing particles. Considering iteration should happen many times per-particle,
+			// while removal will happen only once, this should be the more performant approach, but will likely be worth
+			// profiling in the future. An alternative approach is to flag dead particles without moving them.
+
+			assert(idx < mCount);
+
+			const UINT32 lastIdx = mCount - 1;
+			if(idx != lastIdx)
+			{
+				std::swap(mParticles.position[idx], mParticles.position[lastIdx]);
+				std::swap(mParticles.velocity[idx], mParticles.velocity[lastIdx]);
+				std::swap(mParticles.size[idx], mParticles.size[lastIdx]);
+				std::swap(mParticles.lifetime[idx], mParticles.lifetime[lastIdx]);
+				std::swap(mParticles.color[idx], mParticles.color[lastIdx]);
+			}
+
+			mCount--;
+		}
+
+		/** Returns all data about the particles. Active particles are always sequential at the start of the buffer. */
+		ParticleSetData& getParticles() { return mParticles; }
+
+		/** Returns the number of particles that are currently active. */
+		UINT32 getParticleCount() const { return mCount; }
+
+	private:
+		ParticleSetData mParticles;
+		UINT32 mCount = 0;
 	};
 
-	class ParticleSet;
 
 	/** Contains particle emitter state that varies from frame to frame. */
 	struct ParticleEmitterState
@@ -530,14 +806,50 @@ namespace bs
 		bool m32BitNormals;
 	};
 
-	// TODO - Doc
+	/** Handles spawning of new particles using the specified shape and initial particle property distributions. */
 	class BS_CORE_EXPORT ParticleEmitter
 	{
 	public:
+		/** Determines the shape over which to emit the particles. */
 		void setShape(ParticleEmitterShape* shape) { mShape = shape; }
 
+		/** Determines the number of particles that are emitted every second. */
+		void setEmissionRate(const FloatDistribution& value) { mEmissionRate = value; }
+
+		/** Determines the lifetime of particles when they are initially spawned, in seconds. */
+		void setInitialLifetime(const FloatDistribution& value) { mInitialLifetime = value; }
+
+		/** Determines the speed of the particles along their spawn normals when they are initially spawned. */
+		void setInitialSpeed(const FloatDistribution& value) { mInitialSpeed = value; }
+
+		/** Determines the uniform size of the particles when they are initially spawned. */
+		void setInitialSize(const FloatDistribution& value) { mInitialSize = value; }
+
+		/** Determines the color of the particles when they are initially spawned. */
+		void setInitialColor(const ColorDistribution& value) { mInitialColor = value; }
+
+		/**
+		 * Spawns new particles in the specified time increment, according to the current emission rate.
+		 *
+		 * @param[in]	timeDelta	Time since the last call to this method, in seconds.
+		 * @param[in]	time		Time to evaluate the property distributions at, in seconds.
+		 * @param[in]	random		Random number generator.
+		 * @param[in]	particles	Particle set in which to insert new particles.
+		 * @param[in]	state		Optional state containing per-frame information required by some emitter shapes.
+		 */
+		void spawn(float timeDelta, float time, const Random& random, ParticleSet& particles,
+			const ParticleEmitterState& state) const;
+
 	private:
 		ParticleEmitterShape* mShape = nullptr;
+
+		FloatDistribution mEmissionRate = 50.0f;
+		FloatDistribution mInitialLifetime = 10.0f;
+		FloatDistribution mInitialSpeed = 1.0f;
+		FloatDistribution mInitialSize = 0.1f;
+		ColorDistribution mInitialColor = Color::White;
+
+		mutable float mEmitAccumulator = 0.0f;
 	};
 
 	/** @} */
@@ -546,11 +858,54 @@ namespace bs
 	 *  @{
 	 */
 
-	// TODO - Doc
+	/**
+	 * Controls spawning, lifetime and evolution of a set of particles. Particle data is stored as contiguous per-property
+	 * arrays so the simulation kernels can process it with vector instructions.
+	 */
 	class BS_CORE_EXPORT ParticleSystem : public INonCopyable
 	{
 	public:
+		ParticleSystem();
+		~ParticleSystem();
+
+		/** Registers a new particle emitter and returns its sequential index. The system takes ownership of the emitter. */
 		UINT32 addEmitter(ParticleEmitter* emitter);
+
+		/** Returns the set containing all particles spawned by this system. */
+		ParticleSet& getParticles() { return mParticleSet; }
+
+		/** Returns the number of particles that are currently active. */
+		UINT32 getParticleCount() const { return mParticleSet.getParticleCount(); }
+
+		/**
+		 * Determines should the particles be simulated on the GPU by the renderer. When enabled the CPU simulation is
+		 * skipped entirely for this system, freeing up simulation thread time at the cost of reduced simulation
+		 * flexibility.
+		 */
+		void setGpuSimulated(bool enabled) { mGpuSimulated = enabled; }
+
+		/** @copydoc setGpuSimulated */
+		bool getGpuSimulated() const { return mGpuSimulated; }
+
+		/**
+		 * Advances the simulation by the specified amount of time. Spawns new particles, integrates the motion of the
+		 * active ones and frees those whose lifetime has expired. Normally called by ParticleManager on a worker thread,
+		 * and must not be called while such a simulation is in progress.
+		 */
+		void _simulate(float timeDelta);
+
+	private:
+		/** Integrates positions and remaining lifetimes of the first @p count particles in the set. */
+		static void integrate(ParticleSetData& particles, UINT32 count, float timeDelta);
+
+		/** Initial capacity of the particle set, in number of particles. */
+		static constexpr UINT32 INITIAL_CAPACITY = 256;
+
+		ParticleSet mParticleSet;
+		Vector<ParticleEmitter*> mEmitters;
+		Random mRandom;
+		float mTime = 0.0f;
+		bool mGpuSimulated = false;
 	};
 
 	/** @} */
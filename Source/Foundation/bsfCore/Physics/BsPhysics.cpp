@@ -4,9 +4,42 @@
 #include "Physics/BsRigidbody.h"
 #include "Math/BsRay.h"
 #include "Components/BsCCollider.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
+	/**
+	 * Splits the provided range of scene queries into roughly equal chunks and processes them on the task scheduler's
+	 * worker threads. Runs inline on the calling thread when the range is too small to be worth distributing. Blocks
+	 * until all chunks are processed.
+	 */
+	static void runQueryBatch(UINT32 count, std::function<void(UINT32, UINT32)> worker)
+	{
+		const UINT32 MIN_ENTRIES_PER_TASK = 64;
+
+		UINT32 numTasks = std::min(count / MIN_ENTRIES_PER_TASK, TaskScheduler::instance().getNumWorkers());
+		if (numTasks <= 1)
+		{
+			worker(0, count);
+			return;
+		}
+
+		UINT32 entriesPerTask = count / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			UINT32 start = i * entriesPerTask;
+			UINT32 end = (i == (numTasks - 1)) ? count : (start + entriesPerTask);
+
+			tasks.push_back(Task::create("PhysicsQueryBatch", std::bind(worker, start, end)));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
 	Physics::Physics(const PHYSICS_INIT_DESC& init)
 	{
 		memset(mCollisionMap, 1, CollisionMapSize * CollisionMapSize * sizeof(bool));
@@ -50,6 +83,65 @@ namespace bs
 		return rayCastAny(ray.getOrigin(), ray.getDirection(), layer, max);
 	}
 
+	void Physics::rayCastBatch(const PhysicsRayQuery* queries, UINT32 count, PhysicsQueryResult* results) const
+	{
+		runQueryBatch(count, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				const PhysicsRayQuery& query = queries[i];
+				results[i].hasHit = rayCast(query.ray, results[i].hit, query.layer, query.maxDist);
+			}
+		});
+	}
+
+	void Physics::sphereCastBatch(const PhysicsSphereSweepQuery* queries, UINT32 count, PhysicsQueryResult* results) const
+	{
+		runQueryBatch(count, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				const PhysicsSphereSweepQuery& query = queries[i];
+				results[i].hasHit = sphereCast(query.sphere, query.unitDir, results[i].hit, query.layer, query.maxDist);
+			}
+		});
+	}
+
+	void Physics::sphereOverlapBatch(const PhysicsSphereOverlapQuery* queries, UINT32 count, bool* results) const
+	{
+		runQueryBatch(count, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+				results[i] = sphereOverlapAny(queries[i].sphere, queries[i].layer);
+		});
+	}
+
+	AsyncOp Physics::rayCastBatchAsync(Vector<PhysicsRayQuery> queries) const
+	{
+		AsyncOp asyncOp;
+
+		// Note: The task executes all queries inline rather than fanning out into further tasks, as blocking a worker
+		// thread on child tasks risks starving the scheduler. The caller already gave up same-frame results by going
+		// asynchronous, so latency matters less here.
+		SPtr<Task> task = Task::create("PhysicsQueryBatch",
+			[this, asyncOp, movedQueries = std::move(queries)]() mutable
+		{
+			Vector<PhysicsQueryResult> results(movedQueries.size());
+
+			UINT32 count = (UINT32)movedQueries.size();
+			for (UINT32 i = 0; i < count; i++)
+			{
+				const PhysicsRayQuery& query = movedQueries[i];
+				results[i].hasHit = rayCast(query.ray, results[i].hit, query.layer, query.maxDist);
+			}
+
+			asyncOp._completeOperation(results);
+		});
+
+		TaskScheduler::instance().addTask(task);
+		return asyncOp;
+	}
+
 	Vector<HCollider> rawToComponent(const Vector<Collider*>& raw)
 	{
 		if (raw.empty())
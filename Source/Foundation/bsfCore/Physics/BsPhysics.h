@@ -7,9 +7,12 @@
 #include "BsCorePrerequisites.h"
 #include "Physics/BsPhysicsCommon.h"
 #include "Utility/BsModule.h"
+#include "Threading/BsAsyncOp.h"
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsQuaternion.h"
+#include "Math/BsRay.h"
+#include "Math/BsSphere.h"
 
 namespace bs
 {
@@ -53,6 +56,37 @@ namespace bs
 	typedef Flags<PhysicsFlag> PhysicsFlags;
 	BS_FLAGS_OPERATORS(PhysicsFlag)
 
+	/** A single ray cast within a batched scene query. @see Physics::rayCastBatch */
+	struct PhysicsRayQuery
+	{
+		Ray ray; /**< Ray to cast into the scene. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+		float maxDist = FLT_MAX; /**< Maximum distance at which to detect hits. */
+	};
+
+	/** A single sphere sweep within a batched scene query. @see Physics::sphereCastBatch */
+	struct PhysicsSphereSweepQuery
+	{
+		Sphere sphere; /**< Sphere to sweep through the scene. */
+		Vector3 unitDir = Vector3::UNIT_Z; /**< Unit direction towards which to perform the sweep. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+		float maxDist = FLT_MAX; /**< Maximum distance at which to detect hits. */
+	};
+
+	/** A single sphere overlap test within a batched scene query. @see Physics::sphereOverlapBatch */
+	struct PhysicsSphereOverlapQuery
+	{
+		Sphere sphere; /**< Sphere to check for overlap. */
+		UINT64 layer = BS_ALL_LAYERS; /**< Layers to consider for the query. */
+	};
+
+	/** Result of a single entry of a batched scene query. */
+	struct PhysicsQueryResult
+	{
+		bool hasHit = false; /**< True if the query hit something. */
+		PhysicsQueryHit hit; /**< Information recorded about the hit. Only valid if hasHit is true. */
+	};
+
 	/** Provides global physics settings, factory methods for physics objects and scene queries. */
 	class BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Physics) Physics : public Module<Physics>
 	{
@@ -427,6 +461,53 @@ namespace bs
 		virtual bool convexOverlapAny(const HPhysicsMesh& mesh, const Vector3& position, const Quaternion& rotation,
 			UINT64 layer = BS_ALL_LAYERS) const = 0;
 
+		/******************************************************************************************************************/
+		/********************************************* BATCHED QUERIES ****************************************************/
+		/******************************************************************************************************************/
+
+		/**
+		 * Casts a batch of rays into the scene. The queries are distributed across the task scheduler's worker threads
+		 * and the method blocks until all of them complete. Prefer this over individual rayCast() calls when executing
+		 * a large number of queries at once.
+		 *
+		 * @param[in]	queries		Array of queries to execute.
+		 * @param[in]	count		Number of entries in @p queries.
+		 * @param[out]	results		Pre-allocated array of @p count entries in which the result of each query is
+		 *							recorded, in the same order the queries were submitted.
+		 */
+		virtual void rayCastBatch(const PhysicsRayQuery* queries, UINT32 count, PhysicsQueryResult* results) const;
+
+		/**
+		 * Performs a batch of sphere sweeps into the scene. The queries are distributed across the task scheduler's
+		 * worker threads and the method blocks until all of them complete.
+		 *
+		 * @param[in]	queries		Array of queries to execute.
+		 * @param[in]	count		Number of entries in @p queries.
+		 * @param[out]	results		Pre-allocated array of @p count entries in which the result of each query is
+		 *							recorded, in the same order the queries were submitted.
+		 */
+		virtual void sphereCastBatch(const PhysicsSphereSweepQuery* queries, UINT32 count,
+			PhysicsQueryResult* results) const;
+
+		/**
+		 * Performs a batch of sphere overlap tests against the scene. The queries are distributed across the task
+		 * scheduler's worker threads and the method blocks until all of them complete.
+		 *
+		 * @param[in]	queries		Array of queries to execute.
+		 * @param[in]	count		Number of entries in @p queries.
+		 * @param[out]	results		Pre-allocated array of @p count entries, each recording whether the relevant query
+		 *							overlapped another object.
+		 */
+		virtual void sphereOverlapBatch(const PhysicsSphereOverlapQuery* queries, UINT32 count, bool* results) const;
+
+		/**
+		 * Asynchronous version of rayCastBatch(). The queries execute on a worker thread and the returned operation
+		 * completes once all of them finish, which may be a frame or more after submission. The return value of the
+		 * operation is a Vector<PhysicsQueryResult> with one entry per query, in the same order the queries were
+		 * submitted.
+		 */
+		virtual AsyncOp rayCastBatchAsync(Vector<PhysicsRayQuery> queries) const;
+
 		/******************************************************************************************************************/
 		/************************************************* OPTIONS ********************************************************/
 		/******************************************************************************************************************/
@@ -440,6 +521,18 @@ namespace bs
 		/** Pauses or resumes the physics simulation. */
 		virtual void setPaused(bool paused) = 0;
 
+		/**
+		 * Enables or disables interpolation of simulated rigidbody transforms. When enabled, transforms resulting from
+		 * the fixed-rate simulation are not applied to scene objects immediately, but are instead interpolated between
+		 * the previous and latest simulated state on every frame. This smooths out motion when the frame rate differs
+		 * from the fixed update rate, and spreads out the transform writes so bodies whose interpolated state didn't
+		 * change don't dirty the scene. Introduces up to one fixed step of latency to rendered physics motion.
+		 */
+		virtual void setTransformInterpolation(bool enabled) { }
+
+		/** Checks whether interpolation of simulated rigidbody transforms is enabled. */
+		virtual bool getTransformInterpolation() const { return false; }
+
 		/** @copydoc setGravity() */
 		BS_SCRIPT_EXPORT(n:Gravity,pr:getter)
 		virtual Vector3 getGravity() const = 0;
@@ -613,6 +706,12 @@ namespace bs
 		float typicalSpeed = 9.81f; /**< Typical speed of an object in the scene. */
 		Vector3 gravity = Vector3(0.0f, -9.81f, 0.0f); /**< Initial gravity. */
 		bool initCooking = true; /**< Determines should the cooking library be initialized. */
+		/**
+		 * Maximum number of task scheduler workers the physics simulation is allowed to occupy at once. Set to zero to
+		 * allow physics to use all of them. Physics tasks share worker threads with the rest of the engine, this merely
+		 * limits how many of them the simulation may request concurrently.
+		 */
+		UINT32 maxCpuWorkers = 0;
 		/** Flags that control global physics option. */
 		PhysicsFlags flags = PhysicsFlag::CCT_OverlapRecovery | PhysicsFlag::CCT_PreciseSweeps | PhysicsFlag::CCD_Enable;
 	};
@@ -93,7 +93,8 @@ namespace bs
 		virtual ~Platform();
 
 		/**
-		 * Retrieves the cursor position in screen coordinates.
+		 * Retrieves the cursor position in screen coordinates. Depending on the platform the returned position may be
+		 * a snapshot taken during the last message pump, rather than queried from the OS on every call.
 		 *
 		 * @note	Thread safe.
 		 */
@@ -9,6 +9,7 @@
 #include "Private/Linux/BsLinuxDropTarget.h"
 #include "RenderAPI/BsRenderWindow.h"
 #include "BsCoreApplication.h"
+#include "Threading/BsTripleBuffer.h"
 #include <X11/X.h>
 #include <X11/Xatom.h>
 #include <X11/Xcursor/Xcursor.h>
@@ -87,6 +88,11 @@ namespace bs
 		Rect2I cursorClipRect;
 		LinuxWindow* cursorClipWindow = nullptr;
 		bool cursorClipEnabled = false;
+
+		// Cursor position snapshot, published by the message pump and consumed on the main thread
+		TripleBuffer<Vector2I> cursorPosBuffer;
+		Vector2I cachedCursorPos;
+		bool cursorPosCached = false;
 	};
 
 	static const UINT32 DOUBLE_CLICK_MS = 500;
@@ -263,12 +269,21 @@ namespace bs
 
 	Vector2I Platform::getCursorPosition()
 	{
+		// Use the position sampled by the last message pump where available. Querying the server directly would cost an
+		// X round-trip per call, and contend for the display lock with the message pump.
+		if (mData->cursorPosCached)
+			return mData->cachedCursorPos;
+
 		Lock lock(mData->lock);
 		return _getCursorPosition(mData);
 	}
 
 	void Platform::setCursorPosition(const Vector2I& screenPos)
 	{
+		// Reflect the new position immediately, rather than a frame later when the next pump snapshot arrives
+		if (mData->cursorPosCached)
+			mData->cachedCursorPos = screenPos;
+
 		Lock lock(mData->lock);
 
 		_setCursorPosition(mData, screenPos);
@@ -1362,12 +1377,22 @@ namespace bs
 
 	void Platform::_update()
 	{
+		// Retrieve the cursor position snapshot published by the last message pump, if any
+		if (mData->cursorPosBuffer.read(mData->cachedCursorPos))
+			mData->cursorPosCached = true;
+
 		LinuxDragAndDrop::update();
 	}
 
 	void Platform::_coreUpdate()
 	{
 		_messagePump();
+
+		// Publish a cursor position snapshot for the main thread, so it can query the position without an X round-trip
+		{
+			Lock lock(mData->lock);
+			mData->cursorPosBuffer.write(_getCursorPosition(mData));
+		}
 	}
 
 	void Platform::_shutDown()
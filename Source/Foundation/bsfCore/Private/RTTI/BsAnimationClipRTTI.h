@@ -77,6 +77,9 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mSampleRate, 7)
 			BS_RTTI_MEMBER_PLAIN_NAMED(rootMotionPos, mRootMotion->position, 8)
 			BS_RTTI_MEMBER_PLAIN_NAMED(rootMotionRot, mRootMotion->rotation, 9)
+			BS_RTTI_MEMBER_PLAIN(mUseBakedSamples, 10)
+			BS_RTTI_MEMBER_REFL_ARRAY(mSegments, 11)
+			BS_RTTI_MEMBER_PLAIN(mSegmentLength, 12)
 		BS_END_RTTI_MEMBERS
 	public:
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
@@ -34,6 +34,9 @@ namespace bs
 		bool& getItalic(FontImportOptions* obj) { return obj->mItalic; }
 		void setItalic(FontImportOptions* obj, bool& value) { obj->mItalic = value; }
 
+		bool& getSDF(FontImportOptions* obj) { return obj->mSDF; }
+		void setSDF(FontImportOptions* obj, bool& value) { obj->mSDF = value; }
+
 	public:
 		FontImportOptionsRTTI()
 		{
@@ -43,6 +46,7 @@ namespace bs
 			addPlainField("mRenderMode", 3, &FontImportOptionsRTTI::getRenderMode, &FontImportOptionsRTTI::setRenderMode);
 			addPlainField("mBold", 4, &FontImportOptionsRTTI::getBold, &FontImportOptionsRTTI::setBold);
 			addPlainField("mItalic", 5, &FontImportOptionsRTTI::getItalic, &FontImportOptionsRTTI::setItalic);
+			addPlainField("mSDF", 6, &FontImportOptionsRTTI::getSDF, &FontImportOptionsRTTI::setSDF);
 		}
 
 		const String& getRTTIName() override
@@ -101,7 +101,7 @@ namespace bs
 			UINT32 paramIdx = (UINT32)obj->mParams.size();
 			obj->mParams.push_back(param.data);
 
-			obj->mParamLookup[param.name] = paramIdx;
+			obj->registerParamLookup(param.name, paramIdx);
 		}
 
 		UINT32 getParamDataArraySize(MaterialParams* obj)
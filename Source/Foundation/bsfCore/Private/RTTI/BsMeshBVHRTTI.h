@@ -0,0 +1,44 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Reflection/BsRTTIType.h"
+#include "Mesh/BsMeshBVH.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Core
+	 *  @{
+	 */
+
+	class BS_CORE_EXPORT MeshBVHRTTI : public RTTIType<MeshBVH, IReflectable, MeshBVHRTTI>
+	{
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mNodes, 0)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mTrianglePositions, 1)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mTriangleIndices, 2)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "MeshBVH";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_MeshBVH;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<MeshBVH>();
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
@@ -30,14 +30,29 @@ namespace bs
 		UINT32& getNumIndices(MeshBase* obj) { return obj->mProperties.mNumIndices; }
 		void setNumIndices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumIndices = value; }
 
+		SubMesh& getLodSubMesh(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLodSubMeshes[arrayIdx]; }
+		void setLodSubMesh(MeshBase* obj, UINT32 arrayIdx, SubMesh& value) { obj->mProperties.mLodSubMeshes[arrayIdx] = value; }
+		UINT32 getNumLodSubMeshes(MeshBase* obj) { return (UINT32)obj->mProperties.mLodSubMeshes.size(); }
+		void setNumLodSubMeshes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLodSubMeshes.resize(numElements); }
+
+		float& getLodScreenSize(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLodScreenSizes[arrayIdx]; }
+		void setLodScreenSize(MeshBase* obj, UINT32 arrayIdx, float& value) { obj->mProperties.mLodScreenSizes[arrayIdx] = value; }
+		UINT32 getNumLodScreenSizes(MeshBase* obj) { return (UINT32)obj->mProperties.mLodScreenSizes.size(); }
+		void setNumLodScreenSizes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLodScreenSizes.resize(numElements); }
+
 	public:
 		MeshBaseRTTI()
 		{
 			addPlainField("mNumVertices", 0, &MeshBaseRTTI::getNumVertices, &MeshBaseRTTI::setNumVertices);
 			addPlainField("mNumIndices", 1, &MeshBaseRTTI::getNumIndices, &MeshBaseRTTI::setNumIndices);
 
-			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh, 
+			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh,
 				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+
+			addPlainArrayField("mLodSubMeshes", 3, &MeshBaseRTTI::getLodSubMesh,
+				&MeshBaseRTTI::getNumLodSubMeshes, &MeshBaseRTTI::setLodSubMesh, &MeshBaseRTTI::setNumLodSubMeshes);
+			addPlainArrayField("mLodScreenSizes", 4, &MeshBaseRTTI::getLodScreenSize,
+				&MeshBaseRTTI::getNumLodScreenSizes, &MeshBaseRTTI::setLodScreenSize, &MeshBaseRTTI::setNumLodScreenSizes);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
@@ -6,6 +6,7 @@
 #include "Reflection/BsRTTIType.h"
 #include "BsCoreApplication.h"
 #include "Mesh/BsMesh.h"
+#include "Mesh/BsMeshBVH.h"
 #include "Animation/BsSkeleton.h"
 #include "Animation/BsMorphShapes.h"
 #include "CoreThread/BsCoreThread.h"
@@ -25,6 +26,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mUsage, 2)
 			BS_RTTI_MEMBER_REFLPTR(mSkeleton, 4)
 			BS_RTTI_MEMBER_REFLPTR(mMorphShapes, 5)
+			BS_RTTI_MEMBER_REFLPTR(mBVH, 6)
 		BS_END_RTTI_MEMBERS
 
 		SPtr<MeshData> getMeshData(Mesh* obj) 
@@ -52,6 +52,20 @@ namespace bs
 
 		void setData(PixelData* obj, const SPtr<DataStream>& value, UINT32 size)
 		{
+			// If the serialized data is already resident in memory the stream owns, reference it directly instead of
+			// copying it out, with the stream itself acting as the lifetime token for the referenced range.
+			if (!value->isFile())
+			{
+				SPtr<MemoryDataStream> memStream = std::static_pointer_cast<MemoryDataStream>(value);
+				if (memStream->ownsMemory())
+				{
+					obj->setExternalBuffer(memStream->getCurrentPtr(), memStream);
+					memStream->skip(size);
+
+					return;
+				}
+			}
+
 			obj->allocateInternalBuffer(size);
 			value->read(obj->getData(), size);
 		}
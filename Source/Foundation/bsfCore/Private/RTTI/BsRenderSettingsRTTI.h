@@ -249,6 +249,35 @@ namespace bs
 		}
 	};
 
+	class BS_CORE_EXPORT DynamicResolutionSettingsRTTI :
+		public RTTIType <DynamicResolutionSettings, IReflectable, DynamicResolutionSettingsRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(enabled, 0)
+			BS_RTTI_MEMBER_PLAIN(targetFrameTimeMs, 1)
+			BS_RTTI_MEMBER_PLAIN(minResolutionScale, 2)
+			BS_RTTI_MEMBER_PLAIN(maxResolutionScale, 3)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "DynamicResolutionSettings";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_DynamicResolutionSettings;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<DynamicResolutionSettings>();
+		}
+	};
+
 	class BS_CORE_EXPORT RenderSettingsRTTI : public RTTIType <RenderSettings, IReflectable, RenderSettingsRTTI>
 	{
 	private:
@@ -272,6 +301,11 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(enableIndirectLighting, 16)
 			BS_RTTI_MEMBER_REFL(shadowSettings, 17)
 			BS_RTTI_MEMBER_PLAIN(enableSkybox, 18)
+			BS_RTTI_MEMBER_PLAIN(enableOcclusionCulling, 19)
+			BS_RTTI_MEMBER_PLAIN(enableOrderIndependentTransparency, 20)
+			BS_RTTI_MEMBER_PLAIN(onDemandDrawing, 21)
+			BS_RTTI_MEMBER_REFL(dynamicResolution, 22)
+			BS_RTTI_MEMBER_PLAIN(previewMode, 23)
 		BS_END_RTTI_MEMBERS
 
 	public:
@@ -20,6 +20,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN_ARRAY(mDependencies, 0)
 			BS_RTTI_MEMBER_PLAIN(mAllowAsync, 1)
 			BS_RTTI_MEMBER_PLAIN(mCompressionMethod, 2)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mTransitiveDependencies, 3)
 		BS_END_RTTI_MEMBERS
 
 	public:
@@ -18,9 +18,23 @@ namespace bs
 	 *  @{
 	 */
 
+	/**
+	 * RTTI type for Texture. Deserialization supports a reduced residency mode for streaming - provide a "texSkipMips"
+	 * entry in the serialization parameters and that many of the highest resolution mip levels will be dropped while
+	 * decoding, creating a smaller texture containing just the mip tail. Since each mip level is stored as a separate
+	 * entry in the serialized data the dropped levels can later be streamed in separately, using
+	 * ct::Texture::writeData() for per-mip updates.
+	 */
 	class BS_CORE_EXPORT TextureRTTI : public RTTIType<Texture, Resource, TextureRTTI>
 	{
 	private:
+		/** Transient data tracked during deserialization, stored in Texture::mRTTIData. */
+		struct DeserializationData
+		{
+			Vector<SPtr<PixelData>> pixelData;
+			UINT32 skipMips = 0;
+		};
+
 		BS_BEGIN_RTTI_MEMBERS
 			BS_RTTI_MEMBER_PLAIN(mSize, 0)
 			BS_RTTI_MEMBER_PLAIN_NAMED(height, mProperties.mDesc.height, 2)
@@ -62,9 +76,14 @@ namespace bs
 
 		void setPixelData(Texture* obj, UINT32 idx, SPtr<PixelData> data)
 		{
-			Vector<SPtr<PixelData>>* pixelData = any_cast<Vector<SPtr<PixelData>>*>(obj->mRTTIData);
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(obj->mRTTIData);
+
+			// Discard data for mip levels that were requested to be skipped, right away so it doesn't accumulate
+			UINT32 mipmap = idx % (obj->mProperties.getNumMipmaps() + 1);
+			if (mipmap < deserializationData->skipMips)
+				return;
 
-			(*pixelData)[idx] = data;
+			deserializationData->pixelData[idx] = data;
 		}
 
 		UINT32 getPixelDataArraySize(Texture* obj)
@@ -74,9 +93,9 @@ namespace bs
 
 		void setPixelDataArraySize(Texture* obj, UINT32 size)
 		{
-			Vector<SPtr<PixelData>>* pixelData = any_cast<Vector<SPtr<PixelData>>*>(obj->mRTTIData);
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(obj->mRTTIData);
 
-			pixelData->resize(size);
+			deserializationData->pixelData.resize(size);
 		}
 
 	public:
@@ -92,7 +111,13 @@ namespace bs
 		{
 			Texture* texture = static_cast<Texture*>(obj);
 
-			texture->mRTTIData = bs_new<Vector<SPtr<PixelData>>>();
+			DeserializationData* deserializationData = bs_new<DeserializationData>();
+
+			auto iterFind = params.find("texSkipMips");
+			if (iterFind != params.end())
+				deserializationData->skipMips = (UINT32)iterFind->second;
+
+			texture->mRTTIData = deserializationData;
 		}
 
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
@@ -104,24 +129,42 @@ namespace bs
 
 			TextureProperties& texProps = texture->mProperties;
 
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(texture->mRTTIData);
+			Vector<SPtr<PixelData>>& pixelData = deserializationData->pixelData;
+
+			UINT32 fullNumMips = texProps.getNumMipmaps();
+			UINT32 skipMips = std::min(deserializationData->skipMips, fullNumMips);
+
+			// Drop the highest resolution mip levels if reduced residency was requested, so only the mip tail is
+			// created and uploaded. The dropped levels can be streamed in later.
+			if (skipMips > 0)
+			{
+				texProps.mDesc.width = std::max(texProps.mDesc.width >> skipMips, 1U);
+				texProps.mDesc.height = std::max(texProps.mDesc.height >> skipMips, 1U);
+				texProps.mDesc.depth = std::max(texProps.mDesc.depth >> skipMips, 1U);
+				texProps.mDesc.numMips = fullNumMips - skipMips;
+			}
+
 			// Update pixel format if needed as it's possible the original texture was saved using some other render API
 			// that has an unsupported format.
 			PixelFormat originalFormat = texProps.getFormat();
 			PixelFormat validFormat = TextureManager::instance().getNativeFormat(
 				texProps.getTextureType(), texProps.getFormat(), texProps.getUsage(), texProps.isHardwareGammaEnabled());
 
-			Vector<SPtr<PixelData>>* pixelData = any_cast<Vector<SPtr<PixelData>>*>(texture->mRTTIData);
 			if (originalFormat != validFormat)
 			{
 				texProps.mDesc.format = validFormat;
 
-				for (size_t i = 0; i < pixelData->size(); i++)
+				for (size_t i = 0; i < pixelData.size(); i++)
 				{
-					SPtr<PixelData> origData = pixelData->at(i);
+					SPtr<PixelData> origData = pixelData[i];
+					if (origData == nullptr)
+						continue;
+
 					SPtr<PixelData> newData = PixelData::create(origData->getWidth(), origData->getHeight(), origData->getDepth(), validFormat);
 
 					PixelUtil::bulkPixelConversion(*origData, *newData);
-					(*pixelData)[i] = newData;
+					pixelData[i] = newData;
 				}
 			}
 
@@ -129,16 +172,19 @@ namespace bs
 			// in mRTTIData.
 			texture->initialize();
 
-			for(size_t i = 0; i < pixelData->size(); i++)
+			for(size_t i = 0; i < pixelData.size(); i++)
 			{
-				UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
-				UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
+				if (pixelData[i] == nullptr)
+					continue;
+
+				UINT32 face = (size_t)Math::floor(i / (float)(fullNumMips + 1));
+				UINT32 mipmap = (UINT32)(i % (fullNumMips + 1));
 
-				texture->writeData(pixelData->at(i), face, mipmap, false);
+				texture->writeData(pixelData[i], face, mipmap - skipMips, false);
 			}
 
-			bs_delete(pixelData);
-			texture->mRTTIData = nullptr;	
+			bs_delete(deserializationData);
+			texture->mRTTIData = nullptr;
 		}
 
 		const String& getRTTIName() override
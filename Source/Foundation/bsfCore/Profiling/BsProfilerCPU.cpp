@@ -3,7 +3,9 @@
 #include "Profiling/BsProfilerCPU.h"
 #include "Debug/BsDebug.h"
 #include "Platform/BsPlatform.h"
+#include "FileSystem/BsFileSystem.h"
 #include <chrono>
+#include <fstream>
 
 #if BS_COMPILER == BS_COMPILER_MSVC
 	#include <intrin.h>
@@ -159,6 +161,15 @@ namespace bs
 	}
 
 	BS_THREADLOCAL ProfilerCPU::ThreadInfo* ProfilerCPU::ThreadInfo::activeThread = nullptr;
+	BS_THREADLOCAL ProfilerCPU::EventRingBuffer* ProfilerCPU::EventRingBuffer::activeBuffer = nullptr;
+
+	/**	Returns time elapsed since program start in milliseconds. Matches the time base used by Timer. */
+	static double getTraceEventTime()
+	{
+		nanoseconds timeNowNs = high_resolution_clock::now().time_since_epoch();
+
+		return timeNowNs.count() * 0.000001;
+	}
 
 	ProfilerCPU::ThreadInfo::ThreadInfo()
 		:isActive(false), rootBlock(nullptr), frameAlloc(1024 * 512), activeBlocks(nullptr)
@@ -292,6 +303,13 @@ namespace bs
 
 		for(auto& threadInfo : mActiveThreads)
 			bs_delete<ThreadInfo, ProfilerAlloc>(threadInfo);
+
+		{
+			Lock eventLock(mEventSync);
+
+			for (auto& buffer : mEventBuffers)
+				bs_delete<EventRingBuffer, ProfilerAlloc>(buffer);
+		}
 	}
 
 	void ProfilerCPU::beginThread(const char* name)
@@ -310,6 +328,12 @@ namespace bs
 		}
 
 		thread->begin(name);
+
+		EventRingBuffer* buffer = EventRingBuffer::activeBuffer;
+		if (buffer == nullptr)
+			buffer = registerEventBuffer();
+
+		buffer->threadName = name;
 	}
 
 	void ProfilerCPU::endThread()
@@ -346,6 +370,7 @@ namespace bs
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Basic, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		beginEvent(name);
 		block->basic.beginSample();
 	}
 
@@ -376,6 +401,7 @@ namespace bs
 #endif
 
 		block->basic.endSample();
+		endEvent();
 
 		thread->activeBlocks->pop();
 
@@ -413,6 +439,7 @@ namespace bs
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Precise, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		beginEvent(name);
 		block->precise.beginSample();
 	}
 
@@ -443,6 +470,7 @@ namespace bs
 #endif
 
 		block->precise.endSample();
+		endEvent();
 
 		thread->activeBlocks->pop();
 
@@ -452,6 +480,156 @@ namespace bs
 			thread->activeBlock = ActiveBlock();
 	}
 
+	ProfilerCPU::EventRingBuffer* ProfilerCPU::registerEventBuffer()
+	{
+		EventRingBuffer* buffer = bs_new<EventRingBuffer, ProfilerAlloc>();
+		buffer->threadId = (UINT64)std::hash<std::thread::id>()(std::this_thread::get_id());
+
+		EventRingBuffer::activeBuffer = buffer;
+
+		{
+			Lock lock(mEventSync);
+
+			mEventBuffers.push_back(buffer);
+		}
+
+		return buffer;
+	}
+
+	ProfilerCPU::EventRingBuffer* ProfilerCPU::_registerTraceLane(const char* name)
+	{
+		EventRingBuffer* buffer = bs_new<EventRingBuffer, ProfilerAlloc>();
+
+		// Virtual lanes have no thread, so use the buffer address as a unique lane identifier instead
+		buffer->threadId = (UINT64)(uintptr_t)buffer;
+		buffer->threadName = name;
+		buffer->isVirtualLane = true;
+
+		{
+			Lock lock(mEventSync);
+
+			mEventBuffers.push_back(buffer);
+		}
+
+		return buffer;
+	}
+
+	void ProfilerCPU::_recordTraceEvent(EventRingBuffer* lane, const char* name, double timeMs)
+	{
+		TraceEvent& event = lane->events[lane->count & (EventRingBuffer::CAPACITY - 1)];
+		event.name = name;
+		event.time = timeMs;
+
+		lane->count++;
+	}
+
+	double ProfilerCPU::_getTraceTime()
+	{
+		return getTraceEventTime();
+	}
+
+	void ProfilerCPU::beginEvent(const char* name)
+	{
+		EventRingBuffer* buffer = EventRingBuffer::activeBuffer;
+		if (buffer == nullptr)
+			buffer = registerEventBuffer();
+
+		TraceEvent& event = buffer->events[buffer->count & (EventRingBuffer::CAPACITY - 1)];
+		event.name = name;
+		event.time = getTraceEventTime();
+
+		buffer->count++;
+	}
+
+	void ProfilerCPU::endEvent()
+	{
+		EventRingBuffer* buffer = EventRingBuffer::activeBuffer;
+		if (buffer == nullptr)
+			buffer = registerEventBuffer();
+
+		TraceEvent& event = buffer->events[buffer->count & (EventRingBuffer::CAPACITY - 1)];
+		event.name = nullptr;
+		event.time = getTraceEventTime();
+
+		buffer->count++;
+	}
+
+	void ProfilerCPU::saveTrace(const Path& fileLocation) const
+	{
+		Path parentDir = fileLocation.getDirectory();
+		if (!FileSystem::exists(parentDir))
+			FileSystem::createDir(parentDir);
+
+		std::ofstream output;
+		output.open(fileLocation.toPlatformString().c_str(), std::ios::out);
+		if (output.fail())
+		{
+			LOGWRN("Failed to save trace at: \"" + fileLocation.toString() + "\". Error: " + strerror(errno) + ".");
+			return;
+		}
+
+		// Timestamps are large values measured from program start, so make sure they don't lose precision when printed
+		output << std::fixed;
+		output.precision(3);
+
+		output << "{\"traceEvents\":[";
+
+		Lock lock(mEventSync);
+
+		bool isFirst = true;
+		for (auto& buffer : mEventBuffers)
+		{
+			if (buffer->threadName != nullptr)
+			{
+				if (!isFirst)
+					output << ",";
+
+				isFirst = false;
+				output << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadId
+					<< ",\"args\":{\"name\":\"" << buffer->threadName << "\"}}";
+
+				// Sort virtual lanes below the actual thread lanes
+				if (buffer->isVirtualLane)
+				{
+					output << ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadId
+						<< ",\"args\":{\"sort_index\":100}}";
+				}
+			}
+
+			UINT32 start = buffer->count > EventRingBuffer::CAPACITY ? buffer->count - EventRingBuffer::CAPACITY : 0;
+
+			// If the buffer wrapped we might start in the middle of a block, so skip end events until the first begin
+			bool seenBegin = false;
+			for (UINT32 i = start; i < buffer->count; i++)
+			{
+				const TraceEvent& event = buffer->events[i & (EventRingBuffer::CAPACITY - 1)];
+
+				if (event.name == nullptr && !seenBegin)
+					continue;
+
+				if (!isFirst)
+					output << ",";
+
+				isFirst = false;
+
+				// Timestamps are expected in microseconds
+				if (event.name != nullptr)
+				{
+					seenBegin = true;
+					output << "\n{\"name\":\"" << event.name << "\",\"ph\":\"B\",\"ts\":" << event.time * 1000.0
+						<< ",\"pid\":0,\"tid\":" << buffer->threadId << "}";
+				}
+				else
+				{
+					output << "\n{\"ph\":\"E\",\"ts\":" << event.time * 1000.0
+						<< ",\"pid\":0,\"tid\":" << buffer->threadId << "}";
+				}
+			}
+		}
+
+		output << "\n]}\n";
+	}
+
 	void ProfilerCPU::reset()
 	{
 		ThreadInfo* thread = ThreadInfo::activeThread;
@@ -464,6 +642,8 @@ namespace bs
 	{
 		CPUProfilerReport report;
 
+		aggregateEvents(report);
+
 		ThreadInfo* thread = ThreadInfo::activeThread;
 		if(thread == nullptr)
 			return report;
@@ -760,6 +940,66 @@ namespace bs
 		return report;
 	}
 
+	void ProfilerCPU::aggregateEvents(CPUProfilerReport& report)
+	{
+		Lock lock(mEventSync);
+
+		UnorderedMap<String, UINT32> entryLookup;
+
+		for (auto& buffer : mEventBuffers)
+		{
+			UINT32 end = buffer->count;
+			UINT32 start = buffer->reportedCount;
+
+			// Anything not reported in time got overwritten and can no longer be accounted for
+			if (end - start > EventRingBuffer::CAPACITY)
+				start = end - EventRingBuffer::CAPACITY;
+
+			ProfilerStack<TraceEvent> openEvents;
+			for (UINT32 i = start; i < end; i++)
+			{
+				const TraceEvent& event = buffer->events[i & (EventRingBuffer::CAPACITY - 1)];
+				if (event.name != nullptr)
+				{
+					openEvents.push(event);
+					continue;
+				}
+
+				// End of an event whose begin isn't in the reported range
+				if (openEvents.empty())
+					continue;
+
+				TraceEvent beginEvent = openEvents.top();
+				openEvents.pop();
+
+				double timeMs = event.time - beginEvent.time;
+
+				UINT32 entryIdx;
+				auto iterFind = entryLookup.find(beginEvent.name);
+				if (iterFind == entryLookup.end())
+				{
+					entryIdx = (UINT32)report.mEventEntries.size();
+					entryLookup[beginEvent.name] = entryIdx;
+
+					report.mEventEntries.push_back(CPUProfilerEventEntry());
+					report.mEventEntries.back().name = beginEvent.name;
+				}
+				else
+					entryIdx = iterFind->second;
+
+				CPUProfilerEventEntry& entry = report.mEventEntries[entryIdx];
+				entry.numCalls++;
+				entry.totalTimeMs += timeMs;
+				entry.maxTimeMs = std::max(entry.maxTimeMs, timeMs);
+			}
+
+			buffer->reportedCount = end;
+		}
+
+		for (auto& entry : report.mEventEntries)
+			entry.avgTimeMs = entry.totalTimeMs / entry.numCalls;
+	}
+
 	void ProfilerCPU::estimateTimerOverhead()
 	{
 		// Get an idea of how long timer calls and RDTSC takes
@@ -237,6 +237,32 @@ namespace bs
 			Stack<ActiveBlock, StdFrameAlloc<ActiveBlock>>* activeBlocks;
 		};
 
+	public:
+		/** Single entry in a thread's event buffer, marking the start or the end of a labelled section of code. */
+		struct TraceEvent
+		{
+			const char* name; /**< Label of the section. Null for events marking the end of a section. Not owned. */
+			double time; /**< Time the event was recorded at, in milliseconds since program start. */
+		};
+
+		/**
+		 * Per-thread fixed-size buffer of trace events. Events are recorded without locking or allocation, and the
+		 * oldest events get overwritten once the buffer fills up.
+		 */
+		struct EventRingBuffer
+		{
+			static const UINT32 CAPACITY = 8192; // Must be a power of two
+
+			UINT64 threadId = 0; /**< Identifier of the owning thread. */
+			const char* threadName = nullptr; /**< Name of the owning thread, if registered through beginThread(). */
+			bool isVirtualLane = false; /**< True if the buffer represents a virtual lane rather than an actual thread. */
+			UINT32 count = 0; /**< Total number of events recorded on the thread since program start. */
+			UINT32 reportedCount = 0; /**< Number of events that were already aggregated into a profiler report. */
+			TraceEvent events[CAPACITY];
+
+			static BS_THREADLOCAL EventRingBuffer* activeBuffer;
+		};
+
 	public:
 		ProfilerCPU();
 		~ProfilerCPU();
@@ -293,17 +319,74 @@ namespace bs
 		 */
 		void endSamplePrecise(const char* name);
 
+		/**
+		 * Records the start of a labelled section in the calling thread's event buffer. Unlike beginSample() this
+		 * performs no allocations or lookups, just a timestamped write into a preallocated per-thread ring buffer,
+		 * making it cheap enough to stay enabled in production builds. Must be followed by endEvent().
+		 *
+		 * @param[in]	name	Label for the section. Must be a static string as it is referenced, not copied.
+		 *
+		 * @note	Samples recorded through beginSample() and beginSamplePrecise() are mirrored into the event buffer
+		 *			automatically, so this only needs to be called where full sample instrumentation is too costly.
+		 */
+		void beginEvent(const char* name);
+
+		/** Records the end of the last section started with beginEvent(). */
+		void endEvent();
+
+		/**
+		 * Saves the events recorded in the per-thread event buffers into a JSON file readable by the Chrome tracing
+		 * tool (chrome://tracing), with a separate lane for each thread. Since the buffers are of fixed size only the
+		 * most recently recorded events are available, which makes this primarily useful for examining the time just
+		 * before a hitch.
+		 */
+		void saveTrace(const Path& fileLocation) const;
+
 		/** Clears all sampling data, and ends any unfinished sampling blocks. */
 		void reset();
 
 		/**
 		 * Generates a report from all previously sampled data.
-		 * 			
+		 *
 		 * @note	Generating a report will stop all in-progress sampling. You should make sure
 		 * 			you call endSample* manually beforehand so this doesn't have to happen.
 		 */
 		CPUProfilerReport generateReport();
 
+	public:
+		// ***** INTERNAL ******
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Registers a virtual lane in the exported trace that isn't backed by an actual thread. Used for merging
+		 * events measured on other clocks (e.g. GPU zones) into the same timeline as the thread lanes.
+		 *
+		 * @param[in]	name	Name the lane will be labelled with in the trace. Must be a static string.
+		 * @return				Buffer to record the lane's events into through _recordTraceEvent().
+		 */
+		EventRingBuffer* _registerTraceLane(const char* name);
+
+		/**
+		 * Records an event with an explicitly provided timestamp into a lane created by _registerTraceLane().
+		 * Unlike beginEvent()/endEvent() the caller is responsible for serializing access to the lane.
+		 *
+		 * @param[in]	lane	Lane to record the event into.
+		 * @param[in]	name	Label marking the start of a section, or null to mark the end of the last section.
+		 *						Must remain valid until the trace is saved.
+		 * @param[in]	timeMs	Time to record the event at, in milliseconds on the clock returned by _getTraceTime().
+		 */
+		void _recordTraceEvent(EventRingBuffer* lane, const char* name, double timeMs);
+
+		/**
+		 * Returns the current time on the clock trace events are timestamped with, in milliseconds since program
+		 * start. Use to translate externally measured timings into the trace timeline.
+		 */
+		static double _getTraceTime();
+
+		/** @} */
+
 	private:
 		/**
 		 * Calculates overhead that the timing and sampling methods themselves introduce so we might get more accurate 
@@ -311,6 +394,12 @@ namespace bs
 		 */
 		void estimateTimerOverhead();
 
+		/** Creates and registers the event buffer for the calling thread. */
+		EventRingBuffer* registerEventBuffer();
+
+		/** Aggregates event marker begin/end pairs recorded since the last report into the report's event entries. */
+		void aggregateEvents(CPUProfilerReport& report);
+
 	private:
 		double mBasicTimerOverhead;
 		UINT64 mPreciseTimerOverhead;
@@ -322,6 +411,9 @@ namespace bs
 
 		ProfilerVector<ThreadInfo*> mActiveThreads;
 		Mutex mThreadSync;
+
+		ProfilerVector<EventRingBuffer*> mEventBuffers;
+		mutable Mutex mEventSync;
 	};
 
 	/** Profiling entry containing information about a single CPU profiling block containing timing information. */
@@ -385,6 +477,17 @@ namespace bs
 		ProfilerVector<CPUProfilerPreciseSamplingEntry> childEntries;
 	};
 
+	/** Profiling entry with aggregated information about all recordings of a single event marker. */
+	struct BS_CORE_EXPORT CPUProfilerEventEntry
+	{
+		String name; /**< Label of the marker. */
+		UINT32 numCalls = 0; /**< Number of begin/end pairs recorded for the marker. */
+
+		double avgTimeMs = 0.0; /**< Average time between the begin and end of the marker, per call. In milliseconds. */
+		double maxTimeMs = 0.0; /**< Longest time between the begin and end of the marker. In milliseconds. */
+		double totalTimeMs = 0.0; /**< Total time spent within the marker, across all calls. In milliseconds. */
+	};
+
 	/** CPU profiling report containing all profiling information for a single profiling session. */
 	class BS_CORE_EXPORT CPUProfilerReport
 	{
@@ -403,21 +506,48 @@ namespace bs
 		 */
 		const CPUProfilerPreciseSamplingEntry& getPreciseSamplingData() const { return mPreciseSamplingRootEntry; }
 
+		/**
+		 * Returns a flat list of entries aggregated from the lightweight event markers (see ProfilerCPU::beginEvent())
+		 * recorded on any thread since the previous report. Since markers are held in fixed-size buffers, only events
+		 * still present in them are counted.
+		 */
+		const ProfilerVector<CPUProfilerEventEntry>& getEventData() const { return mEventEntries; }
+
 	private:
 		friend class ProfilerCPU;
 
 		CPUProfilerBasicSamplingEntry mBasicSamplingRootEntry;
 		CPUProfilerPreciseSamplingEntry mPreciseSamplingRootEntry;
+		ProfilerVector<CPUProfilerEventEntry> mEventEntries;
 	};
 
 	/** Provides global access to ProfilerCPU instance. */
 	BS_CORE_EXPORT ProfilerCPU& gProfilerCPU();
 
+	/** Records an event marker spanning the lifetime of the object. See ProfilerCPU::beginEvent(). */
+	class ProfiledEventScope
+	{
+	public:
+		ProfiledEventScope(const char* name) { gProfilerCPU().beginEvent(name); }
+		~ProfiledEventScope() { gProfilerCPU().endEvent(); }
+	};
+
 	/** Shortcut for profiling a single function call. */
 #define PROFILE_CALL(call, name)							\
 	bs::gProfilerCPU().beginSample(name);		\
 	call;													\
 	bs::gProfilerCPU().endSample(name);
 
+	/** @cond INTERNAL */
+#define PROFILE_EVENT_SCOPE_JOIN2(a, b) a##b
+#define PROFILE_EVENT_SCOPE_JOIN(a, b) PROFILE_EVENT_SCOPE_JOIN2(a, b)
+	/** @endcond */
+
+	/**
+	 * Records an event marker spanning the rest of the current scope. Cheap enough to use inside inner loops, see
+	 * ProfilerCPU::beginEvent(). Name must be a static string.
+	 */
+#define PROFILE_EVENT_SCOPE(name) bs::ProfiledEventScope PROFILE_EVENT_SCOPE_JOIN(_bsEventScope, __LINE__)(name)
+
 	/** @} */
 }
@@ -29,6 +29,7 @@ namespace bs
 		mActiveFrame = ActiveFrame();
 
 		mActiveFrame.frameSample.sampleName = "Frame";
+		mActiveFrame.cpuBeginTime = ProfilerCPU::_getTraceTime();
 		beginSampleInternal(mActiveFrame.frameSample);
 
 		mIsFrameActive = true;
@@ -54,12 +55,21 @@ namespace bs
 			BS_EXCEPT(InvalidStateException, "Cannot begin a sample because no frame is active.");
 
 		mActiveFrame.samples.push_back(ActiveSample());
-		ActiveSample& sample = mActiveFrame.samples.back();
+		UINT32 sampleIdx = (UINT32)mActiveFrame.samples.size() - 1;
 
+		ActiveSample& sample = mActiveFrame.samples.back();
 		sample.sampleName = name;
+
+		// If another sample is active, register the new one as its child
+		if (!mActiveSampleIndexes.empty())
+		{
+			mActiveFrame.samples[mActiveSampleIndexes.top()].children.push_back(sampleIdx);
+			sample.hasParent = true;
+		}
+
 		beginSampleInternal(sample);
 
-		mActiveSampleIndexes.push((UINT32)mActiveFrame.samples.size() - 1);
+		mActiveSampleIndexes.push(sampleIdx);
 	}
 
 	void ProfilerGPU::endSample(const ProfilerString& name)
@@ -113,9 +123,13 @@ namespace bs
 			// so if it is complete, we may assume all queries are complete.
 			if (frame.frameSample.activeTimeQuery->isReady())
 			{
+				double cpuBeginTime = frame.cpuBeginTime;
+
 				GPUProfilerReport report = resolveFrame(frame);
 				mUnresolvedFrames.pop();
 
+				emitTraceEvents(report, cpuBeginTime);
+
 				{
 					Lock lock(mMutex);
 					mReadyReports[(mReportHeadPos + mReportCount) % MAX_QUEUE_ELEMENTS] = report;
@@ -136,17 +150,30 @@ namespace bs
 
 		resolveSample(frame.frameSample, report.frameSample);
 
-		for (auto& sample : frame.samples)
+		for (UINT32 i = 0; i < (UINT32)frame.samples.size(); i++)
 		{
-			report.samples.push_back(GPUProfileSample());
-			GPUProfileSample& newSample = report.samples.back();
+			if (frame.samples[i].hasParent)
+				continue;
 
-			resolveSample(sample, newSample);
+			report.samples.push_back(GPUProfileSample());
+			resolveSampleHierarchy(frame, i, report.samples.back());
 		}
 
 		return report;
 	}
 
+	void ProfilerGPU::resolveSampleHierarchy(const ActiveFrame& frame, UINT32 sampleIdx, GPUProfileSample& reportSample)
+	{
+		const ActiveSample& sample = frame.samples[sampleIdx];
+		resolveSample(sample, reportSample);
+
+		for (auto& childIdx : sample.children)
+		{
+			reportSample.children.push_back(GPUProfileSample());
+			resolveSampleHierarchy(frame, childIdx, reportSample.children.back());
+		}
+	}
+
 	void ProfilerGPU::resolveSample(const ActiveSample& sample, GPUProfileSample& reportSample)
 	{
 		reportSample.name = String(sample.sampleName.c_str());
@@ -177,6 +204,40 @@ namespace bs
 		mFreeOcclusionQueries.push(sample.activeOcclusionQuery);
 	}
 
+	void ProfilerGPU::emitTraceEvents(const GPUProfileSample& sample, double startTimeMs)
+	{
+		const char* name = mTraceNames.insert(sample.name).first->c_str();
+		gProfilerCPU()._recordTraceEvent(mTraceLane, name, startTimeMs);
+
+		double childStart = startTimeMs;
+		for (auto& child : sample.children)
+		{
+			emitTraceEvents(child, childStart);
+			childStart += child.timeMs;
+		}
+
+		gProfilerCPU()._recordTraceEvent(mTraceLane, nullptr, startTimeMs + sample.timeMs);
+	}
+
+	void ProfilerGPU::emitTraceEvents(const GPUProfilerReport& report, double startTimeMs)
+	{
+		if (mTraceLane == nullptr)
+			mTraceLane = gProfilerCPU()._registerTraceLane("GPU");
+
+		// Top-level samples are recorded separately from the frame sample, so nest them manually
+		const char* frameName = mTraceNames.insert(report.frameSample.name).first->c_str();
+		gProfilerCPU()._recordTraceEvent(mTraceLane, frameName, startTimeMs);
+
+		double childStart = startTimeMs;
+		for (auto& sample : report.samples)
+		{
+			emitTraceEvents(sample, childStart);
+			childStart += sample.timeMs;
+		}
+
+		gProfilerCPU()._recordTraceEvent(mTraceLane, nullptr, startTimeMs + report.frameSample.timeMs);
+	}
+
 	void ProfilerGPU::beginSampleInternal(ActiveSample& sample)
 	{
 		sample.startStats = RenderStats::instance().getData();
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
 #include "Profiling/BsRenderStats.h"
+#include "Profiling/BsProfilerCPU.h"
 
 namespace bs
 {
@@ -38,13 +39,15 @@ namespace bs
 
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
+
+		Vector<GPUProfileSample> children; /**< Samples that were recorded while this sample was active. */
 	};
 
 	/** Profiler report containing information about GPU sampling data from a single frame. */
 	struct GPUProfilerReport
 	{
 		GPUProfileSample frameSample; /**< Sample containing data for entire frame. */
-		Vector<GPUProfileSample> samples;
+		Vector<GPUProfileSample> samples; /**< Top-level samples. Nested samples are available through their children. */
 	};
 
 	/**
@@ -62,12 +65,16 @@ namespace bs
 			RenderStatsData endStats;
 			SPtr<ct::TimerQuery> activeTimeQuery;
 			SPtr<ct::OcclusionQuery> activeOcclusionQuery;
+			Vector<UINT32> children; /**< Indices of samples recorded while this sample was active. */
+			bool hasParent = false;
 		};
 
 		struct ActiveFrame
 		{
 			ActiveSample frameSample;
 			Vector<ActiveSample> samples;
+
+			double cpuBeginTime = 0.0; /**< CPU trace-clock time the frame was submitted at, used for calibrating GPU zones. */
 		};
 
 	public:
@@ -161,6 +168,23 @@ namespace bs
 		/** Resolves an active sample and converts it to report sample. */
 		void resolveSample(const ActiveSample& sample, GPUProfileSample& reportSample);
 
+		/** Resolves an active sample along with any samples nested within it. */
+		void resolveSampleHierarchy(const ActiveFrame& frame, UINT32 sampleIdx, GPUProfileSample& reportSample);
+
+		/**
+		 * Records a resolved sample and its children as zones in the GPU lane of the CPU profiler's trace timeline,
+		 * with the sample starting at the provided trace-clock time.
+		 *
+		 * Timer queries only report durations, so absolute placement is calibrated by anchoring the frame at the
+		 * core thread's submission timestamp — zones may show earlier than their true execution by the GPU queue
+		 * latency, but their durations and relative layout are exact. Nested zones are laid out back-to-back as
+		 * untimed gaps between siblings cannot be measured.
+		 */
+		void emitTraceEvents(const GPUProfileSample& sample, double startTimeMs);
+
+		/** Records all zones of a resolved frame into the trace timeline, anchored at the provided trace-clock time. */
+		void emitTraceEvents(const GPUProfilerReport& report, double startTimeMs);
+
 	private:
 		ActiveFrame mActiveFrame;
 		bool mIsFrameActive;
@@ -176,6 +200,9 @@ namespace bs
 		mutable Stack<SPtr<ct::TimerQuery>> mFreeTimerQueries;
 		mutable Stack<SPtr<ct::OcclusionQuery>> mFreeOcclusionQueries;
 
+		ProfilerCPU::EventRingBuffer* mTraceLane = nullptr;
+		UnorderedSet<String> mTraceNames; /**< Interned zone names, as the trace references but doesn't copy them. */
+
 		Mutex mMutex;
 	};
 
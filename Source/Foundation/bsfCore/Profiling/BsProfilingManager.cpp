@@ -1,15 +1,37 @@
 //************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Profiling/BsProfilingManager.h"
+#include "Profiling/BsRenderStats.h"
+#include "CoreThread/BsCoreThread.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Utility/BsTime.h"
+#include "Debug/BsDebug.h"
 #include "Math/BsMath.h"
+#include <fstream>
 
 namespace bs
 {
 	const UINT32 ProfilingManager::NUM_SAVED_FRAMES = 200;
+	const UINT32 ProfilingManager::CAPTURE_COOLDOWN_FRAMES = 120;
+
+	/** Recursively writes a basic sampling entry and its children into the provided stream. */
+	static void writeSamplingEntry(std::ofstream& output, const CPUProfilerBasicSamplingEntry& entry, UINT32 depth)
+	{
+		for (UINT32 i = 0; i < depth; i++)
+			output << "  ";
+
+		const CPUProfilerBasicSamplingEntry::Data& data = entry.data;
+		output << data.name << ": total " << data.totalTimeMs << " ms, self " << data.totalSelfTimeMs
+			<< " ms, calls " << data.numCalls << "\n";
+
+		for (auto& child : entry.childEntries)
+			writeSamplingEntry(output, child, depth + 1);
+	}
 
 	ProfilingManager::ProfilingManager()
 		:mSavedSimReports(nullptr), mNextSimReportIdx(0),
-		mSavedCoreReports(nullptr), mNextCoreReportIdx(0)
+		mSavedCoreReports(nullptr), mNextCoreReportIdx(0),
+		mFrameBudgetMs(0.0f), mNumCaptureFrames(10), mCaptureCooldown(0)
 	{
 		mSavedSimReports = bs_newN<ProfilerReport, ProfilerAlloc>(NUM_SAVED_FRAMES);
 		mSavedCoreReports = bs_newN<ProfilerReport, ProfilerAlloc>(NUM_SAVED_FRAMES);
@@ -27,11 +49,30 @@ namespace bs
 	void ProfilingManager::_update()
 	{
 #if BS_PROFILING_ENABLED
-		mSavedSimReports[mNextSimReportIdx].cpuReport = gProfilerCPU().generateReport();
+		ProfilerReport& report = mSavedSimReports[mNextSimReportIdx];
+		report.cpuReport = gProfilerCPU().generateReport();
+		report.numQueuedCoreCommands = gCoreThread().getNumQueuedCommands();
+		report.peakQueuedCoreCommands = gCoreThread().getPeakQueuedCommands(true);
+		report.queuedCoreCommandBytes = gCoreThread().getQueuedCommandBytes();
 
 		gProfilerCPU().reset();
 
 		mNextSimReportIdx = (mNextSimReportIdx + 1) % NUM_SAVED_FRAMES;
+
+		if (mFrameBudgetMs > 0.0f)
+		{
+			if (mCaptureCooldown > 0)
+				mCaptureCooldown--;
+
+			float frameTimeMs = gTime().getFrameDelta() * 1000.0f;
+			if (frameTimeMs > mFrameBudgetMs && mCaptureCooldown == 0)
+			{
+				captureSpike(frameTimeMs);
+
+				// Avoid flooding the output folder when frame times are consistently over budget
+				mCaptureCooldown = CAPTURE_COOLDOWN_FRAMES;
+			}
+		}
 #endif
 	}
 
@@ -69,6 +110,62 @@ namespace bs
 		}
 	}
 
+	void ProfilingManager::setFrameBudget(float budgetMs, const Path& outputFolder, UINT32 numFrames)
+	{
+		mFrameBudgetMs = budgetMs;
+		mCaptureFolder = outputFolder;
+		mNumCaptureFrames = Math::clamp(numFrames, 1U, NUM_SAVED_FRAMES);
+		mCaptureCooldown = 0;
+	}
+
+	void ProfilingManager::captureSpike(float frameTimeMs) const
+	{
+		if (!FileSystem::exists(mCaptureFolder))
+			FileSystem::createDir(mCaptureFolder);
+
+		Path outputPath = mCaptureFolder;
+		outputPath.append(Path("FrameSpike_" + toString(gTime().getFrameIdx()) + ".txt"));
+
+		std::ofstream output;
+		output.open(outputPath.toPlatformString().c_str(), std::ios::out);
+		if (output.fail())
+		{
+			LOGWRN("Failed to save frame spike capture at: \"" + outputPath.toString() + "\". Error: " +
+				strerror(errno) + ".");
+			return;
+		}
+
+		output << "Frame spike capture\n";
+		output << "Frame index: " << gTime().getFrameIdx() << "\n";
+		output << "Frame time: " << frameTimeMs << " ms (budget: " << mFrameBudgetMs << " ms)\n";
+		output << "Core thread queued commands: " << gCoreThread().getNumQueuedCommands() << " (peak "
+			<< gCoreThread().getPeakQueuedCommands() << ", ~" << gCoreThread().getQueuedCommandBytes() << " B)\n";
+
+		// Render stats are incremented on the core thread, so the values can be mid-frame, but they're close enough
+		// to show what the GPU-facing workload looked like
+		const RenderStatsData& stats = RenderStats::instance().getData();
+		output << "Draw calls: " << stats.numDrawCalls << ", compute calls: " << stats.numComputeCalls
+			<< ", clears: " << stats.numClears << ", render target changes: " << stats.numRenderTargetChanges << "\n";
+		output << "Vertices: " << stats.numVertices << ", primitives: " << stats.numPrimitives << "\n";
+		output << "Pipeline state changes: " << stats.numPipelineStateChanges
+			<< ", GPU param binds: " << stats.numGpuParamBinds << "\n";
+		output << "Resource writes: " << stats.numResourceWrites << ", resource reads: " << stats.numResourceReads
+			<< ", objects created: " << stats.numObjectsCreated << ", objects destroyed: "
+			<< stats.numObjectsDestroyed << "\n\n";
+
+		for (UINT32 i = 0; i < mNumCaptureFrames; i++)
+		{
+			// Index zero is the most recent frame
+			output << "--- Frame -" << i << ", sim thread ---\n";
+			writeSamplingEntry(output, getReport(ProfiledThread::Sim, i).cpuReport.getBasicSamplingData(), 0);
+
+			output << "--- Frame -" << i << ", core thread ---\n";
+			writeSamplingEntry(output, getReport(ProfiledThread::Core, i).cpuReport.getBasicSamplingData(), 0);
+
+			output << "\n";
+		}
+	}
+
 	ProfilingManager& gProfiler()
 	{
 		return ProfilingManager::instance();
@@ -16,6 +16,18 @@ namespace bs
 	struct ProfilerReport
 	{
 		CPUProfilerReport cpuReport;
+
+		/** Number of commands waiting in the core thread command queue when the report was generated. */
+		UINT32 numQueuedCoreCommands = 0;
+
+		/** Highest number of commands in the core thread command queue at any point during the reported frame. */
+		UINT32 peakQueuedCoreCommands = 0;
+
+		/**
+		 * Approximate memory used by commands waiting in the core thread command queue when the report was generated.
+		 * Counts fixed per-command storage only, see CoreThread::getQueuedCommandBytes().
+		 */
+		UINT64 queuedCoreCommandBytes = 0;
 	};
 
 	/**	Type of thread used by the profiler. */
@@ -60,14 +72,38 @@ namespace bs
 		 */
 		const ProfilerReport& getReport(ProfiledThread thread, UINT32 idx = 0) const;
 
+		/**
+		 * Enables a watchdog that automatically captures profiling data whenever a frame takes longer than the provided
+		 * budget. When triggered, the most recent sim and core thread profiler reports, current render statistics and
+		 * the core thread command queue depth get written to a file in the provided folder, turning one-off frame
+		 * spikes seen in production into captures that can be examined offline.
+		 *
+		 * @param[in]	budgetMs		Frame time budget in milliseconds. Frames exceeding it trigger a capture. Set
+		 *								to zero to disable the watchdog.
+		 * @param[in]	outputFolder	Folder the capture files get written into.
+		 * @param[in]	numFrames		Number of recent frames to include in each capture. Clamped to the size of the
+		 *								saved report buffer.
+		 */
+		void setFrameBudget(float budgetMs, const Path& outputFolder, UINT32 numFrames = 10);
+
 	private:
+		/** Writes a capture of the most recent profiling data to a file in the watchdog output folder. */
+		void captureSpike(float frameTimeMs) const;
+
 		static const UINT32 NUM_SAVED_FRAMES;
+		static const UINT32 CAPTURE_COOLDOWN_FRAMES;
+
 		ProfilerReport* mSavedSimReports;
 		UINT32 mNextSimReportIdx;
 
 		ProfilerReport* mSavedCoreReports;
 		UINT32 mNextCoreReportIdx;
 
+		float mFrameBudgetMs;
+		Path mCaptureFolder;
+		UINT32 mNumCaptureFrames;
+		UINT32 mCaptureCooldown;
+
 		mutable Mutex mSync;
 	};
 
@@ -29,7 +29,8 @@ namespace bs
 		RenderStatsData()
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
 		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
+		, numIndexBufferBinds(0), gpuMemTexture(0), gpuMemRenderTarget(0), gpuMemBuffer(0), gpuMemBudget(0)
+		, gpuMemMeshShared(0)
 		{ }
 
 		UINT64 numDrawCalls;
@@ -50,8 +51,19 @@ namespace bs
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
 
-		UINT64 numObjectsCreated; 
+		UINT64 numObjectsCreated;
 		UINT64 numObjectsDestroyed;
+
+		/** Estimated GPU memory allocated per category, in bytes, as reported by GpuMemoryBudget. */
+		UINT64 gpuMemTexture;
+		UINT64 gpuMemRenderTarget;
+		UINT64 gpuMemBuffer;
+
+		/** GPU memory budget in bytes, or zero if no budget is set. */
+		UINT64 gpuMemBudget;
+
+		/** GPU memory in bytes saved by meshes sharing deduplicated vertex/index buffers. */
+		UINT64 gpuMemMeshShared;
 	};
 
 	/**
@@ -137,6 +149,12 @@ namespace bs
 		 */
 		void incResWrite(UINT32 category) { mData.numResourceWrites++; }
 
+		/** Increments the counter of GPU memory saved by meshes sharing deduplicated vertex/index buffers. */
+		void addMeshSharedMem(UINT64 bytes) { mData.gpuMemMeshShared += bytes; }
+
+		/** Decrements the counter of GPU memory saved by meshes sharing deduplicated vertex/index buffers. */
+		void subMeshSharedMem(UINT64 bytes) { mData.gpuMemMeshShared -= bytes; }
+
 		/**
 		 * Returns an object containing various rendering statistics.
 		 *			
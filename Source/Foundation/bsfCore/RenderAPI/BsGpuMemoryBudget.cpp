@@ -0,0 +1,60 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "RenderAPI/BsGpuMemoryBudget.h"
+#include "Profiling/BsRenderStats.h"
+
+namespace bs
+{
+	UINT64 GpuMemoryBudget::getTotalUsed() const
+	{
+		UINT64 total = 0;
+		for (UINT32 i = 0; i < (UINT32)GpuMemoryCategory::Count; i++)
+			total += mUsed[i].load(std::memory_order_relaxed);
+
+		return total;
+	}
+
+	UINT32 GpuMemoryBudget::registerEvictionCallback(EvictionCallback callback)
+	{
+		UINT32 handle = mNextCallbackHandle++;
+		mEvictionCallbacks.push_back(std::make_pair(handle, std::move(callback)));
+
+		return handle;
+	}
+
+	void GpuMemoryBudget::unregisterEvictionCallback(UINT32 handle)
+	{
+		auto iterFind = std::find_if(mEvictionCallbacks.begin(), mEvictionCallbacks.end(),
+			[handle](const std::pair<UINT32, EvictionCallback>& entry) { return entry.first == handle; });
+
+		if (iterFind != mEvictionCallbacks.end())
+			mEvictionCallbacks.erase(iterFind);
+	}
+
+	void GpuMemoryBudget::_update()
+	{
+		RenderStatsData& stats = RenderStats::instance().getData();
+		stats.gpuMemTexture = getUsed(GpuMemoryCategory::Texture);
+		stats.gpuMemRenderTarget = getUsed(GpuMemoryCategory::RenderTarget);
+		stats.gpuMemBuffer = getUsed(GpuMemoryCategory::Buffer);
+		stats.gpuMemBudget = getBudget();
+
+		UINT64 budget = getBudget();
+		if (budget == 0)
+			return;
+
+		UINT64 used = getTotalUsed();
+		if (used <= budget)
+			return;
+
+		UINT64 bytesToFree = used - budget;
+		for (auto& entry : mEvictionCallbacks)
+		{
+			UINT64 freed = entry.second(bytesToFree);
+			if (freed >= bytesToFree)
+				break;
+
+			bytesToFree -= freed;
+		}
+	}
+}
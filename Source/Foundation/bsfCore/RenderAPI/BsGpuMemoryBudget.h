@@ -0,0 +1,99 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/** Categories GPU memory allocations are accounted under. */
+	enum class GpuMemoryCategory
+	{
+		Texture, /**< Sampled textures. */
+		RenderTarget, /**< Textures usable as color or depth/stencil targets. */
+		Buffer, /**< Vertex, index, generic and parameter buffers. */
+		Count // Keep at end
+	};
+
+	/**
+	 * Tracks an estimate of total GPU memory allocated by the framework, per category, independent of the render API
+	 * backend in use. Optionally enforces a budget: when total tracked memory exceeds the budget, registered eviction
+	 * callbacks are invoked once per frame and asked to release memory (e.g. by trimming resource pools), until the
+	 * overage is reclaimed or all callbacks have been exhausted.
+	 *
+	 * The tracked amounts are estimates based on resource dimensions and formats - actual driver-side consumption will
+	 * be higher due to alignment, padding and internal allocations. The budget is not queried from the driver by this
+	 * module; render API backends that can retrieve one (e.g. through memory budget extensions) are expected to publish
+	 * it via setBudget(), and applications may set or override it directly.
+	 *
+	 * @note	Allocation tracking methods are thread safe. Budget enforcement and callback registration are expected
+	 *			to happen on the core thread.
+	 */
+	class BS_CORE_EXPORT GpuMemoryBudget : public Module<GpuMemoryBudget>
+	{
+		/** Signature of an eviction callback. Receives the number of bytes requested to be released and returns the
+		 * number of bytes the callback actually released. */
+		using EvictionCallback = std::function<UINT64(UINT64)>;
+
+	public:
+		/** Records an allocation of GPU memory under the specified category. Thread safe. */
+		void notifyAllocated(GpuMemoryCategory category, UINT64 numBytes)
+		{
+			mUsed[(UINT32)category].fetch_add(numBytes, std::memory_order_relaxed);
+		}
+
+		/** Records a release of GPU memory previously recorded with notifyAllocated(). Thread safe. */
+		void notifyFreed(GpuMemoryCategory category, UINT64 numBytes)
+		{
+			mUsed[(UINT32)category].fetch_sub(numBytes, std::memory_order_relaxed);
+		}
+
+		/** Returns the estimated number of bytes of GPU memory currently allocated under the category. Thread safe. */
+		UINT64 getUsed(GpuMemoryCategory category) const
+		{
+			return mUsed[(UINT32)category].load(std::memory_order_relaxed);
+		}
+
+		/** Returns the estimated number of bytes of GPU memory currently allocated across all categories. Thread safe. */
+		UINT64 getTotalUsed() const;
+
+		/**
+		 * Sets the GPU memory budget, in bytes. Zero (the default) disables budget enforcement. Thread safe, although
+		 * enforcement against the new value only takes effect with the next core thread frame.
+		 */
+		void setBudget(UINT64 numBytes) { mBudget.store(numBytes, std::memory_order_relaxed); }
+
+		/** Returns the GPU memory budget, in bytes, or zero if no budget is set. Thread safe. */
+		UINT64 getBudget() const { return mBudget.load(std::memory_order_relaxed); }
+
+		/**
+		 * Registers a callback to be invoked when tracked memory exceeds the budget. Returns a handle that may be used
+		 * for unregistering the callback. Core thread only.
+		 */
+		UINT32 registerEvictionCallback(EvictionCallback callback);
+
+		/** Unregisters an eviction callback previously registered with registerEvictionCallback(). Core thread only. */
+		void unregisterEvictionCallback(UINT32 handle);
+
+		/**
+		 * Publishes current usage to RenderStats and runs eviction callbacks if over budget. Called once per frame on
+		 * the core thread. Internal method.
+		 */
+		void _update();
+
+	private:
+		std::atomic<UINT64> mUsed[(UINT32)GpuMemoryCategory::Count] = { };
+		std::atomic<UINT64> mBudget{0};
+
+		Vector<std::pair<UINT32, EvictionCallback>> mEvictionCallbacks;
+		UINT32 mNextCallbackHandle = 1;
+	};
+
+	/** @} */
+}
@@ -91,7 +91,7 @@ namespace bs
 	namespace ct
 	{
 	GpuParamBlockBuffer::GpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask)
-		:mUsage(usage), mSize(size), mCachedData(nullptr), mGPUBufferDirty(false)
+		:mUsage(usage), mSize(size), mCachedData(nullptr), mGPUBufferDirty(false), mDirtyStart(0), mDirtyEnd(0)
 	{
 		if (mSize > 0)
 		{
@@ -118,6 +118,18 @@ namespace bs
 #endif
 
 		memcpy(mCachedData + offset, data, size);
+
+		if(!mGPUBufferDirty)
+		{
+			mDirtyStart = offset;
+			mDirtyEnd = offset + size;
+		}
+		else
+		{
+			mDirtyStart = std::min(mDirtyStart, offset);
+			mDirtyEnd = std::max(mDirtyEnd, offset + size);
+		}
+
 		mGPUBufferDirty = true;
 	}
 
@@ -147,6 +159,18 @@ namespace bs
 #endif
 
 		memset(mCachedData + offset, 0, size);
+
+		if(!mGPUBufferDirty)
+		{
+			mDirtyStart = offset;
+			mDirtyEnd = offset + size;
+		}
+		else
+		{
+			mDirtyStart = std::min(mDirtyStart, offset);
+			mDirtyEnd = std::max(mDirtyEnd, offset + size);
+		}
+
 		mGPUBufferDirty = true;
 	}
 
@@ -154,8 +178,11 @@ namespace bs
 	{
 		if (mGPUBufferDirty)
 		{
-			writeToGPU(mCachedData, queueIdx);
+			writeToGPU(mCachedData, mDirtyStart, mDirtyEnd - mDirtyStart, queueIdx);
+
 			mGPUBufferDirty = false;
+			mDirtyStart = 0;
+			mDirtyEnd = 0;
 		}
 	}
 
@@ -89,13 +89,16 @@ namespace bs
 		GpuParamBlockBuffer(UINT32 size, GpuParamBlockUsage usage, GpuDeviceFlags deviceMask);
 		virtual ~GpuParamBlockBuffer();
 
-		/** 
-		 * Writes all of the specified data to the buffer. Data size must be the same size as the buffer. 
+		/**
+		 * Writes a range of the specified data to the buffer.
 		 *
 		 * @param[in]	data		Data to write. Must match the size of the buffer.
+		 * @param[in]	offset		Offset in bytes at which the write begins. Must be in range of the buffer size.
+		 * @param[in]	size		Number of bytes to write, starting at the offset. Backends that cannot perform
+		 *							partial updates are free to upload the entire buffer instead.
 		 * @param[in]	queueIdx	Device queue to perform the write operation on. See @ref queuesDoc.
 		 */
-		virtual void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) = 0;
+		virtual void writeToGPU(const UINT8* data, UINT32 offset, UINT32 size, UINT32 queueIdx = 0) = 0;
 
 		/** 
 		 * Flushes any cached data into the actual GPU buffer. 
@@ -143,6 +146,10 @@ namespace bs
 
 		UINT8* mCachedData;
 		bool mGPUBufferDirty;
+
+		// Byte range of the cached data modified since the last flush, so unchanged portions aren't re-uploaded
+		UINT32 mDirtyStart;
+		UINT32 mDirtyEnd;
 	};
 
 	/** @} */
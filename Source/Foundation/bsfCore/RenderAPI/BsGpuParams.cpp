@@ -252,6 +252,10 @@ namespace bs
 			return;
 		}
 
+#if BS_DEBUG_MODE
+		validateBufferSize(iterFind->second, paramBlockBuffer);
+#endif
+
 		setParamBlockBuffer(iterFind->second.set, iterFind->second.slot, paramBlockBuffer);
 	}
 
@@ -268,10 +272,30 @@ namespace bs
 			if (iterFind == paramDescs->paramBlocks.end())
 				continue;
 
+#if BS_DEBUG_MODE
+			validateBufferSize(iterFind->second, paramBlockBuffer);
+#endif
+
 			setParamBlockBuffer(iterFind->second.set, iterFind->second.slot, paramBlockBuffer);
 		}
 	}
 
+	template<bool Core>
+	void TGpuParams<Core>::validateBufferSize(const GpuParamBlockDesc& blockDesc, const ParamsBufferType& paramBlockBuffer) const
+	{
+		if (paramBlockBuffer == nullptr)
+			return;
+
+		UINT32 shaderBlockSize = blockDesc.blockSize * sizeof(UINT32);
+		if (paramBlockBuffer->getSize() < shaderBlockSize)
+		{
+			LOGWRN("Size of the provided parameter block buffer (" + toString(paramBlockBuffer->getSize()) +
+				" bytes) doesn\'t cover the size of the shader block '" + blockDesc.name + "' (" +
+				toString(shaderBlockSize) + " bytes). The block layout likely doesn\'t match the shader and parameter "
+				"writes may end up at wrong offsets.");
+		}
+	}
+
 	template<bool Core>
 	template<class T> 
 	void TGpuParams<Core>::getParam(GpuProgramType type, const String& name, TGpuDataParam<T, Core>& output) const
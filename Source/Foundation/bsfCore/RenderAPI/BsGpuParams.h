@@ -239,6 +239,12 @@ namespace bs
 		/** @copydoc CoreObject::getThisPtr */
 		virtual SPtr<GpuParamsType> _getThisPtr() const = 0;
 
+		/**
+		 * Checks the provided buffer covers the size of the shader-reflected parameter block it is being bound to, and
+		 * logs a warning otherwise. Performed once at bind time so individual parameter writes require no checks.
+		 */
+		void validateBufferSize(const GpuParamBlockDesc& blockDesc, const ParamsBufferType& paramBlockBuffer) const;
+
 		/** Data for a single bound texture. */
 		struct TextureData
 		{
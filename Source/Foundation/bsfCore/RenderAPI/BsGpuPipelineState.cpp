@@ -134,6 +134,12 @@ namespace bs
 		:TGraphicsPipelineState(desc), mDeviceMask(deviceMask)
 	{ }
 
+	GraphicsPipelineState::~GraphicsPipelineState()
+	{
+		RenderStateManager::instance().notifyGraphicsPipelineStateDestroyed(
+			RenderStateManager::buildGraphicsPipelineKey(mData, mDeviceMask));
+	}
+
 	void GraphicsPipelineState::initialize()
 	{
 		GPU_PIPELINE_PARAMS_DESC paramsDesc;
@@ -226,7 +226,7 @@ namespace bs
 	{
 	public:
 		GraphicsPipelineState(const PIPELINE_STATE_DESC& desc, GpuDeviceFlags deviceMask);
-		virtual ~GraphicsPipelineState() { }
+		virtual ~GraphicsPipelineState();
 
 		/** @copydoc CoreObject::initialize() */
 		void initialize() override;
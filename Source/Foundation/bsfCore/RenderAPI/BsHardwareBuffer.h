@@ -3,8 +3,9 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "RenderAPI/BsGpuMemoryBudget.h"
 
-namespace bs 
+namespace bs
 {
 	/** @addtogroup RenderAPI-Internal
 	 *  @{
@@ -20,7 +21,11 @@ namespace bs
 	class BS_CORE_EXPORT HardwareBuffer
 	{
 	public:
-		virtual ~HardwareBuffer() {}
+		virtual ~HardwareBuffer()
+		{
+			if (GpuMemoryBudget::isStarted())
+				GpuMemoryBudget::instance().notifyFreed(GpuMemoryCategory::Buffer, mSize);
+		}
 
 		/**
 		 * Locks a portion of the buffer and returns pointer to the locked area. You must call unlock() when done.
@@ -140,7 +145,10 @@ namespace bs
 		 */
 		HardwareBuffer(UINT32 size)
 			: mSize(size), mIsLocked(false)
-		{  }
+		{
+			if (GpuMemoryBudget::isStarted())
+				GpuMemoryBudget::instance().notifyAllocated(GpuMemoryCategory::Buffer, mSize);
+		}
 
 		/** @copydoc lock */
 		virtual void* map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 deviceIdx, 
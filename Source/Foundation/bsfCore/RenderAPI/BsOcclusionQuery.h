@@ -13,6 +13,10 @@ namespace bs { namespace ct
 	/**
 	 * Represents a query that counts number of samples rendered by the GPU while the query is active.
 	 *
+	 * @note
+	 * Results arrive asynchronously, generally one or two frames after end() is called. Subscribe to onComplete or poll
+	 * isReady() rather than reading the result immediately - reading a result before it is ready can force a pipeline
+	 * sync on some render backends.
 	 * @note		Core thread only.
 	 */
 	class BS_CORE_EXPORT OcclusionQuery
@@ -205,6 +205,12 @@ namespace bs
 		return mCurrentCapabilities[deviceIdx];
 	}
 
+	void RenderAPI::drawIndexedIndirect(const SPtr<GpuBuffer>& argBuffer, UINT32 offset, UINT32 drawCount,
+		UINT32 stride, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		LOGWRN("Indirect draw is not supported by the current render API backend.");
+	}
+
 	UINT32 RenderAPI::vertexCountToPrimCount(DrawOperationType type, UINT32 elementCount)
 	{
 		UINT32 primCount = 0;
@@ -429,10 +429,31 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount, 
+		virtual void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
 			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
 
-		/** 
+		/**
+		 * Draws multiple objects with a single call, reading the arguments of the individual draws from the provided
+		 * buffer. All draws share the currently bound GPU programs, vertex declaration, vertex and index buffers. Useful
+		 * for reducing submission overhead when drawing many objects sharing pipeline state, or when draw arguments are
+		 * generated on the GPU.
+		 *
+		 * Not supported by all render backends. Check the backend implementation before relying on this call, as the
+		 * default implementation performs no rendering.
+		 *
+		 * @param[in]	argBuffer		Buffer of type GBT_INDIRECTARGUMENT containing DrawIndexedIndirectArgs entries,
+		 *								one per draw.
+		 * @param[in]	offset			Offset into the argument buffer at which the first entry starts, in bytes.
+		 * @param[in]	drawCount		Number of draws to execute.
+		 * @param[in]	stride			Distance between individual entries in the argument buffer, in bytes.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided operation
+		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
+		 *								Buffer must support graphics operations.
+		 */
+		virtual void drawIndexedIndirect(const SPtr<GpuBuffer>& argBuffer, UINT32 offset, UINT32 drawCount,
+			UINT32 stride = sizeof(DrawIndexedIndirectArgs), const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/**
 		 * Executes the currently bound compute shader. 
 		 *
 		 * @param[in]	numGroupsX		Number of groups to start in the X direction. Must be in range [1, 65535].
@@ -38,6 +38,8 @@ namespace bs
 		RSC_GEOMETRY_PROGRAM			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 3), /**< Supports hardware geometry programs. */
 		RSC_TESSELLATION_PROGRAM		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 4), /**< Supports hardware tessellation programs. */
 		RSC_COMPUTE_PROGRAM				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 5), /**< Supports hardware compute programs. */
+		RSC_ASYNC_COMPUTE				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 6), /**< Supports executing compute command buffers on a queue separate from the graphics queue. */
+		RSC_DRAW_INDIRECT				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 7), /**< Supports issuing draws whose arguments are sourced from a GBT_INDIRECTARGUMENT buffer. */
 	};
 
 	/** Holds data about render system driver version. */
@@ -52,7 +52,7 @@ namespace bs
 
 	SamplerState::~SamplerState()
 	{
-
+		RenderStateManager::instance().notifySamplerStateDestroyed(mProperties.mData);
 	}
 
 	SPtr<ct::SamplerState> SamplerState::getCore() const
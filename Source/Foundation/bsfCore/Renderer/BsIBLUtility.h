@@ -26,6 +26,34 @@ namespace bs { namespace ct
 		 */
 		virtual void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const = 0;
 
+		/**
+		 * Performs the preparation step of filterCubemapForSpecular(), populating the scratch cubemap with data
+		 * required for filtering individual mip levels. Use filterCubemapForSpecularMip() to perform the filtering
+		 * itself, one mip level at a time. This is useful when the filtering cost needs to be spread out over
+		 * multiple frames, as each mip level can be filtered separately.
+		 *
+		 * @param[in]	cubemap		Cubemap to filter. Its mip level 0 will be used as source.
+		 * @param[in]	scratch		Temporary cubemap texture to use for the filtering process. Must match the size of
+		 *							the source cubemap. Provide null to automatically create a scratch cubemap.
+		 * @return					Scratch cubemap containing the prepared data. Same as @p scratch, unless scratch
+		 *							was null in which case it is a newly created texture.
+		 */
+		virtual SPtr<Texture> filterCubemapForSpecularPrepare(const SPtr<Texture>& cubemap,
+			const SPtr<Texture>& scratch) const = 0;
+
+		/**
+		 * Filters a single mip level of the cubemap, populating it with values that can be used for evaluating
+		 * specular reflections. filterCubemapForSpecularPrepare() must have been called to generate the scratch
+		 * cubemap before calling this method.
+		 *
+		 * @param[in, out]	cubemap		Cubemap whose mip level to filter.
+		 * @param[in]		scratch		Scratch cubemap as output by filterCubemapForSpecularPrepare().
+		 * @param[in]		mip			Mip level to filter. Must be greater than zero, as mip level 0 contains the
+		 *								source data.
+		 */
+		virtual void filterCubemapForSpecularMip(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+			UINT32 mip) const = 0;
+
 		/**
 		 * Performs filtering on the cubemap, populating the output cubemap with values that can be used for evaluating
 		 * irradiance for use in diffuse lighting. Uses order-5 SH (25 coefficients) and outputs the values in the form of
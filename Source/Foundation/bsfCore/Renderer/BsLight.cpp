@@ -103,6 +103,14 @@ namespace bs
 		}
 	}
 
+	bool LightBase::calculateBounds(AABox& bounds) const
+	{
+		Vector3 extents(mBounds.getRadius(), mBounds.getRadius(), mBounds.getRadius());
+		bounds = AABox(mBounds.getCenter() - extents, mBounds.getCenter() + extents);
+
+		return true;
+	}
+
 	void LightBase::updateAttenuationRange()
 	{
 		// Value to which intensity needs to drop in order for the light contribution to fade out to zero
@@ -218,7 +226,28 @@ namespace bs
 
 	CoreSyncData Light::syncToCore(FrameAlloc* allocator)
 	{
-		UINT32 size = getActorSyncDataSize();
+		UINT32 dirtyFlags = getCoreDirtyFlags();
+
+		// Transform-only changes sync just the actor data and bounds instead of the full light state. Dirty flags are
+		// written first so the core thread knows which layout to expect.
+		if (dirtyFlags == (UINT32)ActorDirtyFlag::Transform)
+		{
+			UINT32 size = rttiGetElemSize(dirtyFlags);
+			size += getActorSyncDataSize();
+			size += rttiGetElemSize(mBounds);
+
+			UINT8* buffer = allocator->alloc(size);
+
+			char* dataPtr = (char*)buffer;
+			dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
+			dataPtr = syncActorTo(dataPtr);
+			dataPtr = rttiWriteElem(mBounds, dataPtr);
+
+			return CoreSyncData(buffer, size);
+		}
+
+		UINT32 size = rttiGetElemSize(dirtyFlags);
+		size += getActorSyncDataSize();
 		size += rttiGetElemSize(mType);
 		size += rttiGetElemSize(mCastsShadows);
 		size += rttiGetElemSize(mColor);
@@ -228,13 +257,13 @@ namespace bs
 		size += rttiGetElemSize(mSpotAngle);
 		size += rttiGetElemSize(mSpotFalloffAngle);
 		size += rttiGetElemSize(mAutoAttenuation);
-		size += rttiGetElemSize(getCoreDirtyFlags());
 		size += rttiGetElemSize(mBounds);
 		size += rttiGetElemSize(mShadowBias);
 
 		UINT8* buffer = allocator->alloc(size);
 
 		char* dataPtr = (char*)buffer;
+		dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
 		dataPtr = syncActorTo(dataPtr);
 		dataPtr = rttiWriteElem(mType, dataPtr);
 		dataPtr = rttiWriteElem(mCastsShadows, dataPtr);
@@ -245,7 +274,6 @@ namespace bs
 		dataPtr = rttiWriteElem(mSpotAngle, dataPtr);
 		dataPtr = rttiWriteElem(mSpotFalloffAngle, dataPtr);
 		dataPtr = rttiWriteElem(mAutoAttenuation, dataPtr);
-		dataPtr = rttiWriteElem(getCoreDirtyFlags(), dataPtr);
 		dataPtr = rttiWriteElem(mBounds, dataPtr);
 		dataPtr = rttiWriteElem(mShadowBias, dataPtr);
 
@@ -297,6 +325,22 @@ namespace bs
 		char* dataPtr = (char*)data.getBuffer();
 
 		UINT32 dirtyFlags = 0;
+		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
+
+		// Transform-only changes use a minimal payload, see the sim thread version of this method
+		if (dirtyFlags == (UINT32)ActorDirtyFlag::Transform)
+		{
+			dataPtr = syncActorFrom(dataPtr);
+			dataPtr = rttiReadElem(mBounds, dataPtr);
+
+			updateBounds();
+
+			if (mActive)
+				gRenderer()->notifyLightUpdated(this);
+
+			return;
+		}
+
 		bool oldIsActive = mActive;
 		LightType oldType = mType;
 
@@ -310,7 +354,6 @@ namespace bs
 		dataPtr = rttiReadElem(mSpotAngle, dataPtr);
 		dataPtr = rttiReadElem(mSpotFalloffAngle, dataPtr);
 		dataPtr = rttiReadElem(mAutoAttenuation, dataPtr);
-		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
 		dataPtr = rttiReadElem(mBounds, dataPtr);
 		dataPtr = rttiReadElem(mShadowBias, dataPtr);
 
@@ -140,6 +140,9 @@ namespace bs
 		/**	Returns world space bounds that completely encompass the light's area of influence. */
 		Sphere getBounds() const { return mBounds; }
 
+		/** @copydoc SceneActor::calculateBounds */
+		bool calculateBounds(AABox& bounds) const override;
+
 		/**
 		 * Returns the luminance of the light source. This is the value that should be used in lighting equations.
 		 *
@@ -14,14 +14,22 @@ namespace bs { namespace ct
 	 *  @{
 	 */
 
-	/** Wrapper for a single parameter in a parameter block buffer. */
+	/**
+	 * Wrapper for a single parameter in a parameter block buffer. Byte offsets are resolved once when the parameter
+	 * block is initialized, so setting a value performs a direct store into the buffer with no lookup.
+	 */
 	template<class T>
 	class ParamBlockParam
 	{
 	public:
 		ParamBlockParam() { }
 		ParamBlockParam(const GpuParamDataDesc& paramDesc)
-			:mParamDesc(paramDesc)
+			: mParamDesc(paramDesc)
+			, mByteOffset(paramDesc.cpuMemOffset * sizeof(UINT32))
+			, mByteStride(paramDesc.arrayElementStride * sizeof(UINT32))
+			, mElementSizeBytes(paramDesc.elementSize * sizeof(UINT32))
+			// Truncate if it doesn't fit within parameter size
+			, mSizeBytes(std::min(paramDesc.elementSize * (UINT32)sizeof(UINT32), (UINT32)sizeof(T)))
 		{ }
 
 		/** 
@@ -38,26 +46,24 @@ namespace bs { namespace ct
 			}
 #endif
 
-			UINT32 elementSizeBytes = mParamDesc.elementSize * sizeof(UINT32);
-			UINT32 sizeBytes = std::min(elementSizeBytes, (UINT32)sizeof(T)); // Truncate if it doesn't fit within parameter size
+			// Non-matrix parameters never transpose, letting the compiler eliminate the render API query and the
+			// branch entirely
+			bool transposeMatrices = TransposePolicy<T>::transposeEnabled(true) &&
+				RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
 
-			bool transposeMatrices = RenderAPI::instance().getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ColumnMajorMatrices);
-			if (TransposePolicy<T>::transposeEnabled(transposeMatrices))
+			if (transposeMatrices)
 			{
 				auto transposed = TransposePolicy<T>::transpose(value);
-				paramBlock->write((mParamDesc.cpuMemOffset + arrayIdx * mParamDesc.arrayElementStride) * sizeof(UINT32),
-					&transposed, sizeBytes);
+				paramBlock->write(mByteOffset + arrayIdx * mByteStride, &transposed, mSizeBytes);
 			}
 			else
-				paramBlock->write((mParamDesc.cpuMemOffset + arrayIdx * mParamDesc.arrayElementStride) * sizeof(UINT32),
-					&value, sizeBytes);
+				paramBlock->write(mByteOffset + arrayIdx * mByteStride, &value, mSizeBytes);
 
 			// Set unused bytes to 0
-			if (sizeBytes < elementSizeBytes)
+			if (mSizeBytes < mElementSizeBytes)
 			{
-				UINT32 diffSize = elementSizeBytes - sizeBytes;
-				paramBlock->zeroOut((mParamDesc.cpuMemOffset + arrayIdx * mParamDesc.arrayElementStride) * sizeof(UINT32) +
-					sizeBytes, diffSize);
+				UINT32 diffSize = mElementSizeBytes - mSizeBytes;
+				paramBlock->zeroOut(mByteOffset + arrayIdx * mByteStride + mSizeBytes, diffSize);
 			}
 		}
 
@@ -76,18 +82,18 @@ namespace bs { namespace ct
 			}
 #endif
 
-			UINT32 elementSizeBytes = mParamDesc.elementSize * sizeof(UINT32);
-			UINT32 sizeBytes = std::min(elementSizeBytes, (UINT32)sizeof(T));
-
 			T value;
-			paramBlock->read((mParamDesc.cpuMemOffset + arrayIdx * mParamDesc.arrayElementStride) * sizeof(UINT32), &value,
-				sizeBytes);
+			paramBlock->read(mByteOffset + arrayIdx * mByteStride, &value, mSizeBytes);
 
 			return value;
 		}
 
 	protected:
 		GpuParamDataDesc mParamDesc;
+		UINT32 mByteOffset = 0;
+		UINT32 mByteStride = 0;
+		UINT32 mElementSizeBytes = 0;
+		UINT32 mSizeBytes = 0;
 	};
 
 	/** Base class for all parameter blocks. */
@@ -3,8 +3,10 @@
 #include "Renderer/BsReflectionProbe.h"
 #include "Private/RTTI/BsReflectionProbeRTTI.h"
 #include "Scene/BsSceneObject.h"
+#include "Scene/BsSceneManager.h"
 #include "Image/BsTexture.h"
 #include "Renderer/BsRenderer.h"
+#include "Renderer/BsCamera.h"
 #include "Utility/BsUUID.h"
 #include "Renderer/BsIBLUtility.h"
 
@@ -87,7 +89,9 @@ namespace bs
 		cubemapDesc.width = ct::IBLUtility::REFLECTION_CUBEMAP_SIZE;
 		cubemapDesc.height = ct::IBLUtility::REFLECTION_CUBEMAP_SIZE;
 		cubemapDesc.numMips = PixelUtil::getMaxMipmaps(cubemapDesc.width, cubemapDesc.height, 1, cubemapDesc.format);
-		cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET;
+
+		// Load-store usage allows the renderer to filter the cubemap using a compute shader, when supported
+		cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET | TU_LOADSTORE;
 
 		mFilteredTexture = Texture::_createPtr(cubemapDesc);
 
@@ -99,44 +103,95 @@ namespace bs
 		SPtr<ct::ReflectionProbe> coreProbe = getCore();
 		SPtr<ct::Texture> coreTexture = mFilteredTexture->getCore();
 
+		// When many probes are dirtied at once (e.g. a time-of-day change) the renderer's per-frame task budget can't
+		// cover all of them, so probes with a larger estimated screen influence get refreshed first.
+		float priority = mType == ReflectionProbeType::Sphere ? mRadius : mExtents.length();
+
+		SPtr<Camera> mainCamera = gSceneManager().getMainCamera();
+		if (mainCamera != nullptr)
+		{
+			float distance = (mainCamera->getTransform().getPosition() - mTransform.getPosition()).length();
+			priority /= std::max(distance, 1.0f);
+		}
+
+		// Filtering is spread out over multiple frames (one mip level per frame) so a probe refresh doesn't cause
+		// a framerate hitch. The worker is re-run every frame until it reports completion.
+		auto filterMipAndFinish = [coreTexture, coreProbe](SPtr<ct::Texture>& scratch, UINT32 mip)
+		{
+			UINT32 numMips = coreTexture->getProperties().getNumMipmaps();
+			if (mip < numMips)
+				ct::gIBLUtility().filterCubemapForSpecularMip(coreTexture, scratch, mip);
+
+			if (mip + 1 < numMips)
+				return false;
+
+			scratch = nullptr;
+
+			coreProbe->mFilteredTexture = coreTexture;
+			ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+
+			return true;
+		};
+
 		if (mCustomTexture == nullptr)
 		{
-			auto renderReflProbe = [coreTexture, coreProbe]()
+			auto renderReflProbe =
+				[coreTexture, coreProbe, filterMipAndFinish, stage = 0U, scratch = SPtr<ct::Texture>()]() mutable
 			{
-				float radius = coreProbe->mType == ReflectionProbeType::Sphere ? coreProbe->mRadius : 
-					coreProbe->mExtents.length();
+				if (stage == 0)
+				{
+					float radius = coreProbe->mType == ReflectionProbeType::Sphere ? coreProbe->mRadius :
+						coreProbe->mExtents.length();
+
+					ct::CaptureSettings settings;
+					settings.encodeDepth = true;
+					settings.depthEncodeNear = radius;
+					settings.depthEncodeFar = radius + 1; // + 1 arbitrary, make it a customizable value?
 
-				ct::CaptureSettings settings;
-				settings.encodeDepth = true;
-				settings.depthEncodeNear = radius;
-				settings.depthEncodeFar = radius + 1; // + 1 arbitrary, make it a customizable value?
+					ct::gRenderer()->captureSceneCubeMap(coreTexture, coreProbe->getTransform().getPosition(), settings);
 
-				ct::gRenderer()->captureSceneCubeMap(coreTexture, coreProbe->getTransform().getPosition(), settings);
-				ct::gIBLUtility().filterCubemapForSpecular(coreTexture, nullptr);
+					stage++;
+					return false;
+				}
 
-				coreProbe->mFilteredTexture = coreTexture;
-				ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+				if (stage == 1)
+				{
+					scratch = ct::gIBLUtility().filterCubemapForSpecularPrepare(coreTexture, nullptr);
 
-				return true;
+					stage++;
+					return false;
+				}
+
+				UINT32 mip = stage - 1;
+				stage++;
+
+				return filterMipAndFinish(scratch, mip);
 			};
 
-			mRendererTask = ct::RendererTask::create("ReflProbeRender", renderReflProbe);
+			mRendererTask = ct::RendererTask::create("ReflProbeRender", renderReflProbe, priority);
 		}
 		else
 		{
 			SPtr<ct::Texture> coreCustomTex = mCustomTexture->getCore();
-			auto filterReflProbe = [coreCustomTex, coreTexture, coreProbe]()
+			auto filterReflProbe =
+				[coreCustomTex, coreTexture, coreProbe, filterMipAndFinish, stage = 0U, scratch = SPtr<ct::Texture>()]() mutable
 			{
-				ct::gIBLUtility().scaleCubemap(coreCustomTex, 0, coreTexture, 0);
-				ct::gIBLUtility().filterCubemapForSpecular(coreTexture, nullptr);
+				if (stage == 0)
+				{
+					ct::gIBLUtility().scaleCubemap(coreCustomTex, 0, coreTexture, 0);
+					scratch = ct::gIBLUtility().filterCubemapForSpecularPrepare(coreTexture, nullptr);
+
+					stage++;
+					return false;
+				}
 
-				coreProbe->mFilteredTexture = coreTexture;
-				ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+				UINT32 mip = stage;
+				stage++;
 
-				return true;
+				return filterMipAndFinish(scratch, mip);
 			};
 
-			mRendererTask = ct::RendererTask::create("ReflProbeRender", filterReflProbe);
+			mRendererTask = ct::RendererTask::create("ReflProbeRender", filterReflProbe, priority);
 		}
 
 		mRendererTask->onComplete.connect(renderComplete);
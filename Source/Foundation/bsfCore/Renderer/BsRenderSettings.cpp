@@ -85,6 +85,16 @@ namespace bs
 		return ShadowSettings::getRTTIStatic();
 	}
 
+	RTTITypeBase* DynamicResolutionSettings::getRTTIStatic()
+	{
+		return DynamicResolutionSettingsRTTI::instance();
+	}
+
+	RTTITypeBase* DynamicResolutionSettings::getRTTI() const
+	{
+		return DynamicResolutionSettings::getRTTIStatic();
+	}
+
 	RTTITypeBase* RenderSettings::getRTTIStatic()
 	{
 		return RenderSettingsRTTI::instance();
@@ -109,6 +119,10 @@ namespace bs
 		bufferSize += rttiGetElemSize(enableIndirectLighting);
 		bufferSize += rttiGetElemSize(overlayOnly);
 		bufferSize += rttiGetElemSize(enableSkybox);
+		bufferSize += rttiGetElemSize(enableOcclusionCulling);
+		bufferSize += rttiGetElemSize(enableOrderIndependentTransparency);
+		bufferSize += rttiGetElemSize(onDemandDrawing);
+		bufferSize += rttiGetElemSize(previewMode);
 
 		bufferSize += rttiGetElemSize(autoExposure.histogramLog2Min);
 		bufferSize += rttiGetElemSize(autoExposure.histogramLog2Max);
@@ -162,6 +176,11 @@ namespace bs
 		bufferSize += rttiGetElemSize(shadowSettings.cascadeDistributionExponent);
 		bufferSize += rttiGetElemSize(shadowSettings.shadowFilteringQuality);
 
+		bufferSize += rttiGetElemSize(dynamicResolution.enabled);
+		bufferSize += rttiGetElemSize(dynamicResolution.targetFrameTimeMs);
+		bufferSize += rttiGetElemSize(dynamicResolution.minResolutionScale);
+		bufferSize += rttiGetElemSize(dynamicResolution.maxResolutionScale);
+
 		if (buffer == nullptr)
 		{
 			size = bufferSize;
@@ -186,6 +205,10 @@ namespace bs
 		writeDst = rttiWriteElem(enableIndirectLighting, writeDst);
 		writeDst = rttiWriteElem(overlayOnly, writeDst);
 		writeDst = rttiWriteElem(enableSkybox, writeDst);
+		writeDst = rttiWriteElem(enableOcclusionCulling, writeDst);
+		writeDst = rttiWriteElem(enableOrderIndependentTransparency, writeDst);
+		writeDst = rttiWriteElem(onDemandDrawing, writeDst);
+		writeDst = rttiWriteElem(previewMode, writeDst);
 
 		writeDst = rttiWriteElem(autoExposure.histogramLog2Min, writeDst);
 		writeDst = rttiWriteElem(autoExposure.histogramLog2Max, writeDst);
@@ -238,6 +261,11 @@ namespace bs
 		writeDst = rttiWriteElem(shadowSettings.numCascades, writeDst);
 		writeDst = rttiWriteElem(shadowSettings.cascadeDistributionExponent, writeDst);
 		writeDst = rttiWriteElem(shadowSettings.shadowFilteringQuality, writeDst);
+
+		writeDst = rttiWriteElem(dynamicResolution.enabled, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.targetFrameTimeMs, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.minResolutionScale, writeDst);
+		writeDst = rttiWriteElem(dynamicResolution.maxResolutionScale, writeDst);
 	}
 
 	void RenderSettings::_setSyncData(UINT8* buffer, UINT32 size)
@@ -255,6 +283,10 @@ namespace bs
 		readSource = rttiReadElem(enableIndirectLighting, readSource);
 		readSource = rttiReadElem(overlayOnly, readSource);
 		readSource = rttiReadElem(enableSkybox, readSource);
+		readSource = rttiReadElem(enableOcclusionCulling, readSource);
+		readSource = rttiReadElem(enableOrderIndependentTransparency, readSource);
+		readSource = rttiReadElem(onDemandDrawing, readSource);
+		readSource = rttiReadElem(previewMode, readSource);
 
 		readSource = rttiReadElem(autoExposure.histogramLog2Min, readSource);
 		readSource = rttiReadElem(autoExposure.histogramLog2Max, readSource);
@@ -307,5 +339,10 @@ namespace bs
 		readSource = rttiReadElem(shadowSettings.numCascades, readSource);
 		readSource = rttiReadElem(shadowSettings.cascadeDistributionExponent, readSource);
 		readSource = rttiReadElem(shadowSettings.shadowFilteringQuality, readSource);
+
+		readSource = rttiReadElem(dynamicResolution.enabled, readSource);
+		readSource = rttiReadElem(dynamicResolution.targetFrameTimeMs, readSource);
+		readSource = rttiReadElem(dynamicResolution.minResolutionScale, readSource);
+		readSource = rttiReadElem(dynamicResolution.maxResolutionScale, readSource);
 	}
 }
\ No newline at end of file
@@ -447,7 +447,50 @@ namespace bs
 		static RTTITypeBase* getRTTIStatic();
 		RTTITypeBase* getRTTI() const override;
 	};
-	
+
+	/** Various options that control dynamic resolution scaling for a specific view. */
+	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Rendering) DynamicResolutionSettings : public IReflectable
+	{
+		BS_SCRIPT_EXPORT()
+		DynamicResolutionSettings() = default;
+
+		/**
+		 * Enables dynamic resolution scaling. When enabled the renderer tracks how long the GPU takes to render a frame
+		 * and lowers the resolution the 3D scene is rendered at when the target frame time cannot be met, within the
+		 * bounds set by minResolutionScale and maxResolutionScale. The scaled image is resampled to the output
+		 * resolution at the end of the frame, while overlays (e.g. GUI) are always rendered at full resolution.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool enabled = false;
+
+		/**
+		 * GPU frame time the scaler attempts to maintain, in milliseconds. When the measured frame time exceeds this
+		 * value the rendering resolution is lowered, and raised back up when there is spare budget. For example use
+		 * 16.6 to target 60 frames per second.
+		 */
+		BS_SCRIPT_EXPORT()
+		float targetFrameTimeMs = 16.6f;
+
+		/**
+		 * Lowest resolution scale the scaler is allowed to drop to, in range [0.1, 1]. Applied separately to width and
+		 * height (e.g. 0.5 renders at a quarter of the output pixel count).
+		 */
+		BS_SCRIPT_EXPORT()
+		float minResolutionScale = 0.5f;
+
+		/** Highest resolution scale the scaler is allowed to reach, in range [0.1, 1]. */
+		BS_SCRIPT_EXPORT()
+		float maxResolutionScale = 1.0f;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class DynamicResolutionSettingsRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
 	/** Settings that control rendering for a specific camera (view). */
 	struct BS_CORE_EXPORT BS_SCRIPT_EXPORT(m:Rendering) RenderSettings : public IReflectable
 	{
@@ -561,6 +604,13 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		ShadowSettings shadowSettings;
 
+		/**
+		 * Parameters used for customizing dynamic resolution scaling, which lowers the resolution the 3D scene is
+		 * rendered at in order to maintain a target frame time. Overlays (e.g. GUI) always render at full resolution.
+		 */
+		BS_SCRIPT_EXPORT()
+		DynamicResolutionSettings dynamicResolution;
+
 		/** Determines if indirect lighting (e.g. from light probes or the sky) is rendered. */
 		BS_SCRIPT_EXPORT()
 		bool enableIndirectLighting = true;
@@ -580,6 +630,51 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool enableSkybox = true;
 
+		/**
+		 * Determines should renderable objects hidden behind other geometry be culled before rendering. Culling is
+		 * performed using a downsampled version of the depth buffer from the previous frame, meaning results lag one frame
+		 * behind - objects revealed by a sudden change (e.g. a camera cut or a fast moving occluder) may be missing for a
+		 * single frame. The culling is conservative and mostly benefits scenes with significant occlusion (e.g. cities or
+		 * interiors), where it can significantly reduce the number of drawn objects.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool enableOcclusionCulling = false;
+
+		/**
+		 * Allows the renderer to draw transparent objects whose blend mode is order independent (e.g. additive
+		 * particles or effects) sorted by material instead of by distance. Such objects blend to the same result
+		 * regardless of draw order, so sorting them by material lets the renderer batch them together and greatly
+		 * reduces state switches in effect-heavy scenes. Objects using regular alpha blending are unaffected and
+		 * remain sorted by distance.
+		 *
+		 * @note
+		 * Order independent objects are drawn after all regular transparent objects. When the two types overlap the
+		 * result can differ slightly from fully sorted rendering (e.g. an additive effect seen through alpha blended
+		 * glass will not be attenuated by the glass).
+		 */
+		BS_SCRIPT_EXPORT()
+		bool enableOrderIndependentTransparency = false;
+
+		/**
+		 * Causes the view to be redrawn only when its contents change, instead of every frame. When nothing changed the
+		 * renderer skips both the re-render and the buffer swap of the view's render target, leaving the previously
+		 * presented image on screen and reducing GPU usage of mostly static views to near zero. Only honored for views
+		 * that also have overlayOnly enabled (e.g. GUI-only windows), as only overlays are able to report changes to
+		 * their contents - scene views are always redrawn.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool onDemandDrawing = false;
+
+		/**
+		 * Renders the view through a lightweight path intended for small live previews, such as 3D item previews
+		 * embedded in GUI. Post-processing is skipped and shadows, indirect lighting, ambient occlusion and screen
+		 * space reflections are forced off. Additionally the renderer refreshes preview views in round-robin order
+		 * (see RenderBeastOptions::previewRefreshInterval) instead of re-rendering each of them every frame, keeping
+		 * the total cost of many simultaneous previews low. Only honored for views rendering to a non-window target.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool previewMode = false;
+
 		/** @name Internal
 		 *  @{
 		 */
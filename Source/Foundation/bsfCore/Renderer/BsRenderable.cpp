@@ -12,6 +12,7 @@
 #include "RenderAPI/BsGpuBuffer.h"
 #include "Animation/BsAnimationManager.h"
 #include "Scene/BsSceneManager.h"
+#include "Utility/BsTime.h"
 
 namespace bs
 {
@@ -27,7 +28,7 @@ namespace bs
 	template<bool Core>
 	TRenderable<Core>::TRenderable()
 		: mLayer(1), mUseOverrideBounds(false), mTfrmMatrix(BsIdentity), mTfrmMatrixNoScale(BsIdentity)
-		, mAnimType(RenderableAnimType::None)
+		, mAnimType(RenderableAnimType::None), mVelocity(Vector3::ZERO)
 	{
 		mMaterials.resize(1);
 	}
@@ -129,6 +130,18 @@ namespace bs
 			_markCoreDirty();
 	}
 
+	template<bool Core>
+	void TRenderable<Core>::setVelocity(const Vector3& velocity)
+	{
+		if (mVelocity == velocity)
+			return;
+
+		mVelocity = velocity;
+		onVelocityChanged();
+
+		_markCoreDirty(ActorDirtyFlag::Transform);
+	}
+
 	template<bool Core>
 	void TRenderable<Core>::setUseOverrideBounds(bool enable)
 	{
@@ -192,6 +205,12 @@ namespace bs
 		}
 	}
 
+	bool Renderable::calculateBounds(AABox& bounds) const
+	{
+		bounds = getBounds().getBox();
+		return true;
+	}
+
 	SPtr<ct::Renderable> Renderable::getCore() const
 	{
 		return std::static_pointer_cast<ct::Renderable>(mCoreSpecific);
@@ -211,6 +230,46 @@ namespace bs
 		refreshAnimation();
 	}
 
+	void Renderable::onVelocityChanged()
+	{
+		mVelocityBasePos = mTransform.getPosition();
+		mVelocityBaseTime = gTime().getTime();
+	}
+
+	void Renderable::setExtrapolatedTransform(const Transform& transform)
+	{
+		if (mVelocity != Vector3::ZERO && mMobility == ObjectMobility::Movable)
+		{
+			// Maximum deviation from the extrapolated trajectory before a correction is synced to the core thread
+			constexpr float CORRECTION_EPSILON_SQRD = 0.01f * 0.01f;
+
+			float time = gTime().getTime();
+			Vector3 predictedPos = mVelocityBasePos + mVelocity * (time - mVelocityBaseTime);
+
+			const Vector3& newPos = transform.getPosition();
+			bool onTrajectory =
+				newPos.squaredDistance(predictedPos) <= CORRECTION_EPSILON_SQRD &&
+				transform.getRotation() == mTransform.getRotation() &&
+				transform.getScale() == mTransform.getScale();
+
+			if (onTrajectory)
+			{
+				// Core thread extrapolates this same movement locally, no sync required
+				mTransform = transform;
+				mTfrmMatrix = transform.getMatrix();
+				mTfrmMatrixNoScale = Matrix4::TRS(newPos, transform.getRotation(), Vector3::ONE);
+
+				return;
+			}
+
+			// Off trajectory, sync a correction and re-base the prediction
+			mVelocityBasePos = newPos;
+			mVelocityBaseTime = time;
+		}
+
+		setTransform(transform);
+	}
+
 	void Renderable::refreshAnimation()
 	{
 		if (mAnimation == nullptr)
@@ -263,12 +322,12 @@ namespace bs
 				// hash to reduce the number of required updates.
 				HSceneObject parentSO = so.getParent();
 				if (parentSO != nullptr)
-					setTransform(parentSO->getTransform());
+					setExtrapolatedTransform(parentSO->getTransform());
 				else
-					setTransform(Transform());
+					setExtrapolatedTransform(Transform());
 			}
 			else
-				setTransform(so.getTransform());
+				setExtrapolatedTransform(so.getTransform());
 
 			mHash = curHash;
 		}
@@ -294,6 +353,30 @@ namespace bs
 
 	CoreSyncData Renderable::syncToCore(FrameAlloc* allocator)
 	{
+		UINT32 dirtyFlags = getCoreDirtyFlags();
+
+		// The most common change by far is a moved transform, so that case gets a minimal payload instead of the full
+		// actor state. Dirty flags are written first so the core thread knows which layout to expect.
+		if (dirtyFlags == (UINT32)ActorDirtyFlag::Transform)
+		{
+			UINT32 size =
+				rttiGetElemSize(dirtyFlags) +
+				getActorSyncDataSize() +
+				rttiGetElemSize(mTfrmMatrix) +
+				rttiGetElemSize(mTfrmMatrixNoScale) +
+				rttiGetElemSize(mVelocity);
+
+			UINT8* data = allocator->alloc(size);
+			char* dataPtr = (char*)data;
+			dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
+			dataPtr = syncActorTo(dataPtr);
+			dataPtr = rttiWriteElem(mTfrmMatrix, dataPtr);
+			dataPtr = rttiWriteElem(mTfrmMatrixNoScale, dataPtr);
+			dataPtr = rttiWriteElem(mVelocity, dataPtr);
+
+			return CoreSyncData(data, size);
+		}
+
 		UINT32 numMaterials = (UINT32)mMaterials.size();
 
 		UINT64 animationId;
@@ -303,21 +386,23 @@ namespace bs
 			animationId = (UINT64)-1;
 
 		UINT32 size =
+			rttiGetElemSize(dirtyFlags) +
 			getActorSyncDataSize() +
-			rttiGetElemSize(mLayer) + 
-			rttiGetElemSize(mOverrideBounds) + 
+			rttiGetElemSize(mLayer) +
+			rttiGetElemSize(mOverrideBounds) +
 			rttiGetElemSize(mUseOverrideBounds) +
-			rttiGetElemSize(numMaterials) + 
+			rttiGetElemSize(numMaterials) +
 			rttiGetElemSize(mTfrmMatrix) +
 			rttiGetElemSize(mTfrmMatrixNoScale) +
+			rttiGetElemSize(mVelocity) +
 			rttiGetElemSize(animationId) +
-			rttiGetElemSize(mAnimType) + 
-			rttiGetElemSize(getCoreDirtyFlags()) +
+			rttiGetElemSize(mAnimType) +
 			sizeof(SPtr<ct::Mesh>) +
 			numMaterials * sizeof(SPtr<ct::Material>);
 
 		UINT8* data = allocator->alloc(size);
 		char* dataPtr = (char*)data;
+		dataPtr = rttiWriteElem(dirtyFlags, dataPtr);
 		dataPtr = syncActorTo(dataPtr);
 		dataPtr = rttiWriteElem(mLayer, dataPtr);
 		dataPtr = rttiWriteElem(mOverrideBounds, dataPtr);
@@ -325,9 +410,9 @@ namespace bs
 		dataPtr = rttiWriteElem(numMaterials, dataPtr);
 		dataPtr = rttiWriteElem(mTfrmMatrix, dataPtr);
 		dataPtr = rttiWriteElem(mTfrmMatrixNoScale, dataPtr);
+		dataPtr = rttiWriteElem(mVelocity, dataPtr);
 		dataPtr = rttiWriteElem(animationId, dataPtr);
 		dataPtr = rttiWriteElem(mAnimType, dataPtr);
-		dataPtr = rttiWriteElem(getCoreDirtyFlags(), dataPtr);
 
 		SPtr<ct::Mesh>* mesh = new (dataPtr) SPtr<ct::Mesh>();
 		if (mMesh.isLoaded())
@@ -525,13 +610,146 @@ namespace bs
 			vertexBuffer->unlock();
 
 			mMorphShapeBuffer = vertexBuffer;
+
+			if (gRenderer()->usesGpuMorphBlending())
+				createMorphBlendBuffers();
+			else
+			{
+				mMorphDeltaBuffer = nullptr;
+				mMorphVertexRangeBuffer = nullptr;
+				mMorphWeightBuffer = nullptr;
+				mMorphBlendOutputBuffer = nullptr;
+			}
 		}
 		else
+		{
 			mMorphShapeBuffer = nullptr;
+			mMorphDeltaBuffer = nullptr;
+			mMorphVertexRangeBuffer = nullptr;
+			mMorphWeightBuffer = nullptr;
+			mMorphBlendOutputBuffer = nullptr;
+		}
 
 		mMorphShapeVersion = 0;
 	}
 
+	void Renderable::createMorphBlendBuffers()
+	{
+		SPtr<MorphShapes> morphShapes = mMesh->getMorphShapes();
+		UINT32 numVertices = morphShapes->getNumVertices();
+
+		// Must match the layout expected by the morph blend compute shader
+		struct MorphDelta
+		{
+			Vector3 position;
+			UINT32 shapeIdx;
+			Vector3 normal;
+			float padding;
+		};
+
+		// Flatten the shapes in the same channel-by-channel order the animation system resolves their weights in
+		Vector<SPtr<MorphShape>> shapes;
+		UINT32 numEntries = 0;
+		UINT32 numChannels = morphShapes->getNumChannels();
+		for (UINT32 i = 0; i < numChannels; i++)
+		{
+			SPtr<MorphChannel> channel = morphShapes->getChannel(i);
+			UINT32 numShapes = channel->getNumShapes();
+			for (UINT32 j = 0; j < numShapes; j++)
+			{
+				SPtr<MorphShape> shape = channel->getShape(j);
+				numEntries += (UINT32)shape->getVertices().size();
+				shapes.push_back(shape);
+			}
+		}
+
+		// Group the deltas of all shapes per target vertex, so the blend shader can gather a vertex in a single pass
+		Vector<std::pair<UINT32, UINT32>> vertexRanges(numVertices, std::make_pair(0U, 0U));
+		for (auto& shape : shapes)
+		{
+			for (auto& vertex : shape->getVertices())
+				vertexRanges[vertex.sourceIdx].second++;
+		}
+
+		UINT32 offset = 0;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			vertexRanges[i].first = offset;
+			offset += vertexRanges[i].second;
+		}
+
+		Vector<MorphDelta> deltas(std::max(numEntries, 1U));
+		Vector<UINT32> entryOffsets(numVertices, 0);
+		for (UINT32 i = 0; i < (UINT32)shapes.size(); i++)
+		{
+			for (auto& vertex : shapes[i]->getVertices())
+			{
+				MorphDelta& delta = deltas[vertexRanges[vertex.sourceIdx].first + entryOffsets[vertex.sourceIdx]];
+				delta.position = vertex.deltaPosition;
+				delta.shapeIdx = i;
+				delta.normal = vertex.deltaNormal;
+				delta.padding = 0.0f;
+
+				entryOffsets[vertex.sourceIdx]++;
+			}
+		}
+
+		GPU_BUFFER_DESC deltaDesc;
+		deltaDesc.type = GBT_STRUCTURED;
+		deltaDesc.elementCount = (UINT32)deltas.size();
+		deltaDesc.elementSize = sizeof(MorphDelta);
+		deltaDesc.format = BF_UNKNOWN;
+		deltaDesc.usage = GBU_STATIC;
+
+		mMorphDeltaBuffer = GpuBuffer::create(deltaDesc);
+		mMorphDeltaBuffer->writeData(0, (UINT32)(deltas.size() * sizeof(MorphDelta)), deltas.data(), BWT_DISCARD);
+
+		GPU_BUFFER_DESC rangeDesc;
+		rangeDesc.type = GBT_STANDARD;
+		rangeDesc.elementCount = numVertices;
+		rangeDesc.format = BF_32X2U;
+		rangeDesc.usage = GBU_STATIC;
+
+		mMorphVertexRangeBuffer = GpuBuffer::create(rangeDesc);
+		mMorphVertexRangeBuffer->writeData(0, numVertices * sizeof(UINT32) * 2, vertexRanges.data(), BWT_DISCARD);
+
+		GPU_BUFFER_DESC weightDesc;
+		weightDesc.type = GBT_STANDARD;
+		weightDesc.elementCount = std::max((UINT32)shapes.size(), 1U);
+		weightDesc.format = BF_32X1F;
+		weightDesc.usage = GBU_DYNAMIC;
+
+		mMorphWeightBuffer = GpuBuffer::create(weightDesc);
+
+		Vector<float> initialWeights(weightDesc.elementCount, 0.0f);
+		mMorphWeightBuffer->writeData(0, weightDesc.elementCount * sizeof(float), initialWeights.data(), BWT_DISCARD);
+
+		// Compute output, laid out identically to the morph vertex stream. Vertex buffers cannot be written to from a
+		// compute shader directly, so the renderer copies this into the morph shape buffer after blending.
+		GPU_BUFFER_DESC outputDesc;
+		outputDesc.type = GBT_STANDARD;
+		outputDesc.elementCount = numVertices;
+		outputDesc.format = BF_32X4F;
+		outputDesc.usage = GBU_STATIC;
+		outputDesc.randomGpuWrite = true;
+
+		mMorphBlendOutputBuffer = GpuBuffer::create(outputDesc);
+	}
+
+	bool Renderable::_extrapolateTransform(float timeDelta)
+	{
+		if (mVelocity == Vector3::ZERO || mMobility != ObjectMobility::Movable)
+			return false;
+
+		Vector3 newPos = mTransform.getPosition() + mVelocity * timeDelta;
+
+		mTransform.setPosition(newPos);
+		mTfrmMatrix = mTransform.getMatrix();
+		mTfrmMatrixNoScale = Matrix4::TRS(newPos, mTransform.getRotation(), Vector3::ONE);
+
+		return true;
+	}
+
 	void Renderable::updateAnimationBuffers(const EvaluatedAnimationData& animData)
 	{
 		if (mAnimationId == (UINT64)-1)
@@ -570,11 +788,25 @@ namespace bs
 			{
 				SPtr<MeshData> meshData = animInfo->morphShapeInfo.meshData;
 
-				UINT32 bufferSize = meshData->getSize();
-				UINT8* data = meshData->getData();
+				if (meshData != nullptr)
+				{
+					UINT32 bufferSize = meshData->getSize();
+					UINT8* data = meshData->getData();
+
+					mMorphShapeBuffer->writeData(0, bufferSize, data, BWT_DISCARD);
+					mMorphShapeVersion = animInfo->morphShapeInfo.version;
+				}
+				else if (mMorphWeightBuffer != nullptr)
+				{
+					// Renderer blends the shapes on the GPU, we only provide the weights. The renderer detects the version
+					// change and re-runs the blend for elements that are out of date.
+					const Vector<float>& weights = animInfo->morphShapeInfo.shapeWeights;
+
+					if (!weights.empty())
+						mMorphWeightBuffer->writeData(0, (UINT32)(weights.size() * sizeof(float)), weights.data(), BWT_DISCARD);
 
-				mMorphShapeBuffer->writeData(0, bufferSize, data, BWT_DISCARD);
-				mMorphShapeVersion = animInfo->morphShapeInfo.version;
+					mMorphShapeVersion = animInfo->morphShapeInfo.version;
+				}
 			}
 		}
 	}
@@ -583,10 +815,26 @@ namespace bs
 	{
 		char* dataPtr = (char*)data.getBuffer();
 
+		UINT32 dirtyFlags = 0;
+		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
+
+		// Transform-only changes use a minimal payload, see the sim thread version of this method
+		if (dirtyFlags == (UINT32)ActorDirtyFlag::Transform)
+		{
+			dataPtr = syncActorFrom(dataPtr);
+			dataPtr = rttiReadElem(mTfrmMatrix, dataPtr);
+			dataPtr = rttiReadElem(mTfrmMatrixNoScale, dataPtr);
+			dataPtr = rttiReadElem(mVelocity, dataPtr);
+
+			if (mActive)
+				gRenderer()->notifyRenderableUpdated(this);
+
+			return;
+		}
+
 		mMaterials.clear();
 
 		UINT32 numMaterials = 0;
-		UINT32 dirtyFlags = 0;
 		bool oldIsActive = mActive;
 
 		dataPtr = syncActorFrom(dataPtr);
@@ -596,9 +844,9 @@ namespace bs
 		dataPtr = rttiReadElem(numMaterials, dataPtr);
 		dataPtr = rttiReadElem(mTfrmMatrix, dataPtr);
 		dataPtr = rttiReadElem(mTfrmMatrixNoScale, dataPtr);
+		dataPtr = rttiReadElem(mVelocity, dataPtr);
 		dataPtr = rttiReadElem(mAnimationId, dataPtr);
 		dataPtr = rttiReadElem(mAnimType, dataPtr);
-		dataPtr = rttiReadElem(dirtyFlags, dataPtr);
 
 		SPtr<Mesh>* mesh = (SPtr<Mesh>*)dataPtr;
 		mMesh = *mesh;
@@ -95,6 +95,18 @@ namespace bs
 		 */
 		void setUseOverrideBounds(bool enable);
 
+		/**
+		 * Sets a constant linear velocity, in world units per second, that the object is expected to move at. When
+		 * non-zero the core thread extrapolates the object's position locally every frame instead of requiring a
+		 * transform sync from the simulation thread. Transform changes that match the registered trajectory are then
+		 * elided entirely, and only corrections (velocity or direction changes, teleports, rotation or scale changes)
+		 * generate sync traffic. Set to Vector3::ZERO (the default) to disable extrapolation.
+		 */
+		void setVelocity(const Vector3& velocity);
+
+		/** @copydoc setVelocity() */
+		const Vector3& getVelocity() const { return mVelocity; }
+
 		/** @copydoc setLayer() */
 		UINT64 getLayer() const { return mLayer; }
 
@@ -127,6 +139,9 @@ namespace bs
 		/** Triggered whenever the renderable's mesh changes. */
 		virtual void onMeshChanged() { }
 
+		/** Triggered whenever the renderable's velocity changes. */
+		virtual void onVelocityChanged() { }
+
 		MeshType mMesh;
 		Vector<MaterialType> mMaterials;
 		UINT64 mLayer;
@@ -135,6 +150,7 @@ namespace bs
 		Matrix4 mTfrmMatrix;
 		Matrix4 mTfrmMatrixNoScale;
 		RenderableAnimType mAnimType;
+		Vector3 mVelocity;
 	};
 
 	/** @} */
@@ -150,6 +166,9 @@ namespace bs
 		/**	Gets world bounds of the mesh rendered by this object. */
 		Bounds getBounds() const;
 
+		/** @copydoc SceneActor::calculateBounds */
+		bool calculateBounds(AABox& bounds) const override;
+
 		/** Sets the animation that will be used for animating the attached mesh. */
 		void setAnimation(const SPtr<Animation>& animation);
 
@@ -181,6 +200,17 @@ namespace bs
 		/** @copydoc TRenderable::onMeshChanged */
 		void onMeshChanged() override;
 
+		/** @copydoc TRenderable::onVelocityChanged */
+		void onVelocityChanged() override;
+
+		/**
+		 * Applies a transform change coming from the scene object. When velocity extrapolation is active and the new
+		 * transform lies on the registered trajectory the change is applied locally without triggering a core sync,
+		 * since the core thread extrapolates the same movement on its own. Any other change falls back to a regular
+		 * setTransform() call, which also serves as the trajectory correction.
+		 */
+		void setExtrapolatedTransform(const Transform& transform);
+
 		/** Updates animation properties depending on the current mesh. */
 		void refreshAnimation();
 
@@ -212,6 +242,8 @@ namespace bs
 		static SPtr<Renderable> createEmpty();
 
 		SPtr<Animation> mAnimation;
+		Vector3 mVelocityBasePos = Vector3::ZERO;
+		float mVelocityBaseTime = 0.0f;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -260,6 +292,32 @@ namespace bs
 		/** Returns vertex declaration used for rendering meshes containing morph shape information. */
 		const SPtr<VertexDeclaration>& getMorphVertexDeclaration() const { return mMorphVertexDeclaration; }
 
+		/**
+		 * Returns the GPU buffer containing vertex deltas of all morph shapes, grouped per target vertex. Only valid when
+		 * the active renderer blends morph shapes on the GPU.
+		 */
+		const SPtr<GpuBuffer>& getMorphDeltaBuffer() const { return mMorphDeltaBuffer; }
+
+		/** Returns the GPU buffer containing the range of delta buffer entries belonging to each morph vertex. */
+		const SPtr<GpuBuffer>& getMorphVertexRangeBuffer() const { return mMorphVertexRangeBuffer; }
+
+		/** Returns the GPU buffer containing the current blend weight of every morph shape. */
+		const SPtr<GpuBuffer>& getMorphWeightBuffer() const { return mMorphWeightBuffer; }
+
+		/** Returns the writeable GPU buffer the renderer outputs blended morph vertices into. */
+		const SPtr<GpuBuffer>& getMorphBlendOutputBuffer() const { return mMorphBlendOutputBuffer; }
+
+		/** Returns the version of the morph shape data the animation buffers currently contain. */
+		UINT32 getMorphShapeVersion() const { return mMorphShapeVersion; }
+
+		/**
+		 * Advances the object's position along its registered velocity by the provided time step. Called by the
+		 * renderer once per frame for velocity-driven objects, in place of a transform sync from the simulation
+		 * thread. Returns false if the object isn't velocity-driven (or isn't movable), in which case the transform
+		 * is left untouched.
+		 */
+		bool _extrapolateTransform(float timeDelta);
+
 	protected:
 		friend class bs::Renderable;
 
@@ -274,6 +332,12 @@ namespace bs
 		/** Creates any buffers required for renderable animation. Should be called whenever animation properties change. */
 		void createAnimationBuffers();
 
+		/**
+		 * Creates buffers required for blending morph shapes on the GPU. Only relevant if the active renderer supports
+		 * GPU morph blending.
+		 */
+		void createMorphBlendBuffers();
+
 		UINT32 mRendererId;
 		UINT64 mAnimationId;
 		UINT32 mMorphShapeVersion;
@@ -281,6 +345,11 @@ namespace bs
 		SPtr<GpuBuffer> mBoneMatrixBuffer;
 		SPtr<VertexBuffer> mMorphShapeBuffer;
 		SPtr<VertexDeclaration> mMorphVertexDeclaration;
+
+		SPtr<GpuBuffer> mMorphDeltaBuffer;
+		SPtr<GpuBuffer> mMorphVertexRangeBuffer;
+		SPtr<GpuBuffer> mMorphWeightBuffer;
+		SPtr<GpuBuffer> mMorphBlendOutputBuffer;
 	};
 	}
 
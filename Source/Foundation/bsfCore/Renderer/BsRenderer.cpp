@@ -51,6 +51,43 @@ namespace bs { namespace ct
 			return (UINT32)a->getLocation() < (UINT32)b->getLocation();
 	}
 
+	void Renderer::_unregisterExtension(RendererExtension* extension)
+	{
+		auto iterFind = std::find(mSimExtensions.begin(), mSimExtensions.end(), extension);
+		if (iterFind != mSimExtensions.end())
+			mSimExtensions.erase(iterFind);
+	}
+
+	void Renderer::_syncExtensionData()
+	{
+		Vector<std::pair<RendererExtension*, UINT32>> swaps;
+		for (auto& entry : mSimExtensions)
+		{
+			if (!entry->mDataDirty)
+				continue;
+
+			UINT32 idx = entry->mSimDataIdx;
+			entry->mSimDataIdx = (idx + 1) % 2;
+			entry->mDataDirty = false;
+
+			swaps.push_back(std::make_pair(entry, idx));
+		}
+
+		if (swaps.empty())
+			return;
+
+		// The buffer flip is queued rather than done immediately, guaranteeing the core thread only starts reading the
+		// new buffer once it is done rendering any previously queued frames. Any extension destruction is queued after
+		// this command, so the raw pointers are guaranteed to remain valid.
+		auto swapBuffers = [swaps]()
+		{
+			for (auto& entry : swaps)
+				entry.first->mCoreDataIdx = entry.second;
+		};
+
+		gCoreThread().queueCommand(swapBuffers);
+	}
+
 	void Renderer::update()
 	{
 		for(auto& entry : mUnresolvedTasks)
@@ -86,6 +123,21 @@ namespace bs { namespace ct
 			mQueuedTasks.clear();
 		}
 
+		// Tasks with a higher priority always step first when the budget can't cover all of them. Stable sort preserves
+		// the round-robin rotation performed below for tasks of equal priority.
+		std::stable_sort(mRunningTasks.begin(), mRunningTasks.end(),
+			[](const SPtr<RendererTask>& lhs, const SPtr<RendererTask>& rhs)
+		{
+			return lhs->mPriority > rhs->mPriority;
+		});
+
+		const UINT32 stepBudget = mTaskStepBudget.load();
+		UINT32 numSteps = 0;
+
+		// Tasks that stepped this frame but didn't complete are queued after those that didn't get a chance to run, so
+		// tasks of equal priority make round-robin progress across frames rather than starving the back of the queue.
+		Vector<SPtr<RendererTask>> steppedTasks;
+
 		do
 		{
 			for (auto& entry : mRunningTasks)
@@ -93,15 +145,26 @@ namespace bs { namespace ct
 				if (entry->isCanceled() || entry->isComplete())
 					continue;
 
+				if (!forceAll && stepBudget > 0 && numSteps >= stepBudget)
+				{
+					mRemainingTasks.push_back(entry);
+					continue;
+				}
+
 				entry->mState.store(1);
 
 				bool complete = entry->mTaskWorker();
+				numSteps++;
+
 				if (!complete)
-					mRemainingTasks.push_back(entry);
+					steppedTasks.push_back(entry);
 				else
 					entry->mState.store(2);
 			}
 
+			mRemainingTasks.insert(mRemainingTasks.end(), steppedTasks.begin(), steppedTasks.end());
+			steppedTasks.clear();
+
 			mRunningTasks.clear();
 			std::swap(mRemainingTasks, mRunningTasks);
 		} while (forceAll && !mRunningTasks.empty());
@@ -136,13 +199,14 @@ namespace bs { namespace ct
 		return std::static_pointer_cast<Renderer>(RendererManager::instance().getActive());
 	}
 
-	RendererTask::RendererTask(const PrivatelyConstruct& dummy, String name, std::function<bool()> taskWorker) 
-		:mName(std::move(name)), mTaskWorker(std::move(taskWorker))
+	RendererTask::RendererTask(const PrivatelyConstruct& dummy, String name, std::function<bool()> taskWorker,
+		float priority)
+		:mName(std::move(name)), mTaskWorker(std::move(taskWorker)), mPriority(priority)
 	{ }
 
-	SPtr<RendererTask> RendererTask::create(String name, std::function<bool()> taskWorker)
+	SPtr<RendererTask> RendererTask::create(String name, std::function<bool()> taskWorker, float priority)
 	{
-		return bs_shared_ptr_new<RendererTask>(PrivatelyConstruct(), std::move(name), std::move(taskWorker));
+		return bs_shared_ptr_new<RendererTask>(PrivatelyConstruct(), std::move(name), std::move(taskWorker), priority);
 	}
 
 	bool RendererTask::isComplete() const
@@ -137,6 +137,14 @@ namespace bs
 		/** Name of the renderer. Used by materials to find an appropriate technique for this renderer. */
 		virtual const StringID& getName() const = 0;
 
+		/**
+		 * Checks does the renderer evaluate morph shape blending on the GPU. When true the animation system only needs to
+		 * provide per-shape weights, and can skip generating blended morph vertices on the CPU.
+		 *
+		 * @note	Thread safe.
+		 */
+		virtual bool usesGpuMorphBlending() const { return false; }
+
 		/** Called in order to render all currently active cameras. */
 		virtual void renderAll(const EvaluatedAnimationData* animData) = 0;
 
@@ -301,13 +309,38 @@ namespace bs
 		 */
 		void addPlugin(RendererExtension* plugin) { mCallbacks.insert(plugin); }
 
-		/** 
-		 * Unregisters an extension registered with addPlugin(). 
-		 * 
+		/**
+		 * Unregisters an extension registered with addPlugin().
+		 *
 		 * @note	Core thread.
 		 */
 		void removePlugin(RendererExtension* plugin) { mCallbacks.erase(plugin); }
 
+		/**
+		 * Registers an extension with the sim thread portion of the renderer, so its double-buffered data can be synced
+		 * every frame. Automatically called when an extension is created.
+		 *
+		 * @note	Sim thread.
+		 */
+		void _registerExtension(RendererExtension* extension) { mSimExtensions.push_back(extension); }
+
+		/**
+		 * Unregisters an extension registered with _registerExtension(). Automatically called before an extension is
+		 * destroyed.
+		 *
+		 * @note	Sim thread.
+		 */
+		void _unregisterExtension(RendererExtension* extension);
+
+		/**
+		 * Propagates any data written to extensions through RendererExtension::setData() to the core thread, by flipping
+		 * the relevant double-buffers. Should be called by renderAll() implementations once per frame, before queuing
+		 * core thread rendering.
+		 *
+		 * @note	Sim thread.
+		 */
+		void _syncExtensionData();
+
 		/**
 		 * Registers a new task for execution on the core thread.
 		 * 
@@ -315,6 +348,16 @@ namespace bs
 		 */
 		void addTask(const SPtr<RendererTask>& task);
 
+		/**
+		 * Sets the maximum number of multi-frame task steps the renderer will execute during a single frame. When more
+		 * tasks are queued than the budget allows, higher priority tasks are stepped first and tasks of equal priority
+		 * are stepped in round-robin order, so all of them make progress over consecutive frames. Set to 0 to disable
+		 * the limit and run every queued task each frame.
+		 *
+		 * @note	Thread safe.
+		 */
+		void setTaskStepBudget(UINT32 numSteps) { mTaskStepBudget.store(numSteps); }
+
 		/**	Sets options used for controlling the rendering. */
 		virtual void setOptions(const SPtr<RendererOptions>& options) { }
 
@@ -365,10 +408,11 @@ namespace bs
 		};
 
 		/**
-		 * Executes all renderer tasks queued for this frame.
+		 * Executes all renderer tasks queued for this frame, limited by the task step budget (see setTaskStepBudget()).
+		 *
+		 * @param[in]	forceAll	If true, multi-frame tasks will be forced to execute fully within this call,
+		 *							ignoring the task step budget.
 		 *
-		 * @param[in]	forceAll	If true, multi-frame tasks will be forced to execute fully within this call.
-		 * 
 		 * @note	Core thread.
 		 */
 		void processTasks(bool forceAll);
@@ -387,12 +431,14 @@ namespace bs
 		static bool compareCallback(const RendererExtension* a, const RendererExtension* b);
 
 		Set<RendererExtension*, std::function<bool(const RendererExtension*, const RendererExtension*)>> mCallbacks;
+		Vector<RendererExtension*> mSimExtensions; // Sim thread
 
 		Vector<SPtr<RendererTask>> mQueuedTasks; // Sim & core thread
 		Vector<SPtr<RendererTask>> mUnresolvedTasks; // Sim thread
 		Vector<SPtr<RendererTask>> mRemainingUnresolvedTasks; // Sim thread
 		Vector<SPtr<RendererTask>> mRunningTasks; // Core thread
 		Vector<SPtr<RendererTask>> mRemainingTasks; // Core thread
+		std::atomic<UINT32> mTaskStepBudget{4};
 		Mutex mTaskMutex;
 	};
 
@@ -410,7 +456,7 @@ namespace bs
 		struct PrivatelyConstruct {};
 
 	public:
-		RendererTask(const PrivatelyConstruct& dummy, String name, std::function<bool()> taskWorker);
+		RendererTask(const PrivatelyConstruct& dummy, String name, std::function<bool()> taskWorker, float priority);
 
 		/**
 		 * Creates a new task. Task should be provided to Renderer in order for it to start.
@@ -419,8 +465,10 @@ namespace bs
 		 * @param[in]	taskWorker	Worker method that does all of the work in the task. Tasks can run over the course of
 		 *							multiple frames, in which case this method should return false (if there's more
 		 *							work to be done), or true (if the task has completed).
+		 * @param[in]	priority	Determines the order in which tasks are executed when the renderer's per-frame task
+		 *							step budget can't cover all queued tasks. Higher priority tasks execute first.
 		 */
-		static SPtr<RendererTask> create(String name, std::function<bool()> taskWorker);
+		static SPtr<RendererTask> create(String name, std::function<bool()> taskWorker, float priority = 0.0f);
 
 		/** Returns true if the task has completed. */
 		bool isComplete() const;
@@ -446,6 +494,7 @@ namespace bs
 
 		String mName;
 		std::function<bool()> mTaskWorker;
+		float mPriority = 0.0f;
 		std::atomic<UINT32> mState{0}; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
 	};
 
@@ -9,6 +9,8 @@ namespace bs
 {
 	void RendererExtension::_initializer(RendererExtension* obj, const Any& data)
 	{
+		RendererManager::instance().getActive()->_registerExtension(obj);
+
 		auto coreInitializer = [=]()
 		{
 			RendererManager::instance().getActive()->addPlugin(obj);
@@ -20,6 +22,8 @@ namespace bs
 
 	void RendererExtension::_deleter(RendererExtension* obj)
 	{
+		RendererManager::instance().getActive()->_unregisterExtension(obj);
+
 		auto deleteObj = [=]()
 		{
 			RendererManager::instance().getActive()->removePlugin(obj);
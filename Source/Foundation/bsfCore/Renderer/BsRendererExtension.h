@@ -80,6 +80,16 @@ namespace bs
 		/** Returns true if the render() method should be called for the provided camera. */
 		virtual bool check(const ct::Camera& camera) = 0;
 
+		/**
+		 * Returns true if the extension has new content to render for the provided camera, since the last time render()
+		 * was called for it. The renderer uses this to skip redrawing views that use on-demand drawing (see
+		 * RenderSettings::onDemandDrawing) while their contents are unchanged. Extensions that don't track changes to
+		 * their content can leave the default implementation, which always reports new content. Note that removal of
+		 * previously rendered content also counts as a change - extensions tracking changes should keep reporting the
+		 * camera through check() until the clearing redraw was performed.
+		 */
+		virtual bool checkDirty(const ct::Camera& camera) { return true; }
+
 		/** 
 		 * Called at the point at which rendering should be performed for the provided camera. Relevant render targets
 		 * are guaranteed to be already bound to the render API, depending on the RenderLocation. Note that actual structure
@@ -94,19 +104,43 @@ namespace bs
 		 */
 		UINT32 getPriority() const { return mPriority; }
 
-		/** 
+		/**
 		 * Returns a location that determines at which point in rendering should the system call the render() method. See
 		 * RenderLocation.
 		 */
 		RenderLocation getLocation() const { return mLocation; }
 
+		/**
+		 * Sets data to be passed along to the extension on the core thread. The data is double-buffered: the value
+		 * written here becomes visible through getData() when the renderer starts processing the next frame, meaning
+		 * no core thread queue round-trip (and no blocking) is required per write. Writing multiple times within a
+		 * single frame simply overwrites the previous value.
+		 *
+		 * @note	Sim thread.
+		 */
+		void setData(const Any& data)
+		{
+			mData[mSimDataIdx] = data;
+			mDataDirty = true;
+		}
+
+		/**
+		 * Returns the data last provided by the sim thread through setData(), as of the start of the current frame.
+		 * Returns an empty Any if no data was ever set.
+		 *
+		 * @note	Core thread.
+		 */
+		const Any& getData() const { return mData[mCoreDataIdx]; }
+
 	protected:
 		RendererExtension(RenderLocation location, UINT32 priority)
-			:mLocation(location), mPriority(priority)
+			:mLocation(location), mPriority(priority), mSimDataIdx(0), mCoreDataIdx(1), mDataDirty(false)
 		{ }
 
 		virtual ~RendererExtension() {}
 	private:
+		friend class ct::Renderer;
+
 		/** Initializer that triggers when a renderer extension is first constructed. */
 		static void _initializer(RendererExtension* obj, const Any& data);
 
@@ -115,6 +149,11 @@ namespace bs
 
 		RenderLocation mLocation;
 		UINT32 mPriority;
+
+		Any mData[2];
+		UINT32 mSimDataIdx; // Sim thread
+		UINT32 mCoreDataIdx; // Core thread
+		bool mDataDirty; // Sim thread
 	};
 
 	/** @} */
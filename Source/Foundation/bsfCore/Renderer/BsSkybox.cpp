@@ -44,7 +44,9 @@ namespace bs
 			cubemapDesc.width = ct::IBLUtility::REFLECTION_CUBEMAP_SIZE;
 			cubemapDesc.height = ct::IBLUtility::REFLECTION_CUBEMAP_SIZE;
 			cubemapDesc.numMips = PixelUtil::getMaxMipmaps(cubemapDesc.width, cubemapDesc.height, 1, cubemapDesc.format);
-			cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET;
+
+			// Load-store usage allows the renderer to filter the cubemap using a compute shader, when supported
+			cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET | TU_LOADSTORE;
 
 			mFilteredRadiance = Texture::_createPtr(cubemapDesc);
 		}
@@ -85,7 +87,9 @@ namespace bs
 			return true;
 		};
 
-		mRendererTask = ct::RendererTask::create("SkyboxFilter", filterSkybox);
+		// Sky is visible on the entire screen, so its filtering always takes precedence over reflection probe updates
+		mRendererTask = ct::RendererTask::create("SkyboxFilter", filterSkybox,
+			std::numeric_limits<float>::max());
 
 		mRendererTask->onComplete.connect(renderComplete);
 		ct::gRenderer()->addTask(mRendererTask);
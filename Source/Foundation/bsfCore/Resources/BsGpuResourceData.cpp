@@ -16,6 +16,7 @@ namespace bs
 	GpuResourceData::GpuResourceData(const GpuResourceData& copy)
 	{
 		mData = copy.mData;
+		mLifetimeToken = copy.mLifetimeToken;
 		mLocked = copy.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 	}
@@ -28,6 +29,7 @@ namespace bs
 	GpuResourceData& GpuResourceData::operator=(const GpuResourceData& rhs)
 	{
 		mData = rhs.mData;
+		mLifetimeToken = rhs.mLifetimeToken;
 		mLocked = rhs.mLocked; // TODO - This should be shared by all copies pointing to the same data?
 		mOwnsData = false;
 
@@ -70,6 +72,8 @@ namespace bs
 
 	void GpuResourceData::freeInternalBuffer()
 	{
+		mLifetimeToken = nullptr;
+
 		if(mData == nullptr || !mOwnsData)
 			return;
 
@@ -101,6 +105,13 @@ namespace bs
 		mOwnsData = false;
 	}
 
+	void GpuResourceData::setExternalBuffer(UINT8* data, SPtr<const void> lifetimeToken)
+	{
+		setExternalBuffer(data);
+
+		mLifetimeToken = std::move(lifetimeToken);
+	}
+
 	void GpuResourceData::_lock() const
 	{
 		mLocked = true;
@@ -21,9 +21,10 @@ namespace bs
 	 * and sim thread will be allowed to access it when the operation ends. Caller can track AsyncOp%s regarding the 
 	 * read/write operation to be notified when it is complete.
 	 * @note
-	 * If you allocate an internal buffer to store the resource data, the ownership of the buffer will always remain with 
-	 * the initial instance of the class. If that initial instance is deleted, any potential copies will point to garbage 
-	 * data.
+	 * If you allocate an internal buffer to store the resource data, the ownership of the buffer will always remain with
+	 * the initial instance of the class. If that initial instance is deleted, any potential copies will point to garbage
+	 * data. External buffers registered together with a lifetime token don't suffer from this problem, as the token is
+	 * shared by all copies and keeps the foreign memory alive for as long as any of them exist.
 	 */
 	class BS_CORE_EXPORT GpuResourceData : public IReflectable
 	{
@@ -66,6 +67,34 @@ namespace bs
 		 */
 		void setExternalBuffer(UINT8* data);
 
+		/**
+		 * Makes the internal data pointer point to some external data, without copying it. Unlike
+		 * setExternalBuffer(UINT8*) the caller also provides a lifetime token - an arbitrary shared pointer whose
+		 * reference the object (and any copies of it) will hold on to for as long as the external data is referenced.
+		 * This allows the object to safely wrap foreign memory such as a memory mapped file range, a mapped staging
+		 * buffer or a portion of another buffer, without copying it and without the caller needing to manually
+		 * guarantee the memory outlives the object.
+		 *
+		 * @param[in]	data			External buffer the object should point to.
+		 * @param[in]	lifetimeToken	Shared pointer that keeps the external buffer alive. Released when the object
+		 *								releases the buffer (e.g. when it is destroyed, or a new buffer is assigned).
+		 *
+		 * @note	If any internal data is allocated, it is freed.
+		 */
+		void setExternalBuffer(UINT8* data, SPtr<const void> lifetimeToken);
+
+		/**
+		 * Checks does the object point to a buffer it doesn't own (as set by setExternalBuffer()), rather than an
+		 * internally allocated one.
+		 */
+		bool isExternalBuffer() const { return mData != nullptr && !mOwnsData; }
+
+		/**
+		 * Returns the lifetime token keeping the external buffer alive, if one was provided when the buffer was
+		 * assigned. Null for internally allocated buffers and for external buffers with caller-managed lifetime.
+		 */
+		const SPtr<const void>& getBufferLifetimeToken() const { return mLifetimeToken; }
+
 		/** Checks if the internal buffer is locked due to some other thread using it. */
 		bool isLocked() const { return mLocked; }
 
@@ -84,6 +113,7 @@ namespace bs
 
 	private:
 		UINT8* mData;
+		SPtr<const void> mLifetimeToken;
 		bool mOwnsData;
 		mutable bool mLocked;
 
@@ -30,6 +30,13 @@ namespace bs
 		/**	Marks the resource dependencies list as dirty and schedules it for rebuild. */
 		virtual void markListenerResourcesDirty();
 
+		/**
+		 * Determines the order in which this listener receives notifications when they are deferred and spread over
+		 * multiple frames. Listeners with a higher priority are notified first. Only relevant when a notification
+		 * budget is set on the ResourceListenerManager.
+		 */
+		virtual INT32 getListenerPriority() const { return 0; }
+
 		/**	Called when a resource has been fully loaded. */
 		virtual void notifyResourceLoaded(const HResource& resource) { }
 
@@ -0,0 +1,394 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Resources/BsResourceArchive.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	namespace
+	{
+		constexpr UINT32 ARCHIVE_MAGIC = 0x52415342; // "BSAR"
+		constexpr UINT32 ARCHIVE_VERSION = 1;
+		constexpr UINT32 COPY_BUFFER_SIZE = 65536;
+
+		constexpr UINT32 PROFILE_MAGIC = 0x504C5342; // "BSLP"
+		constexpr UINT32 PROFILE_VERSION = 1;
+
+		/** Stream over a range of a memory mapped archive, keeping the mapping alive for the lifetime of the stream. */
+		class ArchiveRangeDataStream : public MemoryDataStream
+		{
+		public:
+			ArchiveRangeDataStream(UINT8* memory, size_t size, SPtr<DataStream> source)
+				:MemoryDataStream(memory, size, false), mSource(std::move(source))
+			{
+				mAccess = READ;
+			}
+
+		private:
+			SPtr<DataStream> mSource;
+		};
+	}
+
+	bool ResourceArchive::contains(const UUID& uuid) const
+	{
+		return mIndex.find(uuid) != mIndex.end();
+	}
+
+	SPtr<DataStream> ResourceArchive::getResourceStream(const UUID& uuid) const
+	{
+		auto iterFind = mIndex.find(uuid);
+		if (iterFind == mIndex.end())
+			return nullptr;
+
+		const ArchiveEntry& entry = iterFind->second;
+
+		// Reference the memory mapped data directly if available
+		if (mMappedData != nullptr)
+		{
+			return bs_shared_ptr_new<ArchiveRangeDataStream>(mMappedData->getPtr() + entry.offset,
+				(size_t)entry.size, mMappedData);
+		}
+
+		// Otherwise read the relevant range into memory through a temporary file handle
+		SPtr<DataStream> stream = FileSystem::openFile(mPath, true);
+		if (stream == nullptr)
+			return nullptr;
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)entry.size);
+		stream->seek((size_t)entry.offset);
+		stream->read(output->getPtr(), (size_t)entry.size);
+
+		return output;
+	}
+
+	SPtr<ResourceArchive> ResourceArchive::open(const Path& path)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(path, true);
+		if (stream == nullptr)
+			return nullptr;
+
+		UINT32 magic = 0;
+		UINT32 version = 0;
+		UINT32 numEntries = 0;
+
+		stream->read(&magic, sizeof(magic));
+		if (magic != ARCHIVE_MAGIC)
+		{
+			LOGWRN("File \"" + path.toString() + "\" is not a valid resource archive.");
+			return nullptr;
+		}
+
+		stream->read(&version, sizeof(version));
+		if (version != ARCHIVE_VERSION)
+		{
+			LOGWRN("Resource archive \"" + path.toString() + "\" uses an unsupported version: " + toString(version));
+			return nullptr;
+		}
+
+		stream->read(&numEntries, sizeof(numEntries));
+
+		SPtr<ResourceArchive> archive = bs_shared_ptr_new<ResourceArchive>();
+		archive->mPath = path;
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			UUID uuid;
+			ArchiveEntry entry;
+
+			stream->read(&uuid, sizeof(UUID));
+			stream->read(&entry.offset, sizeof(entry.offset));
+			stream->read(&entry.size, sizeof(entry.size));
+			stream->read(&entry.compression, sizeof(entry.compression));
+
+			archive->mIndex[uuid] = entry;
+		}
+
+		stream->close();
+
+		// Map the entire archive so resource streams can reference its memory directly. If mapping fails the archive
+		// falls back to reading ranges through regular file access.
+		archive->mMappedData = std::static_pointer_cast<MemoryDataStream>(FileSystem::mapFile(path));
+
+		return archive;
+	}
+
+	bool ResourceArchive::build(const Path& archivePath, const Vector<std::pair<UUID, Path>>& resources)
+	{
+		// Gather sizes for all resource files so the index can be written up-front
+		Vector<std::pair<UUID, ArchiveEntry>> entries;
+		Vector<Path> filePaths;
+		entries.reserve(resources.size());
+		filePaths.reserve(resources.size());
+
+		for (auto& resource : resources)
+		{
+			if (!FileSystem::isFile(resource.second))
+			{
+				LOGWRN("Skipping missing resource file: \"" + resource.second.toString() + "\"");
+				continue;
+			}
+
+			ArchiveEntry entry;
+			entry.offset = 0;
+			entry.size = FileSystem::getFileSize(resource.second);
+			entry.compression = 0;
+
+			entries.push_back(std::make_pair(resource.first, entry));
+			filePaths.push_back(resource.second);
+		}
+
+		constexpr UINT32 ENTRY_SIZE = sizeof(UUID) + sizeof(UINT64) * 2 + sizeof(UINT32);
+		const UINT32 numEntries = (UINT32)entries.size();
+
+		UINT64 dataOffset = sizeof(UINT32) * 3 + (UINT64)ENTRY_SIZE * numEntries;
+		for (auto& entry : entries)
+		{
+			entry.second.offset = dataOffset;
+			dataOffset += entry.second.size;
+		}
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(archivePath);
+		if (output == nullptr)
+		{
+			LOGWRN("Unable to create resource archive at: \"" + archivePath.toString() + "\"");
+			return false;
+		}
+
+		output->write(&ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+		output->write(&ARCHIVE_VERSION, sizeof(ARCHIVE_VERSION));
+		output->write(&numEntries, sizeof(numEntries));
+
+		for (auto& entry : entries)
+		{
+			output->write(&entry.first, sizeof(UUID));
+			output->write(&entry.second.offset, sizeof(entry.second.offset));
+			output->write(&entry.second.size, sizeof(entry.second.size));
+			output->write(&entry.second.compression, sizeof(entry.second.compression));
+		}
+
+		UINT8* buffer = (UINT8*)bs_alloc(COPY_BUFFER_SIZE);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			SPtr<DataStream> input = FileSystem::openFile(filePaths[i], true);
+			if (input == nullptr)
+			{
+				bs_free(buffer);
+				LOGWRN("Unable to read resource file: \"" + filePaths[i].toString() + "\"");
+				return false;
+			}
+
+			UINT64 remaining = entries[i].second.size;
+			while (remaining > 0)
+			{
+				size_t numBytes = input->read(buffer, (size_t)std::min(remaining, (UINT64)COPY_BUFFER_SIZE));
+				if (numBytes == 0)
+					break;
+
+				output->write(buffer, numBytes);
+				remaining -= numBytes;
+			}
+		}
+
+		bs_free(buffer);
+		output->close();
+
+		return true;
+	}
+
+	bool ResourceArchive::repack(const Path& sourcePath, const Path& archivePath, const Path& profilePath)
+	{
+		if (sourcePath == archivePath)
+		{
+			LOGWRN("Cannot repack a resource archive onto itself: \"" + sourcePath.toString() + "\"");
+			return false;
+		}
+
+		SPtr<ResourceArchive> source = open(sourcePath);
+		if (source == nullptr)
+			return false;
+
+		Vector<std::pair<UUID, float>> profile = readLoadProfile(profilePath);
+		if (profile.empty())
+		{
+			LOGWRN("Load profile \"" + profilePath.toString() + "\" contains no entries, nothing to repack.");
+			return false;
+		}
+
+		// Hot resources go first, in the order the profiled run loaded them
+		Vector<std::pair<UUID, ArchiveEntry>> entries;
+		UnorderedSet<UUID> placed;
+		entries.reserve(source->mIndex.size());
+
+		for (auto& profileEntry : profile)
+		{
+			auto iterFind = source->mIndex.find(profileEntry.first);
+			if (iterFind == source->mIndex.end() || !placed.insert(profileEntry.first).second)
+				continue;
+
+			entries.push_back(std::make_pair(iterFind->first, iterFind->second));
+		}
+
+		// Resources the profiled run never touched follow, keeping their original on-disk order
+		Vector<std::pair<UUID, ArchiveEntry>> coldEntries;
+		for (auto& indexEntry : source->mIndex)
+		{
+			if (placed.find(indexEntry.first) == placed.end())
+				coldEntries.push_back(indexEntry);
+		}
+
+		std::sort(coldEntries.begin(), coldEntries.end(),
+			[](const std::pair<UUID, ArchiveEntry>& lhs, const std::pair<UUID, ArchiveEntry>& rhs)
+		{
+			return lhs.second.offset < rhs.second.offset;
+		});
+
+		entries.insert(entries.end(), coldEntries.begin(), coldEntries.end());
+
+		constexpr UINT32 ENTRY_SIZE = sizeof(UUID) + sizeof(UINT64) * 2 + sizeof(UINT32);
+		const UINT32 numEntries = (UINT32)entries.size();
+
+		Vector<UINT64> sourceOffsets;
+		sourceOffsets.reserve(numEntries);
+
+		UINT64 dataOffset = sizeof(UINT32) * 3 + (UINT64)ENTRY_SIZE * numEntries;
+		for (auto& entry : entries)
+		{
+			sourceOffsets.push_back(entry.second.offset);
+
+			entry.second.offset = dataOffset;
+			dataOffset += entry.second.size;
+		}
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(archivePath);
+		if (output == nullptr)
+		{
+			LOGWRN("Unable to create resource archive at: \"" + archivePath.toString() + "\"");
+			return false;
+		}
+
+		output->write(&ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+		output->write(&ARCHIVE_VERSION, sizeof(ARCHIVE_VERSION));
+		output->write(&numEntries, sizeof(numEntries));
+
+		for (auto& entry : entries)
+		{
+			output->write(&entry.first, sizeof(UUID));
+			output->write(&entry.second.offset, sizeof(entry.second.offset));
+			output->write(&entry.second.size, sizeof(entry.second.size));
+			output->write(&entry.second.compression, sizeof(entry.second.compression));
+		}
+
+		SPtr<DataStream> input;
+		if (source->mMappedData == nullptr)
+		{
+			input = FileSystem::openFile(sourcePath, true);
+			if (input == nullptr)
+			{
+				LOGWRN("Unable to read resource archive: \"" + sourcePath.toString() + "\"");
+				return false;
+			}
+		}
+
+		UINT8* buffer = (UINT8*)bs_alloc(COPY_BUFFER_SIZE);
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			// Copy directly out of the mapping when available, otherwise stream the range through a buffer
+			if (source->mMappedData != nullptr)
+			{
+				output->write(source->mMappedData->getPtr() + sourceOffsets[i], (size_t)entries[i].second.size);
+				continue;
+			}
+
+			input->seek((size_t)sourceOffsets[i]);
+
+			UINT64 remaining = entries[i].second.size;
+			while (remaining > 0)
+			{
+				size_t numBytes = input->read(buffer, (size_t)std::min(remaining, (UINT64)COPY_BUFFER_SIZE));
+				if (numBytes == 0)
+					break;
+
+				output->write(buffer, numBytes);
+				remaining -= numBytes;
+			}
+		}
+
+		bs_free(buffer);
+		output->close();
+
+		return true;
+	}
+
+	bool ResourceArchive::saveLoadProfile(const Path& profilePath, const Vector<std::pair<UUID, float>>& entries)
+	{
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(profilePath);
+		if (output == nullptr)
+		{
+			LOGWRN("Unable to create load profile at: \"" + profilePath.toString() + "\"");
+			return false;
+		}
+
+		const UINT32 numEntries = (UINT32)entries.size();
+
+		output->write(&PROFILE_MAGIC, sizeof(PROFILE_MAGIC));
+		output->write(&PROFILE_VERSION, sizeof(PROFILE_VERSION));
+		output->write(&numEntries, sizeof(numEntries));
+
+		for (auto& entry : entries)
+		{
+			output->write(&entry.first, sizeof(UUID));
+			output->write(&entry.second, sizeof(entry.second));
+		}
+
+		output->close();
+
+		return true;
+	}
+
+	Vector<std::pair<UUID, float>> ResourceArchive::readLoadProfile(const Path& profilePath)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(profilePath, true);
+		if (stream == nullptr)
+			return {};
+
+		UINT32 magic = 0;
+		UINT32 version = 0;
+		UINT32 numEntries = 0;
+
+		stream->read(&magic, sizeof(magic));
+		if (magic != PROFILE_MAGIC)
+		{
+			LOGWRN("File \"" + profilePath.toString() + "\" is not a valid load profile.");
+			return {};
+		}
+
+		stream->read(&version, sizeof(version));
+		if (version != PROFILE_VERSION)
+		{
+			LOGWRN("Load profile \"" + profilePath.toString() + "\" uses an unsupported version: " + toString(version));
+			return {};
+		}
+
+		stream->read(&numEntries, sizeof(numEntries));
+
+		Vector<std::pair<UUID, float>> entries;
+		entries.reserve(numEntries);
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			UUID uuid;
+			float timeMs = 0.0f;
+
+			stream->read(&uuid, sizeof(UUID));
+			stream->read(&timeMs, sizeof(timeMs));
+
+			entries.push_back(std::make_pair(uuid, timeMs));
+		}
+
+		stream->close();
+
+		return entries;
+	}
+}
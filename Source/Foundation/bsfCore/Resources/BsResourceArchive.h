@@ -0,0 +1,103 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsUUID.h"
+
+namespace bs
+{
+	/** @addtogroup Resources
+	 *  @{
+	 */
+
+	/**
+	 * A collection of serialized resources packed into a single file, indexed by UUID. Packing resources into an archive
+	 * avoids the per-file open/read/close overhead when loading many small resources, which tends to dominate cold level
+	 * load times. Register an opened archive with Resources::registerArchive() and resource loads will transparently
+	 * read from the archive instead of the stand-alone files.
+	 *
+	 * The archive starts with an index mapping each resource UUID to the offset and size of its data within the archive.
+	 * The data of each resource is byte-identical to the contents of its stand-alone file, so the regular
+	 * deserialization path runs unchanged on a range of the archive. The archive is memory mapped when possible, in
+	 * which case reads reference the mapping directly without extra copies or file handles.
+	 *
+	 * The order in which resources are laid out within the archive matters on seek-bound media - use repack() together
+	 * with a load profile recorded by Resources::startLoadProfiling() to lay resources out in the order they are
+	 * actually loaded.
+	 *
+	 * @note	Thread safe, except for build() and repack().
+	 */
+	class BS_CORE_EXPORT ResourceArchive
+	{
+		/** Describes where within the archive the data of a single resource is located. */
+		struct ArchiveEntry
+		{
+			UINT64 offset;
+			UINT64 size;
+			UINT32 compression; // Reserved, always 0. Resources handle compression internally.
+		};
+
+	public:
+		ResourceArchive() = default; // Note: Use open() or build() instead of constructing the archive directly
+
+		/** Checks does the archive contain data for the resource with the specified UUID. */
+		bool contains(const UUID& uuid) const;
+
+		/**
+		 * Returns a stream over the serialized data of the resource with the specified UUID, in the same format as a
+		 * file produced by Resources::save(). Returns null if the archive doesn't contain the resource.
+		 */
+		SPtr<DataStream> getResourceStream(const UUID& uuid) const;
+
+		/**
+		 * Opens an existing archive file and reads its index. Resource data itself isn't read until requested through
+		 * getResourceStream(). Returns null if the file can't be opened or isn't a valid archive.
+		 */
+		static SPtr<ResourceArchive> open(const Path& path);
+
+		/**
+		 * Builds a new archive file from a set of stand-alone resource files.
+		 *
+		 * @param[in]	archivePath		Path to the archive file to create. Any existing file is overwritten.
+		 * @param[in]	resources		Resources to pack, each pairing a resource UUID with the path to its file (as
+		 *								registered in a ResourceManifest). Missing files are skipped with a warning.
+		 * @return						True if the archive file was successfully written.
+		 */
+		static bool build(const Path& archivePath, const Vector<std::pair<UUID, Path>>& resources);
+
+		/**
+		 * Rewrites an existing archive so resources are laid out in the order they were loaded during an instrumented
+		 * run. Resources present in the load profile are placed contiguously at the front of the archive in load order,
+		 * turning a cold level load into a single long sequential read instead of seeks all over the file. Resources
+		 * the profiled run never loaded are placed after them, in their original order.
+		 *
+		 * @param[in]	sourcePath	Path to the archive to repack.
+		 * @param[in]	archivePath	Path to the repacked archive to create. Must differ from @p sourcePath. Any
+		 *							existing file is overwritten.
+		 * @param[in]	profilePath	Path to a load profile written by Resources::stopLoadProfiling().
+		 * @return					True if the repacked archive was successfully written.
+		 */
+		static bool repack(const Path& sourcePath, const Path& archivePath, const Path& profilePath);
+
+		/**
+		 * Writes a resource load profile to a file. Each entry pairs a resource UUID with the time in milliseconds at
+		 * which its data was first read, listed in load order. Normally written through Resources::stopLoadProfiling()
+		 * rather than called directly.
+		 */
+		static bool saveLoadProfile(const Path& profilePath, const Vector<std::pair<UUID, float>>& entries);
+
+		/**
+		 * Reads a load profile previously written by saveLoadProfile(). Returns an empty vector if the file can't be
+		 * opened or isn't a valid profile.
+		 */
+		static Vector<std::pair<UUID, float>> readLoadProfile(const Path& profilePath);
+
+	private:
+		Path mPath;
+		UnorderedMap<UUID, ArchiveEntry> mIndex;
+		SPtr<MemoryDataStream> mMappedData; // Null if the file couldn't be memory mapped
+	};
+
+	/** @} */
+}
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Resources/BsResources.h"
 #include "Resources/BsResource.h"
+#include "Resources/BsResourceArchive.h"
 #include "Resources/BsResourceManifest.h"
 #include "Error/BsException.h"
 #include "Serialization/BsFileSerializer.h"
@@ -16,6 +17,7 @@
 #include "Utility/BsCompression.h"
 #include "FileSystem/BsDataStream.h"
 #include "Serialization/BsBinarySerializer.h"
+#include "Reflection/BsRTTIType.h"
 
 namespace bs
 {
@@ -90,6 +92,39 @@ namespace bs
 		return loadInternal(uuid, filePath, !async, loadFlags);
 	}
 
+	bool Resources::cancelAsyncLoad(const HResource& resource)
+	{
+		if (resource == nullptr)
+			return false;
+
+		const UUID& uuid = resource.getUUID();
+		{
+			Lock lock(mInProgressResourcesMutex);
+
+			auto iterFind = mInProgressResources.find(uuid);
+			if (iterFind == mInProgressResources.end())
+				return false;
+
+			ResourceLoadData* myLoadData = iterFind->second;
+			if (myLoadData->loadTask == nullptr || myLoadData->canceled)
+				return false;
+
+			// Remove the active load stage from the task queue if it hasn't started executing. If it has, the flag
+			// makes the relevant callback discard its results instead of completing the load.
+			myLoadData->loadTask->cancel();
+			myLoadData->canceled = true;
+
+			myLoadData->loadedData = nullptr;
+			myLoadData->remainingDependencies--; // Self
+		}
+
+		// Complete the load as failed so any loads dependant on this resource don't wait forever
+		HResource handle = resource;
+		loadComplete(handle);
+
+		return true;
+	}
+
 	HResource Resources::loadInternal(const UUID& uuid, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags)
 	{
 		HResource outputResource;
@@ -128,6 +163,7 @@ namespace bs
 			if (iterFind != mLoadedResources.end())
 			{
 				LoadedResourceData& resData = iterFind->second;
+				resData.lastUsed = mAccessCounter++;
 				outputResource = resData.resource.lock();
 
 				// Increase ref. count
@@ -153,27 +189,42 @@ namespace bs
 				}
 			}
 
+			// Check if a registered archive can provide the resource data, in which case the stand-alone file isn't
+			// required
+			SPtr<DataStream> archiveStream = getArchivedResourceData(uuid);
+
 			// If we have nowhere to load from, warn and complete load if a file path was provided, otherwise pass through
-			// as we might just want to complete a previously queued load 
-			if (filePath.isEmpty())
+			// as we might just want to complete a previously queued load
+			if (archiveStream == nullptr)
 			{
-				if (!alreadyLoading)
+				if (filePath.isEmpty())
+				{
+					if (!alreadyLoading)
+					{
+						LOGWRN_VERBOSE("Cannot load resource. Resource with UUID '" + UUID + "' doesn't exist.");
+						loadFailed = true;
+					}
+				}
+				else if (!FileSystem::isFile(filePath))
 				{
-					LOGWRN_VERBOSE("Cannot load resource. Resource with UUID '" + UUID + "' doesn't exist.");
+					LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 					loadFailed = true;
 				}
 			}
-			else if (!FileSystem::isFile(filePath))
-			{
-				LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
-				loadFailed = true;
-			}
 
 			if(!loadFailed)
 			{
-				// Load dependency data if a file path is provided
+				// Load dependency data if a data source is available
 				SPtr<SavedResourceData> savedResourceData;
-				if (!filePath.isEmpty())
+				if (archiveStream != nullptr)
+				{
+					UINT32 objectSize = 0;
+					archiveStream->read(&objectSize, sizeof(objectSize));
+
+					BinarySerializer bs;
+					savedResourceData = std::static_pointer_cast<SavedResourceData>(bs.decode(archiveStream, objectSize));
+				}
+				else if (!filePath.isEmpty())
 				{
 					FileDecoder fs(filePath);
 					savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
@@ -198,10 +249,15 @@ namespace bs
 					// Make resource listener trigger before exit if loading synchronously
 					loadData->notifyImmediately = synchronous; 
 
-					// Register dependencies and count them so we know when the resource is fully loaded
+					// Register dependencies and count them so we know when the resource is fully loaded. The precomputed
+					// transitive list is preferred so the entire dependency tree gets queued for loading upfront,
+					// rather than being discovered one file decode at a time.
 					if (loadFlags.isSet(ResourceLoadFlag::LoadDependencies) && savedResourceData != nullptr)
 					{
-						for (auto& dependency : savedResourceData->getDependencies())
+						const Vector<UUID>& dependencies = !savedResourceData->getTransitiveDependencies().empty()
+							? savedResourceData->getTransitiveDependencies() : savedResourceData->getDependencies();
+
+						for (auto& dependency : dependencies)
 						{
 							if (dependency != uuid)
 							{
@@ -215,7 +271,8 @@ namespace bs
 				// The resource is already being loaded, or is loaded, but we might still need to load some dependencies
 				else if(savedResourceData != nullptr)
 				{
-					const Vector<UUID>& dependencies = savedResourceData->getDependencies();
+					const Vector<UUID>& dependencies = !savedResourceData->getTransitiveDependencies().empty()
+						? savedResourceData->getTransitiveDependencies() : savedResourceData->getDependencies();
 					if (!dependencies.empty())
 					{
 						ResourceLoadData* loadData = nullptr;
@@ -273,7 +330,7 @@ namespace bs
 					}
 				}
 
-				initiateLoad = !alreadyLoading && !filePath.isEmpty();
+				initiateLoad = !alreadyLoading && (archiveStream != nullptr || !filePath.isEmpty());
 
 				if(savedResourceData != nullptr)
 					synchronous = synchronous & savedResourceData->allowAsyncLoading();
@@ -300,14 +357,28 @@ namespace bs
 			{
 				loadCallback(filePath, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
 			}
-			else // Asynchronous, read the file on a worker thread
+			else // Asynchronous, read the file on a worker thread, then decode it on a separate one
 			{
 				String fileName = filePath.getFilename();
-				String taskName = "Resource load: " + fileName;
+				String taskName = "Resource read: " + fileName;
+
+				TaskPriority priority = TaskPriority::Normal;
+				if (loadFlags.isSet(ResourceLoadFlag::HighPriority))
+					priority = TaskPriority::High;
+				else if (loadFlags.isSet(ResourceLoadFlag::LowPriority))
+					priority = TaskPriority::Low;
+
+				SPtr<Task> task = Task::create(taskName,
+					std::bind(&Resources::readCallback, this, filePath, outputResource, loadFlags), priority);
+
+				{
+					Lock lock(mInProgressResourcesMutex);
+
+					auto iterFind = mInProgressResources.find(uuid);
+					if (iterFind != mInProgressResources.end())
+						iterFind->second->loadTask = task;
+				}
 
-				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
-				SPtr<Task> task = Task::create(taskName, 
-					std::bind(&Resources::loadCallback, this, filePath, outputResource, keepSourceData));
 				TaskScheduler::instance().addTask(task);
 			}
 		}
@@ -345,8 +416,27 @@ namespace bs
 		return outputResource;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData)
+	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, const UUID& uuid, bool loadWithSaveData)
 	{
+		SPtr<DataStream> stream = readFromDisk(filePath, uuid);
+		if (stream == nullptr)
+			return nullptr;
+
+		return deserialize(stream, loadWithSaveData);
+	}
+
+	SPtr<DataStream> Resources::readFromDisk(const Path& filePath, const UUID& uuid)
+	{
+		recordProfiledLoad(uuid);
+
+		// Registered archives take priority over stand-alone files
+		SPtr<DataStream> archiveStream = getArchivedResourceData(uuid);
+		if (archiveStream != nullptr)
+			return archiveStream;
+
+		if (filePath.isEmpty())
+			return nullptr;
+
 		Lock fileLock = FileScheduler::getLock(filePath);
 
 		SPtr<DataStream> stream = FileSystem::openFile(filePath, true);
@@ -359,6 +449,14 @@ namespace bs
 				"File size is larger that UINT32 can hold. Ask a programmer to use a bigger data type.");
 		}
 
+		// Pull the entire file into memory so parsing it later doesn't need to touch the disk
+		return bs_shared_ptr_new<MemoryDataStream>(stream);
+	}
+
+	SPtr<Resource> Resources::deserialize(const SPtr<DataStream>& fileData, bool loadWithSaveData)
+	{
+		SPtr<DataStream> stream = fileData;
+
 		UnorderedMap<String, UINT64> params;
 		if(loadWithSaveData)
 			params["keepSourceData"] = 1;
@@ -394,7 +492,7 @@ namespace bs
 
 		if (loadedData == nullptr)
 		{
-			LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
+			LOGERR("Unable to deserialize resource data.");
 		}
 		else
 		{
@@ -403,6 +501,11 @@ namespace bs
 		}
 
 		SPtr<Resource> resource = std::static_pointer_cast<Resource>(loadedData);
+
+		// Record the serialized size as an estimate of the resource's memory use, for budget tracking
+		if (resource != nullptr)
+			resource->mSize = (UINT32)fileData->size();
+
 		return resource;
 	}
 
@@ -476,6 +579,101 @@ namespace bs
 		}
 	}
 
+	void Resources::setMemoryBudget(UINT32 resourceTypeId, UINT64 bytes)
+	{
+		Lock lock(mLoadedResourceMutex);
+
+		if (bytes > 0)
+			mMemoryBudgets[resourceTypeId] = bytes;
+		else
+			mMemoryBudgets.erase(resourceTypeId);
+	}
+
+	UINT64 Resources::getMemoryUsage(UINT32 resourceTypeId)
+	{
+		Lock lock(mLoadedResourceMutex);
+
+		auto iterFind = mMemoryUsage.find(resourceTypeId);
+		if (iterFind != mMemoryUsage.end())
+			return iterFind->second;
+
+		return 0;
+	}
+
+	void Resources::unloadUnused(UINT32 maxUnloads)
+	{
+		struct UnloadCandidate
+		{
+			HResource resource;
+			UINT64 lastUsed;
+			UINT32 size;
+			UINT32 typeId;
+		};
+
+		Vector<UnloadCandidate> candidates;
+		UnorderedMap<UINT32, UINT64> overBudget;
+
+		{
+			Lock lock(mLoadedResourceMutex);
+
+			// Determine by how much each budgeted resource type exceeds its budget
+			for (auto& budget : mMemoryBudgets)
+			{
+				auto iterUsage = mMemoryUsage.find(budget.first);
+				if (iterUsage == mMemoryUsage.end())
+					continue;
+
+				if (iterUsage->second > budget.second)
+					overBudget[budget.first] = iterUsage->second - budget.second;
+			}
+
+			if (overBudget.empty())
+				return;
+
+			for (auto iter = mLoadedResources.begin(); iter != mLoadedResources.end(); ++iter)
+			{
+				const LoadedResourceData& resData = iter->second;
+				if (overBudget.find(resData.typeId) == overBudget.end())
+					continue;
+
+				std::uint32_t refCount = resData.resource.mData->mRefCount.load(std::memory_order_relaxed);
+				assert(refCount > 0); // No references but kept in mLoadedResources list?
+
+				if (refCount == resData.numInternalRefs) // Only internal references exist, free it
+					candidates.push_back({ resData.resource.lock(), resData.lastUsed, resData.size, resData.typeId });
+			}
+		}
+
+		// Evict least recently used resources first
+		std::sort(candidates.begin(), candidates.end(),
+			[](const UnloadCandidate& a, const UnloadCandidate& b) { return a.lastUsed < b.lastUsed; });
+
+		UINT32 numUnloaded = 0;
+		for (auto& candidate : candidates)
+		{
+			if (numUnloaded >= maxUnloads)
+				break;
+
+			UINT64& remaining = overBudget[candidate.typeId];
+			if (remaining == 0) // Type already back under budget
+				continue;
+
+			release(candidate.resource);
+
+			remaining -= std::min((UINT64)candidate.size, remaining);
+			numUnloaded++;
+		}
+	}
+
+	void Resources::_notifyResourceUsed(const UUID& uuid)
+	{
+		Lock lock(mLoadedResourceMutex);
+
+		auto iterFind = mLoadedResources.find(uuid);
+		if (iterFind != mLoadedResources.end())
+			iterFind->second.lastUsed = mAccessCounter++;
+	}
+
 	void Resources::unloadAll()
 	{
 		// Unload and invalidate all resources
@@ -534,6 +732,9 @@ namespace bs
 					resData.resource.removeInternalRef();
 				}
 
+				UINT64& usage = mMemoryUsage[resData.typeId];
+				usage -= std::min((UINT64)resData.size, usage);
+
 				mLoadedResources.erase(iterFind);
 			}
 			else
@@ -587,9 +788,12 @@ namespace bs
 			dependencyUUIDs[i] = dependencyList[i].resource.getUUID();
 
 		UINT32 compressionMethod = (compress && resource->isCompressible()) ? 1 : 0;
-		SPtr<SavedResourceData> resourceData = bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs, 
+		SPtr<SavedResourceData> resourceData = bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs,
 			resource->allowAsyncLoading(), compressionMethod);
 
+		// Record the full transitive dependency list so a load can queue the entire dependency tree upfront
+		resourceData->setTransitiveDependencies(resolveTransitiveDependencies(resource.getUUID(), dependencyUUIDs));
+
 		Path parentDir = filePath.getDirectory();
 		if (!FileSystem::exists(parentDir))
 			FileSystem::createDir(parentDir);
@@ -707,6 +911,52 @@ namespace bs
 		return savedResourceData->getDependencies();
 	}
 
+	Vector<UUID> Resources::resolveTransitiveDependencies(const UUID& uuid, const Vector<UUID>& directDependencies) const
+	{
+		Vector<UUID> output;
+		UnorderedSet<UUID> visited;
+		visited.insert(uuid);
+
+		Vector<UUID> toExpand = directDependencies;
+		while (!toExpand.empty())
+		{
+			UUID current = toExpand.back();
+			toExpand.pop_back();
+
+			if (!visited.insert(current).second)
+				continue;
+
+			output.push_back(current);
+
+			Path filePath;
+			if (!getFilePathFromUUID(current, filePath) || !FileSystem::isFile(filePath))
+				continue;
+
+			FileDecoder fs(filePath);
+			auto savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			if (savedResourceData == nullptr)
+				continue;
+
+			// Files that already carry a transitive list don't need their dependencies followed individually
+			const Vector<UUID>& transitive = savedResourceData->getTransitiveDependencies();
+			if (!transitive.empty())
+			{
+				for (auto& dependency : transitive)
+				{
+					if (dependency != uuid && visited.insert(dependency).second)
+						output.push_back(dependency);
+				}
+			}
+			else
+			{
+				for (auto& dependency : savedResourceData->getDependencies())
+					toExpand.push_back(dependency);
+			}
+		}
+
+		return output;
+	}
+
 	void Resources::registerResourceManifest(const SPtr<ResourceManifest>& manifest)
 	{
 		auto findIter = std::find(mResourceManifests.begin(), mResourceManifests.end(), manifest);
@@ -726,6 +976,90 @@ namespace bs
 			mResourceManifests.erase(findIter);
 	}
 
+	void Resources::registerArchive(const SPtr<ResourceArchive>& archive)
+	{
+		if (archive == nullptr)
+			return;
+
+		Lock lock(mResourceArchivesMutex);
+
+		auto findIter = std::find(mResourceArchives.begin(), mResourceArchives.end(), archive);
+		if (findIter == mResourceArchives.end())
+			mResourceArchives.push_back(archive);
+	}
+
+	void Resources::unregisterArchive(const SPtr<ResourceArchive>& archive)
+	{
+		Lock lock(mResourceArchivesMutex);
+
+		auto findIter = std::find(mResourceArchives.begin(), mResourceArchives.end(), archive);
+		if (findIter != mResourceArchives.end())
+			mResourceArchives.erase(findIter);
+	}
+
+	void Resources::startLoadProfiling()
+	{
+		Lock lock(mLoadProfileMutex);
+
+		mLoadProfileEntries.clear();
+		mLoadProfiledUUIDs.clear();
+		mLoadProfileTimer.reset();
+		mLoadProfilingEnabled = true;
+	}
+
+	bool Resources::stopLoadProfiling(const Path& profilePath)
+	{
+		Vector<std::pair<UUID, float>> entries;
+
+		{
+			Lock lock(mLoadProfileMutex);
+
+			mLoadProfilingEnabled = false;
+			entries = std::move(mLoadProfileEntries);
+
+			mLoadProfileEntries.clear();
+			mLoadProfiledUUIDs.clear();
+		}
+
+		if (entries.empty())
+		{
+			LOGWRN("No resource loads were recorded, not writing a load profile.");
+			return false;
+		}
+
+		return ResourceArchive::saveLoadProfile(profilePath, entries);
+	}
+
+	void Resources::recordProfiledLoad(const UUID& uuid)
+	{
+		// Unsynchronized early-out, loads that race with enabling/disabling the recording may be missed
+		if (!mLoadProfilingEnabled)
+			return;
+
+		Lock lock(mLoadProfileMutex);
+
+		if (!mLoadProfilingEnabled)
+			return;
+
+		// Only the first read of each resource is relevant for layout purposes
+		if (mLoadProfiledUUIDs.insert(uuid).second)
+			mLoadProfileEntries.push_back(std::make_pair(uuid, mLoadProfileTimer.getMicroseconds() / 1000.0f));
+	}
+
+	SPtr<DataStream> Resources::getArchivedResourceData(const UUID& uuid)
+	{
+		Lock lock(mResourceArchivesMutex);
+
+		for (auto iter = mResourceArchives.rbegin(); iter != mResourceArchives.rend(); ++iter)
+		{
+			SPtr<DataStream> stream = (*iter)->getResourceStream(uuid);
+			if (stream != nullptr)
+				return stream;
+		}
+
+		return nullptr;
+	}
+
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -776,6 +1110,16 @@ namespace bs
 
 			LoadedResourceData& resData = mLoadedResources[UUID];
 			resData.resource = newHandle.getWeak();
+
+			if (obj != nullptr)
+			{
+				resData.typeId = obj->getRTTI()->getRTTIId();
+				resData.size = obj->mSize;
+				resData.lastUsed = mAccessCounter++;
+
+				mMemoryUsage[resData.typeId] += resData.size;
+			}
+
 			mHandles[UUID] = newHandle.getWeak();
 		}
 
@@ -859,6 +1203,12 @@ namespace bs
 				{
 					Lock loadedLock(mLoadedResourceMutex);
 
+					myLoadData->resData.typeId = myLoadData->loadedData->getRTTI()->getRTTIId();
+					myLoadData->resData.size = myLoadData->loadedData->mSize;
+					myLoadData->resData.lastUsed = mAccessCounter++;
+
+					mMemoryUsage[myLoadData->resData.typeId] += myLoadData->resData.size;
+
 					mLoadedResources[uuid] = myLoadData->resData;
 					resource.setHandleData(myLoadData->loadedData, uuid);
 				}
@@ -888,7 +1238,7 @@ namespace bs
 
 	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
+		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, resource.getUUID(), loadWithSaveData);
 
 		{
 			Lock lock(mInProgressResourcesMutex);
@@ -902,6 +1252,65 @@ namespace bs
 		loadComplete(resource);
 	}
 
+	void Resources::readCallback(const Path& filePath, HResource& resource, ResourceLoadFlags loadFlags)
+	{
+		// Load might have been canceled while the task was queued
+		{
+			Lock lock(mInProgressResourcesMutex);
+
+			auto iterFind = mInProgressResources.find(resource.getUUID());
+			if (iterFind == mInProgressResources.end() || iterFind->second->canceled)
+				return;
+		}
+
+		SPtr<DataStream> stream = readFromDisk(filePath, resource.getUUID());
+
+		TaskPriority priority = TaskPriority::Normal;
+		if (loadFlags.isSet(ResourceLoadFlag::HighPriority))
+			priority = TaskPriority::High;
+		else if (loadFlags.isSet(ResourceLoadFlag::LowPriority))
+			priority = TaskPriority::Low;
+
+		bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
+		String taskName = "Resource decode: " + filePath.getFilename();
+		SPtr<Task> task = Task::create(taskName,
+			std::bind(&Resources::decodeCallback, this, stream, resource, keepSourceData), priority);
+
+		{
+			Lock lock(mInProgressResourcesMutex);
+
+			auto iterFind = mInProgressResources.find(resource.getUUID());
+			if (iterFind == mInProgressResources.end() || iterFind->second->canceled)
+				return; // Canceled during the read, discard the data
+
+			iterFind->second->loadTask = task;
+		}
+
+		TaskScheduler::instance().addTask(task);
+	}
+
+	void Resources::decodeCallback(const SPtr<DataStream>& stream, HResource& resource, bool loadWithSaveData)
+	{
+		SPtr<Resource> rawResource;
+		if (stream != nullptr)
+			rawResource = deserialize(stream, loadWithSaveData);
+
+		{
+			Lock lock(mInProgressResourcesMutex);
+
+			auto iterFind = mInProgressResources.find(resource.getUUID());
+			if (iterFind == mInProgressResources.end() || iterFind->second->canceled)
+				return; // Canceled during the decode, discard the data
+
+			// Check if all my dependencies are loaded
+			ResourceLoadData* myLoadData = iterFind->second;
+			myLoadData->loadedData = rawResource;
+			myLoadData->remainingDependencies--;
+		}
+
+		loadComplete(resource);
+	}
+
 	BS_CORE_EXPORT Resources& gResources()
 	{
 		return Resources::instance();
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
+#include "Utility/BsTimer.h"
 
 namespace bs
 {
@@ -32,6 +33,18 @@ namespace bs
 		 * use up extra memory. Normally you want to keep this enabled if you plan on saving the resource to disk.
 		 */
 		KeepSourceData = 1 << 2,
+		/**
+		 * If enabled an asynchronous load of the resource will be processed before other queued loads. Use for resources
+		 * the caller is about to block on, or that are about to become visible, so background streaming doesn't starve
+		 * them. Has no effect on synchronous loads.
+		 */
+		HighPriority = 1 << 3,
+		/**
+		 * If enabled an asynchronous load of the resource will be processed only when no normal or high priority loads
+		 * are queued. Use for speculative streaming of resources that might be needed later. Has no effect on
+		 * synchronous loads.
+		 */
+		LowPriority = 1 << 4,
 		/** Default set of flags used for resource loading. */
 		Default = LoadDependencies | KeepInternalRef
 	};
@@ -39,6 +52,8 @@ namespace bs
 	typedef Flags<ResourceLoadFlag> ResourceLoadFlags;
 	BS_FLAGS_OPERATORS(ResourceLoadFlag);
 
+	class ResourceArchive;
+
 	/**
 	 * Manager for dealing with all engine resources. It allows you to save new resources and load existing ones.
 	 *
@@ -59,6 +74,9 @@ namespace bs
 
 			WeakResourceHandle<Resource> resource;
 			UINT32 numInternalRefs;
+			UINT32 typeId = 0; // RTTI type id of the resource, used for grouping memory budgets
+			UINT32 size = 0; // Approximate size of the resource, in bytes
+			UINT64 lastUsed = 0; // Tick of the most recent access, for least-recently-used eviction
 		};
 
 		/** Information about a resource that's currently being loaded. */
@@ -73,6 +91,8 @@ namespace bs
 			UINT32 remainingDependencies;
 			Vector<HResource> dependencies;
 			bool notifyImmediately;
+			SPtr<Task> loadTask; // Task for the currently active load stage (file read or decode), if any
+			bool canceled = false;
 		};
 
 	public:
@@ -143,6 +163,17 @@ namespace bs
 		 */
 		HResource loadFromUUID(const UUID& uuid, bool async = false, ResourceLoadFlags loadFlags = ResourceLoadFlag::Default);
 
+		/**
+		 * Attempts to cancel an in-progress asynchronous load of the resource. This is a best-effort operation - data
+		 * that was already read or decoded is discarded, but a load stage that already started executing cannot be
+		 * interrupted. Dependencies queued by the load are not canceled.
+		 *
+		 * @param[in]	resource	Handle of the resource whose load to cancel.
+		 * @return					True if the load was canceled. The handle will then never become loaded, so make sure
+		 *							no caller is blocking on it. False if the resource is not being asynchronously loaded.
+		 */
+		bool cancelAsyncLoad(const HResource& resource);
+
 		/**
 		 * Releases an internal reference to the resource held by the resources system. This allows the resource to be 
 		 * unloaded when it goes out of scope, if the resource was loaded with @p keepInternalReference parameter.
@@ -165,6 +196,32 @@ namespace bs
 		/** Forces unload of all resources, whether they are being used or not. */
 		void unloadAll();
 
+		/**
+		 * Sets a memory budget for resources of the specified type. When the combined size of loaded resources of the
+		 * type exceeds the budget, resources of the type that are not referenced outside of the resources system become
+		 * eligible for eviction through unloadUnused(). Provide zero to remove the budget. Resources of types without a
+		 * budget are never evicted by unloadUnused().
+		 *
+		 * @param[in]	resourceTypeId	RTTI type id of the resource type (e.g. TID_Texture).
+		 * @param[in]	bytes			Maximum combined size of loaded resources of the type, in bytes.
+		 */
+		void setMemoryBudget(UINT32 resourceTypeId, UINT64 bytes);
+
+		/**
+		 * Returns the combined size of all loaded resources of the specified type, in bytes. Sizes are based on each
+		 * resource's serialized size, so this is only an estimate of the actual memory used.
+		 */
+		UINT64 getMemoryUsage(UINT32 resourceTypeId);
+
+		/**
+		 * Unloads up to @p maxUnloads unused resources belonging to types whose memory budget is exceeded, least
+		 * recently used first. Unlike unloadAllUnused() the cost of this method is bounded, so it can be called
+		 * regularly (e.g. once per frame) to incrementally trim the resource cache without frame time spikes.
+		 *
+		 * @see		setMemoryBudget(), unloadAllUnused()
+		 */
+		void unloadUnused(UINT32 maxUnloads = 4);
+
 		/**
 		 * Saves the resource at the specified location.
 		 *
@@ -240,6 +297,35 @@ namespace bs
 		/**	Unregisters a resource manifest previously registered with registerResourceManifest(). */
 		void unregisterResourceManifest(const SPtr<ResourceManifest>& manifest);
 
+		/**
+		 * Registers a resource archive. Resource loads will check registered archives for the resource's serialized
+		 * data before falling back to reading its stand-alone file, avoiding per-file open/read/close overhead.
+		 * Archives registered later take priority.
+		 *
+		 * @see		ResourceArchive
+		 */
+		void registerArchive(const SPtr<ResourceArchive>& archive);
+
+		/**	Unregisters a resource archive previously registered with registerArchive(). */
+		void unregisterArchive(const SPtr<ResourceArchive>& archive);
+
+		/**
+		 * Begins recording the order and time at which the data of each resource is first read, whether from a
+		 * stand-alone file or a registered archive. Run an instrumented session (typically a cold level load) with
+		 * recording enabled, write the recorded profile using stopLoadProfiling() and feed it to
+		 * ResourceArchive::repack() to lay archived resources out in the order they are loaded. Discards any previously
+		 * recorded data.
+		 */
+		void startLoadProfiling();
+
+		/**
+		 * Stops recording started with startLoadProfiling() and writes the recorded load profile to the provided file.
+		 *
+		 * @param[in]	profilePath		Path to the load profile file to create. Any existing file is overwritten.
+		 * @return						False if nothing was recorded or the file couldn't be written.
+		 */
+		bool stopLoadProfiling(const Path& profilePath);
+
 		/**
 		 * Allows you to retrieve resource manifest containing UUID <-> file path mapping that is used when resolving 
 		 * resource references.
@@ -302,6 +388,12 @@ namespace bs
 		/** Returns an existing handle for the specified UUID if one exists, or creates a new one. */
 		HResource _getResourceHandle(const UUID& uuid);
 
+		/**
+		 * Notifies the system that the resource was used, making it less likely to be evicted by unloadUnused().
+		 * Loading a resource that is already loaded counts as an use automatically.
+		 */
+		void _notifyResourceUsed(const UUID& uuid);
+
 		/** @} */
 	private:
 		friend class ResourceHandleBase;
@@ -314,7 +406,30 @@ namespace bs
 		HResource loadInternal(const UUID& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
 
 		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData);
+		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, const UUID& uuid, bool loadWithSaveData);
+
+		/**
+		 * Reads the entire serialized data of a resource into a memory stream, without parsing it. Data is retrieved
+		 * from a registered archive if available, otherwise from the resource file. Returns null if the read fails.
+		 */
+		SPtr<DataStream> readFromDisk(const Path& filePath, const UUID& uuid);
+
+		/** Returns a stream over the resource's serialized data from a registered archive, or null if not archived. */
+		SPtr<DataStream> getArchivedResourceData(const UUID& uuid);
+
+		/** Records the first data read of a resource while load profiling is active. See startLoadProfiling(). */
+		void recordProfiledLoad(const UUID& uuid);
+
+		/**
+		 * Expands a list of direct dependency UUIDs into the full transitive dependency list by following the saved
+		 * meta-data of each dependency, located through the registered manifests. Dependencies whose files cannot be
+		 * found are included in the output but not followed. @p uuid identifies the resource owning the dependencies,
+		 * and is excluded from the output.
+		 */
+		Vector<UUID> resolveTransitiveDependencies(const UUID& uuid, const Vector<UUID>& directDependencies) const;
+
+		/** Deserializes a resource from raw file contents provided by readFromDisk(). Returns null if parsing fails. */
+		SPtr<Resource> deserialize(const SPtr<DataStream>& stream, bool loadWithSaveData);
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
@@ -322,6 +437,15 @@ namespace bs
 		/**	Callback triggered when the task manager is ready to process the loading task. */
 		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
 
+		/**
+		 * Callback triggered on a worker thread to read the raw contents of a resource file. Queues a separate decode
+		 * task with the provided data when done, so an expensive decode doesn't delay other queued reads.
+		 */
+		void readCallback(const Path& filePath, HResource& resource, ResourceLoadFlags loadFlags);
+
+		/**	Callback triggered on a worker thread to decode previously read resource data. */
+		void decodeCallback(const SPtr<DataStream>& stream, HResource& resource, bool loadWithSaveData);
+
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
 
@@ -329,12 +453,29 @@ namespace bs
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
 
+		Mutex mResourceArchivesMutex;
+		Vector<SPtr<ResourceArchive>> mResourceArchives;
+
+		// Load order recording used for profile-guided archive layout. All guarded by mLoadProfileMutex.
+		Mutex mLoadProfileMutex;
+		bool mLoadProfilingEnabled = false;
+		Timer mLoadProfileTimer;
+		Vector<std::pair<UUID, float>> mLoadProfileEntries;
+		UnorderedSet<UUID> mLoadProfiledUUIDs;
+
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
 		RecursiveMutex mDestroyMutex;
 
 		UnorderedMap<UUID, WeakResourceHandle<Resource>> mHandles;
 		UnorderedMap<UUID, LoadedResourceData> mLoadedResources;
+
+		// Memory budget and usage per resource RTTI type id, and the access tick counter used for least-recently-used
+		// tracking. All guarded by mLoadedResourceMutex.
+		UnorderedMap<UINT32, UINT64> mMemoryBudgets;
+		UnorderedMap<UINT32, UINT64> mMemoryUsage;
+		UINT64 mAccessCounter = 0;
+
 		UnorderedMap<UUID, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
 		UnorderedMap<UUID, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
 	};
@@ -22,9 +22,19 @@ namespace bs
 		SavedResourceData();
 		SavedResourceData(const Vector<UUID>& dependencies, bool allowAsync, UINT32 compressionMethod);
 
-		/**	Returns a list of all resource dependencies. */
+		/**	Returns a list of all direct resource dependencies. */
 		const Vector<UUID>& getDependencies() const { return mDependencies; }
 
+		/**
+		 * Returns the full transitive dependency list (dependencies, their dependencies, and so on), precomputed when the
+		 * resource was saved. Empty if the resource has no dependencies, or if it was saved before the list was recorded,
+		 * in which case the loader falls back to discovering dependencies recursively.
+		 */
+		const Vector<UUID>& getTransitiveDependencies() const { return mTransitiveDependencies; }
+
+		/** Sets the full transitive dependency list. See getTransitiveDependencies(). */
+		void setTransitiveDependencies(const Vector<UUID>& dependencies) { mTransitiveDependencies = dependencies; }
+
 		/**	Returns true if this resource is allow to be asynchronously loaded. */
 		bool allowAsyncLoading() const { return mAllowAsync; }
 
@@ -33,6 +43,7 @@ namespace bs
 
 	private:
 		Vector<UUID> mDependencies;
+		Vector<UUID> mTransitiveDependencies;
 		bool mAllowAsync;
 		UINT32 mCompressionMethod;
 
@@ -15,12 +15,33 @@ namespace bs
 	/** Flags that control behavior of a Component. */
 	enum class ComponentFlag
 	{
-		/** 
-		 * Ensures that scene manager cannot pause or stop component callbacks from executing. Off by default. 
+		/**
+		 * Ensures that scene manager cannot pause or stop component callbacks from executing. Off by default.
 		 * Note that this flag must be specified on component creation, in its constructor and any later changes
 		 * to the flag will be ignored.
 		 */
-		AlwaysRun = 1 
+		AlwaysRun = 1,
+		/**
+		 * Signals that per-frame updates of this component type are independent from other component types, allowing the
+		 * scene manager to run them on a worker thread while other component types update. By setting this flag the
+		 * component promises its update() doesn't touch state owned by components of other types, doesn't create or
+		 * destroy components or scene objects, and doesn't use any other systems that aren't thread-safe. Updates of
+		 * components of the same type still run sequentially relative to each other.
+		 * Off by default. Like AlwaysRun, this flag must be specified in the component's constructor and any later
+		 * changes will be ignored.
+		 */
+		ParallelUpdate = 2,
+		/**
+		 * Signals that fixed updates of this component type only read shared state (e.g. query physics objects) and
+		 * only write state owned by the component itself, allowing the scene manager to run them on worker threads
+		 * concurrently with fixed updates of other types carrying this flag. Components that mutate shared state
+		 * (e.g. apply forces, move scene objects other types read) must leave this flag off and will update
+		 * sequentially after the parallel stage. Order of updates within a single type is always deterministic,
+		 * following registration order.
+		 * Off by default. Like AlwaysRun, this flag must be specified in the component's constructor and any later
+		 * changes will be ignored.
+		 */
+		ParallelFixedUpdate = 4
 	};
 
 	typedef Flags<ComponentFlag> ComponentFlags;
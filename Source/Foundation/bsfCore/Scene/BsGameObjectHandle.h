@@ -73,11 +73,11 @@ namespace bs
 		 *
 		 * @note	Throws exception if the GameObject was destroyed.
 		 */
-		GameObject* get() const 
-		{ 
-			throwIfDestroyed();
+		GameObject* get() const
+		{
+			BS_CHECK_ONLY(throwIfDestroyed());
 
-			return mData->mPtr->object.get(); 
+			return mData->mPtr->object.get();
 		}
 
 		/**
@@ -87,7 +87,7 @@ namespace bs
 		 */
 		SPtr<GameObject> getInternalPtr() const
 		{
-			throwIfDestroyed();
+			BS_CHECK_ONLY(throwIfDestroyed());
 
 			return mData->mPtr->object;
 		}
@@ -132,7 +132,11 @@ namespace bs
 		GameObjectHandleBase(const SPtr<GameObjectHandleData>& data);
 		GameObjectHandleBase(std::nullptr_t ptr);
 
-		/**	Throws an exception if the referenced GameObject has been destroyed. */
+		/**
+		 * Throws an exception if the referenced GameObject has been destroyed. Only called from handle accessors in
+		 * builds with runtime validity checks enabled (BS_CHECK_LEVEL >= 1), and compiled out entirely in shipping
+		 * builds.
+		 */
 		void throwIfDestroyed() const;
 		
 		/**	Invalidates the handle signifying the referenced object was destroyed. */
@@ -206,11 +210,11 @@ namespace bs
 		 *
 		 * @note	Throws exception if the GameObject was destroyed.
 		 */
-		T* get() const 
-		{ 
-			throwIfDestroyed();
+		T* get() const
+		{
+			BS_CHECK_ONLY(throwIfDestroyed());
 
-			return reinterpret_cast<T*>(mData->mPtr->object.get()); 
+			return reinterpret_cast<T*>(mData->mPtr->object.get());
 		}
 
 		/**
@@ -220,7 +224,7 @@ namespace bs
 		 */
 		SPtr<T> getInternalPtr() const
 		{
-			throwIfDestroyed();
+			BS_CHECK_ONLY(throwIfDestroyed());
 
 			return std::static_pointer_cast<T>(mData->mPtr->object);
 		}
@@ -6,7 +6,7 @@
 namespace bs
 {
 	GameObjectManager::GameObjectManager()
-		:mNextAvailableID(1), mIsDeserializationActive(false), mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
+		:mIsDeserializationActive(false), mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
 	{
 
 	}
@@ -16,23 +16,53 @@ namespace bs
 		destroyQueuedObjects();
 	}
 
-	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
+	const GameObjectHandleBase* GameObjectManager::findObject(UINT64 id) const
 	{
-		auto iterFind = mObjects.find(id);
+		UINT32 slotIdx = (UINT32)id;
+		UINT32 generation = (UINT32)(id >> 32);
+
+		if (generation == 0 || slotIdx >= (UINT32)mObjects.size())
+			return nullptr;
 
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		const ObjectSlot& slot = mObjects[slotIdx];
+		if (slot.generation != generation)
+			return nullptr;
+
+		return &slot.handle;
+	}
+
+	void GameObjectManager::freeSlot(UINT64 id)
+	{
+		UINT32 slotIdx = (UINT32)id;
+		UINT32 generation = (UINT32)(id >> 32);
+
+		if (generation == 0 || slotIdx >= (UINT32)mObjects.size())
+			return;
+
+		ObjectSlot& slot = mObjects[slotIdx];
+		if (slot.generation != generation)
+			return;
+
+		slot.handle = nullptr;
+		slot.generation = 0;
+		mFreeSlots.push_back(slotIdx);
+	}
+
+	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
+	{
+		const GameObjectHandleBase* handle = findObject(id);
+		if (handle != nullptr)
+			return *handle;
 
 		return nullptr;
 	}
 
 	bool GameObjectManager::tryGetObject(UINT64 id, GameObjectHandleBase& object) const
 	{
-		auto iterFind = mObjects.find(id);
-
-		if (iterFind != mObjects.end())
+		const GameObjectHandleBase* handle = findObject(id);
+		if (handle != nullptr)
 		{
-			object = iterFind->second;
+			object = *handle;
 			return true;
 		}
 
@@ -41,7 +71,7 @@ namespace bs
 
 	bool GameObjectManager::objectExists(UINT64 id) const
 	{
-		return mObjects.find(id) != mObjects.end();
+		return findObject(id) != nullptr;
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -49,8 +79,37 @@ namespace bs
 		if (oldId == newId)
 			return;
 
-		mObjects[newId] = mObjects[oldId];
-		mObjects.erase(oldId);
+		const GameObjectHandleBase* oldHandle = findObject(oldId);
+		if (oldHandle == nullptr)
+			return;
+
+		GameObjectHandleBase handle = *oldHandle;
+
+		UINT32 newSlotIdx = (UINT32)newId;
+		UINT32 newGeneration = (UINT32)(newId >> 32);
+
+		assert(newGeneration != 0 && newSlotIdx < (UINT32)mObjects.size() &&
+			"Objects can only be remapped to IDs this manager previously issued.");
+
+		ObjectSlot& newSlot = mObjects[newSlotIdx];
+
+		// If the target slot is empty it's on the free list and must not be handed out again (cold path, only hit
+		// during prefab instance data restore)
+		if (newSlot.generation == 0)
+		{
+			auto iterFind = std::find(mFreeSlots.begin(), mFreeSlots.end(), newSlotIdx);
+			if (iterFind != mFreeSlots.end())
+				mFreeSlots.erase(iterFind);
+		}
+
+		// Any previous occupant of the target ID gets replaced, same as with the old map-based lookup
+		newSlot.handle = handle;
+		newSlot.generation = newGeneration;
+
+		if (newGeneration > newSlot.maxGeneration)
+			newSlot.maxGeneration = newGeneration;
+
+		freeSlot(oldId);
 	}
 
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
@@ -72,7 +131,23 @@ namespace bs
 
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object, UINT64 originalId)
 	{
-		object->initialize(object, mNextAvailableID);
+		UINT32 slotIdx;
+		if (!mFreeSlots.empty())
+		{
+			slotIdx = mFreeSlots.back();
+			mFreeSlots.pop_back();
+		}
+		else
+		{
+			slotIdx = (UINT32)mObjects.size();
+			mObjects.push_back(ObjectSlot());
+		}
+
+		ObjectSlot& slot = mObjects[slotIdx];
+		slot.generation = ++slot.maxGeneration;
+
+		UINT64 instanceId = encodeId(slotIdx, slot.generation);
+		object->initialize(object, instanceId);
 
 		// If deserialization is active we must ensure all handles pointing to the same object share GameObjectHandleData,
 		// so check if any handles referencing this object have been created. See ::registerUnresolvedHandle for
@@ -88,9 +163,8 @@ namespace bs
 				handle.mData = iterFind->second;
 				handle._setHandleData(object);
 
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
+				slot.handle = handle;
+				mIdMapping[originalId] = instanceId;
 
 				return handle;
 			}
@@ -98,24 +172,22 @@ namespace bs
 			{
 				GameObjectHandleBase handle(object);
 
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
+				slot.handle = handle;
+				mIdMapping[originalId] = instanceId;
 
 				return handle;
 			}
 		}
 
 		GameObjectHandleBase handle(object);
-		mObjects[mNextAvailableID] = handle;
-		mNextAvailableID++;
+		slot.handle = handle;
 
 		return handle;
 	}
 
 	void GameObjectManager::unregisterObject(GameObjectHandleBase& object)
 	{
-		mObjects.erase(object->getInstanceId());
+		freeSlot(object->getInstanceId());
 
 		onDestroyed(object);
 		object.destroy();
@@ -167,10 +239,10 @@ namespace bs
 
 		if (isInternalReference || (!isInternalReference && (flags & GODM_RestoreExternal) != 0))
 		{
-			auto findIterObj = mObjects.find(instanceId);
+			const GameObjectHandleBase* foundObj = findObject(instanceId);
 
-			if (findIterObj != mObjects.end())
-				data.handle._resolve(findIterObj->second);
+			if (foundObj != nullptr)
+				data.handle._resolve(*foundObj);
 			else
 			{
 				if ((flags & GODM_KeepMissing) == 0)
@@ -205,10 +277,10 @@ namespace bs
 		auto iterFind = mIdMapping.find(originalId);
 		if (iterFind != mIdMapping.end())
 		{
-			auto iterFind2 = mObjects.find(iterFind->second);
-			if (iterFind2 != mObjects.end())
+			const GameObjectHandleBase* foundObj = findObject(iterFind->second);
+			if (foundObj != nullptr)
 			{
-				object.mData = iterFind2->second.mData;
+				object.mData = foundObj->mData;
 				foundHandleData = true;
 			}
 		}
@@ -32,6 +32,10 @@ namespace bs
 	/**
 	 * Tracks GameObject creation and destructions. Also resolves GameObject references from GameObject handles.
 	 *
+	 * Objects are stored in a slot array and their instance IDs pack the slot index in the lower 32 bits and a
+	 * per-slot generation in the upper 32 bits. This makes ID lookups an array indexing operation with a generation
+	 * compare, while the generation ensures IDs of destroyed objects don't alias later occupants of the same slot.
+	 *
 	 * @note	Sim thread only.
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
@@ -137,8 +141,28 @@ namespace bs
 		UINT32 getDeserializationFlags() const { return mGODeserializationMode; }
 
 	private:
-		UINT64 mNextAvailableID; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
+		/** Single slot in the object lookup table. */
+		struct ObjectSlot
+		{
+			GameObjectHandleBase handle;
+			UINT32 generation = 0; /**< Generation making up the ID of the current occupant. Zero when the slot is empty. */
+			UINT32 maxGeneration = 0; /**< Highest generation ever issued for this slot. Never decreases. */
+		};
+
+		/**
+		 * Looks up the handle registered under the specified instance ID. Returns null if the ID doesn't map to a live
+		 * object.
+		 */
+		const GameObjectHandleBase* findObject(UINT64 id) const;
+
+		/** Empties the slot the specified instance ID maps to and makes it available for reuse. */
+		void freeSlot(UINT64 id);
+
+		/** Packs a slot index and generation into an instance ID. */
+		static UINT64 encodeId(UINT32 slotIdx, UINT32 generation) { return ((UINT64)generation << 32) | slotIdx; }
+
+		Vector<ObjectSlot> mObjects;
+		Vector<UINT32> mFreeSlots;
 		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
 
 		GameObject* mActiveDeserializedObject;
@@ -5,18 +5,24 @@
 #include "Resources/BsResources.h"
 #include "Scene/BsSceneObject.h"
 #include "Scene/BsPrefabUtility.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Serialization/BsMemorySerializer.h"
 #include "BsCoreApplication.h"
 
 namespace bs
 {
 	Prefab::Prefab()
-		:Resource(false), mHash(0), mIsScene(true)
+		:Resource(false), mCachedCloneData(nullptr), mCachedCloneSize(0), mArchetypeBuilt(false), mArchetypeValid(false)
+		, mHash(0), mIsScene(true)
 	{
-		
+
 	}
 
 	Prefab::~Prefab()
 	{
+		clearCloneCache();
+		clearArchetype();
+
 		if (mRoot != nullptr)
 			mRoot->destroy(true);
 	}
@@ -47,6 +53,9 @@ namespace bs
 
 	void Prefab::initialize(const HSceneObject& sceneObject)
 	{
+		clearCloneCache();
+		clearArchetype();
+
 		sceneObject->mPrefabDiff = nullptr;
 		PrefabUtility::generatePrefabIds(sceneObject);
 
@@ -109,6 +118,10 @@ namespace bs
 
 	void Prefab::_updateChildInstances()
 	{
+		// Child instances may get updated from their own prefabs, modifying the hierarchy
+		clearCloneCache();
+		clearArchetype();
+
 		Stack<HSceneObject> todo;
 		todo.push(mRoot);
 
@@ -145,19 +158,223 @@ namespace bs
 
 		HSceneObject clone = _clone();
 		clone->_instantiate();
-		
+
 		return clone;
 	}
 
+	Vector<HSceneObject> Prefab::instantiate(UINT32 count)
+	{
+		Vector<HSceneObject> output;
+		if (mRoot == nullptr || count == 0)
+			return output;
+
+#if BS_IS_BANSHEE3D
+		if (gCoreApplication().isEditor())
+		{
+			// Update any child prefab instances in case their prefabs changed
+			_updateChildInstances();
+		}
+#endif
+
+		output.reserve(count);
+
+		buildArchetype();
+		if (mArchetypeValid)
+		{
+			for (UINT32 i = 0; i < count; i++)
+			{
+				HSceneObject clone = instantiateFromArchetype();
+				clone->_instantiate();
+				output.push_back(clone);
+			}
+
+			return output;
+		}
+
+		buildCloneCache();
+
+		MemorySerializer serializer;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
+			SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+				serializer.decode(mCachedCloneData, mCachedCloneSize));
+
+			HSceneObject clone = cloneObj->mThisHandle;
+			clone->_instantiate();
+			output.push_back(clone);
+		}
+
+		return output;
+	}
+
 	HSceneObject Prefab::_clone()
 	{
 		if (mRoot == nullptr)
 			return HSceneObject();
 
+		buildArchetype();
+		if (mArchetypeValid)
+			return instantiateFromArchetype();
+
+		buildCloneCache();
+
+		MemorySerializer serializer;
+		GameObjectManager::instance().setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
+			serializer.decode(mCachedCloneData, mCachedCloneSize));
+
+		return cloneObj->mThisHandle;
+	}
+
+	void Prefab::buildCloneCache()
+	{
+		if (mCachedCloneData != nullptr)
+			return;
+
 		mRoot->mPrefabHash = mHash;
 		mRoot->mLinkId = -1;
 
-		return mRoot->clone(false);
+		// The internal hierarchy is stored non-instantiated, so the encoded data already carries SOF_DontInstantiate
+		MemorySerializer serializer;
+		mCachedCloneData = serializer.encode(mRoot.get(), mCachedCloneSize, (void*(*)(size_t))&bs_alloc);
+	}
+
+	void Prefab::clearCloneCache()
+	{
+		if (mCachedCloneData != nullptr)
+		{
+			bs_free(mCachedCloneData);
+			mCachedCloneData = nullptr;
+			mCachedCloneSize = 0;
+		}
+	}
+
+	void Prefab::buildArchetype()
+	{
+		if (mArchetypeBuilt)
+			return;
+
+		mArchetypeBuilt = true;
+		mArchetypeValid = true;
+
+		struct StackEntry
+		{
+			HSceneObject obj;
+			UINT32 parentIdx;
+		};
+
+		Stack<StackEntry> todo;
+		todo.push({ mRoot, (UINT32)-1 });
+
+		MemorySerializer serializer;
+		while (!todo.empty())
+		{
+			StackEntry current = todo.top();
+			todo.pop();
+
+			SceneObject* so = current.obj.get();
+
+			// Nested prefab instances carry their own links and diffs which only the full serialization path knows how
+			// to handle
+			bool isNestedPrefab = current.parentIdx != (UINT32)-1 && !so->mPrefabLinkUUID.empty();
+			if (isNestedPrefab || so->mPrefabDiff != nullptr)
+			{
+				clearArchetype();
+
+				mArchetypeBuilt = true;
+				mArchetypeValid = false;
+				return;
+			}
+
+			ArchetypeObject entry;
+			entry.name = so->getName();
+			entry.flags = so->mFlags;
+			entry.localTfrm = so->getLocalTransform();
+			entry.activeSelf = so->mActiveSelf;
+			entry.mobility = so->mMobility;
+			entry.linkId = current.parentIdx == (UINT32)-1 ? (UINT32)-1 : so->mLinkId;
+			entry.originalId = so->getInstanceId();
+			entry.parentIdx = current.parentIdx;
+			entry.componentStart = (UINT32)mArchetypeComponents.size();
+			entry.componentCount = (UINT32)so->mComponents.size();
+
+			for (auto& component : so->mComponents)
+			{
+				ArchetypeComponent compEntry;
+				compEntry.data = serializer.encode(component.get(), compEntry.size, (void*(*)(size_t))&bs_alloc);
+
+				mArchetypeComponents.push_back(compEntry);
+			}
+
+			UINT32 myIdx = (UINT32)mArchetypeObjects.size();
+			mArchetypeObjects.push_back(std::move(entry));
+
+			// Push children in reverse so they pop in their original order, keeping child indices stable
+			UINT32 numChildren = so->getNumChildren();
+			for (UINT32 i = numChildren; i > 0; i--)
+				todo.push({ so->getChild(i - 1), myIdx });
+		}
+	}
+
+	void Prefab::clearArchetype()
+	{
+		for (auto& entry : mArchetypeComponents)
+			bs_free(entry.data);
+
+		mArchetypeObjects.clear();
+		mArchetypeComponents.clear();
+		mArchetypeBuilt = false;
+		mArchetypeValid = false;
+	}
+
+	HSceneObject Prefab::instantiateFromArchetype()
+	{
+		GameObjectManager& goManager = GameObjectManager::instance();
+		goManager.setDeserializationMode(GODM_UseNewIds | GODM_RestoreExternal);
+
+		// All objects and components share a single deserialization scope, so handles between them resolve to the
+		// newly created instances when the scope closes
+		goManager.startDeserialization();
+
+		MemorySerializer serializer;
+		Vector<HSceneObject> objects;
+		objects.reserve(mArchetypeObjects.size());
+
+		for (auto& entry : mArchetypeObjects)
+		{
+			SPtr<SceneObject> soPtr = SPtr<SceneObject>(new (bs_alloc<SceneObject>()) SceneObject(entry.name, entry.flags),
+				&bs_delete<SceneObject>, StdAlloc<SceneObject>());
+
+			HSceneObject so = SceneObject::createInternal(soPtr, entry.originalId);
+			so->mLocalTfrm = entry.localTfrm;
+			so->mActiveSelf = entry.activeSelf;
+			so->mMobility = entry.mobility;
+			so->mLinkId = entry.linkId;
+
+			for (UINT32 i = 0; i < entry.componentCount; i++)
+			{
+				const ArchetypeComponent& compEntry = mArchetypeComponents[entry.componentStart + i];
+				SPtr<Component> component = std::static_pointer_cast<Component>(
+					serializer.decode(compEntry.data, compEntry.size));
+
+				so->addComponentInternal(component);
+			}
+
+			if (entry.parentIdx != (UINT32)-1)
+				so->_setParent(objects[entry.parentIdx], false);
+
+			objects.push_back(so);
+		}
+
+		goManager.endDeserialization();
+
+		HSceneObject root = objects[0];
+		root->mPrefabLinkUUID = mUUID;
+		root->mPrefabHash = mHash;
+		root->setActiveHierarchy(true, false);
+
+		return root;
 	}
 
 	RTTITypeBase* Prefab::getRTTIStatic()
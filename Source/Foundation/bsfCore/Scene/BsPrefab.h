@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Scene/BsGameObject.h"
+#include "Scene/BsTransform.h"
 #include "Resources/BsResource.h"
 
 namespace bs
@@ -40,6 +41,15 @@ namespace bs
 		 */
 		HSceneObject instantiate();
 
+		/**
+		 * Instantiates multiple instances of the prefab at once. More efficient than calling instantiate() in a loop
+		 * since the prefab hierarchy is encoded just once and every instance is then decoded from that cached data.
+		 *
+		 * @param[in]	count	Number of instances to create.
+		 * @return				Instantiated clones of the prefab's scene object hierarchy.
+		 */
+		Vector<HSceneObject> instantiate(UINT32 count);
+
 		/**
 		 * Replaces the contents of this prefab with new contents from the provided object. Object will be automatically
 		 * linked to this prefab, and its previous prefab link (if any) will be broken.
@@ -86,13 +96,69 @@ namespace bs
 	private:
 		using CoreObject::initialize;
 
+		/** An encoded component belonging to an object in the archetype. See buildArchetype(). */
+		struct ArchetypeComponent
+		{
+			UINT8* data; /**< Component encoded on its own, decoded once per spawned instance. */
+			UINT32 size;
+		};
+
+		/** A single scene object in the archetype, holding everything needed to recreate it without reflection. */
+		struct ArchetypeObject
+		{
+			String name;
+			UINT32 flags;
+			Transform localTfrm;
+			bool activeSelf;
+			ObjectMobility mobility;
+			UINT32 linkId;
+			UINT64 originalId; /**< Instance ID the object had within the prefab hierarchy, used for handle fixup. */
+			UINT32 parentIdx; /**< Index of the object's parent within the archetype. -1 for the root. */
+			UINT32 componentStart; /**< Index of the object's first entry in the archetype component list. */
+			UINT32 componentCount;
+		};
+
 		/**	Initializes the internal prefab hierarchy. Must be called druing creation. */
 		void initialize(const HSceneObject& sceneObject);
 
 		/**	Creates an empty and uninitialized prefab. */
 		static SPtr<Prefab> createEmpty();
 
+		/**
+		 * Encodes the prefab hierarchy and caches the result, so repeated _clone() calls only need to decode it. Does
+		 * nothing if the cache already exists.
+		 */
+		void buildCloneCache();
+
+		/** Frees the cached encoded hierarchy. Must be called whenever the prefab hierarchy changes. */
+		void clearCloneCache();
+
+		/**
+		 * Compiles the prefab hierarchy into a flat creation plan (scene object properties, parent indices and
+		 * individually encoded components) and caches it, so instantiation can recreate the hierarchy directly instead of
+		 * decoding it through the serializer. Does nothing if the plan was already built. Hierarchies containing nested
+		 * prefab instances aren't representable as a plan, in which case the archetype is marked invalid and instantiation
+		 * falls back on the serializer path.
+		 */
+		void buildArchetype();
+
+		/** Frees the cached archetype. Must be called whenever the prefab hierarchy changes. */
+		void clearArchetype();
+
+		/**
+		 * Creates a new instance of the prefab hierarchy from the cached archetype. Behaves like _clone(). May only be
+		 * called after buildArchetype(), and only if the archetype is valid.
+		 */
+		HSceneObject instantiateFromArchetype();
+
 		HSceneObject mRoot;
+		UINT8* mCachedCloneData;
+		UINT32 mCachedCloneSize;
+
+		Vector<ArchetypeObject> mArchetypeObjects;
+		Vector<ArchetypeComponent> mArchetypeComponents;
+		bool mArchetypeBuilt;
+		bool mArchetypeValid;
 		UINT32 mHash;
 		UUID mUUID;
 		bool mIsScene;
@@ -37,6 +37,11 @@ namespace bs
 		_markCoreDirty(ActorDirtyFlag::Active);
 	}
 
+	bool SceneActor::calculateBounds(AABox& bounds) const
+	{
+		return false;
+	}
+
 	void SceneActor::_updateState(const SceneObject& so, bool force)
 	{
 		UINT32 curHash = so.getTransformHash();
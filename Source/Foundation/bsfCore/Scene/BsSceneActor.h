@@ -63,7 +63,16 @@ namespace bs
 		/** @copydoc setMobility */
 		ObjectMobility getMobility() const { return mMobility; }
 
-		/** 
+		/**
+		 * Calculates the world bounds of the contents represented by this actor, if any.
+		 *
+		 * @param[in]	bounds	Output world space bounds of the actor.
+		 * @return				True if the actor has bounds, otherwise false. Actors without bounds are not entered
+		 *						into the scene's spatial index.
+		 */
+		virtual bool calculateBounds(AABox& bounds) const;
+
+		/**
 		 * @name Internal
 		 * @{
 		 */
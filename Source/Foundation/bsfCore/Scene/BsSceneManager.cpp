@@ -5,9 +5,12 @@
 #include "Scene/BsComponent.h"
 #include "Renderer/BsRenderable.h"
 #include "Renderer/BsCamera.h"
+#include "Components/BsCRenderable.h"
+#include "Mesh/BsMesh.h"
 #include "Renderer/BsLight.h"
 #include "RenderAPI/BsViewport.h"
 #include "Scene/BsGameObjectManager.h"
+#include "Threading/BsTaskScheduler.h"
 #include "RenderAPI/BsRenderTarget.h"
 #include "Renderer/BsLightProbeVolume.h"
 #include "Scene/BsSceneActor.h"
@@ -92,6 +95,7 @@ namespace bs
 
 	void SceneManager::_unbindActor(const SPtr<SceneActor>& actor)
 	{
+		mSpatialIndex.removeActor(actor.get());
 		mBoundActors.erase(actor.get());
 	}
 
@@ -149,10 +153,159 @@ namespace bs
 		}
 	}
 
+	void SceneManager::_journalTransformChanged(const HSceneObject& so)
+	{
+		if (so->mInTransformJournal)
+			return;
+
+		so->mInTransformJournal = true;
+		mTransformJournal.push_back(so);
+	}
+
+	void SceneManager::_flushTransformJournal()
+	{
+		// Iterated by index as delivered notifications may move other objects, appending new entries that then get
+		// picked up by the same flush
+		for (UINT32 i = 0; i < (UINT32)mTransformJournal.size(); i++)
+		{
+			HSceneObject so = mTransformJournal[i];
+			if (so.isDestroyed(true))
+				continue;
+
+			so->mInTransformJournal = false;
+
+			for (auto& component : so->mComponents)
+			{
+				if (!component->supportsNotify(TCF_Transform))
+					continue;
+
+				bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
+				if (alwaysRun || isRunning())
+					component->onTransformChanged(TCF_Transform);
+			}
+		}
+
+		mTransformJournal.clear();
+	}
+
 	void SceneManager::_updateCoreObjectTransforms()
 	{
+		_flushTransformJournal();
+
 		for (auto& entry : mBoundActors)
+		{
 			entry.second.actor->_updateState(*entry.second.so);
+
+			// Keep the spatial index in sync with actor bounds. The index skips the update if bounds are unchanged.
+			AABox bounds;
+			if (entry.second.actor->calculateBounds(bounds))
+				mSpatialIndex.updateActor(entry.second.actor.get(), bounds);
+		}
+
+		// Bulk re-insert any actors that moved outside of their padded bounds this frame
+		mSpatialIndex.flushPendingReinserts();
+	}
+
+	Vector<HSceneObject> SceneManager::actorsToObjects(const Vector<SceneActor*>& actors) const
+	{
+		Vector<HSceneObject> output;
+		for (auto& actor : actors)
+		{
+			auto iterFind = mBoundActors.find(actor);
+			if (iterFind != mBoundActors.end())
+				output.push_back(iterFind->second.so);
+		}
+
+		return output;
+	}
+
+	Vector<HSceneObject> SceneManager::findObjectsAlongRay(const Ray& ray) const
+	{
+		Vector<SceneActor*> actors;
+		mSpatialIndex.findAlongRay(ray, actors);
+
+		return actorsToObjects(actors);
+	}
+
+	HSceneObject SceneManager::pickObjectAlongRay(const Ray& ray, float* outDistance) const
+	{
+		Vector<SceneActor*> actors;
+		mSpatialIndex.findAlongRay(ray, actors);
+
+		HSceneObject nearestObject;
+		float nearestDist = std::numeric_limits<float>::max();
+
+		for (auto& actor : actors)
+		{
+			auto iterFind = mBoundActors.find(actor);
+			if (iterFind == mBoundActors.end())
+				continue;
+
+			const HSceneObject& so = iterFind->second.so;
+
+			float dist;
+
+			HRenderable renderableComp = so->getComponent<CRenderable>();
+			HMesh mesh = renderableComp != nullptr ? renderableComp->getMesh() : HMesh();
+
+			if (mesh.isLoaded(false))
+			{
+				// Triangle-accurate test in mesh local space, using the mesh BVH when one is available
+				Matrix4 worldMatrix = so->getTransform().getMatrix();
+
+				Ray localRay = ray;
+				localRay.transformAffine(worldMatrix.inverseAffine());
+
+				auto result = mesh->rayCast(localRay);
+				if (!result.first)
+					continue;
+
+				// Distance along the transformed ray is in local space units - convert by going through the world
+				// space intersection point
+				Vector3 worldHit = worldMatrix.multiplyAffine(localRay.getPoint(result.second));
+				dist = ray.getOrigin().distance(worldHit);
+			}
+			else
+			{
+				// No triangle data available, rank by bounds intersection
+				AABox bounds;
+				if (!actor->calculateBounds(bounds))
+					continue;
+
+				auto result = ray.intersects(bounds);
+				if (!result.first)
+					continue;
+
+				dist = result.second;
+			}
+
+			if (dist < nearestDist)
+			{
+				nearestDist = dist;
+				nearestObject = so;
+			}
+		}
+
+		if (nearestObject != nullptr && outDistance != nullptr)
+			*outDistance = nearestDist;
+
+		return nearestObject;
+	}
+
+	Vector<HSceneObject> SceneManager::findObjectsInVolume(const ConvexVolume& volume) const
+	{
+		Vector<SceneActor*> actors;
+		mSpatialIndex.findInVolume(volume, actors);
+
+		return actorsToObjects(actors);
+	}
+
+	Vector<HSceneObject> SceneManager::findObjectsInSphere(const Sphere& sphere) const
+	{
+		Vector<SceneActor*> actors;
+		mSpatialIndex.findInSphere(sphere, actors);
+
+		return actorsToObjects(actors);
 	}
 
 	SPtr<Camera> SceneManager::getMainCamera() const
@@ -205,14 +358,16 @@ namespace bs
 			if(oldState == ComponentState::Stopped)
 			{
 				// Disable, and then re-enable components that have an AlwaysRun flag
-				for(auto& entry : mActiveComponents)
+				for(auto& group : mActiveComponents)
 				{
-					if (entry->sceneObject()->getActive())
+					for(auto& entry : group.components)
 					{
-						entry->onDisabled();
-						entry->onEnabled();
+						if (entry->sceneObject()->getActive())
+						{
+							entry->onDisabled();
+							entry->onEnabled();
+						}
 					}
-					
 				}
 
 				// Trigger enable on all components that don't have AlwaysRun flag (at this point those will be all
@@ -224,29 +379,7 @@ namespace bs
 				}
 
 				// Initialize and enable uninitialized components
-				for(auto& entry : mUninitializedComponents)
-				{
-					entry->onInitialized();
-
-					if (entry->sceneObject()->getActive())
-					{
-						entry->onEnabled();
-
-						UINT32 idx = (UINT32)mActiveComponents.size();
-						mActiveComponents.push_back(entry);
-
-						entry->setSceneManagerId(encodeComponentId(idx, ActiveList));
-					}
-					else
-					{
-						UINT32 idx = (UINT32)mInactiveComponents.size();
-						mInactiveComponents.push_back(entry);
-
-						entry->setSceneManagerId(encodeComponentId(idx, InactiveList));
-					}
-				}
-
-				mUninitializedComponents.clear();
+				processUninitializedComponents(0);
 			}
 		}
 
@@ -263,10 +396,7 @@ namespace bs
 				removeFromInactiveList(component);
 				i--; // Keep the same index next iteration to process the component we just swapped
 
-				UINT32 activeIdx = (UINT32)mActiveComponents.size();
-				mActiveComponents.push_back(component);
-
-				component->setSceneManagerId(encodeComponentId(activeIdx, ActiveList));
+				addToActiveList(component);
 			}
 		}
 		// Stop updates on all active components
@@ -275,35 +405,41 @@ namespace bs
 			// Trigger onDisable events if stopping
 			if (state == ComponentState::Stopped)
 			{
-				for (INT32 i = 0; i < (INT32)mActiveComponents.size(); i++)
+				for (auto& group : mActiveComponents)
 				{
-					HComponent component = mActiveComponents[i];
+					for (INT32 i = 0; i < (INT32)group.components.size(); i++)
+					{
+						HComponent component = group.components[i];
 
-					bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
+						bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
 
-					component->onDisabled();
+						component->onDisabled();
 
-					if(alwaysRun)
-						component->onEnabled();
+						if(alwaysRun)
+							component->onEnabled();
+					}
 				}
 			}
 
 			// Move from active to inactive list
-			for (INT32 i = 0; i < (INT32)mActiveComponents.size(); i++)
+			for (auto& group : mActiveComponents)
 			{
-				HComponent component = mActiveComponents[i];
+				for (INT32 i = 0; i < (INT32)group.components.size(); i++)
+				{
+					HComponent component = group.components[i];
 
-				bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
-				if (alwaysRun)
-					continue;
+					bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
+					if (alwaysRun)
+						continue;
 
-				removeFromActiveList(component);
-				i--; // Keep the same index next iteration to process the component we just swapped
+					removeFromActiveList(component);
+					i--; // Keep the same index next iteration to process the component we just swapped
 
-				UINT32 inactiveIdx = (UINT32)mInactiveComponents.size();
-				mInactiveComponents.push_back(component);
+					UINT32 inactiveIdx = (UINT32)mInactiveComponents.size();
+					mInactiveComponents.push_back(component);
 
-				component->setSceneManagerId(encodeComponentId(inactiveIdx, InactiveList));
+					component->setSceneManagerId(encodeComponentId(inactiveIdx, InactiveList));
+				}
 			}
 		}
 	}
@@ -315,16 +451,23 @@ namespace bs
 		bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
 		if(alwaysRun || mComponentState != ComponentState::Stopped)
 		{
+			// If an initialization budget is set, queue the component instead of initializing it immediately, so large
+			// scene loads spread their initialization cost over multiple frames
+			if (!alwaysRun && mComponentInitBudget > 0)
+			{
+				UINT32 idx = (UINT32)mUninitializedComponents.size();
+				mUninitializedComponents.push_back(component);
+
+				component->setSceneManagerId(encodeComponentId(idx, UninitializedList));
+				return;
+			}
+
 			component->onInitialized();
 
 			if (parentActive)
 			{
 				component->onEnabled();
-
-				UINT32 idx = (UINT32)mActiveComponents.size();
-				mActiveComponents.push_back(component);
-
-				component->setSceneManagerId(encodeComponentId(idx, ActiveList));
+				addToActiveList(component);
 			}
 			else
 			{
@@ -345,6 +488,15 @@ namespace bs
 
 	void SceneManager::_notifyComponentActivated(const HComponent& component, bool triggerEvent)
 	{
+		UINT32 listType;
+		UINT32 idx;
+		decodeComponentId(component->getSceneManagerId(), idx, listType);
+
+		// Component is waiting on deferred initialization. It remains queued and will pick up the current active state
+		// of its parent once it gets initialized.
+		if (listType == UninitializedList)
+			return;
+
 		bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
 
 		if (alwaysRun || mComponentState == ComponentState::Running || mComponentState == ComponentState::Paused)
@@ -353,16 +505,21 @@ namespace bs
 				component->onEnabled();
 
 			removeFromInactiveList(component);
-
-			UINT32 activeIdx = (UINT32)mActiveComponents.size();
-			mActiveComponents.push_back(component);
-
-			component->setSceneManagerId(encodeComponentId(activeIdx, ActiveList));
+			addToActiveList(component);
 		}
 	}
 
 	void SceneManager::_notifyComponentDeactivated(const HComponent& component, bool triggerEvent)
 	{
+		UINT32 listType;
+		UINT32 idx;
+		decodeComponentId(component->getSceneManagerId(), idx, listType);
+
+		// Component is waiting on deferred initialization. It remains queued and will pick up the current active state
+		// of its parent once it gets initialized.
+		if (listType == UninitializedList)
+			return;
+
 		bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
 
 		if (alwaysRun || mComponentState == ComponentState::Running || mComponentState == ComponentState::Paused)
@@ -402,7 +559,11 @@ namespace bs
 		}
 
 		bool alwaysRun = component->hasFlag(ComponentFlag::AlwaysRun);
-		bool isEnabled = component->sceneObject()->getActive() && (alwaysRun || mComponentState != ComponentState::Stopped);
+
+		// Components still waiting on initialization never received onInitialized()/onEnabled(), so don't send
+		// onDisabled() either
+		bool isEnabled = component->sceneObject()->getActive() && (alwaysRun || mComponentState != ComponentState::Stopped)
+			&& listType != UninitializedList;
 
 		if (isEnabled)
 			component->onDisabled();
@@ -410,24 +571,39 @@ namespace bs
 		component->onDestroyed();
 	}
 
+	void SceneManager::addToActiveList(const HComponent& component)
+	{
+		UINT32 groupIdx = getComponentGroupIdx(component);
+		ComponentGroup& group = mActiveComponents[groupIdx];
+
+		UINT32 idx = (UINT32)group.components.size();
+		group.components.push_back(component);
+
+		component->setSceneManagerId(encodeComponentId(encodeGroupIdx(groupIdx, idx), ActiveList));
+	}
+
 	void SceneManager::removeFromActiveList(const HComponent& component)
 	{
 		UINT32 listType;
+		UINT32 encodedIdx;
+		decodeComponentId(component->getSceneManagerId(), encodedIdx, listType);
+
+		UINT32 groupIdx;
 		UINT32 idx;
-		decodeComponentId(component->getSceneManagerId(), idx, listType);
+		decodeGroupIdx(encodedIdx, groupIdx, idx);
 
-		UINT32 lastIdx;
-		decodeComponentId(mActiveComponents.back()->getSceneManagerId(), lastIdx, listType);
+		ComponentGroup& group = mActiveComponents[groupIdx];
+		UINT32 lastIdx = (UINT32)group.components.size() - 1;
 
-		assert(mActiveComponents[idx] == component);
+		assert(group.components[idx] == component);
 
 		if (idx != lastIdx)
 		{
-			std::swap(mActiveComponents[idx], mActiveComponents[lastIdx]);
-			mActiveComponents[idx]->setSceneManagerId(encodeComponentId(idx, ActiveList));
+			std::swap(group.components[idx], group.components[lastIdx]);
+			group.components[idx]->setSceneManagerId(encodeComponentId(encodeGroupIdx(groupIdx, idx), ActiveList));
 		}
 
-		mActiveComponents.erase(mActiveComponents.end() - 1);
+		group.components.erase(group.components.end() - 1);
 	}
 
 	void SceneManager::removeFromInactiveList(const HComponent& component)
@@ -470,6 +646,48 @@ namespace bs
 		mUninitializedComponents.erase(mUninitializedComponents.end() - 1);
 	}
 
+	void SceneManager::processUninitializedComponents(UINT32 maxEntries)
+	{
+		if (mUninitializedComponents.empty())
+			return;
+
+		UINT32 numToProcess = (UINT32)mUninitializedComponents.size();
+		if (maxEntries > 0)
+			numToProcess = std::min(numToProcess, maxEntries);
+
+		// Process in creation order, guaranteeing a component's parents and earlier siblings initialize before it.
+		// Note the callbacks may add or remove queued entries, so the list is re-checked every iteration. Any newly
+		// queued entries are left for a later call.
+		UINT32 numProcessed = 0;
+		while (numProcessed < numToProcess && numProcessed < (UINT32)mUninitializedComponents.size())
+		{
+			HComponent entry = mUninitializedComponents[numProcessed];
+
+			entry->onInitialized();
+
+			if (entry->sceneObject()->getActive())
+			{
+				entry->onEnabled();
+				addToActiveList(entry);
+			}
+			else
+			{
+				UINT32 idx = (UINT32)mInactiveComponents.size();
+				mInactiveComponents.push_back(entry);
+
+				entry->setSceneManagerId(encodeComponentId(idx, InactiveList));
+			}
+
+			numProcessed++;
+		}
+
+		mUninitializedComponents.erase(mUninitializedComponents.begin(), mUninitializedComponents.begin() + numProcessed);
+
+		// Remaining entries have shifted, update their recorded indices
+		for (UINT32 i = 0; i < (UINT32)mUninitializedComponents.size(); i++)
+			mUninitializedComponents[i]->setSceneManagerId(encodeComponentId(i, UninitializedList));
+	}
+
 	UINT32 SceneManager::encodeComponentId(UINT32 idx, UINT32 type)
 	{
 		assert(idx <= (0x3FFFFFFF));
@@ -483,6 +701,41 @@ namespace bs
 		type = id >> 30;
 	}
 
+	UINT32 SceneManager::encodeGroupIdx(UINT32 groupIdx, UINT32 idx)
+	{
+		assert(groupIdx <= 0x3FF);
+		assert(idx <= 0xFFFFF);
+
+		return (groupIdx << 20) | idx;
+	}
+
+	void SceneManager::decodeGroupIdx(UINT32 encodedIdx, UINT32& groupIdx, UINT32& idx)
+	{
+		groupIdx = (encodedIdx >> 20) & 0x3FF;
+		idx = encodedIdx & 0xFFFFF;
+	}
+
+	UINT32 SceneManager::getComponentGroupIdx(const HComponent& component)
+	{
+		UINT32 rttiId = component->getRTTI()->getRTTIId();
+
+		auto iterFind = mComponentGroupIndices.find(rttiId);
+		if (iterFind != mComponentGroupIndices.end())
+			return iterFind->second;
+
+		UINT32 groupIdx = (UINT32)mActiveComponents.size();
+
+		ComponentGroup group;
+		group.rttiId = rttiId;
+		group.parallelUpdate = component->hasFlag(ComponentFlag::ParallelUpdate);
+		group.parallelFixedUpdate = component->hasFlag(ComponentFlag::ParallelFixedUpdate);
+
+		mActiveComponents.push_back(group);
+		mComponentGroupIndices[rttiId] = groupIdx;
+
+		return groupIdx;
+	}
+
 	bool SceneManager::isComponentOfType(const HComponent& component, UINT32 rttiId)
 	{
 		return component->getRTTI()->getRTTIId() == rttiId;
@@ -490,19 +743,81 @@ namespace bs
 
 	void SceneManager::_update()
 	{
-		// Note: Eventually perform updates based on component types and/or on component priority. Right now we just
-		// iterate in an undefined order, but it wouldn't be hard to change it.
+		// Evaluate any transforms dirtied since last frame in bulk, so component updates don't pay for it by walking
+		// parent chains lazily
+		mTransformUpdater.updateTransforms(mRootNode);
+
+		// Initialize a slice of any components whose initialization was deferred by the budget
+		if (mComponentState != ComponentState::Stopped)
+			processUninitializedComponents(mComponentInitBudget);
+
+		// Update one component type at a time so all instances of a type run together from a contiguous list. Types that
+		// opted into parallel updates run on worker threads first, concurrently with each other, then the remaining types
+		// update sequentially on this thread.
+		Vector<SPtr<Task>> parallelUpdates;
+		for (auto& group : mActiveComponents)
+		{
+			if (!group.parallelUpdate || group.components.empty())
+				continue;
+
+			ComponentGroup* groupPtr = &group;
+			SPtr<Task> task = Task::create("ComponentUpdate", [groupPtr]()
+			{
+				for (auto& entry : groupPtr->components)
+					entry->update();
+			});
+
+			parallelUpdates.push_back(task);
+			TaskScheduler::instance().addTask(task);
+		}
+
+		for (auto& task : parallelUpdates)
+			task->wait();
+
+		for (auto& group : mActiveComponents)
+		{
+			if (group.parallelUpdate)
+				continue;
 
-		for (auto& entry : mActiveComponents)
-			entry->update();
+			for (auto& entry : group.components)
+				entry->update();
+		}
 
 		GameObjectManager::instance().destroyQueuedObjects();
 	}
 
 	void SceneManager::_fixedUpdate()
 	{
-		for (auto& entry : mActiveComponents)
-			entry->fixedUpdate();
+		// Types whose fixed updates only read shared state run concurrently on worker threads first, one task per type
+		// so updates within a type keep their deterministic registration order. Mutating types then update sequentially.
+		Vector<SPtr<Task>> parallelUpdates;
+		for (auto& group : mActiveComponents)
+		{
+			if (!group.parallelFixedUpdate || group.components.empty())
+				continue;
+
+			ComponentGroup* groupPtr = &group;
+			SPtr<Task> task = Task::create("ComponentFixedUpdate", [groupPtr]()
+			{
+				for (auto& entry : groupPtr->components)
+					entry->fixedUpdate();
+			});
+
+			parallelUpdates.push_back(task);
+			TaskScheduler::instance().addTask(task);
+		}
+
+		for (auto& task : parallelUpdates)
+			task->wait();
+
+		for (auto& group : mActiveComponents)
+		{
+			if (group.parallelFixedUpdate)
+				continue;
+
+			for (auto& entry : group.components)
+				entry->fixedUpdate();
+		}
 	}
 
 	void SceneManager::registerNewSO(const HSceneObject& node)
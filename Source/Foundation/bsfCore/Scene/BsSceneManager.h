@@ -5,6 +5,8 @@
 #include "BsCorePrerequisites.h"
 #include "Utility/BsModule.h"
 #include "Scene/BsGameObject.h"
+#include "Scene/BsSceneTransformUpdater.h"
+#include "Scene/BsSceneSpatialIndex.h"
 
 namespace bs
 {
@@ -27,6 +29,19 @@ namespace bs
 		HSceneObject so;
 	};
 
+	/**
+	 * Contains all active components of a single type. Components of one type are updated together from a contiguous
+	 * list, and types flagged with ComponentFlag::ParallelUpdate or ComponentFlag::ParallelFixedUpdate may update on a
+	 * worker thread during the relevant stage.
+	 */
+	struct ComponentGroup
+	{
+		UINT32 rttiId = 0;
+		bool parallelUpdate = false;
+		bool parallelFixedUpdate = false;
+		Vector<HComponent> components;
+	};
+
 	/** Possible states components can be in. Controls which component callbacks are triggered. */
 	enum class ComponentState
 	{
@@ -67,6 +82,17 @@ namespace bs
 		/** Checks are the components currently in the Running state. */
 		bool isRunning() const { return mComponentState == ComponentState::Running; }
 
+		/**
+		 * Determines the maximum number of components that will be initialized per frame. Zero (the default) initializes
+		 * components immediately as they are created. When non-zero, components created while the scene is running are
+		 * instead queued and initialized in creation order over the following frames, at most @p numPerFrame per frame.
+		 * This keeps large scene or prefab loads from triggering thousands of onInitialized()/onEnabled() callbacks in a
+		 * single frame. Since creation order is preserved an object's parents and earlier siblings are guaranteed to be
+		 * initialized before it. Components with the ComponentFlag::AlwaysRun flag ignore the budget and always
+		 * initialize immediately.
+		 */
+		void setComponentInitializationBudget(UINT32 numPerFrame) { mComponentInitBudget = numPerFrame; }
+
 		/** 
 		 * Returns a list of all components of the specified type currently in the scene. 
 		 *
@@ -93,9 +119,41 @@ namespace bs
 		 */
 		void setMainRenderTarget(const SPtr<RenderTarget>& rt);
 
-		/** 
+		/**
+		 * Finds all scene objects with bound actors whose bounds intersect the provided ray. Only actors that report
+		 * bounds (see SceneActor::calculateBounds()) are considered.
+		 */
+		Vector<HSceneObject> findObjectsAlongRay(const Ray& ray) const;
+
+		/**
+		 * Finds the scene object closest to the ray origin that is intersected by the ray. Objects with a renderable
+		 * mesh are tested triangle-accurately, using the mesh bounding volume hierarchy when one was generated (see
+		 * MeshImportOptions::setGenerateBVH), while other bound actors are ranked by their bounds intersection. Intended
+		 * for picking.
+		 *
+		 * @param[in]	ray				Ray to test, in world space.
+		 * @param[out]	outDistance		If not null and an object was hit, receives the distance from the ray origin to
+		 *								the intersection point.
+		 * @return						The intersected scene object closest to the ray origin, or null if the ray
+		 *								intersects nothing.
+		 */
+		HSceneObject pickObjectAlongRay(const Ray& ray, float* outDistance = nullptr) const;
+
+		/** Finds all scene objects with bound actors whose bounds intersect the provided convex volume (e.g. a frustum). */
+		Vector<HSceneObject> findObjectsInVolume(const ConvexVolume& volume) const;
+
+		/** Finds all scene objects with bound actors whose bounds intersect the provided sphere. */
+		Vector<HSceneObject> findObjectsInSphere(const Sphere& sphere) const;
+
+		/**
+		 * Returns the spatial index covering bounds of all bound scene actors. Can be used by external systems (e.g. the
+		 * renderer) as a broad-phase filter before running their own exact queries.
+		 */
+		const SceneSpatialIndex& _getSpatialIndex() const { return mSpatialIndex; }
+
+		/**
 		 * Binds a scene actor with a scene object. Every frame the scene object's transform will be monitored for
-		 * changes and those changes will be automatically transfered to the actor. 
+		 * changes and those changes will be automatically transfered to the actor.
 		 */
 		void _bindActor(const SPtr<SceneActor>& actor, const HSceneObject& so);
 
@@ -123,6 +181,19 @@ namespace bs
 		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
 		void _updateCoreObjectTransforms();
 
+		/**
+		 * Records a scene object whose transform changed this frame into the journal. Duplicate records of the same
+		 * object are ignored. The relevant components are notified when the journal is next flushed.
+		 */
+		void _journalTransformChanged(const HSceneObject& so);
+
+		/**
+		 * Delivers transform-change notifications for all objects recorded in the journal since the last flush, each
+		 * object notified exactly once regardless of how many times it moved. Called automatically at the end of the
+		 * sim tick and before each physics step.
+		 */
+		void _flushTransformJournal();
+
 		/** Notifies the manager that a new component has just been created. The manager triggers necessary callbacks. */
 		void _notifyComponentCreated(const HComponent& component, bool parentActive);
 
@@ -160,6 +231,12 @@ namespace bs
 		/**	Callback that is triggered when the main render target size is changed. */
 		void onMainRenderTargetResized();
 
+		/** Maps a set of scene actors to the scene objects they are bound to. Actors without a bound object are skipped. */
+		Vector<HSceneObject> actorsToObjects(const Vector<SceneActor*>& actors) const;
+
+		/** Adds a component to the active component list, into the group matching its type. */
+		void addToActiveList(const HComponent& component);
+
 		/** Removes a component from the active component list. */
 		void removeFromActiveList(const HComponent& component);
 
@@ -169,15 +246,31 @@ namespace bs
 		/** Removes a component from the uninitialized component list. */
 		void removeFromUninitializedList(const HComponent& component);
 
-		/** 
+		/**
+		 * Initializes (and enables, if their parent is active) components from the uninitialized component list, in the
+		 * order they were created. At most @p maxEntries components are processed, zero meaning no limit.
+		 */
+		void processUninitializedComponents(UINT32 maxEntries);
+
+		/**
 		 * Encodes an index and a type into a single 32-bit integer. Top 2 bits represent the type, while the rest represent
-		 * the index.
+		 * the index. For components on the active list the index portion further splits into a component group index
+		 * (top 10 bits) and an index within the group (bottom 20 bits).
 		 */
 		UINT32 encodeComponentId(UINT32 idx, UINT32 type);
 
 		/** Decodes an id encoded with encodeComponentId(). */
 		void decodeComponentId(UINT32 id, UINT32& idx, UINT32& type);
 
+		/** Encodes a component group index and an index within that group into the index portion of a component id. */
+		UINT32 encodeGroupIdx(UINT32 groupIdx, UINT32 idx);
+
+		/** Decodes an index encoded with encodeGroupIdx(). */
+		void decodeGroupIdx(UINT32 encodedIdx, UINT32& groupIdx, UINT32& idx);
+
+		/** Returns the index of the active component group for the provided component's type, creating it if missing. */
+		UINT32 getComponentGroupIdx(const HComponent& component);
+
 		/** Checks does the specified component type match the provided RTTI id. */
 		static bool isComponentOfType(const HComponent& component, UINT32 rttiId);
 
@@ -188,14 +281,20 @@ namespace bs
 		UnorderedMap<Camera*, SPtr<Camera>> mCameras;
 		Vector<SPtr<Camera>> mMainCameras;
 
-		Vector<HComponent> mActiveComponents;
+		Vector<ComponentGroup> mActiveComponents;
+		UnorderedMap<UINT32, UINT32> mComponentGroupIndices;
 		Vector<HComponent> mInactiveComponents;
 		Vector<HComponent> mUninitializedComponents;
 
+		SceneTransformUpdater mTransformUpdater;
+		SceneSpatialIndex mSpatialIndex;
+		Vector<HSceneObject> mTransformJournal;
+
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
 
 		ComponentState mComponentState = ComponentState::Running;
+		UINT32 mComponentInitBudget = 0;
 	};
 
 	/**	Provides easy access to the SceneManager. */
@@ -207,9 +306,12 @@ namespace bs
 		UINT32 rttiId = T::getRTTIStatic()->getRTTIId();
 
 		Vector<GameObjectHandle<T>> output;
-		for(auto& entry : mActiveComponents)
+		for(auto& group : mActiveComponents)
 		{
-			if (isComponentOfType(entry, rttiId))
+			if (group.rttiId != rttiId)
+				continue;
+
+			for(auto& entry : group.components)
 				output.push_back(static_object_cast<T>(entry));
 		}
 
@@ -425,6 +425,16 @@ namespace bs
 
 	void SceneObject::notifyTransformChanged(TransformChangedFlags flags) const
 	{
+		// Plain transform changes happen frequently (gameplay can move an object several times in a single frame) and
+		// their reactions (physics write-back, audio positions, core sync) only need the final transform, so they are
+		// journaled and delivered once at the end of the sim tick. Structural changes (parent, mobility) remain
+		// immediate as components depend on observing them right away.
+		if (flags == TCF_Transform && mThisHandle != nullptr && SceneManager::isStarted())
+		{
+			journalTransformChanged();
+			return;
+		}
+
 		// If object is immovable, don't send transform changed events nor mark the transform dirty
 		TransformChangedFlags componentFlags = flags;
 		if (mMobility != ObjectMobility::Movable)
@@ -458,6 +468,28 @@ namespace bs
 		}
 	}
 
+	void SceneObject::journalTransformChanged() const
+	{
+		if (mMobility == ObjectMobility::Movable)
+		{
+			mDirtyFlags |= DirtyFlags::LocalTfrmDirty | DirtyFlags::WorldTfrmDirty;
+			mDirtyHash++;
+
+			// Only objects with a component interested in the change need a journal entry
+			for (auto& entry : mComponents)
+			{
+				if (entry->supportsNotify(TCF_Transform))
+				{
+					gSceneManager()._journalTransformChanged(mThisHandle);
+					break;
+				}
+			}
+		}
+
+		for (auto& entry : mChildren)
+			entry->journalTransformChanged();
+	}
+
 	void SceneObject::updateWorldTfrm() const
 	{
 		mWorldTfrm = mLocalTfrm;
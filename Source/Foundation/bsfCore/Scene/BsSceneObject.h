@@ -48,6 +48,7 @@ namespace bs
 		};
 
 		friend class SceneManager;
+		friend class SceneTransformUpdater;
 		friend class Prefab;
 		friend class PrefabDiff;
 		friend class PrefabUtility;
@@ -312,14 +313,23 @@ namespace bs
 
 		mutable UINT32 mDirtyFlags;
 		mutable UINT32 mDirtyHash;
+		mutable bool mInTransformJournal = false;
 
-		/** 
-		 * Notifies components and child scene object that a transform has been changed.  
-		 * 
+		/**
+		 * Notifies components and child scene object that a transform has been changed.
+		 *
 		 * @param	flags		Specifies in what way was the transform changed.
 		 */
 		void notifyTransformChanged(TransformChangedFlags flags) const;
 
+		/**
+		 * Recursively marks cached transforms in the hierarchy as dirty, and records any objects with components
+		 * interested in transform changes into the scene manager's journal, deferring the actual notifications to the
+		 * end of the sim tick. Used in place of notifyTransformChanged() for plain (non-structural) transform changes,
+		 * so an object moved multiple times in a frame triggers its downstream reactions just once.
+		 */
+		void journalTransformChanged() const;
+
 		/** Updates the local transform. Normally just reconstructs the transform matrix from the position/rotation/scale. */
 		void updateLocalTfrm() const;
 
@@ -0,0 +1,134 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Scene/BsSceneSpatialIndex.h"
+#include "Math/BsRay.h"
+#include "Math/BsSphere.h"
+#include "Math/BsConvexVolume.h"
+
+namespace bs
+{
+	// Extent (half-size) of the octree root node. Elements that don't fit are kept in the root node, so objects placed
+	// outside of this range remain queryable, just without the benefit of spatial partitioning.
+	static constexpr float ROOT_EXTENT = 10000.0f;
+
+	// Amount the actor bounds get padded by when inserted into the octree, as a fraction of their half-size. Larger
+	// values mean fewer octree re-inserts for moving objects, at the cost of looser element bounds during traversal.
+	static constexpr float FAT_BOUNDS_EXPANSION = 0.1f;
+
+	// Minimum absolute padding applied to each axis, so very small (or flat) bounds still get room to move in.
+	static constexpr float FAT_BOUNDS_MIN_PADDING = 0.05f;
+
+	SceneSpatialIndex::SceneSpatialIndex()
+		: mOctree(Vector3::ZERO, ROOT_EXTENT, &mContext)
+	{ }
+
+	void SceneSpatialIndex::updateActor(SceneActor* actor, const AABox& bounds)
+	{
+		auto iterFind = mEntryIndices.find(actor);
+		if (iterFind != mEntryIndices.end())
+		{
+			IndexEntry& entry = mContext.entries[iterFind->second];
+			if (entry.bounds == bounds)
+				return;
+
+			entry.bounds = bounds;
+
+			// As long as the actor remains within its padded bounds the octree needs no update, since queries always
+			// test the actual bounds of individual elements
+			if (entry.fatBounds.contains(bounds))
+				return;
+
+			if (!entry.pendingReinsert)
+			{
+				entry.pendingReinsert = true;
+				mPendingReinserts.push_back(iterFind->second);
+			}
+		}
+		else
+		{
+			UINT32 entryIdx;
+			if (!mFreeEntryIndices.empty())
+			{
+				entryIdx = mFreeEntryIndices.back();
+				mFreeEntryIndices.erase(mFreeEntryIndices.end() - 1);
+			}
+			else
+			{
+				entryIdx = (UINT32)mContext.entries.size();
+				mContext.entries.push_back(IndexEntry());
+			}
+
+			IndexEntry& entry = mContext.entries[entryIdx];
+			entry.actor = actor;
+			entry.bounds = bounds;
+			entry.fatBounds = calcFatBounds(bounds);
+			entry.pendingReinsert = false;
+
+			mEntryIndices[actor] = entryIdx;
+			mOctree.addElement(entryIdx);
+		}
+	}
+
+	void SceneSpatialIndex::removeActor(SceneActor* actor)
+	{
+		auto iterFind = mEntryIndices.find(actor);
+		if (iterFind == mEntryIndices.end())
+			return;
+
+		UINT32 entryIdx = iterFind->second;
+		mOctree.removeElement(mContext.entries[entryIdx].octreeId);
+
+		mContext.entries[entryIdx].actor = nullptr;
+		mContext.entries[entryIdx].pendingReinsert = false;
+		mFreeEntryIndices.push_back(entryIdx);
+		mEntryIndices.erase(iterFind);
+	}
+
+	void SceneSpatialIndex::flushPendingReinserts()
+	{
+		for (UINT32 entryIdx : mPendingReinserts)
+		{
+			IndexEntry& entry = mContext.entries[entryIdx];
+
+			// Entry was removed (and possibly re-used for a different actor) after being queued
+			if (!entry.pendingReinsert)
+				continue;
+
+			entry.pendingReinsert = false;
+			entry.fatBounds = calcFatBounds(entry.bounds);
+
+			mOctree.removeElement(entry.octreeId);
+			mOctree.addElement(entryIdx);
+		}
+
+		mPendingReinserts.clear();
+	}
+
+	AABox SceneSpatialIndex::calcFatBounds(const AABox& bounds)
+	{
+		const Vector3 padding = bounds.getHalfSize() * FAT_BOUNDS_EXPANSION +
+			Vector3(FAT_BOUNDS_MIN_PADDING, FAT_BOUNDS_MIN_PADDING, FAT_BOUNDS_MIN_PADDING);
+
+		return AABox(bounds.getMin() - padding, bounds.getMax() + padding);
+	}
+
+	void SceneSpatialIndex::findInBox(const AABox& box, Vector<SceneActor*>& output) const
+	{
+		findMatching([&box](const AABox& bounds) { return bounds.intersects(box); }, output);
+	}
+
+	void SceneSpatialIndex::findInSphere(const Sphere& sphere, Vector<SceneActor*>& output) const
+	{
+		findMatching([&sphere](const AABox& bounds) { return bounds.intersects(sphere); }, output);
+	}
+
+	void SceneSpatialIndex::findInVolume(const ConvexVolume& volume, Vector<SceneActor*>& output) const
+	{
+		findMatching([&volume](const AABox& bounds) { return volume.intersects(bounds); }, output);
+	}
+
+	void SceneSpatialIndex::findAlongRay(const Ray& ray, Vector<SceneActor*>& output) const
+	{
+		findMatching([&ray](const AABox& bounds) { return bounds.intersects(ray).first; }, output);
+	}
+}
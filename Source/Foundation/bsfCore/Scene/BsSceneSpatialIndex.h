@@ -0,0 +1,157 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsAABox.h"
+#include "Utility/BsOctree.h"
+
+namespace bs
+{
+	class ConvexVolume;
+
+	/** @addtogroup Scene-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Maintains a spatial index (an octree) over the bounds of scene actors, so spatial queries don't need to scan every
+	 * object in the scene. Entries are registered and kept up to date by the SceneManager as actor transforms change.
+	 */
+	class BS_CORE_EXPORT SceneSpatialIndex
+	{
+		/** Information about a single indexed actor. */
+		struct IndexEntry
+		{
+			SceneActor* actor = nullptr;
+			AABox bounds = AABox::BOX_EMPTY;
+
+			/**
+			 * Padded version of the actor bounds, as registered with the octree. As long as the actual bounds stay within
+			 * the padded bounds the octree doesn't need to be touched when the actor moves.
+			 */
+			AABox fatBounds = AABox::BOX_EMPTY;
+
+			/** True if the actor left its padded bounds and is waiting to be re-inserted into the octree. */
+			bool pendingReinsert = false;
+
+			mutable OctreeElementId octreeId;
+		};
+
+		/** Data shared with the octree. Octree elements are indices into the entry list. */
+		struct IndexContext
+		{
+			Vector<IndexEntry> entries;
+		};
+
+		/** Controls the octree properties. */
+		struct IndexOptions
+		{
+			enum { LoosePadding = 16 };
+			enum { MinElementsPerNode = 8 };
+			enum { MaxElementsPerNode = 16 };
+			enum { MaxDepth = 12 };
+
+			static simd::AABox getBounds(UINT32 elem, void* context)
+			{
+				IndexContext* indexContext = (IndexContext*)context;
+				return simd::AABox(indexContext->entries[elem].fatBounds);
+			}
+
+			static void setElementId(UINT32 elem, const OctreeElementId& id, void* context)
+			{
+				IndexContext* indexContext = (IndexContext*)context;
+				indexContext->entries[elem].octreeId = id;
+			}
+		};
+
+		typedef Octree<UINT32, IndexOptions> ActorOctree;
+
+	public:
+		SceneSpatialIndex();
+
+		/**
+		 * Adds a new actor to the index, or updates the bounds of a previously added actor. Actors are stored in the
+		 * octree using padded (fat) bounds, so updates that keep the actor within its padded bounds don't modify the
+		 * octree at all. Actors that leave their padded bounds are queued and must be re-inserted in bulk by calling
+		 * flushPendingReinserts() before the index is next queried.
+		 */
+		void updateActor(SceneActor* actor, const AABox& bounds);
+
+		/** Removes an actor from the index. Does nothing if the actor was never added. */
+		void removeActor(SceneActor* actor);
+
+		/**
+		 * Re-inserts all actors that left their padded bounds since the last call, re-padding their bounds in the
+		 * process. Called by the SceneManager once per frame, after all actor bounds have been updated. This makes index
+		 * maintenance cost proportional to how far actors actually move, rather than to how often they move.
+		 */
+		void flushPendingReinserts();
+
+		/** Finds all indexed actors whose bounds intersect the provided box. */
+		void findInBox(const AABox& box, Vector<SceneActor*>& output) const;
+
+		/** Finds all indexed actors whose bounds intersect the provided sphere. */
+		void findInSphere(const Sphere& sphere, Vector<SceneActor*>& output) const;
+
+		/** Finds all indexed actors whose bounds intersect the provided convex volume (e.g. a frustum). */
+		void findInVolume(const ConvexVolume& volume, Vector<SceneActor*>& output) const;
+
+		/** Finds all indexed actors whose bounds intersect the provided ray. */
+		void findAlongRay(const Ray& ray, Vector<SceneActor*>& output) const;
+
+	private:
+		/**
+		 * Walks the octree, skipping any branches whose bounds fail the provided predicate, and outputs all actors whose
+		 * bounds pass it. The predicate receives an AABox and must return true if the box intersects the queried shape.
+		 */
+		template<class Pred>
+		void findMatching(Pred predicate, Vector<SceneActor*>& output) const;
+
+		/** Converts SIMD-friendly bounds used by the octree into a regular axis aligned box. */
+		static AABox toAABox(const simd::AABox& bounds)
+		{
+			Vector3 center(bounds.center.x, bounds.center.y, bounds.center.z);
+			Vector3 extents(bounds.extents.x, bounds.extents.y, bounds.extents.z);
+
+			return AABox(center - extents, center + extents);
+		}
+
+		/** Calculates padded bounds for an actor, leaving room for movement before a re-insert becomes necessary. */
+		static AABox calcFatBounds(const AABox& bounds);
+
+		IndexContext mContext;
+		ActorOctree mOctree;
+		UnorderedMap<SceneActor*, UINT32> mEntryIndices;
+		Vector<UINT32> mFreeEntryIndices;
+		Vector<UINT32> mPendingReinserts;
+	};
+
+	template<class Pred>
+	void SceneSpatialIndex::findMatching(Pred predicate, Vector<SceneActor*>& output) const
+	{
+		ActorOctree::NodeIterator nodeIter(mOctree);
+		while (nodeIter.moveNext())
+		{
+			const ActorOctree::HNode& nodeRef = nodeIter.getCurrent();
+			if (!predicate(toAABox(nodeRef.getBounds().getBounds())))
+				continue;
+
+			ActorOctree::ElementIterator elemIter(nodeRef.getNode());
+			while (elemIter.moveNext())
+			{
+				const IndexEntry& entry = mContext.entries[elemIter.getCurrentElem()];
+				if (predicate(entry.bounds))
+					output.push_back(entry.actor);
+			}
+
+			for (UINT32 i = 0; i < 8; i++)
+			{
+				if (nodeRef.getNode()->hasChild(i))
+					nodeIter.pushChild(i);
+			}
+		}
+	}
+
+	/** @} */
+}
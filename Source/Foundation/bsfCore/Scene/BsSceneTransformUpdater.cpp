@@ -0,0 +1,154 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Scene/BsSceneTransformUpdater.h"
+#include "Scene/BsSceneObject.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs
+{
+	// Special values for SceneTransformUpdater::mParents entries
+	static constexpr UINT32 PARENT_NONE = 0xFFFFFFFF; /**< World transform equals the local transform. */
+	static constexpr UINT32 PARENT_BASE = 0xFFFFFFFE; /**< Combine with the parent world transform stored during gather. */
+
+	// Depth levels with at least this many entries are considered worth splitting among worker threads
+	static constexpr UINT32 PARALLEL_THRESHOLD = 128;
+
+	// Number of entries evaluated by a single worker task
+	static constexpr UINT32 CHUNK_SIZE = 256;
+
+	void SceneTransformUpdater::updateTransforms(const HSceneObject& root, bool parallel)
+	{
+		mLocalTfrms.clear();
+		mWorldTfrms.clear();
+		mParents.clear();
+		mOwners.clear();
+		mLevelEnds.clear();
+
+		if (root == nullptr || root.isDestroyed())
+			return;
+
+		// Gather dirty objects breadth-first, so all entries of one depth level are contiguous and every parent is
+		// evaluated before any of its children. Clean parents contribute their cached world transform as a base.
+		struct QueueEntry
+		{
+			SceneObject* so;
+			UINT32 parentIdx;
+		};
+
+		Vector<QueueEntry> curLevel;
+		Vector<QueueEntry> nextLevel;
+
+		curLevel.push_back({ root.get(), (UINT32)PARENT_NONE });
+
+		while (!curLevel.empty())
+		{
+			for (auto& entry : curLevel)
+			{
+				SceneObject* so = entry.so;
+
+				UINT32 myIdx = (UINT32)PARENT_NONE;
+				if (!so->isCachedWorldTfrmUpToDate())
+				{
+					myIdx = (UINT32)mOwners.size();
+
+					mOwners.push_back(so);
+					mLocalTfrms.push_back(so->mLocalTfrm);
+
+					// Don't allow movement from parent when not movable
+					if (so->mParent != nullptr && so->mMobility == ObjectMobility::Movable)
+					{
+						if (entry.parentIdx != PARENT_NONE)
+						{
+							mParents.push_back(entry.parentIdx);
+							mWorldTfrms.push_back(Transform());
+						}
+						else
+						{
+							// Parent is already up to date, so its cached world transform serves as the base
+							mParents.push_back((UINT32)PARENT_BASE);
+							mWorldTfrms.push_back(so->mParent->getTransform());
+						}
+					}
+					else
+					{
+						mParents.push_back((UINT32)PARENT_NONE);
+						mWorldTfrms.push_back(Transform());
+					}
+				}
+
+				for (auto& child : so->mChildren)
+					nextLevel.push_back({ child.get(), myIdx });
+			}
+
+			UINT32 numEntries = (UINT32)mOwners.size();
+			if (numEntries > (mLevelEnds.empty() ? 0 : mLevelEnds.back()))
+				mLevelEnds.push_back(numEntries);
+
+			curLevel.swap(nextLevel);
+			nextLevel.clear();
+		}
+
+		// Evaluate one depth level at a time. Entries within a level only depend on previous levels, so they can be
+		// processed in any order, or concurrently.
+		UINT32 levelStart = 0;
+		for (auto& levelEnd : mLevelEnds)
+		{
+			UINT32 numEntries = levelEnd - levelStart;
+			if (parallel && numEntries >= PARALLEL_THRESHOLD)
+			{
+				Vector<SPtr<Task>> tasks;
+				for (UINT32 chunkStart = levelStart; chunkStart < levelEnd; chunkStart += CHUNK_SIZE)
+				{
+					UINT32 chunkEnd = std::min(chunkStart + CHUNK_SIZE, levelEnd);
+					SPtr<Task> task = Task::create("UpdateTransforms", [this, chunkStart, chunkEnd]()
+					{
+						for (UINT32 i = chunkStart; i < chunkEnd; i++)
+							evaluateEntry(i);
+					});
+
+					tasks.push_back(task);
+					TaskScheduler::instance().addTask(task);
+				}
+
+				for (auto& task : tasks)
+					task->wait();
+			}
+			else
+			{
+				for (UINT32 i = levelStart; i < levelEnd; i++)
+					evaluateEntry(i);
+			}
+
+			levelStart = levelEnd;
+		}
+	}
+
+	void SceneTransformUpdater::evaluateEntry(UINT32 idx)
+	{
+		SceneObject* so = mOwners[idx];
+
+		UINT32 parentIdx = mParents[idx];
+		if (parentIdx == PARENT_NONE)
+		{
+			mWorldTfrms[idx] = mLocalTfrms[idx];
+
+			so->mWorldTfrm = mLocalTfrms[idx];
+			so->mCachedWorldTfrm = so->getLocalMatrix();
+		}
+		else
+		{
+			Transform world = mLocalTfrms[idx];
+			if (parentIdx == PARENT_BASE)
+				world.makeWorld(mWorldTfrms[idx]); // Parent world transform was stored during gather
+			else
+				world.makeWorld(mWorldTfrms[parentIdx]);
+
+			mWorldTfrms[idx] = world;
+
+			so->mWorldTfrm = world;
+			so->mCachedWorldTfrm = world.getMatrix();
+		}
+
+		so->mDirtyFlags &= ~SceneObject::DirtyFlags::WorldTfrmDirty;
+	}
+}
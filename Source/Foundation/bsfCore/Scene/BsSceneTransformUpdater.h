@@ -0,0 +1,47 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Scene/BsTransform.h"
+
+namespace bs
+{
+	/** @addtogroup Scene-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Evaluates dirty scene object world transforms in bulk. Instead of lazily walking parent chains per-object, all
+	 * dirty objects are gathered breadth-first into contiguous arrays once per frame, grouped by hierarchy depth. Depth
+	 * levels are then evaluated in order, guaranteeing every parent transform is evaluated exactly once before any of its
+	 * children, while entries within a single level are independent and may be split among worker threads.
+	 *
+	 * Objects left untouched by the pass (e.g. those modified by component updates later in the frame) still fall back
+	 * to the regular lazy evaluation in SceneObject.
+	 */
+	class BS_CORE_EXPORT SceneTransformUpdater
+	{
+	public:
+		/**
+		 * Evaluates world transforms for all dirty objects in the hierarchy below (and including) @p root.
+		 *
+		 * @param[in]	root		Root of the hierarchy to update.
+		 * @param[in]	parallel	If true, depth levels containing many entries are split among worker threads.
+		 */
+		void updateTransforms(const HSceneObject& root, bool parallel = true);
+
+	private:
+		/** Evaluates the world transform of a single gathered entry and writes the result back to its owner. */
+		void evaluateEntry(UINT32 idx);
+
+		// Gathered per-entry data, in breadth-first order so entries of a single depth level are contiguous
+		Vector<Transform> mLocalTfrms;
+		Vector<Transform> mWorldTfrms;
+		Vector<UINT32> mParents;
+		Vector<SceneObject*> mOwners;
+		Vector<UINT32> mLevelEnds;
+	};
+
+	/** @} */
+}
@@ -43,6 +43,13 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		Vector<HTexture> texturePages;
 
+		/**
+		 * If true the texture pages contain signed distance fields instead of glyph coverage. Multiple font sizes may
+		 * share the same set of distance field pages, with only the character metrics differing between them.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool isSDF = false;
+
 		/** All characters in the font referenced by character ID. */
 		Map<UINT32, CharDesc> characters;
 
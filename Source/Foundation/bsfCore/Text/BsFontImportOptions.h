@@ -48,6 +48,13 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**
+		 * Sets whether the characters should be baked as signed distance fields instead of plain bitmaps. Distance
+		 * fields are generated once at the largest requested size and shared between all imported sizes, allowing text
+		 * to be scaled smoothly and all sizes to be rendered from the same set of textures.
+		 */
+		void setSDF(bool sdf) { mSDF = sdf; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +73,9 @@ namespace bs
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/**	Gets whether the characters should be baked as signed distance fields instead of plain bitmaps. */
+		bool getSDF() const { return mSDF; }
+
 		/** Creates a new import options object that allows you to customize how are fonts imported. */
 		static SPtr<FontImportOptions> create();
 
@@ -76,6 +86,7 @@ namespace bs
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mSDF;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -559,9 +559,14 @@ namespace bs
 		return mFontData->baselineOffset; 
 	}
 
-	UINT32 TextDataBase::getLineHeight() const 
-	{ 
-		return mFontData->lineHeight; 
+	UINT32 TextDataBase::getLineHeight() const
+	{
+		return mFontData->lineHeight;
+	}
+
+	bool TextDataBase::isUsingSDF() const
+	{
+		return mFontData != nullptr && mFontData->isSDF;
 	}
 
 	UINT32 TextDataBase::getSpaceWidth() const 
@@ -230,6 +230,9 @@ namespace bs
 		/**	Returns the height of a line in pixels. */
 		BS_CORE_EXPORT UINT32 getLineHeight() const;
 
+		/**	Returns true if the font bitmap used for generating the text stores signed distance fields. */
+		BS_CORE_EXPORT bool isUsingSDF() const;
+
 		/**	Gets information describing a single line at the specified index. */
 		BS_CORE_EXPORT const TextLine& getLine(UINT32 idx) const { return mLines[idx]; }
 
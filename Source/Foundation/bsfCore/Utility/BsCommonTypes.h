@@ -220,6 +220,19 @@ namespace bs
 		GBT_INDIRECTARGUMENT,
 	};
 
+	/**
+	 * Arguments for a single indexed draw operation, as stored in a GBT_INDIRECTARGUMENT buffer. The layout matches the
+	 * indirect argument layout expected by all supported render APIs.
+	 */
+	struct DrawIndexedIndirectArgs
+	{
+		UINT32 indexCount = 0; /**< Number of indices to draw. */
+		UINT32 instanceCount = 0; /**< Number of instances to draw. */
+		UINT32 firstIndex = 0; /**< Offset into the bound index buffer to start drawing from. */
+		INT32 vertexOffset = 0; /**< Offset to apply to each vertex index. */
+		UINT32 firstInstance = 0; /**< Offset to apply to each instance index. */
+	};
+
 	/** Types of valid formats used for standard GPU buffers. */
 	enum GpuBufferFormat
 	{
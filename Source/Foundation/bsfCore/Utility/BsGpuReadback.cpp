@@ -0,0 +1,166 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsGpuReadback.h"
+#include "Image/BsTexture.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	GpuReadback::~GpuReadback()
+	{
+		// Drop any readbacks still waiting on the core thread, so their closures don't outlive the module
+		gCoreThread().queueCommand([this]() { mPending.clear(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void GpuReadback::readTexture(const SPtr<Texture>& texture, TextureReadbackCallback callback, UINT32 face,
+		UINT32 mipLevel)
+	{
+		const TextureProperties& props = texture->getProperties();
+
+		UINT32 width = props.getWidth();
+		UINT32 height = props.getHeight();
+		UINT32 depth = props.getDepth();
+
+		for (UINT32 i = 0; i < mipLevel; i++)
+		{
+			if (width != 1) width /= 2;
+			if (height != 1) height /= 2;
+			if (depth != 1) depth /= 2;
+		}
+
+		SPtr<PixelData> pixelData = allocPixelData(width, height, depth, props.getFormat());
+		pixelData->_lock();
+
+		SPtr<InFlightReadback> entry = bs_shared_ptr_new<InFlightReadback>();
+		entry->pixelData = pixelData;
+		entry->textureCallback = std::move(callback);
+
+		mInFlight.push_back(entry);
+
+		SPtr<ct::Texture> textureCore = texture->getCore();
+		UINT32 frameLatency = mFrameLatency;
+		gCoreThread().queueCommand([this, textureCore, pixelData, entry, face, mipLevel, frameLatency]()
+		{
+			auto execute = [textureCore, pixelData, entry, face, mipLevel]()
+			{
+				textureCore->readData(*pixelData, mipLevel, face);
+				pixelData->_unlock();
+				entry->ready.store(true, std::memory_order_release);
+			};
+
+			mPending.push_back({ frameLatency, std::move(execute) });
+		});
+	}
+
+	void GpuReadback::readBuffer(const SPtr<GpuBuffer>& buffer, BufferReadbackCallback callback)
+	{
+		const GpuBufferProperties& props = buffer->getProperties();
+		UINT32 size = props.getElementCount() * props.getElementSize();
+
+		SPtr<MemoryDataStream> bufferData = allocBufferData(size);
+
+		SPtr<InFlightReadback> entry = bs_shared_ptr_new<InFlightReadback>();
+		entry->bufferData = bufferData;
+		entry->bufferCallback = std::move(callback);
+
+		mInFlight.push_back(entry);
+
+		SPtr<ct::GpuBuffer> bufferCore = buffer->getCore();
+		UINT32 frameLatency = mFrameLatency;
+		gCoreThread().queueCommand([this, bufferCore, bufferData, entry, size, frameLatency]()
+		{
+			auto execute = [bufferCore, bufferData, entry, size]()
+			{
+				bufferCore->readData(0, size, bufferData->getPtr());
+				entry->ready.store(true, std::memory_order_release);
+			};
+
+			mPending.push_back({ frameLatency, std::move(execute) });
+		});
+	}
+
+	void GpuReadback::_update()
+	{
+		// Age the readbacks waiting on the core thread and execute those that waited long enough. By that point the
+		// GPU has normally finished producing their data, so the read doesn't drain the pipeline.
+		gCoreThread().queueCommand([this]()
+		{
+			for (auto iter = mPending.begin(); iter != mPending.end();)
+			{
+				if (iter->framesLeft == 0)
+				{
+					iter->execute();
+					iter = mPending.erase(iter);
+				}
+				else
+				{
+					iter->framesLeft--;
+					++iter;
+				}
+			}
+		});
+
+		// Deliver results that became available
+		for (auto iter = mInFlight.begin(); iter != mInFlight.end();)
+		{
+			SPtr<InFlightReadback>& entry = *iter;
+			if (entry->ready.load(std::memory_order_acquire))
+			{
+				if (entry->textureCallback != nullptr)
+					entry->textureCallback(entry->pixelData);
+				else if (entry->bufferCallback != nullptr)
+					entry->bufferCallback(entry->bufferData);
+
+				iter = mInFlight.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	SPtr<PixelData> GpuReadback::allocPixelData(UINT32 width, UINT32 height, UINT32 depth, PixelFormat format)
+	{
+		for (auto& entry : mPixelDataPool)
+		{
+			// Only the pool references it, meaning the previous consumer is done with the data
+			if (entry.use_count() != 1)
+				continue;
+
+			if (entry->getWidth() == width && entry->getHeight() == height && entry->getDepth() == depth &&
+				entry->getFormat() == format)
+			{
+				return entry;
+			}
+		}
+
+		SPtr<PixelData> newEntry = bs_shared_ptr_new<PixelData>(width, height, depth, format);
+		newEntry->allocateInternalBuffer();
+
+		mPixelDataPool.push_back(newEntry);
+		return newEntry;
+	}
+
+	SPtr<MemoryDataStream> GpuReadback::allocBufferData(UINT32 size)
+	{
+		for (auto& entry : mBufferDataPool)
+		{
+			if (entry.use_count() != 1)
+				continue;
+
+			if (entry->size() == size)
+				return entry;
+		}
+
+		SPtr<MemoryDataStream> newEntry = bs_shared_ptr_new<MemoryDataStream>((size_t)size);
+
+		mBufferDataPool.push_back(newEntry);
+		return newEntry;
+	}
+
+	GpuReadback& gGpuReadback()
+	{
+		return GpuReadback::instance();
+	}
+}
@@ -0,0 +1,119 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Image/BsPixelData.h"
+#include "FileSystem/BsDataStream.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Utility-Core
+	 *  @{
+	 */
+
+	/**
+	 * Provides asynchronous readback of GPU resource contents to the CPU, intended for repeated captures (screenshots,
+	 * depth or analytics readbacks) that shouldn't hitch the frame.
+	 *
+	 * Unlike Texture::readData(), which performs the read as soon as the core thread gets to it and therefore stalls
+	 * until the GPU has produced the data, readbacks queued here are executed a set number of frames after they were
+	 * requested (see setFrameLatency()). By then the GPU has long finished the work that produced the data, so mapping
+	 * it no longer drains the pipeline. Destination memory comes from an internal pool of persistent staging buffers,
+	 * avoiding a fresh allocation per capture. The result handed to the callback aliases that pooled memory - no copy
+	 * is made on the CPU side - and the buffer is recycled once the caller releases the last reference to it.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT GpuReadback : public Module<GpuReadback>
+	{
+	public:
+		/** Callback used for delivering texture readback results. */
+		typedef std::function<void(const SPtr<PixelData>&)> TextureReadbackCallback;
+
+		/** Callback used for delivering buffer readback results. */
+		typedef std::function<void(const SPtr<MemoryDataStream>&)> BufferReadbackCallback;
+
+		GpuReadback() = default;
+		~GpuReadback();
+
+		/**
+		 * Queues an asynchronous readback of a texture subresource. The copy is enqueued to the core thread during the
+		 * current frame, and the callback is invoked on the sim thread roughly getFrameLatency() frames later, during
+		 * _update().
+		 *
+		 * @param[in]	texture		Texture to read from.
+		 * @param[in]	callback	Callback receiving the read pixel data. The data aliases pooled staging memory -
+		 *							hold on to the pointer for as long as the data is needed, and release it to return
+		 *							the memory to the pool.
+		 * @param[in]	face		Texture face to read from.
+		 * @param[in]	mipLevel	Mipmap level to read from.
+		 */
+		void readTexture(const SPtr<Texture>& texture, TextureReadbackCallback callback, UINT32 face = 0,
+			UINT32 mipLevel = 0);
+
+		/**
+		 * Queues an asynchronous readback of the entire contents of a GPU buffer. Behaves like readTexture(), with the
+		 * result delivered as a memory stream aliasing pooled staging memory.
+		 *
+		 * @param[in]	buffer		Buffer to read from.
+		 * @param[in]	callback	Callback receiving the read data.
+		 */
+		void readBuffer(const SPtr<GpuBuffer>& buffer, BufferReadbackCallback callback);
+
+		/**
+		 * Determines how many frames after a readback request the actual GPU read is performed. Higher values make the
+		 * read cheaper (the GPU is less likely to still be producing the data), lower values deliver results sooner.
+		 * Clamped to at least one frame. Changes apply to readbacks requested after the call.
+		 */
+		void setFrameLatency(UINT32 numFrames) { mFrameLatency = std::max(numFrames, 1U); }
+
+		/** @copydoc setFrameLatency() */
+		UINT32 getFrameLatency() const { return mFrameLatency; }
+
+		/**
+		 * Advances pending readbacks and delivers completed results through their callbacks. Called once per frame by
+		 * the main loop.
+		 */
+		void _update();
+
+	private:
+		/** A requested readback whose result hasn't been delivered to its callback yet. */
+		struct InFlightReadback
+		{
+			SPtr<PixelData> pixelData; /**< Destination for texture readbacks, null otherwise. */
+			SPtr<MemoryDataStream> bufferData; /**< Destination for buffer readbacks, null otherwise. */
+			TextureReadbackCallback textureCallback;
+			BufferReadbackCallback bufferCallback;
+			std::atomic<bool> ready{false}; /**< Set by the core thread once the destination contains valid data. */
+		};
+
+		/** A readback waiting on the core thread for enough frames to pass before it executes. */
+		struct PendingExecution
+		{
+			UINT32 framesLeft;
+			std::function<void()> execute;
+		};
+
+		/** Retrieves a pooled pixel buffer of the specified dimensions and format, allocating one if none are free. */
+		SPtr<PixelData> allocPixelData(UINT32 width, UINT32 height, UINT32 depth, PixelFormat format);
+
+		/** Retrieves a pooled memory stream of the specified size, allocating one if none are free. */
+		SPtr<MemoryDataStream> allocBufferData(UINT32 size);
+
+		UINT32 mFrameLatency = 2;
+
+		Vector<SPtr<InFlightReadback>> mInFlight; // Sim thread only
+		Vector<PendingExecution> mPending; // Core thread only
+
+		Vector<SPtr<PixelData>> mPixelDataPool; // Sim thread only
+		Vector<SPtr<MemoryDataStream>> mBufferDataPool; // Sim thread only
+	};
+
+	/** Provides easier access to GpuReadback. */
+	BS_CORE_EXPORT GpuReadback& gGpuReadback();
+
+	/** @} */
+}
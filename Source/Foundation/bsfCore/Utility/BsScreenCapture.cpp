@@ -0,0 +1,160 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsScreenCapture.h"
+#include "Utility/BsGpuReadback.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+#include "RenderAPI/BsRenderTexture.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Utility/BsTime.h"
+
+namespace bs
+{
+	void ScreenCapture::startCapture(const HTexture& source, CaptureCallback callback, const SCREEN_CAPTURE_DESC& desc)
+	{
+		stopCapture();
+
+		mSource = source;
+		mCallback = std::move(callback);
+		mDesc = desc;
+		mDesc.frameInterval = std::max(mDesc.frameInterval, 1U);
+		mDesc.numPoolSurfaces = std::max(mDesc.numPoolSurfaces, 1U);
+
+		// First _update() call captures immediately
+		mFramesSinceCapture = mDesc.frameInterval;
+	}
+
+	void ScreenCapture::startCapture(const SPtr<RenderTexture>& source, CaptureCallback callback,
+		const SCREEN_CAPTURE_DESC& desc)
+	{
+		startCapture(source->getColorTexture(0), std::move(callback), desc);
+	}
+
+	void ScreenCapture::stopCapture()
+	{
+		mSource = nullptr;
+		mCallback = nullptr;
+
+		// In-flight entries keep their pool surfaces alive through the readback closures
+		mPool.clear();
+	}
+
+	void ScreenCapture::_update()
+	{
+		if (mSource == nullptr || !mSource.isLoaded(false))
+			return;
+
+		mFramesSinceCapture++;
+		if (mFramesSinceCapture < mDesc.frameInterval)
+			return;
+
+		// All pool surfaces waiting on readback, drop the frame rather than stall
+		SPtr<PoolSurface> slot = allocPoolSurface();
+		if (slot == nullptr)
+			return;
+
+		mFramesSinceCapture = 0;
+		slot->free = false;
+
+		// Snapshot the source on the GPU, so it can keep being re-rendered while the readback is in flight
+		SPtr<ct::Texture> srcCore = mSource->getCore();
+		SPtr<ct::Texture> dstCore = slot->texture->getCore();
+		gCoreThread().queueCommand([srcCore, dstCore]() { srcCore->copy(dstCore); });
+
+		UINT64 frameIdx = gTime().getFrameIdx();
+		float timestamp = gTime().getTime();
+		bool compress = mDesc.compress;
+		CaptureCallback callback = mCallback;
+
+		gGpuReadback().readTexture(slot->texture.getInternalPtr(),
+			[slot, callback, frameIdx, timestamp, compress](const SPtr<PixelData>& pixels)
+		{
+			// Pixels have been copied off the pool surface, so it can receive the next capture
+			slot->free = true;
+
+			if (compress)
+			{
+				SPtr<Task> task = Task::create("CaptureEncode", [pixels, callback, frameIdx, timestamp]()
+				{
+					SPtr<PixelData> compressed = bs_shared_ptr_new<PixelData>(
+						pixels->getWidth(), pixels->getHeight(), 1, PF_BC1);
+					compressed->allocateInternalBuffer();
+
+					CompressionOptions options;
+					options.format = PF_BC1;
+					PixelUtil::compress(*pixels, *compressed, options);
+
+					CapturedFrame frame;
+					frame.pixels = compressed;
+					frame.frameIdx = frameIdx;
+					frame.timestamp = timestamp;
+
+					callback(frame);
+				});
+
+				TaskScheduler::instance().addTask(task);
+			}
+			else
+			{
+				CapturedFrame frame;
+				frame.pixels = pixels;
+				frame.frameIdx = frameIdx;
+				frame.timestamp = timestamp;
+
+				callback(frame);
+			}
+		});
+	}
+
+	SPtr<ScreenCapture::PoolSurface> ScreenCapture::allocPoolSurface()
+	{
+		const TextureProperties& srcProps = mSource->getProperties();
+
+		SPtr<PoolSurface> freeSlot;
+		for (auto& entry : mPool)
+		{
+			if (!entry->free)
+				continue;
+
+			const TextureProperties& props = entry->texture->getProperties();
+			if (props.getWidth() != srcProps.getWidth() || props.getHeight() != srcProps.getHeight() ||
+				props.getFormat() != srcProps.getFormat())
+			{
+				// Source was resized or changed format, surface gets recreated below
+				entry->texture = nullptr;
+			}
+
+			freeSlot = entry;
+			break;
+		}
+
+		if (freeSlot == nullptr)
+		{
+			if ((UINT32)mPool.size() >= mDesc.numPoolSurfaces)
+				return nullptr;
+
+			freeSlot = bs_shared_ptr_new<PoolSurface>();
+			mPool.push_back(freeSlot);
+		}
+
+		if (freeSlot->texture == nullptr)
+		{
+			TEXTURE_DESC desc;
+			desc.type = TEX_TYPE_2D;
+			desc.width = srcProps.getWidth();
+			desc.height = srcProps.getHeight();
+			desc.format = srcProps.getFormat();
+			desc.usage = TU_CPUREADABLE;
+
+			freeSlot->texture = Texture::create(desc);
+		}
+
+		return freeSlot;
+	}
+
+	ScreenCapture& gScreenCapture()
+	{
+		return ScreenCapture::instance();
+	}
+}
@@ -0,0 +1,121 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Image/BsPixelData.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Core
+	 *  @{
+	 */
+
+	/** Options controlling a continuous capture started through ScreenCapture::startCapture(). */
+	struct SCREEN_CAPTURE_DESC
+	{
+		/** Capture every Nth rendered frame. 1 (the default) captures every frame. */
+		UINT32 frameInterval = 1;
+
+		/**
+		 * If enabled, captured frames are compressed to BC1 on worker threads before delivery, cutting the delivered
+		 * data to a fraction of the raw size. Note this causes the capture callback to be invoked from a worker thread
+		 * rather than the sim thread.
+		 */
+		bool compress = false;
+
+		/**
+		 * Number of textures in the rotating pool the source is copied into on the GPU. Determines how many captures
+		 * may be in flight at once - if all entries are waiting on readback, new frames are dropped rather than
+		 * stalling. Should generally exceed GpuReadback::getFrameLatency().
+		 */
+		UINT32 numPoolSurfaces = 4;
+	};
+
+	/** A single frame delivered by ScreenCapture. */
+	struct CapturedFrame
+	{
+		/** Captured pixels, in the source format or BC1 if compression was enabled. */
+		SPtr<PixelData> pixels;
+
+		/** Index of the frame the capture was taken on, as reported by Time::getFrameIdx(). */
+		UINT64 frameIdx = 0;
+
+		/** Time the capture was taken at, in seconds since application start. */
+		float timestamp = 0.0f;
+	};
+
+	/**
+	 * Provides continuous capture of rendered output without stalling the pipeline, intended for screenshot, video and
+	 * telemetry-replay recording during live gameplay.
+	 *
+	 * Each captured frame is first copied on the GPU into a rotating pool of textures, so the source can keep being
+	 * re-rendered while the capture is in flight. The pooled copy is then read back asynchronously through GpuReadback,
+	 * meaning frames arrive a few frames late (see GpuReadback::setFrameLatency()) but the readback itself never drains
+	 * the pipeline. If compression is enabled the delivered frames are additionally BC1-encoded on task scheduler
+	 * workers, off the critical path.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT ScreenCapture : public Module<ScreenCapture>
+	{
+	public:
+		/** Callback used for delivering captured frames. */
+		typedef std::function<void(const CapturedFrame&)> CaptureCallback;
+
+		ScreenCapture() = default;
+
+		/**
+		 * Starts a continuous capture of the provided texture, which is expected to be re-rendered every frame (e.g.
+		 * the color texture of a render target a camera outputs to). Replaces any capture already in progress.
+		 *
+		 * @param[in]	source		Texture to capture. Must be loaded for frames to be captured.
+		 * @param[in]	callback	Callback invoked once for every delivered frame. Invoked on the sim thread, unless
+		 *							compression is enabled in which case it is invoked from a worker thread. The pixel
+		 *							data remains valid for as long as the caller holds a reference to it.
+		 * @param[in]	desc		Optional settings controlling frame rate, compression and pooling.
+		 */
+		void startCapture(const HTexture& source, CaptureCallback callback,
+			const SCREEN_CAPTURE_DESC& desc = SCREEN_CAPTURE_DESC());
+
+		/** @copydoc startCapture() */
+		void startCapture(const SPtr<RenderTexture>& source, CaptureCallback callback,
+			const SCREEN_CAPTURE_DESC& desc = SCREEN_CAPTURE_DESC());
+
+		/** Stops the capture in progress, if any. Frames already in flight are still delivered. */
+		void stopCapture();
+
+		/** Checks if a capture is currently in progress. */
+		bool isCapturing() const { return mSource != nullptr; }
+
+		/**
+		 * Captures a frame if one is due and delivers any that completed. Called once per frame by the main loop,
+		 * after the frame's rendering has been queued.
+		 */
+		void _update();
+
+	private:
+		/** A pooled texture the source is copied into on the GPU while its readback is in flight. */
+		struct PoolSurface
+		{
+			HTexture texture;
+			bool free = true;
+		};
+
+		/** Returns a free pool surface matching the source dimensions, or null if all are waiting on readback. */
+		SPtr<PoolSurface> allocPoolSurface();
+
+		HTexture mSource;
+		CaptureCallback mCallback;
+		SCREEN_CAPTURE_DESC mDesc;
+
+		Vector<SPtr<PoolSurface>> mPool;
+		UINT32 mFramesSinceCapture = 0;
+	};
+
+	/** Provides easier access to ScreenCapture. */
+	BS_CORE_EXPORT ScreenCapture& gScreenCapture();
+
+	/** @} */
+}
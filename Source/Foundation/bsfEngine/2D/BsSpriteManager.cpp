@@ -2,20 +2,42 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "2D/BsSpriteManager.h"
 #include "2D/BsSpriteMaterials.h"
+#include "String/BsUnicode.h"
+#include "Utility/BsUtil.h"
 
 namespace bs
 {
+	const UINT32 SpriteManager::MAX_CACHED_TEXT_LAYOUTS = 512;
+
+	size_t SpriteManager::TextLayoutKeyHash::operator()(const TextLayoutKey& key) const
+	{
+		Resource* fontPtr = key.font.getHandleData() != nullptr ? key.font.getHandleData()->mPtr.get() : nullptr;
+
+		size_t seed = 0;
+		bs::hash_combine(seed, key.text);
+		bs::hash_combine(seed, fontPtr);
+		bs::hash_combine(seed, key.fontSize);
+		bs::hash_combine(seed, key.width);
+		bs::hash_combine(seed, key.height);
+		bs::hash_combine(seed, key.wordWrap);
+		bs::hash_combine(seed, key.wordBreak);
+
+		return seed;
+	}
+
 	SpriteManager::SpriteManager()
 	{
 		SpriteMaterial* imageTransparentMat = registerMaterial<SpriteImageTransparentMaterial>();
 		SpriteMaterial* imageOpaqueMat = registerMaterial<SpriteImageOpaqueMaterial>();
 		SpriteMaterial* textMat = registerMaterial<SpriteTextMaterial>();
 		SpriteMaterial* lineMat = registerMaterial<SpriteLineMaterial>();
+		SpriteMaterial* textSDFMat = registerMaterial<SpriteTextSDFMaterial>();
 
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageTransparent] = imageTransparentMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::ImageOpaque] = imageOpaqueMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text] = textMat->getId();
 		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Line] = lineMat->getId();
+		builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::TextSDF] = textSDFMat->getId();
 	}
 
 	SpriteManager::~SpriteManager()
@@ -32,4 +54,38 @@ namespace bs
 
 		return nullptr;
 	}
+
+	SPtr<TextData<GenAlloc>> SpriteManager::getTextLayout(const TEXT_SPRITE_DESC& desc)
+	{
+		TextLayoutKey key = { desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap,
+			desc.wordBreak };
+
+		auto iterFind = mTextLayouts.find(key);
+		if (iterFind != mTextLayouts.end())
+		{
+			// Move the entry to the front of the LRU list
+			mTextLayoutLRU.splice(mTextLayoutLRU.begin(), mTextLayoutLRU, iterFind->second.lruPos);
+			return iterFind->second.textData;
+		}
+
+		const U32String utf32text = UTF8::toUTF32(desc.text);
+		SPtr<TextData<GenAlloc>> textData = bs_shared_ptr_new<TextData<GenAlloc>>(utf32text, desc.font, desc.fontSize,
+			desc.width, desc.height, desc.wordWrap, desc.wordBreak);
+
+		mTextLayoutLRU.push_front(key);
+
+		TextLayoutEntry entry;
+		entry.textData = textData;
+		entry.lruPos = mTextLayoutLRU.begin();
+
+		mTextLayouts[key] = entry;
+
+		while ((UINT32)mTextLayouts.size() > MAX_CACHED_TEXT_LAYOUTS)
+		{
+			mTextLayouts.erase(mTextLayoutLRU.back());
+			mTextLayoutLRU.pop_back();
+		}
+
+		return textData;
+	}
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "BsPrerequisites.h"
 #include "Utility/BsModule.h"
 #include "2D/BsSpriteMaterial.h"
+#include "2D/BsTextSprite.h"
+#include "Text/BsTextData.h"
 
 namespace bs
 {
@@ -22,6 +24,7 @@ namespace bs
 			ImageOpaque,
 			Text,
 			Line,
+			TextSDF,
 			Count // Keep at end
 		};
 
@@ -41,6 +44,10 @@ namespace bs
 		SpriteMaterial* getTextMaterial() const
 			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Text]); }
 
+		/** Returns the material used for rendering text sprites that use a signed distance field font. */
+		SpriteMaterial* getTextSDFMaterial() const
+			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::TextSDF]); }
+
 		/** Returns the material used for rendering antialiased lines. */
 		SpriteMaterial* getLineMaterial() const
 			{ return getMaterial(builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Line]); }
@@ -48,6 +55,13 @@ namespace bs
 		/** Returns a sprite material with the specified ID. Returns null if one cannot be found. */
 		SpriteMaterial* getMaterial(UINT32 id) const;
 
+		/**
+		 * Returns layout information (glyphs, word wrapping, lines) for the text described by the provided descriptor.
+		 * Layouts are cached, so repeated requests for the same text, font and bounds skip glyph lookup and word
+		 * wrapping entirely. Least recently used layouts are evicted once the cache grows past a fixed size.
+		 */
+		SPtr<TextData<GenAlloc>> getTextLayout(const TEXT_SPRITE_DESC& desc);
+
 		/** 
 		 * Registers a new material in the sprite manager. Caller must ensure the material has a unique ID that doesn't
 		 * already exist in the sprite manager, otherwise the call will be ignored.
@@ -73,8 +87,45 @@ namespace bs
 			return newMaterial;
 		}
 	private:
+		/** Uniquely identifies a cached text layout. */
+		struct TextLayoutKey
+		{
+			String text;
+			HFont font;
+			UINT32 fontSize;
+			UINT32 width;
+			UINT32 height;
+			bool wordWrap;
+			bool wordBreak;
+
+			bool operator==(const TextLayoutKey& other) const
+			{
+				return fontSize == other.fontSize && width == other.width && height == other.height &&
+					wordWrap == other.wordWrap && wordBreak == other.wordBreak && font == other.font &&
+					text == other.text;
+			}
+		};
+
+		/** Generates a hash value for a text layout key. */
+		struct TextLayoutKeyHash
+		{
+			size_t operator()(const TextLayoutKey& key) const;
+		};
+
+		/** Single entry of the text layout cache. */
+		struct TextLayoutEntry
+		{
+			SPtr<TextData<GenAlloc>> textData;
+			List<TextLayoutKey>::iterator lruPos;
+		};
+
 		UnorderedMap<UINT32, SpriteMaterial*> mMaterials;
 		UINT32 builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Count];
+
+		UnorderedMap<TextLayoutKey, TextLayoutEntry, TextLayoutKeyHash> mTextLayouts;
+		List<TextLayoutKey> mTextLayoutLRU;
+
+		static const UINT32 MAX_CACHED_TEXT_LAYOUTS;
 	};
 
 	/** @} */
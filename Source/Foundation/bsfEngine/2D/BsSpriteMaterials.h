@@ -32,6 +32,13 @@ namespace bs
 		SpriteTextMaterial();
 	};
 
+	/** Sprite material used for rendering text from a signed distance field font. */
+	class BS_EXPORT SpriteTextSDFMaterial : public SpriteMaterial
+	{
+	public:
+		SpriteTextSDFMaterial();
+	};
+
 	/** Sprite material used for antialiased lines. */
 	class BS_EXPORT SpriteLineMaterial : public SpriteMaterial
 	{
@@ -0,0 +1,225 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "2D/BsSpriteTextureAtlasManager.h"
+#include "2D/BsSpriteTexture.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
+#include "Image/BsColor.h"
+#include "CoreThread/BsCoreThread.h"
+
+namespace bs
+{
+	HSpriteTexture SpriteTextureAtlasManager::getAtlased(const HTexture& texture)
+	{
+		// Can't evaluate eligibility until the texture is loaded, return a plain non-atlased wrapper
+		if (!texture.isLoaded(false))
+			return SpriteTexture::create(texture);
+
+		auto iterFind = mElements.find(texture.getUUID());
+		if (iterFind != mElements.end())
+			return iterFind->second.sprite;
+
+		AtlasElement element;
+		element.source = texture;
+
+		if (!isEligible(texture))
+		{
+			// Cache the wrapper, but don't assign it to a page
+			element.sprite = SpriteTexture::create(texture);
+			mElements[texture.getUUID()] = element;
+
+			return element.sprite;
+		}
+
+		const TextureProperties& props = texture->getProperties();
+		element.width = props.getWidth();
+		element.height = props.getHeight();
+
+		UINT32 paddedWidth = element.width + ELEMENT_PADDING * 2;
+		UINT32 paddedHeight = element.height + ELEMENT_PADDING * 2;
+
+		// Find an existing page with a matching format that has room for the element
+		UINT32 x = 0;
+		UINT32 y = 0;
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			AtlasPage& page = mPages[i];
+			if (page.format != props.getFormat())
+				continue;
+
+			if (page.layout.addElement(paddedWidth, paddedHeight, x, y))
+			{
+				element.pageIdx = i;
+				break;
+			}
+		}
+
+		if (element.pageIdx == (UINT32)-1)
+		{
+			TEXTURE_DESC pageDesc;
+			pageDesc.type = TEX_TYPE_2D;
+			pageDesc.width = PAGE_SIZE;
+			pageDesc.height = PAGE_SIZE;
+			pageDesc.format = props.getFormat();
+
+			AtlasPage page;
+			page.texture = Texture::create(pageDesc);
+			page.layout = TextureAtlasLayout(PAGE_SIZE, PAGE_SIZE, PAGE_SIZE, PAGE_SIZE);
+			page.format = props.getFormat();
+
+			// Clear the page so element padding reads as transparent black rather than uninitialized memory
+			SPtr<ct::Texture> corePage = page.texture->getCore();
+			gCoreThread().queueCommand([corePage]() { corePage->clear(Color::ZERO); });
+
+			page.layout.addElement(paddedWidth, paddedHeight, x, y);
+
+			element.pageIdx = (UINT32)mPages.size();
+			mPages.push_back(page);
+		}
+
+		element.x = x + ELEMENT_PADDING;
+		element.y = y + ELEMENT_PADDING;
+
+		AtlasPage& page = mPages[element.pageIdx];
+		copyToPage(element, page.texture);
+
+		constexpr float invSize = 1.0f / PAGE_SIZE;
+		element.sprite = SpriteTexture::create(
+			Vector2(element.x * invSize, element.y * invSize),
+			Vector2(element.width * invSize, element.height * invSize),
+			page.texture);
+
+		page.usedArea += paddedWidth * paddedHeight;
+		mElements[texture.getUUID()] = element;
+
+		return element.sprite;
+	}
+
+	void SpriteTextureAtlasManager::remove(const HTexture& texture)
+	{
+		auto iterFind = mElements.find(texture.getUUID());
+		if (iterFind == mElements.end())
+			return;
+
+		const AtlasElement& element = iterFind->second;
+		if (element.pageIdx != (UINT32)-1)
+		{
+			AtlasPage& page = mPages[element.pageIdx];
+
+			UINT32 paddedArea = (element.width + ELEMENT_PADDING * 2) * (element.height + ELEMENT_PADDING * 2);
+			page.usedArea -= paddedArea;
+			page.freedArea += paddedArea;
+		}
+
+		mElements.erase(iterFind);
+	}
+
+	void SpriteTextureAtlasManager::_update()
+	{
+		constexpr float pageArea = (float)(PAGE_SIZE * PAGE_SIZE);
+
+		// Repack at most one page per call to keep the per-frame cost bounded
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			if (mPages[i].freedArea / pageArea >= DEFRAG_THRESHOLD)
+			{
+				repackPage(i);
+				break;
+			}
+		}
+	}
+
+	bool SpriteTextureAtlasManager::isEligible(const HTexture& texture)
+	{
+		const TextureProperties& props = texture->getProperties();
+		if (props.getTextureType() != TEX_TYPE_2D || props.getNumSamples() > 1 || props.getNumArraySlices() > 1)
+			return false;
+
+		if (props.getWidth() > MAX_ELEMENT_SIZE || props.getHeight() > MAX_ELEMENT_SIZE)
+			return false;
+
+		// Block compressed formats can't be copied to arbitrary positions within a page
+		if (PixelUtil::isCompressed(props.getFormat()))
+			return false;
+
+		// GPU writable textures can change after packing, and the atlas copy wouldn't pick the changes up
+		if ((props.getUsage() & (TU_RENDERTARGET | TU_DEPTHSTENCIL | TU_LOADSTORE | TU_DYNAMIC)) != 0)
+			return false;
+
+		return true;
+	}
+
+	void SpriteTextureAtlasManager::copyToPage(const AtlasElement& element, const HTexture& page)
+	{
+		TEXTURE_COPY_DESC copyDesc;
+		copyDesc.srcVolume = PixelVolume(0, 0, element.width, element.height);
+		copyDesc.dstPosition = Vector3I(element.x, element.y, 0);
+
+		SPtr<ct::Texture> coreSource = element.source->getCore();
+		SPtr<ct::Texture> corePage = page->getCore();
+
+		gCoreThread().queueCommand([coreSource, corePage, copyDesc]() { coreSource->copy(corePage, copyDesc); });
+	}
+
+	void SpriteTextureAtlasManager::repackPage(UINT32 pageIdx)
+	{
+		AtlasPage& page = mPages[pageIdx];
+
+		// Gather live elements, largest first so the new layout stays close to optimal
+		Vector<AtlasElement*> liveElements;
+		for (auto& entry : mElements)
+		{
+			if (entry.second.pageIdx == pageIdx)
+				liveElements.push_back(&entry.second);
+		}
+
+		std::sort(liveElements.begin(), liveElements.end(),
+			[](const AtlasElement* lhs, const AtlasElement* rhs)
+		{
+			return lhs->width * lhs->height > rhs->width * rhs->height;
+		});
+
+		TEXTURE_DESC pageDesc;
+		pageDesc.type = TEX_TYPE_2D;
+		pageDesc.width = PAGE_SIZE;
+		pageDesc.height = PAGE_SIZE;
+		pageDesc.format = page.format;
+
+		HTexture newTexture = Texture::create(pageDesc);
+		TextureAtlasLayout newLayout(PAGE_SIZE, PAGE_SIZE, PAGE_SIZE, PAGE_SIZE);
+
+		SPtr<ct::Texture> corePage = newTexture->getCore();
+		gCoreThread().queueCommand([corePage]() { corePage->clear(Color::ZERO); });
+
+		constexpr float invSize = 1.0f / PAGE_SIZE;
+
+		UINT32 usedArea = 0;
+		for (auto& element : liveElements)
+		{
+			UINT32 paddedWidth = element->width + ELEMENT_PADDING * 2;
+			UINT32 paddedHeight = element->height + ELEMENT_PADDING * 2;
+
+			// Cannot fail since the live set is a subset of the elements the old layout held
+			UINT32 x = 0;
+			UINT32 y = 0;
+			newLayout.addElement(paddedWidth, paddedHeight, x, y);
+
+			element->x = x + ELEMENT_PADDING;
+			element->y = y + ELEMENT_PADDING;
+
+			copyToPage(*element, newTexture);
+
+			// Redirect the existing sprite texture to the new page, so external references pick up the new layout
+			element->sprite->setTexture(newTexture);
+			element->sprite->setOffset(Vector2(element->x * invSize, element->y * invSize));
+			element->sprite->setScale(Vector2(element->width * invSize, element->height * invSize));
+
+			usedArea += paddedWidth * paddedHeight;
+		}
+
+		page.texture = newTexture;
+		page.layout = newLayout;
+		page.usedArea = usedArea;
+		page.freedArea = 0;
+	}
+}
@@ -0,0 +1,98 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Image/BsTextureAtlasLayout.h"
+#include "Image/BsPixelData.h"
+
+namespace bs
+{
+	/** @addtogroup 2D-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Runtime texture atlas that packs small, frequently co-bound textures (GUI icons, decals, particle flipbooks) into
+	 * shared atlas pages. Elements with the same pixel format share a page, and the returned SpriteTexture encodes the
+	 * UV remap into that page. Since sprite batching merges draws by underlying texture, all elements packed onto the
+	 * same page render as a single batch.
+	 */
+	class BS_EXPORT SpriteTextureAtlasManager : public Module<SpriteTextureAtlasManager>
+	{
+	public:
+		/**
+		 * Returns a sprite texture that addresses the provided texture through a shared atlas page, packing the texture
+		 * into an atlas on first request. Repeated requests for the same texture return the same sprite texture.
+		 * Textures that aren't eligible for atlasing (too large, compressed, GPU writable, not 2D) are returned wrapped
+		 * in a plain non-atlased sprite texture instead.
+		 */
+		HSpriteTexture getAtlased(const HTexture& texture);
+
+		/**
+		 * Releases the atlas region held by a texture previously registered through getAtlased(). The region's memory
+		 * is reclaimed by a future defragmentation pass. Caller must ensure the sprite texture returned by getAtlased()
+		 * is no longer in use.
+		 */
+		void remove(const HTexture& texture);
+
+		/**
+		 * Performs incremental atlas maintenance. Repacks at most one fragmented page per call so the cost stays
+		 * bounded, making it safe to run every frame. Called automatically by Application.
+		 */
+		void _update();
+
+	private:
+		/**	A single texture packed into an atlas page. */
+		struct AtlasElement
+		{
+			HTexture source;
+			HSpriteTexture sprite;
+			UINT32 x = 0;
+			UINT32 y = 0;
+			UINT32 width = 0;
+			UINT32 height = 0;
+			UINT32 pageIdx = (UINT32)-1;
+		};
+
+		/**	A single shared atlas page texture. */
+		struct AtlasPage
+		{
+			HTexture texture;
+			TextureAtlasLayout layout;
+			PixelFormat format = PF_UNKNOWN;
+			UINT32 usedArea = 0;
+			UINT32 freedArea = 0;
+		};
+
+		/**	Checks is the texture suitable for placement in an atlas page. */
+		static bool isEligible(const HTexture& texture);
+
+		/**	Queues a core thread copy of the source element pixels into its assigned region of the page texture. */
+		static void copyToPage(const AtlasElement& element, const HTexture& page);
+
+		/**
+		 * Re-packs all live elements of the specified page into a fresh page texture, reclaiming regions freed through
+		 * remove(). Existing sprite textures are redirected to the new page, so external references stay valid.
+		 */
+		void repackPage(UINT32 pageIdx);
+
+		Vector<AtlasPage> mPages;
+		UnorderedMap<UUID, AtlasElement> mElements;
+
+		/** Width & height of an atlas page, in pixels. */
+		static constexpr UINT32 PAGE_SIZE = 1024;
+
+		/** Maximum width & height of a texture eligible for atlasing, in pixels. */
+		static constexpr UINT32 MAX_ELEMENT_SIZE = 128;
+
+		/** Empty border around each element that prevents filtering from bleeding in neighboring elements. */
+		static constexpr UINT32 ELEMENT_PADDING = 1;
+
+		/** Fraction of a page's area that must be freed before the page is considered for defragmentation. */
+		static constexpr float DEFRAG_THRESHOLD = 0.25f;
+	};
+
+	/** @} */
+}
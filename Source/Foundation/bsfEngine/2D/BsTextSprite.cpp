@@ -4,7 +4,6 @@
 #include "Text/BsTextData.h"
 #include "Math/BsVector2.h"
 #include "2D/BsSpriteManager.h"
-#include "String/BsUnicode.h"
 
 namespace bs
 {
@@ -20,14 +19,19 @@ namespace bs
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
-		bs_frame_mark();
 		{
-			const U32String utf32text = UTF8::toUTF32(desc.text);
-			TextData<FrameAlloc> textData(utf32text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, 
-				desc.wordBreak);
+			// Layout (glyph lookup, word wrapping) is cached and shared between all sprites displaying the same text,
+			// so static text only pays for quad transform below
+			SPtr<TextData<GenAlloc>> textDataPtr = SpriteManager::instance().getTextLayout(desc);
+			const TextData<GenAlloc>& textData = *textDataPtr;
 
 			UINT32 numPages = textData.getNumPages();
 
+			// Distance field fonts need a material that reconstructs glyph edges from the distance field
+			SpriteMaterial* textMaterial = textData.isUsingSDF()
+				? SpriteManager::instance().getTextSDFMaterial()
+				: SpriteManager::instance().getTextMaterial();
+
 			// Free all previous memory
 			for (auto& cachedElem : mCachedRenderElements)
 			{
@@ -60,7 +64,7 @@ namespace bs
 				matInfo.texture = tex;
 				matInfo.tint = desc.color;
 
-				cachedElem.material = SpriteManager::instance().getTextMaterial();
+				cachedElem.material = textMaterial;
 
 				texPage++;
 			}
@@ -75,8 +79,6 @@ namespace bs
 			}
 		}
 
-		bs_frame_clear();
-
 		updateBounds();
 	}
 
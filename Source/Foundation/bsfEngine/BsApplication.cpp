@@ -3,6 +3,7 @@
 #include "BsApplication.h"
 #include "GUI/BsGUIManager.h"
 #include "2D/BsSpriteManager.h"
+#include "2D/BsSpriteTextureAtlasManager.h"
 #include "Resources/BsBuiltinResources.h"
 #include "Script/BsScriptManager.h"
 #include "Profiling/BsProfilingManager.h"
@@ -40,6 +41,7 @@ namespace bs
 		Cursor::shutDown();
 
 		GUIManager::shutDown();
+		SpriteTextureAtlasManager::shutDown();
 		SpriteManager::shutDown();
 		BuiltinResources::shutDown();
 		RendererMaterialManager::shutDown();
@@ -58,6 +60,7 @@ namespace bs
 		RendererMaterialManager::startUp();
 		RendererManager::instance().initialize();
 		SpriteManager::startUp();
+		SpriteTextureAtlasManager::startUp();
 		GUIManager::startUp();
 		ShortcutManager::startUp();
 
@@ -106,6 +109,7 @@ namespace bs
 	{
 		CoreApplication::postUpdate();
 
+		SpriteTextureAtlasManager::instance()._update();
 		PROFILE_CALL(GUIManager::instance().update(), "GUI");
 		DebugDraw::instance()._update();
 	}
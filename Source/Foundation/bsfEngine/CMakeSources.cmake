@@ -101,6 +101,7 @@ set(BS_ENGINE_SRC_2D
 	"bsfEngine/2D/BsSpriteMaterial.cpp"
 	"bsfEngine/2D/BsSpriteMaterials.cpp"
 	"bsfEngine/2D/BsSpriteManager.cpp"
+	"bsfEngine/2D/BsSpriteTextureAtlasManager.cpp"
 )
 
 set(BS_ENGINE_SRC_UTILITY
@@ -127,6 +128,7 @@ set(BS_ENGINE_INC_2D
 	"bsfEngine/2D/BsSpriteMaterial.h"
 	"bsfEngine/2D/BsSpriteMaterials.h"
 	"bsfEngine/2D/BsSpriteManager.h"
+	"bsfEngine/2D/BsSpriteTextureAtlasManager.h"
 )
 
 set(BS_ENGINE_INC_RTTI
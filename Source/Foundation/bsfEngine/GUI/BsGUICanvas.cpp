@@ -23,7 +23,7 @@ namespace bs
 
 	GUICanvas::GUICanvas(const String& styleName, const GUIDimensions& dimensions)
 		: GUIElement(styleName, dimensions), mNumRenderElements(0), mDepthRange(1), mLastOffset(BsZero)
-		, mForceTriangleBuild(false)
+		, mTrianglesDirty(false), mClippedVertexWaste(0), mLastSpriteGroupId(0)
 	{
 
 	}
@@ -43,15 +43,15 @@ namespace bs
 		return new (bs_alloc<GUICanvas>()) GUICanvas(getStyleName<GUICanvas>(styleName), GUIDimensions::create());
 	}
 
-	void GUICanvas::drawLine(const Vector2I& a, const Vector2I& b, const Color& color, UINT8 depth)
+	UINT32 GUICanvas::drawLine(const Vector2I& a, const Vector2I& b, const Color& color, UINT8 depth)
 	{
-		drawPolyLine({ a, b }, color, depth);
+		return drawPolyLine({ a, b }, color, depth);
 	}
 
-	void GUICanvas::drawPolyLine(const Vector<Vector2I>& vertices, const Color& color, UINT8 depth)
+	UINT32 GUICanvas::drawPolyLine(const Vector<Vector2I>& vertices, const Color& color, UINT8 depth)
 	{
 		if(vertices.size() < 2)
-			return;
+			return (UINT32)-1;
 
 		mElements.push_back(CanvasElement());
 		CanvasElement& element = mElements.back();
@@ -62,6 +62,9 @@ namespace bs
 		element.vertexStart = (UINT32)mVertexData.size();
 		element.numVertices = (UINT32)vertices.size();
 		element.depth = depth;
+		element.dirty = true;
+		element.clippedVertexStart = 0;
+		element.clippedNumVertices = 0;
 
 		mDepthRange = std::max(mDepthRange, (UINT8)(depth + 1));
 
@@ -78,11 +81,13 @@ namespace bs
 			mVertexData.push_back(point);
 		}
 
-		mForceTriangleBuild = true;
+		mTrianglesDirty = true;
 		_markContentAsDirty();
+
+		return (UINT32)(mElements.size() - 1);
 	}
 
-	void GUICanvas::drawTexture(const HSpriteTexture& texture, const Rect2I& area, TextureScaleMode scaleMode, 
+	UINT32 GUICanvas::drawTexture(const HSpriteTexture& texture, const Rect2I& area, TextureScaleMode scaleMode,
 		const Color& color, UINT8 depth)
 	{
 		mElements.push_back(CanvasElement());
@@ -94,19 +99,22 @@ namespace bs
 		element.scaleMode = scaleMode;
 		element.imageSprite = bs_new<ImageSprite>();
 		element.depth = depth;
+		element.dirty = true;
 
 		mDepthRange = std::max(mDepthRange, (UINT8)(depth + 1));
 
 		mImageData.push_back({ texture, area });
 		_markContentAsDirty();
+
+		return (UINT32)(mElements.size() - 1);
 	}
 
-	void GUICanvas::drawTriangleStrip(const Vector<Vector2I>& vertices, const Color& color, UINT8 depth)
+	UINT32 GUICanvas::drawTriangleStrip(const Vector<Vector2I>& vertices, const Color& color, UINT8 depth)
 	{
 		if (vertices.size() < 3)
 		{
 			LOGWRN("Invalid number of vertices. Ignoring call.");
-			return;
+			return (UINT32)-1;
 		}
 
 		mElements.push_back(CanvasElement());
@@ -118,6 +126,9 @@ namespace bs
 		element.vertexStart = (UINT32)mVertexData.size();
 		element.numVertices = (UINT32)(vertices.size() - 2) * 3;
 		element.depth = depth;
+		element.dirty = true;
+		element.clippedVertexStart = 0;
+		element.clippedNumVertices = 0;
 
 		mDepthRange = std::max(mDepthRange, (UINT8)(depth + 1));
 
@@ -143,16 +154,18 @@ namespace bs
 		elemData.matInfo.groupId = 0;
 		elemData.matInfo.tint = color;
 
-		mForceTriangleBuild = true;
+		mTrianglesDirty = true;
 		_markContentAsDirty();
+
+		return (UINT32)(mElements.size() - 1);
 	}
 
-	void GUICanvas::drawTriangleList(const Vector<Vector2I>& vertices, const Color& color, UINT8 depth)
+	UINT32 GUICanvas::drawTriangleList(const Vector<Vector2I>& vertices, const Color& color, UINT8 depth)
 	{
 		if (vertices.size() < 3 || vertices.size() % 3 != 0)
 		{
 			LOGWRN("Invalid number of vertices. Ignoring call.");
-			return;
+			return (UINT32)-1;
 		}
 
 		mElements.push_back(CanvasElement());
@@ -175,11 +188,13 @@ namespace bs
 		elemData.matInfo.groupId = 0;
 		elemData.matInfo.tint = color;
 
-		mForceTriangleBuild = true;
+		mTrianglesDirty = true;
 		_markContentAsDirty();
+
+		return (UINT32)(mElements.size() - 1);
 	}
 
-	void GUICanvas::drawText(const String& text, const Vector2I& position, const HFont& font, UINT32 size, 
+	UINT32 GUICanvas::drawText(const String& text, const Vector2I& position, const HFont& font, UINT32 size,
 		const Color& color, UINT8 depth)
 	{
 		mElements.push_back(CanvasElement());
@@ -191,11 +206,79 @@ namespace bs
 		element.size = size;
 		element.textSprite = bs_new<TextSprite>();
 		element.depth = depth;
+		element.dirty = true;
 
 		mDepthRange = std::max(mDepthRange, (UINT8)(depth + 1));
 
 		mTextData.push_back({ text, font, position });
 		_markContentAsDirty();
+
+		return (UINT32)(mElements.size() - 1);
+	}
+
+	void GUICanvas::moveCommand(UINT32 commandId, const Vector2I& offset)
+	{
+		if (commandId >= (UINT32)mElements.size())
+		{
+			LOGWRN("Invalid command identifier. Ignoring call.");
+			return;
+		}
+
+		CanvasElement& element = mElements[commandId];
+		switch (element.type)
+		{
+		case CanvasElementType::Line:
+		case CanvasElementType::Triangle:
+		{
+			// Source vertices move, so the command needs to be re-clipped, but all other commands keep their geometry
+			Vector2 floatOffset((float)offset.x, (float)offset.y);
+			for (UINT32 i = 0; i < element.numVertices; i++)
+				mVertexData[element.vertexStart + i] += floatOffset;
+
+			element.dirty = true;
+			mTrianglesDirty = true;
+		}
+			break;
+		case CanvasElementType::Image:
+			// Position is applied during buffer fill, no sprite rebuild required
+			mImageData[element.dataId].area.x += offset.x;
+			mImageData[element.dataId].area.y += offset.y;
+			break;
+		case CanvasElementType::Text:
+			// Position is applied during buffer fill, no sprite rebuild required
+			mTextData[element.dataId].position += offset;
+			break;
+		}
+
+		_markContentAsDirty();
+	}
+
+	void GUICanvas::setCommandColor(UINT32 commandId, const Color& color)
+	{
+		if (commandId >= (UINT32)mElements.size())
+		{
+			LOGWRN("Invalid command identifier. Ignoring call.");
+			return;
+		}
+
+		CanvasElement& element = mElements[commandId];
+		element.color = color;
+
+		switch (element.type)
+		{
+		case CanvasElementType::Line:
+		case CanvasElementType::Triangle:
+			// Color is a material tint, geometry remains valid
+			mTriangleElementData[element.dataId].matInfo.tint = color;
+			break;
+		case CanvasElementType::Image:
+		case CanvasElementType::Text:
+			// Color is baked into the sprite, requiring a sprite rebuild
+			element.dirty = true;
+			break;
+		}
+
+		_markContentAsDirty();
 	}
 
 	void GUICanvas::clear()
@@ -219,7 +302,8 @@ namespace bs
 		mTriangleElementData.clear();
 		mClippedVertices.clear();
 		mClippedLineVertices.clear();
-		mForceTriangleBuild = false;
+		mTrianglesDirty = false;
+		mClippedVertexWaste = 0;
 	}
 
 	UINT32 GUICanvas::_getNumRenderElements() const
@@ -311,18 +395,39 @@ namespace bs
 
 	void GUICanvas::updateRenderElementsInternal()
 	{
+		// Image sprites bake the element's layout size, and all sprites bake the parent widget, so all of them need a
+		// rebuild if either changes. Otherwise only dirty sprites are rebuilt.
+		Vector2I layoutSize(mLayoutData.area.width, mLayoutData.area.height);
+		UINT64 groupId = (UINT64)_getParentWidget();
+
+		bool rebuildAllImages = layoutSize != mLastLayoutSize || groupId != mLastSpriteGroupId;
+		bool rebuildAllText = groupId != mLastSpriteGroupId;
+
+		mLastLayoutSize = layoutSize;
+		mLastSpriteGroupId = groupId;
+
 		mNumRenderElements = 0;
 		for(auto& element : mElements)
 		{
 			switch(element.type)
 			{
 			case CanvasElementType::Image:
-				buildImageElement(element);
+				if (element.dirty || rebuildAllImages)
+				{
+					buildImageElement(element);
+					element.dirty = false;
+				}
+
 				element.renderElemStart = mNumRenderElements;
 				element.renderElemEnd = element.renderElemStart + element.imageSprite->getNumRenderElements();
 				break;
 			case CanvasElementType::Text:
-				buildTextElement(element);
+				if (element.dirty || rebuildAllText)
+				{
+					buildTextElement(element);
+					element.dirty = false;
+				}
+
 				element.renderElemStart = mNumRenderElements;
 				element.renderElemEnd = element.renderElemStart + element.textSprite->getNumRenderElements();
 				break;
@@ -498,7 +603,8 @@ namespace bs
 		element.textSprite->update(desc, (UINT64)_getParentWidget());
 	}
 
-	void GUICanvas::buildTriangleElement(const CanvasElement& element, const Vector2& offset, const Rect2I& clipRect) const
+	void GUICanvas::buildTriangleElement(const CanvasElement& element, const Vector2& offset, const Rect2I& clipRect,
+		Vector<Vector2>& output) const
 	{
 		assert(element.type == CanvasElementType::Triangle || element.type == CanvasElementType::Line);
 
@@ -510,15 +616,14 @@ namespace bs
 			auto writeCallback = [&](Vector2* vertices, Vector2* uvs, UINT32 count)
 			{
 				for (UINT32 i = 0; i < count; i++)
-					mClippedVertices.push_back(vertices[i] + offset);
+					output.push_back(vertices[i] + offset);
 
 				element.clippedNumVertices += count;
 			};
 
-			element.clippedVertexStart = (UINT32)mClippedVertices.size();
 			element.clippedNumVertices = 0;
 
-			ImageSprite::clipTrianglesToRect(verticesToClip, nullptr, trianglesToClip, sizeof(Vector2), clipRect, 
+			ImageSprite::clipTrianglesToRect(verticesToClip, nullptr, trianglesToClip, sizeof(Vector2), clipRect,
 				writeCallback);
 		}
 		else
@@ -544,7 +649,6 @@ namespace bs
 				Plane2D(Vector2(0.0f, -1.0f), (float)-(clipRect.y + (INT32)clipRect.height))
 			}};
 
-			element.clippedVertexStart = (UINT32)mClippedLineVertices.size();
 			element.clippedNumVertices = 0;
 
 			for (UINT32 i = 0; i < numLines; i++)
@@ -583,34 +687,93 @@ namespace bs
 				if (!isVisible)
 					continue;
 
-				mClippedLineVertices.push_back(a + offset);
-				mClippedLineVertices.push_back(b + offset);
+				output.push_back(a + offset);
+				output.push_back(b + offset);
 
 				element.clippedNumVertices += 2;
 			}
 		}
 	}
 
+	void GUICanvas::rebuildDirtyTriangleElement(const CanvasElement& element, const Vector2& offset,
+		const Rect2I& clipRect) const
+	{
+		Vector<Vector2>& clippedData = element.type == CanvasElementType::Line ? mClippedLineVertices : mClippedVertices;
+
+		UINT32 oldStart = element.clippedVertexStart;
+		UINT32 oldCount = element.clippedNumVertices;
+
+		mTriangleScratch.clear();
+		buildTriangleElement(element, offset, clipRect, mTriangleScratch);
+
+		if (element.clippedNumVertices <= oldCount)
+		{
+			// New geometry fits the old range, write it in place. Any leftover entries remain unreferenced until the
+			// next full rebuild.
+			std::copy(mTriangleScratch.begin(), mTriangleScratch.end(), clippedData.begin() + oldStart);
+
+			element.clippedVertexStart = oldStart;
+			mClippedVertexWaste += oldCount - element.clippedNumVertices;
+		}
+		else
+		{
+			// New geometry is larger, append it at the end and abandon the old range until the next full rebuild
+			element.clippedVertexStart = (UINT32)clippedData.size();
+			clippedData.insert(clippedData.end(), mTriangleScratch.begin(), mTriangleScratch.end());
+
+			mClippedVertexWaste += oldCount;
+		}
+	}
+
 	void GUICanvas::buildAllTriangleElementsIfDirty(const Vector2& offset, const Rect2I& clipRect) const
 	{
-		// We need to rebuild if new triangle element(s) were added, or if offset or clip rectangle changed
-		bool isDirty = mForceTriangleBuild || (mLastOffset != offset) || (mLastClipRect != clipRect);
-		if (!isDirty)
-			return;
+		// Clipped geometry depends on the offset and the clip rectangle, so everything rebuilds if either changes. A
+		// rebuild is also triggered once incremental updates abandon too much space in the clipped buffers.
+		UINT32 numClippedVerts = (UINT32)(mClippedVertices.size() + mClippedLineVertices.size());
+		bool fullRebuild = (mLastOffset != offset) || (mLastClipRect != clipRect) ||
+			(mClippedVertexWaste * 2 > numClippedVerts);
 
-		mClippedVertices.clear();
-		mClippedLineVertices.clear();
-		for(auto& element : mElements)
+		if (!fullRebuild)
+		{
+			if (!mTrianglesDirty)
+				return;
+
+			// Only dirty elements re-tessellate, unchanged ones keep their baked vertex ranges
+			for (auto& element : mElements)
+			{
+				if (element.type != CanvasElementType::Triangle && element.type != CanvasElementType::Line)
+					continue;
+
+				if (!element.dirty)
+					continue;
+
+				rebuildDirtyTriangleElement(element, offset, clipRect);
+				element.dirty = false;
+			}
+		}
+		else
 		{
-			if (element.type != CanvasElementType::Triangle && element.type != CanvasElementType::Line)
-				continue;
+			mClippedVertices.clear();
+			mClippedLineVertices.clear();
+			for(auto& element : mElements)
+			{
+				if (element.type != CanvasElementType::Triangle && element.type != CanvasElementType::Line)
+					continue;
+
+				Vector<Vector2>& clippedData = element.type == CanvasElementType::Line
+					? mClippedLineVertices : mClippedVertices;
+
+				element.clippedVertexStart = (UINT32)clippedData.size();
+				buildTriangleElement(element, offset, clipRect, clippedData);
+				element.dirty = false;
+			}
 
-			buildTriangleElement(element, offset, clipRect);
+			mClippedVertexWaste = 0;
 		}
 
 		mLastOffset = offset;
 		mLastClipRect = clipRect;
-		mForceTriangleBuild = false;
+		mTrianglesDirty = false;
 	}
 
 	const GUICanvas::CanvasElement& GUICanvas::findElement(UINT32 renderElementIdx) const
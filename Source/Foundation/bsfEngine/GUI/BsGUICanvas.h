@@ -50,8 +50,9 @@ namespace bs
 		 * @param[in]	depth	Depth at which to draw the element. Elements with higher depth will be drawn before others.
 		 *						Additionally elements of the same type (triangle or line) will be drawn in order they are
 		 *						submitted if they share the same depth.
+		 * @return				Identifier of the draw command, which may be passed to moveCommand() or setCommandColor().
 		 */
-		void drawLine(const Vector2I& a, const Vector2I& b, const Color& color = Color::White, UINT8 depth = 128);
+		UINT32 drawLine(const Vector2I& a, const Vector2I& b, const Color& color = Color::White, UINT8 depth = 128);
 
 		/** 
 		 * Draws multiple lines following the path by the provided vertices. First vertex connects to the second vertex,
@@ -63,8 +64,10 @@ namespace bs
 		 * @param[in]	depth		Depth at which to draw the element. Elements with higher depth will be drawn before 
 		 *							others. Additionally elements of the same type (triangle or line) will be drawn in order
 		 *							they are submitted if they share the same depth.
+		 * @return					Identifier of the draw command, which may be passed to moveCommand() or
+		 *							setCommandColor(). Returns -1 if the call was invalid.
 		 */
-		void drawPolyLine(const Vector<Vector2I>& vertices, const Color& color = Color::White, UINT8 depth = 128);
+		UINT32 drawPolyLine(const Vector<Vector2I>& vertices, const Color& color = Color::White, UINT8 depth = 128);
 
 		/** 
 		 * Draws a quad with a the provided texture displayed.
@@ -78,8 +81,10 @@ namespace bs
 		 * @param[in]	depth		Depth at which to draw the element. Elements with higher depth will be drawn before 
 		 *							others. Additionally elements of the same type (triangle or line) will be drawn in order
 		 *							they are submitted if they share the same depth.
+		 * @return					Identifier of the draw command, which may be passed to moveCommand() or
+		 *							setCommandColor().
 		 */
-		void drawTexture(const HSpriteTexture& texture, const Rect2I& area, 
+		UINT32 drawTexture(const HSpriteTexture& texture, const Rect2I& area,
 			TextureScaleMode scaleMode = TextureScaleMode::StretchToFit, const Color& color = Color::White, UINT8 depth = 128);
 
 		/** 
@@ -92,8 +97,10 @@ namespace bs
 		 * @param[in]	depth		Depth at which to draw the element. Elements with higher depth will be drawn before
 		 *							others. Additionally elements of the same type (triangle or line) will be drawn in order
 		 *							they are submitted if they share the same depth.
+		 * @return					Identifier of the draw command, which may be passed to moveCommand() or
+		 *							setCommandColor(). Returns -1 if the call was invalid.
 		 */
-		void drawTriangleStrip(const Vector<Vector2I>& vertices, const Color& color = Color::White, UINT8 depth = 128);
+		UINT32 drawTriangleStrip(const Vector<Vector2I>& vertices, const Color& color = Color::White, UINT8 depth = 128);
 
 		/** 
 		 * Draws a triangle list. Every three vertices in the list represent a unique triangle.
@@ -104,8 +111,10 @@ namespace bs
 		 * @param[in]	depth		Depth at which to draw the element. Elements with higher depth will be drawn before
 		 *							others. Additionally elements of the same type (triangle or line) will be drawn in order
 		 *							they are submitted if they share the same depth.
+		 * @return					Identifier of the draw command, which may be passed to moveCommand() or
+		 *							setCommandColor(). Returns -1 if the call was invalid.
 		 */
-		void drawTriangleList(const Vector<Vector2I>& vertices, const Color& color = Color::White, UINT8 depth = 128);
+		UINT32 drawTriangleList(const Vector<Vector2I>& vertices, const Color& color = Color::White, UINT8 depth = 128);
 
 		/**
 		 * Draws a piece of text with the wanted font. The text will be aligned to the top-left corner of the provided
@@ -120,10 +129,30 @@ namespace bs
 		 * @param[in]	depth		Depth at which to draw the element. Elements with higher depth will be drawn before
 		 *							others. Additionally elements of the same type (triangle or line) will be drawn in order
 		 *							they are submitted if they share the same depth.
+		 * @return					Identifier of the draw command, which may be passed to moveCommand() or
+		 *							setCommandColor().
 		 */
-		void drawText(const String& text, const Vector2I& position, const HFont& font, UINT32 size = 10, 
+		UINT32 drawText(const String& text, const Vector2I& position, const HFont& font, UINT32 size = 10,
 			const Color& color = Color::White, UINT8 depth = 128);
 
+		/**
+		 * Translates a previously drawn command by the provided offset. Much cheaper than clearing and re-drawing the
+		 * entire canvas, as all other commands keep their already generated geometry.
+		 *
+		 * @param[in]	commandId	Identifier of the command, as returned by one of the draw methods.
+		 * @param[in]	offset		Offset to translate the command by, in pixels relative to its current position.
+		 */
+		void moveCommand(UINT32 commandId, const Vector2I& offset);
+
+		/**
+		 * Changes the color of a previously drawn command. Much cheaper than clearing and re-drawing the entire canvas,
+		 * as all other commands keep their already generated geometry.
+		 *
+		 * @param[in]	commandId	Identifier of the command, as returned by one of the draw methods.
+		 * @param[in]	color		New color of the command.
+		 */
+		void setCommandColor(UINT32 commandId, const Color& color);
+
 		/** Clears the canvas, removing any previously drawn elements. */
 		void clear();
 
@@ -155,6 +184,7 @@ namespace bs
 			UINT32 renderElemEnd;
 			UINT32 dataId;
 			UINT8 depth;
+			mutable bool dirty;
 
 			union
 			{
@@ -232,12 +262,25 @@ namespace bs
 		/** Build a text sprite from the provided canvas element. */
 		void buildTextElement(const CanvasElement& element);
 
-		/** Build a set of clipped triangles from the source triangles provided by the canvas element. */
-		void buildTriangleElement(const CanvasElement& element, const Vector2& offset, const Rect2I& clipRect) const;
+		/**
+		 * Builds a set of clipped triangles from the source triangles provided by the canvas element, appending them to
+		 * the provided buffer. Updates the element's clipped vertex count, but leaves updating its clipped vertex start
+		 * offset to the caller.
+		 */
+		void buildTriangleElement(const CanvasElement& element, const Vector2& offset, const Rect2I& clipRect,
+			Vector<Vector2>& output) const;
 
-		/** 
-		 * Rebuilds all triangle elements on the canvas, by constructing a set of clipped and offset triangles from the
-		 * triangles provided by the canvas elements. 
+		/**
+		 * Re-tessellates a single dirty triangle or line element, leaving the baked geometry of all other elements
+		 * intact. The new geometry is written over the element's previous vertex range if it fits, and is otherwise
+		 * appended at the end of the relevant clipped vertex buffer.
+		 */
+		void rebuildDirtyTriangleElement(const CanvasElement& element, const Vector2& offset, const Rect2I& clipRect) const;
+
+		/**
+		 * Rebuilds triangle elements on the canvas, by constructing a set of clipped and offset triangles from the
+		 * triangles provided by the canvas elements. Only dirty elements are rebuilt, unless the offset or clip
+		 * rectangle changed in which case all elements are.
 		 */
 		void buildAllTriangleElementsIfDirty(const Vector2& offset, const Rect2I& clipRect) const;
 
@@ -255,9 +298,13 @@ namespace bs
 
 		mutable Vector<Vector2> mClippedVertices;
 		mutable Vector<Vector2> mClippedLineVertices;
+		mutable Vector<Vector2> mTriangleScratch;
 		mutable Vector2 mLastOffset;
 		mutable Rect2I mLastClipRect;
-		mutable bool mForceTriangleBuild;
+		mutable bool mTrianglesDirty;
+		mutable UINT32 mClippedVertexWaste;
+		Vector2I mLastLayoutSize;
+		UINT64 mLastSpriteGroupId;
 
 		static const float LINE_SMOOTH_BORDER_WIDTH;
 	};
@@ -249,6 +249,22 @@ namespace bs
 		return nullptr;
 	}
 
+	LayoutSizeRange GUIElement::_getLayoutSizeRange() const
+	{
+		// Elements with children (element containers) can change size when a child does, which doesn't pass through
+		// this element's dirty marks, so they cannot rely on the cache
+		if(!mChildren.empty())
+			return _calculateLayoutSizeRange();
+
+		if((mFlags & GUIElem_SizeRangeOutdated) != 0)
+		{
+			mCachedSizeRange = _calculateLayoutSizeRange();
+			mFlags &= ~GUIElem_SizeRangeOutdated;
+		}
+
+		return mCachedSizeRange;
+	}
+
 	void GUIElement::_refreshStyle()
 	{
 		const GUIElementStyle* newStyle = nullptr;
@@ -217,6 +217,14 @@ namespace bs
 		/** @copydoc GUIElementBase::_setLayoutData */
 		void _setLayoutData(const GUILayoutData& data) override;
 
+		/**
+		 * @copydoc GUIElementBase::_getLayoutSizeRange
+		 *
+		 * Returns a size range cached since the last time the element was marked dirty, so repeated layout passes over
+		 * a clean element don't re-measure its contents.
+		 */
+		LayoutSizeRange _getLayoutSizeRange() const override;
+
 		/** @copydoc GUIElementBase::_changeParentWidget */
 		void _changeParentWidget(GUIWidget* widget) override;
 
@@ -337,6 +345,7 @@ namespace bs
 		/**	Returns the tint that is applied to the GUI element. */
 		Color getTint() const;
 
+		mutable LayoutSizeRange mCachedSizeRange;
 		bool mIsDestroyed = false;
 		GUIElementOptions mOptionFlags;
 		Rect2I mClippedBounds;
@@ -175,6 +175,8 @@ namespace bs
 
 	void GUIElementBase::_markLayoutAsDirty() 
 	{ 
+		mFlags |= GUIElem_SizeRangeOutdated;
+
 		if(!_isVisible())
 			return;
 
@@ -186,6 +188,8 @@ namespace bs
 
 	void GUIElementBase::_markContentAsDirty()
 	{
+		mFlags |= GUIElem_SizeRangeOutdated;
+
 		if (!_isVisible())
 			return;
 
@@ -465,7 +469,7 @@ namespace bs
 
 	void GUIElementBase::destroyChildElements()
 	{
-		Vector<GUIElementBase*> childCopy = mChildren;
+		SmallVector<GUIElementBase*, 4> childCopy = mChildren;
 		for (auto& child : childCopy)
 		{
 			if (child->_getType() == Type::Element)
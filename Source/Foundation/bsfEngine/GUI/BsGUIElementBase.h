@@ -39,7 +39,8 @@ namespace bs
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_SizeRangeOutdated = 0x80
 		};
 
 	public:
@@ -326,8 +327,8 @@ namespace bs
 		GUIElementBase* mUpdateParent = nullptr;
 		GUIElementBase* mParentElement = nullptr;
 
-		Vector<GUIElementBase*> mChildren;	
-		UINT8 mFlags = GUIElem_Dirty;
+		SmallVector<GUIElementBase*, 4> mChildren;
+		mutable UINT8 mFlags = GUIElem_Dirty | GUIElem_SizeRangeOutdated;
 
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
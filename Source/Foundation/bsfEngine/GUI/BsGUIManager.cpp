@@ -73,7 +73,7 @@ namespace bs
 
 	GUIManager::GUIManager()
 		: mCoreDirty(false), mActiveMouseButton(GUIMouseButton::Left), mShowTooltip(false), mTooltipElementHoverStart(0.0f)
-		, mInputCaret(nullptr), mInputSelection(nullptr), mSeparateMeshesByWidget(true), mDragState(DragState::NoDrag)
+		, mInputCaret(nullptr), mInputSelection(nullptr), mSeparateMeshesByWidget(false), mDragState(DragState::NoDrag)
 		, mCaretColor(1.0f, 0.6588f, 0.0f), mCaretBlinkInterval(0.5f), mCaretLastBlinkTime(0.0f), mIsCaretOn(false)
 		, mActiveCursor(CursorType::Arrow), mTextSelectionColor(0.0f, 114/255.0f, 188/255.0f)
 	{
@@ -380,10 +380,11 @@ namespace bs
 		if (mCoreDirty)
 		{
 			UnorderedMap<SPtr<ct::Camera>, Vector<GUICoreRenderData>> corePerCameraData;
+			Vector<SPtr<ct::Camera>> dirtyCameras;
 
 			for (auto& viewportData : mCachedGUIData)
 			{
-				const GUIRenderData& renderData = viewportData.second;
+				GUIRenderData& renderData = viewportData.second;
 
 				SPtr<Camera> camera;
 				for (auto& widget : viewportData.second.widgets)
@@ -396,6 +397,12 @@ namespace bs
 				if (camera == nullptr)
 					continue;
 
+				if (renderData.changedSinceSubmit)
+				{
+					dirtyCameras.push_back(camera->getCore());
+					renderData.changedSinceSubmit = false;
+				}
+
 				auto insertedData = corePerCameraData.insert(std::make_pair(camera->getCore(), Vector<GUICoreRenderData>()));
 				Vector<GUICoreRenderData>& cameraData = insertedData.first->second;
 
@@ -427,7 +434,8 @@ namespace bs
 				}
 			}
 
-			gCoreThread().queueCommand(std::bind(&ct::GUIRenderer::updateData, mRenderer.get(), corePerCameraData));
+			gCoreThread().queueCommand(
+				std::bind(&ct::GUIRenderer::updateData, mRenderer.get(), corePerCameraData, dirtyCameras));
 
 			mCoreDirty = false;
 		}
@@ -448,13 +456,23 @@ namespace bs
 
 			// Check if anything is dirty. If nothing is we can skip the update
 			bool isDirty = renderData.isDirty;
+			bool structuralChange = renderData.isDirty;
 			renderData.isDirty = false;
 
+			Vector<GUIElement*> contentUpdates;
 			for(auto& widget : renderData.widgets)
 			{
 				if (widget->isDirty(true))
 				{
 					isDirty = true;
+
+					if (widget->_wasStructurallyDirty())
+						structuralChange = true;
+					else
+					{
+						const Vector<GUIElement*>& widgetUpdates = widget->_getRecentContentUpdates();
+						contentUpdates.insert(contentUpdates.end(), widgetUpdates.begin(), widgetUpdates.end());
+					}
 				}
 			}
 
@@ -462,6 +480,12 @@ namespace bs
 				continue;
 
 			mCoreDirty = true;
+			renderData.changedSinceSubmit = true;
+
+			// When only element contents changed, attempt to patch the existing meshes in-place, avoiding the cost of
+			// re-sorting and re-grouping every element and re-allocating the mesh buffers
+			if (!structuralChange && patchDirtyElementMeshes(renderData, contentUpdates))
+				continue;
 
 			bs_frame_mark();
 			{
@@ -524,13 +548,21 @@ namespace bs
 
 					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
 					{
-						// If we separate meshes by widget, ignore any groups with widget parents other than mine
-						if (mSeparateMeshesByWidget)
+						// Groups from other widgets can only be considered if their widget shares our world transform,
+						// since vertices are in widget space and a merged group is drawn with a single transform
+						if (groupIter->elements.size() > 0)
 						{
-							if (groupIter->elements.size() > 0)
+							GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
+							GUIWidget* otherWidget = otherElem->_getParentWidget();
+							GUIWidget* myWidget = guiElem->_getParentWidget();
+
+							if (otherWidget != myWidget)
 							{
-								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
+								if (mSeparateMeshesByWidget)
+									continue;
+
+								if (otherWidget == nullptr || myWidget == nullptr ||
+									otherWidget->getWorldTfrm() != myWidget->getWorldTfrm())
 									continue;
 							}
 						}
@@ -640,6 +672,9 @@ namespace bs
 
 				renderData.triangleMesh = nullptr;
 				renderData.lineMesh = nullptr;
+				renderData.triangleMeshData = nullptr;
+				renderData.lineMeshData = nullptr;
+				renderData.elementRanges.clear();
 
 				renderData.cachedMeshes.resize(numMeshes);
 
@@ -705,6 +740,27 @@ namespace bs
 						for(UINT32 i = indexStart; i < indexEnd; i++)
 							indices[typeIdx][i] += vertexOffset[typeIdx];
 
+						// Remember the mesh region this render element occupies, so later content-only changes can
+						// patch just its vertices instead of rebuilding all meshes
+						SpriteMaterial* elemMaterial = nullptr;
+						const SpriteMaterialInfo& elemMatInfo =
+							matElement.element->_getMaterial(matElement.renderElement, &elemMaterial);
+
+						Rect2I elemBounds = matElement.element->_getClippedBounds();
+						elemBounds.transform(matElement.element->_getParentWidget()->getWorldTfrm());
+
+						GUIElementMeshRange range;
+						range.renderElement = matElement.renderElement;
+						range.typeIdx = typeIdx;
+						range.vertexOffset = vertexOffset[typeIdx];
+						range.indexOffset = indexStart;
+						range.numVertices = elemNumVertices;
+						range.numIndices = elemNumIndices;
+						range.materialHash = elemMaterial->getMergeHash(elemMatInfo);
+						range.bounds = elemBounds;
+
+						renderData.elementRanges[matElement.element].push_back(range);
+
 						indexOffset[typeIdx] += elemNumIndices;
 						vertexOffset[typeIdx] += elemNumVertices;
 
@@ -721,10 +777,87 @@ namespace bs
 
 				if(meshData[1])
 					renderData.lineMesh = Mesh::_createPtr(meshData[1], MU_STATIC, DOT_LINE_LIST);
+
+				// Keep the system memory copies alive so content-only changes can patch them in-place
+				renderData.triangleMeshData = meshData[0];
+				renderData.lineMeshData = meshData[1];
 			}
 
-			bs_frame_clear();			
+			bs_frame_clear();
+		}
+	}
+
+	bool GUIManager::patchDirtyElementMeshes(GUIRenderData& renderData, const Vector<GUIElement*>& dirtyElements)
+	{
+		bool meshTouched[2] = { false, false };
+
+		for (auto& element : dirtyElements)
+		{
+			// Visibility changes require re-batching
+			if (!element->_isVisible())
+				return false;
+
+			auto iterFind = renderData.elementRanges.find(element);
+			if (iterFind == renderData.elementRanges.end())
+				return false;
+
+			Vector<GUIElementMeshRange>& ranges = iterFind->second;
+			if (element->_getNumRenderElements() != (UINT32)ranges.size())
+				return false;
+
+			Rect2I tfrmedBounds = element->_getClippedBounds();
+			tfrmedBounds.transform(element->_getParentWidget()->getWorldTfrm());
+
+			// A change in mesh size, material or placement can affect batching, requiring a full rebuild
+			for (auto& range : ranges)
+			{
+				UINT32 numVertices;
+				UINT32 numIndices;
+				GUIMeshType meshType;
+				element->_getMeshInfo(range.renderElement, numVertices, numIndices, meshType);
+
+				if (numVertices != range.numVertices || numIndices != range.numIndices ||
+					(UINT32)meshType != range.typeIdx)
+					return false;
+
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = element->_getMaterial(range.renderElement, &spriteMaterial);
+				if (spriteMaterial == nullptr || spriteMaterial->getMergeHash(matInfo) != range.materialHash)
+					return false;
+
+				if (tfrmedBounds != range.bounds)
+					return false;
+			}
+
+			for (auto& range : ranges)
+			{
+				SPtr<MeshData>& meshData = range.typeIdx == 0 ? renderData.triangleMeshData : renderData.lineMeshData;
+
+				// Buffer can be locked if the core thread hasn't picked up a previous write yet
+				if (meshData == nullptr || meshData->isLocked())
+					return false;
+
+				UINT8* vertices = meshData->getElementData(VES_POSITION);
+				UINT32* indices = meshData->getIndices32();
+
+				element->_fillBuffer(vertices, indices, range.vertexOffset, range.indexOffset,
+					meshData->getNumVertices(), meshData->getNumIndices(), range.renderElement);
+
+				UINT32 indexEnd = range.indexOffset + range.numIndices;
+				for (UINT32 i = range.indexOffset; i < indexEnd; i++)
+					indices[i] += range.vertexOffset;
+
+				meshTouched[range.typeIdx] = true;
+			}
 		}
+
+		if (meshTouched[0] && renderData.triangleMesh != nullptr)
+			renderData.triangleMesh->writeData(renderData.triangleMeshData, true);
+
+		if (meshTouched[1] && renderData.lineMesh != nullptr)
+			renderData.lineMesh->writeData(renderData.lineMeshData, true);
+
+		return true;
 	}
 
 	void GUIManager::updateCaretTexture()
@@ -1859,14 +1992,27 @@ namespace bs
 
 	bool GUIRenderer::check(const Camera& camera)
 	{
+		// A camera that just lost all of its GUI is still reported until rendered once more, so that on-demand drawn
+		// views get the redraw that clears the previously drawn GUI
+		if (mDirtyCameras.find(&camera) != mDirtyCameras.end())
+			return true;
+
 		auto iterFind = mPerCameraData.find(&camera);
 		return iterFind != mPerCameraData.end();
 	}
 
+	bool GUIRenderer::checkDirty(const Camera& camera)
+	{
+		return mDirtyCameras.find(&camera) != mDirtyCameras.end();
+	}
+
 	void GUIRenderer::render(const Camera& camera)
 	{
 		Vector<GUIManager::GUICoreRenderData>& renderData = mPerCameraData[&camera];
 
+		// Camera's GUI is about to be drawn, so its contents are no longer considered changed
+		mDirtyCameras.erase(&camera);
+
 		float invViewportWidth = 1.0f / (camera.getViewport()->getPixelArea().width * 0.5f);
 		float invViewportHeight = 1.0f / (camera.getViewport()->getPixelArea().height * 0.5f);
 		float viewflipYFlip = bs::RenderAPI::getAPIInfo().isFlagSet(RenderAPIFeatureFlag::NDCYAxisDown) ? -1.0f : 1.0f;
@@ -1893,11 +2039,30 @@ namespace bs
 		}
 	}
 
-	void GUIRenderer::updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& newPerCameraData)
+	void GUIRenderer::updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& newPerCameraData,
+		const Vector<SPtr<Camera>>& dirtyCameras)
 	{
 		bs_frame_mark();
 
 		{
+			// Cameras that lost all their GUI data need one more redraw, to clear the previously drawn GUI
+			FrameSet<const Camera*> removedCameras;
+			for (auto& oldCameraData : mPerCameraData)
+			{
+				bool stillPresent = false;
+				for (auto& newCameraData : newPerCameraData)
+				{
+					if (newCameraData.first.get() == oldCameraData.first)
+					{
+						stillPresent = true;
+						break;
+					}
+				}
+
+				if (!stillPresent)
+					removedCameras.insert(oldCameraData.first);
+			}
+
 			mPerCameraData.clear();
 			mReferencedCameras.clear();
 
@@ -1909,6 +2074,25 @@ namespace bs
 				mReferencedCameras.insert(camera);
 			}
 
+			for (auto& camera : dirtyCameras)
+				mDirtyCameras.insert(camera.get());
+
+			for (auto& camera : removedCameras)
+				mDirtyCameras.insert(camera);
+
+			// Drop dirty entries for cameras that neither have GUI to render, nor just lost it (e.g. the camera itself
+			// was destroyed before its dirty state was queried)
+			for (auto iter = mDirtyCameras.begin(); iter != mDirtyCameras.end();)
+			{
+				if (mPerCameraData.find(*iter) == mPerCameraData.end() &&
+					removedCameras.find(*iter) == removedCameras.end())
+				{
+					iter = mDirtyCameras.erase(iter);
+				}
+				else
+					++iter;
+			}
+
 			// Allocate GPU buffers containing the material parameters
 			UINT32 numBuffers = 0;
 			for (auto& cameraData : mPerCameraData)
@@ -60,18 +60,38 @@ namespace bs
 			bool isLine;
 		};
 
+		/**
+		 * Describes the region of a viewport's shared mesh buffer occupied by a single render element of a GUI element.
+		 * Recorded during a full mesh rebuild so that later content-only changes can patch just the relevant vertices.
+		 */
+		struct GUIElementMeshRange
+		{
+			UINT32 renderElement = 0;
+			UINT32 typeIdx = 0; /**< 0 for the triangle mesh, 1 for the line mesh. */
+			UINT32 vertexOffset = 0;
+			UINT32 indexOffset = 0;
+			UINT32 numVertices = 0;
+			UINT32 numIndices = 0;
+			UINT64 materialHash = 0;
+			Rect2I bounds; /**< Clipped bounds of the element at rebuild time, in render target space. */
+		};
+
 		/**	GUI render data for a single viewport. */
 		struct GUIRenderData
 		{
 			GUIRenderData()
-				:isDirty(true)
+				:isDirty(true), changedSinceSubmit(true)
 			{ }
 
 			SPtr<Mesh> triangleMesh;
 			SPtr<Mesh> lineMesh;
+			SPtr<MeshData> triangleMeshData;
+			SPtr<MeshData> lineMeshData;
 			Vector<GUIMeshData> cachedMeshes;
+			UnorderedMap<GUIElement*, Vector<GUIElementMeshRange>> elementRanges;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+			bool changedSinceSubmit; /**< True if any widget contents changed since the last submit to the core renderer. */
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -241,6 +261,14 @@ namespace bs
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/**
+		 * Attempts to update the meshes of the provided viewport in-place by re-generating only the vertices of the
+		 * provided elements, using the mesh ranges recorded during the last full rebuild. Returns false if any of the
+		 * elements cannot be patched (e.g. its vertex count, material or bounds changed), in which case a full mesh
+		 * rebuild is required.
+		 */
+		bool patchDirtyElementMeshes(GUIRenderData& renderData, const Vector<GUIElement*>& dirtyElements);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -398,6 +426,7 @@ namespace bs
 		GUIInputCaret* mInputCaret;
 		GUIInputSelection* mInputSelection;
 
+		/** If true, batches are never merged across widget boundaries, even when widget transforms match. */
 		bool mSeparateMeshesByWidget;
 		Vector2I mLastPointerScreenPos;
 
@@ -464,6 +493,9 @@ namespace bs
 		/**	@copydoc RendererExtension::check */
 		bool check(const Camera& camera) override;
 
+		/**	@copydoc RendererExtension::checkDirty */
+		bool checkDirty(const Camera& camera) override;
+
 		/**	@copydoc RendererExtension::render */
 		void render(const Camera& camera) override;
 
@@ -472,10 +504,15 @@ namespace bs
 		 * Updates the internal data that determines what will be rendered on the next render() call.
 		 *
 		 * @param[in]	perCameraData	GUI mesh/material per viewport.
+		 * @param[in]	dirtyCameras	Cameras whose GUI contents changed since the last update. Such cameras will
+		 *								report as dirty until the next time they are rendered, allowing on-demand drawn
+		 *								views to be redrawn.
 		 */
-		void updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& perCameraData);
+		void updateData(const UnorderedMap<SPtr<Camera>, Vector<GUIManager::GUICoreRenderData>>& perCameraData,
+			const Vector<SPtr<Camera>>& dirtyCameras);
 
 		UnorderedMap<const Camera*, Vector<GUIManager::GUICoreRenderData>> mPerCameraData;
+		Set<const Camera*> mDirtyCameras;
 		Set<SPtr<Camera>> mReferencedCameras;
 		Vector<SPtr<GpuParamBlockBuffer>> mParamBlocks;
 		SPtr<SamplerState> mSamplerState;
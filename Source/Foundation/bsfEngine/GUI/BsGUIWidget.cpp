@@ -346,6 +346,11 @@ namespace bs
 
 		if(cleanIfDirty && dirty)
 		{
+			// Remember what kind of dirtiness this was, so the GUI manager can avoid a full mesh rebuild when only
+			// element contents changed
+			mRecentStructuralChange = mWidgetIsDirty;
+			mRecentContentUpdates.assign(mDirtyContents.begin(), mDirtyContents.end());
+
 			mWidgetIsDirty = false;
 
 			for (auto& dirtyElement : mDirtyContents)
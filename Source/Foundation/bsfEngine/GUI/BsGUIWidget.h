@@ -133,6 +133,18 @@ namespace bs
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/**
+		 * Returns true if the dirty state reported (and cleaned) by the last isDirty() call included changes that
+		 * require a full mesh rebuild, as opposed to just element content updates.
+		 */
+		bool _wasStructurallyDirty() const { return mRecentStructuralChange; }
+
+		/**
+		 * Returns the elements whose contents were updated by the last isDirty() call. Only valid when the call
+		 * reported the widget as dirty.
+		 */
+		const Vector<GUIElement*>& _getRecentContentUpdates() const { return mRecentContentUpdates; }
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
@@ -200,6 +212,8 @@ namespace bs
 		HEvent mOwnerTargetResizedConn;
 
 		Set<GUIElement*> mDirtyContents;
+		Vector<GUIElement*> mRecentContentUpdates;
+		bool mRecentStructuralChange = true;
 
 		mutable UINT64 mCachedRTId;
 		mutable bool mWidgetIsDirty;
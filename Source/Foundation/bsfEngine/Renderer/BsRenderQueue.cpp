@@ -6,24 +6,95 @@
 #include "Mesh/BsMesh.h"
 #include "Material/BsMaterial.h"
 #include "Renderer/BsRenderableElement.h"
-
-using namespace std::placeholders;
+#include "Math/BsMath.h"
 
 namespace bs { namespace ct
 {
+	namespace
+	{
+		/** Size of the memory blocks used by the per-queue frame allocator. */
+		constexpr UINT32 QUEUE_BLOCK_SIZE = 256 * 1024;
+
+		/** Smallest entry capacity to allocate when the previous frame provides no sizing information. */
+		constexpr UINT32 QUEUE_MIN_CAPACITY = 64;
+
+		/** Maps a floating point value to an unsigned integer so that unsigned ordering matches the float ordering. */
+		UINT32 mapFloatToUInt(float value)
+		{
+			UINT32 bits;
+			memcpy(&bits, &value, sizeof(bits));
+
+			UINT32 mask = (UINT32)(-(INT32)(bits >> 31)) | 0x80000000;
+			return bits ^ mask;
+		}
+
+		/**
+		 * Grows a frame-allocated array of trivially copyable entries to the provided capacity, copying over any
+		 * existing entries.
+		 */
+		template <class T>
+		T* growArray(FrameAlloc& alloc, T* oldData, UINT32 count, UINT32 newCapacity)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Queue entries must be trivially copyable.");
+
+			T* newData = (T*)alloc.alloc(newCapacity * (UINT32)sizeof(T));
+			if (oldData != nullptr)
+			{
+				if (count > 0)
+					memcpy(newData, oldData, count * sizeof(T));
+
+				// No-op outside of debug builds, where it keeps the allocator's leak detection satisfied
+				alloc.free((UINT8*)oldData);
+			}
+
+			return newData;
+		}
+	}
+
 	RenderQueue::RenderQueue(StateReduction mode)
-		:mStateReductionMode(mode)
+		:mAlloc(QUEUE_BLOCK_SIZE), mStateReductionMode(mode)
 	{
 
 	}
 
+	RenderQueue::~RenderQueue()
+	{
+		clear();
+	}
+
 	void RenderQueue::clear()
 	{
-		mSortableElements.clear();
-		mSortableElementIdx.clear();
-		mElements.clear();
+		mLastFrameElements = mNumElements;
+		mLastFrameSortable = mNumSortableElements;
+
+		// Free is a no-op outside of debug builds, where it keeps the allocator's leak detection satisfied. The actual
+		// memory is released all at once by the allocator clear below.
+		if (mElements != nullptr)
+			mAlloc.free((UINT8*)mElements);
+
+		if (mSortableElements != nullptr)
+			mAlloc.free((UINT8*)mSortableElements);
+
+		if (mSortableElementIdx != nullptr)
+			mAlloc.free((UINT8*)mSortableElementIdx);
+
+		if (mSortedRenderElements != nullptr)
+			mAlloc.free((UINT8*)mSortedRenderElements);
 
-		mSortedRenderElements.clear();
+		mAlloc.clear();
+
+		mElements = nullptr;
+		mSortableElements = nullptr;
+		mSortableElementIdx = nullptr;
+		mSortedRenderElements = nullptr;
+
+		mNumElements = 0;
+		mNumSortableElements = 0;
+		mNumSortedElements = 0;
+		mMaxSortedElements = 0;
+
+		mElementCapacity = 0;
+		mSortableCapacity = 0;
 	}
 
 	void RenderQueue::add(RenderableElement* element, float distFromCamera)
@@ -31,8 +102,15 @@ namespace bs { namespace ct
 		SPtr<Material> material = element->material;
 		SPtr<Shader> shader = material->getShader();
 
-		mElements.push_back(element);
-		
+		if (mNumElements == mElementCapacity)
+		{
+			UINT32 newCapacity = std::max(std::max(mElementCapacity * 2, mLastFrameElements), QUEUE_MIN_CAPACITY);
+			mElements = growArray(mAlloc, mElements, mNumElements, newCapacity);
+			mElementCapacity = newCapacity;
+		}
+
+		mElements[mNumElements++] = element;
+
 		UINT32 queuePriority = shader->getQueuePriority();
 		QueueSortType sortType = shader->getQueueSortType();
 		UINT32 shaderId = shader->getId();
@@ -51,17 +129,30 @@ namespace bs { namespace ct
 		}
 
 		UINT32 numPasses = material->getNumPasses();
+
+		// Worst case number of sorted entries this element expands to during sort(), used to size the output array
+		mMaxSortedElements += numPasses;
+
 		if (!separablePasses)
 			numPasses = std::min(1U, numPasses);
 
-		for (UINT32 i = 0; i < numPasses; i++)
+		if (mNumSortableElements + numPasses > mSortableCapacity)
 		{
-			UINT32 idx = (UINT32)mSortableElementIdx.size();
-			mSortableElementIdx.push_back(idx);
+			UINT32 newCapacity = std::max(std::max(mSortableCapacity * 2, mLastFrameSortable), QUEUE_MIN_CAPACITY);
+			while (newCapacity < mNumSortableElements + numPasses)
+				newCapacity *= 2;
 
-			mSortableElements.push_back(SortableElement());
-			SortableElement& sortableElem = mSortableElements.back();
+			mSortableElements = growArray(mAlloc, mSortableElements, mNumSortableElements, newCapacity);
+			mSortableElementIdx = growArray(mAlloc, mSortableElementIdx, mNumSortableElements, newCapacity);
+			mSortableCapacity = newCapacity;
+		}
+
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			UINT32 idx = mNumSortableElements++;
+			mSortableElementIdx[idx] = idx;
 
+			SortableElement& sortableElem = mSortableElements[idx];
 			sortableElem.seqIdx = idx;
 			sortableElem.priority = queuePriority;
 			sortableElem.shaderId = shaderId;
@@ -72,23 +163,23 @@ namespace bs { namespace ct
 
 	void RenderQueue::sort()
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
+		// Generate a packed sort key per element and sort only indices, since we generate an entirely new data set
+		// anyway it doesn't make sense to move sortable elements. The radix sort is stable so the sequential index
+		// doesn't need to be encoded in the key.
+		UINT32 numElements = mNumSortableElements;
+		if (numElements == 0)
+			return;
 
-		switch (mStateReductionMode)
-		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
-		}
+		UINT64* sortKeys = (UINT64*)mAlloc.alloc(numElements * (UINT32)sizeof(UINT64));
+		for (UINT32 i = 0; i < numElements; i++)
+			sortKeys[i] = generateSortKey(mSortableElements[i], mStateReductionMode);
 
-		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		radixSortElements(sortKeys, mSortableElementIdx, numElements);
+
+		// Output entries are written into a frame-allocated array sized for the worst case pass count, so assembly is
+		// a single linear write with no reallocations.
+		mSortedRenderElements = (RenderQueueElement*)mAlloc.alloc(mMaxSortedElements * (UINT32)sizeof(RenderQueueElement));
+		mNumSortedElements = 0;
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevPassIdx = (UINT32)-1;
@@ -96,7 +187,7 @@ namespace bs { namespace ct
 		INT32 currentElementIdx = -1;
 		UINT32 numPassesInCurrentElement = 0;
 		bool separablePasses = true;
-		for (UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
+		for (UINT32 i = 0; i < numElements; i++)
 		{
 			UINT32 idx = mSortableElementIdx[i];
 
@@ -111,9 +202,7 @@ namespace bs { namespace ct
 			const SortableElement& elem = mSortableElements[idx];
 			if (separablePasses)
 			{
-				mSortedRenderElements.push_back(RenderQueueElement());
-
-				RenderQueueElement& sortedElem = mSortedRenderElements.back();
+				RenderQueueElement& sortedElem = mSortedRenderElements[mNumSortedElements++];
 				sortedElem.renderElem = renderElem;
 				sortedElem.passIdx = elem.passIdx;
 
@@ -132,9 +221,7 @@ namespace bs { namespace ct
 			{
 				for (UINT32 j = 0; j < numPassesInCurrentElement; j++)
 				{
-					mSortedRenderElements.push_back(RenderQueueElement());
-
-					RenderQueueElement& sortedElem = mSortedRenderElements.back();
+					RenderQueueElement& sortedElem = mSortedRenderElements[mNumSortedElements++];
 					sortedElem.renderElem = renderElem;
 					sortedElem.passIdx = j;
 					sortedElem.applyPass = true;
@@ -144,68 +231,91 @@ namespace bs { namespace ct
 				}
 
 				numPassesInCurrentElement = 0;
-			}			
+			}
+		}
+
+		mAlloc.free((UINT8*)sortKeys);
+	}
+
+	UINT64 RenderQueue::generateSortKey(const SortableElement& element, StateReduction mode)
+	{
+		// Elements are sorted in ascending key order, while higher priorities should sort first, so the priority bits
+		// are inverted. Priority is clamped to a 16-bit range, distance is quantized to the top 22 bits of its ordered
+		// float representation and shader id/pass index are truncated to 20/6 bits respectively.
+		UINT64 priority = 0xFFFF - (UINT32)(Math::clamp(element.priority, -32768, 32767) + 32768);
+		UINT64 distFull = mapFloatToUInt(element.distFromCamera);
+		UINT64 dist = distFull >> 10;
+		UINT64 shaderId = element.shaderId & 0xFFFFF;
+		UINT64 passIdx = element.passIdx & 0x3F;
+
+		switch (mode)
+		{
+		default:
+		case StateReduction::None:
+			return priority << 48 | distFull << 16;
+		case StateReduction::Material:
+			return priority << 48 | shaderId << 28 | passIdx << 22 | dist;
+		case StateReduction::Distance:
+			return priority << 48 | dist << 26 | shaderId << 6 | passIdx;
 		}
 	}
 
-	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
+	void RenderQueue::radixSortElements(UINT64* keys, UINT32* indices, UINT32 numElements)
 	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
+		if (numElements == 0)
+			return;
 
-		UINT8 isHigher = (a.priority > b.priority) << 2 |
-			(a.distFromCamera < b.distFromCamera) << 1 |
-			(a.seqIdx < b.seqIdx);
+		UINT64* tempKeys = (UINT64*)mAlloc.alloc(numElements * (UINT32)sizeof(UINT64));
+		UINT32* tempIndices = (UINT32*)mAlloc.alloc(numElements * (UINT32)sizeof(UINT32));
 
-		UINT8 isLower = (a.priority < b.priority) << 2 |
-			(a.distFromCamera > b.distFromCamera) << 1 |
-			(a.seqIdx > b.seqIdx);
+		UINT64* srcKeys = keys;
+		UINT32* srcIdx = indices;
+		UINT64* dstKeys = tempKeys;
+		UINT32* dstIdx = tempIndices;
 
-		return isHigher > isLower;
-	}
+		for (UINT32 shift = 0; shift < 64; shift += 8)
+		{
+			UINT32 counts[256] = { };
+			for (UINT32 i = 0; i < numElements; i++)
+				counts[(srcKeys[i] >> shift) & 0xFF]++;
 
-	bool RenderQueue::elementSorterPreferGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
-	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-		
-		UINT8 isHigher = (a.priority > b.priority) << 4 |
-			(a.shaderId < b.shaderId) << 3 |
-			(a.passIdx < b.passIdx) << 2 |
-			(a.distFromCamera < b.distFromCamera) << 1 |
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.shaderId > b.shaderId) << 3 |
-			(a.passIdx > b.passIdx) << 2 |
-			(a.distFromCamera > b.distFromCamera) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
-	}
+			// All elements fall in the same bucket, nothing to do for this digit
+			if (counts[(srcKeys[0] >> shift) & 0xFF] == numElements)
+				continue;
 
-	bool RenderQueue::elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
-	{
-		const SortableElement& a = lookup[aIdx];
-		const SortableElement& b = lookup[bIdx];
-
-		UINT8 isHigher = (a.priority > b.priority) << 4 | 
-			(a.distFromCamera < b.distFromCamera) << 3 | 
-			(a.shaderId < b.shaderId) << 2 | 
-			(a.passIdx < b.passIdx) << 1 | 
-			(a.seqIdx < b.seqIdx);
-
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.distFromCamera > b.distFromCamera) << 3 |
-			(a.shaderId > b.shaderId) << 2 |
-			(a.passIdx > b.passIdx) << 1 |
-			(a.seqIdx > b.seqIdx);
-
-		return isHigher > isLower;
+			UINT32 offset = 0;
+			for (UINT32 i = 0; i < 256; i++)
+			{
+				UINT32 count = counts[i];
+				counts[i] = offset;
+				offset += count;
+			}
+
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				UINT32 digit = (srcKeys[i] >> shift) & 0xFF;
+
+				dstKeys[counts[digit]] = srcKeys[i];
+				dstIdx[counts[digit]] = srcIdx[i];
+				counts[digit]++;
+			}
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcIdx, dstIdx);
+		}
+
+		if (srcIdx != indices)
+		{
+			memcpy(indices, srcIdx, numElements * sizeof(UINT32));
+			memcpy(keys, srcKeys, numElements * sizeof(UINT64));
+		}
+
+		mAlloc.free((UINT8*)tempKeys);
+		mAlloc.free((UINT8*)tempIndices);
 	}
 
-	const Vector<RenderQueueElement>& RenderQueue::getSortedElements() const
+	RenderQueueElementList RenderQueue::getSortedElements() const
 	{
-		return mSortedRenderElements;
+		return RenderQueueElementList(mSortedRenderElements, mNumSortedElements);
 	}
-}}
\ No newline at end of file
+}}
@@ -5,6 +5,7 @@
 #include "BsPrerequisites.h"
 #include "Math/BsVector3.h"
 #include "RenderAPI/BsSubMesh.h"
+#include "Allocators/BsFrameAlloc.h"
 
 namespace bs { namespace ct
 {
@@ -22,16 +23,31 @@ namespace bs { namespace ct
 		Distance /**< Elements will be grouped by distance first, material second. */
 	};
 
-	/** Contains data needed for performing a single rendering pass. */
+	/**
+	 * Contains data needed for performing a single rendering pass. Kept trivially copyable so the queue can keep entries
+	 * in frame-allocated arrays and grow them through memcpy.
+	 */
 	struct BS_EXPORT RenderQueueElement
 	{
-		RenderQueueElement()
-			:renderElem(nullptr), passIdx(0), applyPass(true)
+		RenderableElement* renderElem = nullptr;
+		UINT32 passIdx = 0;
+		bool applyPass = true;
+	};
+
+	/** A view over the list of sorted entries in a RenderQueue. Only valid until the queue is next cleared. */
+	struct RenderQueueElementList
+	{
+		RenderQueueElementList(const RenderQueueElement* elements, UINT32 count)
+			:elements(elements), count(count)
 		{ }
 
-		RenderableElement* renderElem;
-		UINT32 passIdx;
-		bool applyPass;
+		const RenderQueueElement* begin() const { return elements; }
+		const RenderQueueElement* end() const { return elements + count; }
+		UINT32 size() const { return count; }
+		const RenderQueueElement& operator[](UINT32 idx) const { return elements[idx]; }
+
+		const RenderQueueElement* elements;
+		UINT32 count;
 	};
 
 	/**
@@ -53,7 +69,7 @@ namespace bs { namespace ct
 
 	public:
 		RenderQueue(StateReduction grouping = StateReduction::Distance);
-		virtual ~RenderQueue() { }
+		virtual ~RenderQueue();
 
 		/**
 		 * Adds a new entry to the render queue.
@@ -63,38 +79,65 @@ namespace bs { namespace ct
 		 */
 		void add(RenderableElement* element, float distFromCamera);
 
-		/**	Clears all render operations from the queue. */
+		/**	Clears all render operations from the queue and resets its internal frame allocator. */
 		void clear();
-		
+
 		/**	Sorts all the render operations using user-defined rules. */
 		virtual void sort();
 
-		/** Returns a list of sorted render elements. Caller must ensure sort() is called before this method. */
-		const Vector<RenderQueueElement>& getSortedElements() const;
+		/**
+		 * Returns a view over the sorted render elements. Caller must ensure sort() is called before this method. The
+		 * view is only valid until the next call to clear().
+		 */
+		RenderQueueElementList getSortedElements() const;
 
 		/**
-		 * Controls if and how a render queue groups renderable objects by material in order to reduce number of state 
+		 * Controls if and how a render queue groups renderable objects by material in order to reduce number of state
 		 * changes.
 		 */
 		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
 
 	protected:
-		/**	Callback used for sorting elements with no material grouping. */
-		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
+		/**
+		 * Generates a 64-bit key that encodes the sort order of the provided element for the specified grouping mode.
+		 * Elements then only need to be sorted in ascending key order. Distance is quantized and shader id and pass
+		 * index are truncated to fit the key, meaning elements whose fields differ only below that precision compare
+		 * equal and retain their submission order.
+		 */
+		static UINT64 generateSortKey(const SortableElement& element, StateReduction mode);
+
+		/**
+		 * Performs a stable least-significant-digit radix sort that orders @p indices in ascending order of the provided
+		 * keys. Scratch memory is taken from the queue's frame allocator.
+		 */
+		void radixSortElements(UINT64* keys, UINT32* indices, UINT32 numElements);
+
+		/**
+		 * All queue storage is allocated from a per-queue frame allocator and laid out in plain contiguous arrays.
+		 * Entries are trivially copyable so growth is a memcpy into a larger frame allocation, and clear() releases
+		 * everything in constant time by resetting the allocator. Arrays are pre-sized from the previous frame's entry
+		 * counts, so in steady state a frame performs no heap allocations at all.
+		 */
+		FrameAlloc mAlloc;
+
+		SortableElement* mSortableElements = nullptr;
+		UINT32* mSortableElementIdx = nullptr;
+		RenderableElement** mElements = nullptr;
+		RenderQueueElement* mSortedRenderElements = nullptr;
 
-		/**	Callback used for sorting elements with preferred material grouping. */
-		static bool elementSorterPreferGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
+		UINT32 mNumElements = 0;
+		UINT32 mNumSortableElements = 0;
+		UINT32 mNumSortedElements = 0;
+		UINT32 mMaxSortedElements = 0;
 
-		/**	Callback used for sorting elements with material grouping after sorting. */
-		static bool elementSorterPreferSort(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
+		UINT32 mElementCapacity = 0;
+		UINT32 mSortableCapacity = 0;
 
-		Vector<SortableElement> mSortableElements;
-		Vector<UINT32> mSortableElementIdx;
-		Vector<RenderableElement*> mElements;
+		UINT32 mLastFrameElements = 0;
+		UINT32 mLastFrameSortable = 0;
 
-		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
 	};
 
 	/** @} */
-}}
\ No newline at end of file
+}}
@@ -8,10 +8,12 @@
 #include "Material/BsGpuParamsSet.h"
 #include "Material/BsPass.h"
 #include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsSamplerState.h"
 #include "Utility/BsShapeMeshes3D.h"
 #include "Renderer/BsLight.h"
 #include "Material/BsShader.h"
 #include "Renderer/BsIBLUtility.h"
+#include "Image/BsTexture.h"
 #include "Math/BsAABox.h"
 
 namespace bs { namespace ct
@@ -223,7 +225,49 @@ namespace bs { namespace ct
 		mesh->_notifyUsedOnGPU();
 	}
 
-	void RendererUtility::drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
+	void RendererUtility::drawIndirect(const SPtr<MeshBase>& mesh, const SubMesh& subMesh,
+		const SPtr<GpuBuffer>& argBuffer)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+
+		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration);
+
+		auto& vertexBuffers = vertexData->getBuffers();
+		if (vertexBuffers.size() > 0)
+		{
+			SPtr<VertexBuffer> buffers[BS_MAX_BOUND_VERTEX_BUFFERS];
+
+			UINT32 endSlot = 0;
+			UINT32 startSlot = BS_MAX_BOUND_VERTEX_BUFFERS;
+			for (auto iter = vertexBuffers.begin(); iter != vertexBuffers.end(); ++iter)
+			{
+				if (iter->first >= BS_MAX_BOUND_VERTEX_BUFFERS)
+					BS_EXCEPT(InvalidParametersException, "Buffer index out of range");
+
+				startSlot = std::min(iter->first, startSlot);
+				endSlot = std::max(iter->first, endSlot);
+			}
+
+			for (auto iter = vertexBuffers.begin(); iter != vertexBuffers.end(); ++iter)
+			{
+				buffers[iter->first - startSlot] = iter->second;
+			}
+
+			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1);
+		}
+
+		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
+		rapi.setIndexBuffer(indexBuffer);
+
+		rapi.setDrawOperation(subMesh.drawOp);
+
+		rapi.drawIndexedIndirect(argBuffer, 0, 1);
+
+		mesh->_notifyUsedOnGPU();
+	}
+
+	void RendererUtility::drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh,
 		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration)
 	{
 		// Bind buffers and draw
@@ -267,11 +311,14 @@ namespace bs { namespace ct
 		mesh->_notifyUsedOnGPU();
 	}
 
-	void RendererUtility::blit(const SPtr<Texture>& texture, const Rect2I& area, bool flipUV, bool isDepth)
+	void RendererUtility::blit(const SPtr<Texture>& texture, const Rect2I& area, bool flipUV, bool isDepth,
+		bool linearFiltering)
 	{
 		auto& texProps = texture->getProperties();
 
-		BlitMat* blitMat = BlitMat::getVariation(texProps.getNumSamples(), !isDepth);
+		bool filtered = linearFiltering && !isDepth && texProps.getNumSamples() <= 1;
+
+		BlitMat* blitMat = BlitMat::getVariation(texProps.getNumSamples(), !isDepth, filtered);
 		blitMat->setParameters(texture);
 		blitMat->bind();
 
@@ -284,7 +331,48 @@ namespace bs { namespace ct
 			fArea.height = (float)texProps.getHeight();
 		}
 
-		drawScreenQuad(fArea, Vector2I(1, 1), 1, flipUV);
+		// The filtered variation samples instead of loading per-pixel, and expects normalized UV
+		Vector2I textureSize(1, 1);
+		if (filtered)
+			textureSize = Vector2I(texProps.getWidth(), texProps.getHeight());
+
+		drawScreenQuad(fArea, textureSize, 1, flipUV);
+	}
+
+	void RendererUtility::generateMipmaps(const SPtr<Texture>& texture)
+	{
+		auto& props = texture->getProperties();
+
+		UINT32 numMips = props.getNumMipmaps();
+		if (numMips == 0)
+			return;
+
+		GenerateMipsMat* generateMipsMat = GenerateMipsMat::get();
+
+		// Each dispatch generates up to four mip levels. The dispatch samples from a scratch copy of the relevant
+		// source mip, since the APIs we support don't allow a texture to be bound for sampling and load-store access
+		// at the same time, even when the referenced mip levels don't overlap.
+		UINT32 srcMip = 0;
+		while (srcMip < numMips)
+		{
+			UINT32 numMipsInDispatch = std::min(numMips - srcMip, 4U);
+
+			TEXTURE_DESC scratchDesc;
+			scratchDesc.width = std::max(props.getWidth() >> srcMip, 1U);
+			scratchDesc.height = std::max(props.getHeight() >> srcMip, 1U);
+			scratchDesc.format = props.getFormat();
+
+			SPtr<Texture> scratch = Texture::create(scratchDesc);
+
+			TEXTURE_COPY_DESC copyDesc;
+			copyDesc.srcMip = srcMip;
+
+			texture->copy(scratch, copyDesc);
+
+			generateMipsMat->execute(scratch, texture, srcMip + 1, numMipsInDispatch);
+
+			srcMip += numMipsInDispatch;
+		}
 	}
 
 	void RendererUtility::drawScreenQuad(const Rect2& uv, const Vector2I& textureSize, UINT32 numInstances, bool flipUV)
@@ -369,6 +457,16 @@ namespace bs { namespace ct
 	BlitMat::BlitMat()
 	{
 		mParams->getTextureParam(GPT_FRAGMENT_PROGRAM, "gSource", mSource);
+
+		if (mParams->hasSamplerState(GPT_FRAGMENT_PROGRAM, "gSampler"))
+		{
+			SAMPLER_STATE_DESC desc;
+			desc.minFilter = FO_LINEAR;
+			desc.magFilter = FO_LINEAR;
+			desc.mipFilter = FO_POINT;
+
+			mParams->setSamplerState(GPT_FRAGMENT_PROGRAM, "gSampler", SamplerState::create(desc));
+		}
 	}
 
 	void BlitMat::setParameters(const SPtr<Texture>& source)
@@ -376,7 +474,7 @@ namespace bs { namespace ct
 		mSource.set(source);
 	}
 
-	BlitMat* BlitMat::getVariation(UINT32 msaaCount, bool isColor)
+	BlitMat* BlitMat::getVariation(UINT32 msaaCount, bool isColor, bool filtered)
 	{
 		if (msaaCount > 1)
 		{
@@ -385,12 +483,12 @@ namespace bs { namespace ct
 				switch(msaaCount)
 				{
 				case 2:
-					return get(getVariation<2, true>());
+					return get(getVariation<2, true, false>());
 				case 4:
-					return get(getVariation<4, true>());
+					return get(getVariation<4, true, false>());
 				default:
 				case 8:
-					return get(getVariation<8, true>());
+					return get(getVariation<8, true, false>());
 				}
 			}
 			else
@@ -398,17 +496,22 @@ namespace bs { namespace ct
 				switch(msaaCount)
 				{
 				case 2:
-					return get(getVariation<2, false>());
+					return get(getVariation<2, false, false>());
 				case 4:
-					return get(getVariation<4, false>());
+					return get(getVariation<4, false, false>());
 				default:
 				case 8:
-					return get(getVariation<8, false>());
+					return get(getVariation<8, false, false>());
 				}
 			}
 		}
 		else
-			return get(getVariation<1, true>());
+		{
+			if (filtered)
+				return get(getVariation<1, true, true>());
+
+			return get(getVariation<1, true, false>());
+		}
 	}
 
 	ClearParamDef gClearParamDef;
@@ -426,4 +529,48 @@ namespace bs { namespace ct
 		bind();
 		gRendererUtility().drawScreenQuad();
 	}
+
+	GenerateMipsParamDef gGenerateMipsParamDef;
+
+	GenerateMipsMat::GenerateMipsMat()
+	{
+		mParamBuffer = gGenerateMipsParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Input", mParamBuffer);
+		mParams->getTextureParam(GPT_COMPUTE_PROGRAM, "gInputTex", mInputTexture);
+
+		mParams->getLoadStoreTextureParam(GPT_COMPUTE_PROGRAM, "gOutputMip0", mOutputTextures[0]);
+		mParams->getLoadStoreTextureParam(GPT_COMPUTE_PROGRAM, "gOutputMip1", mOutputTextures[1]);
+		mParams->getLoadStoreTextureParam(GPT_COMPUTE_PROGRAM, "gOutputMip2", mOutputTextures[2]);
+		mParams->getLoadStoreTextureParam(GPT_COMPUTE_PROGRAM, "gOutputMip3", mOutputTextures[3]);
+	}
+
+	void GenerateMipsMat::execute(const SPtr<Texture>& source, const SPtr<Texture>& texture, UINT32 dstMip,
+		UINT32 numMips)
+	{
+		numMips = Math::clamp(numMips, 1U, MAX_MIPS_PER_DISPATCH);
+
+		auto& props = texture->getProperties();
+		UINT32 outWidth = std::max(props.getWidth() >> dstMip, 1U);
+		UINT32 outHeight = std::max(props.getHeight() >> dstMip, 1U);
+
+		gGenerateMipsParamDef.gNumMips.set(mParamBuffer, numMips);
+		gGenerateMipsParamDef.gOutSize.set(mParamBuffer, Vector2I(outWidth, outHeight));
+		gGenerateMipsParamDef.gInvOutSize.set(mParamBuffer, Vector2(1.0f / outWidth, 1.0f / outHeight));
+
+		mInputTexture.set(source);
+
+		for (UINT32 i = 0; i < MAX_MIPS_PER_DISPATCH; i++)
+		{
+			// All outputs must be bound to a valid surface, so clamp the unused ones to the last generated mip level.
+			// The shader guarantees they won't be written to.
+			UINT32 mip = dstMip + std::min(i, numMips - 1);
+			mOutputTextures[i].set(texture, TextureSurface(mip));
+		}
+
+		bind();
+
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.dispatchCompute(Math::divideAndRoundUp(outWidth, 8U), Math::divideAndRoundUp(outHeight, 8U));
+	}
 }}
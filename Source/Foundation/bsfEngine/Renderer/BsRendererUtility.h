@@ -22,13 +22,14 @@ namespace bs { namespace ct
 		RMAT_DEF("Blit.bsl");
 
 		/** Helper method used for initializing variations of this material. */
-		template<UINT32 msaa, bool color>
+		template<UINT32 msaa, bool color, bool filtered>
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
 			Vector<ShaderVariation::Param>{
 				ShaderVariation::Param("MSAA_COUNT", msaa),
 				ShaderVariation::Param("COLOR", color),
+				ShaderVariation::Param("FILTERED", filtered),
 			});
 
 			return variation;
@@ -39,7 +40,7 @@ namespace bs { namespace ct
 		/** Updates the parameter buffers used by the material. */
 		void setParameters(const SPtr<Texture>& source);
 
-		/** 
+		/**
 		 * Returns the material variation matching the provided parameters.
 		 *
 		 * @param	msaaCount		Number of MSAA samples in the input texture. If larger than 1 the texture will be resolved
@@ -48,8 +49,11 @@ namespace bs { namespace ct
 		 *							the input is a 1-component depth texture. This controls how is the texture resolve and is
 		 *							only relevant if @p msaaCount > 1. Color texture MSAA samples will be averaged, while for
 		 *							depth textures the minimum of all samples will be used.
+		 * @param	filtered		If true the source is sampled with bilinear filtering instead of loaded 1:1, allowing
+		 *							the blit to rescale the image when source and destination sizes don't match. Only
+		 *							relevant for non-multisampled color textures.
 		 */
-		static BlitMat* getVariation(UINT32 msaaCount, bool isColor);
+		static BlitMat* getVariation(UINT32 msaaCount, bool isColor, bool filtered = false);
 	private:
 		GpuParamTexture mSource;
 	};
@@ -74,9 +78,44 @@ namespace bs { namespace ct
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 	};
 
+	BS_PARAM_BLOCK_BEGIN(GenerateMipsParamDef)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gNumMips)
+		BS_PARAM_BLOCK_ENTRY(Vector2I, gOutSize)
+		BS_PARAM_BLOCK_ENTRY(Vector2, gInvOutSize)
+	BS_PARAM_BLOCK_END
+
+	extern GenerateMipsParamDef gGenerateMipsParamDef;
+
+	/** Compute shader that downsamples a texture mip level into up to four smaller mip levels in a single dispatch. */
+	class GenerateMipsMat : public RendererMaterial<GenerateMipsMat>
+	{
+		RMAT_DEF("GenerateMips.bsl");
+
+	public:
+		GenerateMipsMat();
+
+		/**
+		 * Generates @p numMips mip levels of @p texture, starting with @p dstMip, by downsampling the contents of
+		 * @p source. The texture must be created with the load-store flag.
+		 *
+		 * @param[in]	source		Texture containing the contents of the mip level preceding @p dstMip.
+		 * @param[in]	texture		Texture to output the mip levels to.
+		 * @param[in]	dstMip		First mip level to generate.
+		 * @param[in]	numMips		Number of mip levels to generate, in range [1, 4].
+		 */
+		void execute(const SPtr<Texture>& source, const SPtr<Texture>& texture, UINT32 dstMip, UINT32 numMips);
+
+	private:
+		static constexpr UINT32 MAX_MIPS_PER_DISPATCH = 4;
+
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamTexture mInputTexture;
+		GpuParamLoadStoreTexture mOutputTextures[MAX_MIPS_PER_DISPATCH];
+	};
+
 	/**
 	 * Contains various utility methods that make various common operations in the renderer easier.
-	 * 			
+	 *
 	 * @note	Core thread only.
 	 */
 	class BS_EXPORT RendererUtility : public Module<RendererUtility>
@@ -137,6 +176,20 @@ namespace bs { namespace ct
 		 */
 		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1);
 
+		/**
+		 * Draws the specified mesh using arguments sourced from a GPU buffer. The backend must support the
+		 * RSC_DRAW_INDIRECT capability.
+		 *
+		 * @param[in]	mesh			Mesh to draw.
+		 * @param[in]	subMesh			Portion of the mesh to draw. Only used for determining the draw operation, the
+		 *								index range is expected to be provided through the argument buffer.
+		 * @param[in]	argBuffer		Buffer of type GBT_INDIRECTARGUMENT containing a single DrawIndexedIndirectArgs
+		 *								entry describing the draw.
+		 *
+		 * @note	Core thread.
+		 */
+		void drawIndirect(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<GpuBuffer>& argBuffer);
+
 		/**
 		 * Draws the specified mesh with an additional vertex buffer containing morph shape vertices.
 		 *
@@ -163,9 +216,24 @@ namespace bs { namespace ct
 		 * @param[in]	isDepth	If true, the input texture is assumed to be a depth texture (instead of a color one).
 		 *						Multisampled depth textures will be resolved by taking the minimum value of all samples,
 		 *						unlike color textures which wil be averaged.
+		 * @param[in]	linearFiltering	If true the source is sampled with bilinear filtering, allowing the blit to
+		 *						rescale the image when the source size doesn't match the destination. Only supported
+		 *						for non-multisampled color textures, ignored otherwise.
+		 */
+		void blit(const SPtr<Texture>& texture, const Rect2I& area = Rect2I::EMPTY, bool flipUV = false,
+			bool isDepth = false, bool linearFiltering = false);
+
+		/**
+		 * Generates the entire mip chain of a 2D texture by repeatedly downsampling its first mip level, using a
+		 * compute shader that outputs up to four mip levels per dispatch. This is considerably faster than blitting
+		 * between individual mip levels. The texture must be created with the load-store flag and have power of two
+		 * dimensions.
+		 *
+		 * @param[in]	texture		Texture whose mip levels to generate. First mip level is expected to be populated.
+		 *
+		 * @note	Core thread.
 		 */
-		void blit(const SPtr<Texture>& texture, const Rect2I& area = Rect2I::EMPTY, bool flipUV = false, 
-			bool isDepth = false);
+		void generateMipmaps(const SPtr<Texture>& texture);
 
 		/**
 		 * Draws a quad over the entire viewport in normalized device coordinates.
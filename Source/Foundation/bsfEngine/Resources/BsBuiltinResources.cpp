@@ -81,6 +81,7 @@ namespace bs
 	/************************************************************************/
 
 	const String BuiltinResources::ShaderSpriteTextFile = u8"SpriteText.bsl";
+	const String BuiltinResources::ShaderSpriteTextSDFFile = u8"SpriteTextSDF.bsl";
 	const String BuiltinResources::ShaderSpriteImageAlphaFile = u8"SpriteImageAlpha.bsl";
 	const String BuiltinResources::ShaderSpriteImageNoAlphaFile = u8"SpriteImageNoAlpha.bsl";
 	const String BuiltinResources::ShaderSpriteLineFile = u8"SpriteLine.bsl";
@@ -217,6 +218,7 @@ namespace bs
 
 		// Load basic resources
 		mShaderSpriteText = getShader(ShaderSpriteTextFile);
+		mShaderSpriteTextSDF = getShader(ShaderSpriteTextSDFFile);
 		mShaderSpriteImage = getShader(ShaderSpriteImageAlphaFile);
 		mShaderSpriteNonAlphaImage = getShader(ShaderSpriteImageNoAlphaFile);
 		mShaderSpriteLine = getShader(ShaderSpriteLineFile);
@@ -872,6 +874,11 @@ namespace bs
 		return Material::create(mShaderSpriteText);
 	}
 
+	HMaterial BuiltinResources::createSpriteTextSDFMaterial() const
+	{
+		return Material::create(mShaderSpriteTextSDF);
+	}
+
 	HMaterial BuiltinResources::createSpriteImageMaterial() const
 	{
 		return Material::create(mShaderSpriteImage);
@@ -99,6 +99,9 @@ namespace bs
 		/**	Creates a material used for textual sprite rendering (for example text in GUI). */
 		HMaterial createSpriteTextMaterial() const;
 
+		/**	Creates a material used for rendering textual sprites using a signed distance field font. */
+		HMaterial createSpriteTextSDFMaterial() const;
+
 		/**	Creates a material used for image sprite rendering (for example images in GUI). */
 		HMaterial createSpriteImageMaterial() const;
 
@@ -182,6 +185,7 @@ namespace bs
 		HTexture mDummyTexture;
 
 		HShader mShaderSpriteText;
+		HShader mShaderSpriteTextSDF;
 		HShader mShaderSpriteImage;
 		HShader mShaderSpriteNonAlphaImage;
 		HShader mShaderSpriteLine;
@@ -240,6 +244,7 @@ namespace bs
 		static const Vector2I CursorSizeWEHotspot;
 
 		static const String ShaderSpriteTextFile;
+		static const String ShaderSpriteTextSDFFile;
 		static const String ShaderSpriteImageAlphaFile;
 		static const String ShaderSpriteImageNoAlphaFile;
 		static const String ShaderSpriteLineFile;
@@ -21,6 +21,12 @@ namespace bs
 	{
 		mTransform = Matrix4::IDENTITY;
 
+		for(UINT32 i = 0; i < 4; i++)
+		{
+			mPooledVertexCount[i] = 0;
+			mPooledIndexCount[i] = 0;
+		}
+
 		mSolidVertexDesc = bs_shared_ptr_new<VertexDataDesc>();
 		mSolidVertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
 		mSolidVertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
@@ -1216,7 +1222,10 @@ namespace bs
 		for(UINT32 i = 0; i < 4; i++)
 		{
 			if(meshData[i])
-				meshes[i] = Mesh::_createPtr(meshData[i]);
+			{
+				meshes[i] = allocPooledMesh(i, vertexCount[i], indexCount[i]);
+				meshes[i]->writeData(meshData[i], true);
+			}
 		}
 
 		for(auto& entry : meshInfos)
@@ -1241,4 +1250,29 @@ namespace bs
 
 		return meshInfos;
 	}
+
+	SPtr<Mesh> DrawHelper::allocPooledMesh(UINT32 typeIdx, UINT32 numVertices, UINT32 numIndices)
+	{
+		if (mPooledMeshes[typeIdx] == nullptr || mPooledVertexCount[typeIdx] < numVertices ||
+			mPooledIndexCount[typeIdx] < numIndices)
+		{
+			SPtr<VertexDataDesc> vertexDesc[4] = { mSolidVertexDesc, mWireVertexDesc, mLineVertexDesc, mTextVertexDesc };
+
+			// Grow in fixed increments so minor size fluctuations between frames don't trigger re-creation
+			UINT32 vertexCapacity = Math::divideAndRoundUp(numVertices, VERTEX_BUFFER_GROWTH) * VERTEX_BUFFER_GROWTH;
+			UINT32 indexCapacity = Math::divideAndRoundUp(numIndices, INDEX_BUFFER_GROWTH) * INDEX_BUFFER_GROWTH;
+
+			MESH_DESC meshDesc;
+			meshDesc.numVertices = vertexCapacity;
+			meshDesc.numIndices = indexCapacity;
+			meshDesc.vertexDesc = vertexDesc[typeIdx];
+			meshDesc.usage = MU_DYNAMIC;
+
+			mPooledMeshes[typeIdx] = Mesh::_createPtr(meshDesc);
+			mPooledVertexCount[typeIdx] = vertexCapacity;
+			mPooledIndexCount[typeIdx] = indexCapacity;
+		}
+
+		return mPooledMeshes[typeIdx];
+	}
 }
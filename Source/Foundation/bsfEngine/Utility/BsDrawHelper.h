@@ -225,6 +225,13 @@ namespace bs
 		static const UINT32 VERTEX_BUFFER_GROWTH;
 		static const UINT32 INDEX_BUFFER_GROWTH;
 
+		/**
+		 * Returns a pooled mesh for the specified mesh type, with capacity for at least the specified number of vertices
+		 * and indices. The same mesh is re-used between buildMeshes() calls and is only re-created when its capacity is
+		 * exceeded, avoiding per-frame GPU buffer creation for transient geometry.
+		 */
+		SPtr<Mesh> allocPooledMesh(UINT32 typeIdx, UINT32 numVertices, UINT32 numIndices);
+
 		Color mColor;
 		Matrix4 mTransform;
 		UINT64 mLayer;
@@ -250,6 +257,10 @@ namespace bs
 		SPtr<VertexDataDesc> mWireVertexDesc;
 		SPtr<VertexDataDesc> mLineVertexDesc;
 		SPtr<VertexDataDesc> mTextVertexDesc;
+
+		SPtr<Mesh> mPooledMeshes[4];
+		UINT32 mPooledVertexCount[4];
+		UINT32 mPooledIndexCount[4];
 	};
 
 	/** @} */
@@ -257,11 +257,26 @@ namespace bs
 			}
 		}
 
+		if (newBlock == nullptr)
+		{
+			// Check the shared pool first, the block might have been recently released by another thread's allocator
+			newBlock = getBlockPool().pop(blockSize);
+			if (newBlock != nullptr)
+			{
+				newBlock->clear();
+
+				mBlocks.push_back(newBlock);
+				mNextBlockIdx++;
+			}
+		}
+
 		if (newBlock == nullptr)
 		{
 			UINT32 alignOffset = 16 - (sizeof(MemBlock) & (16 - 1));
 
-			UINT8* data = (UINT8*)reinterpret_cast<UINT8*>(bs_alloc_aligned16(blockSize + sizeof(MemBlock) + alignOffset));
+			// Large blocks get backed by large pages where the platform supports it, reducing TLB pressure for code
+			// iterating over frame-allocated data
+			UINT8* data = (UINT8*)reinterpret_cast<UINT8*>(bs_alloc_large(blockSize + sizeof(MemBlock) + alignOffset));
 			newBlock = new (data) MemBlock(blockSize);
 			data += sizeof(MemBlock) + alignOffset;
 			newBlock->mData = data;
@@ -277,8 +292,81 @@ namespace bs
 
 	void FrameAlloc::deallocBlock(MemBlock* block)
 	{
+		// Recycle the block through the shared pool if it has room, so other frame allocators can reuse it
+		if (getBlockPool().push(block))
+			return;
+
+		UINT32 alignOffset = 16 - (sizeof(MemBlock) & (16 - 1));
+		UINT32 allocSize = block->mSize + sizeof(MemBlock) + alignOffset;
+
 		block->~MemBlock();
-		bs_free_aligned16(block);
+		bs_free_large(block, allocSize);
+	}
+
+	FrameAlloc::MemBlock* FrameAlloc::BlockPool::pop(UINT32 minSize)
+	{
+		// The pool is only touched when whole blocks are allocated or released, not on the per-allocation fast path,
+		// so a plain lock is cheap. It also guarantees a block cannot be inspected while another thread pops and
+		// frees it, which a lock-free list would need hazard pointers to ensure.
+		Lock lock(mMutex);
+
+		// Only the top block is considered. Searching deeper would keep the lock held longer for what is meant to be
+		// an opportunistic grab.
+		if (mFreeBlocks == nullptr || mFreeBlocks->mSize < minSize)
+			return nullptr;
+
+		MemBlock* block = mFreeBlocks;
+		mFreeBlocks = block->mNextFree;
+		block->mNextFree = nullptr;
+		mPooledBytes -= block->mSize;
+
+		return block;
+	}
+
+	bool FrameAlloc::BlockPool::push(MemBlock* block)
+	{
+		Lock lock(mMutex);
+
+		if (mPooledBytes + block->mSize > MAX_POOLED_BYTES)
+			return false;
+
+		mPooledBytes += block->mSize;
+
+		block->mNextFree = mFreeBlocks;
+		mFreeBlocks = block;
+
+		return true;
+	}
+
+	void FrameAlloc::BlockPool::clear()
+	{
+		MemBlock* block;
+		{
+			Lock lock(mMutex);
+
+			block = mFreeBlocks;
+			mFreeBlocks = nullptr;
+			mPooledBytes = 0;
+		}
+
+		while (block != nullptr)
+		{
+			MemBlock* next = block->mNextFree;
+
+			UINT32 alignOffset = 16 - (sizeof(MemBlock) & (16 - 1));
+			UINT32 allocSize = block->mSize + sizeof(MemBlock) + alignOffset;
+
+			block->~MemBlock();
+			bs_free_large(block, allocSize);
+
+			block = next;
+		}
+	}
+
+	FrameAlloc::BlockPool& FrameAlloc::getBlockPool()
+	{
+		static BlockPool pool;
+		return pool;
 	}
 
 	void FrameAlloc::setOwnerThread(ThreadId thread)
@@ -292,13 +380,24 @@ namespace bs
 		if (_GlobalFrameAlloc == nullptr)
 		{
 			// Note: This will leak memory but since it should exist throughout the entirety 
-			// of runtime it should only leak on shutdown when the OS will free it anyway.
+			// of runtime it should only leak on shutdown when the OS will free it anyway. Threads that get destroyed
+			// before then (e.g. pooled workers) should call bs_thread_frame_alloc_free() so their blocks recycle.
 			_GlobalFrameAlloc = new FrameAlloc();
 		}
 
 		return *_GlobalFrameAlloc;
 	}
 
+	BS_UTILITY_EXPORT void bs_thread_frame_alloc_free()
+	{
+		if (_GlobalFrameAlloc != nullptr)
+		{
+			// Destructor returns the blocks to the shared pool, where allocators on other threads can pick them up
+			delete _GlobalFrameAlloc;
+			_GlobalFrameAlloc = nullptr;
+		}
+	}
+
 	BS_UTILITY_EXPORT UINT8* bs_frame_alloc(UINT32 numBytes)
 	{
 		return gFrameAlloc().alloc(numBytes);
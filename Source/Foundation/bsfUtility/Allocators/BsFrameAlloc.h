@@ -47,6 +47,7 @@ namespace bs
 			UINT8* mData = nullptr;
 			UINT32 mFreePtr = 0;
 			UINT32 mSize;
+			MemBlock* mNextFree = nullptr; /**< Links blocks on the shared free-list while they're pooled. */
 		};
 
 	public:
@@ -150,6 +151,39 @@ namespace bs
 
 		/** Frees a memory block. */
 		void deallocBlock(MemBlock* block);
+
+		/**
+		 * Lock-free free-list shared by all frame allocators, so blocks released by one thread's allocator can be picked
+		 * up by another without a round-trip through the heap. Implemented as a Treiber stack with a modification
+		 * counter to protect against ABA.
+		 */
+		struct BlockPool
+		{
+			/**
+			 * Attempts to grab a pooled block of at least @p minSize bytes. Returns null if the pool is empty or the
+			 * top block is too small.
+			 */
+			MemBlock* pop(UINT32 minSize);
+
+			/**
+			 * Returns a block to the pool. Returns false if the pool is at capacity, in which case the caller should
+			 * free the block instead.
+			 */
+			bool push(MemBlock* block);
+
+			/** Releases all pooled blocks back to the heap. */
+			void clear();
+
+			Mutex mMutex;
+			MemBlock* mFreeBlocks = nullptr;
+			UINT32 mPooledBytes = 0;
+
+			/** Maximum amount of memory the pool will hold on to before blocks get freed for real. */
+			static constexpr UINT32 MAX_POOLED_BYTES = 32 * 1024 * 1024;
+		};
+
+		/** Returns the block pool shared by all frame allocators. */
+		static BlockPool& getBlockPool();
 	};
 
 	/** 
@@ -250,6 +284,15 @@ namespace bs
 	 */
 	BS_UTILITY_EXPORT FrameAlloc& gFrameAlloc();
 
+	/**
+	 * Destroys the calling thread's global frame allocator, returning its memory blocks to a shared pool where frame
+	 * allocators on other threads can reuse them. Should be called before a thread exits, particularly for short-lived
+	 * or pooled worker threads. A new allocator is transparently created if the thread allocates again afterwards.
+	 *
+	 * @note	Thread safe.
+	 */
+	BS_UTILITY_EXPORT void bs_thread_frame_alloc_free();
+
 	/**
 	 * Allocates some memory using the global frame allocator.
 	 *
@@ -2,8 +2,327 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Prerequisites/BsPrerequisitesUtil.h"
 
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+#include <windows.h>
+#elif BS_PLATFORM == BS_PLATFORM_LINUX || BS_PLATFORM == BS_PLATFORM_ANDROID
+#include <sys/mman.h>
+#endif
+
+#if BS_MEMORY_PROFILING
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#endif
+
 namespace bs
 {
 	UINT64 BS_THREADLOCAL MemoryCounter::Allocs = 0;
 	UINT64 BS_THREADLOCAL MemoryCounter::Frees = 0;
-}
\ No newline at end of file
+
+	/** Size of a large page. 2 MB on every platform we currently target. */
+	static const size_t LARGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+	/** Rounds @p size up to a multiple of the large page size when it's big enough to use large pages at all. */
+	static size_t largePageRoundUp(size_t size)
+	{
+		if (size < LARGE_PAGE_SIZE)
+			return size;
+
+		return (size + LARGE_PAGE_SIZE - 1) & ~(LARGE_PAGE_SIZE - 1);
+	}
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+	void* platformLargePageAlloc(size_t size)
+	{
+		if (size >= LARGE_PAGE_SIZE)
+		{
+			// Requires the SeLockMemoryPrivilege privilege, so this is expected to fail on default user accounts, in
+			// which case we quietly fall back to regular pages below.
+			size_t minLargePage = (size_t)GetLargePageMinimum();
+			if (minLargePage > 0)
+			{
+				size_t roundedSize = (size + minLargePage - 1) & ~(minLargePage - 1);
+				void* ptr = VirtualAlloc(nullptr, roundedSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+					PAGE_READWRITE);
+
+				if (ptr != nullptr)
+					return ptr;
+			}
+		}
+
+		return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	}
+
+	void platformLargePageFree(void* ptr, size_t size)
+	{
+		if (ptr == nullptr)
+			return;
+
+		VirtualFree(ptr, 0, MEM_RELEASE);
+	}
+#elif BS_PLATFORM == BS_PLATFORM_LINUX || BS_PLATFORM == BS_PLATFORM_ANDROID
+	void* platformLargePageAlloc(size_t size)
+	{
+		// Sizes get rounded up identically during free, so both the huge-page and the fallback path can unmap using
+		// just the original size.
+		size_t roundedSize = largePageRoundUp(size);
+
+#if defined(MAP_HUGETLB)
+		if (size >= LARGE_PAGE_SIZE)
+		{
+			// Fails unless huge pages were reserved by the administrator (vm.nr_hugepages), in which case we fall back
+			// to regular pages below.
+			void* ptr = mmap(nullptr, roundedSize, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+			if (ptr != MAP_FAILED)
+				return ptr;
+		}
+#endif
+
+		void* ptr = mmap(nullptr, roundedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (ptr == MAP_FAILED)
+			return nullptr;
+
+#if defined(MADV_HUGEPAGE)
+		// Ask the kernel to back the range with transparent huge pages where possible
+		if (size >= LARGE_PAGE_SIZE)
+			madvise(ptr, roundedSize, MADV_HUGEPAGE);
+#endif
+
+		return ptr;
+	}
+
+	void platformLargePageFree(void* ptr, size_t size)
+	{
+		if (ptr == nullptr)
+			return;
+
+		munmap(ptr, largePageRoundUp(size));
+	}
+#else
+	void* platformLargePageAlloc(size_t size)
+	{
+		return ::malloc(size);
+	}
+
+	void platformLargePageFree(void* ptr, size_t size)
+	{
+		::free(ptr);
+	}
+#endif
+
+#if BS_MEMORY_PROFILING
+	/**
+	 * Fixed-size per-thread statistics table. Only ever written by its owning thread, so no synchronization is needed
+	 * on the recording path. Reports read the tables from other threads without locking, which can observe values
+	 * mid-update, but that's acceptable for diagnostics.
+	 */
+	struct MemoryProfiler::ThreadTable
+	{
+		static const uint32_t NUM_SLOTS = 1024; // Must be a power of two
+		static const uint32_t MAX_PROBES = 32;
+
+		/** Statistics of a single call site. */
+		struct Slot
+		{
+			void* site;
+			uint64_t numAllocs;
+			uint64_t totalBytes;
+		};
+
+		ThreadTable()
+		{
+			clear(0);
+		}
+
+		/** Clears all recorded data and stamps the table with the provided epoch. */
+		void clear(uint32_t newEpoch)
+		{
+			memset(histogram, 0, sizeof(histogram));
+			memset(slots, 0, sizeof(slots));
+			numFrees = 0;
+			overflow = { (void*)(uintptr_t)-1, 0, 0 };
+			epoch = newEpoch;
+		}
+
+		/** Guards the global table registry. */
+		static Mutex& getMutex()
+		{
+			static Mutex mutex;
+			return mutex;
+		}
+
+		/** All thread tables ever created. Tables are never removed, matching the lifetime of their owning threads. */
+		static std::vector<ThreadTable*>& getTables()
+		{
+			static std::vector<ThreadTable*> tables;
+			return tables;
+		}
+
+		uint32_t epoch;
+		uint64_t numFrees;
+		uint64_t histogram[NUM_HISTOGRAM_BUCKETS];
+		Slot slots[NUM_SLOTS];
+		Slot overflow; /**< Shared entry for call sites that don't fit in the table. */
+
+		static BS_THREADLOCAL ThreadTable* tActiveTable;
+	};
+
+	BS_THREADLOCAL MemoryProfiler::ThreadTable* MemoryProfiler::ThreadTable::tActiveTable = nullptr;
+
+	/**
+	 * Epoch incremented on every reset(). Tables lazily clear themselves when they notice their epoch is out of date,
+	 * so reset() doesn't need to touch memory owned by other threads.
+	 */
+	static std::atomic<uint32_t> gMemoryProfilerEpoch{1};
+
+	MemoryProfiler::ThreadTable& MemoryProfiler::getThreadTable()
+	{
+		ThreadTable* table = ThreadTable::tActiveTable;
+		if (table == nullptr)
+		{
+			// Allocated through malloc directly so the profiler doesn't record its own memory. The thread-local
+			// pointer is assigned before registration so a recursive allocation can't re-enter this path.
+			table = new (::malloc(sizeof(ThreadTable))) ThreadTable();
+			ThreadTable::tActiveTable = table;
+
+			Lock lock(ThreadTable::getMutex());
+			ThreadTable::getTables().push_back(table);
+		}
+
+		return *table;
+	}
+
+	void MemoryProfiler::recordAlloc(size_t bytes, void* site)
+	{
+		ThreadTable& table = getThreadTable();
+
+		uint32_t epoch = gMemoryProfilerEpoch.load(std::memory_order_relaxed);
+		if (table.epoch != epoch)
+			table.clear(epoch);
+
+		uint32_t bucket = 0;
+		size_t value = bytes;
+		while (value >>= 1)
+			bucket++;
+
+		if (bucket >= NUM_HISTOGRAM_BUCKETS)
+			bucket = NUM_HISTOGRAM_BUCKETS - 1;
+
+		table.histogram[bucket]++;
+
+		ThreadTable::Slot* slot = &table.overflow;
+		uint32_t idx = (uint32_t)(((uintptr_t)site >> 4) * 2654435761U);
+		for (uint32_t i = 0; i < ThreadTable::MAX_PROBES; i++)
+		{
+			ThreadTable::Slot& candidate = table.slots[(idx + i) & (ThreadTable::NUM_SLOTS - 1)];
+			if (candidate.site == site || candidate.site == nullptr)
+			{
+				candidate.site = site;
+				slot = &candidate;
+				break;
+			}
+		}
+
+		slot->numAllocs++;
+		slot->totalBytes += bytes;
+	}
+
+	void MemoryProfiler::recordFree()
+	{
+		ThreadTable& table = getThreadTable();
+
+		uint32_t epoch = gMemoryProfilerEpoch.load(std::memory_order_relaxed);
+		if (table.epoch != epoch)
+			table.clear(epoch);
+
+		table.numFrees++;
+	}
+
+	uint32_t MemoryProfiler::getTopSites(SiteStats* output, uint32_t count)
+	{
+		uint32_t epoch = gMemoryProfilerEpoch.load(std::memory_order_relaxed);
+
+		std::unordered_map<void*, SiteStats> aggregated;
+		{
+			Lock lock(ThreadTable::getMutex());
+			for (auto& table : ThreadTable::getTables())
+			{
+				if (table->epoch != epoch)
+					continue; // Nothing recorded since the last reset
+
+				auto addSlot = [&aggregated](const ThreadTable::Slot& slot)
+				{
+					if (slot.site == nullptr || slot.numAllocs == 0)
+						return;
+
+					SiteStats& stats = aggregated[slot.site];
+					stats.site = slot.site;
+					stats.numAllocs += slot.numAllocs;
+					stats.totalBytes += slot.totalBytes;
+				};
+
+				for (auto& slot : table->slots)
+					addSlot(slot);
+
+				addSlot(table->overflow);
+			}
+		}
+
+		std::vector<SiteStats> sorted;
+		sorted.reserve(aggregated.size());
+		for (auto& entry : aggregated)
+			sorted.push_back(entry.second);
+
+		std::sort(sorted.begin(), sorted.end(),
+			[](const SiteStats& a, const SiteStats& b) { return a.totalBytes > b.totalBytes; });
+
+		uint32_t numOutput = std::min(count, (uint32_t)sorted.size());
+		for (uint32_t i = 0; i < numOutput; i++)
+			output[i] = sorted[i];
+
+		return numOutput;
+	}
+
+	uint64_t MemoryProfiler::getHistogramEntry(uint32_t bucket)
+	{
+		if (bucket >= NUM_HISTOGRAM_BUCKETS)
+			return 0;
+
+		uint32_t epoch = gMemoryProfilerEpoch.load(std::memory_order_relaxed);
+		uint64_t total = 0;
+
+		Lock lock(ThreadTable::getMutex());
+		for (auto& table : ThreadTable::getTables())
+		{
+			if (table->epoch == epoch)
+				total += table->histogram[bucket];
+		}
+
+		return total;
+	}
+
+	uint64_t MemoryProfiler::getNumFrees()
+	{
+		uint32_t epoch = gMemoryProfilerEpoch.load(std::memory_order_relaxed);
+		uint64_t total = 0;
+
+		Lock lock(ThreadTable::getMutex());
+		for (auto& table : ThreadTable::getTables())
+		{
+			if (table->epoch == epoch)
+				total += table->numFrees;
+		}
+
+		return total;
+	}
+
+	void MemoryProfiler::reset()
+	{
+		gMemoryProfilerEpoch.fetch_add(1, std::memory_order_relaxed);
+	}
+#endif // BS_MEMORY_PROFILING
+}
@@ -96,6 +96,96 @@ namespace bs
 	}
 #endif
 
+	/**
+	 * Allocates memory backed by large pages (typically 2 MB) when the platform supports them and @p size is large
+	 * enough to warrant it, reducing TLB pressure when the memory is scanned frequently. Gracefully falls back to
+	 * regular pages when large ones are unavailable. Large-size allocations get rounded up to a multiple of the large
+	 * page size, so this is only suitable for big, long-lived blocks (e.g. allocator backing pools). Returned memory is
+	 * aligned to at least 16 bytes and must be freed with platformLargePageFree(), providing the same size.
+	 */
+	BS_UTILITY_EXPORT void* platformLargePageAlloc(size_t size);
+
+	/** Frees memory allocated with platformLargePageAlloc(). @p size must match the size passed during allocation. */
+	BS_UTILITY_EXPORT void platformLargePageFree(void* ptr, size_t size);
+
+	/**
+	 * Define as 1 in the build settings to enable detailed memory allocation profiling. When enabled every allocation
+	 * and deallocation going through the framework allocators records its size and calling site into per-thread
+	 * buffers, queryable through MemoryProfiler. Adds a small constant cost to every allocation, so it's intended for
+	 * shipping-like profiling builds rather than being always on.
+	 */
+#ifndef BS_MEMORY_PROFILING
+	#define BS_MEMORY_PROFILING 0
+#endif
+
+#if BS_MEMORY_PROFILING
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+	extern "C" void* _ReturnAddress();
+	#define BS_MEMORY_CALL_SITE _ReturnAddress()
+#else
+	#define BS_MEMORY_CALL_SITE __builtin_return_address(0)
+#endif
+
+	/**
+	 * Records statistics about every allocation and deallocation going through the framework allocators: a histogram
+	 * of allocation sizes, and per-call-site allocation counts and byte totals. Statistics are gathered into
+	 * fixed-size per-thread hash tables without locking or allocating on the recording path.
+	 *
+	 * @note
+	 * Call sites are recorded as the return address of the allocation call. Since the allocator functions are inlined
+	 * this typically lands inside the subsystem performing the allocation and can be symbolized offline.
+	 * @note
+	 * Thread safe.
+	 */
+	class BS_UTILITY_EXPORT MemoryProfiler
+	{
+	public:
+		/** Aggregated statistics for a single allocating call site. */
+		struct SiteStats
+		{
+			void* site; /**< Address of the allocating call site. */
+			uint64_t numAllocs; /**< Number of allocations made from the site since the last reset. */
+			uint64_t totalBytes; /**< Total number of bytes allocated from the site since the last reset. */
+		};
+
+		/** Number of buckets in the allocation size histogram. Bucket N counts sizes in range [2^N, 2^(N+1)). */
+		static const uint32_t NUM_HISTOGRAM_BUCKETS = 32;
+
+		/** Records an allocation of the specified size, attributed to the provided call site. Lock-free. */
+		static void recordAlloc(size_t bytes, void* site);
+
+		/** Records a deallocation. Lock-free. */
+		static void recordFree();
+
+		/**
+		 * Writes up to @p count call sites with the highest allocated byte totals since the last reset into the
+		 * provided output buffer, aggregated over all threads and sorted by total descending. Returns the number of
+		 * entries written.
+		 */
+		static uint32_t getTopSites(SiteStats* output, uint32_t count);
+
+		/** Returns the number of allocations recorded in the specified size histogram bucket since the last reset. */
+		static uint64_t getHistogramEntry(uint32_t bucket);
+
+		/** Returns the number of deallocations recorded since the last reset. */
+		static uint64_t getNumFrees();
+
+		/**
+		 * Clears all recorded statistics. Call at a fixed point (for example once per frame) so reports returned by
+		 * getTopSites() correspond to a known interval.
+		 */
+		static void reset();
+
+	private:
+		struct ThreadTable;
+
+		/** Returns the statistics table of the calling thread, creating and registering it on first use. */
+		static ThreadTable& getThreadTable();
+	};
+
+#endif // BS_MEMORY_PROFILING
+
 	/**
 	 * Thread safe class used for storing total number of memory allocations and deallocations, primarily for statistic
 	 * purposes.
@@ -148,6 +238,9 @@ namespace bs
 #if BS_PROFILING_ENABLED
 			incAllocCount();
 #endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordAlloc(bytes, BS_MEMORY_CALL_SITE);
+#endif
 
 			return malloc(bytes);
 		}
@@ -161,6 +254,9 @@ namespace bs
 #if BS_PROFILING_ENABLED
 			incAllocCount();
 #endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordAlloc(bytes, BS_MEMORY_CALL_SITE);
+#endif
 
 			return platformAlignedAlloc(bytes, alignment);
 		}
@@ -171,16 +267,38 @@ namespace bs
 #if BS_PROFILING_ENABLED
 			incAllocCount();
 #endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordAlloc(bytes, BS_MEMORY_CALL_SITE);
+#endif
 
 			return platformAlignedAlloc16(bytes);
 		}
 
+		/**
+		 * Allocates @p bytes backed by large pages when the platform supports them, falling back to regular pages
+		 * otherwise. Only suitable for big (megabyte range), long-lived allocations. Must be freed with freeLarge().
+		 */
+		static void* allocateLarge(size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			incAllocCount();
+#endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordAlloc(bytes, BS_MEMORY_CALL_SITE);
+#endif
+
+			return platformLargePageAlloc(bytes);
+		}
+
 		/** Frees the memory at the specified location. */
 		static void free(void* ptr)
 		{
 #if BS_PROFILING_ENABLED
 			incFreeCount();
 #endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordFree();
+#endif
 
 			::free(ptr);
 		}
@@ -191,6 +309,9 @@ namespace bs
 #if BS_PROFILING_ENABLED
 			incFreeCount();
 #endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordFree();
+#endif
 
 			platformAlignedFree(ptr);
 		}
@@ -201,9 +322,25 @@ namespace bs
 #if BS_PROFILING_ENABLED
 			incFreeCount();
 #endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordFree();
+#endif
 
 			platformAlignedFree16(ptr);
 		}
+
+		/** Frees memory allocated with allocateLarge(). @p bytes must match the size passed during allocation. */
+		static void freeLarge(void* ptr, size_t bytes)
+		{
+#if BS_PROFILING_ENABLED
+			incFreeCount();
+#endif
+#if BS_MEMORY_PROFILING
+			MemoryProfiler::recordFree();
+#endif
+
+			platformLargePageFree(ptr, bytes);
+		}
 	};
 
 	/**
@@ -312,6 +449,16 @@ namespace bs
 		return MemoryAllocator<GenAlloc>::allocateAligned16(count);
 	}
 
+	/**
+	 * Allocates the specified number of bytes backed by large pages when the platform supports them. Only suitable for
+	 * big (megabyte range), long-lived allocations, such as allocator backing blocks. Returned memory is aligned to at
+	 * least 16 bytes.
+	 */
+	inline void* bs_alloc_large(size_t count)
+	{
+		return MemoryAllocator<GenAlloc>::allocateLarge(count);
+	}
+
 	/** Allocates enough bytes to hold an array of @p count elements the specified type, but doesn't construct them. */
 	template<class T>
 	inline T* bs_allocN(size_t count)
@@ -356,6 +503,12 @@ namespace bs
 		MemoryAllocator<GenAlloc>::freeAligned16(ptr);
 	}
 
+	/** Frees memory previously allocated with bs_alloc_large(). @p count must match the size passed during allocation. */
+	inline void bs_free_large(void* ptr, size_t count)
+	{
+		MemoryAllocator<GenAlloc>::freeLarge(ptr, count);
+	}
+
 /************************************************************************/
 /*			MACRO VERSIONS					*/
 /* You will almost always want to use the template versions but in some */
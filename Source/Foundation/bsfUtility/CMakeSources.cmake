@@ -4,6 +4,10 @@ set(BS_UTILITY_INC_THREADING
 	"bsfUtility/Threading/BsSpinLock.h"
 	"bsfUtility/Threading/BsThreadPool.h"
 	"bsfUtility/Threading/BsTaskScheduler.h"
+	"bsfUtility/Threading/BsWorkStealingQueue.h"
+	"bsfUtility/Threading/BsNumaTopology.h"
+	"bsfUtility/Threading/BsSpscQueue.h"
+	"bsfUtility/Threading/BsTripleBuffer.h"
 )
 
 set(BS_UTILITY_SRC_THIRDPARTY
@@ -50,29 +54,34 @@ set(BS_UTILITY_SRC_UTILITY
 	"bsfUtility/Utility/BsCompression.cpp"
 	"bsfUtility/Utility/BsTriangulation.cpp"
 	"bsfUtility/Utility/BsUUID.cpp"
+	"bsfUtility/Utility/BsBitwise.cpp"
 )
 
 set(BS_UTILITY_INC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.h"
 	"bsfUtility/Debug/BsDebug.h"
 	"bsfUtility/Debug/BsLog.h"
+	"bsfUtility/Debug/BsAsyncLog.h"
 )
 
 set(BS_UTILITY_INC_FILESYSTEM
 	"bsfUtility/FileSystem/BsFileSystem.h"
 	"bsfUtility/FileSystem/BsDataStream.h"
 	"bsfUtility/FileSystem/BsPath.h"
+	"bsfUtility/FileSystem/BsAsyncFileReader.h"
 )
 
 set(BS_UTILITY_SRC_FILESYSTEM
 	"bsfUtility/FileSystem/BsDataStream.cpp"
 	"bsfUtility/FileSystem/BsFileSystem.cpp"
 	"bsfUtility/FileSystem/BsPath.cpp"
+	"bsfUtility/FileSystem/BsAsyncFileReader.cpp"
 )
 
 set(BS_UTILITY_SRC_THREADING
 	"bsfUtility/Threading/BsAsyncOp.cpp"
 	"bsfUtility/Threading/BsTaskScheduler.cpp"
+	"bsfUtility/Threading/BsNumaTopology.cpp"
 	"bsfUtility/Threading/BsThreadPool.cpp"
 )
 
@@ -87,6 +96,7 @@ set(BS_UTILITY_INC_UTILITY
 	"bsfUtility/Utility/BsModule.h"
 	"bsfUtility/Utility/BsPlatformUtility.h"
 	"bsfUtility/Utility/BsServiceLocator.h"
+	"bsfUtility/Utility/BsSmallFunction.h"
 	"bsfUtility/Utility/BsTime.h"
 	"bsfUtility/Utility/BsTimer.h"
 	"bsfUtility/Utility/BsUtil.h"
@@ -97,6 +107,8 @@ set(BS_UTILITY_INC_UTILITY
 	"bsfUtility/Utility/BsUUID.h"
 	"bsfUtility/Utility/BsOctree.h"
 	"bsfUtility/Utility/BsDataBlob.h"
+	"bsfUtility/Utility/BsFlatHashMap.h"
+	"bsfUtility/Utility/BsSmallVector.h"
 )
 
 set(BS_UTILITY_SRC_ALLOCATORS
@@ -114,6 +126,7 @@ set(BS_UTILITY_SRC_REFLECTION
 set(BS_UTILITY_SRC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.cpp"
 	"bsfUtility/Debug/BsLog.cpp"
+	"bsfUtility/Debug/BsAsyncLog.cpp"
 	"bsfUtility/Debug/BsDebug.cpp"
 )
 
@@ -174,12 +187,14 @@ set(BS_UTILITY_INC_TESTING
 	"bsfUtility/Testing/BsTestSuite.h"
 	"bsfUtility/Testing/BsTestOutput.h"
 	"bsfUtility/Testing/BsConsoleTestOutput.h"
+	"bsfUtility/Testing/BsBenchmarkSuite.h"
 )
 
 set(BS_UTILITY_SRC_TESTING
 	"bsfUtility/Testing/BsTestSuite.cpp"
 	"bsfUtility/Testing/BsTestOutput.cpp"
 	"bsfUtility/Testing/BsConsoleTestOutput.cpp"
+	"bsfUtility/Testing/BsBenchmarkSuite.cpp"
 )
 
 set(BS_UTILITY_SRC_SERIALIZATION
@@ -187,6 +202,7 @@ set(BS_UTILITY_SRC_SERIALIZATION
 	"bsfUtility/Serialization/BsFileSerializer.cpp"
 	"bsfUtility/Serialization/BsBinarySerializer.cpp"
 	"bsfUtility/Serialization/BsBinaryDiff.cpp"
+	"bsfUtility/Serialization/BsBinaryJournal.cpp"
 	"bsfUtility/Serialization/BsSerializedObject.cpp"
 	"bsfUtility/Serialization/BsBinaryCloner.cpp"
 )
@@ -210,6 +226,7 @@ set(BS_UTILITY_INC_MATH
 	"bsfUtility/Math/BsVector4I.h"
 	"bsfUtility/Math/BsBounds.h"
 	"bsfUtility/Math/BsConvexVolume.h"
+	"bsfUtility/Math/BsConvexVolumePacket.h"
 	"bsfUtility/Math/BsTorus.h"
 	"bsfUtility/Math/BsLineSegment3.h"
 	"bsfUtility/Math/BsRect3.h"
@@ -231,6 +248,7 @@ set(BS_UTILITY_INC_SERIALIZATION
 	"bsfUtility/Serialization/BsFileSerializer.h"
 	"bsfUtility/Serialization/BsMemorySerializer.h"
 	"bsfUtility/Serialization/BsBinaryDiff.h"
+	"bsfUtility/Serialization/BsBinaryJournal.h"
 	"bsfUtility/Serialization/BsSerializedObject.h"
 	"bsfUtility/Serialization/BsBinaryCloner.h"
 )
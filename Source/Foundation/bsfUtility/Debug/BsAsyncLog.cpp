@@ -0,0 +1,275 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsAsyncLog.h"
+#include "Debug/BsLog.h"
+#include "String/BsString.h"
+
+#include <chrono>
+
+namespace bs
+{
+	namespace
+	{
+		/** Length of the rate limiting window, per channel. */
+		constexpr UINT64 RATE_LIMIT_WINDOW_MS = 1000;
+
+		/** How often the drain thread wakes up to check for new messages. */
+		constexpr UINT32 DRAIN_INTERVAL_MS = 10;
+
+		/** Returns the current time on a monotonic clock, in milliseconds. */
+		UINT64 getNowMs()
+		{
+			auto now = std::chrono::steady_clock::now().time_since_epoch();
+			return (UINT64)std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+		}
+	}
+
+	AsyncLog::AsyncLog(Log& sink)
+		:mSink(sink)
+	{ }
+
+	AsyncLog::~AsyncLog()
+	{
+		if (mThreadStarted.load(std::memory_order_acquire))
+		{
+			{
+				Lock lock(mStateMutex);
+				mRunning = false;
+			}
+
+			mStateSignal.notify_one();
+			mThread.join();
+		}
+
+		// Pick up anything recorded after the drain thread shut down
+		flush();
+	}
+
+	void AsyncLog::record(const AsyncLogEntry& entry)
+	{
+		ThreadBuffer* buffer = getThreadBuffer();
+		if (!buffer->entries.push(entry))
+			buffer->numDropped.fetch_add(1, std::memory_order_relaxed);
+
+		// Start the drain thread on first use, so merely constructing the log doesn't spin up a thread
+		if (!mThreadStarted.load(std::memory_order_acquire))
+		{
+			Lock lock(mStateMutex);
+			if (!mThreadStarted.load(std::memory_order_relaxed))
+			{
+				mRunning = true;
+				mThread = Thread(&AsyncLog::run, this);
+				mThreadStarted.store(true, std::memory_order_release);
+			}
+		}
+	}
+
+	AsyncLog::ThreadBuffer* AsyncLog::getThreadBuffer()
+	{
+		// Shared pointers keep a buffer alive until both its thread exited and the drain thread emptied it. The
+		// wrapper makes sure a buffer whose thread is gone gets drained one final time and then released.
+		struct ThreadBufferRef
+		{
+			~ThreadBufferRef()
+			{
+				if (buffer != nullptr)
+					buffer->retired.store(true, std::memory_order_release);
+			}
+
+			SPtr<ThreadBuffer> buffer;
+		};
+
+		static thread_local ThreadBufferRef ref;
+		if (ref.buffer == nullptr)
+		{
+			ref.buffer = bs_shared_ptr_new<ThreadBuffer>();
+
+			Lock lock(mBuffersMutex);
+			mBuffers.push_back(ref.buffer);
+		}
+
+		return ref.buffer.get();
+	}
+
+	void AsyncLog::run()
+	{
+		Lock lock(mStateMutex);
+		while (mRunning)
+		{
+			mStateSignal.wait_for(lock, std::chrono::milliseconds(DRAIN_INTERVAL_MS));
+
+			lock.unlock();
+			flush();
+			lock.lock();
+		}
+	}
+
+	void AsyncLog::flush()
+	{
+		Vector<SPtr<ThreadBuffer>> buffers;
+		{
+			Lock lock(mBuffersMutex);
+			buffers = mBuffers;
+		}
+
+		UINT64 now = getNowMs();
+
+		for (auto& buffer : buffers)
+		{
+			AsyncLogEntry entry;
+			while (buffer->entries.pop(entry))
+			{
+				if (!allowMessage(entry.channel, now))
+					continue;
+
+				mSink.logMsg(formatEntry(entry), entry.channel);
+			}
+
+			UINT32 numDropped = buffer->numDropped.exchange(0, std::memory_order_relaxed);
+			if (numDropped > 0)
+			{
+				mSink.logMsg("Dropped " + toString(numDropped) +
+					" deferred log message(s) because a thread's log buffer was full.", 0);
+			}
+		}
+
+		// Report messages suppressed by rate limiting once their window expires
+		for (auto& entry : mChannelStates)
+		{
+			ChannelState& state = entry.second;
+			if ((now - state.windowStartMs) < RATE_LIMIT_WINDOW_MS)
+				continue;
+
+			if (state.numSuppressed > 0)
+			{
+				mSink.logMsg("Suppressed " + toString(state.numSuppressed) + " log message(s) on channel " +
+					toString(entry.first) + " due to rate limiting.", entry.first);
+			}
+
+			state.windowStartMs = now;
+			state.numInWindow = 0;
+			state.numSuppressed = 0;
+		}
+
+		// Release buffers belonging to threads that have exited, once they're fully drained
+		{
+			Lock lock(mBuffersMutex);
+			for (auto iter = mBuffers.begin(); iter != mBuffers.end();)
+			{
+				if ((*iter)->retired.load(std::memory_order_acquire) && (*iter)->entries.size() == 0)
+					iter = mBuffers.erase(iter);
+				else
+					++iter;
+			}
+		}
+	}
+
+	bool AsyncLog::allowMessage(UINT32 channel, UINT64 nowMs)
+	{
+		ChannelState& state = mChannelStates[channel];
+		if (state.windowStartMs == 0)
+			state.windowStartMs = nowMs;
+
+		if ((nowMs - state.windowStartMs) >= RATE_LIMIT_WINDOW_MS)
+		{
+			state.windowStartMs = nowMs;
+			state.numInWindow = 0;
+		}
+
+		if (state.numInWindow >= mMaxPerSecond.load(std::memory_order_relaxed))
+		{
+			state.numSuppressed++;
+			return false;
+		}
+
+		state.numInWindow++;
+		return true;
+	}
+
+	String AsyncLog::formatEntry(const AsyncLogEntry& entry)
+	{
+		String params[AsyncLogEntry::MAX_PARAMS];
+		for (UINT32 i = 0; i < entry.numParams; i++)
+			params[i] = paramToString(entry.params[i]);
+
+		switch (entry.numParams)
+		{
+		default:
+		case 0:
+			return String(entry.format);
+		case 1:
+			return StringUtil::format(entry.format, params[0]);
+		case 2:
+			return StringUtil::format(entry.format, params[0], params[1]);
+		case 3:
+			return StringUtil::format(entry.format, params[0], params[1], params[2]);
+		case 4:
+			return StringUtil::format(entry.format, params[0], params[1], params[2], params[3]);
+		}
+	}
+
+	String AsyncLog::paramToString(const AsyncLogParam& param)
+	{
+		switch (param.type)
+		{
+		case AsyncLogParam::Type::Int:
+			return toString(param.intVal);
+		case AsyncLogParam::Type::Float:
+			return toString(param.floatVal);
+		case AsyncLogParam::Type::Bool:
+			return toString(param.boolVal);
+		case AsyncLogParam::Type::CString:
+			return String(param.strVal);
+		default:
+			return String();
+		}
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, INT32 value)
+	{
+		param.type = AsyncLogParam::Type::Int;
+		param.intVal = value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, UINT32 value)
+	{
+		param.type = AsyncLogParam::Type::Int;
+		param.intVal = value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, INT64 value)
+	{
+		param.type = AsyncLogParam::Type::Int;
+		param.intVal = value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, UINT64 value)
+	{
+		param.type = AsyncLogParam::Type::Int;
+		param.intVal = (INT64)value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, float value)
+	{
+		param.type = AsyncLogParam::Type::Float;
+		param.floatVal = value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, double value)
+	{
+		param.type = AsyncLogParam::Type::Float;
+		param.floatVal = value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, bool value)
+	{
+		param.type = AsyncLogParam::Type::Bool;
+		param.boolVal = value;
+	}
+
+	void AsyncLog::setParam(AsyncLogParam& param, const char* value)
+	{
+		param.type = AsyncLogParam::Type::CString;
+		param.strVal = value;
+	}
+}
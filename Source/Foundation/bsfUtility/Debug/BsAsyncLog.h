@@ -0,0 +1,178 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Threading/BsSpscQueue.h"
+#include "Threading/BsThreadDefines.h"
+#include <atomic>
+
+namespace bs
+{
+	class Log;
+
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/** A single parameter of a deferred log message, stored as plain data without formatting. */
+	struct AsyncLogParam
+	{
+		enum class Type : UINT32
+		{
+			None, Int, Float, Bool, CString
+		};
+
+		Type type = Type::None;
+		union
+		{
+			INT64 intVal;
+			double floatVal;
+			bool boolVal;
+			const char* strVal;
+		};
+	};
+
+	/**
+	 * A single deferred log message. Only a pointer to the format string and plain parameter values are stored, so
+	 * recording a message performs no allocation or formatting. The message is formatted later, when it is drained.
+	 *
+	 * @note
+	 * The format string isn't copied and must therefore remain valid until the message is drained - in practice it
+	 * should always be a string literal. The same applies to any C string parameters.
+	 */
+	struct AsyncLogEntry
+	{
+		enum { MAX_PARAMS = 4 };
+
+		const char* format = nullptr;
+		UINT32 channel = 0;
+		UINT32 numParams = 0;
+		AsyncLogParam params[MAX_PARAMS];
+	};
+
+	/**
+	 * Provides a logging path that records messages into per-thread lock-free ring buffers, with formatting deferred
+	 * to a background thread that drains the buffers and forwards the formatted messages to a Log. Since recording a
+	 * message never takes a lock, allocates or formats, it is safe to use in performance sensitive (e.g. per-frame)
+	 * code.
+	 *
+	 * To avoid a flood of messages dragging down the drain thread and the log itself, each channel is limited to a
+	 * maximum number of messages per second. Messages over the limit are counted and reported in a single summary
+	 * message once the second expires.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT AsyncLog
+	{
+		/** Ring buffer holding deferred messages recorded by a single thread. */
+		struct ThreadBuffer
+		{
+			SpscQueue<AsyncLogEntry> entries{ 1024 };
+			std::atomic<UINT32> numDropped{ 0 };
+			std::atomic<bool> retired{ false };
+		};
+
+		/** Rate limiting information for a single channel. Accessed only from the drain thread. */
+		struct ChannelState
+		{
+			UINT64 windowStartMs = 0;
+			UINT32 numInWindow = 0;
+			UINT32 numSuppressed = 0;
+		};
+
+	public:
+		/** Constructs a new asynchronous log that forwards drained messages to @p sink. */
+		AsyncLog(Log& sink);
+		~AsyncLog();
+
+		/**
+		 * Records a new message. Never blocks, allocates or formats. If the calling thread's buffer is full the
+		 * message is dropped and the number of dropped messages is reported when the buffer is next drained.
+		 *
+		 * @param[in]	format	Format string optionally containing "{0}"-style parameter identifiers, as accepted by
+		 *						StringUtil::format(). Must be a string literal (it is referenced, not copied).
+		 * @param[in]	channel	Channel in which to store the log entry.
+		 * @param[in]	args	Values to insert in place of the parameter identifiers. Only numbers, booleans and
+		 *						C string literals are supported, four parameters at most.
+		 */
+		template <class... Args>
+		void log(const char* format, UINT32 channel, Args... args)
+		{
+			static_assert(sizeof...(Args) <= (UINT32)AsyncLogEntry::MAX_PARAMS,
+				"Deferred log messages support at most AsyncLogEntry::MAX_PARAMS parameters.");
+
+			AsyncLogEntry entry;
+			entry.format = format;
+			entry.channel = channel;
+
+			encodeParams(entry, args...);
+			record(entry);
+		}
+
+		/**
+		 * Sets the maximum number of messages a single channel may output per second. Messages over the limit are
+		 * suppressed and reported in a summary message instead.
+		 */
+		void setRateLimit(UINT32 maxPerSecond) { mMaxPerSecond.store(maxPerSecond, std::memory_order_relaxed); }
+
+		/** Drains any pending messages into the sink log. Called automatically, but can be called manually as well. */
+		void flush();
+
+	private:
+		/** Records an already encoded entry into the calling thread's buffer, starting the drain thread if needed. */
+		void record(const AsyncLogEntry& entry);
+
+		/** Returns the buffer of the calling thread, creating and registering it if this is the first use. */
+		ThreadBuffer* getThreadBuffer();
+
+		/** Executes on the drain thread. Periodically drains all thread buffers until shutdown. */
+		void run();
+
+		/**
+		 * Checks the rate limit of the provided channel, registering one message against it. Returns false if the
+		 * message should be suppressed.
+		 */
+		bool allowMessage(UINT32 channel, UINT64 nowMs);
+
+		/** Formats a deferred entry into its final message text. */
+		static String formatEntry(const AsyncLogEntry& entry);
+
+		/** Converts a single stored parameter into string form. */
+		static String paramToString(const AsyncLogParam& param);
+
+		static void setParam(AsyncLogParam& param, INT32 value);
+		static void setParam(AsyncLogParam& param, UINT32 value);
+		static void setParam(AsyncLogParam& param, INT64 value);
+		static void setParam(AsyncLogParam& param, UINT64 value);
+		static void setParam(AsyncLogParam& param, float value);
+		static void setParam(AsyncLogParam& param, double value);
+		static void setParam(AsyncLogParam& param, bool value);
+		static void setParam(AsyncLogParam& param, const char* value);
+
+		static void encodeParams(AsyncLogEntry& entry) { }
+
+		template <class P, class... Rest>
+		static void encodeParams(AsyncLogEntry& entry, P param, Rest... rest)
+		{
+			setParam(entry.params[entry.numParams++], param);
+			encodeParams(entry, rest...);
+		}
+
+		Log& mSink;
+
+		Vector<SPtr<ThreadBuffer>> mBuffers;
+		Mutex mBuffersMutex;
+
+		UnorderedMap<UINT32, ChannelState> mChannelStates;
+		std::atomic<UINT32> mMaxPerSecond{ 32 };
+
+		Thread mThread;
+		std::atomic<bool> mThreadStarted{ false };
+		bool mRunning = false;
+		Mutex mStateMutex;
+		Signal mStateSignal;
+	};
+
+	/** @} */
+}
@@ -4,6 +4,7 @@
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Debug/BsLog.h"
+#include "Debug/BsAsyncLog.h"
 
 namespace bs
 {
@@ -41,9 +42,34 @@ namespace bs
 		/** Adds a log entry in the specified channel. You may specify custom channels as needed. */
 		void log(const String& msg, UINT32 channel);
 
+		/**
+		 * Adds a log entry in the specified channel without taking any locks or formatting the message. The message
+		 * is recorded into a per-thread buffer and formatted on a background thread, making this safe to use in
+		 * performance sensitive (e.g. per-frame) code. Channels are rate limited so a misbehaving subsystem cannot
+		 * flood the log.
+		 *
+		 * @param[in]	format	Format string optionally containing "{0}"-style parameter identifiers, as accepted by
+		 *						StringUtil::format(). Must be a string literal.
+		 * @param[in]	channel	Channel in which to store the log entry.
+		 * @param[in]	args	Values to insert in place of the parameter identifiers. Only numbers, booleans and
+		 *						C string literals are supported, four parameters at most.
+		 *
+		 * @note
+		 * Unlike log(), messages logged this way are not mirrored to the IDE console, and appear in the log with a
+		 * small delay.
+		 */
+		template <class... Args>
+		void logAsync(const char* format, UINT32 channel, Args... args)
+		{
+			mAsyncLog.log(format, channel, args...);
+		}
+
 		/** Retrieves the Log used by the Debug instance. */
 		Log& getLog() { return mLog; }
 
+		/** Retrieves the asynchronous log used by the Debug instance, e.g. for adjusting its rate limit. */
+		AsyncLog& getAsyncLog() { return mAsyncLog; }
+
 		/** Converts raw pixels into a BMP image and saves it as a file */
 		void writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, 
 			bool overwrite = true) const;
@@ -85,6 +111,7 @@ namespace bs
 	private:
 		UINT64 mLogHash = 0;
 		Log mLog;
+		AsyncLog mAsyncLog{ mLog };
 	};
 
 	/** A simpler way of accessing the Debug module. */
@@ -0,0 +1,128 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "FileSystem/BsAsyncFileReader.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+#include <algorithm>
+
+namespace bs
+{
+	AsyncFileReader::AsyncFileReader()
+	{
+		mIOThread = Thread(std::bind(&AsyncFileReader::run, this));
+	}
+
+	AsyncFileReader::~AsyncFileReader()
+	{
+		{
+			Lock lock(mMutex);
+			mShutdown = true;
+		}
+
+		mRequestsReady.notify_all();
+		mIOThread.join();
+	}
+
+	AsyncOp AsyncFileReader::readAsync(const Path& file, UINT64 offset, UINT64 size, UINT8* buffer,
+		std::function<void(UINT64)> callback)
+	{
+		ReadRequest request;
+		request.file = file;
+		request.offset = offset;
+		request.size = size;
+		request.buffer = buffer;
+		request.callback = std::move(callback);
+
+		AsyncOp op = request.op;
+
+		{
+			Lock lock(mMutex);
+			mQueuedRequests.push_back(std::move(request));
+			mNumActiveRequests++;
+		}
+
+		mRequestsReady.notify_one();
+		return op;
+	}
+
+	void AsyncFileReader::flush()
+	{
+		Lock lock(mMutex);
+		while (mNumActiveRequests > 0)
+			mRequestsDone.wait(lock);
+	}
+
+	void AsyncFileReader::run()
+	{
+		while (true)
+		{
+			Vector<ReadRequest> requests;
+			{
+				Lock lock(mMutex);
+				while (mQueuedRequests.empty() && !mShutdown)
+					mRequestsReady.wait(lock);
+
+				if (mQueuedRequests.empty() && mShutdown)
+					return;
+
+				requests.swap(mQueuedRequests);
+			}
+
+			processRequests(requests);
+
+			{
+				Lock lock(mMutex);
+				mNumActiveRequests -= (UINT32)requests.size();
+			}
+
+			mRequestsDone.notify_all();
+		}
+	}
+
+	void AsyncFileReader::processRequests(Vector<ReadRequest>& requests)
+	{
+		// Group requests by file and read ranges in ascending order, so each file in the batch is opened once and
+		// adjacent ranges turn into a single sequential pass
+		std::sort(requests.begin(), requests.end(),
+			[](const ReadRequest& a, const ReadRequest& b)
+		{
+			size_t hashA = a.file.getHash();
+			size_t hashB = b.file.getHash();
+			if (hashA != hashB)
+				return hashA < hashB;
+
+			return a.offset < b.offset;
+		});
+
+		SPtr<DataStream> stream;
+		Path streamPath;
+		for (auto& request : requests)
+		{
+			if (stream == nullptr || streamPath != request.file)
+			{
+				stream = FileSystem::openFile(request.file);
+				streamPath = request.file;
+			}
+
+			UINT64 bytesRead = 0;
+			if (stream != nullptr)
+			{
+				if (stream->tell() != request.offset)
+					stream->seek((size_t)request.offset);
+
+				bytesRead = (UINT64)stream->read(request.buffer, (size_t)request.size);
+			}
+
+			request.op._completeOperation(bytesRead);
+
+			if (request.callback != nullptr)
+				request.callback(bytesRead);
+		}
+	}
+
+	AsyncFileReader& gAsyncFileReader()
+	{
+		return AsyncFileReader::instance();
+	}
+}
@@ -0,0 +1,83 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "FileSystem/BsPath.h"
+#include "Threading/BsAsyncOp.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Filesystem
+	 *  @{
+	 */
+
+	/**
+	 * Performs file reads asynchronously on a dedicated I/O thread, so worker threads don't block in read() while
+	 * streaming resources. Requests are submitted with a file, offset, size and destination buffer and completed
+	 * through an AsyncOp and an optional callback.
+	 *
+	 * Submitted requests are batched: requests targeting the same file are grouped and sorted by offset, so the file
+	 * is opened once per batch and adjacent or nearby ranges are read in a single sequential pass without
+	 * re-seeking.
+	 */
+	class BS_UTILITY_EXPORT AsyncFileReader : public Module<AsyncFileReader>
+	{
+	public:
+		AsyncFileReader();
+		~AsyncFileReader();
+
+		/**
+		 * Queues an asynchronous read of a range of a file into the provided buffer.
+		 *
+		 * @param[in]	file		Path to the file to read from.
+		 * @param[in]	offset		Offset in bytes at which to begin reading.
+		 * @param[in]	size		Number of bytes to read.
+		 * @param[out]	buffer		Pre-allocated buffer of at least @p size bytes the data will be read into. Must
+		 *							remain valid until the request completes.
+		 * @param[in]	callback	Optional callback triggered when the read completes, receiving the number of bytes
+		 *							actually read. Triggered on the I/O thread, so it should be brief and thread safe.
+		 * @return					Async operation object you can use to poll for completion. Its return value is the
+		 *							number of bytes read, as UINT64. Zero bytes are reported if the file couldn't be
+		 *							opened or the range is out of bounds.
+		 */
+		AsyncOp readAsync(const Path& file, UINT64 offset, UINT64 size, UINT8* buffer,
+			std::function<void(UINT64)> callback = nullptr);
+
+		/** Blocks the calling thread until all queued read requests complete. */
+		void flush();
+
+	private:
+		/** A single queued read request. */
+		struct ReadRequest
+		{
+			Path file;
+			UINT64 offset;
+			UINT64 size;
+			UINT8* buffer;
+			std::function<void(UINT64)> callback;
+			AsyncOp op;
+		};
+
+		/** Method running on the I/O thread. Processes batches of queued requests until told to shut down. */
+		void run();
+
+		/** Executes a batch of requests, grouping requests by file and reading ranges in offset order. */
+		void processRequests(Vector<ReadRequest>& requests);
+
+		Thread mIOThread;
+		Vector<ReadRequest> mQueuedRequests;
+		UINT32 mNumActiveRequests = 0;
+		bool mShutdown = false;
+
+		Mutex mMutex;
+		Signal mRequestsReady;
+		Signal mRequestsDone;
+	};
+
+	/** Provides easier access to AsyncFileReader. */
+	BS_UTILITY_EXPORT AsyncFileReader& gAsyncFileReader();
+
+	/** @} */
+}
@@ -196,6 +196,12 @@ namespace bs
 		
 		/** Get a pointer to the current position in the memory block this stream holds. */
 		UINT8* getCurrentPtr() const { return mPos; }
+
+		/**
+		 * Checks does the stream own the memory block it holds (meaning the memory remains valid for as long as the
+		 * stream exists), as opposed to wrapping an externally managed block.
+		 */
+		bool ownsMemory() const { return mFreeOnClose; }
 		
 		/** @copydoc DataStream::read */
 		size_t read(void* buf, size_t count) override;
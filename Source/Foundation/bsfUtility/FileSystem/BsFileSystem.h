@@ -30,6 +30,17 @@ namespace bs
 		 */
 		static SPtr<DataStream> createAndOpenFile(const Path& fullPath);
 
+		/**
+		 * Maps the file at the specified path into memory and returns a read-only data stream accessing the file
+		 * contents directly through the mapping, without copying them into process memory first. The mapping remains
+		 * valid until the returned stream is closed or destroyed.
+		 *
+		 * @param[in]	fullPath	Full path to a file.
+		 * @return					Stream accessing the mapped file contents, or null if the file doesn't exist or
+		 *							cannot be mapped (for example if it is empty).
+		 */
+		static SPtr<DataStream> mapFile(const Path& fullPath);
+
 		/**
 		 * Returns the size of a file in bytes.
 		 *
@@ -49,6 +49,8 @@ namespace bs
 		std::swap(mDevice, path.mDevice);
 		std::swap(mNode, path.mNode);
 		std::swap(mIsAbsolute, path.mIsAbsolute);
+		std::swap(mCachedHash, path.mCachedHash);
+		std::swap(mCachedHashValid, path.mCachedHashValid);
 	}
 
 	void Path::assign(const Path& path)
@@ -58,6 +60,8 @@ namespace bs
 		mDevice = path.mDevice;
 		mNode = path.mNode;
 		mIsAbsolute = path.mIsAbsolute;
+		mCachedHash = path.mCachedHash;
+		mCachedHashValid = path.mCachedHashValid;
 	}
 
 	void Path::assign(const String& pathStr, PathType type)
@@ -147,6 +151,7 @@ namespace bs
 	{
 		Path copy = *this;
 		copy.mFilename.clear();
+		copy.mCachedHashValid = false;
 
 		return copy;
 	}
@@ -173,6 +178,7 @@ namespace bs
 			mFilename.clear();
 		}
 
+		mCachedHashValid = false;
 		return *this;
 	}
 
@@ -214,6 +220,7 @@ namespace bs
 		mDevice = "";
 		mNode = "";
 		mIsAbsolute = false;
+		mCachedHashValid = false;
 
 		return *this;
 	}
@@ -335,6 +342,7 @@ namespace bs
 			pushDirectory(dir);
 
 		mFilename = path.mFilename;
+		mCachedHashValid = false;
 
 		return *this;
 	}
@@ -342,6 +350,7 @@ namespace bs
 	void Path::setBasename(const String& basename)
 	{
 		mFilename = basename + getExtension();
+		mCachedHashValid = false;
 	}
 
 	void Path::setExtension(const String& extension)
@@ -351,6 +360,7 @@ namespace bs
 		stream << extension;
 
 		mFilename = stream.str();
+		mCachedHashValid = false;
 	}
 
 	String Path::getFilename(bool extension) const
@@ -404,6 +414,7 @@ namespace bs
 		mFilename.clear();
 		mNode.clear();
 		mIsAbsolute = false;
+		mCachedHashValid = false;
 	}
 
 	void Path::throwInvalidPathException(const String& path) const
@@ -482,6 +493,34 @@ namespace bs
 		return append(rhs);
 	}
 
+	size_t Path::getHash() const
+	{
+		if (mCachedHashValid)
+			return mCachedHash;
+
+		// Hashes the case insensitive form of the path so the hash agrees with equals(), with directories and the
+		// filename treated as a single element sequence since equals() allows the filename to match a trailing
+		// directory.
+		size_t hash = 0;
+		hash_combine(hash, mIsAbsolute);
+
+		if (mIsAbsolute)
+			hash_combine(hash, UTF8::toLower(mDevice));
+
+		hash_combine(hash, UTF8::toLower(mNode));
+
+		for (auto& dir : mDirectories)
+			hash_combine(hash, UTF8::toLower(dir));
+
+		if (!mFilename.empty())
+			hash_combine(hash, UTF8::toLower(mFilename));
+
+		mCachedHash = hash;
+		mCachedHashValid = true;
+
+		return hash;
+	}
+
 	bool Path::comparePathElem(const String& left, const String& right)
 	{
 		// Note: Might be more efficient to perform toLower character by character, and return as soon as comparison
@@ -512,6 +551,8 @@ namespace bs
 	{
 		if (!dir.empty() && dir != ".")
 		{
+			mCachedHashValid = false;
+
 			if (dir == "..")
 			{
 				if (!mDirectories.empty() && mDirectories.back() != "..")
@@ -55,6 +55,7 @@ namespace bs
 		 */
 		Path(const char* pathStr, PathType type = PathType::Default);
 		Path(const Path& other);
+		Path(Path&& other) = default;
 
 		/**
 		 * Assigns a path by parsing the provided path string. Path will be parsed according to the rules of the platform
@@ -69,6 +70,7 @@ namespace bs
 		Path& operator= (const char* pathStr);
 
 		Path& operator= (const Path& path);
+		Path& operator= (Path&& path) = default;
 
 		/**
 		 * Compares two paths and returns true if they match. Comparison is case insensitive and paths will be compared
@@ -202,7 +204,7 @@ namespace bs
 		bool equals(const Path& other) const;
 
 		/** Change or set the filename in the path. */
-		void setFilename(const String& filename) { mFilename = filename; }
+		void setFilename(const String& filename) { mFilename = filename; mCachedHashValid = false; }
 
 		/**
 		 * Change or set the base name in the path. Base name changes the filename by changing its base to the provided
@@ -257,6 +259,13 @@ namespace bs
 		/** Concatenates two paths. */
 		Path& operator+= (const Path& rhs);
 
+		/**
+		 * Returns a hash value that matches the case insensitive comparison rules used by equals(), suitable for using
+		 * paths as keys in hash based containers. The hash is computed on first use and cached, so repeated lookups
+		 * with the same Path object don't re-hash its components.
+		 */
+		size_t getHash() const;
+
 		/** Compares two path elements (filenames, directory names, etc.). */
 		static bool comparePathElem(const String& left, const String& right);
 
@@ -426,8 +435,8 @@ namespace bs
 			}
 		}
 
-		void setNode(const String& node) { mNode = node; }
-		void setDevice(const String& device) { mDevice = device; }
+		void setNode(const String& node) { mNode = node; mCachedHashValid = false; }
+		void setDevice(const String& device) { mDevice = device; mCachedHashValid = false; }
 
 		/** Build a Windows path string from internal path data. */
 		String buildWindows() const;
@@ -449,6 +458,9 @@ namespace bs
 		String mFilename;
 		String mNode;
 		bool mIsAbsolute = false;
+
+		mutable size_t mCachedHash = 0;
+		mutable bool mCachedHashValid = false;
 	};
 
 	/** @cond SPECIALIZATIONS */
@@ -486,6 +498,7 @@ namespace bs
 			memory = rttiReadElem(data.mFilename, memory);
 			memory = rttiReadElem(data.mIsAbsolute, memory);
 			rttiReadElem(data.mDirectories, memory);
+			data.mCachedHashValid = false;
 
 			return size;
 		}
@@ -520,15 +533,7 @@ namespace std
 	{
 		size_t operator()(const bs::Path& path) const
 		{
-			size_t hash = 0;
-			bs::hash_combine(hash, path.mFilename);
-			bs::hash_combine(hash, path.mDevice);
-			bs::hash_combine(hash, path.mNode);
-
-			for (auto& dir : path.mDirectories)
-				bs::hash_combine(hash, dir);
-
-			return hash;
+			return path.getHash();
 		}
 	};
 }
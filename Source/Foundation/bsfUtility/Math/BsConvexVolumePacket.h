@@ -0,0 +1,173 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Math/BsConvexVolume.h"
+#include "Math/BsAABox.h"
+#include "Math/BsSphere.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Structure-of-arrays representation of the planes of a ConvexVolume, padded to a multiple of the SIMD width so
+	 * multiple planes can be tested against a single shape per iteration. Intended to be built once per frame per
+	 * frustum and then re-used for all intersection tests against that frustum (culling, light assignment, broad-phase
+	 * or audibility queries).
+	 */
+	class ConvexVolumePacket
+	{
+	public:
+		ConvexVolumePacket() = default;
+
+		/** Builds the packet from the planes of the provided volume. */
+		explicit ConvexVolumePacket(const ConvexVolume& volume) { build(volume); }
+
+		/** Rebuilds the packet from the planes of the provided volume, replacing any previous contents. */
+		void build(const ConvexVolume& volume)
+		{
+			const Vector<Plane>& planes = volume.getPlanes();
+
+			mNumPlanes = (UINT32)planes.size();
+			const UINT32 padded = ((mNumPlanes + LANES - 1) / LANES) * LANES;
+
+			// Padding entries use a zero normal and a large negative plane distance, making them pass any intersection
+			// test without influencing the result
+			mNormalX.assign(padded, 0.0f);
+			mNormalY.assign(padded, 0.0f);
+			mNormalZ.assign(padded, 0.0f);
+			mDist.assign(padded, -1e30f);
+
+			for (UINT32 i = 0; i < mNumPlanes; i++)
+			{
+				mNormalX[i] = planes[i].normal.x;
+				mNormalY[i] = planes[i].normal.y;
+				mNormalZ[i] = planes[i].normal.z;
+				mDist[i] = planes[i].d;
+			}
+		}
+
+		/** Returns the number of (non-padding) planes in the packet. */
+		UINT32 getNumPlanes() const { return mNumPlanes; }
+
+		/**
+		 * Checks does the volume intersect the provided sphere. This will return true if the sphere is fully inside
+		 * the volume.
+		 */
+		bool intersects(const Sphere& sphere) const
+		{
+			const Vector3& center = sphere.getCenter();
+
+			simd::float32x4 cx = simd::splat(center.x);
+			simd::float32x4 cy = simd::splat(center.y);
+			simd::float32x4 cz = simd::splat(center.z);
+			simd::float32x4 radius = simd::splat(sphere.getRadius());
+
+			const UINT32 numPackets = (UINT32)mNormalX.size() / LANES;
+			for (UINT32 i = 0; i < numPackets; i++)
+			{
+				UINT32 base = i * LANES;
+
+				auto nx = simd::load_u<simd::float32x4>(&mNormalX[base]);
+				auto ny = simd::load_u<simd::float32x4>(&mNormalY[base]);
+				auto nz = simd::load_u<simd::float32x4>(&mNormalZ[base]);
+				auto d = simd::load_u<simd::float32x4>(&mDist[base]);
+
+				// Signed distance from each plane. The sphere is fully on the negative side of a plane (and therefore
+				// outside the volume) when the distance is below the negated radius.
+				simd::float32x4 dot = simd::add(simd::add(
+					simd::mul(cx, nx), simd::mul(cy, ny)), simd::mul(cz, nz));
+				simd::float32x4 dist = simd::sub(dot, d);
+
+				if (anyNegative(simd::add(dist, radius)))
+					return false;
+			}
+
+			return true;
+		}
+
+		/**
+		 * Checks does the volume intersect the provided axis aligned box. This will return true if the box is fully
+		 * inside the volume.
+		 */
+		bool intersects(const AABox& box) const
+		{
+			const Vector3 center = box.getCenter();
+			const Vector3 extents = box.getHalfSize();
+
+			simd::float32x4 cx = simd::splat(center.x);
+			simd::float32x4 cy = simd::splat(center.y);
+			simd::float32x4 cz = simd::splat(center.z);
+
+			simd::float32x4 ex = simd::splat(extents.x);
+			simd::float32x4 ey = simd::splat(extents.y);
+			simd::float32x4 ez = simd::splat(extents.z);
+
+			const UINT32 numPackets = (UINT32)mNormalX.size() / LANES;
+			for (UINT32 i = 0; i < numPackets; i++)
+			{
+				UINT32 base = i * LANES;
+
+				auto nx = simd::load_u<simd::float32x4>(&mNormalX[base]);
+				auto ny = simd::load_u<simd::float32x4>(&mNormalY[base]);
+				auto nz = simd::load_u<simd::float32x4>(&mNormalZ[base]);
+				auto d = simd::load_u<simd::float32x4>(&mDist[base]);
+
+				// Distance from each plane, offset by the effective radius of the box along the plane normal. The box
+				// is fully on the negative side of a plane (and therefore outside the volume) when negative.
+				simd::float32x4 dot = simd::add(simd::add(
+					simd::mul(cx, nx), simd::mul(cy, ny)), simd::mul(cz, nz));
+				simd::float32x4 dist = simd::sub(dot, d);
+
+				simd::float32x4 radius = simd::add(simd::add(
+					simd::mul(ex, simd::abs(nx)), simd::mul(ey, simd::abs(ny))), simd::mul(ez, simd::abs(nz)));
+
+				if (anyNegative(simd::add(dist, radius)))
+					return false;
+			}
+
+			return true;
+		}
+
+		/** Tests an array of spheres against the volume, outputting an intersection flag for each. */
+		void intersects(const Sphere* spheres, UINT32 count, bool* output) const
+		{
+			for (UINT32 i = 0; i < count; i++)
+				output[i] = intersects(spheres[i]);
+		}
+
+		/** Tests an array of axis aligned boxes against the volume, outputting an intersection flag for each. */
+		void intersects(const AABox* boxes, UINT32 count, bool* output) const
+		{
+			for (UINT32 i = 0; i < count; i++)
+				output[i] = intersects(boxes[i]);
+		}
+
+	private:
+		enum { LANES = 4 };
+
+		/** Checks if any lane of the provided register holds a negative value. */
+		static bool anyNegative(const simd::float32x4& value)
+		{
+			simd::mask_float32x4 negative = simd::cmp_lt(value, 0.0f);
+
+			SIMDPP_ALIGN(16) UINT32 laneMask[LANES];
+			simd::store(laneMask, simd::bit_cast<simd::uint32x4>(negative.unmask()));
+
+			return (laneMask[0] | laneMask[1] | laneMask[2] | laneMask[3]) != 0;
+		}
+
+		Vector<float> mNormalX;
+		Vector<float> mNormalY;
+		Vector<float> mNormalZ;
+		Vector<float> mDist;
+		UINT32 mNumPlanes = 0;
+	};
+
+	/** @} */
+}
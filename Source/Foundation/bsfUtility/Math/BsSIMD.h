@@ -6,6 +6,7 @@
 #include "Math/BsVector4.h"
 #include "Math/BsAABox.h"
 #include "Math/BsSphere.h"
+#include "Math/BsMatrix4.h"
 
 #define SIMDPP_ARCH_X86_SSE4_1
 
@@ -83,6 +84,209 @@ namespace bs
 			}
 		};
 
+		/**
+		 * Multiplies two 2x2 row-major matrices, each packed in a single SIMD register in (m00, m01, m10, m11) order.
+		 */
+		inline float32x4 mat2Mul(const float32x4& a, const float32x4& b)
+		{
+			return add(mul(a, permute4<0, 3, 0, 3>(b)), mul(permute4<1, 0, 3, 2>(a), permute4<2, 1, 2, 1>(b)));
+		}
+
+		/** Multiplies the adjugate of a packed 2x2 matrix with another packed 2x2 matrix. */
+		inline float32x4 mat2AdjMul(const float32x4& a, const float32x4& b)
+		{
+			return sub(mul(permute4<3, 3, 0, 0>(a), b), mul(permute4<1, 1, 2, 2>(a), permute4<2, 3, 0, 1>(b)));
+		}
+
+		/** Multiplies a packed 2x2 matrix with the adjugate of another packed 2x2 matrix. */
+		inline float32x4 mat2MulAdj(const float32x4& a, const float32x4& b)
+		{
+			return sub(mul(a, permute4<3, 0, 3, 0>(b)), mul(permute4<1, 0, 3, 2>(a), permute4<2, 1, 2, 1>(b)));
+		}
+
+		/** Concatenates (multiplies) two matrices using SIMD operations. Equivalent to @p a * @p b. */
+		inline bs::Matrix4 concat(const bs::Matrix4& a, const bs::Matrix4& b)
+		{
+			float32x4 b0 = load_u<float32x4>(&b[0]);
+			float32x4 b1 = load_u<float32x4>(&b[1]);
+			float32x4 b2 = load_u<float32x4>(&b[2]);
+			float32x4 b3 = load_u<float32x4>(&b[3]);
+
+			bs::Matrix4 output;
+			for (UINT32 i = 0; i < 4; i++)
+			{
+				float32x4 e0 = splat(a[i][0]);
+				float32x4 e1 = splat(a[i][1]);
+				float32x4 e2 = splat(a[i][2]);
+				float32x4 e3 = splat(a[i][3]);
+
+				float32x4 row = add(add(mul(e0, b0), mul(e1, b1)), add(mul(e2, b2), mul(e3, b3)));
+				store_u(&output[i], row);
+			}
+
+			return output;
+		}
+
+		/** Concatenates (multiplies) @p count matrix pairs using SIMD operations. Equivalent to @p a[i] * @p b[i]. */
+		inline void concat(const bs::Matrix4* a, const bs::Matrix4* b, UINT32 count, bs::Matrix4* output)
+		{
+			for (UINT32 i = 0; i < count; i++)
+				output[i] = concat(a[i], b[i]);
+		}
+
+		/** Transforms a 4D vector by a matrix using SIMD operations. Equivalent to @p mat * @p vec. */
+		inline bs::Vector4 transform(const bs::Matrix4& mat, const bs::Vector4& vec)
+		{
+			float32x4 v = load_u<float32x4>(&vec);
+
+			bs::Vector4 output;
+			output.x = reduce_add(mul(load_u<float32x4>(&mat[0]), v));
+			output.y = reduce_add(mul(load_u<float32x4>(&mat[1]), v));
+			output.z = reduce_add(mul(load_u<float32x4>(&mat[2]), v));
+			output.w = reduce_add(mul(load_u<float32x4>(&mat[3]), v));
+
+			return output;
+		}
+
+		/**
+		 * Transforms @p count 3D points by an affine matrix using SIMD operations, treating each point as if it had
+		 * a W component equal to one. The projection row of the matrix is ignored. @p input and @p output may point
+		 * to the same array.
+		 */
+		inline void transform(const bs::Matrix4& mat, const bs::Vector3* input, UINT32 count, bs::Vector3* output)
+		{
+			// Arrange the matrix as columns, so each point only requires broadcasts and multiply-adds
+			SIMDPP_ALIGN(16) float columns[4][4];
+			for (UINT32 row = 0; row < 4; row++)
+			{
+				for (UINT32 col = 0; col < 4; col++)
+					columns[col][row] = mat[row][col];
+			}
+
+			float32x4 c0 = load<float32x4>(columns[0]);
+			float32x4 c1 = load<float32x4>(columns[1]);
+			float32x4 c2 = load<float32x4>(columns[2]);
+			float32x4 c3 = load<float32x4>(columns[3]);
+
+			for (UINT32 i = 0; i < count; i++)
+			{
+				float32x4 x = splat(input[i].x);
+				float32x4 y = splat(input[i].y);
+				float32x4 z = splat(input[i].z);
+
+				float32x4 result = add(add(mul(x, c0), mul(y, c1)), add(mul(z, c2), c3));
+
+				SIMDPP_ALIGN(16) float values[4];
+				store(values, result);
+
+				output[i] = bs::Vector3(values[0], values[1], values[2]);
+			}
+		}
+
+		/**
+		 * Transforms the bounds of @p count axis aligned boxes by an affine matrix using SIMD operations. The output
+		 * bounds fully contain the transformed input bounds. @p input and @p output may point to the same array.
+		 */
+		inline void transform(const bs::Matrix4& mat, const AABox* input, UINT32 count, AABox* output)
+		{
+			SIMDPP_ALIGN(16) float columns[4][4];
+			for (UINT32 row = 0; row < 4; row++)
+			{
+				for (UINT32 col = 0; col < 4; col++)
+					columns[col][row] = mat[row][col];
+			}
+
+			float32x4 c0 = load<float32x4>(columns[0]);
+			float32x4 c1 = load<float32x4>(columns[1]);
+			float32x4 c2 = load<float32x4>(columns[2]);
+			float32x4 c3 = load<float32x4>(columns[3]);
+
+			// Extents only require the absolute rotation/scale part of the matrix
+			float32x4 a0 = abs(c0);
+			float32x4 a1 = abs(c1);
+			float32x4 a2 = abs(c2);
+
+			for (UINT32 i = 0; i < count; i++)
+			{
+				float32x4 cx = splat(input[i].center.x);
+				float32x4 cy = splat(input[i].center.y);
+				float32x4 cz = splat(input[i].center.z);
+
+				float32x4 center = add(add(mul(cx, c0), mul(cy, c1)), add(mul(cz, c2), c3));
+
+				float32x4 ex = splat(input[i].extents.x);
+				float32x4 ey = splat(input[i].extents.y);
+				float32x4 ez = splat(input[i].extents.z);
+
+				float32x4 extents = add(add(mul(ex, a0), mul(ey, a1)), mul(ez, a2));
+
+				store(&output[i].center, center);
+				store(&output[i].extents, extents);
+			}
+		}
+
+		/**
+		 * Calculates the inverse of a matrix using SIMD operations, using the block-wise Cramer's rule. The matrix
+		 * must not be singular.
+		 */
+		inline bs::Matrix4 invert(const bs::Matrix4& mat)
+		{
+			float32x4 r0 = load_u<float32x4>(&mat[0]);
+			float32x4 r1 = load_u<float32x4>(&mat[1]);
+			float32x4 r2 = load_u<float32x4>(&mat[2]);
+			float32x4 r3 = load_u<float32x4>(&mat[3]);
+
+			// Split the matrix into four 2x2 sub-matrices, each packed in a single register
+			float32x4 subA = shuffle4x2<0, 1, 4, 5>(r0, r1);
+			float32x4 subB = shuffle4x2<2, 3, 6, 7>(r0, r1);
+			float32x4 subC = shuffle4x2<0, 1, 4, 5>(r2, r3);
+			float32x4 subD = shuffle4x2<2, 3, 6, 7>(r2, r3);
+
+			// Determinants of all four sub-matrices, as (|A|, |B|, |C|, |D|)
+			float32x4 detSub = sub(
+				mul(shuffle4x2<0, 2, 4, 6>(r0, r2), shuffle4x2<1, 3, 5, 7>(r1, r3)),
+				mul(shuffle4x2<1, 3, 5, 7>(r0, r2), shuffle4x2<0, 2, 4, 6>(r1, r3)));
+
+			float detA = extract<0>(detSub);
+			float detB = extract<1>(detSub);
+			float detC = extract<2>(detSub);
+			float detD = extract<3>(detSub);
+
+			float32x4 D_C = mat2AdjMul(subD, subC);
+			float32x4 A_B = mat2AdjMul(subA, subB);
+
+			float32x4 sDetA = splat(detA);
+			float32x4 sDetB = splat(detB);
+			float32x4 sDetC = splat(detC);
+			float32x4 sDetD = splat(detD);
+
+			// Adjugates of the four sub-matrix blocks of the inverse
+			float32x4 x = sub(mul(sDetD, subA), mat2Mul(subB, D_C));
+			float32x4 w = sub(mul(sDetA, subD), mat2Mul(subC, A_B));
+			float32x4 y = sub(mul(sDetB, subC), mat2MulAdj(subD, A_B));
+			float32x4 z = sub(mul(sDetC, subB), mat2MulAdj(subA, D_C));
+
+			// Full determinant: |A||D| + |B||C| - tr((A#B)(D#C))
+			float trace = reduce_add(mul(A_B, permute4<0, 2, 1, 3>(D_C)));
+			float det = detA * detD + detB * detC - trace;
+
+			float32x4 signedInvDet = div(make_float<float32x4>(1.0f, -1.0f, -1.0f, 1.0f), (float32x4)splat(det));
+
+			x = mul(x, signedInvDet);
+			y = mul(y, signedInvDet);
+			z = mul(z, signedInvDet);
+			w = mul(w, signedInvDet);
+
+			// Applies the adjugate transpose of each block while storing
+			bs::Matrix4 output;
+			store_u(&output[0], shuffle4x2<3, 1, 7, 5>(x, y));
+			store_u(&output[1], shuffle4x2<2, 0, 6, 4>(x, y));
+			store_u(&output[2], shuffle4x2<3, 1, 7, 5>(z, w));
+			store_u(&output[3], shuffle4x2<2, 0, 6, 4>(z, w));
+
+			return output;
+		}
+
 		/** @} */
 	}
 }
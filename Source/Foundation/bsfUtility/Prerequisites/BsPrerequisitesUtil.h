@@ -209,6 +209,40 @@
 #define BS_ASSERT(x)
 #endif
 
+/**
+ * Determines which tier of runtime validity checks gets compiled in. Tier 2 (debug builds) enables all checks, tier 1
+ * (profile builds) retains hot-path validity checks in otherwise optimized code, and tier 0 (shipping builds) compiles
+ * them out entirely. Override by defining BS_CHECK_LEVEL yourself, or build using the Profile configuration to get
+ * tier 1.
+ */
+#ifndef BS_CHECK_LEVEL
+#	if BS_DEBUG_MODE
+#		define BS_CHECK_LEVEL 2
+#	elif defined(BS_PROFILE_MODE)
+#		define BS_CHECK_LEVEL 1
+#	else
+#		define BS_CHECK_LEVEL 0
+#	endif
+#endif
+
+#if BS_CHECK_LEVEL >= 1
+#define BS_CHECK_ONLY(x) x
+// Deliberately not implemented through assert(), as profile builds define NDEBUG which would compile the check out
+// of the very configuration tier 1 exists for
+#define BS_ASSERT_CHECKED(x)																		\
+	do																								\
+	{																								\
+		if (!(x))																					\
+		{																							\
+			fprintf(stderr, "Assertion failed: %s, file %s, line %d\n", #x, __FILE__, __LINE__);	\
+			std::abort();																			\
+		}																							\
+	} while (false)
+#else
+#define BS_CHECK_ONLY(x)
+#define BS_ASSERT_CHECKED(x)
+#endif
+
 // Script binding defines
 
 /**
@@ -266,6 +300,7 @@
 
 // Commonly used standard headers
 #include "Prerequisites/BsStdHeaders.h"
+#include "Utility/BsSmallVector.h"
 
 // Forward declarations
 #include "Prerequisites/BsFwdDeclUtil.h"
@@ -0,0 +1,26 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsFrameworkBenchmarkSuite.h"
+
+#include <cstdio>
+
+using namespace bs;
+
+int main(int argc, char* argv[])
+{
+	SPtr<BenchmarkSuite> benchmarks = FrameworkBenchmarkSuite::create<FrameworkBenchmarkSuite>();
+	Vector<BenchmarkResult> results = benchmarks->run();
+
+	for (auto& result : results)
+	{
+		printf("%s: mean %.4f ms, median %.4f ms, min %.4f ms, max %.4f ms, stddev %.4f ms (%u runs)\n",
+			result.name.c_str(), result.meanMs, result.medianMs, result.minMs, result.maxMs, result.stdDevMs,
+			result.numRuns);
+	}
+
+	// Optionally write a JSON report for automated comparison, if an output path was provided
+	if (argc > 1)
+		BenchmarkSuite::saveJSON(results, Path(argv[1]));
+
+	return 0;
+}
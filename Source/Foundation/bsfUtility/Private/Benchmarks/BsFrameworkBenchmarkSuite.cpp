@@ -0,0 +1,184 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Private/Benchmarks/BsFrameworkBenchmarkSuite.h"
+#include "Allocators/BsFrameAlloc.h"
+#include "Animation/BsAnimationCurve.h"
+#include "CoreThread/BsCommandQueue.h"
+#include "Image/BsPixelData.h"
+#include "Image/BsPixelUtil.h"
+#include "Math/BsMatrix4.h"
+#include "Reflection/BsRTTIType.h"
+#include "Serialization/BsMemorySerializer.h"
+
+namespace bs
+{
+	/** Accumulator the benchmarks write their outputs to, so the compiler can't optimize the measured work away. */
+	static volatile float gBenchmarkSink = 0.0f;
+
+	/** Simple reflectable object used for measuring serialization throughput. */
+	class BenchmarkObject : public IReflectable
+	{
+	public:
+		UINT32 intData = 0;
+		float floatData = 0.0f;
+		String stringData;
+		Vector<float> arrayData;
+
+		friend class BenchmarkObjectRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+	};
+
+	class BenchmarkObjectRTTI : public RTTIType<BenchmarkObject, IReflectable, BenchmarkObjectRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(intData, 0)
+			BS_RTTI_MEMBER_PLAIN(floatData, 1)
+			BS_RTTI_MEMBER_PLAIN(stringData, 2)
+			BS_RTTI_MEMBER_PLAIN(arrayData, 3)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "BenchmarkObject";
+			return name;
+		}
+
+		// Benchmark-only type, ID deliberately outside of any reserved framework range
+		UINT32 getRTTIId() override { return 200000; }
+		SPtr<IReflectable> newRTTIObject() override { return bs_shared_ptr_new<BenchmarkObject>(); }
+	};
+
+	RTTITypeBase* BenchmarkObject::getRTTIStatic()
+	{
+		return BenchmarkObjectRTTI::instance();
+	}
+
+	FrameworkBenchmarkSuite::FrameworkBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK(FrameworkBenchmarkSuite::benchFrameAlloc);
+		BS_ADD_BENCHMARK(FrameworkBenchmarkSuite::benchCommandQueue);
+		BS_ADD_BENCHMARK(FrameworkBenchmarkSuite::benchAnimationCurveEvaluate);
+		BS_ADD_BENCHMARK(FrameworkBenchmarkSuite::benchPixelConversion);
+		BS_ADD_BENCHMARK(FrameworkBenchmarkSuite::benchBinarySerializer);
+		BS_ADD_BENCHMARK(FrameworkBenchmarkSuite::benchMatrix4Multiply);
+	}
+
+	void FrameworkBenchmarkSuite::benchFrameAlloc()
+	{
+		static const UINT32 NUM_FRAMES = 100;
+		static const UINT32 NUM_ALLOCS = 1000;
+
+		FrameAlloc alloc(1024 * 1024);
+		for (UINT32 i = 0; i < NUM_FRAMES; i++)
+		{
+			alloc.markFrame();
+
+			for (UINT32 j = 0; j < NUM_ALLOCS; j++)
+			{
+				UINT8* data = alloc.alloc(64);
+				data[0] = (UINT8)j;
+				gBenchmarkSink += data[0];
+			}
+
+			alloc.clear();
+		}
+	}
+
+	void FrameworkBenchmarkSuite::benchCommandQueue()
+	{
+		static const UINT32 NUM_FLUSHES = 100;
+		static const UINT32 NUM_COMMANDS = 1000;
+
+		CommandQueue<CommandQueueNoSync> queue(BS_THREAD_CURRENT_ID);
+		for (UINT32 i = 0; i < NUM_FLUSHES; i++)
+		{
+			for (UINT32 j = 0; j < NUM_COMMANDS; j++)
+				queue.queue([]() { gBenchmarkSink += 1.0f; });
+
+			queue.playback(queue.flush());
+		}
+	}
+
+	void FrameworkBenchmarkSuite::benchAnimationCurveEvaluate()
+	{
+		static const UINT32 NUM_KEYFRAMES = 32;
+		static const UINT32 NUM_EVALUATIONS = 100000;
+
+		Vector<TKeyframe<float>> keyframes(NUM_KEYFRAMES);
+		for (UINT32 i = 0; i < NUM_KEYFRAMES; i++)
+		{
+			keyframes[i].time = i * 0.1f;
+			keyframes[i].value = Math::sin(i * 0.5f);
+			keyframes[i].inTangent = 1.0f;
+			keyframes[i].outTangent = 1.0f;
+		}
+
+		TAnimationCurve<float> curve(keyframes);
+		float length = curve.getLength();
+		for (UINT32 i = 0; i < NUM_EVALUATIONS; i++)
+			gBenchmarkSink += curve.evaluate((i * 0.0001f) * length);
+	}
+
+	void FrameworkBenchmarkSuite::benchPixelConversion()
+	{
+		static const UINT32 SIZE = 256;
+
+		PixelData src(SIZE, SIZE, 1, PF_RGBA8);
+		src.allocateInternalBuffer();
+
+		UINT8* srcData = src.getData();
+		for (UINT32 i = 0; i < src.getSize(); i++)
+			srcData[i] = (UINT8)i;
+
+		PixelData dst(SIZE, SIZE, 1, PF_BGRA8);
+		dst.allocateInternalBuffer();
+
+		PixelUtil::bulkPixelConversion(src, dst);
+		gBenchmarkSink += dst.getData()[0];
+	}
+
+	void FrameworkBenchmarkSuite::benchBinarySerializer()
+	{
+		static const UINT32 NUM_OBJECTS = 100;
+
+		BenchmarkObject object;
+		object.intData = 12345;
+		object.floatData = 67.89f;
+		object.stringData = "Benchmark string data";
+		object.arrayData.resize(256);
+		for (UINT32 i = 0; i < (UINT32)object.arrayData.size(); i++)
+			object.arrayData[i] = (float)i;
+
+		MemorySerializer serializer;
+		for (UINT32 i = 0; i < NUM_OBJECTS; i++)
+		{
+			UINT32 bytesWritten = 0;
+			UINT8* data = serializer.encode(&object, bytesWritten);
+
+			SPtr<IReflectable> decoded = serializer.decode(data, bytesWritten);
+			gBenchmarkSink += std::static_pointer_cast<BenchmarkObject>(decoded)->floatData;
+
+			bs_free(data);
+		}
+	}
+
+	void FrameworkBenchmarkSuite::benchMatrix4Multiply()
+	{
+		static const UINT32 NUM_MULTIPLIES = 100000;
+
+		Matrix4 a = Matrix4::translation(Vector3(1.0f, 2.0f, 3.0f));
+		Matrix4 b = Matrix4::scaling(Vector3(0.5f, 0.5f, 0.5f));
+
+		Matrix4 output = Matrix4::IDENTITY;
+		for (UINT32 i = 0; i < NUM_MULTIPLIES; i++)
+		{
+			output = a * b;
+			a[0][0] = output[0][0] + 1.0f; // Creates a dependency chain so iterations can't be folded together
+		}
+
+		gBenchmarkSink += output[3][3];
+	}
+}
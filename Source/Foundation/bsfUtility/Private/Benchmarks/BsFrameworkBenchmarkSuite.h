@@ -0,0 +1,24 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Testing/BsBenchmarkSuite.h"
+
+namespace bs
+{
+	/** Benchmarks covering framework hot paths that have historically regressed. */
+	class FrameworkBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		FrameworkBenchmarkSuite();
+
+	private:
+		void benchFrameAlloc();
+		void benchCommandQueue();
+		void benchAnimationCurveEvaluate();
+		void benchPixelConversion();
+		void benchBinarySerializer();
+		void benchMatrix4Multiply();
+	};
+}
@@ -78,6 +78,32 @@ namespace bs
 			*(UINT32*)&nativeUUID[12]);
 	}
 
+	void PlatformUtility::generateRandom(UINT8* buffer, UINT32 count)
+	{
+		FILE* urandom = fopen("/dev/urandom", "rb");
+		if (urandom != nullptr)
+		{
+			size_t numRead = fread(buffer, 1, count, urandom);
+			fclose(urandom);
+
+			if (numRead == count)
+				return;
+		}
+
+		// Reading the system entropy source failed, fall back to deriving the bytes from generated UUIDs
+		UINT32 written = 0;
+		while (written < count)
+		{
+			uuid_t nativeUUID;
+			uuid_generate(nativeUUID);
+
+			UINT32 numBytes = std::min(count - written, (UINT32)sizeof(nativeUUID));
+			memcpy(buffer + written, nativeUUID, numBytes);
+
+			written += numBytes;
+		}
+	}
+
 	String PlatformUtility::convertCaseUTF8(const bs::String& input, bool toUpper)
 	{
 		CFMutableStringRef mutableString = CFStringCreateMutable(nullptr, 0);
@@ -8,6 +8,8 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -150,6 +152,70 @@ namespace bs
 		return bs_shared_ptr_new<FileDataStream>(path, DataStream::AccessMode::WRITE, true);
 	}
 
+	/** Read-only stream accessing the contents of a memory-mapped file. Unmaps the file when the stream is closed. */
+	class UnixMappedFileDataStream : public MemoryDataStream
+	{
+	public:
+		UnixMappedFileDataStream(void* memory, size_t size)
+			:MemoryDataStream(memory, size, false)
+		{
+			mAccess = READ;
+		}
+
+		~UnixMappedFileDataStream()
+		{
+			unmap();
+		}
+
+		size_t write(const void* buf, size_t count) override { return 0; }
+
+		void close() override
+		{
+			unmap();
+			MemoryDataStream::close();
+		}
+
+	private:
+		/** Releases the file mapping, if it wasn't released already. */
+		void unmap()
+		{
+			if (mData != nullptr)
+				munmap(mData, mSize);
+		}
+	};
+
+	SPtr<DataStream> FileSystem::mapFile(const Path& fullPath)
+	{
+		String pathString = fullPath.toString();
+
+		int fileDesc = open(pathString.c_str(), O_RDONLY);
+		if (fileDesc == -1)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return nullptr;
+		}
+
+		struct stat st_buf;
+		if (fstat(fileDesc, &st_buf) != 0 || st_buf.st_size == 0)
+		{
+			::close(fileDesc);
+			return nullptr;
+		}
+
+		void* memory = mmap(nullptr, (size_t)st_buf.st_size, PROT_READ, MAP_PRIVATE, fileDesc, 0);
+
+		// The mapping keeps its own reference to the file
+		::close(fileDesc);
+
+		if (memory == MAP_FAILED)
+		{
+			HANDLE_PATH_ERROR(pathString, errno);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<UnixMappedFileDataStream>(memory, (size_t)st_buf.st_size);
+	}
+
 	UINT64 FileSystem::getFileSize(const Path& path)
 	{
 		struct stat st_buf;
@@ -293,6 +293,89 @@ namespace bs
 		return bs_shared_ptr_new<FileDataStream>(fullPath, DataStream::AccessMode::WRITE, true);
 	}
 
+	/** Read-only stream accessing the contents of a memory-mapped file. Unmaps the file when the stream is closed. */
+	class Win32MappedFileDataStream : public MemoryDataStream
+	{
+	public:
+		Win32MappedFileDataStream(void* memory, size_t size)
+			:MemoryDataStream(memory, size, false)
+		{
+			mAccess = READ;
+		}
+
+		~Win32MappedFileDataStream()
+		{
+			unmap();
+		}
+
+		size_t write(const void* buf, size_t count) override { return 0; }
+
+		void close() override
+		{
+			unmap();
+			MemoryDataStream::close();
+		}
+
+	private:
+		/** Releases the file mapping, if it wasn't released already. */
+		void unmap()
+		{
+			if (mData != nullptr)
+				UnmapViewOfFile(mData);
+		}
+	};
+
+	SPtr<DataStream> FileSystem::mapFile(const Path& fullPath)
+	{
+		WString pathWString = UTF8::toWide(fullPath.toString());
+		const wchar_t* pathString = pathWString.c_str();
+
+		if (!win32_pathExists(pathString) || !win32_isFile(pathString))
+		{
+			LOGWRN("Attempting to map a file that doesn't exist: " + fullPath.toString());
+			return nullptr;
+		}
+
+		HANDLE fileHandle = CreateFileW(pathString, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(fileHandle);
+			return nullptr;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		// The mapping keeps its own reference to the file
+		CloseHandle(fileHandle);
+
+		if (mappingHandle == nullptr)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		void* memory = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+		// And the view keeps a reference to the mapping
+		CloseHandle(mappingHandle);
+
+		if (memory == nullptr)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<Win32MappedFileDataStream>(memory, (size_t)fileSize.QuadPart);
+	}
+
 	UINT64 FileSystem::getFileSize(const Path& fullPath)
 	{
 		return win32_getFileSize(UTF8::toWide(fullPath.toString()));
@@ -4,6 +4,7 @@
 #include "Private/Win32/BsWin32PlatformUtility.h"
 #include "Image/BsColor.h"
 #include <windows.h>
+#include <wincrypt.h>
 #include <iphlpapi.h>
 #include <VersionHelpers.h>
 #include <intrin.h>
@@ -139,6 +140,34 @@ namespace bs
 		return UUID(data1, data2, data3, data4);
 	}
 
+	void PlatformUtility::generateRandom(UINT8* buffer, UINT32 count)
+	{
+		// Acquired once and intentionally never released, the provider is valid for the lifetime of the process
+		static HCRYPTPROV provider = []()
+		{
+			HCRYPTPROV output = 0;
+			if (!CryptAcquireContextW(&output, nullptr, nullptr, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT | CRYPT_SILENT))
+				output = 0;
+
+			return output;
+		}();
+
+		if (provider != 0 && CryptGenRandom(provider, count, buffer))
+			return;
+
+		// Acquiring the system entropy source failed, fall back to deriving the bytes from generated UUIDs
+		UINT32 written = 0;
+		while (written < count)
+		{
+			UUID uuid = generateUUID();
+
+			UINT32 numBytes = std::min(count - written, (UINT32)sizeof(uuid));
+			memcpy(buffer + written, &uuid, numBytes);
+
+			written += numBytes;
+		}
+	}
+
 	String PlatformUtility::convertCaseUTF8(const String& input, bool toUpper)
 	{
 		if(input.empty())
@@ -7,17 +7,36 @@
 
 namespace bs
 {
+	/**
+	 * Global type id to RTTI type lookup table. Populated during static initialization as types register themselves,
+	 * so lookups during deserialization don't need to walk the type hierarchy.
+	 */
+	static UnorderedMap<UINT32, RTTITypeBase*>& getIdToTypeRegistry()
+	{
+		static UnorderedMap<UINT32, RTTITypeBase*> registry;
+		return registry;
+	}
+
 	void IReflectable::_registerDerivedClass(RTTITypeBase* derivedClass)
 	{
 		if(_isTypeIdDuplicate(derivedClass->getRTTIId()))
 		{
-			BS_EXCEPT(InternalErrorException, "RTTI type \"" + derivedClass->getRTTIName() + 
+			BS_EXCEPT(InternalErrorException, "RTTI type \"" + derivedClass->getRTTIName() +
 				"\" has a duplicate ID: " + toString(derivedClass->getRTTIId()));
 		}
 
+		_registerRTTIType(derivedClass);
 		getDerivedClasses().push_back(derivedClass);
 	}
 
+	void IReflectable::_registerRTTIType(RTTITypeBase* rttiType)
+	{
+		if(rttiType->getRTTIId() == TID_Abstract)
+			return;
+
+		getIdToTypeRegistry().emplace(rttiType->getRTTIId(), rttiType);
+	}
+
 	SPtr<IReflectable> IReflectable::createInstanceFromTypeId(UINT32 rttiTypeId)
 	{
 		RTTITypeBase* type = _getRTTIfromTypeId(rttiTypeId);
@@ -34,6 +53,13 @@ namespace bs
 
 	RTTITypeBase* IReflectable::_getRTTIfromTypeId(UINT32 rttiTypeId)
 	{
+		const auto& registry = getIdToTypeRegistry();
+		auto iterFind = registry.find(rttiTypeId);
+		if(iterFind != registry.end())
+			return iterFind->second;
+
+		// Fall back to walking the hierarchy, in case a type was registered through a custom RTTITypeBase
+		// implementation that bypasses the registry
 		Stack<RTTITypeBase*> todo;
 
 		for(const auto& item : getDerivedClasses())
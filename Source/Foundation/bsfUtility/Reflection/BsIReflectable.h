@@ -62,6 +62,12 @@ namespace bs
 		/** Called by each type deriving from IReflectable, on program load. */
 		static void _registerDerivedClass(RTTITypeBase* derivedClass);
 
+		/**
+		 * Called by each RTTI type on program load in order to register it in the global type id lookup table. Types
+		 * with a duplicate or abstract type id are ignored.
+		 */
+		static void _registerRTTIType(RTTITypeBase* rttiType);
+
 		/** Returns class' RTTI type from type id. */
 		static RTTITypeBase* _getRTTIfromTypeId(UINT32 rttiTypeId);
 
@@ -27,6 +27,21 @@ namespace bs
 	{
 		virtual ~RTTIPlainFieldBase() = default;
 
+		/**
+		 * Offset of the field data from the start of the owning object, in bytes. Only valid if the owning type declared
+		 * an in-memory layout for this field. @see RTTITypeBase::declareFieldLayout
+		 */
+		UINT32 mLayoutOffset = (UINT32)-1;
+
+		/** In-memory size of the field data, in bytes. Only valid if hasLayout() returns true. */
+		UINT32 mLayoutSize = 0;
+
+		/**
+		 * Checks has the owning type declared an in-memory layout for this field, meaning the field data can be copied
+		 * directly to/from (object + mLayoutOffset) without going through the getter/setter methods.
+		 */
+		bool hasLayout() const { return mLayoutOffset != (UINT32)-1; }
+
 		/** Throws an exception if the current field type and provided template types don't match. */
 		template<class DataType>
 		void checkType()
@@ -13,6 +13,8 @@ namespace bs
 
 	RTTIField* RTTITypeBase::findField(const String& name)
 	{
+		ensureFieldsInitialized();
+
 		auto foundElement = std::find_if(mFields.begin(), mFields.end(), [&name](RTTIField* x) { return x->mName == name; });
 
 		if(foundElement == mFields.end())
@@ -26,6 +28,8 @@ namespace bs
 
 	RTTIField* RTTITypeBase::findField(int uniqueFieldId)
 	{
+		ensureFieldsInitialized();
+
 		auto foundElement = std::find_if(mFields.begin(), mFields.end(), [&uniqueFieldId](RTTIField* x) { return x->mUniqueId == uniqueFieldId; });
 
 		if(foundElement == mFields.end())
@@ -63,6 +67,52 @@ namespace bs
 		mFields.push_back(field);
 	}
 
+	void RTTITypeBase::declareFieldLayout(const String& name, UINT32 offset, UINT32 size)
+	{
+		RTTIField* genericField = findField(name);
+		genericField->checkIsPlain(false);
+
+		RTTIPlainFieldBase* field = static_cast<RTTIPlainFieldBase*>(genericField);
+		if(field->hasDynamicSize())
+		{
+			BS_EXCEPT(InternalErrorException,
+				"Cannot declare a layout for field (" + name + ") as it has a dynamic size.");
+		}
+
+		if(field->getTypeSize() != size)
+		{
+			BS_EXCEPT(InternalErrorException,
+				"Cannot declare a layout for field (" + name + ") as its in-memory size doesn't match its type size.");
+		}
+
+		field->mLayoutOffset = offset;
+		field->mLayoutSize = size;
+
+		mFieldLayout.push_back({ field, offset, size });
+	}
+
+	void RTTITypeBase::ensureFieldsInitialized() const
+	{
+		if (mFieldsInitialized.load(std::memory_order_acquire))
+			return;
+
+		RecursiveLock lock(mFieldInitMutex);
+
+		// Re-entrant call - initFields() itself looks fields up (e.g. through declareFieldLayout()), in which case the
+		// partially built table is exactly what it expects
+		if (mInitializingFields)
+			return;
+
+		if (!mFieldsInitialized.load(std::memory_order_relaxed))
+		{
+			mInitializingFields = true;
+			const_cast<RTTITypeBase*>(this)->initFields();
+			mInitializingFields = false;
+
+			mFieldsInitialized.store(true, std::memory_order_release);
+		}
+	}
+
 	SPtr<IReflectable> rtti_create(UINT32 rttiId)
 	{
 		return IReflectable::createInstanceFromTypeId(rttiId);
@@ -5,6 +5,7 @@
 #include <string>
 #include <algorithm>
 #include <unordered_map>
+#include <atomic>
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Reflection/BsRTTIField.h"
@@ -66,6 +67,27 @@ namespace bs
 																								\
 	typedef META_NextEntry_##name
 
+	   /**
+	    * Same as BS_RTTI_MEMBER_PLAIN, but also declares the in-memory layout of the member, allowing systems like the
+		* binary serializer to copy the field data directly to/from object memory instead of through the getter/setter
+		* methods. Only use for members whose serialized form is a bitwise copy of the in-memory data.
+		*/
+#define BS_RTTI_MEMBER_PLAIN_LAYOUT(name, id)													\
+	META_Entry_##name;																			\
+																								\
+	decltype(OwnerType::name)& get##name(OwnerType* obj) { return obj->name; }					\
+	void set##name(OwnerType* obj, decltype(OwnerType::name)& val) { obj->name = val; }			\
+																								\
+	struct META_NextEntry_##name{};																\
+	void META_InitPrevEntry(META_NextEntry_##name typeId)										\
+	{																							\
+		addPlainField(#name, id, &MyType::get##name, &MyType::set##name);						\
+		declareFieldLayout(#name, (UINT32)offsetof(OwnerType, name), sizeof(OwnerType::name));	\
+		META_InitPrevEntry(META_Entry_##name());												\
+	}																							\
+																								\
+	typedef META_NextEntry_##name
+
 /**
  * Registers a new member field in the RTTI type. The field references the @p name member in the owner class.
  * The type of the member must be an array of valid plain types. Each field must specify a unique ID for @p id.
@@ -262,19 +284,20 @@ namespace bs
 																								\
 	typedef META_NextEntry_##name
 
-/** Ends definitions for member fields with a RTTI type. Must follow BS_BEGIN_RTTI_MEMBERS. */
+/**
+ * Ends definitions for member fields with a RTTI type. Must follow BS_BEGIN_RTTI_MEMBERS.
+ *
+ * The field metadata declared by the BS_RTTI_MEMBER_* macros is built lazily, on the first access to the type's
+ * fields (normally the first time an object of the type is serialized or deserialized). Types that are never
+ * (de)serialized by a process therefore never pay the registration cost or the heap footprint of their field table.
+ */
 #define BS_END_RTTI_MEMBERS																		\
 	META_LastEntry;																				\
 																								\
-	struct META_InitAllMembers																	\
+	void initFields() override																	\
 	{																							\
-		META_InitAllMembers(MyType* owner)														\
-		{																						\
-			owner->META_InitPrevEntry(META_LastEntry());										\
-		}																						\
-	};																							\
-																								\
-	META_InitAllMembers mInitMembers{this};
+		META_InitPrevEntry(META_LastEntry());													\
+	}
 
 	/** @} */
 
@@ -285,6 +308,17 @@ namespace bs
 	 *  @{
 	 */
 
+	/**
+	 * A single entry in the optional field layout table published by a RTTI type. Describes where in memory the data of
+	 * a fixed-size plain field is located, relative to the start of the owning object. @see RTTITypeBase::getFieldLayout
+	 */
+	struct RTTIFieldLayoutEntry
+	{
+		RTTIField* field; /**< Plain field the entry describes. */
+		UINT32 offset; /**< Offset of the field data from the start of the owning object, in bytes. */
+		UINT32 size; /**< Size of the field data, in bytes. */
+	};
+
 	/**
 	 * Provides an interface for accessing fields of a certain class.
 	 * Data can be easily accessed by getter and setter methods.
@@ -660,10 +694,17 @@ namespace bs
 		}	
 
 		/** Returns the total number of fields in this RTTI type. */
-		UINT32 getNumFields() const { return (UINT32)mFields.size(); }
+		UINT32 getNumFields() const { ensureFieldsInitialized(); return (UINT32)mFields.size(); }
 
 		/** Returns a field based on the field index. Use getNumFields() to get total number of fields available. */
-		RTTIField* getField(UINT32 idx) { return mFields.at(idx); }
+		RTTIField* getField(UINT32 idx) { ensureFieldsInitialized(); return mFields.at(idx); }
+
+		/**
+		 * Returns a table describing the in-memory layout of the type's fixed-size plain fields, as declared through
+		 * declareFieldLayout(). Systems like the binary serializer use the table to copy field data directly to/from
+		 * object memory, skipping the virtual getter/setter methods. Empty if the type didn't declare a layout.
+		 */
+		const Vector<RTTIFieldLayoutEntry>& getFieldLayout() const { ensureFieldsInitialized(); return mFieldLayout; }
 
 		/**
 		 * Tries to find a field with the specified name. Throws an exception if it can't.
@@ -692,6 +733,14 @@ namespace bs
 		/** @} */
 
 	protected:
+		/**
+		 * Populates the field metadata of this type, as declared through the BS_RTTI_MEMBER_* macros. Invoked on the
+		 * first access to the type's fields rather than on construction, so types that are never (de)serialized don't
+		 * pay for building their field table. Fields registered outside the macros (directly in the RTTI type's
+		 * constructor) are unaffected and keep registering on construction.
+		 */
+		virtual void initFields() { }
+
 		/**
 		 * Tries to add a new field to the fields array, and throws an exception if a field with the same name or id 
 		 * already exists.
@@ -700,8 +749,31 @@ namespace bs
 		 */
 		void addNewField(RTTIField* field);
 
+		/**
+		 * Declares the in-memory layout of a previously added plain field, allowing its data to be copied directly
+		 * to/from object memory instead of through the getter/setter methods. Normally called through
+		 * BS_RTTI_MEMBER_PLAIN_LAYOUT rather than directly.
+		 *
+		 * Only valid for non-array plain fields without a dynamic size, whose serialized form is a bitwise copy of the
+		 * in-memory data (the default for types not specializing RTTIPlainType serialization). Throws an exception if
+		 * the field doesn't meet those requirements.
+		 *
+		 * @param[in]	name	Name of a previously added field.
+		 * @param[in]	offset	Offset of the member backing the field from the start of the owning object, in bytes.
+		 * @param[in]	size	In-memory size of the member backing the field, in bytes. Must match the field type size.
+		 */
+		void declareFieldLayout(const String& name, UINT32 offset, UINT32 size);
+
 	private:
+		/** Runs initFields() if it hasn't run yet. Safe to call from multiple threads, and from initFields() itself. */
+		void ensureFieldsInitialized() const;
+
 		Vector<RTTIField*> mFields;
+		Vector<RTTIFieldLayoutEntry> mFieldLayout;
+
+		mutable std::atomic<bool> mFieldsInitialized{false};
+		mutable bool mInitializingFields = false;
+		mutable RecursiveMutex mFieldInitMutex;
 	};
 
 	/** Used for initializing a certain type as soon as the program is loaded. */
@@ -836,6 +908,7 @@ namespace bs
 					"\" has a duplicate ID: " + toString(derivedClass->getRTTIId()));
 			}
 
+			IReflectable::_registerRTTIType(derivedClass);
 			getDerivedClasses().push_back(derivedClass);
 		}
 
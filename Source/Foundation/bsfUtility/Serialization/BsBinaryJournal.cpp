@@ -0,0 +1,231 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Serialization/BsBinaryJournal.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "Serialization/BsBinaryDiff.h"
+#include "Serialization/BsMemorySerializer.h"
+#include "Serialization/BsSerializedObject.h"
+#include "Reflection/BsRTTIType.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	BinaryJournal::BinaryJournal(const Path& fileLocation)
+		:mFileLocation(fileLocation)
+	{
+		openStream();
+	}
+
+	BinaryJournal::~BinaryJournal()
+	{
+		mOutputStream.close();
+		mOutputStream.clear();
+	}
+
+	void BinaryJournal::openStream()
+	{
+		Path parentDir = mFileLocation.getDirectory();
+		if (!FileSystem::exists(parentDir))
+			FileSystem::createDir(parentDir);
+
+		mOutputStream.open(mFileLocation.toPlatformString().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (mOutputStream.fail())
+		{
+			LOGWRN("Failed to open journal file: " + mFileLocation.toString() + ". Error: " + strerror(errno) + ".");
+			return;
+		}
+
+		UINT32 magic = JOURNAL_MAGIC;
+		UINT32 version = JOURNAL_VERSION;
+		mOutputStream.write((char*)&magic, sizeof(magic));
+		mOutputStream.write((char*)&version, sizeof(version));
+	}
+
+	void BinaryJournal::registerObject(UINT64 id, const SPtr<IReflectable>& object)
+	{
+		if (object == nullptr)
+			return;
+
+		ObjectEntry& entry = mObjects[id];
+		entry.object = object;
+		entry.baseline = BinarySerializer()._encodeToIntermediate(object.get());
+		entry.dirty = false;
+
+		mBaselineBytes += writeObject(id, object.get(), EntryType::Full);
+	}
+
+	void BinaryJournal::unregisterObject(UINT64 id)
+	{
+		auto iterFind = mObjects.find(id);
+		if (iterFind == mObjects.end())
+			return;
+
+		mObjects.erase(iterFind);
+		writeEntry(EntryType::Removed, id, nullptr, 0);
+	}
+
+	void BinaryJournal::notifyModified(UINT64 id)
+	{
+		auto iterFind = mObjects.find(id);
+		if (iterFind != mObjects.end())
+			iterFind->second.dirty = true;
+	}
+
+	void BinaryJournal::save()
+	{
+		for (auto& entry : mObjects)
+		{
+			ObjectEntry& objEntry = entry.second;
+			if (!objEntry.dirty)
+				continue;
+
+			objEntry.dirty = false;
+
+			SPtr<SerializedObject> newBaseline = BinarySerializer()._encodeToIntermediate(objEntry.object.get());
+
+			IDiff& diffHandler = objEntry.object->getRTTI()->getDiffHandler();
+			SPtr<SerializedObject> diff = diffHandler.generateDiff(objEntry.baseline, newBaseline);
+			objEntry.baseline = newBaseline;
+
+			if (diff == nullptr)
+				continue;
+
+			mDeltaBytes += writeObject(entry.first, diff.get(), EntryType::Delta);
+		}
+
+		mOutputStream.flush();
+
+		// Once the deltas outgrow the baseline data a full re-write gets cheaper than replaying the journal on load
+		if (mDeltaBytes > mBaselineBytes)
+			compact();
+	}
+
+	void BinaryJournal::compact()
+	{
+		mOutputStream.close();
+		mOutputStream.clear();
+
+		openStream();
+
+		mBaselineBytes = 0;
+		mDeltaBytes = 0;
+
+		for (auto& entry : mObjects)
+			mBaselineBytes += writeObject(entry.first, entry.second.object.get(), EntryType::Full);
+
+		mOutputStream.flush();
+	}
+
+	UINT32 BinaryJournal::writeObject(UINT64 id, IReflectable* object, EntryType type)
+	{
+		MemorySerializer ms;
+
+		UINT32 size = 0;
+		UINT8* data = ms.encode(object, size);
+
+		writeEntry(type, id, data, size);
+		bs_free(data);
+
+		return size;
+	}
+
+	void BinaryJournal::writeEntry(EntryType type, UINT64 id, UINT8* data, UINT32 size)
+	{
+		if (!mOutputStream.is_open())
+			return;
+
+		UINT8 typeByte = (UINT8)type;
+		mOutputStream.write((char*)&typeByte, sizeof(typeByte));
+		mOutputStream.write((char*)&id, sizeof(id));
+		mOutputStream.write((char*)&size, sizeof(size));
+
+		if (size > 0)
+			mOutputStream.write((char*)data, size);
+	}
+
+	Vector<BinaryJournal::RestoredObject> BinaryJournal::restore(const Path& fileLocation)
+	{
+		Vector<RestoredObject> output;
+
+		SPtr<DataStream> stream = FileSystem::openFile(fileLocation, true);
+		if (stream == nullptr)
+			return output;
+
+		UINT32 magic = 0;
+		UINT32 version = 0;
+		stream->read(&magic, sizeof(magic));
+		stream->read(&version, sizeof(version));
+
+		if (magic != JOURNAL_MAGIC || version != JOURNAL_VERSION)
+		{
+			LOGWRN("Invalid or unsupported journal file: " + fileLocation.toString() + ".");
+			return output;
+		}
+
+		MemorySerializer ms;
+		UnorderedMap<UINT64, SPtr<IReflectable>> objects;
+		Vector<UINT64> order;
+		Vector<UINT8> readBuffer;
+
+		while (!stream->eof())
+		{
+			UINT8 typeByte = 0;
+			if (stream->read(&typeByte, sizeof(typeByte)) != sizeof(typeByte))
+				break;
+
+			UINT64 id = 0;
+			UINT32 size = 0;
+			stream->read(&id, sizeof(id));
+			stream->read(&size, sizeof(size));
+
+			if (size > (UINT32)readBuffer.size())
+				readBuffer.resize(size);
+
+			if (size > 0)
+				stream->read(readBuffer.data(), size);
+
+			switch ((EntryType)typeByte)
+			{
+			case EntryType::Full:
+			{
+				auto iterFind = objects.find(id);
+				if (iterFind == objects.end())
+					order.push_back(id);
+
+				objects[id] = ms.decode(readBuffer.data(), size);
+				break;
+			}
+			case EntryType::Delta:
+			{
+				auto iterFind = objects.find(id);
+				if (iterFind == objects.end() || iterFind->second == nullptr)
+					break;
+
+				SPtr<IReflectable> decodedDiff = ms.decode(readBuffer.data(), size);
+				if (decodedDiff == nullptr || !rtti_is_of_type<SerializedObject>(decodedDiff))
+					break;
+
+				SPtr<IReflectable>& object = iterFind->second;
+
+				IDiff& diffHandler = object->getRTTI()->getDiffHandler();
+				diffHandler.applyDiff(object, std::static_pointer_cast<SerializedObject>(decodedDiff));
+				break;
+			}
+			case EntryType::Removed:
+				objects.erase(id);
+				break;
+			}
+		}
+
+		for (auto& id : order)
+		{
+			auto iterFind = objects.find(id);
+			if (iterFind != objects.end() && iterFind->second != nullptr)
+				output.push_back({ id, iterFind->second });
+		}
+
+		return output;
+	}
+}
@@ -0,0 +1,114 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Serialization
+	 *  @{
+	 */
+
+	/**
+	 * Persists a set of objects to a file incrementally. The journal keeps an in-memory baseline snapshot of every
+	 * registered object and, on save(), appends binary diffs of just those objects that were reported as modified,
+	 * instead of re-encoding the entire set. Once the accumulated deltas outgrow the baseline data the journal
+	 * automatically compacts itself by re-writing full snapshots of all objects.
+	 *
+	 * Object modification state must be reported externally through notifyModified() (e.g. driven by core object or
+	 * game object dirty state). Objects are identified by caller-provided identifiers, which must be unique within the
+	 * journal and stable across application runs so a restored journal can be matched back to its objects.
+	 */
+	class BS_UTILITY_EXPORT BinaryJournal
+	{
+	public:
+		/** Single object reconstructed from a journal file, together with the identifier it was registered under. */
+		struct RestoredObject
+		{
+			UINT64 id;
+			SPtr<IReflectable> object;
+		};
+
+		/** Creates a new journal that will write to the specified file. Any existing file contents are overwritten. */
+		BinaryJournal(const Path& fileLocation);
+		~BinaryJournal();
+
+		/**
+		 * Registers an object with the journal, captures its baseline snapshot and appends its full contents to the
+		 * journal file.
+		 *
+		 * @param[in]	id		Identifier to register the object under. Must be unique within the journal.
+		 * @param[in]	object	Object to track. The journal keeps a reference to the object for its own lifetime.
+		 */
+		void registerObject(UINT64 id, const SPtr<IReflectable>& object);
+
+		/** Stops tracking the object with the specified identifier and records its removal in the journal file. */
+		void unregisterObject(UINT64 id);
+
+		/** Marks the object with the specified identifier as modified, so the next save() re-examines it. */
+		void notifyModified(UINT64 id);
+
+		/**
+		 * Diffs all objects marked as modified against their baseline snapshots and appends the differences to the
+		 * journal file. Objects not reported through notifyModified() aren't examined at all, and reported objects whose
+		 * contents didn't actually change produce no entries. Automatically compacts the journal when the accumulated
+		 * deltas outgrow the baseline data.
+		 */
+		void save();
+
+		/**
+		 * Re-writes the journal file from scratch so it contains just a full snapshot of every registered object,
+		 * discarding all accumulated delta and removal entries. Normally called automatically by save() when enough
+		 * deltas accumulate, but may be called manually (e.g. before shipping the file).
+		 */
+		void compact();
+
+		/**
+		 * Reads a journal file and reconstructs the objects contained within, by decoding each full snapshot and
+		 * applying any recorded deltas on top of it.
+		 */
+		static Vector<RestoredObject> restore(const Path& fileLocation);
+
+	private:
+		/** Type of a single entry in the journal file. */
+		enum class EntryType
+		{
+			Full = 0, /**< Complete encoded object. */
+			Delta = 1, /**< Encoded difference against the previously recorded state of the object. */
+			Removed = 2 /**< Marks the object as no longer part of the saved set. */
+		};
+
+		/** Information about a single tracked object. */
+		struct ObjectEntry
+		{
+			SPtr<IReflectable> object;
+			SPtr<SerializedObject> baseline;
+			bool dirty = false;
+		};
+
+		/** Opens the journal file for writing, truncating any existing contents and writing the file header. */
+		void openStream();
+
+		/**
+		 * Encodes the full contents of an object and appends it as an entry to the journal file. Returns the size of the
+		 * encoded data.
+		 */
+		UINT32 writeObject(UINT64 id, IReflectable* object, EntryType type);
+
+		/** Appends a single entry to the journal file. */
+		void writeEntry(EntryType type, UINT64 id, UINT8* data, UINT32 size);
+
+		Path mFileLocation;
+		std::ofstream mOutputStream;
+
+		UnorderedMap<UINT64, ObjectEntry> mObjects;
+		UINT64 mBaselineBytes = 0;
+		UINT64 mDeltaBytes = 0;
+
+		static constexpr UINT32 JOURNAL_MAGIC = 0x4e4a5342; // "BSJN"
+		static constexpr UINT32 JOURNAL_VERSION = 1;
+	};
+
+	/** @} */
+}
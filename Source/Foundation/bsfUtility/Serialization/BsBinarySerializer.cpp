@@ -13,6 +13,8 @@
 #include "Reflection/BsRTTIManagedDataBlockField.h"
 #include "Serialization/BsMemorySerializer.h"
 #include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Allocators/BsFrameAlloc.h"
 
 #include <unordered_set>
 
@@ -40,9 +42,9 @@ buffer += size;															\
 
 namespace bs
 {
-	void BinarySerializer::encode(IReflectable* object, UINT8* buffer, UINT32 bufferLength, UINT32* bytesWritten, 
-		std::function<UINT8*(UINT8*, UINT32, UINT32&)> flushBufferCallback, bool shallow, 
-		const UnorderedMap<String, UINT64>& params)
+	void BinarySerializer::encode(IReflectable* object, UINT8* buffer, UINT32 bufferLength, UINT32* bytesWritten,
+		std::function<UINT8*(UINT8*, UINT32, UINT32&)> flushBufferCallback, bool shallow,
+		const UnorderedMap<String, UINT64>& params, bool emitSkipTables)
 	{
 		mObjectsToEncode.clear();
 		mObjectAddrToId.clear();
@@ -50,6 +52,7 @@ namespace bs
 		*bytesWritten = 0;
 		mTotalBytesWritten = 0;
 		mParams = params;
+		mEmitSkipTables = emitSkipTables;
 
 		Vector<SPtr<IReflectable>> encodedObjects;
 		UINT32 objectId = findOrCreatePersistentId(object);
@@ -131,6 +134,182 @@ namespace bs
 		return _decodeFromIntermediate(intermediateObject);
 	}
 
+	SPtr<IReflectable> BinarySerializer::decodePartial(const SPtr<DataStream>& data, UINT32 dataLength,
+		const UnorderedSet<UINT16>& fieldFilter, const UnorderedMap<String, UINT64>& params)
+	{
+		mParams = params;
+
+		if (dataLength == 0)
+			return nullptr;
+
+		SPtr<SerializedObject> intermediateObject = _decodeToIntermediate(data, dataLength, false, nullptr, &fieldFilter);
+		if (intermediateObject == nullptr)
+			return nullptr;
+
+		return _decodeFromIntermediate(intermediateObject);
+	}
+
+	SPtr<IReflectable> BinarySerializer::decodeParallel(const SPtr<DataStream>& data, UINT32 dataLength,
+		const UnorderedMap<String, UINT64>& params)
+	{
+		mParams = params;
+
+		if (dataLength == 0)
+			return nullptr;
+
+		SPtr<SerializedObject> intermediateObject = _decodeToIntermediate(data, dataLength);
+		if (intermediateObject == nullptr)
+			return nullptr;
+
+		// Find the objects the root references through pointer fields. Each one is potentially an independent sub-graph
+		// that can decode on its own worker.
+		Vector<SPtr<SerializedObject>> rootChildren;
+		findReferencedObjects(intermediateObject, rootChildren);
+
+		if (rootChildren.size() < 2)
+			return _decodeFromIntermediate(intermediateObject);
+
+		// Phase 1: group the sub-graphs into connected components. Sub-graphs that share any object must decode
+		// sequentially on the same worker, which guarantees cross-references never span two workers.
+		Vector<Vector<SPtr<SerializedObject>>> components;
+		UnorderedMap<SerializedObject*, UINT32> componentLookup;
+
+		for (auto& rootChild : rootChildren)
+		{
+			if (rootChild == nullptr)
+				continue;
+
+			Vector<SPtr<SerializedObject>> subGraph;
+			collectSubGraph(rootChild, subGraph);
+
+			// Find all existing components this sub-graph touches
+			UINT32 targetComponent = (UINT32)-1;
+			for (auto& entry : subGraph)
+			{
+				auto iterFind = componentLookup.find(entry.get());
+				if (iterFind != componentLookup.end() && (targetComponent == (UINT32)-1 || iterFind->second < targetComponent))
+					targetComponent = iterFind->second;
+			}
+
+			if (targetComponent == (UINT32)-1)
+			{
+				targetComponent = (UINT32)components.size();
+				components.push_back(Vector<SPtr<SerializedObject>>());
+			}
+
+			Vector<SPtr<SerializedObject>>& component = components[targetComponent];
+			for (auto& entry : subGraph)
+			{
+				auto iterFind = componentLookup.find(entry.get());
+				if (iterFind == componentLookup.end())
+				{
+					componentLookup[entry.get()] = targetComponent;
+					component.push_back(entry);
+				}
+				else if (iterFind->second != targetComponent)
+				{
+					// Merge the previously created component into the target one
+					Vector<SPtr<SerializedObject>>& originalComponent = components[iterFind->second];
+					for (auto& mergedEntry : originalComponent)
+					{
+						componentLookup[mergedEntry.get()] = targetComponent;
+						component.push_back(mergedEntry);
+					}
+
+					originalComponent.clear();
+				}
+			}
+		}
+
+		// If the root is itself reachable from one of the sub-graphs (a circular reference back to the root), the
+		// sub-graphs aren't independent from the root and concurrent decode isn't safe - fall back to the serial path.
+		if (componentLookup.find(intermediateObject.get()) != componentLookup.end())
+			return _decodeFromIntermediate(intermediateObject);
+
+		// Phase 2: pre-create all referenced objects so workers never modify the shared object map, then decode each
+		// component on its own task.
+		mObjectMap.clear();
+
+		for (auto& component : components)
+		{
+			for (auto& serializedObj : component)
+			{
+				if (mObjectMap.find(serializedObj) != mObjectMap.end())
+					continue;
+
+				RTTITypeBase* childRtti = IReflectable::_getRTTIfromTypeId(serializedObj->getRootTypeId());
+				if (childRtti == nullptr)
+					continue;
+
+				mObjectMap.insert(std::make_pair(serializedObj, ObjectToDecode(childRtti->newRTTIObject(), serializedObj)));
+			}
+		}
+
+		Vector<SPtr<Task>> tasks;
+		for (auto& component : components)
+		{
+			if (component.empty())
+				continue;
+
+			Vector<SPtr<SerializedObject>>* componentPtr = &component;
+			auto worker = [this, componentPtr]()
+			{
+				for (auto& serializedObj : *componentPtr)
+				{
+					auto iterFind = mObjectMap.find(serializedObj);
+					if (iterFind == mObjectMap.end())
+						continue;
+
+					ObjectToDecode& objToDecode = iterFind->second;
+					if (objToDecode.isDecoded)
+						continue;
+
+					objToDecode.decodeInProgress = true;
+					decodeEntry(objToDecode.object, objToDecode.serializedObject);
+					objToDecode.decodeInProgress = false;
+					objToDecode.isDecoded = true;
+				}
+			};
+
+			tasks.push_back(Task::create("DecodeSubGraph", worker));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		// Phase 3: serially decode the root itself, which only needs to link in the already decoded sub-graphs, then
+		// pick up any objects reachable solely through weak references.
+		SPtr<IReflectable> output;
+		RTTITypeBase* type = IReflectable::_getRTTIfromTypeId(intermediateObject->getRootTypeId());
+		if (type != nullptr)
+		{
+			output = type->newRTTIObject();
+			auto iterNewObj = mObjectMap.insert(std::make_pair(intermediateObject, ObjectToDecode(output, intermediateObject)));
+
+			iterNewObj.first->second.decodeInProgress = true;
+			decodeEntry(output, intermediateObject);
+			iterNewObj.first->second.decodeInProgress = false;
+			iterNewObj.first->second.isDecoded = true;
+		}
+
+		for (auto iter = mObjectMap.begin(); iter != mObjectMap.end(); ++iter)
+		{
+			ObjectToDecode& objToDecode = iter->second;
+
+			if (objToDecode.isDecoded)
+				continue;
+
+			objToDecode.decodeInProgress = true;
+			decodeEntry(objToDecode.object, objToDecode.serializedObject);
+			objToDecode.decodeInProgress = false;
+			objToDecode.isDecoded = true;
+		}
+
+		mObjectMap.clear();
+		return output;
+	}
+
 	SPtr<IReflectable> BinarySerializer::_decodeFromIntermediate(const SPtr<SerializedObject>& serializedObject)
 	{
 		mObjectMap.clear();
@@ -166,7 +345,7 @@ namespace bs
 		return output;
 	}
 
-	SPtr<SerializedObject> BinarySerializer::_encodeToIntermediate(IReflectable* object, bool shallow)
+	SPtr<SerializedObject> BinarySerializer::_encodeToIntermediate(IReflectable* object, bool shallow, FrameAlloc* alloc)
 	{
 		// TODO: This is a hacky way of generating an intermediate format to save development time and complexity.
 		// It is hacky because it requires a full on encode to binary and then decode into intermediate. It should 
@@ -182,12 +361,13 @@ namespace bs
 		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(data, dataLength);
 
 		BinarySerializer bs;
-		SPtr<SerializedObject> obj = bs._decodeToIntermediate(stream, dataLength, true);
+		SPtr<SerializedObject> obj = bs._decodeToIntermediate(stream, dataLength, true, alloc);
 
 		return obj;
 	}
 
-	SPtr<SerializedObject> BinarySerializer::_decodeToIntermediate(const SPtr<DataStream>& data, UINT32 dataLength, bool copyData)
+	SPtr<SerializedObject> BinarySerializer::_decodeToIntermediate(const SPtr<DataStream>& data, UINT32 dataLength, bool copyData,
+		FrameAlloc* alloc, const UnorderedSet<UINT16>* rootFieldFilter)
 	{
 		bool streamDataBlock = false;
 		if (!copyData && data->isFile())
@@ -198,18 +378,32 @@ namespace bs
 
 		UINT32 bytesRead = 0;
 		mInterimObjectMap.clear();
+		mIntermediateAlloc = alloc;
 
 		SPtr<SerializedObject> rootObj;
-		bool hasMore = decodeEntry(data, dataLength, bytesRead, rootObj, copyData, streamDataBlock);
+		bool hasMore = decodeEntry(data, dataLength, bytesRead, rootObj, copyData, streamDataBlock, rootFieldFilter);
 		while (hasMore)
 		{
 			SPtr<SerializedObject> dummyObj;
 			hasMore = decodeEntry(data, dataLength, bytesRead, dummyObj, copyData, streamDataBlock);
 		}
 
+		mIntermediateAlloc = nullptr;
 		return rootObj;
 	}
 
+	template <class T>
+	SPtr<T> BinarySerializer::allocIntermediateNode()
+	{
+		if (mIntermediateAlloc == nullptr)
+			return bs_shared_ptr_new<T>();
+
+		// Both the node and the shared pointer control block come from the arena, and their memory gets freed in bulk
+		// when the caller clears it. Destructors still run normally when the last reference is released, freeing any
+		// heap memory held by the node's containers.
+		return std::allocate_shared<T>(StdFrameAlloc<T>(mIntermediateAlloc));
+	}
+
 	UINT8* BinarySerializer::encodeEntry(IReflectable* object, UINT32 objectId, UINT8* buffer, UINT32& bufferLength, 
 		UINT32* bytesWritten, std::function<UINT8*(UINT8*, UINT32, UINT32&)> flushBufferCallback, bool shallow)
 	{
@@ -226,6 +420,32 @@ namespace bs
 			COPY_TO_BUFFER(&objectMetaData, sizeof(ObjectMetaData))
 
 			int numFields = si->getNumFields();
+
+			// Emit a skip table as the object's first field, listing the ID and encoded size of every real field that
+			// follows. Encoded as a normal dynamic-size plain field so decoders unaware of it just skip over it.
+			if(mEmitSkipTables)
+			{
+				int tableMeta = encodeFieldMetaData(SKIP_TABLE_FIELD_ID, 0, false, SerializableFT_Plain, true, false);
+				COPY_TO_BUFFER(&tableMeta, META_SIZE)
+
+				// Size includes its own four bytes, matching the convention of other dynamic-size fields
+				UINT32 tableSize = 2 * sizeof(UINT32) + numFields * 2 * sizeof(UINT32);
+				COPY_TO_BUFFER(&tableSize, sizeof(UINT32))
+
+				UINT32 numTableEntries = (UINT32)numFields;
+				COPY_TO_BUFFER(&numTableEntries, sizeof(UINT32))
+
+				for(int i = 0; i < numFields; i++)
+				{
+					RTTIField* curGenericField = si->getField(i);
+
+					UINT32 entryId = curGenericField->mUniqueId;
+					UINT32 entrySize = getFieldEncodedSize(curGenericField, object);
+
+					COPY_TO_BUFFER(&entryId, sizeof(UINT32))
+					COPY_TO_BUFFER(&entrySize, sizeof(UINT32))
+				}
+			}
 			for(int i = 0; i < numFields; i++)
 			{
 				RTTIField* curGenericField = si->getField(i);
@@ -358,6 +578,14 @@ namespace bs
 						{
 							RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
 
+							// Field with a declared layout is at a known offset and bitwise copyable, so its data can
+							// be copied directly without going through the virtual getter
+							if(curField->hasLayout())
+							{
+								COPY_TO_BUFFER((UINT8*)object + curField->mLayoutOffset, curField->mLayoutSize)
+								break;
+							}
+
 							UINT32 typeSize = 0;
 							if(curField->hasDynamicSize())
 								typeSize = curField->getDynamicSize(object);
@@ -431,7 +659,7 @@ namespace bs
 	}
 
 	bool BinarySerializer::decodeEntry(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead,
-		SPtr<SerializedObject>& output, bool copyData, bool streamDataBlock)
+		SPtr<SerializedObject>& output, bool copyData, bool streamDataBlock, const UnorderedSet<UINT16>* fieldFilter)
 	{
 		ObjectMetaData objectMetaData;
 		objectMetaData.objectMeta = 0;
@@ -465,14 +693,14 @@ namespace bs
 				auto iterFind = mInterimObjectMap.find(objectId);
 				if (iterFind == mInterimObjectMap.end())
 				{
-					output = bs_shared_ptr_new<SerializedObject>();
+					output = allocIntermediateNode<SerializedObject>();
 					mInterimObjectMap.insert(std::make_pair(objectId, output));
 				}
 				else
 					output = iterFind->second;
 			}
 			else // Not a reflectable ptr referenced object
-				output = bs_shared_ptr_new<SerializedObject>();
+				output = allocIntermediateNode<SerializedObject>();
 
 			output->subObjects.push_back(SerializedSubObject());
 			serializedSubObject = &output->subObjects.back();
@@ -480,6 +708,9 @@ namespace bs
 			serializedSubObject->typeId = objectTypeId;
 		}
 
+		// Field sizes parsed from the current sub-object's skip table, if it has one
+		UnorderedMap<UINT16, UINT32> skipTable;
+
 		while (bytesRead < dataLength)
 		{
 			int metaData = -1;
@@ -525,6 +756,9 @@ namespace bs
 						serializedSubObject->typeId = objTypeId;
 					}
 
+					// The base class carries its own skip table (if any), don't let the derived class' entries leak
+					skipTable.clear();
+
 					bytesRead += sizeof(ObjectMetaData);
 					continue;
 				}
@@ -549,16 +783,69 @@ namespace bs
 			if (terminator)
 			{
 				// We've processed the last field in this object, so return. Although we return false we don't actually know
-				// if there is an object following this one. However it doesn't matter since terminator fields are only used 
+				// if there is an object following this one. However it doesn't matter since terminator fields are only used
 				// for embedded objects that are all processed within this method so we can compensate.
 				return false;
 			}
 
+			// Check for a skip table, which (when present) is always the first field of a sub-object
+			if (fieldId == SKIP_TABLE_FIELD_ID && fieldType == SerializableFT_Plain && hasDynamicSize && !isArray)
+			{
+				UINT32 tableSize = 0;
+				if (data->read(&tableSize, sizeof(UINT32)) != sizeof(UINT32))
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				UINT32 numTableEntries = 0;
+				if (data->read(&numTableEntries, sizeof(UINT32)) != sizeof(UINT32))
+				{
+					BS_EXCEPT(InternalErrorException, "Error decoding data.");
+				}
+
+				skipTable.clear();
+				if (tableSize == 2 * sizeof(UINT32) + numTableEntries * 2 * sizeof(UINT32))
+				{
+					for (UINT32 i = 0; i < numTableEntries; i++)
+					{
+						UINT32 entryId = 0;
+						UINT32 entrySize = 0;
+						data->read(&entryId, sizeof(UINT32));
+						data->read(&entrySize, sizeof(UINT32));
+
+						skipTable[(UINT16)entryId] = entrySize;
+					}
+				}
+				else // Malformed or produced by a newer format revision, skip whatever remains of it
+					data->skip(tableSize - 2 * sizeof(UINT32));
+
+				bytesRead += tableSize;
+				continue;
+			}
+
 			RTTIField* curGenericField = nullptr;
 
 			if (rtti != nullptr)
 				curGenericField = rtti->findField(fieldId);
 
+			// When partially decoding, fields outside the filter are handled as if they were unknown
+			if (curGenericField != nullptr && fieldFilter != nullptr && fieldFilter->find(fieldId) == fieldFilter->end())
+				curGenericField = nullptr;
+
+			// Unknown and filtered-out fields whose size is listed in the skip table can be skipped with a single seek,
+			// without parsing their contents
+			if (curGenericField == nullptr)
+			{
+				auto iterSkip = skipTable.find(fieldId);
+				if (iterSkip != skipTable.end() && iterSkip->second >= META_SIZE)
+				{
+					UINT32 dataSize = iterSkip->second - META_SIZE;
+					data->skip(dataSize);
+					bytesRead += dataSize;
+					continue;
+				}
+			}
+
 			if (curGenericField != nullptr)
 			{
 				if (!hasDynamicSize && curGenericField->getTypeSize() != fieldSize)
@@ -597,7 +884,7 @@ namespace bs
 				SPtr<SerializedArray> serializedArray;
 				if (curGenericField != nullptr)
 				{
-					serializedArray = bs_shared_ptr_new<SerializedArray>();
+					serializedArray = allocIntermediateNode<SerializedArray>();
 					serializedArray->numElements = arrayNumElems;
 
 					serializedEntry = serializedArray;
@@ -629,7 +916,7 @@ namespace bs
 								auto findObj = mInterimObjectMap.find(childObjectId);
 								if (findObj == mInterimObjectMap.end())
 								{
-									serializedArrayEntry = bs_shared_ptr_new<SerializedObject>();
+									serializedArrayEntry = allocIntermediateNode<SerializedObject>();
 									mInterimObjectMap.insert(std::make_pair(childObjectId, serializedArrayEntry));
 								}
 								else
@@ -681,14 +968,20 @@ namespace bs
 
 						if (curField != nullptr)
 						{
-							SPtr<SerializedField> serializedField = bs_shared_ptr_new<SerializedField>();
+							SPtr<SerializedField> serializedField = allocIntermediateNode<SerializedField>();
 
 							if (copyData)
 							{
-								serializedField->value = (UINT8*)bs_alloc(typeSize);
-								data->read(serializedField->value, typeSize);
+								// Arena-allocated data is freed in bulk along with the rest of the graph
+								if (mIntermediateAlloc != nullptr)
+									serializedField->value = mIntermediateAlloc->alloc(typeSize);
+								else
+								{
+									serializedField->value = (UINT8*)bs_alloc(typeSize);
+									serializedField->ownsMemory = true;
+								}
 
-								serializedField->ownsMemory = true;
+								data->read(serializedField->value, typeSize);
 							}
 							else // Guaranteed not to be a file stream, as we check earlier
 							{
@@ -744,7 +1037,7 @@ namespace bs
 							auto findObj = mInterimObjectMap.find(childObjectId);
 							if (findObj == mInterimObjectMap.end())
 							{
-								serializedField = bs_shared_ptr_new<SerializedObject>();
+								serializedField = allocIntermediateNode<SerializedObject>();
 								mInterimObjectMap.insert(std::make_pair(childObjectId, serializedField));
 							}
 							else
@@ -784,13 +1077,19 @@ namespace bs
 
 					if (curField != nullptr)
 					{
-						SPtr<SerializedField> serializedField = bs_shared_ptr_new<SerializedField>();
+						SPtr<SerializedField> serializedField = allocIntermediateNode<SerializedField>();
 						if (copyData)
 						{
-							serializedField->value = (UINT8*)bs_alloc(typeSize);
-							data->read(serializedField->value, typeSize);
+							// Arena-allocated data is freed in bulk along with the rest of the graph
+							if (mIntermediateAlloc != nullptr)
+								serializedField->value = mIntermediateAlloc->alloc(typeSize);
+							else
+							{
+								serializedField->value = (UINT8*)bs_alloc(typeSize);
+								serializedField->ownsMemory = true;
+							}
 
-							serializedField->ownsMemory = true;
+							data->read(serializedField->value, typeSize);
 						}
 						else // Guaranteed not to be a file stream, as we check earlier
 						{
@@ -826,7 +1125,7 @@ namespace bs
 					// Data block data
 					if (curField != nullptr)
 					{
-						SPtr<SerializedDataBlock> serializedDataBlock = bs_shared_ptr_new<SerializedDataBlock>();
+						SPtr<SerializedDataBlock> serializedDataBlock = allocIntermediateNode<SerializedDataBlock>();
 
 						if (streamDataBlock || !copyData)
 						{
@@ -876,6 +1175,80 @@ namespace bs
 		return false;
 	}
 
+	void BinarySerializer::findReferencedObjects(const SPtr<SerializedObject>& object, Vector<SPtr<SerializedObject>>& output)
+	{
+		for (auto& subObject : object->subObjects)
+		{
+			RTTITypeBase* rtti = IReflectable::_getRTTIfromTypeId(subObject.typeId);
+			if (rtti == nullptr)
+				continue;
+
+			UINT32 numFields = rtti->getNumFields();
+			for (UINT32 fieldIdx = 0; fieldIdx < numFields; fieldIdx++)
+			{
+				RTTIField* curGenericField = rtti->getField(fieldIdx);
+
+				auto iterFindFieldData = subObject.entries.find(curGenericField->mUniqueId);
+				if (iterFindFieldData == subObject.entries.end())
+					continue;
+
+				SPtr<SerializedInstance> entryData = iterFindFieldData->second.serialized;
+				if (entryData == nullptr)
+					continue;
+
+				if (curGenericField->isArray())
+				{
+					SPtr<SerializedArray> arrayData = std::static_pointer_cast<SerializedArray>(entryData);
+					for (auto& arrayElem : arrayData->entries)
+					{
+						SPtr<SerializedObject> arrayElemData =
+							std::static_pointer_cast<SerializedObject>(arrayElem.second.serialized);
+						if (arrayElemData == nullptr)
+							continue;
+
+						if (curGenericField->mType == SerializableFT_ReflectablePtr)
+							output.push_back(arrayElemData);
+						else if (curGenericField->mType == SerializableFT_Reflectable)
+							findReferencedObjects(arrayElemData, output);
+					}
+				}
+				else
+				{
+					if (curGenericField->mType == SerializableFT_ReflectablePtr)
+						output.push_back(std::static_pointer_cast<SerializedObject>(entryData));
+					else if (curGenericField->mType == SerializableFT_Reflectable)
+						findReferencedObjects(std::static_pointer_cast<SerializedObject>(entryData), output);
+				}
+			}
+		}
+	}
+
+	void BinarySerializer::collectSubGraph(const SPtr<SerializedObject>& object, Vector<SPtr<SerializedObject>>& output)
+	{
+		UnorderedSet<SerializedObject*> visited;
+
+		Vector<SPtr<SerializedObject>> todo;
+		todo.push_back(object);
+		visited.insert(object.get());
+
+		while (!todo.empty())
+		{
+			SPtr<SerializedObject> current = todo.back();
+			todo.erase(todo.end() - 1);
+
+			output.push_back(current);
+
+			Vector<SPtr<SerializedObject>> referenced;
+			findReferencedObjects(current, referenced);
+
+			for (auto& entry : referenced)
+			{
+				if (visited.insert(entry.get()).second)
+					todo.push_back(entry);
+			}
+		}
+	}
+
 	void BinarySerializer::decodeEntry(const SPtr<IReflectable>& object, const SPtr<SerializedObject>& serializableObject)
 	{
 		UINT32 numSubObjects = (UINT32)serializableObject->subObjects.size();
@@ -1082,7 +1455,13 @@ namespace bs
 						SPtr<SerializedField> fieldData = std::static_pointer_cast<SerializedField>(entryData);
 						if (fieldData != nullptr)
 						{
-							curField->fromBuffer(object.get(), fieldData->value);
+							// Field with a declared layout is at a known offset and bitwise copyable, so its data can
+							// be copied directly without going through the virtual setter. Size mismatch means the data
+							// was serialized by an older version of the type, in which case let the field handle it.
+							if (curField->hasLayout() && fieldData->size == curField->mLayoutSize)
+								memcpy((UINT8*)object.get() + curField->mLayoutOffset, fieldData->value, fieldData->size);
+							else
+								curField->fromBuffer(object.get(), fieldData->value);
 						}
 					}
 						break;
@@ -1197,7 +1576,129 @@ namespace bs
 		return ((encodedData & 0x01) != 0);
 	}
 
-	UINT8* BinarySerializer::complexTypeToBuffer(IReflectable* object, UINT8* buffer, UINT32& bufferLength, 
+	UINT32 BinarySerializer::getFieldEncodedSize(RTTIField* field, IReflectable* object)
+	{
+		UINT32 size = META_SIZE;
+
+		if(field->mIsVectorType)
+		{
+			UINT32 arrayNumElems = field->getArraySize(object);
+			size += NUM_ELEM_FIELD_SIZE;
+
+			switch(field->mType)
+			{
+			case SerializableFT_ReflectablePtr:
+				size += arrayNumElems * COMPLEX_TYPE_FIELD_SIZE;
+				break;
+			case SerializableFT_Reflectable:
+				{
+					RTTIReflectableFieldBase* curField = static_cast<RTTIReflectableFieldBase*>(field);
+
+					for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+					{
+						IReflectable& childObject = curField->getArrayValue(object, arrIdx);
+
+						// Embedded objects are followed by a terminator field
+						size += getObjectEncodedSize(&childObject) + META_SIZE;
+					}
+
+					break;
+				}
+			case SerializableFT_Plain:
+				{
+					RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(field);
+
+					if(curField->hasDynamicSize())
+					{
+						for(UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+							size += curField->getArrayElemDynamicSize(object, arrIdx);
+					}
+					else
+						size += arrayNumElems * curField->getTypeSize();
+
+					break;
+				}
+			default:
+				BS_EXCEPT(InternalErrorException,
+					"Error calculating field size. Encountered a type I don't know how to encode. Type: " +
+					toString(UINT32(field->mType)) + ", Is array: " + toString(field->mIsVectorType));
+			}
+		}
+		else
+		{
+			switch(field->mType)
+			{
+			case SerializableFT_ReflectablePtr:
+				size += COMPLEX_TYPE_FIELD_SIZE;
+				break;
+			case SerializableFT_Reflectable:
+				{
+					RTTIReflectableFieldBase* curField = static_cast<RTTIReflectableFieldBase*>(field);
+					IReflectable& childObject = curField->getValue(object);
+
+					size += getObjectEncodedSize(&childObject) + META_SIZE;
+					break;
+				}
+			case SerializableFT_Plain:
+				{
+					RTTIPlainFieldBase* curField = static_cast<RTTIPlainFieldBase*>(field);
+
+					if(curField->hasLayout())
+						size += curField->mLayoutSize;
+					else if(curField->hasDynamicSize())
+						size += curField->getDynamicSize(object);
+					else
+						size += curField->getTypeSize();
+
+					break;
+				}
+			case SerializableFT_DataBlock:
+				{
+					RTTIManagedDataBlockFieldBase* curField = static_cast<RTTIManagedDataBlockFieldBase*>(field);
+
+					UINT32 dataBlockSize = 0;
+					curField->getValue(object, dataBlockSize);
+
+					size += DATA_BLOCK_TYPE_FIELD_SIZE + dataBlockSize;
+					break;
+				}
+			default:
+				BS_EXCEPT(InternalErrorException,
+					"Error calculating field size. Encountered a type I don't know how to encode. Type: " +
+					toString(UINT32(field->mType)) + ", Is array: " + toString(field->mIsVectorType));
+			}
+		}
+
+		return size;
+	}
+
+	UINT32 BinarySerializer::getObjectEncodedSize(IReflectable* object)
+	{
+		RTTITypeBase* si = object->getRTTI();
+		UINT32 size = 0;
+
+		do
+		{
+			si->onSerializationStarted(object, mParams);
+
+			size += sizeof(ObjectMetaData);
+
+			int numFields = si->getNumFields();
+			if(mEmitSkipTables)
+				size += META_SIZE + 2 * sizeof(UINT32) + numFields * 2 * sizeof(UINT32);
+
+			for(int i = 0; i < numFields; i++)
+				size += getFieldEncodedSize(si->getField(i), object);
+
+			si->onSerializationEnded(object, mParams);
+
+			si = si->getBaseClass();
+		} while(si != nullptr);
+
+		return size;
+	}
+
+	UINT8* BinarySerializer::complexTypeToBuffer(IReflectable* object, UINT8* buffer, UINT32& bufferLength,
 		UINT32* bytesWritten, std::function<UINT8*(UINT8*, UINT32, UINT32&)> flushBufferCallback, bool shallow)
 	{
 		if (object != nullptr)
@@ -56,15 +56,25 @@ namespace bs
 		 *										completely). User must then either create a new buffer or empty the existing 
 		 *										one, and then return it by the callback. If the returned buffer address is 
 		 *										NULL, encoding is aborted.
-		 * @param[in]	shallow					Determines how to handle referenced objects. If true then references will 
-		 *										not be encoded and will be set to null. If false then references will be 
+		 * @param[in]	shallow					Determines how to handle referenced objects. If true then references will
+		 *										not be encoded and will be set to null. If false then references will be
 		 *										encoded as well and restored upon decoding.
 		 * @param[in]	params					Optional parameters to be passed to the serialization callbacks on the
 		 *										objects being serialized.
+		 * @param[in]	emitSkipTables			If true every encoded object is prefixed with a skip table (a synthetic
+		 *										field listing the IDs and encoded sizes of the object's fields). Decoders
+		 *										that understand the table can skip unknown or unwanted fields with a
+		 *										single seek instead of parsing their contents, and can partially decode
+		 *										an object (see decodePartial()). Decoders that don't understand the table
+		 *										treat it as an unknown field and skip it, so the output remains readable
+		 *										by older versions. Costs a sizing pre-pass over the object, which invokes
+		 *										field getters and serialization callbacks an additional time, so only
+		 *										enable it for data where forward compatibility or partial decode matters.
 		 */
 		void encode(IReflectable* object, UINT8* buffer, UINT32 bufferLength, UINT32* bytesWritten,
 			std::function<UINT8*(UINT8* buffer, UINT32 bytesWritten, UINT32& newBufferSize)> flushBufferCallback,
-			bool shallow = false, const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>());
+			bool shallow = false, const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>(),
+			bool emitSkipTables = false);
 
 		/**
 		 * Decodes an object from binary data.
@@ -74,10 +84,44 @@ namespace bs
 		 * @param[in]	params		Optional parameters to be passed to the serialization callbacks on the objects being
 		 *							serialized.
 		 */
-		SPtr<IReflectable> decode(const SPtr<DataStream>& data, UINT32 dataLength, 
+		SPtr<IReflectable> decode(const SPtr<DataStream>& data, UINT32 dataLength,
 			const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>());
 
-		/** @name Internal 
+		/**
+		 * Decodes an object from binary data, like decode(), but objects referenced by the root through pointer fields
+		 * are decoded concurrently on task scheduler workers. Sub-graphs that share any object are grouped and decoded
+		 * sequentially by a single worker, so cross-references never need to be fixed up across threads. The root
+		 * object itself is decoded serially at the end, linking in the concurrently decoded sub-graphs.
+		 *
+		 * @param[in]	data  		Binary data to decode.
+		 * @param[in]	dataLength	Length of the data in bytes.
+		 * @param[in]	params		Optional parameters to be passed to the serialization callbacks on the objects being
+		 *							serialized.
+		 *
+		 * @note	Serialization callbacks of the decoded types may get invoked from multiple threads simultaneously
+		 *			and must not rely on unprotected shared state.
+		 */
+		SPtr<IReflectable> decodeParallel(const SPtr<DataStream>& data, UINT32 dataLength,
+			const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>());
+
+		/**
+		 * Decodes only the specified fields of the root object, skipping all others. Useful for cheaply scanning just the
+		 * metadata of large objects (for example reading name and size information off a serialized Resource without
+		 * loading its contents). Fields are skipped with a single seek when the data was encoded with skip tables (see
+		 * encode()), and by parsing over their contents otherwise. The filter applies to the root object only (including
+		 * its base classes); objects referenced by the decoded fields are decoded fully.
+		 *
+		 * @param[in]	data  		Binary data to decode.
+		 * @param[in]	dataLength	Length of the data in bytes.
+		 * @param[in]	fieldFilter	IDs of the root object fields to decode. All other fields are left at their defaults.
+		 * @param[in]	params		Optional parameters to be passed to the serialization callbacks on the objects being
+		 *							serialized.
+		 */
+		SPtr<IReflectable> decodePartial(const SPtr<DataStream>& data, UINT32 dataLength,
+			const UnorderedSet<UINT16>& fieldFilter,
+			const UnorderedMap<String, UINT64>& params = UnorderedMap<String, UINT64>());
+
+		/** @name Internal
 		 *  @{
 		 */
 
@@ -88,8 +132,14 @@ namespace bs
 		 * @param[in]	shallow		Determines how to handle referenced objects. If true then references will not be encoded
 		 *							and will be set to null. If false then references will be encoded as well and restored
 		 *							upon decoding.
+		 * @param[in]	alloc		Optional arena to allocate the intermediate representation from. If provided, all nodes
+		 *							of the returned graph (and any copied field data) are placed in the arena instead of
+		 *							being allocated individually from the heap, which is significantly faster for large
+		 *							objects. The caller must keep the arena alive for as long as the returned graph is in
+		 *							use, and may clear() it afterwards to free the entire graph in one go (after releasing
+		 *							any references to it).
 		 */
-		SPtr<SerializedObject> _encodeToIntermediate(IReflectable* object, bool shallow = false);
+		SPtr<SerializedObject> _encodeToIntermediate(IReflectable* object, bool shallow = false, FrameAlloc* alloc = nullptr);
 
 		/**
 		 * Decodes a serialized object into an intermediate representation for easier parsing.
@@ -100,11 +150,14 @@ namespace bs
 		 *							serialized object will be invalid as soon as the original data buffer is destroyed.
 		 *							Referencing is faster than copying. If the source data stream is a file stream the data
 		 *							will always be copied.
+		 * @param[in]	alloc		Optional arena to allocate the intermediate representation from. See
+		 *							_encodeToIntermediate() for details on ownership and lifetime.
 		 *
 		 * @note
 		 * References to field data will point to the original buffer and will become invalid when it is destroyed.
 		 */
-		SPtr<SerializedObject> _decodeToIntermediate(const SPtr<DataStream>& data, UINT32 dataLength, bool copyData = false);
+		SPtr<SerializedObject> _decodeToIntermediate(const SPtr<DataStream>& data, UINT32 dataLength, bool copyData = false,
+			FrameAlloc* alloc = nullptr, const UnorderedSet<UINT16>* rootFieldFilter = nullptr);
 
 		/** Decodes an intermediate representation of a serialized object into the actual object. */
 		SPtr<IReflectable> _decodeFromIntermediate(const SPtr<SerializedObject>& serializedObject);
@@ -147,9 +200,31 @@ namespace bs
 		/**	Decodes a single IReflectable object. */
 		void decodeEntry(const SPtr<IReflectable>& object, const SPtr<SerializedObject>& serializableObject);
 
+		/**
+		 * Finds all objects referenced through pointer fields in the inline data of @p object, without recursing into
+		 * the referenced objects themselves.
+		 */
+		static void findReferencedObjects(const SPtr<SerializedObject>& object, Vector<SPtr<SerializedObject>>& output);
+
+		/** Outputs @p object and every object transitively reachable from it through pointer fields. */
+		static void collectSubGraph(const SPtr<SerializedObject>& object, Vector<SPtr<SerializedObject>>& output);
+
 		/**	Decodes an object in memory into an intermediate representation for easier parsing. */
-		bool decodeEntry(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, SPtr<SerializedObject>& output, 
-			bool copyData, bool streamDataBlock);
+		bool decodeEntry(const SPtr<DataStream>& data, UINT32 dataLength, UINT32& bytesRead, SPtr<SerializedObject>& output,
+			bool copyData, bool streamDataBlock, const UnorderedSet<UINT16>* fieldFilter = nullptr);
+
+		/**
+		 * Calculates the number of bytes encoding the provided field would write, including its meta data. Must mirror
+		 * the encoding logic in encodeEntry() exactly.
+		 */
+		UINT32 getFieldEncodedSize(RTTIField* field, IReflectable* object);
+
+		/**
+		 * Calculates the number of bytes encoding the provided object would write, covering its entire class hierarchy
+		 * but excluding the terminator field written by complexTypeToBuffer(). Invokes serialization callbacks and field
+		 * getters the same way encoding does.
+		 */
+		UINT32 getObjectEncodedSize(IReflectable* object);
 
 		/**	Helper method for encoding a complex object and copying its data to a buffer. */
 		UINT8* complexTypeToBuffer(IReflectable* object, UINT8* buffer, UINT32& bufferLength, UINT32* bytesWritten,
@@ -193,6 +268,13 @@ namespace bs
 		/** Returns true if the provided encoded meta data represents object meta data. */
 		static bool isObjectMetaData(UINT32 encodedData);
 
+		/**
+		 * Allocates a node of the intermediate representation, either from the heap or from the arena provided to
+		 * _encodeToIntermediate()/_decodeToIntermediate().
+		 */
+		template <class T>
+		SPtr<T> allocIntermediateNode();
+
 		UnorderedMap<void*, UINT32> mObjectAddrToId;
 		UINT32 mLastUsedObjectId = 1;
 		Vector<ObjectToEncode> mObjectsToEncode;
@@ -200,8 +282,14 @@ namespace bs
 
 		UnorderedMap<SPtr<SerializedObject>, ObjectToDecode> mObjectMap;
 		UnorderedMap<UINT32, SPtr<SerializedObject>> mInterimObjectMap;
+		FrameAlloc* mIntermediateAlloc = nullptr;
 
 		UnorderedMap<String, UINT64> mParams;
+		bool mEmitSkipTables = false;
+
+		// Field ID reserved for per-object skip tables. Encoded as a regular plain field with a dynamic size, so
+		// decoders unaware of skip tables handle it like any other unknown field.
+		static constexpr const UINT16 SKIP_TABLE_FIELD_ID = 0xFFFF;
 
 		static constexpr const int META_SIZE = 4; // Meta field size
 		static constexpr const int NUM_ELEM_FIELD_SIZE = 4; // Size of the field storing number of array elements
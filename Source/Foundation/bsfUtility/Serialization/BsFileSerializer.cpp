@@ -62,9 +62,15 @@ namespace bs
 		return bufferStart;
 	}
 
-	FileDecoder::FileDecoder(const Path& fileLocation)
+	FileDecoder::FileDecoder(const Path& fileLocation, bool memoryMapped)
 	{
-		mInputStream = FileSystem::openFile(fileLocation, true);
+		if (memoryMapped)
+			mInputStream = FileSystem::mapFile(fileLocation);
+
+		// The serializer can then reference plain data and data block payloads directly from the mapped memory,
+		// instead of copying them out of a buffered file stream.
+		if (mInputStream == nullptr)
+			mInputStream = FileSystem::openFile(fileLocation, true);
 
 		if (mInputStream == nullptr)
 			return;
@@ -45,7 +45,16 @@ namespace bs
 	class BS_UTILITY_EXPORT FileDecoder
 	{
 	public:
-		FileDecoder(const Path& fileLocation);
+		/**
+		 * Opens the file at the provided location and prepares it for decoding.
+		 *
+		 * @param[in]	fileLocation	Location of the file to decode.
+		 * @param[in]	memoryMapped	If true the file is memory-mapped instead of read through a buffered stream.
+		 *								Decoded data is then referenced directly from the mapping where possible (plain
+		 *								data fields and data block payloads), avoiding an extra copy. Falls back to a
+		 *								buffered stream if the file cannot be mapped.
+		 */
+		FileDecoder(const Path& fileLocation, bool memoryMapped = false);
 
 		/**	
 		 * Deserializes an IReflectable object by reading the binary data at the provided file location. 
@@ -0,0 +1,111 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Testing/BsBenchmarkSuite.h"
+#include "Utility/BsTimer.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Debug/BsDebug.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace bs
+{
+	BenchmarkSuite::BenchmarkEntry::BenchmarkEntry(Func benchmark, const String& name, UINT32 numWarmUpRuns,
+		UINT32 numMeasuredRuns)
+		: benchmark(benchmark), name(name), numWarmUpRuns(numWarmUpRuns), numMeasuredRuns(numMeasuredRuns)
+	{ }
+
+	void BenchmarkSuite::addBenchmark(Func benchmark, const String& name, UINT32 numWarmUpRuns, UINT32 numMeasuredRuns)
+	{
+		mBenchmarks.push_back(BenchmarkEntry(benchmark, name, numWarmUpRuns, std::max(numMeasuredRuns, 1U)));
+	}
+
+	Vector<BenchmarkResult> BenchmarkSuite::run()
+	{
+		Vector<BenchmarkResult> results;
+		for (auto& entry : mBenchmarks)
+		{
+			for (UINT32 i = 0; i < entry.numWarmUpRuns; i++)
+				(this->*(entry.benchmark))();
+
+			Vector<double> timings(entry.numMeasuredRuns);
+			for (UINT32 i = 0; i < entry.numMeasuredRuns; i++)
+			{
+				Timer timer;
+				(this->*(entry.benchmark))();
+				timings[i] = timer.getMicroseconds() * 0.001;
+			}
+
+			std::sort(timings.begin(), timings.end());
+
+			BenchmarkResult result;
+			result.name = entry.name;
+			result.numRuns = entry.numMeasuredRuns;
+			result.minMs = timings.front();
+			result.maxMs = timings.back();
+
+			UINT32 count = (UINT32)timings.size();
+			if (count % 2 == 0)
+				result.medianMs = (timings[count / 2 - 1] + timings[count / 2]) * 0.5;
+			else
+				result.medianMs = timings[count / 2];
+
+			double sum = 0.0;
+			for (auto& timing : timings)
+				sum += timing;
+
+			result.meanMs = sum / count;
+
+			double varianceSum = 0.0;
+			for (auto& timing : timings)
+				varianceSum += (timing - result.meanMs) * (timing - result.meanMs);
+
+			result.stdDevMs = std::sqrt(varianceSum / count);
+
+			results.push_back(result);
+		}
+
+		return results;
+	}
+
+	void BenchmarkSuite::saveJSON(const Vector<BenchmarkResult>& results, const Path& path)
+	{
+		if (!FileSystem::exists(path.getDirectory()))
+			FileSystem::createDir(path.getDirectory());
+
+		std::ofstream output;
+		output.open(path.toPlatformString().c_str(), std::ios::out);
+		if (output.fail())
+		{
+			LOGWRN("Failed to save benchmark results at path: \"" + path.toString() + "\". Error: " +
+				strerror(errno) + ".");
+			return;
+		}
+
+		output << std::fixed;
+		output.precision(4);
+
+		output << "{\"benchmarks\":[";
+		bool first = true;
+		for (auto& result : results)
+		{
+			if (!first)
+				output << ",";
+
+			first = false;
+			output << "\n\t{";
+			output << "\"name\":\"" << result.name.c_str() << "\",";
+			output << "\"numRuns\":" << result.numRuns << ",";
+			output << "\"meanMs\":" << result.meanMs << ",";
+			output << "\"medianMs\":" << result.medianMs << ",";
+			output << "\"minMs\":" << result.minMs << ",";
+			output << "\"maxMs\":" << result.maxMs << ",";
+			output << "\"stdDevMs\":" << result.stdDevMs;
+			output << "}";
+		}
+
+		output << "\n]}\n";
+		output.close();
+	}
+}
@@ -0,0 +1,93 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Contains aggregated timing statistics of a single benchmark. All times are in milliseconds. */
+	struct BenchmarkResult
+	{
+		String name;
+		UINT32 numRuns = 0;
+		double meanMs = 0.0;
+		double medianMs = 0.0;
+		double minMs = 0.0;
+		double maxMs = 0.0;
+		double stdDevMs = 0.0;
+	};
+
+	/**
+	 * Primary class for micro-benchmarking. Override and register benchmarks in the constructor, then run them using
+	 * run(). Each benchmark is executed several times without measurement to warm up caches and branch predictors,
+	 * then measured over multiple runs and reported with aggregate statistics, so individual noisy runs don't skew
+	 * comparisons between builds.
+	 */
+	class BS_UTILITY_EXPORT BenchmarkSuite
+	{
+	public:
+		typedef void(BenchmarkSuite::*Func)();
+
+	private:
+		/** Contains data about a single registered benchmark. */
+		struct BenchmarkEntry
+		{
+			BenchmarkEntry(Func benchmark, const String& name, UINT32 numWarmUpRuns, UINT32 numMeasuredRuns);
+
+			Func benchmark;
+			String name;
+			UINT32 numWarmUpRuns;
+			UINT32 numMeasuredRuns;
+		};
+
+	public:
+		virtual ~BenchmarkSuite() = default;
+
+		/** Runs all the benchmarks in the suite and returns their aggregated timings. */
+		Vector<BenchmarkResult> run();
+
+		/**
+		 * Saves a set of benchmark results as a JSON file, suitable for archiving and automated comparison between
+		 * builds.
+		 *
+		 * @param[in]	results		Results as returned from run().
+		 * @param[in]	path		Path to the file to write. Any existing file will be overwritten.
+		 */
+		static void saveJSON(const Vector<BenchmarkResult>& results, const Path& path);
+
+		/**	Creates a new suite of a particular type. */
+		template <class T>
+		static SPtr<BenchmarkSuite> create()
+		{
+			static_assert((std::is_base_of<BenchmarkSuite, T>::value),
+				"Invalid benchmark suite type. It needs to derive from bs::BenchmarkSuite.");
+
+			return std::static_pointer_cast<BenchmarkSuite>(bs_shared_ptr_new<T>());
+		}
+
+	protected:
+		BenchmarkSuite() = default;
+
+		/**
+		 * Registers a new benchmark.
+		 *
+		 * @param[in]	benchmark		Function to call in order to execute the benchmark.
+		 * @param[in]	name			Name of the benchmark, used for reporting.
+		 * @param[in]	numWarmUpRuns	Number of unmeasured runs executed before measurement starts.
+		 * @param[in]	numMeasuredRuns	Number of measured runs the statistics are aggregated over.
+		 */
+		void addBenchmark(Func benchmark, const String& name, UINT32 numWarmUpRuns = 3, UINT32 numMeasuredRuns = 16);
+
+		Vector<BenchmarkEntry> mBenchmarks;
+	};
+
+/** Registers a new benchmark within an implementation of BenchmarkSuite. */
+#define BS_ADD_BENCHMARK(func) addBenchmark(static_cast<Func>(&func), #func);
+
+	/** @} */
+}
@@ -10,21 +10,75 @@ namespace bs
 		return mData->mIsCompleted.load(std::memory_order_acquire);
 	}
 
-	void AsyncOp::_completeOperation(Any returnValue) 
-	{ 
-		mData->mReturnValue = returnValue; 
-		mData->mIsCompleted.store(true, std::memory_order_release);
+	AsyncOp AsyncOp::then(std::function<Any(const Any&)> callback, Scheduler scheduler) const
+	{
+		AsyncOp chainedOp;
+
+		std::function<void(const Any&)> continuation =
+			[callback = std::move(callback), scheduler = std::move(scheduler), chainedOp](const Any& returnValue) mutable
+		{
+			auto invoke = [callback, chainedOp, returnValue]() mutable
+			{
+				chainedOp._completeOperation(callback(returnValue));
+			};
+
+			if (scheduler != nullptr)
+				scheduler(std::move(invoke));
+			else
+				invoke();
+		};
+
+		bool alreadyCompleted = false;
+		{
+			ScopedSpinLock lock(mData->mContinuationsLock);
+
+			// Check under the lock, so a completion racing with the registration can't miss the continuation
+			if (mData->mIsCompleted.load(std::memory_order_acquire))
+				alreadyCompleted = true;
+			else
+				mData->mContinuations.push_back(continuation);
+		}
+
+		if (alreadyCompleted)
+			continuation(mData->mReturnValue);
+
+		return chainedOp;
+	}
+
+	void AsyncOp::_completeOperation(Any returnValue)
+	{
+		mData->mReturnValue = returnValue;
+
+		Vector<std::function<void(const Any&)>> continuations;
+		{
+			ScopedSpinLock lock(mData->mContinuationsLock);
+
+			mData->mIsCompleted.store(true, std::memory_order_release);
+			continuations.swap(mData->mContinuations);
+		}
 
 		if (mSyncData != nullptr)
 			mSyncData->mCondition.notify_all();
+
+		for (auto& continuation : continuations)
+			continuation(mData->mReturnValue);
 	}
 
-	void AsyncOp::_completeOperation() 
-	{ 
-		mData->mIsCompleted.store(true, std::memory_order_release);
+	void AsyncOp::_completeOperation()
+	{
+		Vector<std::function<void(const Any&)>> continuations;
+		{
+			ScopedSpinLock lock(mData->mContinuationsLock);
+
+			mData->mIsCompleted.store(true, std::memory_order_release);
+			continuations.swap(mData->mContinuations);
+		}
 
 		if (mSyncData != nullptr)
 			mSyncData->mCondition.notify_all();
+
+		for (auto& continuation : continuations)
+			continuation(mData->mReturnValue);
 	}
 
 	void AsyncOp::blockUntilComplete() const
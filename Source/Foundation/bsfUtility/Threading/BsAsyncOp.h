@@ -5,6 +5,7 @@
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Error/BsException.h"
 #include "Utility/BsAny.h"
+#include "Threading/BsSpinLock.h"
 
 namespace bs
 {
@@ -57,9 +58,17 @@ namespace bs
 
 			Any mReturnValue;
 			volatile std::atomic<bool> mIsCompleted{false};
+			Vector<std::function<void(const Any&)>> mContinuations;
+			SpinLock mContinuationsLock;
 		};
 
 	public:
+		/**
+		 * Method that invokes a continuation on a specific thread or scheduler lane. Receives the continuation as a
+		 * parameter and must eventually execute it exactly once.
+		 */
+		typedef std::function<void(std::function<void()>)> Scheduler;
+
 		AsyncOp()
 			:mData(bs_shared_ptr_new<AsyncOpData>())
 		{ }
@@ -106,6 +115,23 @@ namespace bs
 		 */
 		Any getGenericReturnValue() const { return mData->mReturnValue; }
 
+		/**
+		 * Registers a continuation that is invoked once when the operation completes, receiving the operation's generic
+		 * return value. This allows multi-stage async pipelines (e.g. load, then decode, then upload) to be expressed as
+		 * a linear chain instead of blocking waits or nested callbacks.
+		 *
+		 * @param[in]	callback	Continuation to run when the operation completes. Its return value becomes the return
+		 *							value of the AsyncOp returned by this method, allowing further chaining. Return an
+		 *							empty Any if there is no meaningful value.
+		 * @param[in]	scheduler	(optional) Method used for scheduling the continuation onto a specific thread (e.g.
+		 *							queueing a core thread command, or submitting a task to TaskScheduler). If not
+		 *							provided the continuation runs on whatever thread completes the operation (or the
+		 *							calling thread, if the operation has already completed).
+		 * @return					Async operation that completes once the continuation has executed, with the
+		 *							continuation's return value.
+		 */
+		AsyncOp then(std::function<Any(const Any&)> callback, Scheduler scheduler = nullptr) const;
+
 	public: // ***** INTERNAL ******
 		/** @name Internal 
 		 *  @{
@@ -0,0 +1,121 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Threading/BsNumaTopology.h"
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+#include <cstdio>
+#include <cstdlib>
+#endif
+
+namespace bs
+{
+	/** Maximum number of NUMA nodes the topology query supports. */
+	static constexpr UINT32 MAX_NUMA_NODES = 16;
+
+	/** Cached system NUMA topology, queried once on first use. */
+	struct NumaInfo
+	{
+		UINT32 numNodes = 1;
+		UINT64 nodeCoreMasks[MAX_NUMA_NODES] = { 0 };
+	};
+
+#if BS_PLATFORM == BS_PLATFORM_LINUX
+	/** Parses a Linux cpulist string (e.g. "0-7,16-23") into a core bitmask. Cores past 63 are ignored. */
+	static UINT64 parseCpuList(const char* cpuList)
+	{
+		UINT64 mask = 0;
+
+		const char* cur = cpuList;
+		while (*cur != '\0' && *cur != '\n')
+		{
+			char* end = nullptr;
+			long rangeStart = strtol(cur, &end, 10);
+			if (end == cur)
+				break;
+
+			long rangeEnd = rangeStart;
+			cur = end;
+			if (*cur == '-')
+			{
+				cur++;
+				rangeEnd = strtol(cur, &end, 10);
+				if (end == cur)
+					break;
+
+				cur = end;
+			}
+
+			for (long i = rangeStart; i <= rangeEnd && i < 64; i++)
+				mask |= (UINT64)1 << i;
+
+			if (*cur == ',')
+				cur++;
+		}
+
+		return mask;
+	}
+#endif
+
+	static NumaInfo queryNumaInfo()
+	{
+		NumaInfo info;
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		ULONG highestNode = 0;
+		if (GetNumaHighestNodeNumber(&highestNode) && highestNode > 0)
+		{
+			info.numNodes = std::min((UINT32)highestNode + 1, MAX_NUMA_NODES);
+
+			for (UINT32 i = 0; i < info.numNodes; i++)
+			{
+				ULONGLONG processorMask = 0;
+				if (GetNumaNodeProcessorMask((UCHAR)i, &processorMask))
+					info.nodeCoreMasks[i] = (UINT64)processorMask;
+			}
+		}
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+		for (UINT32 i = 0; i < MAX_NUMA_NODES; i++)
+		{
+			char path[64];
+			snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", i);
+
+			FILE* file = fopen(path, "r");
+			if (file == nullptr)
+				break;
+
+			char cpuList[256];
+			if (fgets(cpuList, sizeof(cpuList), file) != nullptr)
+				info.nodeCoreMasks[i] = parseCpuList(cpuList);
+
+			fclose(file);
+
+			info.numNodes = i + 1;
+		}
+#endif
+
+		return info;
+	}
+
+	static const NumaInfo& getNumaInfo()
+	{
+		static NumaInfo info = queryNumaInfo();
+		return info;
+	}
+
+	UINT32 NumaTopology::getNumNodes()
+	{
+		return getNumaInfo().numNodes;
+	}
+
+	UINT64 NumaTopology::getNodeCoreMask(UINT32 node)
+	{
+		const NumaInfo& info = getNumaInfo();
+		if (node >= info.numNodes)
+			return 0;
+
+		return info.nodeCoreMasks[node];
+	}
+}
@@ -0,0 +1,38 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Provides information about the NUMA (non-uniform memory access) topology of the system, allowing threads to be
+	 * placed so that the memory they touch stays on their own node. On systems without multiple NUMA nodes, or on
+	 * platforms where the topology cannot be queried, a single node covering all cores is reported.
+	 *
+	 * Note that memory itself follows the first-touch policy of the OS: pages are placed on the node of the thread
+	 * that first writes to them. Binding a thread to a node (see ThreadPool::run() affinity mask) is therefore enough
+	 * to make its allocations, including per-thread frame allocator blocks, node-local.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT NumaTopology
+	{
+	public:
+		/** Returns the number of NUMA nodes on the system. Always at least 1. */
+		static UINT32 getNumNodes();
+
+		/**
+		 * Returns a bitmask of the logical cores belonging to the provided node, where bit N corresponds to core N.
+		 * Returns zero (no restriction) for invalid nodes, or when core membership cannot be determined.
+		 */
+		static UINT64 getNodeCoreMask(UINT32 node);
+	};
+
+	/** @} */
+}
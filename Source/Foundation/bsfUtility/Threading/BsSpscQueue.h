@@ -0,0 +1,103 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Bounded lock-free queue supporting a single producer thread and a single consumer thread. Entries are delivered in
+	 * FIFO order. Useful for streaming events across threads (e.g. OS input events) without taking a lock per entry.
+	 *
+	 * @note
+	 * push() may only ever be called from one thread, and pop() from one (possibly different) thread. Using either from
+	 * multiple threads concurrently is not safe.
+	 * @note
+	 * Entries must be trivially copyable as they are copied in and out of the backing buffer without synchronization
+	 * beyond the index ordering.
+	 */
+	template <class T>
+	class SpscQueue
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "SpscQueue entries must be trivially copyable.");
+
+	public:
+		/** Constructs a queue able to hold @p capacity entries. Capacity must be a power of two. */
+		SpscQueue(UINT32 capacity = 4096)
+			:mCapacity(capacity), mMask(capacity - 1)
+		{
+			assert((capacity & (capacity - 1)) == 0 && "Capacity must be a power of two.");
+
+			mEntries = bs_allocN<T>(capacity);
+		}
+
+		~SpscQueue()
+		{
+			bs_free(mEntries);
+		}
+
+		SpscQueue(const SpscQueue&) = delete;
+		SpscQueue& operator=(const SpscQueue&) = delete;
+
+		/**
+		 * Appends a new entry to the queue. Must always be called from the same (producer) thread. Returns false if the
+		 * queue is full, in which case the entry is not added.
+		 */
+		bool push(const T& value)
+		{
+			UINT32 tail = mTail.load(std::memory_order_relaxed);
+			UINT32 head = mHead.load(std::memory_order_acquire);
+
+			if ((tail - head) >= mCapacity)
+				return false;
+
+			mEntries[tail & mMask] = value;
+			mTail.store(tail + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 * Removes the oldest entry from the queue. Must always be called from the same (consumer) thread. Returns false
+		 * if the queue is empty.
+		 */
+		bool pop(T& value)
+		{
+			UINT32 head = mHead.load(std::memory_order_relaxed);
+			UINT32 tail = mTail.load(std::memory_order_acquire);
+
+			if (head == tail)
+				return false;
+
+			value = mEntries[head & mMask];
+			mHead.store(head + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/** Returns the approximate number of entries in the queue. Only a hint as the other thread may modify it. */
+		UINT32 size() const
+		{
+			UINT32 tail = mTail.load(std::memory_order_relaxed);
+			UINT32 head = mHead.load(std::memory_order_relaxed);
+
+			return tail - head;
+		}
+
+	private:
+		T* mEntries;
+		UINT32 mCapacity;
+		UINT32 mMask;
+
+		std::atomic<UINT32> mHead{0};
+		std::atomic<UINT32> mTail{0};
+	};
+
+	/** @} */
+}
@@ -2,9 +2,28 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Threading/BsTaskScheduler.h"
 #include "Threading/BsThreadPool.h"
+#include "Threading/BsNumaTopology.h"
 
 namespace bs
 {
+	/** Index of the work-stealing worker owned by the current thread, or (UINT32)-1 when not a worker thread. */
+	static thread_local UINT32 tWorkerIdx = (UINT32)-1;
+
+	/** Maps a task priority onto the scheduling band its worker thread should run at. */
+	static ThreadBand getTaskBand(TaskPriority priority)
+	{
+		switch(priority)
+		{
+		case TaskPriority::VeryHigh:
+			return ThreadBand::TimeCritical;
+		case TaskPriority::VeryLow:
+		case TaskPriority::Low:
+			return ThreadBand::Background;
+		default:
+			return ThreadBand::Normal;
+		}
+	}
+
 	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
 		TaskPriority priority, SPtr<Task> dependency)
 		: mName(name), mPriority(priority), mTaskWorker(std::move(taskWorker)), mTaskDependency(std::move(dependency))
@@ -12,12 +31,25 @@ namespace bs
 
 	}
 
-	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority, 
+	Task::Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
+		TaskPriority priority, const Vector<SPtr<Task>>& dependencies)
+		: mName(name), mPriority(priority), mTaskWorker(std::move(taskWorker)), mDependencies(dependencies)
+	{
+
+	}
+
+	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, TaskPriority priority,
 		SPtr<Task> dependency)
 	{
 		return bs_shared_ptr_new<Task>(PrivatelyConstruct(), name, std::move(taskWorker), priority, std::move(dependency));
 	}
 
+	SPtr<Task> Task::create(const String& name, std::function<void()> taskWorker, const Vector<SPtr<Task>>& dependencies,
+		TaskPriority priority)
+	{
+		return bs_shared_ptr_new<Task>(PrivatelyConstruct(), name, std::move(taskWorker), priority, dependencies);
+	}
+
 	bool Task::isComplete() const
 	{
 		return mState == 2;
@@ -39,12 +71,30 @@ namespace bs
 		mState = 3;
 	}
 
-	TaskScheduler::TaskScheduler()
-		:mTaskQueue(&TaskScheduler::taskCompare)
+	TaskScheduler::TaskScheduler(TaskSchedulerMode mode)
+		:mMode(mode), mTaskQueue(&TaskScheduler::taskCompare)
 	{
 		mMaxActiveTasks = BS_THREAD_HARDWARE_CONCURRENCY;
 
-		mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+		if(mMode == TaskSchedulerMode::Centralized)
+			mTaskSchedulerThread = ThreadPool::instance().run("TaskScheduler", std::bind(&TaskScheduler::runMain, this));
+		else
+		{
+			// Spread workers evenly over NUMA nodes and pin each to its node. Combined with the first-touch page
+			// placement of the OS this keeps worker allocations (including frame allocator blocks) node-local.
+			mNumNumaNodes = NumaTopology::getNumNodes();
+
+			for (UINT32 i = 0; i < mMaxActiveTasks; i++)
+			{
+				Worker* worker = bs_new<Worker>();
+				worker->numaNode = i % mNumNumaNodes;
+				mWorkers.push_back(worker);
+
+				UINT64 affinityMask = mNumNumaNodes > 1 ? NumaTopology::getNodeCoreMask(worker->numaNode) : 0;
+				worker->thread = ThreadPool::instance().run("TaskSchedulerWorker",
+					std::bind(&TaskScheduler::runWorker, this, i), ThreadBand::Normal, affinityMask);
+			}
+		}
 	}
 
 	TaskScheduler::~TaskScheduler()
@@ -63,6 +113,13 @@ namespace bs
 			}
 		}
 
+		if(mMode == TaskSchedulerMode::WorkStealing)
+		{
+			// Wait until the worker deques and the shared queue drain
+			while (mNumQueuedTasks.load() > 0)
+				BS_THREAD_SLEEP(1);
+		}
+
 		// Start shutdown of the main queue worker and wait until it exits
 		{
 			Lock lock(mReadyMutex);
@@ -70,21 +127,99 @@ namespace bs
 			mShutdown = true;
 		}
 
-		mTaskReadyCond.notify_one();
+		if(mMode == TaskSchedulerMode::Centralized)
+		{
+			mTaskReadyCond.notify_one();
+			mTaskSchedulerThread.blockUntilComplete();
+		}
+		else
+		{
+			mTaskReadyCond.notify_all();
+
+			for (auto& worker : mWorkers)
+				worker->thread.blockUntilComplete();
 
-		mTaskSchedulerThread.blockUntilComplete();
+			for (auto& worker : mWorkers)
+				bs_delete(worker);
+
+			mWorkers.clear();
+		}
 	}
 
 	void TaskScheduler::addTask(SPtr<Task> task)
 	{
-		Lock lock(mReadyMutex);
-
 		assert(task->mState != 1 && "Task is already executing, it cannot be executed again until it finishes.");
 
 		task->mParent = this;
-		task->mTaskId = mNextTaskId++;
 		task->mState.store(0); // Reset state in case the task is getting re-queued
 
+		if(task->mNumaNode != (UINT32)-1)
+			task->mNumaNode %= mNumNumaNodes;
+
+		if(!task->mDependencies.empty())
+		{
+			if(mMode == TaskSchedulerMode::WorkStealing)
+				mNumQueuedTasks.fetch_add(1, std::memory_order_release);
+
+			// Extra count guards against the task getting scheduled while registration is still in progress
+			UINT32 numDeps = (UINT32)task->mDependencies.size();
+			task->mUnfinishedDeps.store(numDeps + 1, std::memory_order_release);
+
+			for(auto& dependency : task->mDependencies)
+			{
+				bool registered = false;
+
+				dependency->mDependantsLock.lock();
+				if(!dependency->isComplete() && !dependency->isCanceled())
+				{
+					dependency->mDependants.push_back(task);
+					registered = true;
+				}
+				dependency->mDependantsLock.unlock();
+
+				if(!registered)
+					task->mUnfinishedDeps.fetch_sub(1, std::memory_order_acq_rel);
+			}
+
+			// Remove the registration guard, scheduling the task immediately if all dependencies already completed
+			if(task->mUnfinishedDeps.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				scheduleDependant(std::move(task));
+
+			return;
+		}
+
+		if(mMode == TaskSchedulerMode::WorkStealing)
+		{
+			mNumQueuedTasks.fetch_add(1, std::memory_order_release);
+
+			// Tasks queued from a worker go on its own deque without taking any locks, and get popped in LIFO order
+			// which keeps hot data in cache. Everything else, including tasks hinted to another NUMA node, goes
+			// through the shared priority queue.
+			if(tWorkerIdx != (UINT32)-1 && task->mTaskDependency == nullptr &&
+				(task->mNumaNode == (UINT32)-1 || task->mNumaNode == mWorkers[tWorkerIdx]->numaNode))
+			{
+				Task* rawTask = task.get();
+				rawTask->mSelfRef = std::move(task);
+
+				mWorkers[tWorkerIdx]->queue.push(rawTask);
+			}
+			else
+			{
+				Lock lock(mReadyMutex);
+
+				task->mTaskId = mNextTaskId++;
+				mTaskQueue.insert(std::move(task));
+
+				mTaskReadyCond.notify_all();
+			}
+
+			return;
+		}
+
+		Lock lock(mReadyMutex);
+
+		task->mTaskId = mNextTaskId++;
+
 		mCheckTasks = true;
 		mTaskQueue.insert(std::move(task));
 
@@ -127,13 +262,14 @@ namespace bs
 			for(auto iter = mTaskQueue.begin(); iter != mTaskQueue.end();)
 			{
 				if ((UINT32)mActiveTasks.size() >= mMaxActiveTasks)
-					break;	
+					break;
 
 				SPtr<Task> curTask = *iter;
 
 				if(curTask->isCanceled())
 				{
 					iter = mTaskQueue.erase(iter);
+					releaseDependants(curTask.get());
 					continue;
 				}
 
@@ -148,7 +284,10 @@ namespace bs
 				curTask->mState.store(1);
 				mActiveTasks.push_back(curTask);
 
-				ThreadPool::instance().run(curTask->mName, std::bind(&TaskScheduler::runTask, this, curTask));
+				// Route the task onto a thread running at the OS priority matching its own, so background tasks never
+				// preempt frame-critical threads
+				ThreadPool::instance().run(curTask->mName, std::bind(&TaskScheduler::runTask, this, curTask),
+					getTaskBand(curTask->mPriority));
 			}
 		}
 	}
@@ -172,6 +311,8 @@ namespace bs
 			mTaskCompleteCond.notify_all();
 		}
 
+		releaseDependants(task.get());
+
 		// Wake the main scheduler thread in case there are other tasks waiting or this task was someone's dependency
 		{
 			Lock lock(mReadyMutex);
@@ -181,11 +322,183 @@ namespace bs
 		}
 	}
 
+	void TaskScheduler::runWorker(UINT32 workerIdx)
+	{
+		tWorkerIdx = workerIdx;
+
+		while(true)
+		{
+			Task* task = findWorkerTask(workerIdx);
+			if(task != nullptr)
+			{
+				runWorkerTask(workerIdx, task);
+				continue;
+			}
+
+			Lock lock(mReadyMutex);
+
+			if(mShutdown)
+				break;
+
+			// Sleep with a timeout rather than indefinitely, as local pushes on other workers don't signal (that would
+			// require them taking a lock), so we periodically wake up to attempt a steal.
+			mTaskReadyCond.wait_for(lock, std::chrono::milliseconds(2));
+		}
+
+		tWorkerIdx = (UINT32)-1;
+	}
+
+	Task* TaskScheduler::findWorkerTask(UINT32 workerIdx)
+	{
+		// Fast path: pop from our own deque, most recently pushed first
+		Task* task = nullptr;
+		if(mWorkers[workerIdx]->queue.pop(task))
+			return task;
+
+		UINT32 myNode = mWorkers[workerIdx]->numaNode;
+
+		// Check the shared queue for tasks queued from non-worker threads, or tasks with dependencies
+		{
+			Lock lock(mReadyMutex);
+
+			for(auto iter = mTaskQueue.begin(); iter != mTaskQueue.end(); ++iter)
+			{
+				SPtr<Task> curTask = *iter;
+				if(curTask->mTaskDependency != nullptr && !curTask->mTaskDependency->isComplete())
+					continue;
+
+				// Leave tasks hinted to another NUMA node for that node's workers
+				if(mNumNumaNodes > 1 && curTask->mNumaNode != (UINT32)-1 && curTask->mNumaNode != myNode)
+					continue;
+
+				mTaskQueue.erase(iter);
+
+				task = curTask.get();
+				task->mSelfRef = std::move(curTask);
+
+				return task;
+			}
+		}
+
+		// Steal the oldest task from another worker, preferring victims on our own NUMA node so stolen tasks keep
+		// operating on node-local memory
+		UINT32 numWorkers = (UINT32)mWorkers.size();
+		if(mNumNumaNodes > 1)
+		{
+			for (UINT32 i = 1; i < numWorkers; i++)
+			{
+				UINT32 victimIdx = (workerIdx + i) % numWorkers;
+				if(mWorkers[victimIdx]->numaNode != myNode)
+					continue;
+
+				if(mWorkers[victimIdx]->queue.steal(task))
+					return task;
+			}
+		}
+
+		for (UINT32 i = 1; i < numWorkers; i++)
+		{
+			UINT32 victimIdx = (workerIdx + i) % numWorkers;
+			if(mWorkers[victimIdx]->queue.steal(task))
+				return task;
+		}
+
+		return nullptr;
+	}
+
+	void TaskScheduler::runWorkerTask(UINT32 workerIdx, Task* task)
+	{
+		SPtr<Task> taskPtr = std::move(task->mSelfRef);
+
+		if(task->isCanceled())
+		{
+			releaseDependants(task);
+			mNumQueuedTasks.fetch_sub(1, std::memory_order_release);
+			return;
+		}
+
+		task->mState.store(1);
+		task->mTaskWorker();
+
+		{
+			Lock lock(mCompleteMutex);
+			task->mState.store(2);
+
+			mTaskCompleteCond.notify_all();
+		}
+
+		releaseDependants(task);
+
+		mNumQueuedTasks.fetch_sub(1, std::memory_order_release);
+
+		// Wake other workers in case this task was someone's dependency
+		mTaskReadyCond.notify_all();
+	}
+
+	void TaskScheduler::releaseDependants(Task* task)
+	{
+		Vector<SPtr<Task>> dependants;
+
+		task->mDependantsLock.lock();
+		dependants.swap(task->mDependants);
+		task->mDependantsLock.unlock();
+
+		for(auto& dependant : dependants)
+		{
+			if(dependant->mUnfinishedDeps.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				scheduleDependant(std::move(dependant));
+		}
+
+		task->mDependencies.clear();
+	}
+
+	void TaskScheduler::scheduleDependant(SPtr<Task> task)
+	{
+		// Hand the task to the finishing worker's own deque so it gets picked up immediately, without a round-trip
+		// through the shared queue and dispatcher wake-up.
+		if(mMode == TaskSchedulerMode::WorkStealing && tWorkerIdx != (UINT32)-1)
+		{
+			Task* rawTask = task.get();
+			rawTask->mSelfRef = std::move(task);
+
+			mWorkers[tWorkerIdx]->queue.push(rawTask);
+			return;
+		}
+
+		Lock lock(mReadyMutex);
+
+		task->mTaskId = mNextTaskId++;
+
+		mCheckTasks = true;
+		mTaskQueue.insert(std::move(task));
+
+		if(mMode == TaskSchedulerMode::WorkStealing)
+			mTaskReadyCond.notify_all();
+		else
+			mTaskReadyCond.notify_one();
+	}
+
 	void TaskScheduler::waitUntilComplete(const Task* task)
 	{
 		if(task->isCanceled())
 			return;
 
+		// A work-stealing worker helps execute other tasks instead of blocking, both to keep the core busy and to avoid
+		// deadlocks when the waited-on task sits in this worker's own deque.
+		if(mMode == TaskSchedulerMode::WorkStealing && tWorkerIdx != (UINT32)-1)
+		{
+			while(!task->isComplete() && !task->isCanceled())
+			{
+				Task* otherTask = findWorkerTask(tWorkerIdx);
+				if(otherTask != nullptr)
+					runWorkerTask(tWorkerIdx, otherTask);
+				else
+					std::this_thread::yield();
+			}
+
+			return;
+		}
+
 		{
 			Lock lock(mCompleteMutex);
 
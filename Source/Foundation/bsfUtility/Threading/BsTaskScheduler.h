@@ -5,6 +5,7 @@
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Utility/BsModule.h"
 #include "Threading/BsThreadPool.h"
+#include "Threading/BsWorkStealingQueue.h"
 
 namespace bs
 {
@@ -23,6 +24,23 @@ namespace bs
 		VeryHigh = 102
 	};
 
+	/** Determines how TaskScheduler distributes queued tasks to worker threads. */
+	enum class TaskSchedulerMode
+	{
+		/**
+		 * All tasks go through a single priority queue drained by a dispatcher thread. Respects priorities exactly and
+		 * works well for a moderate number of coarse tasks, but the shared lock becomes a bottleneck with many small
+		 * tasks submitted from multiple threads.
+		 */
+		Centralized,
+		/**
+		 * Each worker owns a lock-free deque it pops in LIFO order, and steals from other workers in FIFO order when its
+		 * own deque runs dry. Scales to thousands of fine-grained tasks per frame, at the cost of priorities only being
+		 * respected for tasks queued from non-worker threads.
+		 */
+		WorkStealing
+	};
+
 	/**
 	 * Represents a single task that may be queued in the TaskScheduler.
 	 *
@@ -35,6 +53,8 @@ namespace bs
 	public:
 		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
 			TaskPriority priority, SPtr<Task> dependency);
+		Task(const PrivatelyConstruct& dummy, const String& name, std::function<void()> taskWorker,
+			TaskPriority priority, const Vector<SPtr<Task>>& dependencies);
 
 		/**
 		 * Creates a new task. Task should be provided to TaskScheduler in order for it to start.
@@ -45,9 +65,32 @@ namespace bs
 		 * @param[in]	dependency	(optional) Task dependency if one exists. If provided the task will
 		 * 							not be executed until its dependency is complete.
 		 */
-		static SPtr<Task> create(const String& name, std::function<void()> taskWorker, 
+		static SPtr<Task> create(const String& name, std::function<void()> taskWorker,
 			TaskPriority priority = TaskPriority::Normal, SPtr<Task> dependency = nullptr);
 
+		/**
+		 * Hints that the task should preferably execute on a worker pinned to the provided NUMA node, keeping it close
+		 * to memory allocated by other tasks on the same node (see NumaTopology). Invalid nodes are wrapped to a valid
+		 * one. This is a hint, not a guarantee - the hint is only honored in work-stealing mode, and tasks released
+		 * by a completed dependency stay on the node of the worker that released them. Must be set before the task is
+		 * queued.
+		 */
+		void setNumaNode(UINT32 node) { mNumaNode = node; }
+
+		/**
+		 * Creates a new task that depends on multiple other tasks. The task will not start executing until all of its
+		 * dependencies have completed. Dependencies are tracked through an atomic countdown, and the task is handed to
+		 * the worker that finishes its last dependency, allowing a frame to be expressed as a task graph (DAG) without
+		 * artificial join tasks or the wake-up latency of waiting on each branch separately.
+		 *
+		 * @param[in]	name			Name you can use to more easily identify the task.
+		 * @param[in]	taskWorker		Worker method that does all of the work in the task.
+		 * @param[in]	dependencies	Tasks that must complete before this task may begin executing.
+		 * @param[in]	priority  		(optional) Higher priority means the tasks will be executed sooner.
+		 */
+		static SPtr<Task> create(const String& name, std::function<void()> taskWorker,
+			const Vector<SPtr<Task>>& dependencies, TaskPriority priority = TaskPriority::Normal);
+
 		/** Returns true if the task has completed. */
 		bool isComplete() const;
 
@@ -69,10 +112,16 @@ namespace bs
 
 		String mName;
 		TaskPriority mPriority;
+		UINT32 mNumaNode = (UINT32)-1; /**< Preferred NUMA node, or (UINT32)-1 when the task may run anywhere. */
 		UINT32 mTaskId = 0;
 		std::function<void()> mTaskWorker;
 		SPtr<Task> mTaskDependency;
+		Vector<SPtr<Task>> mDependencies; /**< Tasks that must complete before this one starts, when more than one. */
+		Vector<SPtr<Task>> mDependants; /**< Tasks waiting on this one to complete, released when it does. */
+		std::atomic<UINT32> mUnfinishedDeps{0}; /**< Countdown of incomplete entries in mDependencies. */
+		SpinLock mDependantsLock; /**< Synchronizes dependant registration against task completion. */
 		std::atomic<UINT32> mState{0}; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
+		SPtr<Task> mSelfRef; /**< Keeps the task alive while queued in a work-stealing deque, which stores raw pointers. */
 
 		TaskScheduler* mParent = nullptr;
 	};
@@ -84,9 +133,9 @@ namespace bs
 	 * @note
 	 * Thread safe.
 	 * @note
-	 * This type of task scheduler uses a global queue and is best used for coarse granularity of tasks. (Number of tasks
-	 * in the order of hundreds. Higher number of tasks might require different queuing and locking mechanism, potentially
-	 * at the cost of flexibility.)
+	 * In TaskSchedulerMode::Centralized mode a global queue is used and the scheduler is best used for coarse granularity
+	 * of tasks (number of tasks in the order of hundreds). Use TaskSchedulerMode::WorkStealing when many fine-grained
+	 * tasks are submitted concurrently from multiple threads.
 	 * @note
 	 * By default the task scheduler will create as many threads as there are physical CPU cores. You may add or remove
 	 * threads using addWorker()/removeWorker() methods.
@@ -94,7 +143,7 @@ namespace bs
 	class BS_UTILITY_EXPORT TaskScheduler : public Module<TaskScheduler>
 	{
 	public:
-		TaskScheduler();
+		TaskScheduler(TaskSchedulerMode mode = TaskSchedulerMode::Centralized);
 		~TaskScheduler();
 
 		/** Queues a new task. */
@@ -123,6 +172,31 @@ namespace bs
 		/**	Method used for sorting tasks. */
 		static bool taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs);
 
+		/** Per-worker state used in work-stealing mode. */
+		struct Worker
+		{
+			WorkStealingQueue<Task*> queue;
+			HThread thread;
+			UINT32 numaNode = 0; /**< NUMA node the worker thread is pinned to. */
+		};
+
+		/**	Main loop for a single work-stealing worker thread. */
+		void runWorker(UINT32 workerIdx);
+
+		/**	Executes a single task on a work-stealing worker, handling deferral of tasks with incomplete dependencies. */
+		void runWorkerTask(UINT32 workerIdx, Task* task);
+
+		/**	Attempts to grab a task in work-stealing mode, checking the local deque, shared queue and other workers. */
+		Task* findWorkerTask(UINT32 workerIdx);
+
+		/** Decrements the dependency countdown of all tasks waiting on @p task, scheduling any that become ready. */
+		void releaseDependants(Task* task);
+
+		/** Queues a task whose final dependency just completed, preferring the finishing worker's own deque. */
+		void scheduleDependant(SPtr<Task> task);
+
+		TaskSchedulerMode mMode;
+
 		HThread mTaskSchedulerThread;
 		Set<SPtr<Task>, std::function<bool(const SPtr<Task>&, const SPtr<Task>&)>> mTaskQueue;
 		Vector<SPtr<Task>> mActiveTasks;
@@ -131,6 +205,10 @@ namespace bs
 		bool mShutdown = false;
 		bool mCheckTasks = false;
 
+		Vector<Worker*> mWorkers;
+		UINT32 mNumNumaNodes = 1;
+		std::atomic<UINT32> mNumQueuedTasks{0};
+
 		Mutex mReadyMutex;
 		Mutex mCompleteMutex;
 		Signal mTaskReadyCond;
@@ -14,8 +14,82 @@
 
 #endif // BS_PLATFORM == BS_PLATFORM_WIN32
 
+#if BS_PLATFORM == BS_PLATFORM_LINUX
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // BS_PLATFORM == BS_PLATFORM_LINUX
+
 namespace bs
 {
+	/** Applies the scheduling band to the calling thread by adjusting its OS priority. */
+	static void applyThreadBand(ThreadBand band)
+	{
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		int priority = THREAD_PRIORITY_NORMAL;
+		switch(band)
+		{
+		case ThreadBand::TimeCritical:
+			priority = THREAD_PRIORITY_HIGHEST;
+			break;
+		case ThreadBand::Background:
+			priority = THREAD_PRIORITY_LOWEST;
+			break;
+		default:
+			break;
+		}
+
+		SetThreadPriority(GetCurrentThread(), priority);
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+		switch(band)
+		{
+		case ThreadBand::TimeCritical:
+		{
+			// Requires elevated privileges, in which case we silently remain at the default priority
+			sched_param param;
+			param.sched_priority = sched_get_priority_min(SCHED_RR);
+			pthread_setschedparam(pthread_self(), SCHED_RR, &param);
+			break;
+		}
+		case ThreadBand::Background:
+			setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), 10);
+			break;
+		default:
+			setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), 0);
+			break;
+		}
+#else
+		// Not supported on this platform
+		(void)band;
+#endif
+	}
+
+	/** Restricts the calling thread to the cores set in the provided bitmask. Does nothing if the mask is zero. */
+	static void applyThreadAffinity(UINT64 affinityMask)
+	{
+		if(affinityMask == 0)
+			return;
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+		SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)affinityMask);
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for(UINT32 i = 0; i < 64; i++)
+		{
+			if((affinityMask & ((UINT64)1 << i)) != 0)
+				CPU_SET(i, &cpuSet);
+		}
+
+		pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#else
+		// Affinity hints are not supported on this platform
+#endif
+	}
+
 	HThread::HThread(ThreadPool* pool, UINT32 threadId)
 		:mThreadId(threadId), mPool(pool)
 	{ }
@@ -90,6 +164,10 @@ namespace bs
 			std::function<void()> worker = nullptr;
 
 			{
+				ThreadBand band = ThreadBand::Normal;
+				UINT64 affinityMask = 0;
+				bool bandDirty = false;
+
 				{
 					Lock lock(mMutex);
 
@@ -97,10 +175,25 @@ namespace bs
 						mReadyCond.wait(lock);
 
 					worker = mWorkerMethod;
+
+					band = mBand;
+					affinityMask = mAffinityMask;
+					bandDirty = mBandDirty;
+					mBandDirty = false;
+				}
+
+				// Priority and affinity can only be applied from the thread itself, so do it before running the worker
+				if(bandDirty)
+				{
+					applyThreadBand(band);
+					applyThreadAffinity(affinityMask);
 				}
 
 				if (worker == nullptr)
 				{
+					// Return this thread's frame allocator blocks to the shared pool before exiting
+					bs_thread_frame_alloc_free();
+
 					onThreadEnded(mName);
 					return;
 				}
@@ -174,6 +267,18 @@ namespace bs
 		mName = name;
 	}
 
+	void PooledThread::setBand(ThreadBand band, UINT64 affinityMask)
+	{
+		Lock lock(mMutex);
+
+		if(mBand == band && mAffinityMask == affinityMask)
+			return;
+
+		mBand = band;
+		mAffinityMask = affinityMask;
+		mBandDirty = true;
+	}
+
 	UINT32 PooledThread::getId() const
 	{
 		Lock lock(mMutex);
@@ -192,14 +297,46 @@ namespace bs
 		stopAll();
 	}
 
-	HThread ThreadPool::run(const String& name, std::function<void()> workerMethod)
+	HThread ThreadPool::run(const String& name, std::function<void()> workerMethod, ThreadBand band,
+		UINT64 affinityMask)
 	{
 		PooledThread* thread = getThread(name);
+		thread->setBand(band, affinityMask != 0 ? affinityMask : getWorkerAffinityMask());
 		thread->start(workerMethod, mUniqueId++);
 
 		return HThread(this, thread->getId());
 	}
 
+	void ThreadPool::setReservedCores(UINT64 coreMask)
+	{
+		Lock lock(mMutex);
+
+		mReservedCoreMask = coreMask;
+	}
+
+	UINT64 ThreadPool::getWorkerAffinityMask() const
+	{
+		UINT64 reservedMask;
+		{
+			Lock lock(mMutex);
+			reservedMask = mReservedCoreMask;
+		}
+
+		if(reservedMask == 0)
+			return 0;
+
+		UINT32 numCores = BS_THREAD_HARDWARE_CONCURRENCY;
+		UINT64 allCoresMask = numCores >= 64 ? (UINT64)-1 : (((UINT64)1 << numCores) - 1);
+
+		UINT64 workerMask = allCoresMask & ~reservedMask;
+
+		// Never restrict workers to an empty core set
+		if(workerMask == 0)
+			return 0;
+
+		return workerMask;
+	}
+
 	void ThreadPool::stopAll()
 	{
 		Lock lock(mMutex);
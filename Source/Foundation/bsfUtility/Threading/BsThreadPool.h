@@ -13,6 +13,27 @@ namespace bs
 
 	class ThreadPool;
 
+	/**
+	 * Scheduling class of a thread managed by ThreadPool, determining the OS priority its worker method runs at and
+	 * whether it respects the pool's reserved cores.
+	 */
+	enum class ThreadBand
+	{
+		/**
+		 * Elevated OS priority. Use for workers on the critical path of a frame, so they don't get preempted by
+		 * lower priority work. On platforms where raising thread priority requires elevated privileges this may
+		 * silently behave like Normal.
+		 */
+		TimeCritical,
+		/** Default OS priority. */
+		Normal,
+		/**
+		 * Lowered OS priority. Use for long-running work that shouldn't interfere with frame processing (e.g. resource
+		 * import, background streaming).
+		 */
+		Background
+	};
+
 	/** Handle to a thread managed by ThreadPool. */
 	class BS_UTILITY_EXPORT HThread
 	{
@@ -74,6 +95,16 @@ namespace bs
 		/**	Sets a name of the thread. */
 		void setName(const String& name);
 
+		/**
+		 * Sets the scheduling band and core-affinity of the thread. Applied by the thread itself just before it begins
+		 * executing its next worker method.
+		 *
+		 * @param[in]	band			Scheduling class determining the OS priority of the thread.
+		 * @param[in]	affinityMask	Bitmask of logical cores the thread is allowed to run on, where bit N corresponds
+		 *								to core N. Zero means no restriction.
+		 */
+		void setBand(ThreadBand band, UINT64 affinityMask);
+
 		/**	Gets unique ID of the currently executing thread. */
 		UINT32 getId() const;
 
@@ -102,6 +133,10 @@ namespace bs
 
 		time_t mIdleTime = 0;
 
+		ThreadBand mBand = ThreadBand::Normal;
+		UINT64 mAffinityMask = 0;
+		bool mBandDirty = false;
+
 		Thread* mThread;
 		mutable Mutex mMutex;
 		Signal mStartedCond;
@@ -164,9 +199,26 @@ namespace bs
 		 *
 		 * @param[in]	name			A name you may use for more easily identifying the thread.
 		 * @param[in]	workerMethod	The worker method to be called by the thread.
+		 * @param[in]	band			(optional) Scheduling class the worker method runs at, determining the OS
+		 *								priority of the thread and restricting it to non-reserved cores (see
+		 *								setReservedCores()).
+		 * @param[in]	affinityMask	(optional) When non-zero, restricts the thread to the provided set of logical
+		 *								cores (bit N corresponds to core N), overriding the default non-reserved core
+		 *								mask. Used e.g. for pinning workers to a NUMA node (see NumaTopology).
 		 * @return						A thread handle you may use for monitoring the thread execution.
 		 */
-		HThread run(const String& name, std::function<void()> workerMethod);
+		HThread run(const String& name, std::function<void()> workerMethod, ThreadBand band = ThreadBand::Normal,
+			UINT64 affinityMask = 0);
+
+		/**
+		 * Reserves a set of logical cores for threads not managed by the pool. Pooled threads are restricted to the
+		 * remaining cores, so latency sensitive threads (e.g. the core or sim thread) pinned to the reserved cores never
+		 * share a core (or its SMT sibling, if included in the mask) with background import or streaming workers.
+		 *
+		 * @param[in]	coreMask	Bitmask of logical cores to exclude from pooled threads, where bit N corresponds to
+		 *							core N. Zero (the default) removes any restriction.
+		 */
+		void setReservedCores(UINT64 coreMask);
 
 		/**
 		 * Stops all threads and destroys them. Caller must ensure each threads worker method returns otherwise this will 
@@ -206,10 +258,14 @@ namespace bs
 		 */
 		PooledThread* getThread(const String& name);
 
+		/** Returns the affinity mask pooled threads should use, based on the reserved cores. Zero if unrestricted. */
+		UINT64 getWorkerAffinityMask() const;
+
 		UINT32 mDefaultCapacity;
 		UINT32 mMaxCapacity;
 		UINT32 mIdleTimeout;
 		UINT32 mAge = 0;
+		UINT64 mReservedCoreMask = 0;
 
 		std::atomic_uint mUniqueId;
 		mutable Mutex mMutex;
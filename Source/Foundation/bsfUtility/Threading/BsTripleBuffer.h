@@ -0,0 +1,81 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Lock-free single-producer single-consumer exchange of the most recent value of some state. Unlike a queue,
+	 * intermediate values are discarded - the consumer always retrieves the latest published snapshot. Uses three
+	 * internal buffers so neither thread ever waits on the other: the producer always has a free buffer to write into,
+	 * and the consumer always has a stable buffer to read from. Useful for periodically sampled state shared across
+	 * threads (e.g. OS cursor state polled by the message pump).
+	 *
+	 * @note
+	 * write() may only ever be called from one thread, and read() from one (possibly different) thread. Using either
+	 * from multiple threads concurrently is not safe.
+	 * @note
+	 * Entries must be trivially copyable as they are copied in and out of the backing buffers without synchronization
+	 * beyond the buffer exchange.
+	 */
+	template <class T>
+	class TripleBuffer
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "TripleBuffer entries must be trivially copyable.");
+
+	public:
+		TripleBuffer() = default;
+
+		TripleBuffer(const TripleBuffer&) = delete;
+		TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+		/**
+		 * Publishes a new snapshot, replacing any previously published snapshot the consumer has not yet retrieved.
+		 * Must always be called from the same (producer) thread.
+		 */
+		void write(const T& value)
+		{
+			mBuffers[mWriteIdx] = value;
+
+			// Exchange the write buffer with the middle buffer and mark the middle buffer as holding fresh data
+			UINT32 previous = mMiddle.exchange(mWriteIdx | FRESH_BIT, std::memory_order_release);
+			mWriteIdx = previous & INDEX_MASK;
+		}
+
+		/**
+		 * Retrieves the most recently published snapshot. Returns false if no new snapshot was published since the last
+		 * call, in which case @p value is left unmodified. Must always be called from the same (consumer) thread.
+		 */
+		bool read(T& value)
+		{
+			if ((mMiddle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+				return false;
+
+			// Exchange the read buffer with the middle buffer, clearing the fresh flag
+			UINT32 previous = mMiddle.exchange(mReadIdx, std::memory_order_acquire);
+			mReadIdx = previous & INDEX_MASK;
+
+			value = mBuffers[mReadIdx];
+			return true;
+		}
+
+	private:
+		static constexpr UINT32 FRESH_BIT = 0x4;
+		static constexpr UINT32 INDEX_MASK = 0x3;
+
+		T mBuffers[3] = { };
+		UINT32 mWriteIdx = 0;
+		UINT32 mReadIdx = 1;
+
+		std::atomic<UINT32> mMiddle{2};
+	};
+
+	/** @} */
+}
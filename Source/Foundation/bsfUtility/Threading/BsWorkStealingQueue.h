@@ -0,0 +1,167 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Lock-free work-stealing deque based on the Chase-Lev algorithm. The owning thread pushes and pops entries from the
+	 * bottom in LIFO order, while any other thread may concurrently steal entries from the top in FIFO order.
+	 *
+	 * @note
+	 * push() and pop() may only be called from the owning thread. steal() may be called from any thread.
+	 * @note
+	 * Entries must be trivially copyable (e.g. raw pointers) as they are stored in atomic slots.
+	 */
+	template <class T>
+	class WorkStealingQueue
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "WorkStealingQueue entries must be trivially copyable.");
+
+		/** Circular buffer holding the queue entries, grown by doubling when full. */
+		struct CircularArray
+		{
+			CircularArray(UINT64 capacity)
+				:capacity(capacity), mask(capacity - 1)
+			{
+				entries = bs_newN<std::atomic<T>>((UINT32)capacity);
+			}
+
+			~CircularArray()
+			{
+				bs_deleteN(entries, (UINT32)capacity);
+			}
+
+			T get(UINT64 idx) const { return entries[idx & mask].load(std::memory_order_relaxed); }
+			void set(UINT64 idx, T value) { entries[idx & mask].store(value, std::memory_order_relaxed); }
+
+			UINT64 capacity;
+			UINT64 mask;
+			std::atomic<T>* entries;
+		};
+
+	public:
+		WorkStealingQueue(UINT64 initialCapacity = 256)
+		{
+			assert((initialCapacity & (initialCapacity - 1)) == 0 && "Capacity must be a power of two.");
+
+			mArray.store(bs_new<CircularArray>(initialCapacity), std::memory_order_relaxed);
+		}
+
+		~WorkStealingQueue()
+		{
+			bs_delete(mArray.load(std::memory_order_relaxed));
+
+			for (auto entry : mRetiredArrays)
+				bs_delete(entry);
+		}
+
+		/** Pushes a new entry to the bottom of the queue. Must be called from the owning thread. */
+		void push(T value)
+		{
+			UINT64 bottom = mBottom.load(std::memory_order_relaxed);
+			UINT64 top = mTop.load(std::memory_order_acquire);
+			CircularArray* array = mArray.load(std::memory_order_relaxed);
+
+			if ((bottom - top) >= array->capacity)
+				array = grow(array, bottom, top);
+
+			array->set(bottom, value);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * Pops the most recently pushed entry from the bottom of the queue. Must be called from the owning thread. Returns
+		 * false if the queue is empty.
+		 */
+		bool pop(T& value)
+		{
+			UINT64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			CircularArray* array = mArray.load(std::memory_order_relaxed);
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			UINT64 top = mTop.load(std::memory_order_relaxed);
+
+			// Compare as a signed difference, as on an empty queue the decrement above wraps bottom below top
+			INT64 numEntries = (INT64)(bottom - top);
+			if (numEntries < 0)
+			{
+				// Queue already empty, undo the decrement
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			value = array->get(bottom);
+			if (numEntries > 0)
+				return true;
+
+			// Popping the last entry, race against concurrent steals for it
+			bool won = mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return won;
+		}
+
+		/**
+		 * Steals the oldest entry from the top of the queue. Safe to call from any thread. Returns false if the queue is
+		 * empty or the steal lost a race with another thread.
+		 */
+		bool steal(T& value)
+		{
+			UINT64 top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			UINT64 bottom = mBottom.load(std::memory_order_acquire);
+
+			// Signed comparison, as the owning thread's pop() may transiently wrap bottom below top on an empty queue
+			if ((INT64)(bottom - top) <= 0)
+				return false;
+
+			CircularArray* array = mArray.load(std::memory_order_consume);
+			value = array->get(top);
+
+			return mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+
+		/** Returns the approximate number of entries in the queue. Only a hint as other threads may modify it. */
+		UINT64 size() const
+		{
+			UINT64 bottom = mBottom.load(std::memory_order_relaxed);
+			UINT64 top = mTop.load(std::memory_order_relaxed);
+
+			INT64 numEntries = (INT64)(bottom - top);
+			return numEntries > 0 ? (UINT64)numEntries : 0;
+		}
+
+	private:
+		/** Doubles the capacity of the backing array, copying over any live entries. */
+		CircularArray* grow(CircularArray* oldArray, UINT64 bottom, UINT64 top)
+		{
+			CircularArray* newArray = bs_new<CircularArray>(oldArray->capacity * 2);
+			for (UINT64 i = top; i < bottom; i++)
+				newArray->set(i, oldArray->get(i));
+
+			mArray.store(newArray, std::memory_order_release);
+
+			// Concurrent stealers may still be reading the old array, retire it until destruction instead of freeing
+			mRetiredArrays.push_back(oldArray);
+
+			return newArray;
+		}
+
+		std::atomic<UINT64> mTop{0};
+		std::atomic<UINT64> mBottom{0};
+		std::atomic<CircularArray*> mArray{nullptr};
+		Vector<CircularArray*> mRetiredArrays;
+	};
+
+	/** @} */
+}
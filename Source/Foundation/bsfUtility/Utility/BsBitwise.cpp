@@ -0,0 +1,218 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsBitwise.h"
+#include "Math/BsSIMD.h"
+
+namespace bs
+{
+	void Bitwise::floatToHalf(const float* input, UINT16* output, UINT32 count)
+	{
+		const simd::uint32<8> signMask = simd::make_uint(0x8000);
+		const simd::uint32<8> absMask = simd::make_uint(0x7fffffff);
+		const simd::uint32<8> mantissaMask = simd::make_uint(0x007fffff);
+		const simd::uint32<8> exponentMask = simd::make_uint(0xff);
+		const simd::int32<8> exponentBias = simd::make_int(127 - 15);
+		const simd::uint32<8> zero = simd::make_uint(0);
+		const simd::int32<8> one = simd::make_int(1);
+		const simd::int32<8> maxExponent = simd::make_int(30);
+
+		UINT32 numBlocks = count / 8;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			simd::uint32<8> v = simd::load_u(input);
+
+			simd::uint32<8> s = simd::bit_and(simd::shift_r<16>(v), signMask);
+			simd::int32<8> e = simd::sub(
+				simd::bit_cast<simd::int32<8>>(simd::bit_and(simd::shift_r<23>(v), exponentMask)), exponentBias);
+			simd::uint32<8> m = simd::bit_and(v, mantissaMask);
+
+			// Result for values in the normal range, where the rebased exponent falls in [1, 30]
+			simd::uint32<8> h = simd::bit_or(simd::bit_or(s,
+				simd::shift_l<10>(simd::bit_cast<simd::uint32<8>>(e))), simd::shift_r<13>(m));
+
+			// Zero maps to zero, with the sign dropped same as in the scalar version
+			simd::mask_int32<8> isZero = simd::cmp_eq(simd::bit_and(v, absMask), zero);
+			h = simd::blend(zero, h, isZero);
+
+			simd::uint16<8> packed = simd::to_uint16(h);
+			simd::store_u(output, packed);
+
+			// Denormals, infinities, NaNs and exponents outside the normal range are rare in practice and take the
+			// scalar path
+			simd::mask_int32<8> isSpecial = simd::bit_or(
+				simd::bit_and(simd::cmp_lt(e, one), simd::bit_not(isZero)), simd::cmp_gt(e, maxExponent));
+
+			simd::uint32<8> specialBits = simd::uint32<8>(isSpecial);
+			if (simd::test_bits_any(specialBits))
+			{
+				SIMDPP_ALIGN(32) UINT32 specialLanes[8];
+				simd::store(specialLanes, specialBits);
+
+				for (UINT32 j = 0; j < 8; j++)
+				{
+					if (specialLanes[j] != 0)
+						output[j] = floatToHalf(input[j]);
+				}
+			}
+
+			input += 8;
+			output += 8;
+		}
+
+		for (UINT32 i = numBlocks * 8; i < count; i++)
+			*output++ = floatToHalf(*input++);
+	}
+
+	void Bitwise::halfToFloat(const UINT16* input, float* output, UINT32 count)
+	{
+		const simd::uint32<8> exponentMask = simd::make_uint(0x1f);
+		const simd::uint32<8> mantissaMask = simd::make_uint(0x3ff);
+		const simd::uint32<8> absMask = simd::make_uint(0x7fff);
+		const simd::uint32<8> exponentBias = simd::make_uint(127 - 15);
+		const simd::uint32<8> zero = simd::make_uint(0);
+		const simd::uint32<8> maxExponent = simd::make_uint(31);
+
+		UINT32 numBlocks = count / 8;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			simd::uint16<8> raw = simd::load_u(input);
+			simd::uint32<8> y = simd::to_uint32(raw);
+
+			simd::uint32<8> s = simd::shift_l<31>(simd::shift_r<15>(y));
+			simd::uint32<8> e = simd::bit_and(simd::shift_r<10>(y), exponentMask);
+			simd::uint32<8> m = simd::bit_and(y, mantissaMask);
+
+			// Result for values in the normal range, where the exponent is in [1, 30]
+			simd::uint32<8> f = simd::bit_or(simd::bit_or(s,
+				simd::shift_l<23>(simd::add(e, exponentBias))), simd::shift_l<13>(m));
+
+			// Positive and negative zero keep just their sign
+			simd::mask_int32<8> isZero = simd::cmp_eq(simd::bit_and(y, absMask), zero);
+			f = simd::blend(s, f, isZero);
+
+			simd::store_u(output, f);
+
+			// Denormals, infinities and NaNs are rare in practice and take the scalar path
+			simd::mask_int32<8> isSpecial = simd::bit_or(
+				simd::bit_and(simd::cmp_eq(e, zero), simd::bit_not(isZero)), simd::cmp_eq(e, maxExponent));
+
+			simd::uint32<8> specialBits = simd::uint32<8>(isSpecial);
+			if (simd::test_bits_any(specialBits))
+			{
+				SIMDPP_ALIGN(32) UINT32 specialLanes[8];
+				simd::store(specialLanes, specialBits);
+
+				for (UINT32 j = 0; j < 8; j++)
+				{
+					if (specialLanes[j] != 0)
+						output[j] = halfToFloat(input[j]);
+				}
+			}
+
+			input += 8;
+			output += 8;
+		}
+
+		for (UINT32 i = numBlocks * 8; i < count; i++)
+			*output++ = halfToFloat(*input++);
+	}
+
+	void Bitwise::unormToUint(const float* input, UINT8* output, UINT32 count)
+	{
+		const simd::float32<16> scale = simd::make_float(256.0f);
+		const simd::float32<16> half = simd::make_float(0.5f);
+		const simd::float32<16> one = simd::make_float(1.0f);
+		const simd::int32<16> minValue = simd::make_int(0);
+		const simd::int32<16> maxValue = simd::make_int(255);
+
+		UINT32 numBlocks = count / 16;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			// Clamp the upper range before scaling so oversized values can't overflow the float->int conversion
+			simd::float32<16> v = simd::min((simd::float32<16>)simd::load_u(input), one);
+
+			// Matches the rounding of the scalar version (floor(x * 256 + 0.5)), clamped to the valid output range
+			simd::int32<16> r = simd::to_int32(simd::floor(simd::add(simd::mul(v, scale), half)));
+			r = simd::max(simd::min(r, maxValue), minValue);
+
+			simd::uint8<16> packed = simd::to_uint8(simd::bit_cast<simd::uint32<16>>(r));
+			simd::store_u(output, packed);
+
+			input += 16;
+			output += 16;
+		}
+
+		for (UINT32 i = numBlocks * 16; i < count; i++)
+			*output++ = (UINT8)std::min(unormToUint<8>(*input++), 255u);
+	}
+
+	void Bitwise::snormToUint(const float* input, UINT8* output, UINT32 count)
+	{
+		const simd::float32<16> scale = simd::make_float(128.0f);
+		const simd::float32<16> bias = simd::make_float(128.5f);
+		const simd::float32<16> one = simd::make_float(1.0f);
+		const simd::int32<16> minValue = simd::make_int(0);
+		const simd::int32<16> maxValue = simd::make_int(255);
+
+		UINT32 numBlocks = count / 16;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			// Clamp the upper range before scaling so oversized values can't overflow the float->int conversion
+			simd::float32<16> v = simd::min((simd::float32<16>)simd::load_u(input), one);
+
+			// Equivalent of the unorm conversion applied to (x + 1) * 0.5
+			simd::int32<16> r = simd::to_int32(simd::floor(simd::add(simd::mul(v, scale), bias)));
+			r = simd::max(simd::min(r, maxValue), minValue);
+
+			simd::uint8<16> packed = simd::to_uint8(simd::bit_cast<simd::uint32<16>>(r));
+			simd::store_u(output, packed);
+
+			input += 16;
+			output += 16;
+		}
+
+		for (UINT32 i = numBlocks * 16; i < count; i++)
+			*output++ = (UINT8)std::min(snormToUint<8>(*input++), 255u);
+	}
+
+	void Bitwise::uintToUnorm(const UINT8* input, float* output, UINT32 count)
+	{
+		const simd::float32<16> invMax = simd::make_float(1.0f / 255.0f);
+
+		UINT32 numBlocks = count / 16;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			simd::uint8<16> raw = simd::load_u(input);
+			simd::float32<16> f = simd::to_float32(simd::bit_cast<simd::int32<16>>(simd::to_uint32(raw)));
+
+			simd::store_u(output, simd::mul(f, invMax));
+
+			input += 16;
+			output += 16;
+		}
+
+		for (UINT32 i = numBlocks * 16; i < count; i++)
+			*output++ = uintToUnorm<8>(*input++);
+	}
+
+	void Bitwise::uintToSnorm(const UINT8* input, float* output, UINT32 count)
+	{
+		const simd::float32<16> scale = simd::make_float(2.0f / 255.0f);
+		const simd::float32<16> bias = simd::make_float(-1.0f);
+
+		UINT32 numBlocks = count / 16;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			simd::uint8<16> raw = simd::load_u(input);
+			simd::float32<16> f = simd::to_float32(simd::bit_cast<simd::int32<16>>(simd::to_uint32(raw)));
+
+			simd::store_u(output, simd::add(simd::mul(f, scale), bias));
+
+			input += 16;
+			output += 16;
+		}
+
+		for (UINT32 i = numBlocks * 16; i < count; i++)
+			*output++ = uintToSnorm<8>(*input++);
+	}
+}
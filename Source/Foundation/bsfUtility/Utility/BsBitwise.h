@@ -60,7 +60,7 @@ namespace bs
 	};
 
 	/** Class for manipulating bit patterns. */
-	class Bitwise
+	class BS_UTILITY_EXPORT Bitwise
 	{
 	public:
 		/** Returns the most significant bit set in a value. */
@@ -237,6 +237,25 @@ namespace bs
 			return uintToUnorm<bits>(value) * 2.0f - 1.0f;
 		}
 
+		/**
+		 * Converts an array of floating point values in range [0, 1] to 8-bit unsigned integers, using SIMD. Equivalent
+		 * to calling unormToUint<8>() on each value, except results are always clamped to the valid 8-bit range. Input
+		 * and output may not overlap.
+		 */
+		static void unormToUint(const float* input, UINT8* output, UINT32 count);
+
+		/** @copydoc unormToUint(const float*, UINT8*, UINT32), except input values are expected in range [-1, 1]. */
+		static void snormToUint(const float* input, UINT8* output, UINT32 count);
+
+		/**
+		 * Converts an array of 8-bit unsigned integers to floating point values in range [0, 1], using SIMD. Equivalent
+		 * to calling uintToUnorm<8>() on each value. Input and output may not overlap.
+		 */
+		static void uintToUnorm(const UINT8* input, float* output, UINT32 count);
+
+		/** @copydoc uintToUnorm(const UINT8*, float*, UINT32), except outputs are in range [-1, 1]. */
+		static void uintToSnorm(const UINT8* input, float* output, UINT32 count);
+
 		/** 
 		 * Interpolates between two values using the @p t parameter. All parameters must be in [0, 255] range. When @p t
 		 * is zero, @p from value will be returned, and when it is 255 @p to value will be returned, and interpolation
@@ -442,10 +461,22 @@ namespace bs
 		
 			e = e + (127 - 15);
 			m = m << 13;
-		
+
 			return (s << 31) | (e << 23) | m;
 		}
 
+		/**
+		 * Converts an array of float32 values to float16, using SIMD for runs of values in the normal range. Equivalent
+		 * to calling floatToHalf() on each value. Input and output may not overlap.
+		 */
+		static void floatToHalf(const float* input, UINT16* output, UINT32 count);
+
+		/**
+		 * Converts an array of float16 values to float32, using SIMD for runs of values in the normal range. Equivalent
+		 * to calling halfToFloat() on each value. Input and output may not overlap.
+		 */
+		static void halfToFloat(const UINT16* input, float* output, UINT32 count);
+
 		/** Converts a 32-bit float to a 10-bit float according to OpenGL packed_float extension. */
 		static UINT32 floatToFloat10(float v)
 		{
@@ -2,14 +2,20 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Utility/BsCompression.h"
 #include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
 
 // Third party
 #include "snappy.h"
 #include "snappy-sinksource.h"
 #include "Debug/BsDebug.h"
 
+#include <atomic>
+
 namespace bs
 {
+	// Identifies a stream written by Compression::compressBlocked()
+	static constexpr UINT32 BLOCKED_COMPRESSION_MAGIC = 0x42435342; // "BSCB"
+
 	/** Source accepting a data stream. Used for Snappy compression library. */
 	class DataStreamSource : public snappy::Source
 	{
@@ -191,4 +197,168 @@ namespace bs
 
 		return dst.GetOutput();
 	}
+
+	SPtr<MemoryDataStream> Compression::compressBlocked(SPtr<DataStream>& input, UINT32 blockSize)
+	{
+		assert(blockSize > 0);
+
+		// Blocks are compressed directly from memory, so pull file streams into a memory stream first
+		SPtr<MemoryDataStream> memInput;
+		if (input->isFile())
+			memInput = bs_shared_ptr_new<MemoryDataStream>(input);
+		else
+			memInput = std::static_pointer_cast<MemoryDataStream>(input);
+
+		UINT64 uncompressedSize = (UINT64)(memInput->size() - memInput->tell());
+		UINT32 numBlocks = (UINT32)((uncompressedSize + blockSize - 1) / blockSize);
+
+		struct CompressedBlock
+		{
+			char* data;
+			UINT32 compressedSize;
+			UINT32 uncompressedSize;
+		};
+
+		Vector<CompressedBlock> blocks;
+		blocks.reserve(numBlocks);
+
+		const char* srcPtr = (const char*)memInput->getCurrentPtr();
+		UINT64 remaining = uncompressedSize;
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			CompressedBlock block;
+			block.uncompressedSize = (UINT32)std::min(remaining, (UINT64)blockSize);
+			block.data = (char*)bs_alloc((UINT32)snappy::MaxCompressedLength(block.uncompressedSize));
+
+			size_t compressedSize = 0;
+			snappy::RawCompress(srcPtr, block.uncompressedSize, block.data, &compressedSize);
+			block.compressedSize = (UINT32)compressedSize;
+
+			blocks.push_back(block);
+
+			srcPtr += block.uncompressedSize;
+			remaining -= block.uncompressedSize;
+		}
+
+		UINT64 totalSize = sizeof(UINT32) * 2 + sizeof(UINT64);
+		for (auto& block : blocks)
+			totalSize += sizeof(UINT32) * 2 + block.compressedSize;
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)totalSize);
+		output->write(&BLOCKED_COMPRESSION_MAGIC, sizeof(BLOCKED_COMPRESSION_MAGIC));
+		output->write(&numBlocks, sizeof(numBlocks));
+		output->write(&uncompressedSize, sizeof(uncompressedSize));
+
+		for (auto& block : blocks)
+		{
+			output->write(&block.uncompressedSize, sizeof(block.uncompressedSize));
+			output->write(&block.compressedSize, sizeof(block.compressedSize));
+			output->write(block.data, block.compressedSize);
+
+			bs_free(block.data);
+		}
+
+		output->seek(0);
+		return output;
+	}
+
+	SPtr<MemoryDataStream> Compression::decompressBlocked(SPtr<DataStream>& input, bool parallel)
+	{
+		UINT32 magic = 0;
+		UINT32 numBlocks = 0;
+		UINT64 uncompressedSize = 0;
+
+		input->read(&magic, sizeof(magic));
+		if (magic != BLOCKED_COMPRESSION_MAGIC)
+		{
+			LOGERR("Decompression failed, data is not in the blocked compression format.");
+			return nullptr;
+		}
+
+		input->read(&numBlocks, sizeof(numBlocks));
+		input->read(&uncompressedSize, sizeof(uncompressedSize));
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)uncompressedSize);
+
+		bool isMemory = !input->isFile();
+		SPtr<MemoryDataStream> memInput;
+		if (isMemory)
+			memInput = std::static_pointer_cast<MemoryDataStream>(input);
+
+		std::atomic<bool> failed(false);
+		Vector<SPtr<Task>> tasks;
+		Vector<char*> tempBuffers;
+
+		char* dstPtr = (char*)output->getPtr();
+		UINT64 dstOffset = 0;
+
+		for (UINT32 i = 0; i < numBlocks; i++)
+		{
+			UINT32 blockUncompressed = 0;
+			UINT32 blockCompressed = 0;
+			input->read(&blockUncompressed, sizeof(blockUncompressed));
+			input->read(&blockCompressed, sizeof(blockCompressed));
+
+			if (dstOffset + blockUncompressed > uncompressedSize)
+			{
+				failed = true;
+				break;
+			}
+
+			// Memory streams can provide the compressed data in-place, file streams need a temporary buffer per block
+			const char* srcPtr;
+			if (isMemory)
+			{
+				srcPtr = (const char*)memInput->getCurrentPtr();
+				input->skip(blockCompressed);
+			}
+			else
+			{
+				char* buffer = (char*)bs_alloc(blockCompressed);
+				input->read(buffer, blockCompressed);
+				tempBuffers.push_back(buffer);
+
+				srcPtr = buffer;
+			}
+
+			char* blockDst = dstPtr + dstOffset;
+			auto worker = [srcPtr, blockCompressed, blockDst, blockUncompressed, &failed]()
+			{
+				size_t actualSize = 0;
+				if (!snappy::GetUncompressedLength(srcPtr, blockCompressed, &actualSize) ||
+					actualSize != blockUncompressed || !snappy::RawUncompress(srcPtr, blockCompressed, blockDst))
+				{
+					failed = true;
+				}
+			};
+
+			// Blocks are independent, so they can decompress on workers while remaining blocks are still being read
+			if (parallel && numBlocks > 1)
+			{
+				SPtr<Task> task = Task::create("DecompressBlock", worker);
+				tasks.push_back(task);
+
+				TaskScheduler::instance().addTask(task);
+			}
+			else
+				worker();
+
+			dstOffset += blockUncompressed;
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		for (auto& buffer : tempBuffers)
+			bs_free(buffer);
+
+		if (failed || dstOffset != uncompressedSize)
+		{
+			LOGERR("Decompression failed, corrupt data.");
+			return nullptr;
+		}
+
+		output->seek(0);
+		return output;
+	}
 }
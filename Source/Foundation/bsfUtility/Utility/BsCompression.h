@@ -19,6 +19,26 @@ namespace bs
 
 		/** Decompresses the data from the provided data stream and outputs the new stream with decompressed data. */
 		static SPtr<MemoryDataStream> decompress(SPtr<DataStream>& input);
+
+		/**
+		 * Compresses the data from the provided stream as a sequence of independently compressed blocks and outputs a
+		 * new stream with the compressed data. Unlike compress() the result can be decompressed block by block, which
+		 * allows decompression to overlap with reads and to run on multiple cores. Use decompressBlocked() to
+		 * decompress.
+		 *
+		 * @param[in]	input		Stream containing the data to compress.
+		 * @param[in]	blockSize	Amount of uncompressed data per block, in bytes. Larger blocks compress better while
+		 *							smaller blocks allow more parallelism.
+		 */
+		static SPtr<MemoryDataStream> compressBlocked(SPtr<DataStream>& input, UINT32 blockSize = 262144);
+
+		/**
+		 * Decompresses data previously compressed with compressBlocked() and outputs the new stream with decompressed
+		 * data. If @p parallel is true the blocks are decompressed concurrently on task scheduler workers while further
+		 * blocks are still being read from the stream, otherwise they are decompressed one by one on the calling
+		 * thread. Returns null if the data is corrupt or not in the blocked format.
+		 */
+		static SPtr<MemoryDataStream> decompressBlocked(SPtr<DataStream>& input, bool parallel = true);
 	};
 
 	/** @} */
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Allocators/BsPoolAlloc.h"
+#include <atomic>
 
 namespace bs
 {
@@ -41,7 +43,7 @@ namespace bs
 	{
 		EventInternalData() = default;
 
-		~EventInternalData()
+		virtual ~EventInternalData()
 		{
 			BaseConnectionData* conn = mConnections;
 			while (conn != nullptr)
@@ -91,7 +93,7 @@ namespace bs
 		 *
 		 * @note	Only call this once.
 		 */
-		void disconnect(BaseConnectionData* conn)
+		virtual void disconnect(BaseConnectionData* conn)
 		{
 			RecursiveLock lock(mMutex);
 
@@ -103,7 +105,7 @@ namespace bs
 		}
 
 		/** Disconnects all connections in the event. */
-		void clear()
+		virtual void clear()
 		{
 			RecursiveLock lock(mMutex);
 
@@ -127,7 +129,7 @@ namespace bs
 		 * Called when the event handle no longer keeps a reference to the connection data. This means we might be able to 
 		 * free (and reuse) its memory if the event is done with it too.
 		 */
-		void freeHandle(BaseConnectionData* conn)
+		virtual void freeHandle(BaseConnectionData* conn)
 		{
 			RecursiveLock lock(mMutex);
 
@@ -397,6 +399,276 @@ namespace bs
 		SPtr<EventInternalData> mInternalData;
 	};
 
+	/**
+	 * Variant of TEvent optimized for events that trigger very often (for example every frame) but are rarely connected
+	 * or disconnected from. Triggering the event takes no locks. Instead the connection list is traversed through atomic
+	 * pointers, while connect/disconnect synchronize through a mutex and only unlink nodes - node memory is reclaimed
+	 * once no triggers are in progress. Connection nodes are allocated from a pool so connecting doesn't hit the
+	 * general-purpose allocator.
+	 *
+	 * @note
+	 * Safe to trigger from multiple threads, and to connect/disconnect (including from within a callback) while a
+	 * trigger is in progress. Unlike TEvent, individual callbacks may execute concurrently if the event is triggered
+	 * from multiple threads at once.
+	 */
+	template <class RetType, class... Args>
+	class TTriggerOptimizedEvent
+	{
+		struct ConnectionData : BaseConnectionData
+		{
+			std::function<RetType(Args...)> func;
+
+			/** Next node in the connection list. Atomic so triggers can traverse the list without locking. */
+			std::atomic<ConnectionData*> nextConn { nullptr };
+
+			/** Set to false when the connection is disconnected. Checked by triggers before invoking the callback. */
+			std::atomic<bool> active { true };
+
+			/** Previous node in the connection list. Only accessed while holding the mutex. */
+			ConnectionData* prevConn = nullptr;
+		};
+
+		/** Internal data shared between the event and its handles. */
+		struct InternalData : EventInternalData
+		{
+			~InternalData() override
+			{
+				// No handles nor triggers can exist at this point (handles keep the internal data alive), so all
+				// remaining nodes can be freed outright
+				ConnectionData* conn = mHead.load();
+				while (conn != nullptr)
+				{
+					ConnectionData* next = conn->nextConn.load();
+					destroyNode(conn);
+
+					conn = next;
+				}
+
+				conn = mRetired;
+				while (conn != nullptr)
+				{
+					ConnectionData* next = static_cast<ConnectionData*>(conn->next);
+					destroyNode(conn);
+
+					conn = next;
+				}
+			}
+
+			/** @copydoc EventInternalData::disconnect */
+			void disconnect(BaseConnectionData* conn) override
+			{
+				RecursiveLock lock(mMutex);
+
+				ConnectionData* myConn = static_cast<ConnectionData*>(conn);
+				if (myConn->active.load())
+				{
+					myConn->active.store(false);
+					unlink(myConn);
+				}
+
+				myConn->handleLinks--;
+
+				if (myConn->handleLinks == 0)
+					retire(myConn);
+
+				reclaimRetired();
+			}
+
+			/** @copydoc EventInternalData::clear */
+			void clear() override
+			{
+				RecursiveLock lock(mMutex);
+
+				ConnectionData* conn = mHead.load();
+				while (conn != nullptr)
+				{
+					ConnectionData* next = conn->nextConn.load();
+
+					conn->active.store(false);
+					conn->prevConn = nullptr;
+
+					if (conn->handleLinks == 0)
+						retire(conn);
+
+					conn = next;
+				}
+
+				mHead.store(nullptr);
+				mTail = nullptr;
+
+				reclaimRetired();
+			}
+
+			/** @copydoc EventInternalData::freeHandle */
+			void freeHandle(BaseConnectionData* conn) override
+			{
+				RecursiveLock lock(mMutex);
+
+				ConnectionData* myConn = static_cast<ConnectionData*>(conn);
+				myConn->handleLinks--;
+
+				if (myConn->handleLinks == 0 && !myConn->active.load())
+					retire(myConn);
+
+				reclaimRetired();
+			}
+
+			/** Removes a node from the connection list. Must be called while holding the mutex. */
+			void unlink(ConnectionData* conn)
+			{
+				ConnectionData* next = conn->nextConn.load();
+
+				if (conn->prevConn != nullptr)
+					conn->prevConn->nextConn.store(next);
+				else
+					mHead.store(next);
+
+				if (next != nullptr)
+					next->prevConn = conn->prevConn;
+				else
+					mTail = conn->prevConn;
+
+				// Note: conn->nextConn is deliberately left intact, so triggers that are still on this node can
+				// continue onto the rest of the list
+			}
+
+			/**
+			 * Queues an unlinked node for reclamation. Must be called while holding the mutex. The node's memory is
+			 * released once no triggers are in progress, as an in-progress trigger might still be reading it.
+			 */
+			void retire(ConnectionData* conn)
+			{
+				conn->isActive = false;
+
+				// Repurpose the (otherwise unused) base class link for the retired list
+				conn->next = mRetired;
+				mRetired = conn;
+			}
+
+			/** Frees all retired nodes, unless a trigger is in progress. Must be called while holding the mutex. */
+			void reclaimRetired()
+			{
+				if (mActiveTriggers.load() != 0)
+					return;
+
+				ConnectionData* conn = mRetired;
+				while (conn != nullptr)
+				{
+					ConnectionData* next = static_cast<ConnectionData*>(conn->next);
+					destroyNode(conn);
+
+					conn = next;
+				}
+
+				mRetired = nullptr;
+			}
+
+			/** Destructs a node and returns its memory to the pool. */
+			void destroyNode(ConnectionData* conn)
+			{
+				conn->isActive = false;
+				conn->next = nullptr;
+				conn->~ConnectionData();
+				mPool.free(conn);
+			}
+
+			/** Head of the connection list, traversed by triggers without locking. */
+			std::atomic<ConnectionData*> mHead { nullptr };
+
+			/** Tail of the connection list. Only accessed while holding the mutex. */
+			ConnectionData* mTail = nullptr;
+
+			/** Retired nodes waiting for all in-progress triggers to finish. Only accessed while holding the mutex. */
+			ConnectionData* mRetired = nullptr;
+
+			/** Number of triggers currently iterating over the connection list. */
+			std::atomic<UINT32> mActiveTriggers { 0 };
+
+			/** Pool the connection nodes are allocated from. Only accessed while holding the mutex. */
+			PoolAlloc<sizeof(ConnectionData), 16, alignof(ConnectionData)> mPool;
+		};
+
+	public:
+		TTriggerOptimizedEvent()
+			:mInternalData(bs_shared_ptr_new<InternalData>())
+		{ }
+
+		~TTriggerOptimizedEvent()
+		{
+			clear();
+		}
+
+		/** Register a new callback that will get notified once the event is triggered. */
+		HEvent connect(std::function<RetType(Args...)> func)
+		{
+			RecursiveLock lock(mInternalData->mMutex);
+
+			ConnectionData* connData = (ConnectionData*)mInternalData->mPool.alloc();
+			new (connData) ConnectionData();
+			connData->func = std::move(func);
+
+			// Publish the fully constructed node at the end of the list. Triggers either see it or they don't, either
+			// way the list stays consistent.
+			connData->prevConn = mInternalData->mTail;
+
+			if (mInternalData->mTail != nullptr)
+				mInternalData->mTail->nextConn.store(connData);
+			else
+				mInternalData->mHead.store(connData);
+
+			mInternalData->mTail = connData;
+
+			mInternalData->reclaimRetired();
+
+			return HEvent(mInternalData, connData);
+		}
+
+		/** Trigger the event, notifying all register callback methods. */
+		void operator() (Args... args)
+		{
+			// Increase ref count to ensure this event data isn't destroyed if one of the callbacks
+			// deletes the event itself.
+			SPtr<InternalData> internalData = mInternalData;
+
+			// While this is non-zero no connection node memory will be reclaimed, making the traversal below safe
+			// even if callbacks (or other threads) disconnect while we iterate
+			internalData->mActiveTriggers.fetch_add(1);
+
+			ConnectionData* conn = internalData->mHead.load();
+			while (conn != nullptr)
+			{
+				// Save next here in case the callback itself disconnects this connection
+				ConnectionData* next = conn->nextConn.load();
+
+				if (conn->active.load())
+					conn->func(std::forward<Args>(args)...);
+
+				conn = next;
+			}
+
+			internalData->mActiveTriggers.fetch_sub(1);
+		}
+
+		/** Clear all callbacks from the event. */
+		void clear()
+		{
+			mInternalData->clear();
+		}
+
+		/**
+		 * Check if event has any callbacks registered.
+		 *
+		 * @note	It is safe to trigger an event even if no callbacks are registered.
+		 */
+		bool empty() const
+		{
+			return mInternalData->mHead.load() == nullptr;
+		}
+
+	private:
+		SPtr<InternalData> mInternalData;
+	};
+
 	/** @} */
 	/** @} */
 
@@ -408,7 +680,7 @@ namespace bs
 	/* 							SPECIALIZATIONS                      		*/
 	/* 	SO YOU MAY USE FUNCTION LIKE SYNTAX FOR DECLARING EVENT SIGNATURE   */
 	/************************************************************************/
-	
+
 	/** @copydoc TEvent */
 	template <typename Signature>
 	class Event;
@@ -418,5 +690,14 @@ namespace bs
 	class Event<RetType(Args...) > : public TEvent <RetType, Args...>
 	{ };
 
+	/** @copydoc TTriggerOptimizedEvent */
+	template <typename Signature>
+	class TriggerOptimizedEvent;
+
+	/** @copydoc TTriggerOptimizedEvent */
+	template <class RetType, class... Args>
+	class TriggerOptimizedEvent<RetType(Args...) > : public TTriggerOptimizedEvent <RetType, Args...>
+	{ };
+
 	/** @} */
 }
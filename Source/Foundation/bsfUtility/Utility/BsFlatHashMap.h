@@ -0,0 +1,429 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Utility
+	 *  @{
+	 */
+
+	/**
+	 * Open addressing hash map using robin hood hashing. Unlike UnorderedMap all entries are stored in a single
+	 * contiguous block of memory, avoiding the per-node allocation and pointer chasing of the standard containers, which
+	 * makes lookups and iteration considerably faster for small keys and values. Intended for lookup-heavy engine
+	 * registries.
+	 *
+	 * Semantics match UnorderedMap with these exceptions:
+	 *  - Iterators and references are invalidated by any insertion (the table may rehash) and by any erase (entries are
+	 *    shifted backwards to fill the hole).
+	 *  - Iteration order is unspecified and changes as the table grows.
+	 *  - Entries are exposed as std::pair<Key, Value> rather than std::pair<const Key, Value>. The key must never be
+	 *    modified through an iterator.
+	 *
+	 * @tparam	Key		Type of the key. Must be movable.
+	 * @tparam	Value	Type of the value. Must be movable.
+	 * @tparam	Hash	Functor generating a hash from the key.
+	 * @tparam	EqualTo	Functor comparing two keys for equality.
+	 * @tparam	Alloc	Allocator to use for the slot array.
+	 */
+	template<class Key, class Value, class Hash = std::hash<Key>, class EqualTo = std::equal_to<Key>, class Alloc = GenAlloc>
+	class FlatHashMap
+	{
+	public:
+		using KeyValue = std::pair<Key, Value>;
+
+	private:
+		/**
+		 * Single entry in the slot array. @p dist is the distance from the entry's ideal slot plus one, with zero marking
+		 * an empty slot. The key-value pair is only constructed while the slot is occupied.
+		 */
+		struct Slot
+		{
+			UINT32 dist;
+			typename std::aligned_storage<sizeof(KeyValue), alignof(KeyValue)>::type data;
+
+			KeyValue* kv() { return (KeyValue*)&data; }
+			const KeyValue* kv() const { return (const KeyValue*)&data; }
+		};
+
+	public:
+		/** Iterator over the occupied entries of the map. */
+		template<bool Const>
+		class IteratorBase
+		{
+		public:
+			using SlotPtr = typename std::conditional<Const, const Slot*, Slot*>::type;
+			using Reference = typename std::conditional<Const, const KeyValue&, KeyValue&>::type;
+			using Pointer = typename std::conditional<Const, const KeyValue*, KeyValue*>::type;
+
+			IteratorBase() = default;
+
+			IteratorBase(SlotPtr slot, SlotPtr end)
+				: mSlot(slot), mEnd(end)
+			{
+				skipEmpty();
+			}
+
+			/** Allow implicit conversion from a non-const to a const iterator. */
+			template<bool OtherConst, class = typename std::enable_if<Const && !OtherConst>::type>
+			IteratorBase(const IteratorBase<OtherConst>& other)
+				: mSlot(other.mSlot), mEnd(other.mEnd)
+			{ }
+
+			Reference operator*() const { return *mSlot->kv(); }
+			Pointer operator->() const { return mSlot->kv(); }
+
+			IteratorBase& operator++()
+			{
+				++mSlot;
+				skipEmpty();
+
+				return *this;
+			}
+
+			IteratorBase operator++(int)
+			{
+				IteratorBase copy = *this;
+				++(*this);
+
+				return copy;
+			}
+
+			bool operator==(const IteratorBase& rhs) const { return mSlot == rhs.mSlot; }
+			bool operator!=(const IteratorBase& rhs) const { return mSlot != rhs.mSlot; }
+
+		private:
+			friend class FlatHashMap;
+			template<bool> friend class IteratorBase;
+
+			/** Moves the iterator forward until it points to an occupied slot, or the end of the slot array. */
+			void skipEmpty()
+			{
+				while (mSlot != mEnd && mSlot->dist == 0)
+					++mSlot;
+			}
+
+			SlotPtr mSlot = nullptr;
+			SlotPtr mEnd = nullptr;
+		};
+
+		using Iterator = IteratorBase<false>;
+		using ConstIterator = IteratorBase<true>;
+
+		FlatHashMap() = default;
+
+		FlatHashMap(const FlatHashMap& other)
+		{
+			reserve(other.mSize);
+
+			for (auto& entry : other)
+				insert(entry);
+		}
+
+		FlatHashMap(FlatHashMap&& other)
+			: mSlots(std::exchange(other.mSlots, nullptr)), mCapacity(std::exchange(other.mCapacity, 0))
+			, mSize(std::exchange(other.mSize, 0))
+		{ }
+
+		~FlatHashMap()
+		{
+			destroyEntries();
+
+			if (mSlots != nullptr)
+				bs_free<Alloc>(mSlots);
+		}
+
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this == &other)
+				return *this;
+
+			clear();
+			reserve(other.mSize);
+
+			for (auto& entry : other)
+				insert(entry);
+
+			return *this;
+		}
+
+		FlatHashMap& operator=(FlatHashMap&& other)
+		{
+			if (this == &other)
+				return *this;
+
+			destroyEntries();
+
+			if (mSlots != nullptr)
+				bs_free<Alloc>(mSlots);
+
+			mSlots = std::exchange(other.mSlots, nullptr);
+			mCapacity = std::exchange(other.mCapacity, 0);
+			mSize = std::exchange(other.mSize, 0);
+
+			return *this;
+		}
+
+		Iterator begin() { return Iterator(mSlots, mSlots + mCapacity); }
+		Iterator end() { return Iterator(mSlots + mCapacity, mSlots + mCapacity); }
+		ConstIterator begin() const { return ConstIterator(mSlots, mSlots + mCapacity); }
+		ConstIterator end() const { return ConstIterator(mSlots + mCapacity, mSlots + mCapacity); }
+
+		/** Returns the number of entries in the map. */
+		UINT32 size() const { return mSize; }
+
+		/** Checks if the map contains no entries. */
+		bool empty() const { return mSize == 0; }
+
+		/** Returns an iterator to the entry with the specified key, or end() if no such entry exists. */
+		Iterator find(const Key& key)
+		{
+			Slot* slot = findSlot(key);
+			if (slot == nullptr)
+				return end();
+
+			return Iterator(slot, mSlots + mCapacity);
+		}
+
+		/** @copydoc find */
+		ConstIterator find(const Key& key) const
+		{
+			const Slot* slot = const_cast<FlatHashMap*>(this)->findSlot(key);
+			if (slot == nullptr)
+				return end();
+
+			return ConstIterator(slot, mSlots + mCapacity);
+		}
+
+		/** Returns the value stored under the specified key, inserting a default constructed value if not present. */
+		Value& operator[](const Key& key)
+		{
+			Slot* slot = findSlot(key);
+			if (slot != nullptr)
+				return slot->kv()->second;
+
+			return insertNew(KeyValue(key, Value()))->second;
+		}
+
+		/**
+		 * Inserts a new entry in the map, unless an entry with the same key already exists. Returns an iterator to the
+		 * inserted (or existing) entry, along with true if the insertion took place.
+		 */
+		std::pair<Iterator, bool> insert(KeyValue entry)
+		{
+			Slot* slot = findSlot(entry.first);
+			if (slot != nullptr)
+				return std::make_pair(Iterator(slot, mSlots + mCapacity), false);
+
+			slot = insertNewSlot(std::move(entry));
+			return std::make_pair(Iterator(slot, mSlots + mCapacity), true);
+		}
+
+		/** Removes the entry with the specified key, if it exists. Returns the number of removed entries. */
+		UINT32 erase(const Key& key)
+		{
+			Slot* slot = findSlot(key);
+			if (slot == nullptr)
+				return 0;
+
+			eraseSlot(slot);
+			return 1;
+		}
+
+		/**
+		 * Removes the entry the iterator points to. Returns an iterator that can be used for continuing iteration,
+		 * however note that entries shifted into the erased slot will be visited again.
+		 */
+		Iterator erase(const Iterator& iter)
+		{
+			eraseSlot(iter.mSlot);
+			return Iterator(iter.mSlot, mSlots + mCapacity);
+		}
+
+		/** Removes all entries from the map, without freeing the slot array. */
+		void clear()
+		{
+			destroyEntries();
+
+			for (UINT32 i = 0; i < mCapacity; i++)
+				mSlots[i].dist = 0;
+
+			mSize = 0;
+		}
+
+		/** Ensures the map can hold the specified number of entries without rehashing. */
+		void reserve(UINT32 numEntries)
+		{
+			UINT32 requiredCapacity = MIN_CAPACITY;
+			while (numEntries * 4 > requiredCapacity * 3)
+				requiredCapacity *= 2;
+
+			if (requiredCapacity > mCapacity)
+				rehash(requiredCapacity);
+		}
+
+	private:
+		static constexpr UINT32 MIN_CAPACITY = 8;
+
+		/** Returns the slot holding the specified key, or null if the key is not present. */
+		Slot* findSlot(const Key& key)
+		{
+			if (mSize == 0)
+				return nullptr;
+
+			const UINT32 mask = mCapacity - 1;
+			UINT32 idx = (UINT32)mHasher(key) & mask;
+			UINT32 dist = 1;
+
+			while (true)
+			{
+				Slot& slot = mSlots[idx];
+
+				// An entry this far from its ideal slot would have displaced a closer one during insertion
+				if (slot.dist < dist)
+					return nullptr;
+
+				if (slot.dist == dist && mEqualTo(slot.kv()->first, key))
+					return &slot;
+
+				idx = (idx + 1) & mask;
+				dist++;
+			}
+		}
+
+		/** Inserts an entry known not to be present, growing the table if necessary. Returns its key-value pair. */
+		KeyValue* insertNew(KeyValue entry)
+		{
+			return insertNewSlot(std::move(entry))->kv();
+		}
+
+		/** Inserts an entry known not to be present, growing the table if necessary. Returns its slot. */
+		Slot* insertNewSlot(KeyValue entry)
+		{
+			if ((mSize + 1) * 4 > mCapacity * 3)
+				rehash(mCapacity == 0 ? MIN_CAPACITY : mCapacity * 2);
+
+			mSize++;
+			return placeEntry(std::move(entry));
+		}
+
+		/**
+		 * Finds a position for the provided entry using robin hood probing, displacing existing entries that are closer
+		 * to their ideal slot than the carried entry is to its own. Assumes the table has a free slot and doesn't contain
+		 * the key. Returns the slot the provided entry ended up in (displaced entries may settle further along).
+		 */
+		Slot* placeEntry(KeyValue entry)
+		{
+			const UINT32 mask = mCapacity - 1;
+			UINT32 idx = (UINT32)mHasher(entry.first) & mask;
+			UINT32 dist = 1;
+
+			Slot* placedSlot = nullptr;
+			while (true)
+			{
+				Slot& slot = mSlots[idx];
+				if (slot.dist == 0)
+				{
+					new (slot.kv()) KeyValue(std::move(entry));
+					slot.dist = dist;
+
+					return placedSlot != nullptr ? placedSlot : &slot;
+				}
+
+				if (slot.dist < dist)
+				{
+					// Rob the rich: the resident entry is closer to home than us, swap places and carry it onwards
+					std::swap(dist, slot.dist);
+
+					KeyValue carried(std::move(*slot.kv()));
+					slot.kv()->~KeyValue();
+					new (slot.kv()) KeyValue(std::move(entry));
+					entry = std::move(carried);
+
+					if (placedSlot == nullptr)
+						placedSlot = &slot;
+				}
+
+				idx = (idx + 1) & mask;
+				dist++;
+			}
+		}
+
+		/** Removes the entry in the specified slot, shifting following entries backwards to fill the hole. */
+		void eraseSlot(Slot* slot)
+		{
+			const UINT32 mask = mCapacity - 1;
+			UINT32 idx = (UINT32)(slot - mSlots);
+
+			mSlots[idx].kv()->~KeyValue();
+
+			UINT32 nextIdx = (idx + 1) & mask;
+			while (mSlots[nextIdx].dist > 1)
+			{
+				Slot& src = mSlots[nextIdx];
+				Slot& dst = mSlots[idx];
+
+				new (dst.kv()) KeyValue(std::move(*src.kv()));
+				dst.dist = src.dist - 1;
+
+				src.kv()->~KeyValue();
+
+				idx = nextIdx;
+				nextIdx = (nextIdx + 1) & mask;
+			}
+
+			mSlots[idx].dist = 0;
+			mSize--;
+		}
+
+		/** Re-creates the slot array with the specified capacity and re-inserts all existing entries. */
+		void rehash(UINT32 newCapacity)
+		{
+			Slot* oldSlots = mSlots;
+			UINT32 oldCapacity = mCapacity;
+
+			mSlots = (Slot*)bs_alloc<Alloc>(newCapacity * sizeof(Slot));
+			mCapacity = newCapacity;
+
+			for (UINT32 i = 0; i < newCapacity; i++)
+				mSlots[i].dist = 0;
+
+			for (UINT32 i = 0; i < oldCapacity; i++)
+			{
+				if (oldSlots[i].dist == 0)
+					continue;
+
+				placeEntry(std::move(*oldSlots[i].kv()));
+				oldSlots[i].kv()->~KeyValue();
+			}
+
+			if (oldSlots != nullptr)
+				bs_free<Alloc>(oldSlots);
+		}
+
+		/** Calls the destructor on all occupied entries, without marking their slots as free. */
+		void destroyEntries()
+		{
+			if (mSize == 0)
+				return;
+
+			for (UINT32 i = 0; i < mCapacity; i++)
+			{
+				if (mSlots[i].dist != 0)
+					mSlots[i].kv()->~KeyValue();
+			}
+		}
+
+		Slot* mSlots = nullptr;
+		UINT32 mCapacity = 0;
+		UINT32 mSize = 0;
+
+		Hash mHasher;
+		EqualTo mEqualTo;
+	};
+
+	/** @} */
+}
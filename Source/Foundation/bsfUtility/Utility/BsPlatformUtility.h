@@ -53,6 +53,15 @@ namespace bs
 		/** Creates a new universally unique identifier (UUID/GUID). */
 		static UUID generateUUID();
 
+		/**
+		 * Fills the provided buffer with random bytes sourced from the operating system's entropy source. More
+		 * expensive than a pseudo-random generator, so prefer requesting larger batches over many small requests.
+		 *
+		 * @param[out]	buffer		Buffer to fill with random bytes.
+		 * @param[in]	count		Number of bytes to write to the buffer.
+		 */
+		static void generateRandom(UINT8* buffer, UINT32 count);
+
 		/**
 		 * Converts a UTF8 encoded string into uppercase or lowercase.
 		 *
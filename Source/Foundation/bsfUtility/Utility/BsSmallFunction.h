@@ -0,0 +1,192 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/** Number of bytes a SmallFunction can store inline, without triggering a heap allocation. */
+	constexpr UINT32 BS_SMALL_FUNCTION_CAPACITY = 128;
+
+	template <class Signature>
+	class SmallFunction;
+
+	/**
+	 * Type-erased callable similar to std::function, except callables whose size doesn't exceed
+	 * BS_SMALL_FUNCTION_CAPACITY bytes are stored in-place and never allocate heap memory. Larger callables fall back to
+	 * a heap allocation, same as std::function. Intended for high-frequency paths (e.g. per-frame command queuing) where
+	 * capture spill-over to the heap shows up in profiles.
+	 */
+	template <class ReturnType, class... Args>
+	class SmallFunction<ReturnType(Args...)>
+	{
+		/** Set of operations for manipulating the type-erased callable, generated per callable type. */
+		struct FunctionOps
+		{
+			ReturnType (*invoke)(const void*, Args&&...);
+			void (*copy)(void*, const void*);
+			void (*move)(void*, void*);
+			void (*destroy)(void*);
+		};
+
+		/** Operations for callables small enough to be stored in the internal buffer. */
+		template <class T>
+		struct InlineOps
+		{
+			static ReturnType invoke(const void* storage, Args&&... args)
+			{
+				return (*(T*)storage)(std::forward<Args>(args)...);
+			}
+
+			static void copy(void* dest, const void* src) { new (dest) T(*(const T*)src); }
+			static void move(void* dest, void* src) { new (dest) T(std::move(*(T*)src)); ((T*)src)->~T(); }
+			static void destroy(void* storage) { ((T*)storage)->~T(); }
+
+			static const FunctionOps* get()
+			{
+				static const FunctionOps ops = { &invoke, &copy, &move, &destroy };
+				return &ops;
+			}
+		};
+
+		/** Operations for callables that exceed the internal buffer, stored through a pointer to the heap. */
+		template <class T>
+		struct HeapOps
+		{
+			static ReturnType invoke(const void* storage, Args&&... args)
+			{
+				return (**(T* const*)storage)(std::forward<Args>(args)...);
+			}
+
+			static void copy(void* dest, const void* src) { *(T**)dest = bs_new<T>(**(T* const*)src); }
+			static void move(void* dest, void* src)
+			{
+				*(T**)dest = *(T**)src;
+				*(T**)src = nullptr;
+			}
+
+			static void destroy(void* storage) { bs_delete(*(T**)storage); }
+
+			static const FunctionOps* get()
+			{
+				static const FunctionOps ops = { &invoke, &copy, &move, &destroy };
+				return &ops;
+			}
+		};
+
+	public:
+		SmallFunction() = default;
+		SmallFunction(std::nullptr_t) { }
+
+		/** Constructs the function object from any compatible callable, storing it inline if it is small enough. */
+		template <class T, class = typename std::enable_if<
+			!std::is_same<typename std::decay<T>::type, SmallFunction>::value>::type>
+		SmallFunction(T&& callable)
+		{
+			using CallableType = typename std::decay<T>::type;
+
+			if(sizeof(CallableType) <= BS_SMALL_FUNCTION_CAPACITY)
+			{
+				new (&mStorage) CallableType(std::forward<T>(callable));
+				mOps = InlineOps<CallableType>::get();
+			}
+			else
+			{
+				*(CallableType**)&mStorage = bs_new<CallableType>(std::forward<T>(callable));
+				mOps = HeapOps<CallableType>::get();
+			}
+		}
+
+		SmallFunction(const SmallFunction& other)
+			:mOps(other.mOps)
+		{
+			if(mOps != nullptr)
+				mOps->copy(&mStorage, &other.mStorage);
+		}
+
+		SmallFunction(SmallFunction&& other)
+			:mOps(other.mOps)
+		{
+			if(mOps != nullptr)
+			{
+				mOps->move(&mStorage, &other.mStorage);
+				other.mOps = nullptr;
+			}
+		}
+
+		~SmallFunction()
+		{
+			if(mOps != nullptr)
+				mOps->destroy(&mStorage);
+		}
+
+		SmallFunction& operator=(const SmallFunction& other)
+		{
+			if(this == &other)
+				return *this;
+
+			if(mOps != nullptr)
+				mOps->destroy(&mStorage);
+
+			mOps = other.mOps;
+			if(mOps != nullptr)
+				mOps->copy(&mStorage, &other.mStorage);
+
+			return *this;
+		}
+
+		SmallFunction& operator=(SmallFunction&& other)
+		{
+			if(this == &other)
+				return *this;
+
+			if(mOps != nullptr)
+				mOps->destroy(&mStorage);
+
+			mOps = other.mOps;
+			if(mOps != nullptr)
+			{
+				mOps->move(&mStorage, &other.mStorage);
+				other.mOps = nullptr;
+			}
+
+			return *this;
+		}
+
+		SmallFunction& operator=(std::nullptr_t)
+		{
+			if(mOps != nullptr)
+			{
+				mOps->destroy(&mStorage);
+				mOps = nullptr;
+			}
+
+			return *this;
+		}
+
+		/** Invokes the stored callable. Calling this on an empty function object is undefined. */
+		ReturnType operator()(Args... args) const
+		{
+			assert(mOps != nullptr);
+
+			return mOps->invoke(&mStorage, std::forward<Args>(args)...);
+		}
+
+		/** Returns true if a callable is currently stored. */
+		explicit operator bool() const { return mOps != nullptr; }
+
+		bool operator==(std::nullptr_t) const { return mOps == nullptr; }
+		bool operator!=(std::nullptr_t) const { return mOps != nullptr; }
+
+	private:
+		typename std::aligned_storage<BS_SMALL_FUNCTION_CAPACITY, 16>::type mStorage;
+		const FunctionOps* mOps = nullptr;
+	};
+
+	/** @} */
+}
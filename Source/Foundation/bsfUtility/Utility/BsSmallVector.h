@@ -0,0 +1,327 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsTypes.h"
+#include "Allocators/BsMemoryAllocator.h"
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/**
+	 * Dynamically sized array, similar to Vector, except the first @p N elements are stored directly inside the object
+	 * without involving the heap. This makes it ideal for short-lived containers that usually hold just a handful of
+	 * elements, where the dynamic allocation would dominate the cost of using the container. Once the element count
+	 * exceeds @p N the contents transparently move to a heap allocation made through the @p Alloc category.
+	 *
+	 * @tparam	Type	Type of the elements. Must be movable.
+	 * @tparam	N		Number of elements that can be stored without a dynamic allocation.
+	 * @tparam	Alloc	Allocator to use for elements that overflow the static storage.
+	 */
+	template <class Type, UINT32 N, class Alloc = GenAlloc>
+	class SmallVector
+	{
+	public:
+		typedef Type ValueType;
+		typedef Type* Iterator;
+		typedef const Type* ConstIterator;
+
+		SmallVector() = default;
+
+		SmallVector(const SmallVector& other)
+		{
+			append(other.begin(), other.end());
+		}
+
+		SmallVector(SmallVector&& other)
+		{
+			*this = std::move(other);
+		}
+
+		SmallVector(std::initializer_list<Type> list)
+		{
+			append(list.begin(), list.end());
+		}
+
+		explicit SmallVector(UINT32 size, const Type& value = Type())
+		{
+			resize(size, value);
+		}
+
+		~SmallVector()
+		{
+			destroyElements();
+
+			if (!isSmall())
+				bs_free<Alloc>(mData);
+		}
+
+		SmallVector& operator=(const SmallVector& other)
+		{
+			if (this == &other)
+				return *this;
+
+			clear();
+			append(other.begin(), other.end());
+
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector&& other)
+		{
+			if (this == &other)
+				return *this;
+
+			destroyElements();
+
+			if (!isSmall())
+				bs_free<Alloc>(mData);
+
+			if (other.isSmall())
+			{
+				// Elements in static storage can't have their buffer stolen, move them one by one
+				mData = (Type*)&mStorage;
+				mCapacity = N;
+				mSize = other.mSize;
+
+				for (UINT32 i = 0; i < mSize; i++)
+				{
+					new (&mData[i]) Type(std::move(other.mData[i]));
+					other.mData[i].~Type();
+				}
+			}
+			else
+			{
+				mData = other.mData;
+				mCapacity = other.mCapacity;
+				mSize = other.mSize;
+
+				other.mData = (Type*)&other.mStorage;
+				other.mCapacity = N;
+			}
+
+			other.mSize = 0;
+			return *this;
+		}
+
+		SmallVector& operator=(std::initializer_list<Type> list)
+		{
+			clear();
+			append(list.begin(), list.end());
+
+			return *this;
+		}
+
+		bool operator==(const SmallVector& other) const
+		{
+			if (mSize != other.mSize)
+				return false;
+
+			return std::equal(begin(), end(), other.begin());
+		}
+
+		bool operator!=(const SmallVector& other) const
+		{
+			return !(*this == other);
+		}
+
+		Type& operator[](UINT32 idx)
+		{
+			assert(idx < mSize && "Array index out-of-range.");
+			return mData[idx];
+		}
+
+		const Type& operator[](UINT32 idx) const
+		{
+			assert(idx < mSize && "Array index out-of-range.");
+			return mData[idx];
+		}
+
+		Iterator begin() { return mData; }
+		Iterator end() { return mData + mSize; }
+		ConstIterator begin() const { return mData; }
+		ConstIterator end() const { return mData + mSize; }
+
+		Type* data() { return mData; }
+		const Type* data() const { return mData; }
+
+		Type& front() { return mData[0]; }
+		const Type& front() const { return mData[0]; }
+
+		Type& back() { return mData[mSize - 1]; }
+		const Type& back() const { return mData[mSize - 1]; }
+
+		/** Returns true if the container holds no elements. */
+		bool empty() const { return mSize == 0; }
+
+		/** Returns the number of elements in the container. */
+		UINT32 size() const { return mSize; }
+
+		/** Returns the number of elements the container can hold without reallocating. */
+		UINT32 capacity() const { return mCapacity; }
+
+		/** Appends a copy of the element to the end of the container. */
+		void push_back(const Type& element)
+		{
+			emplace_back(element);
+		}
+
+		/** Moves the element to the end of the container. */
+		void push_back(Type&& element)
+		{
+			emplace_back(std::move(element));
+		}
+
+		/** Constructs a new element in-place at the end of the container, from the provided arguments. */
+		template<class... Args>
+		Type& emplace_back(Args&&... args)
+		{
+			if (mSize < mCapacity)
+			{
+				Type* element = new (&mData[mSize]) Type(std::forward<Args>(args)...);
+				mSize++;
+
+				return *element;
+			}
+
+			UINT32 newCapacity = mCapacity * 2;
+			Type* newData = (Type*)bs_alloc<Alloc>(newCapacity * sizeof(Type));
+
+			// Construct the new element before moving the existing ones, as the arguments may reference them
+			Type* element = new (&newData[mSize]) Type(std::forward<Args>(args)...);
+
+			for (UINT32 i = 0; i < mSize; i++)
+			{
+				new (&newData[i]) Type(std::move(mData[i]));
+				mData[i].~Type();
+			}
+
+			if (!isSmall())
+				bs_free<Alloc>(mData);
+
+			mData = newData;
+			mCapacity = newCapacity;
+			mSize++;
+
+			return *element;
+		}
+
+		/** Inserts a copy of the element before the position the iterator points to. Returns an iterator to the new element. */
+		Iterator insert(ConstIterator iter, const Type& element)
+		{
+			assert(iter >= begin() && iter <= end() && "Iterator out-of-range.");
+
+			auto idx = (UINT32)(iter - begin());
+			push_back(element);
+
+			std::rotate(begin() + idx, end() - 1, end());
+			return begin() + idx;
+		}
+
+		/** Removes the last element from the container. */
+		void pop_back()
+		{
+			assert(mSize > 0 && "Cannot pop an empty container.");
+
+			mSize--;
+			mData[mSize].~Type();
+		}
+
+		/** Removes the element the iterator points to, shifting any following elements. Returns an iterator to the next element. */
+		Iterator erase(ConstIterator iter)
+		{
+			assert(iter >= begin() && iter < end() && "Iterator out-of-range.");
+
+			auto idx = (UINT32)(iter - begin());
+			for (UINT32 i = idx + 1; i < mSize; i++)
+				mData[i - 1] = std::move(mData[i]);
+
+			pop_back();
+			return mData + idx;
+		}
+
+		/** Removes all elements from the container, without changing its capacity. */
+		void clear()
+		{
+			destroyElements();
+			mSize = 0;
+		}
+
+		/** Ensures the container can hold @p numElements without reallocating. */
+		void reserve(UINT32 numElements)
+		{
+			if (numElements <= mCapacity)
+				return;
+
+			Type* newData = (Type*)bs_alloc<Alloc>(numElements * sizeof(Type));
+			for (UINT32 i = 0; i < mSize; i++)
+			{
+				new (&newData[i]) Type(std::move(mData[i]));
+				mData[i].~Type();
+			}
+
+			if (!isSmall())
+				bs_free<Alloc>(mData);
+
+			mData = newData;
+			mCapacity = numElements;
+		}
+
+		/** Changes the number of elements in the container, appending copies of @p value or removing elements as needed. */
+		void resize(UINT32 size, const Type& value = Type())
+		{
+			if (size > mSize)
+			{
+				reserve(size);
+
+				for (UINT32 i = mSize; i < size; i++)
+					new (&mData[i]) Type(value);
+			}
+			else
+			{
+				for (UINT32 i = size; i < mSize; i++)
+					mData[i].~Type();
+			}
+
+			mSize = size;
+		}
+
+	private:
+		/** Checks is the container currently using its static (non-heap) storage. */
+		bool isSmall() const { return mData == (Type*)&mStorage; }
+
+		/** Appends copies of the provided range of elements to the end of the container. */
+		void append(const Type* rangeBegin, const Type* rangeEnd)
+		{
+			reserve(mSize + (UINT32)(rangeEnd - rangeBegin));
+
+			for (auto iter = rangeBegin; iter != rangeEnd; ++iter)
+			{
+				new (&mData[mSize]) Type(*iter);
+				mSize++;
+			}
+		}
+
+		/** Calls the destructor on all elements, without updating the element count. */
+		void destroyElements()
+		{
+			for (UINT32 i = 0; i < mSize; i++)
+				mData[i].~Type();
+		}
+
+		typename std::aligned_storage<sizeof(Type) * N, alignof(Type)>::type mStorage;
+		Type* mData = (Type*)&mStorage;
+
+		UINT32 mSize = 0;
+		UINT32 mCapacity = N;
+	};
+
+	/** @} */
+}
@@ -166,6 +166,26 @@ namespace bs
 
 	UUID UUIDGenerator::generateRandom()
 	{
-		return PlatformUtility::generateUUID();
+		// A single OS entropy call yields a whole batch of version 4 UUIDs, amortizing the platform API cost across
+		// requests. The pool is thread-local so no synchronization is required.
+		constexpr UINT32 BATCH_SIZE = 64;
+
+		static BS_THREADLOCAL UINT32 pool[BATCH_SIZE * 4];
+		static BS_THREADLOCAL UINT32 poolIdx = BATCH_SIZE;
+
+		if (poolIdx >= BATCH_SIZE)
+		{
+			PlatformUtility::generateRandom((UINT8*)pool, sizeof(pool));
+			poolIdx = 0;
+		}
+
+		UINT32* data = &pool[poolIdx * 4];
+		poolIdx++;
+
+		// Stamp the version (4 - random) and variant (RFC 4122) bits over the random data
+		data[1] = (data[1] & 0xFFFF0FFF) | 0x00004000;
+		data[2] = (data[2] & 0x3FFFFFFF) | 0x80000000;
+
+		return UUID(data[0], data[1], data[2], data[3]);
 	}
 }
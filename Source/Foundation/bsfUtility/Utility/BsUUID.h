@@ -100,11 +100,13 @@ struct hash<bs::UUID>
 {
 	size_t operator()(const bs::UUID& value) const
 	{
+		// The data is 16 tightly packed bytes, view it as two 64-bit words so the hash needs half as many mixing steps
+		bs::UINT64 words[2];
+		memcpy(words, value.mData, sizeof(words));
+
 		size_t hash = 0;
-		bs::hash_combine(hash, value.mData[0]);
-		bs::hash_combine(hash, value.mData[1]);
-		bs::hash_combine(hash, value.mData[2]);
-		bs::hash_combine(hash, value.mData[3]);
+		bs::hash_combine(hash, words[0]);
+		bs::hash_combine(hash, words[1]);
 
 		return hash;
 	}
@@ -18,6 +18,38 @@ namespace bs
 		seed ^= hasher(v) + 0x9e3779b9 + (seed<<6) + (seed>>2);
 	}
 
+	/**
+	 * Generates a 32-bit FNV-1a hash from a null-terminated string. Implemented as constexpr so hashes of string
+	 * literals can be evaluated at compile time.
+	 */
+	constexpr UINT32 bs_hash_string(const char* str)
+	{
+		UINT32 hash = 0x811c9dc5;
+		while (*str != '\0')
+		{
+			hash = (hash ^ (UINT8)*str) * 0x01000193;
+			++str;
+		}
+
+		return hash;
+	}
+
+	/** Generates a 64-bit FNV-1a hash from the provided block of raw memory. */
+	inline UINT64 bs_hash_data(const void* data, UINT64 size)
+	{
+		constexpr UINT64 FNV_PRIME = 0x100000001b3;
+
+		UINT64 hash = 0xcbf29ce484222325;
+		const UINT8* bytes = (const UINT8*)data;
+		for (UINT64 i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+
+		return hash;
+	}
+
 	/** Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const WString& source);
 
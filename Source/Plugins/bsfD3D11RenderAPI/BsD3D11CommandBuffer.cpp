@@ -11,7 +11,7 @@ namespace bs { namespace ct
 			BS_EXCEPT(InvalidParametersException, "Only a single device supported on DX11.");
 	}
 
-	void D3D11CommandBuffer::queueCommand(const std::function<void()> command)
+	void D3D11CommandBuffer::queueCommand(const std::function<void()>& command)
 	{
 		mCommands.push_back(command);
 	}
@@ -32,8 +32,11 @@ namespace bs { namespace ct
 		}
 #endif
 
+		mCommands.reserve(mCommands.size() + secondaryBuffer->mCommands.size());
 		for (auto& entry : secondaryBuffer->mCommands)
-			mCommands.push_back(entry);
+			mCommands.push_back(std::move(entry));
+
+		secondaryBuffer->mCommands.clear();
 	}
 
 	void D3D11CommandBuffer::executeCommands()
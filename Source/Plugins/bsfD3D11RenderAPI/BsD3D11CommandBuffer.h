@@ -15,14 +15,23 @@ namespace bs { namespace ct
 	/**
 	 * Command buffer implementation for DirectX 11, which doesn't support multi-threaded command generation. Instead all
 	 * commands are stored in an internal buffer, and then sent to the actual render API when the buffer is executed.
+	 *
+	 * Note that D3D11 deferred contexts are deliberately not used here. All queued commands issue their device calls
+	 * against the immediate context and shared render API state at execution time, so replay always happens serially on
+	 * the core thread. Moving that work onto worker threads through deferred contexts would require per-context
+	 * duplicates of all state tracked by D3D11RenderAPI, and on most drivers deferred command lists are emulated,
+	 * yielding little benefit for that cost.
 	 */
 	class D3D11CommandBuffer : public CommandBuffer
 	{
 	public:
 		/** Registers a new command in the command buffer. */
-		void queueCommand(const std::function<void()> command);
+		void queueCommand(const std::function<void()>& command);
 
-		/** Appends all commands from the secondary buffer into this command buffer. */
+		/**
+		 * Appends all commands from the secondary buffer into this command buffer. The secondary buffer is emptied in the
+		 * process.
+		 */
 		void appendSecondary(const SPtr<D3D11CommandBuffer>& secondaryBuffer);
 
 		/** Executes all commands in the command buffer. Not supported on secondary buffer. */
@@ -46,8 +46,10 @@ namespace bs { namespace ct
 		return mBuffer->getD3DBuffer();
 	}
 
-	void D3D11GpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
+	void D3D11GpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 offset, UINT32 size, UINT32 queueIdx)
 	{
+		// D3D11 doesn't support partial constant buffer updates, so the entire buffer is written regardless of the
+		// requested range
 		mBuffer->writeData(0, mSize, data, BWT_DISCARD);
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
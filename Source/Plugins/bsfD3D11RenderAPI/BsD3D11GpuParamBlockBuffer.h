@@ -19,7 +19,7 @@ namespace bs { namespace ct
 		~D3D11GpuParamBlockBuffer();
 
 		/** @copydoc GpuParamBlockBuffer::writeToGPU */
-		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override;
+		void writeToGPU(const UINT8* data, UINT32 offset, UINT32 size, UINT32 queueIdx = 0) override;
 
 		/**	Returns internal DX11 buffer object. */
 		ID3D11Buffer* getD3D11Buffer() const;
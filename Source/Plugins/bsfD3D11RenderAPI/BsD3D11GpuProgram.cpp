@@ -48,7 +48,7 @@ namespace bs { namespace ct
 			desc.source = mSource;
 			desc.language = "hlsl";
 
-			mBytecode = compileBytecode(desc);
+			mBytecode = GpuProgramManager::instance().getBytecode(desc, DIRECTX_COMPILER_ID);
 		}
 
 		mCompileMessages = mBytecode->messages;
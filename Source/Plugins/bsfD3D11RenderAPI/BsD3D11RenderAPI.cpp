@@ -372,6 +372,22 @@ namespace bs { namespace ct
 				FrameVector<ID3D11Buffer*> constBuffers(8);
 				FrameVector<ID3D11SamplerState*> samplers(8);
 
+				// Checks if the requested bindings are already present on the context, in which case the bind can be
+				// skipped. Otherwise records them as the new bound state. Textures and samplers rarely change between
+				// draws using the same material, while constant buffers do, so only the former two are cached.
+				auto isRedundantBind = [](auto& cache, auto& newBindings)
+				{
+					auto num = newBindings.size();
+					if (num <= cache.size() && std::equal(newBindings.begin(), newBindings.end(), cache.begin()))
+						return true;
+
+					if (num > cache.size())
+						cache.resize(num);
+
+					std::copy(newBindings.begin(), newBindings.end(), cache.begin());
+					return false;
+				};
+
 				auto populateViews = [&](GpuProgramType type)
 				{
 					srvs.clear();
@@ -504,13 +520,13 @@ namespace bs { namespace ct
 				numConstBuffers = (UINT32)constBuffers.size();
 				numSamplers = (UINT32)samplers.size();
 
-				if(numSRVs > 0)
+				if(numSRVs > 0 && !isRedundantBind(mBoundParams[GPT_VERTEX_PROGRAM].srvs, srvs))
 					context->VSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
 					context->VSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
 
-				if (numSamplers > 0)
+				if (numSamplers > 0 && !isRedundantBind(mBoundParams[GPT_VERTEX_PROGRAM].samplers, samplers))
 					context->VSSetSamplers(0, numSamplers, samplers.data());
 
 				populateViews(GPT_FRAGMENT_PROGRAM);
@@ -519,7 +535,7 @@ namespace bs { namespace ct
 				numConstBuffers = (UINT32)constBuffers.size();
 				numSamplers = (UINT32)samplers.size();
 
-				if (numSRVs > 0)
+				if (numSRVs > 0 && !isRedundantBind(mBoundParams[GPT_FRAGMENT_PROGRAM].srvs, srvs))
 					context->PSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numUAVs > 0)
@@ -527,12 +543,15 @@ namespace bs { namespace ct
 					context->OMSetRenderTargetsAndUnorderedAccessViews(
 						D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL, nullptr, nullptr, 0, numUAVs, uavs.data(), nullptr);
 					mPSUAVsBound = true;
+
+					// Runtime might have implicitly unbound any resources conflicting with the UAVs
+					invalidateBindCache();
 				}
 
 				if (numConstBuffers > 0)
 					context->PSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
 
-				if (numSamplers > 0)
+				if (numSamplers > 0 && !isRedundantBind(mBoundParams[GPT_FRAGMENT_PROGRAM].samplers, samplers))
 					context->PSSetSamplers(0, numSamplers, samplers.data());
 
 				populateViews(GPT_GEOMETRY_PROGRAM);
@@ -540,13 +559,13 @@ namespace bs { namespace ct
 				numConstBuffers = (UINT32)constBuffers.size();
 				numSamplers = (UINT32)samplers.size();
 
-				if (numSRVs > 0)
+				if (numSRVs > 0 && !isRedundantBind(mBoundParams[GPT_GEOMETRY_PROGRAM].srvs, srvs))
 					context->GSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
 					context->GSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
 
-				if (numSamplers > 0)
+				if (numSamplers > 0 && !isRedundantBind(mBoundParams[GPT_GEOMETRY_PROGRAM].samplers, samplers))
 					context->GSSetSamplers(0, numSamplers, samplers.data());
 
 				populateViews(GPT_HULL_PROGRAM);
@@ -554,13 +573,13 @@ namespace bs { namespace ct
 				numConstBuffers = (UINT32)constBuffers.size();
 				numSamplers = (UINT32)samplers.size();
 
-				if (numSRVs > 0)
+				if (numSRVs > 0 && !isRedundantBind(mBoundParams[GPT_HULL_PROGRAM].srvs, srvs))
 					context->HSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
 					context->HSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
 
-				if (numSamplers > 0)
+				if (numSamplers > 0 && !isRedundantBind(mBoundParams[GPT_HULL_PROGRAM].samplers, samplers))
 					context->HSSetSamplers(0, numSamplers, samplers.data());
 
 				populateViews(GPT_DOMAIN_PROGRAM);
@@ -568,13 +587,13 @@ namespace bs { namespace ct
 				numConstBuffers = (UINT32)constBuffers.size();
 				numSamplers = (UINT32)samplers.size();
 
-				if (numSRVs > 0)
+				if (numSRVs > 0 && !isRedundantBind(mBoundParams[GPT_DOMAIN_PROGRAM].srvs, srvs))
 					context->DSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numConstBuffers > 0)
 					context->DSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
 
-				if (numSamplers > 0)
+				if (numSamplers > 0 && !isRedundantBind(mBoundParams[GPT_DOMAIN_PROGRAM].samplers, samplers))
 					context->DSSetSamplers(0, numSamplers, samplers.data());
 
 				populateViews(GPT_COMPUTE_PROGRAM);
@@ -583,19 +602,22 @@ namespace bs { namespace ct
 				numConstBuffers = (UINT32)constBuffers.size();
 				numSamplers = (UINT32)samplers.size();
 
-				if (numSRVs > 0)
+				if (numSRVs > 0 && !isRedundantBind(mBoundParams[GPT_COMPUTE_PROGRAM].srvs, srvs))
 					context->CSSetShaderResources(0, numSRVs, srvs.data());
 
 				if (numUAVs > 0)
 				{
 					context->CSSetUnorderedAccessViews(0, numUAVs, uavs.data(), nullptr);
 					mCSUAVsBound = true;
+
+					// Runtime might have implicitly unbound any resources conflicting with the UAVs
+					invalidateBindCache();
 				}
 
 				if (numConstBuffers > 0)
 					context->CSSetConstantBuffers(0, numConstBuffers, constBuffers.data());
 
-				if (numSamplers > 0)
+				if (numSamplers > 0 && !isRedundantBind(mBoundParams[GPT_COMPUTE_PROGRAM].samplers, samplers))
 					context->CSSetSamplers(0, numSamplers, samplers.data());
 
 			}
@@ -1074,6 +1096,9 @@ namespace bs { namespace ct
 			if (mDevice->hasError())
 				BS_EXCEPT(RenderingAPIException, "Failed to setRenderTarget : " + mDevice->getErrorDescription());
 
+			// Runtime might have implicitly unbound any resources conflicting with the new targets
+			invalidateBindCache();
+
 			bs_deleteN(views, maxRenderTargets);
 			applyViewport();
 		};
@@ -1095,10 +1120,23 @@ namespace bs { namespace ct
 	{
 		THROW_IF_NOT_CORE_THREAD;
 		target->swapBuffers();
-		
+
+		// Resources released during the frame may get reused at the same address next frame, so don't trust any
+		// cached binding pointers across the frame boundary
+		invalidateBindCache();
+
 		BS_INC_RENDER_STAT(NumPresents);
 	}
 
+	void D3D11RenderAPI::invalidateBindCache()
+	{
+		for (auto& entry : mBoundParams)
+		{
+			entry.srvs.clear();
+			entry.samplers.clear();
+		}
+	}
+
 	void D3D11RenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
 	{
 		SPtr<D3D11CommandBuffer> cb = std::static_pointer_cast<D3D11CommandBuffer>(commandBuffer);
@@ -151,6 +151,13 @@ namespace bs { namespace ct
 		/** Creates and populates a set of render system capabilities describing which functionality is available. */
 		void initCapabilites(IDXGIAdapter* adapter, RenderAPICapabilities& caps) const;
 
+		/**
+		 * Forgets any cached shader resource and sampler bindings, forcing the next setGpuParams() call to rebind
+		 * everything. Must be called whenever bindings may have changed outside of setGpuParams() (e.g. the runtime
+		 * implicitly unbinding resources that conflict with a new render target).
+		 */
+		void invalidateBindCache();
+
 	private:
 		IDXGIFactory* mDXGIFactory;
 		D3D11Device* mDevice;
@@ -166,6 +173,15 @@ namespace bs { namespace ct
 		bool mPSUAVsBound;
 		bool mCSUAVsBound;
 
+		/** Bindings applied by the last setGpuParams() call for a single stage, used for skipping redundant binds. */
+		struct BoundParamsState
+		{
+			Vector<ID3D11ShaderResourceView*> srvs;
+			Vector<ID3D11SamplerState*> samplers;
+		};
+
+		BoundParamsState mBoundParams[GPT_COUNT];
+
 		UINT32 mStencilRef;
 		Rect2 mViewportNorm;
 		D3D11_VIEWPORT mViewport;
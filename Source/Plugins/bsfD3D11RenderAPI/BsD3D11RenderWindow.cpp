@@ -704,6 +704,18 @@ namespace bs
 			hr = mDXGIFactory->CreateSwapChain(pDXGIDevice, &mSwapChainDesc, &mSwapChain);
 		}
 
+		if (SUCCEEDED(hr))
+		{
+			// Don't let the driver queue more than a single frame ahead of the GPU. Deep present queues inflate input
+			// latency without improving framerate, since the application already paces itself on the sim thread.
+			IDXGIDevice1* pDXGIDevice1 = nullptr;
+			if (SUCCEEDED(pDXGIDevice->QueryInterface(__uuidof(IDXGIDevice1), (void**)&pDXGIDevice1)))
+			{
+				pDXGIDevice1->SetMaximumFrameLatency(1);
+				SAFE_RELEASE(pDXGIDevice1);
+			}
+		}
+
 		SAFE_RELEASE(pDXGIDevice);
 
 		if (FAILED(hr))
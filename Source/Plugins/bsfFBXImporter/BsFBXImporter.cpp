@@ -13,6 +13,7 @@
 #include "RenderAPI/BsVertexDataDesc.h"
 #include "BsFBXUtility.h"
 #include "Mesh/BsMeshUtility.h"
+#include "Mesh/BsMeshBVH.h"
 #include "Renderer/BsRendererMeshData.h"
 #include "Importer/BsMeshImportOptions.h"
 #include "Physics/BsPhysicsMesh.h"
@@ -23,9 +24,45 @@
 #include "Animation/BsMorphShapes.h"
 #include "Physics/BsPhysics.h"
 #include "FileSystem/BsFileSystem.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
+	/**
+	 * Splits the provided range into roughly equal chunks and processes them on the task scheduler's worker threads.
+	 * Runs inline on the calling thread when the range is too small to be worth distributing. Blocks until all chunks
+	 * are processed.
+	 */
+	static void processRangeParallel(UINT32 count, UINT32 minEntriesPerTask, std::function<void(UINT32, UINT32)> worker)
+	{
+		UINT32 numTasks = 0;
+		if (minEntriesPerTask > 0)
+			numTasks = count / minEntriesPerTask;
+
+		numTasks = std::min(numTasks, TaskScheduler::instance().getNumWorkers());
+
+		if (numTasks <= 1)
+		{
+			worker(0, count);
+			return;
+		}
+
+		UINT32 entriesPerTask = count / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			UINT32 start = i * entriesPerTask;
+			UINT32 end = (i == (numTasks - 1)) ? count : (start + entriesPerTask);
+
+			tasks.push_back(Task::create("FBXImport", std::bind(worker, start, end)));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
 	Matrix4 FBXToNativeType(const FbxAMatrix& value)
 	{
 		Matrix4 native;
@@ -126,7 +163,23 @@ namespace bs
 		if (meshImportOptions->getCPUCached())
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = rendererMeshData->getData();
+
+		// Vertex reordering invalidates morph shape vertex indices, so only reorder indices in that case
+		if (meshImportOptions->getOptimizeMesh())
+			MeshUtility::optimizeForRendering(meshData, desc.subMeshes, desc.morphShapes == nullptr);
+
+		UINT32 numLodLevels = meshImportOptions->getGenerateLodLevels();
+		if (numLodLevels > 0)
+		{
+			meshData = MeshUtility::generateLodChain(meshData, desc.subMeshes, numLodLevels, 0.5f,
+				desc.lodSubMeshes, desc.lodScreenSizes);
+		}
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
+
+		if (meshImportOptions->getGenerateBVH())
+			mesh->_setBVH(MeshBVH::create(*meshData));
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -148,7 +201,23 @@ namespace bs
 		if (meshImportOptions->getCPUCached())
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = rendererMeshData->getData();
+
+		// Vertex reordering invalidates morph shape vertex indices, so only reorder indices in that case
+		if (meshImportOptions->getOptimizeMesh())
+			MeshUtility::optimizeForRendering(meshData, desc.subMeshes, desc.morphShapes == nullptr);
+
+		UINT32 numLodLevels = meshImportOptions->getGenerateLodLevels();
+		if (numLodLevels > 0)
+		{
+			meshData = MeshUtility::generateLodChain(meshData, desc.subMeshes, numLodLevels, 0.5f,
+				desc.lodSubMeshes, desc.lodScreenSizes);
+		}
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
+
+		if (meshImportOptions->getGenerateBVH())
+			mesh->_setBVH(MeshBVH::create(*meshData));
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -659,20 +728,27 @@ namespace bs
 
 	void FBXImporter::splitMeshVertices(FBXImportScene& scene)
 	{
-		Vector<FBXImportMesh*> splitMeshes;
+		UINT32 numMeshes = (UINT32)scene.meshes.size();
+		Vector<FBXImportMesh*> splitMeshes(numMeshes);
 
-		for (auto& mesh : scene.meshes)
+		// Individual meshes are fully independent, so split them on separate worker threads
+		processRangeParallel(numMeshes, 1, [&](UINT32 start, UINT32 end)
 		{
-			FBXImportMesh* splitMesh = bs_new<FBXImportMesh>();
-			splitMesh->fbxMesh = mesh->fbxMesh;
-			splitMesh->referencedBy = mesh->referencedBy;
-			splitMesh->bones = mesh->bones;
+			for (UINT32 i = start; i < end; i++)
+			{
+				FBXImportMesh* mesh = scene.meshes[i];
 
-			FBXUtility::splitVertices(*mesh, *splitMesh);
-			splitMeshes.push_back(splitMesh);
+				FBXImportMesh* splitMesh = bs_new<FBXImportMesh>();
+				splitMesh->fbxMesh = mesh->fbxMesh;
+				splitMesh->referencedBy = mesh->referencedBy;
+				splitMesh->bones = mesh->bones;
 
-			bs_delete(mesh);
-		}
+				FBXUtility::splitVertices(*mesh, *splitMesh);
+				splitMeshes[i] = splitMesh;
+
+				bs_delete(mesh);
+			}
+		});
 
 		scene.meshes = splitMeshes;
 	}
@@ -694,168 +770,183 @@ namespace bs
 				rootBoneName = skeleton->getBoneInfo(rootBoneIdx).name;
 		}
 
-		bool isFirstClip = true;
-		for (auto& clip : clips)
+		// Processed data of a single clip, before a unique name was assigned
+		struct ProcessedClip
 		{
-			SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+			String name;
+			String clipName;
+			bool isAdditive;
+			UINT32 sampleRate;
+			SPtr<AnimationCurves> curves;
 			SPtr<RootMotion> rootMotion;
+		};
 
-			// Find offset so animations start at time 0
-			float animStart = std::numeric_limits<float>::infinity();
+		UINT32 numClips = (UINT32)clips.size();
+		Vector<Vector<ProcessedClip>> processedClips(numClips);
 
-			for (auto& bone : clip.boneAnimations)
+		// Individual clips are independent of each other, so convert them on separate worker threads. Unique names are
+		// assigned in a serial pass below, so the output remains deterministic.
+		processRangeParallel(numClips, 1, [&](UINT32 startIdx, UINT32 endIdx)
+		{
+			for (UINT32 clipIdx = startIdx; clipIdx < endIdx; clipIdx++)
 			{
-				if(bone.translation.getNumKeyFrames() > 0)
-					animStart = std::min(bone.translation.getKeyFrame(0).time, animStart);
-
-				if (bone.rotation.getNumKeyFrames() > 0)
-					animStart = std::min(bone.rotation.getKeyFrame(0).time, animStart);
+				const FBXAnimationClip& clip = clips[clipIdx];
 
-				if (bone.scale.getNumKeyFrames() > 0)
-					animStart = std::min(bone.scale.getKeyFrame(0).time, animStart);
-			}
+				SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+				SPtr<RootMotion> rootMotion;
 
-			for (auto& anim : clip.blendShapeAnimations)
-			{
-				if (anim.curve.getNumKeyFrames() > 0)
-					animStart = std::min(anim.curve.getKeyFrame(0).time, animStart);
-			}
+				// Find offset so animations start at time 0
+				float animStart = std::numeric_limits<float>::infinity();
 
-			AnimationCurveFlags blendShapeFlags = AnimationCurveFlag::ImportedCurve | AnimationCurveFlag::MorphFrame;
-			if (animStart != 0.0f && animStart != std::numeric_limits<float>::infinity())
-			{
 				for (auto& bone : clip.boneAnimations)
 				{
-					TAnimationCurve<Vector3> translation = AnimationUtility::offsetCurve(bone.translation, -animStart);
-					TAnimationCurve<Quaternion> rotation = AnimationUtility::offsetCurve(bone.rotation, -animStart);
-					TAnimationCurve<Vector3> scale = AnimationUtility::offsetCurve(bone.scale, -animStart);
+					if(bone.translation.getNumKeyFrames() > 0)
+						animStart = std::min(bone.translation.getKeyFrame(0).time, animStart);
 
-					if(importRootMotion && bone.node->name == rootBoneName)
-						rootMotion = bs_shared_ptr_new<RootMotion>(translation, rotation);
-					else
-					{
-						curves->position.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, translation });
-						curves->rotation.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, rotation });
-						curves->scale.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, scale });
-					}
+					if (bone.rotation.getNumKeyFrames() > 0)
+						animStart = std::min(bone.rotation.getKeyFrame(0).time, animStart);
+
+					if (bone.scale.getNumKeyFrames() > 0)
+						animStart = std::min(bone.scale.getKeyFrame(0).time, animStart);
 				}
 
 				for (auto& anim : clip.blendShapeAnimations)
 				{
-					TAnimationCurve<float> curve = AnimationUtility::offsetCurve(anim.curve, -animStart);
-					curves->generic.push_back({ anim.blendShape, blendShapeFlags, curve });
+					if (anim.curve.getNumKeyFrames() > 0)
+						animStart = std::min(anim.curve.getKeyFrame(0).time, animStart);
 				}
-			}
-			else
-			{
-				for (auto& bone : clip.boneAnimations)
+
+				AnimationCurveFlags blendShapeFlags = AnimationCurveFlag::ImportedCurve | AnimationCurveFlag::MorphFrame;
+				if (animStart != 0.0f && animStart != std::numeric_limits<float>::infinity())
 				{
-					if (importRootMotion && bone.node->name == rootBoneName)
-						rootMotion = bs_shared_ptr_new<RootMotion>(bone.translation, bone.rotation);
-					else
+					for (auto& bone : clip.boneAnimations)
 					{
-						curves->position.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, bone.translation });
-						curves->rotation.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, bone.rotation });
-						curves->scale.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, bone.scale });
+						TAnimationCurve<Vector3> translation = AnimationUtility::offsetCurve(bone.translation, -animStart);
+						TAnimationCurve<Quaternion> rotation = AnimationUtility::offsetCurve(bone.rotation, -animStart);
+						TAnimationCurve<Vector3> scale = AnimationUtility::offsetCurve(bone.scale, -animStart);
+
+						if(importRootMotion && bone.node->name == rootBoneName)
+							rootMotion = bs_shared_ptr_new<RootMotion>(translation, rotation);
+						else
+						{
+							curves->position.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, translation });
+							curves->rotation.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, rotation });
+							curves->scale.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, scale });
+						}
 					}
-				}
 
-				for (auto& anim : clip.blendShapeAnimations)
-					curves->generic.push_back({ anim.blendShape, blendShapeFlags, anim.curve });
-			}
+					for (auto& anim : clip.blendShapeAnimations)
+					{
+						TAnimationCurve<float> curve = AnimationUtility::offsetCurve(anim.curve, -animStart);
+						curves->generic.push_back({ anim.blendShape, blendShapeFlags, curve });
+					}
+				}
+				else
+				{
+					for (auto& bone : clip.boneAnimations)
+					{
+						if (importRootMotion && bone.node->name == rootBoneName)
+							rootMotion = bs_shared_ptr_new<RootMotion>(bone.translation, bone.rotation);
+						else
+						{
+							curves->position.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, bone.translation });
+							curves->rotation.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, bone.rotation });
+							curves->scale.push_back({ bone.node->name, AnimationCurveFlag::ImportedCurve, bone.scale });
+						}
+					}
 
-			// See if any splits are required. We only split the first clip as it is assumed if FBX has multiple clips the
-			// user has the ability to split them externally.
-			if(isFirstClip && !splits.empty())
-			{
-				float secondsPerFrame = 1.0f / clip.sampleRate;
+					for (auto& anim : clip.blendShapeAnimations)
+						curves->generic.push_back({ anim.blendShape, blendShapeFlags, anim.curve });
+				}
 
-				for(auto& split : splits)
+				// See if any splits are required. We only split the first clip as it is assumed if FBX has multiple
+				// clips the user has the ability to split them externally.
+				if(clipIdx == 0 && !splits.empty())
 				{
-					SPtr<AnimationCurves> splitClipCurve = bs_shared_ptr_new<AnimationCurves>();
-					SPtr<RootMotion> splitRootMotion;
+					float secondsPerFrame = 1.0f / clip.sampleRate;
 
-					auto splitCurves = [&](auto& inCurves, auto& outCurves)
+					for(auto& split : splits)
 					{
-						UINT32 numCurves = (UINT32)inCurves.size();
-						outCurves.resize(numCurves);
+						SPtr<AnimationCurves> splitClipCurve = bs_shared_ptr_new<AnimationCurves>();
+						SPtr<RootMotion> splitRootMotion;
 
-						for (UINT32 i = 0; i < numCurves; i++)
+						auto splitCurves = [&](auto& inCurves, auto& outCurves)
 						{
-							auto& animCurve = inCurves[i].curve;
-							outCurves[i].name = inCurves[i].name;
-
-							UINT32 numFrames = animCurve.getNumKeyFrames();
-							if (numFrames == 0)
-								continue;
-
-							float startTime = split.startFrame * secondsPerFrame;
-							float endTime = split.endFrame * secondsPerFrame;
-
-							outCurves[i].curve = inCurves[i].curve.split(startTime, endTime);
+							UINT32 numCurves = (UINT32)inCurves.size();
+							outCurves.resize(numCurves);
 
-							if (split.isAdditive)
-								outCurves[i].curve.makeAdditive();
-						}
-					};
+							for (UINT32 i = 0; i < numCurves; i++)
+							{
+								auto& animCurve = inCurves[i].curve;
+								outCurves[i].name = inCurves[i].name;
 
-					splitCurves(curves->position, splitClipCurve->position);
-					splitCurves(curves->rotation, splitClipCurve->rotation);
-					splitCurves(curves->scale, splitClipCurve->scale);
-					splitCurves(curves->generic, splitClipCurve->generic);
+								UINT32 numFrames = animCurve.getNumKeyFrames();
+								if (numFrames == 0)
+									continue;
 
-					if(rootMotion != nullptr)
-					{
-						auto splitCurve = [&](auto& inCurve, auto& outCurve)
-						{
-							UINT32 numFrames = inCurve.getNumKeyFrames();
-							if (numFrames > 0)
-							{
 								float startTime = split.startFrame * secondsPerFrame;
 								float endTime = split.endFrame * secondsPerFrame;
 
-								outCurve = inCurve.split(startTime, endTime);
+								outCurves[i].curve = inCurves[i].curve.split(startTime, endTime);
 
 								if (split.isAdditive)
-									outCurve.makeAdditive();
+									outCurves[i].curve.makeAdditive();
 							}
 						};
 
-						splitRootMotion = bs_shared_ptr_new<RootMotion>();
-						splitCurve(rootMotion->position, splitRootMotion->position);
-						splitCurve(rootMotion->rotation, splitRootMotion->rotation);
-					}
+						splitCurves(curves->position, splitClipCurve->position);
+						splitCurves(curves->rotation, splitClipCurve->rotation);
+						splitCurves(curves->scale, splitClipCurve->scale);
+						splitCurves(curves->generic, splitClipCurve->generic);
 
-					// Search for a unique name
-					String name = split.name;
-					UINT32 attemptIdx = 0;
-					while (names.find(name) != names.end())
-					{
-						name = clip.name + "_" + toString(attemptIdx);
-						attemptIdx++;
-					}
+						if(rootMotion != nullptr)
+						{
+							auto splitCurve = [&](auto& inCurve, auto& outCurve)
+							{
+								UINT32 numFrames = inCurve.getNumKeyFrames();
+								if (numFrames > 0)
+								{
+									float startTime = split.startFrame * secondsPerFrame;
+									float endTime = split.endFrame * secondsPerFrame;
+
+									outCurve = inCurve.split(startTime, endTime);
+
+									if (split.isAdditive)
+										outCurve.makeAdditive();
+								}
+							};
 
-					names.insert(name);
-					output.push_back(FBXAnimationClipData(name, split.isAdditive, clip.sampleRate, splitClipCurve,
-						splitRootMotion));
+							splitRootMotion = bs_shared_ptr_new<RootMotion>();
+							splitCurve(rootMotion->position, splitRootMotion->position);
+							splitCurve(rootMotion->rotation, splitRootMotion->rotation);
+						}
+
+						processedClips[clipIdx].push_back({ split.name, clip.name, split.isAdditive, clip.sampleRate,
+							splitClipCurve, splitRootMotion });
+					}
 				}
+				else
+					processedClips[clipIdx].push_back({ clip.name, clip.name, false, clip.sampleRate, curves, rootMotion });
 			}
-			else
+		});
+
+		for (auto& clipEntries : processedClips)
+		{
+			for (auto& entry : clipEntries)
 			{
 				// Search for a unique name
-				String name = clip.name;
+				String name = entry.name;
 				UINT32 attemptIdx = 0;
-				while(names.find(name) != names.end())
+				while (names.find(name) != names.end())
 				{
-					name = clip.name + "_" + toString(attemptIdx);
+					name = entry.clipName + "_" + toString(attemptIdx);
 					attemptIdx++;
 				}
 
 				names.insert(name);
-				output.push_back(FBXAnimationClipData(name, false, clip.sampleRate, curves, rootMotion));
+				output.push_back(FBXAnimationClipData(name, entry.isAdditive, entry.sampleRate, entry.curves,
+					entry.rootMotion));
 			}
-
-			isFirstClip = false;
 		}
 	}
 
@@ -1672,49 +1763,56 @@ namespace bs
 
 	void FBXImporter::generateMissingTangentSpace(FBXImportScene& scene, const FBXImportOptions& options)
 	{
-		for (auto& mesh : scene.meshes)
+		// Tangent space generation only reads and writes data of a single mesh, so process meshes on separate
+		// worker threads
+		UINT32 numMeshes = (UINT32)scene.meshes.size();
+		processRangeParallel(numMeshes, 1, [&](UINT32 startIdx, UINT32 endIdx)
 		{
-			UINT32 numVertices = (UINT32)mesh->positions.size();
-			UINT32 numIndices = (UINT32)mesh->indices.size();
-
-			if ((options.importNormals || options.importTangents) && mesh->normals.empty())
+			for (UINT32 meshIdx = startIdx; meshIdx < endIdx; meshIdx++)
 			{
-				mesh->normals.resize(numVertices);
+				FBXImportMesh* mesh = scene.meshes[meshIdx];
+				UINT32 numVertices = (UINT32)mesh->positions.size();
+				UINT32 numIndices = (UINT32)mesh->indices.size();
 
-				MeshUtility::calculateNormals(mesh->positions.data(), (UINT8*)mesh->indices.data(), numVertices, numIndices, mesh->normals.data());
-			}
+				if ((options.importNormals || options.importTangents) && mesh->normals.empty())
+				{
+					mesh->normals.resize(numVertices);
 
-			if (options.importTangents && !mesh->UV[0].empty() && (mesh->tangents.empty() || mesh->bitangents.empty()))
-			{
-				mesh->tangents.resize(numVertices);
-				mesh->bitangents.resize(numVertices);
+					MeshUtility::calculateNormals(mesh->positions.data(), (UINT8*)mesh->indices.data(), numVertices, numIndices, mesh->normals.data());
+				}
 
-				MeshUtility::calculateTangents(mesh->positions.data(), mesh->normals.data(), mesh->UV[0].data(), (UINT8*)mesh->indices.data(), 
-					numVertices, numIndices, mesh->tangents.data(), mesh->bitangents.data());
-			}
+				if (options.importTangents && !mesh->UV[0].empty() && (mesh->tangents.empty() || mesh->bitangents.empty()))
+				{
+					mesh->tangents.resize(numVertices);
+					mesh->bitangents.resize(numVertices);
 
-			for (auto& shape : mesh->blendShapes)
-			{
-				for (auto& frame : shape.frames)
+					MeshUtility::calculateTangents(mesh->positions.data(), mesh->normals.data(), mesh->UV[0].data(), (UINT8*)mesh->indices.data(),
+						numVertices, numIndices, mesh->tangents.data(), mesh->bitangents.data());
+				}
+
+				for (auto& shape : mesh->blendShapes)
 				{
-					if ((options.importNormals || options.importTangents) && frame.normals.empty())
+					for (auto& frame : shape.frames)
 					{
-						frame.normals.resize(numVertices);
+						if ((options.importNormals || options.importTangents) && frame.normals.empty())
+						{
+							frame.normals.resize(numVertices);
 
-						MeshUtility::calculateNormals(mesh->positions.data(), (UINT8*)mesh->indices.data(), numVertices, numIndices, frame.normals.data());
-					}
+							MeshUtility::calculateNormals(mesh->positions.data(), (UINT8*)mesh->indices.data(), numVertices, numIndices, frame.normals.data());
+						}
 
-					if (options.importTangents && !mesh->UV[0].empty() && (frame.tangents.empty() || frame.bitangents.empty()))
-					{
-						frame.tangents.resize(numVertices);
-						frame.bitangents.resize(numVertices);
+						if (options.importTangents && !mesh->UV[0].empty() && (frame.tangents.empty() || frame.bitangents.empty()))
+						{
+							frame.tangents.resize(numVertices);
+							frame.bitangents.resize(numVertices);
 
-						MeshUtility::calculateTangents(mesh->positions.data(), frame.normals.data(), mesh->UV[0].data(), (UINT8*)mesh->indices.data(),
-							numVertices, numIndices, frame.tangents.data(), frame.bitangents.data());
+							MeshUtility::calculateTangents(mesh->positions.data(), frame.normals.data(), mesh->UV[0].data(), (UINT8*)mesh->indices.data(),
+								numVertices, numIndices, frame.tangents.data(), frame.bitangents.data());
+						}
 					}
 				}
 			}
-		}
+		});
 	}
 
 	void FBXImporter::importAnimations(FbxScene* scene, FBXImportOptions& importOptions, FBXImportScene& importScene)
@@ -7,6 +7,7 @@
 #include "Image/BsTextureAtlasLayout.h"
 #include "BsCoreApplication.h"
 #include "CoreThread/BsCoreThread.h"
+#include "Math/BsMath.h"
 
 #include <ft2build.h>
 #include <freetype/freetype.h>
@@ -17,6 +18,86 @@ using namespace std::placeholders;
 
 namespace bs
 {
+	/**
+	 * Calculates an approximate distance from every pixel of a binary image to the nearest pixel with the specified
+	 * value, using a two-pass 3-4 chamfer distance transform. Output distances are in pixels.
+	 */
+	static void calcChamferDistance(const Vector<UINT8>& binary, UINT32 width, UINT32 height, UINT8 targetValue,
+		Vector<float>& distances)
+	{
+		const float MAX_DIST = 1e10f;
+		const float ORTHO_DIST = 3.0f;
+		const float DIAG_DIST = 4.0f;
+
+		distances.assign(width * height, MAX_DIST);
+		for (UINT32 i = 0; i < width * height; i++)
+		{
+			if (binary[i] == targetValue)
+				distances[i] = 0.0f;
+		}
+
+		// Forward pass (top-left to bottom-right)
+		for (UINT32 y = 0; y < height; y++)
+		{
+			for (UINT32 x = 0; x < width; x++)
+			{
+				UINT32 idx = y * width + x;
+				float dist = distances[idx];
+
+				if (x > 0)
+					dist = std::min(dist, distances[idx - 1] + ORTHO_DIST);
+
+				if (y > 0)
+				{
+					dist = std::min(dist, distances[idx - width] + ORTHO_DIST);
+
+					if (x > 0)
+						dist = std::min(dist, distances[idx - width - 1] + DIAG_DIST);
+
+					if (x < width - 1)
+						dist = std::min(dist, distances[idx - width + 1] + DIAG_DIST);
+				}
+
+				distances[idx] = dist;
+			}
+		}
+
+		// Backward pass (bottom-right to top-left)
+		for (UINT32 y = height; y > 0;)
+		{
+			y--;
+
+			for (UINT32 x = width; x > 0;)
+			{
+				x--;
+
+				UINT32 idx = y * width + x;
+				float dist = distances[idx];
+
+				if (x < width - 1)
+					dist = std::min(dist, distances[idx + 1] + ORTHO_DIST);
+
+				if (y < height - 1)
+				{
+					dist = std::min(dist, distances[idx + width] + ORTHO_DIST);
+
+					if (x < width - 1)
+						dist = std::min(dist, distances[idx + width + 1] + DIAG_DIST);
+
+					if (x > 0)
+						dist = std::min(dist, distances[idx + width - 1] + DIAG_DIST);
+				}
+
+				distances[idx] = dist;
+			}
+		}
+
+		// Chamfer weights are integer approximations of 1 and sqrt(2), scaled by the orthogonal step cost
+		const float invScale = 1.0f / ORTHO_DIST;
+		for (auto& dist : distances)
+			dist *= invScale;
+	}
+
 	FontImporter::FontImporter()
 		:SpecificImporter() 
 	{
@@ -95,6 +176,19 @@ namespace bs
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
+		// Distance field import renders glyphs only once, at the largest requested size, and shares the generated
+		// texture pages between all sizes. Render mode options don't apply as the source rasterization is always binary.
+		if (fontImportOptions->getSDF())
+		{
+			Vector<SPtr<FontBitmap>> dataPerSize = importSDF(face, charIndexRanges, fontSizes, dpi);
+			SPtr<Font> newFont = Font::_createPtr(dataPerSize);
+
+			FT_Done_FreeType(library);
+
+			newFont->setName(filePath.getFilename(false));
+			return newFont;
+		}
+
 		Vector<SPtr<FontBitmap>> dataPerSize;
 		for(size_t i = 0; i < fontSizes.size(); i++)
 		{
@@ -372,4 +466,322 @@ namespace bs
 
 		return newFont;
 	}
+
+	Vector<SPtr<FontBitmap>> FontImporter::importSDF(FT_FaceRec_* face,
+		const Vector<std::pair<UINT32, UINT32>>& charIndexRanges, const Vector<UINT32>& fontSizes, UINT32 dpi) const
+	{
+		UINT32 refSize = 0;
+		for (auto& size : fontSizes)
+			refSize = std::max(refSize, size);
+
+		if (refSize == 0)
+			return Vector<SPtr<FontBitmap>>();
+
+		// Glyphs are rasterized upscaled and without anti-aliasing so the distance transform operates on clean binary
+		// coverage with sub-(output-)pixel precision
+		const FT_Int32 loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(refSize * SDF_UPSCALE * (1 << 6));
+		if (FT_Set_Char_Size(face, ftSize, 0, dpi, dpi))
+			BS_EXCEPT(InternalErrorException, "Could not set character size.");
+
+		/** Baked distance field and metrics for a single glyph, at the reference size. */
+		struct SDFGlyph
+		{
+			UINT32 charId;
+			UINT32 width, height; // Output cell size, including SDF_SPREAD padding on all sides
+			INT32 xOffset, yOffset;
+			INT32 xAdvance, yAdvance;
+			INT32 horiBearingY;
+			UINT32 glyphHeight; // Glyph height without the padding
+			Vector<UINT8> pixels;
+		};
+
+		Vector<SDFGlyph> glyphs;
+
+		FT_Error error = 0;
+		auto bakeGlyph = [&](UINT32 charIdx, bool isMissingGlyph)
+		{
+			if (!isMissingGlyph)
+				error = FT_Load_Char(face, (FT_ULong)charIdx, loadFlags);
+			else
+				error = FT_Load_Glyph(face, 0, loadFlags);
+
+			if (error)
+				BS_EXCEPT(InternalErrorException, "Failed to load a character");
+
+			error = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO);
+
+			if (error)
+				BS_EXCEPT(InternalErrorException, "Failed to render a character");
+
+			FT_GlyphSlot slot = face->glyph;
+
+			if (slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
+				BS_EXCEPT(InternalErrorException, "Failed to render glyph bitmap");
+
+			const UINT32 srcWidth = (UINT32)slot->bitmap.width;
+			const UINT32 srcHeight = (UINT32)slot->bitmap.rows;
+
+			// High resolution grid with enough border for the distance field to fully fade out
+			const UINT32 padding = SDF_SPREAD * SDF_UPSCALE;
+			const UINT32 gridWidth = srcWidth + padding * 2;
+			const UINT32 gridHeight = srcHeight + padding * 2;
+
+			Vector<UINT8> binary(gridWidth * gridHeight, 0);
+			for (UINT32 y = 0; y < srcHeight; y++)
+			{
+				const UINT8* srcRow = slot->bitmap.buffer + y * slot->bitmap.pitch;
+				UINT8* dstRow = binary.data() + (padding + y) * gridWidth + padding;
+
+				// 8 pixels are packed into a byte, so do some unpacking
+				for (UINT32 x = 0; x < srcWidth; x++)
+					dstRow[x] = (srcRow[x >> 3] & (128 >> (x & 7))) != 0 ? 1 : 0;
+			}
+
+			Vector<float> distToInside;
+			Vector<float> distToOutside;
+			calcChamferDistance(binary, gridWidth, gridHeight, 1, distToInside);
+			calcChamferDistance(binary, gridWidth, gridHeight, 0, distToOutside);
+
+			SDFGlyph glyph;
+			glyph.charId = charIdx;
+			glyph.width = Math::divideAndRoundUp(srcWidth, SDF_UPSCALE) + SDF_SPREAD * 2;
+			glyph.height = Math::divideAndRoundUp(srcHeight, SDF_UPSCALE) + SDF_SPREAD * 2;
+			glyph.xOffset = Math::roundToInt((slot->bitmap_left) / (float)SDF_UPSCALE) - (INT32)SDF_SPREAD;
+			glyph.yOffset = Math::roundToInt((slot->bitmap_top) / (float)SDF_UPSCALE) + (INT32)SDF_SPREAD;
+			glyph.xAdvance = Math::roundToInt((slot->advance.x >> 6) / (float)SDF_UPSCALE);
+			glyph.yAdvance = Math::roundToInt((slot->advance.y >> 6) / (float)SDF_UPSCALE);
+			glyph.horiBearingY = Math::roundToInt((slot->metrics.horiBearingY >> 6) / (float)SDF_UPSCALE);
+			glyph.glyphHeight = Math::divideAndRoundUp(srcHeight, SDF_UPSCALE);
+			glyph.pixels.resize(glyph.width * glyph.height);
+
+			// Sample the high resolution field at output pixel centers, mapping the edge to 0.5 and the extremes of
+			// the spread range to 0 and 1
+			const float invRange = 1.0f / (2.0f * SDF_SPREAD * SDF_UPSCALE);
+			for (UINT32 y = 0; y < glyph.height; y++)
+			{
+				for (UINT32 x = 0; x < glyph.width; x++)
+				{
+					UINT32 srcX = std::min(x * SDF_UPSCALE + SDF_UPSCALE / 2, gridWidth - 1);
+					UINT32 srcY = std::min(y * SDF_UPSCALE + SDF_UPSCALE / 2, gridHeight - 1);
+
+					UINT32 srcIdx = srcY * gridWidth + srcX;
+					float signedDist = binary[srcIdx] != 0 ? distToOutside[srcIdx] : -distToInside[srcIdx];
+
+					float value = Math::clamp01(0.5f + signedDist * invRange);
+					glyph.pixels[y * glyph.width + x] = (UINT8)(value * 255.0f + 0.5f);
+				}
+			}
+
+			glyphs.push_back(std::move(glyph));
+		};
+
+		for (auto& range : charIndexRanges)
+		{
+			for (UINT32 charIdx = range.first; charIdx <= range.second; charIdx++)
+				bakeGlyph(charIdx, false);
+		}
+
+		// Add missing glyph (always the last element)
+		bakeGlyph(0, true);
+
+		// Create an optimal layout for the glyph distance fields
+		Vector<TextureAtlasUtility::Element> atlasElements;
+		for (auto& glyph : glyphs)
+		{
+			TextureAtlasUtility::Element atlasElement;
+			atlasElement.input.width = glyph.width;
+			atlasElement.input.height = glyph.height;
+
+			atlasElements.push_back(atlasElement);
+		}
+
+		Vector<TextureAtlasUtility::Page> pages = TextureAtlasUtility::createAtlasLayout(atlasElements, 64, 64,
+			MAXIMUM_TEXTURE_SIZE, MAXIMUM_TEXTURE_SIZE, true);
+
+		SPtr<FontBitmap> refBitmap = bs_shared_ptr_new<FontBitmap>();
+		refBitmap->size = refSize;
+		refBitmap->isSDF = true;
+
+		INT32 baselineOffset = 0;
+		UINT32 lineHeight = 0;
+
+		UINT32 pageIdx = 0;
+		for (auto pageIter = pages.begin(); pageIter != pages.end(); ++pageIter)
+		{
+			UINT32 bufferSize = pageIter->width * pageIter->height * 2;
+
+			SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(pageIter->width, pageIter->height, 1, PF_RG8);
+
+			pixelData->allocateInternalBuffer();
+			UINT8* pixelBuffer = pixelData->getData();
+			memset(pixelBuffer, 0, bufferSize);
+
+			for (size_t i = 0; i < atlasElements.size(); i++)
+			{
+				if (atlasElements[i].output.page != (INT32)pageIdx)
+					continue;
+
+				TextureAtlasUtility::Element curElement = atlasElements[i];
+				UINT32 elementIdx = curElement.output.idx;
+				const SDFGlyph& glyph = glyphs[elementIdx];
+
+				bool isMissingGlypth = elementIdx == (atlasElements.size() - 1); // It's always the last element
+
+				// Copy the glyph distance field
+				const UINT8* sourceBuffer = glyph.pixels.data();
+				UINT8* dstBuffer = pixelBuffer + (curElement.output.y * pageIter->width * 2) + curElement.output.x * 2;
+				for (UINT32 row = 0; row < glyph.height; row++)
+				{
+					for (UINT32 column = 0; column < glyph.width; column++)
+					{
+						dstBuffer[column * 2 + 0] = sourceBuffer[column];
+						dstBuffer[column * 2 + 1] = sourceBuffer[column];
+					}
+
+					dstBuffer += pageIter->width * 2;
+					sourceBuffer += glyph.width;
+				}
+
+				// Store character information
+				CharDesc charDesc;
+
+				float invTexWidth = 1.0f / pageIter->width;
+				float invTexHeight = 1.0f / pageIter->height;
+
+				charDesc.charId = glyph.charId;
+				charDesc.width = glyph.width;
+				charDesc.height = glyph.height;
+				charDesc.page = curElement.output.page;
+				charDesc.uvWidth = invTexWidth * glyph.width;
+				charDesc.uvHeight = invTexHeight * glyph.height;
+				charDesc.uvX = invTexWidth * curElement.output.x;
+				charDesc.uvY = invTexHeight * curElement.output.y;
+				charDesc.xOffset = glyph.xOffset;
+				charDesc.yOffset = glyph.yOffset;
+				charDesc.xAdvance = glyph.xAdvance;
+				charDesc.yAdvance = glyph.yAdvance;
+
+				baselineOffset = std::max(baselineOffset, glyph.horiBearingY);
+				lineHeight = std::max(lineHeight, glyph.glyphHeight);
+
+				// Load kerning and store char
+				if (!isMissingGlypth)
+				{
+					FT_Vector resultKerning;
+					for (auto kerningIter = charIndexRanges.begin(); kerningIter != charIndexRanges.end(); ++kerningIter)
+					{
+						for (UINT32 kerningCharIdx = kerningIter->first; kerningCharIdx <= kerningIter->second; kerningCharIdx++)
+						{
+							if (kerningCharIdx == glyph.charId)
+								continue;
+
+							error = FT_Get_Kerning(face, glyph.charId, kerningCharIdx, FT_KERNING_DEFAULT, &resultKerning);
+
+							if (error)
+								BS_EXCEPT(InternalErrorException, "Failed to get kerning information for character: " + toString(glyph.charId));
+
+							INT32 kerningX = Math::roundToInt((resultKerning.x >> 6) / (float)SDF_UPSCALE);
+							if (kerningX == 0) // We don't store 0 kerning, this is assumed default
+								continue;
+
+							KerningPair pair;
+							pair.amount = kerningX;
+							pair.otherCharId = kerningCharIdx;
+
+							charDesc.kerningPairs.push_back(pair);
+						}
+					}
+
+					refBitmap->characters[glyph.charId] = charDesc;
+				}
+				else
+				{
+					refBitmap->missingGlyph = charDesc;
+				}
+			}
+
+			TEXTURE_DESC texDesc;
+			texDesc.width = pageIter->width;
+			texDesc.height = pageIter->height;
+			texDesc.format = PF_RG8;
+
+			HTexture newTex = Texture::create(texDesc);
+
+			// It's possible the formats no longer match
+			if (newTex->getProperties().getFormat() != pixelData->getFormat())
+			{
+				SPtr<PixelData> temp = newTex->getProperties().allocBuffer(0, 0);
+				PixelUtil::bulkPixelConversion(*pixelData, *temp);
+
+				newTex->writeData(temp);
+			}
+			else
+			{
+				newTex->writeData(pixelData);
+			}
+
+			newTex->setName(u8"FontPage" + toString((UINT32)refBitmap->texturePages.size()));
+
+			refBitmap->texturePages.push_back(newTex);
+			pageIdx++;
+		}
+
+		refBitmap->baselineOffset = baselineOffset;
+		refBitmap->lineHeight = lineHeight;
+
+		// Get space size
+		error = FT_Load_Char(face, 32, loadFlags);
+
+		if (error)
+			BS_EXCEPT(InternalErrorException, "Failed to load a character");
+
+		refBitmap->spaceWidth = Math::roundToInt((face->glyph->advance.x >> 6) / (float)SDF_UPSCALE);
+
+		// All sizes share the same distance field pages, only the metrics get scaled
+		Vector<SPtr<FontBitmap>> dataPerSize;
+		for (auto& size : fontSizes)
+		{
+			if (size == refSize)
+			{
+				dataPerSize.push_back(refBitmap);
+				continue;
+			}
+
+			float scale = size / (float)refSize;
+
+			auto scaleCharDesc = [scale](const CharDesc& desc)
+			{
+				CharDesc scaled = desc;
+				scaled.width = (UINT32)std::max(1, Math::roundToInt(desc.width * scale));
+				scaled.height = (UINT32)std::max(1, Math::roundToInt(desc.height * scale));
+				scaled.xOffset = Math::roundToInt(desc.xOffset * scale);
+				scaled.yOffset = Math::roundToInt(desc.yOffset * scale);
+				scaled.xAdvance = Math::roundToInt(desc.xAdvance * scale);
+				scaled.yAdvance = Math::roundToInt(desc.yAdvance * scale);
+
+				for (auto& pair : scaled.kerningPairs)
+					pair.amount = Math::roundToInt(pair.amount * scale);
+
+				return scaled;
+			};
+
+			SPtr<FontBitmap> fontData = bs_shared_ptr_new<FontBitmap>();
+			fontData->size = size;
+			fontData->isSDF = true;
+			fontData->texturePages = refBitmap->texturePages;
+			fontData->baselineOffset = Math::roundToInt(refBitmap->baselineOffset * scale);
+			fontData->lineHeight = (UINT32)std::max(1, Math::roundToInt(refBitmap->lineHeight * scale));
+			fontData->spaceWidth = (UINT32)std::max(0, Math::roundToInt(refBitmap->spaceWidth * scale));
+			fontData->missingGlyph = scaleCharDesc(refBitmap->missingGlyph);
+
+			for (auto& entry : refBitmap->characters)
+				fontData->characters[entry.first] = scaleCharDesc(entry.second);
+
+			dataPerSize.push_back(fontData);
+		}
+
+		return dataPerSize;
+	}
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "Importer/BsSpecificImporter.h"
 #include "Importer/BsImporter.h"
 
+struct FT_FaceRec_;
+
 namespace bs
 {
 	/** @addtogroup Font
@@ -31,9 +33,19 @@ namespace bs
 		/** @copydoc SpecificImporter::createImportOptions */
 		SPtr<ImportOptions> createImportOptions() const override;
 	private:
+		/**
+		 * Imports the requested font sizes as signed distance fields. Glyphs are baked just once, at the largest
+		 * requested size, and every size shares the resulting texture pages with only the character metrics differing.
+		 */
+		Vector<SPtr<FontBitmap>> importSDF(FT_FaceRec_* face, const Vector<std::pair<UINT32, UINT32>>& charIndexRanges,
+			const Vector<UINT32>& fontSizes, UINT32 dpi) const;
+
 		Vector<String> mExtensions;
 
 		const static int MAXIMUM_TEXTURE_SIZE = 2048;
+
+		const static UINT32 SDF_UPSCALE = 8;
+		const static UINT32 SDF_SPREAD = 4;
 	};
 
 	/** @} */
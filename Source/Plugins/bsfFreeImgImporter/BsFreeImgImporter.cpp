@@ -206,7 +206,18 @@ namespace bs
 			{
 				SPtr<PixelData> dst = newTexture->getProperties().allocBuffer(0, mip);
 
-				PixelUtil::bulkPixelConversion(*mipLevels[mip], *dst);
+				if (PixelUtil::isCompressed(texDesc.format))
+				{
+					CompressionOptions compressionOptions;
+					compressionOptions.format = texDesc.format;
+					compressionOptions.isSRGB = sRGB;
+					compressionOptions.quality = textureImportOptions->getCompressionQuality();
+
+					PixelUtil::compress(*mipLevels[mip], *dst, compressionOptions);
+				}
+				else
+					PixelUtil::bulkPixelConversion(*mipLevels[mip], *dst);
+
 				newTexture->writeData(dst, i, mip);
 			}
 		}
@@ -7,13 +7,13 @@
 namespace bs { namespace ct
 {
 	GLBuffer::GLBuffer()
-		:mTarget(0), mBufferId(0), mZeroLocked(false)
+		:mTarget(0), mBufferId(0), mUsage(GBU_STATIC), mZeroLocked(false)
 	{
-		
+
 	}
 
 	GLBuffer::GLBuffer(GLenum target, UINT32 size, GpuBufferUsage usage)
-		:mTarget(target), mBufferId(0), mZeroLocked(false)
+		:mTarget(target), mBufferId(0), mUsage(usage), mZeroLocked(false)
 	{
 		initialize(target, size, usage);
 	}
@@ -32,6 +32,7 @@ namespace bs { namespace ct
 		assert(mBufferId == 0 && "Buffer already initialized");
 
 		mTarget = target;
+		mUsage = usage;
 
 		glGenBuffers(1, &mBufferId);
 		BS_CHECK_GL_ERROR();
@@ -124,6 +125,15 @@ namespace bs { namespace ct
 		if(mBufferId == 0)
 			return;
 
+		// Dynamic buffers are updated often, so route their writes through the persistently mapped upload ring when
+		// available, avoiding a map/unmap call into the driver per write
+		if((mUsage & GBU_DYNAMIC) != 0)
+		{
+			GLHardwareBufferManager& manager = static_cast<GLHardwareBufferManager&>(HardwareBufferManager::instance());
+			if (manager.getUploadRing().write(mBufferId, offset, length, pSource))
+				return;
+		}
+
 		GpuLockOptions lockOption = GBL_WRITE_ONLY;
 		if (writeFlags == BWT_DISCARD)
 			lockOption = GBL_WRITE_ONLY_DISCARD;
@@ -80,6 +80,7 @@ namespace bs { namespace ct
 	private:
 		GLenum mTarget;
 		GLuint mBufferId;
+		GpuBufferUsage mUsage;
 
 		bool mZeroLocked;
 	};
@@ -0,0 +1,134 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGLBufferUploadRing.h"
+
+namespace bs { namespace ct
+{
+	GLBufferUploadRing::~GLBufferUploadRing()
+	{
+		for (UINT32 i = 0; i < NUM_SEGMENTS; i++)
+		{
+			if (mSegmentFences[i] != nullptr)
+			{
+				glDeleteSync(mSegmentFences[i]);
+				BS_CHECK_GL_ERROR();
+			}
+		}
+
+		if (mBufferId != 0)
+		{
+			glBindBuffer(GL_COPY_READ_BUFFER, mBufferId);
+			BS_CHECK_GL_ERROR();
+
+			glUnmapBuffer(GL_COPY_READ_BUFFER);
+			BS_CHECK_GL_ERROR();
+
+			glDeleteBuffers(1, &mBufferId);
+			BS_CHECK_GL_ERROR();
+		}
+	}
+
+	void GLBufferUploadRing::initialize()
+	{
+		mInitialized = true;
+
+#if BS_OPENGL_4_4
+		if (!GLEW_ARB_buffer_storage)
+			return;
+
+		glGenBuffers(1, &mBufferId);
+		BS_CHECK_GL_ERROR();
+
+		glBindBuffer(GL_COPY_READ_BUFFER, mBufferId);
+		BS_CHECK_GL_ERROR();
+
+		const GLbitfield accessFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glBufferStorage(GL_COPY_READ_BUFFER, RING_SIZE, nullptr, accessFlags);
+		BS_CHECK_GL_ERROR();
+
+		mMappedData = (UINT8*)glMapBufferRange(GL_COPY_READ_BUFFER, 0, RING_SIZE, accessFlags);
+		BS_CHECK_GL_ERROR();
+
+		if (mMappedData == nullptr)
+		{
+			glDeleteBuffers(1, &mBufferId);
+			BS_CHECK_GL_ERROR();
+
+			mBufferId = 0;
+		}
+#endif
+	}
+
+	bool GLBufferUploadRing::write(GLuint dstBufferId, UINT32 dstOffset, UINT32 length, const void* source)
+	{
+		if (!mInitialized)
+			initialize();
+
+		if (mBufferId == 0 || length == 0 || length > SEGMENT_SIZE)
+			return false;
+
+		UINT32 offset = (mWriteOffset + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1);
+		if (offset + length > RING_SIZE)
+			offset = 0;
+
+		// Keep each write within a single segment, so a segment can be fenced as soon as the write head leaves it
+		UINT32 segment = offset / SEGMENT_SIZE;
+		if (segment != (offset + length - 1) / SEGMENT_SIZE)
+		{
+			offset = (segment + 1) * SEGMENT_SIZE;
+			segment = segment + 1;
+		}
+
+		advanceTo(segment);
+
+		memcpy(mMappedData + offset, source, length);
+
+		// Mapping is coherent so the memcpy needs no explicit flush before the copy below
+		glBindBuffer(GL_COPY_READ_BUFFER, mBufferId);
+		BS_CHECK_GL_ERROR();
+
+		glBindBuffer(GL_COPY_WRITE_BUFFER, dstBufferId);
+		BS_CHECK_GL_ERROR();
+
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, dstOffset, length);
+		BS_CHECK_GL_ERROR();
+
+		mWriteOffset = offset + length;
+		return true;
+	}
+
+	void GLBufferUploadRing::advanceTo(UINT32 segment)
+	{
+		while (mHeadSegment != segment)
+		{
+			// All copies sourcing the segment we're leaving have been issued, so the fence covers them all
+			if (mSegmentFences[mHeadSegment] != nullptr)
+			{
+				glDeleteSync(mSegmentFences[mHeadSegment]);
+				BS_CHECK_GL_ERROR();
+			}
+
+			mSegmentFences[mHeadSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			BS_CHECK_GL_ERROR();
+
+			mHeadSegment = (mHeadSegment + 1) % NUM_SEGMENTS;
+
+			GLsync& fence = mSegmentFences[mHeadSegment];
+			if (fence != nullptr)
+			{
+				GLenum result;
+				do
+				{
+					result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+					BS_CHECK_GL_ERROR();
+				} while (result == GL_TIMEOUT_EXPIRED);
+
+				glDeleteSync(fence);
+				BS_CHECK_GL_ERROR();
+
+				fence = nullptr;
+			}
+		}
+	}
+}}
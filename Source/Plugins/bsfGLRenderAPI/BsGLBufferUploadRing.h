@@ -0,0 +1,66 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsGLPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup GL
+	 *  @{
+	 */
+
+	/**
+	 * Ring buffer kept persistently mapped in write-combined memory, used as a staging area for uploads into dynamic
+	 * hardware buffers. Writes become a plain memcpy into the mapped memory followed by a GPU-side copy into the
+	 * destination buffer, avoiding a map/unmap round-trip into the driver for every update. The ring is split into
+	 * segments guarded by fence sync objects so memory isn't overwritten while the GPU is still reading from it.
+	 *
+	 * Requires the GL_ARB_buffer_storage extension. If the extension isn't available all writes report failure and the
+	 * caller is expected to fall back to mapping the destination buffer directly.
+	 */
+	class GLBufferUploadRing
+	{
+	public:
+		GLBufferUploadRing() = default;
+		~GLBufferUploadRing();
+
+		/**
+		 * Copies the provided memory into the ring buffer and schedules a GPU copy into the destination buffer.
+		 * Must be executed on the core thread, with a GL context active.
+		 *
+		 * @param[in]	dstBufferId		Internal ID of the OpenGL buffer to write the data into.
+		 * @param[in]	dstOffset		Offset into the destination buffer to write the data at, in bytes.
+		 * @param[in]	length			Size of the data to write, in bytes.
+		 * @param[in]	source			Source buffer containing the data to write.
+		 * @return						True if the write was performed. False if the extension is unsupported or the
+		 *								write is too large for the ring, in which case the caller must write the data
+		 *								some other way.
+		 */
+		bool write(GLuint dstBufferId, UINT32 dstOffset, UINT32 length, const void* source);
+
+	private:
+		/** Creates the ring buffer and maps it persistently. Only called once, on first write. */
+		void initialize();
+
+		/**
+		 * Moves the write head into the specified segment, fencing each segment the head leaves and waiting on the fence
+		 * guarding each segment it enters.
+		 */
+		void advanceTo(UINT32 segment);
+
+		static const UINT32 RING_SIZE = 4 * 1024 * 1024;
+		static const UINT32 NUM_SEGMENTS = 4;
+		static const UINT32 SEGMENT_SIZE = RING_SIZE / NUM_SEGMENTS;
+		static const UINT32 ALIGNMENT = 16;
+
+		bool mInitialized = false;
+		GLuint mBufferId = 0;
+		UINT8* mMappedData = nullptr;
+		UINT32 mWriteOffset = 0;
+		UINT32 mHeadSegment = 0;
+		GLsync mSegmentFences[NUM_SEGMENTS] = { };
+	};
+
+	/** @} */
+}}
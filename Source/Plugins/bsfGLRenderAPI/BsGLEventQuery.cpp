@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsGLEventQuery.h"
 #include "BsGLCommandBuffer.h"
+#include "BsGLQueryManager.h"
 #include "Profiling/BsRenderStats.h"
 
 namespace bs { namespace ct
@@ -11,16 +12,21 @@ namespace bs { namespace ct
 	{
 		assert(deviceIdx == 0 && "Multiple GPUs not supported natively on OpenGL.");
 
-		glGenQueries(1, &mQueryObj);
-		BS_CHECK_GL_ERROR();
+		mQueryObj = static_cast<GLQueryManager&>(QueryManager::instance()).allocQuery(GL_TIMESTAMP);
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
 	}
 
 	GLEventQuery::~GLEventQuery()
 	{
-		glDeleteQueries(1, &mQueryObj);
-		BS_CHECK_GL_ERROR();
+		if (QueryManager::isStarted())
+			static_cast<GLQueryManager&>(QueryManager::instance()).releaseQuery(GL_TIMESTAMP, mQueryObj);
+		else
+		{
+			// Manager (and with it the pool) is already gone, free the query object directly
+			glDeleteQueries(1, &mQueryObj);
+			BS_CHECK_GL_ERROR();
+		}
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
 	}
@@ -33,6 +39,7 @@ namespace bs { namespace ct
 			BS_CHECK_GL_ERROR();
 
 			setActive(true);
+			static_cast<GLQueryManager&>(QueryManager::instance()).markPending(this);
 		};
 
 		if (cb == nullptr)
@@ -12,16 +12,12 @@ namespace bs { namespace ct
 	GLGpuBuffer::GLGpuBuffer(const GPU_BUFFER_DESC& desc, GpuDeviceFlags deviceMask)
 		: GpuBuffer(desc, deviceMask), mTextureID(0), mFormat(0)
 	{
-		if(desc.type == GBT_INDIRECTARGUMENT)
-			LOGERR("Only standard and structured buffers are supported on OpenGL.");
-
 		if (desc.useCounter)
 			LOGERR("Buffer counters not supported on OpenGL.");
 
 		assert((deviceMask == GDF_DEFAULT || deviceMask == GDF_PRIMARY) && "Multiple GPUs not supported natively on OpenGL.");
 
-		// Note: Implement OpenGL shader storage buffers, append/consume buffers, transform feedback buffers, 
-		// indirect argument buffers and counter buffers
+		// Note: Implement OpenGL append/consume buffers, transform feedback buffers and counter buffers
 
 		mFormat = GLPixelUtil::getBufferFormat(desc.format);
 	}
@@ -47,6 +43,13 @@ namespace bs { namespace ct
 			LOGWRN("SSBOs are not supported on the current OpenGL version.");
 #endif
 		}
+		else if(mProperties.getType() == GBT_INDIRECTARGUMENT)
+		{
+			// Holds draw arguments only, so no texture view is required
+			const auto& props = getProperties();
+			UINT32 size = props.getElementCount() * props.getElementSize();
+			mBuffer.initialize(GL_DRAW_INDIRECT_BUFFER, size, props.getUsage());
+		}
 		else
 		{
 			const auto& props = getProperties();
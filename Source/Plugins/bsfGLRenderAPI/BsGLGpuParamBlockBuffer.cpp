@@ -48,12 +48,12 @@ namespace bs { namespace ct
 		GpuParamBlockBuffer::initialize();
 	}
 
-	void GLGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
+	void GLGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 offset, UINT32 size, UINT32 queueIdx)
 	{
 		glBindBuffer(GL_UNIFORM_BUFFER, mGLHandle);
 		BS_CHECK_GL_ERROR();
 
-		glBufferSubData(GL_UNIFORM_BUFFER, 0 , mSize, data);
+		glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data + offset);
 		BS_CHECK_GL_ERROR();
 
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
@@ -19,7 +19,7 @@ namespace bs { namespace ct
 		~GLGpuParamBlockBuffer();
 
 		/** @copydoc GpuParamBlockBuffer::writeToGPU */
-		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0) override;
+		void writeToGPU(const UINT8* data, UINT32 offset, UINT32 size, UINT32 queueIdx = 0) override;
 
 		/**	Returns internal OpenGL uniform buffer handle. */
 		GLuint getGLHandle() const { return mGLHandle; }
@@ -4,6 +4,7 @@
 
 #include "BsGLPrerequisites.h"
 #include "Managers/BsHardwareBufferManager.h"
+#include "BsGLBufferUploadRing.h"
 
 namespace bs { namespace ct
 {
@@ -21,6 +22,9 @@ namespace bs { namespace ct
 		/**	Converts vertex element type into OpenGL specific type. */
 		static GLenum getGLType(VertexElementType type);
 
+		/** Returns the persistently mapped ring buffer shared by all dynamic buffers for uploading data. */
+		GLBufferUploadRing& getUploadRing() { return mUploadRing; }
+
 	protected:
 		/** @copydoc HardwareBufferManager::createVertexBufferInternal */
 		SPtr<VertexBuffer> createVertexBufferInternal(const VERTEX_BUFFER_DESC& desc, 
@@ -35,8 +39,10 @@ namespace bs { namespace ct
 			GpuParamBlockUsage usage = GPBU_DYNAMIC, GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
 
 		/** @copydoc HardwareBufferManager::createGpuBufferInternal */
-		SPtr<GpuBuffer> createGpuBufferInternal(const GPU_BUFFER_DESC& desc, 
+		SPtr<GpuBuffer> createGpuBufferInternal(const GPU_BUFFER_DESC& desc,
 			GpuDeviceFlags deviceMask = GDF_DEFAULT) override;
+
+		GLBufferUploadRing mUploadRing;
 	};
 
 	/** @} */
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsGLOcclusionQuery.h"
 #include "BsGLCommandBuffer.h"
+#include "BsGLQueryManager.h"
 #include "Math/BsMath.h"
 #include "Profiling/BsRenderStats.h"
 
@@ -12,16 +13,25 @@ namespace bs { namespace ct
 	{
 		assert(deviceIdx == 0 && "Multiple GPUs not supported natively on OpenGL.");
 
-		glGenQueries(1, &mQueryObj);
-		BS_CHECK_GL_ERROR();
+		mQueryObj = static_cast<GLQueryManager&>(QueryManager::instance()).allocQuery(
+			mBinary ? GL_ANY_SAMPLES_PASSED : GL_SAMPLES_PASSED);
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
 	}
 
 	GLOcclusionQuery::~GLOcclusionQuery()
 	{
-		glDeleteQueries(1, &mQueryObj);
-		BS_CHECK_GL_ERROR();
+		if (QueryManager::isStarted())
+		{
+			static_cast<GLQueryManager&>(QueryManager::instance()).releaseQuery(
+				mBinary ? GL_ANY_SAMPLES_PASSED : GL_SAMPLES_PASSED, mQueryObj);
+		}
+		else
+		{
+			// Manager (and with it the pool) is already gone, free the query object directly
+			glDeleteQueries(1, &mQueryObj);
+			BS_CHECK_GL_ERROR();
+		}
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
 	}
@@ -56,6 +66,8 @@ namespace bs { namespace ct
 
 			mEndIssued = true;
 			mFinalized = false;
+
+			static_cast<GLQueryManager&>(QueryManager::instance()).markPending(this);
 		};
 
 		if (cb == nullptr)
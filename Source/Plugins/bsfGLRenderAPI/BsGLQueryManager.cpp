@@ -7,9 +7,25 @@
 
 namespace bs { namespace ct
 {
+	GLQueryManager::~GLQueryManager()
+	{
+		// Trigger and delete any outstanding queries now, while the pool is still around for their query objects to
+		// return to
+		processRemainingQueries();
+
+		for (auto& pool : mFreeQueries)
+		{
+			if (!pool.empty())
+			{
+				glDeleteQueries((GLsizei)pool.size(), pool.data());
+				BS_CHECK_GL_ERROR();
+			}
+		}
+	}
+
 	SPtr<EventQuery> GLQueryManager::createEventQuery(UINT32 deviceIdx) const
 	{
-		SPtr<EventQuery> query = SPtr<GLEventQuery>(bs_new<GLEventQuery>(deviceIdx), 
+		SPtr<EventQuery> query = SPtr<GLEventQuery>(bs_new<GLEventQuery>(deviceIdx),
 			&QueryManager::deleteEventQuery, StdAlloc<GLEventQuery>());
 		mEventQueries.push_back(query.get());
 
@@ -18,7 +34,7 @@ namespace bs { namespace ct
 
 	SPtr<TimerQuery> GLQueryManager::createTimerQuery(UINT32 deviceIdx) const
 	{
-		SPtr<TimerQuery> query = SPtr<GLTimerQuery>(bs_new<GLTimerQuery>(deviceIdx), 
+		SPtr<TimerQuery> query = SPtr<GLTimerQuery>(bs_new<GLTimerQuery>(deviceIdx),
 			&QueryManager::deleteTimerQuery, StdAlloc<GLTimerQuery>());
 		mTimerQueries.push_back(query.get());
 
@@ -27,10 +43,156 @@ namespace bs { namespace ct
 
 	SPtr<OcclusionQuery> GLQueryManager::createOcclusionQuery(bool binary, UINT32 deviceIdx) const
 	{
-		SPtr<OcclusionQuery> query = SPtr<GLOcclusionQuery>(bs_new<GLOcclusionQuery>(binary, deviceIdx), 
+		SPtr<OcclusionQuery> query = SPtr<GLOcclusionQuery>(bs_new<GLOcclusionQuery>(binary, deviceIdx),
 			&QueryManager::deleteOcclusionQuery, StdAlloc<GLOcclusionQuery>());
 		mOcclusionQueries.push_back(query.get());
 
 		return query;
 	}
-}}
\ No newline at end of file
+
+	void GLQueryManager::_update()
+	{
+		// Drop pending entries for queries that were queued for deletion since the last update
+		for (auto& query : mDeletedEventQueries)
+			unregisterPending(query);
+
+		for (auto& query : mDeletedTimerQueries)
+			unregisterPending(query);
+
+		for (auto& query : mDeletedOcclusionQueries)
+			unregisterPending(query);
+
+		// GL queries complete in the order they were issued, so walk the pending list and stop at the first entry the
+		// GPU hasn't finished. This resolves every completed query while checking availability of at most one
+		// unfinished query, instead of polling every outstanding query each frame.
+		UINT32 numResolved = 0;
+		for (; numResolved < (UINT32)mPendingQueries.size(); numResolved++)
+		{
+			const PendingQuery& entry = mPendingQueries[numResolved];
+
+			bool resolved = false;
+			switch (entry.type)
+			{
+			case PendingQueryType::Event:
+			{
+				auto query = (EventQuery*)entry.query;
+				if (!isQueryActive(query))
+					resolved = true;
+				else if (query->isReady())
+				{
+					query->onTriggered();
+					setQueryActive(query, false);
+
+					resolved = true;
+				}
+			}
+				break;
+			case PendingQueryType::Timer:
+			{
+				auto query = (TimerQuery*)entry.query;
+				if (!isQueryActive(query))
+					resolved = true;
+				else if (query->isReady())
+				{
+					query->onTriggered(query->getTimeMs());
+					setQueryActive(query, false);
+
+					resolved = true;
+				}
+			}
+				break;
+			case PendingQueryType::Occlusion:
+			{
+				auto query = (OcclusionQuery*)entry.query;
+				if (!isQueryActive(query))
+					resolved = true;
+				else if (query->isReady())
+				{
+					query->onComplete(query->getNumSamples());
+					setQueryActive(query, false);
+
+					resolved = true;
+				}
+			}
+				break;
+			}
+
+			if (!resolved)
+				break;
+		}
+
+		if (numResolved > 0)
+			mPendingQueries.erase(mPendingQueries.begin(), mPendingQueries.begin() + numResolved);
+
+		processDeletedQueue();
+	}
+
+	GLuint GLQueryManager::allocQuery(GLenum type)
+	{
+		Vector<GLuint>& pool = mFreeQueries[poolIdx(type)];
+		if (pool.empty())
+		{
+			GLuint queries[QUERY_BATCH_SIZE];
+			glGenQueries(QUERY_BATCH_SIZE, queries);
+			BS_CHECK_GL_ERROR();
+
+			pool.insert(pool.end(), queries, queries + QUERY_BATCH_SIZE);
+		}
+
+		GLuint query = pool.back();
+		pool.pop_back();
+
+		return query;
+	}
+
+	void GLQueryManager::releaseQuery(GLenum type, GLuint query)
+	{
+		mFreeQueries[poolIdx(type)].push_back(query);
+	}
+
+	void GLQueryManager::markPending(EventQuery* query)
+	{
+		registerPending(PendingQueryType::Event, query);
+	}
+
+	void GLQueryManager::markPending(TimerQuery* query)
+	{
+		registerPending(PendingQueryType::Timer, query);
+	}
+
+	void GLQueryManager::markPending(OcclusionQuery* query)
+	{
+		registerPending(PendingQueryType::Occlusion, query);
+	}
+
+	UINT32 GLQueryManager::poolIdx(GLenum type)
+	{
+		switch (type)
+		{
+		default:
+		case GL_SAMPLES_PASSED:
+			return 0;
+		case GL_ANY_SAMPLES_PASSED:
+			return 1;
+		case GL_TIMESTAMP:
+			return 2;
+		}
+	}
+
+	void GLQueryManager::unregisterPending(void* query)
+	{
+		auto iterFind = std::find_if(mPendingQueries.begin(), mPendingQueries.end(),
+			[&](const PendingQuery& entry) { return entry.query == query; });
+
+		if (iterFind != mPendingQueries.end())
+			mPendingQueries.erase(iterFind);
+	}
+
+	void GLQueryManager::registerPending(PendingQueryType type, void* query)
+	{
+		// A re-issued query supersedes its previous pending entry
+		unregisterPending(query);
+
+		mPendingQueries.push_back({ type, query });
+	}
+}}
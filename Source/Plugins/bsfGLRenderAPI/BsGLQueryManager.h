@@ -15,6 +15,8 @@ namespace bs { namespace ct
 	class GLQueryManager : public QueryManager
 	{
 	public:
+		~GLQueryManager();
+
 		/** @copydoc QueryManager::createEventQuery */
 		SPtr<EventQuery> createEventQuery(UINT32 deviceIdx = 0) const override;
 
@@ -23,7 +25,67 @@ namespace bs { namespace ct
 
 		/** @copydoc QueryManager::createOcclusionQuery */
 		SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const override;
+
+		/** @copydoc QueryManager::_update */
+		void _update() override;
+
+		/**
+		 * Returns an unused query object of the specified type (e.g. GL_SAMPLES_PASSED), generating a new batch of
+		 * objects if the pool is empty. OpenGL query objects become typed on first use, so a separate pool is kept per
+		 * query type.
+		 */
+		GLuint allocQuery(GLenum type);
+
+		/** Returns a query object previously acquired through allocQuery() to the pool, allowing it to be reused. */
+		void releaseQuery(GLenum type, GLuint query);
+
+		/**
+		 * Registers a query whose result is now pending on the GPU. Called when the query is fully issued (e.g. on
+		 * end()). Queries complete in the order they were issued, which allows _update() to resolve all completed
+		 * queries by walking the pending list and stopping at the first entry the GPU hasn't finished.
+		 */
+		void markPending(EventQuery* query);
+
+		/** @copydoc markPending(EventQuery*) */
+		void markPending(TimerQuery* query);
+
+		/** @copydoc markPending(EventQuery*) */
+		void markPending(OcclusionQuery* query);
+
+	private:
+		/** Type of query stored in a PendingQuery entry. */
+		enum class PendingQueryType
+		{
+			Event,
+			Timer,
+			Occlusion
+		};
+
+		/** Entry in the issue-ordered list of queries awaiting their results. */
+		struct PendingQuery
+		{
+			PendingQueryType type;
+			void* query;
+		};
+
+		/** Maps a query type to an index into the query object pools. */
+		static UINT32 poolIdx(GLenum type);
+
+		/** Removes the pending entry referencing the provided query, if one exists. */
+		void unregisterPending(void* query);
+
+		/** Adds a pending entry for the provided query, replacing any existing entry for the same query. */
+		void registerPending(PendingQueryType type, void* query);
+
+		/** Number of query objects generated in one batch when a pool runs dry. */
+		static constexpr UINT32 QUERY_BATCH_SIZE = 16;
+
+		/** Number of query object pools (GL_SAMPLES_PASSED, GL_ANY_SAMPLES_PASSED, GL_TIMESTAMP). */
+		static constexpr UINT32 NUM_QUERY_POOLS = 3;
+
+		mutable Vector<GLuint> mFreeQueries[NUM_QUERY_POOLS];
+		Vector<PendingQuery> mPendingQueries;
 	};
 
 	/** @} */
-}}
\ No newline at end of file
+}}
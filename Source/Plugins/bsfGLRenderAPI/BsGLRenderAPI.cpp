@@ -1250,7 +1250,74 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
-	void GLRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ, 
+	void GLRenderAPI::drawIndexedIndirect(const SPtr<GpuBuffer>& argBuffer, UINT32 offset, UINT32 drawCount,
+		UINT32 stride, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		auto executeRef = [&](const SPtr<GpuBuffer>& argBuffer, UINT32 offset, UINT32 drawCount, UINT32 stride)
+		{
+			THROW_IF_NOT_CORE_THREAD;
+
+#if BS_OPENGL_4_3
+			if (!GLEW_ARB_multi_draw_indirect)
+			{
+				LOGWRN("Cannot draw indirect because multi-draw-indirect is not supported by the current driver.");
+				return;
+			}
+
+			if (mBoundIndexBuffer == nullptr)
+			{
+				LOGWRN("Cannot draw indexed because index buffer is not set.");
+				return;
+			}
+
+			if (argBuffer->getProperties().getType() != GBT_INDIRECTARGUMENT)
+			{
+				LOGWRN("Cannot draw indirect because the provided buffer is not an indirect argument buffer.");
+				return;
+			}
+
+			// Find the correct type to render
+			GLint primType = getGLDrawMode();
+
+			beginDraw();
+
+			SPtr<GLIndexBuffer> indexBuffer = std::static_pointer_cast<GLIndexBuffer>(mBoundIndexBuffer);
+			const IndexBufferProperties& ibProps = indexBuffer->getProperties();
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer->getGLBufferId());
+			BS_CHECK_GL_ERROR();
+
+			GLenum indexType = (ibProps.getType() == IT_16BIT) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+			GLGpuBuffer* glArgBuffer = static_cast<GLGpuBuffer*>(argBuffer.get());
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, glArgBuffer->getGLBufferId());
+			BS_CHECK_GL_ERROR();
+
+			// First index and base vertex of each draw come from the argument entries, so the bound vertex array object
+			// requires no per-draw changes
+			glMultiDrawElementsIndirect(primType, indexType, (GLvoid*)(UINT64)offset, drawCount, stride);
+			BS_CHECK_GL_ERROR();
+
+			endDraw();
+#else
+			LOGWRN("Indirect draw is not supported on the current OpenGL version.");
+#endif
+		};
+
+		if (commandBuffer == nullptr)
+			executeRef(argBuffer, offset, drawCount, stride);
+		else
+		{
+			auto execute = [=]() { executeRef(argBuffer, offset, drawCount, stride); };
+
+			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
+			cb->queueCommand(execute);
+		}
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
+	void GLRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
@@ -2613,6 +2680,11 @@ namespace bs { namespace ct
 			caps.setNumCombinedLoadStoreTextureUnits(static_cast<UINT16>(combinedLoadStoreTextureUnits));
 		}
 
+#if BS_OPENGL_4_3
+		if (mGLSupport->checkExtension("GL_ARB_multi_draw_indirect"))
+			caps.setCapability(RSC_DRAW_INDIRECT);
+#endif
+
 		GLint combinedTexUnits;
 		glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &combinedTexUnits);
 		BS_CHECK_GL_ERROR();
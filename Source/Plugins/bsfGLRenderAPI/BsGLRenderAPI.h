@@ -69,6 +69,10 @@ namespace bs { namespace ct
 		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount
 			, UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
 
+		/** @copydoc RenderAPI::drawIndexedIndirect() */
+		void drawIndexedIndirect(const SPtr<GpuBuffer>& argBuffer, UINT32 offset, UINT32 drawCount,
+			UINT32 stride = sizeof(DrawIndexedIndirectArgs), const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
+
 		/** @copydoc RenderAPI::dispatchCompute() */
 		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1, 
 			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
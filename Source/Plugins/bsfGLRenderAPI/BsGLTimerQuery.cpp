@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsGLTimerQuery.h"
 #include "BsGLCommandBuffer.h"
+#include "BsGLQueryManager.h"
 #include "Math/BsMath.h"
 #include "Profiling/BsRenderStats.h"
 
@@ -12,24 +13,31 @@ namespace bs { namespace ct
 	{
 		assert(deviceIdx == 0 && "Multiple GPUs not supported natively on OpenGL.");
 
-		GLuint queries[2];
-		glGenQueries(2, queries);
-		BS_CHECK_GL_ERROR();
-
-		mQueryStartObj = queries[0];
-		mQueryEndObj = queries[1];
+		auto& queryManager = static_cast<GLQueryManager&>(QueryManager::instance());
+		mQueryStartObj = queryManager.allocQuery(GL_TIMESTAMP);
+		mQueryEndObj = queryManager.allocQuery(GL_TIMESTAMP);
 
 		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
 	}
 
 	GLTimerQuery::~GLTimerQuery()
 	{
-		GLuint queries[2];
-		queries[0] = mQueryStartObj;
-		queries[1] = mQueryEndObj;
+		if (QueryManager::isStarted())
+		{
+			auto& queryManager = static_cast<GLQueryManager&>(QueryManager::instance());
+			queryManager.releaseQuery(GL_TIMESTAMP, mQueryStartObj);
+			queryManager.releaseQuery(GL_TIMESTAMP, mQueryEndObj);
+		}
+		else
+		{
+			// Manager (and with it the pool) is already gone, free the query objects directly
+			GLuint queries[2];
+			queries[0] = mQueryStartObj;
+			queries[1] = mQueryEndObj;
 
-		glDeleteQueries(2, queries);
-		BS_CHECK_GL_ERROR();
+			glDeleteQueries(2, queries);
+			BS_CHECK_GL_ERROR();
+		}
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
 	}
@@ -63,6 +71,8 @@ namespace bs { namespace ct
 
 			mEndIssued = true;
 			mFinalized = false;
+
+			static_cast<GLQueryManager&>(QueryManager::instance()).markPending(this);
 		};
 
 		if (cb == nullptr)
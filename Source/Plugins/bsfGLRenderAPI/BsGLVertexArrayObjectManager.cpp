@@ -70,6 +70,39 @@ namespace bs { namespace ct
 		return !operator==(obj);
 	}
 
+	const Vector<GLint>& GLVertexArrayObjectManager::getAttribLocations(const SPtr<VertexDeclaration>& vertexDecl,
+		const SPtr<GLSLGpuProgram>& vertexProgram)
+	{
+		UINT64 key = ((UINT64)vertexDecl->getId() << 32) | vertexProgram->getGLHandle();
+
+		auto iterFind = mAttribLocations.find(key);
+		if (iterFind != mAttribLocations.end())
+			return iterFind->second;
+
+		const Vector<VertexElement>& decl = vertexDecl->getProperties().getElements();
+		const Vector<VertexElement>& inputAttributes = vertexProgram->getInputDeclaration()->getProperties().getElements();
+
+		Vector<GLint> locations;
+		locations.reserve(decl.size());
+
+		for (auto& elem : decl)
+		{
+			GLint attribLocation = -1;
+			for (auto iter = inputAttributes.begin(); iter != inputAttributes.end(); ++iter)
+			{
+				if (iter->getSemantic() == elem.getSemantic() && iter->getSemanticIdx() == elem.getSemanticIdx())
+				{
+					attribLocation = iter->getOffset();
+					break;
+				}
+			}
+
+			locations.push_back(attribLocation);
+		}
+
+		return mAttribLocations[key] = std::move(locations);
+	}
+
 	GLVertexArrayObjectManager::~GLVertexArrayObjectManager()
 	{
 		assert(mVAObjects.size() == 0 && "VertexArrayObjectManager getting shut down but not all VA objects were released.");
@@ -125,7 +158,7 @@ namespace bs { namespace ct
 		}
 
 		// Need to create new VAO
-		const Vector<VertexElement>& inputAttributes = vertexProgram->getInputDeclaration()->getProperties().getElements();
+		const Vector<GLint>& attribLocations = getAttribLocations(vertexDecl, vertexProgram);
 
 		glGenVertexArrays(1, &wantedVAO.mHandle);
 		BS_CHECK_GL_ERROR();
@@ -133,27 +166,17 @@ namespace bs { namespace ct
 		glBindVertexArray(wantedVAO.mHandle);
 		BS_CHECK_GL_ERROR();
 
+		UINT32 elemIdx = 0;
 		for (auto& elem : decl)
 		{
 			UINT16 streamIdx = elem.getStreamIdx();
 			INT32 seqIdx = streamToSeqIdx[streamIdx];
+			GLint attribLocation = attribLocations[elemIdx++];
 
 			if (seqIdx == -1)
 				continue;
 
-			bool foundSemantic = false;
-			GLint attribLocation = 0;
-			for (auto iter = inputAttributes.begin(); iter != inputAttributes.end(); ++iter)
-			{
-				if (iter->getSemantic() == elem.getSemantic() && iter->getSemanticIdx() == elem.getSemanticIdx())
-				{
-					foundSemantic = true;
-					attribLocation = iter->getOffset();
-					break;
-				}
-			}
-
-			if (!foundSemantic) // Shader needs to have a matching input attribute, otherwise we skip it
+			if (attribLocation == -1) // Shader needs to have a matching input attribute, otherwise we skip it
 				continue;
 
 			// TODO - We might also want to check the size of input and buffer, and make sure they match? Or does OpenGL handle that internally?
@@ -71,7 +71,16 @@ namespace bs { namespace ct
 	private:
 		typedef UnorderedSet<GLVertexArrayObject, GLVertexArrayObject::Hash, GLVertexArrayObject::Equal> VAOMap;
 
+		/**
+		 * Returns GL attribute locations for each element of the provided vertex declaration, as resolved against the
+		 * input attributes of the provided vertex program. Elements with no matching program input are assigned -1.
+		 * Results are cached per (declaration, program) pair so semantic matching only happens once per combination.
+		 */
+		const Vector<GLint>& getAttribLocations(const SPtr<VertexDeclaration>& vertexDecl,
+			const SPtr<GLSLGpuProgram>& vertexProgram);
+
 		VAOMap mVAObjects;
+		UnorderedMap<UINT64, Vector<GLint>> mAttribLocations;
 	};
 
 	/** @} */
@@ -30,6 +30,7 @@ set(BS_GLRENDERAPI_INC_NOFILTER
 	"BsGLRenderAPIFactory.h"
 	"BsGLUtil.h"
 	"BsGLBuffer.h"
+	"BsGLBufferUploadRing.h"
 	"BsGLCommandBuffer.h"
 	"BsGLCommandBufferManager.h"
 	"BsGLTextureView.h"
@@ -59,6 +60,7 @@ set(BS_GLRENDERAPI_SRC_NOFILTER
 	"BsGLRenderAPIFactory.cpp"
 	"BsGLPlugin.cpp"
 	"BsGLBuffer.cpp"
+	"BsGLBufferUploadRing.cpp"
 	"BsGLCommandBuffer.cpp"
 	"BsGLCommandBufferManager.cpp"
 	"BsGLTextureView.cpp"
@@ -0,0 +1,81 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsMonoPinnedArray.h"
+#include "BsMonoUtil.h"
+
+namespace bs
+{
+	MonoPinnedArray::MonoPinnedArray(const ScriptArray& array)
+	{
+		mInternal = array.getInternal();
+		if (mInternal == nullptr)
+			return;
+
+		mGCHandle = MonoUtil::newGCHandle((MonoObject*)mInternal, true);
+		mNumElements = array.size();
+		mElementSize = array.elementSize();
+	}
+
+	MonoPinnedArray::MonoPinnedArray(::MonoClass* elementClass, UINT32 size)
+		:MonoPinnedArray(ScriptArray(elementClass, size))
+	{ }
+
+	MonoPinnedArray::~MonoPinnedArray()
+	{
+		free();
+	}
+
+	MonoPinnedArray::MonoPinnedArray(MonoPinnedArray&& other)
+	{
+		mInternal = other.mInternal;
+		mGCHandle = other.mGCHandle;
+		mNumElements = other.mNumElements;
+		mElementSize = other.mElementSize;
+
+		other.mInternal = nullptr;
+		other.mGCHandle = 0;
+		other.mNumElements = 0;
+		other.mElementSize = 0;
+	}
+
+	MonoPinnedArray& MonoPinnedArray::operator=(MonoPinnedArray&& other)
+	{
+		if (this == &other)
+			return *this;
+
+		free();
+
+		mInternal = other.mInternal;
+		mGCHandle = other.mGCHandle;
+		mNumElements = other.mNumElements;
+		mElementSize = other.mElementSize;
+
+		other.mInternal = nullptr;
+		other.mGCHandle = 0;
+		other.mNumElements = 0;
+		other.mElementSize = 0;
+
+		return *this;
+	}
+
+	UINT8* MonoPinnedArray::getRaw() const
+	{
+		if (mInternal == nullptr)
+			return nullptr;
+
+		return ScriptArray::_getArrayAddr(mInternal, mElementSize, 0);
+	}
+
+	void MonoPinnedArray::free()
+	{
+		if (mGCHandle != 0)
+		{
+			MonoUtil::freeGCHandle(mGCHandle);
+			mGCHandle = 0;
+		}
+
+		mInternal = nullptr;
+		mNumElements = 0;
+		mElementSize = 0;
+	}
+}
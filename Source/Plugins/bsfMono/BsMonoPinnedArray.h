@@ -0,0 +1,103 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsMonoPrerequisites.h"
+#include "BsMonoArray.h"
+
+namespace bs
+{
+	/** @addtogroup Mono
+	 *  @{
+	 */
+
+	/**
+	 * Wraps a managed array and pins it in memory for the lifetime of the wrapper. Pinning allows native code to hold a
+	 * direct pointer to the array memory and read/write it freely, without per-element marshalling and without the GC
+	 * moving the array underneath it.
+	 *
+	 * This is meant for sharing bulk per-frame data with managed code (for example transform, input or time streams laid
+	 * out structure-of-arrays style). Native code writes the entire stream directly into the array memory, and managed
+	 * code iterates over it in a single call per frame, instead of paying an interop transition and argument boxing for
+	 * every object.
+	 *
+	 * @note
+	 * Pinned objects prevent the GC from compacting the heap, so these buffers should be long-lived and few in number.
+	 * Allocate them once and re-use them across frames rather than creating them per frame.
+	 */
+	class BS_MONO_EXPORT MonoPinnedArray
+	{
+	public:
+		MonoPinnedArray() = default;
+
+		/** Pins the provided managed array. The array stays pinned until this object is destroyed. */
+		MonoPinnedArray(const ScriptArray& array);
+
+		/** Creates a new managed array with elements of the specified type, and pins it. */
+		MonoPinnedArray(::MonoClass* elementClass, UINT32 size);
+
+		~MonoPinnedArray();
+
+		MonoPinnedArray(const MonoPinnedArray&) = delete;
+		MonoPinnedArray& operator=(const MonoPinnedArray&) = delete;
+
+		MonoPinnedArray(MonoPinnedArray&& other);
+		MonoPinnedArray& operator=(MonoPinnedArray&& other);
+
+		/**
+		 * Returns a pointer to the first element of the array. The pointer remains valid for the lifetime of this object.
+		 * Returns null if the wrapper is empty.
+		 */
+		UINT8* getRaw() const;
+
+		/**
+		 * Returns a typed pointer to the first element of the array. The size of @p T must match the element size of the
+		 * wrapped array. The pointer remains valid for the lifetime of this object.
+		 */
+		template<class T>
+		T* getData() const
+		{
+#if BS_DEBUG_MODE
+			assert(mInternal == nullptr || sizeof(T) == mElementSize);
+#endif
+			return (T*)getRaw();
+		}
+
+		/** Returns the number of elements in the array. */
+		UINT32 size() const { return mNumElements; }
+
+		/** Returns the size of an individual element in the array, in bytes. */
+		UINT32 elementSize() const { return mElementSize; }
+
+		/** Checks does the wrapper contain a valid pinned array. */
+		bool isValid() const { return mInternal != nullptr; }
+
+		/**
+		 * Returns the managed object representing this array, for passing to managed code. Since the array is pinned it is
+		 * safe to cache this pointer.
+		 */
+		MonoArray* getInternal() const { return mInternal; }
+
+		/**
+		 * Creates a new managed array of the specified primitive type, and pins it.
+		 *
+		 * @tparam	T	Primitive type of the array elements (for example float or UINT32).
+		 */
+		template<class T>
+		static MonoPinnedArray create(UINT32 size)
+		{
+			return MonoPinnedArray(ScriptArray::create<T>(size));
+		}
+
+	private:
+		/** Unpins the wrapped array, if any, and clears the wrapper. */
+		void free();
+
+		MonoArray* mInternal = nullptr;
+		UINT32 mGCHandle = 0;
+		UINT32 mNumElements = 0;
+		UINT32 mElementSize = 0;
+	};
+
+	/** @} */
+}
@@ -9,6 +9,7 @@ set(BS_MONO_INC_NOFILTER
 	"BsMonoUtil.h"
 	"BsScriptMeta.h"
 	"BsMonoArray.h"
+	"BsMonoPinnedArray.h"
 )
 
 set(BS_MONO_SRC_NOFILTER
@@ -22,6 +23,7 @@ set(BS_MONO_SRC_NOFILTER
 	"BsScriptMeta.cpp"
 	"BsMonoUtil.cpp"
 	"BsMonoArray.cpp"
+	"BsMonoPinnedArray.cpp"
 )
 
 source_group("" FILES ${BS_MONO_INC_NOFILTER} ${BS_MONO_SRC_NOFILTER})
@@ -5,8 +5,8 @@
 #include "BsOAAudioListener.h"
 #include "BsOAAudioSource.h"
 #include "Math/BsMath.h"
-#include "Threading/BsTaskScheduler.h"
 #include "Audio/BsAudioUtility.h"
+#include "Utility/BsTime.h"
 #include "AL/al.h"
 
 namespace bs
@@ -70,6 +70,16 @@ namespace bs
 	{
 		stopManualSources();
 
+		{
+			Lock lock(mMutex);
+			mStreamingThreadShutdown = true;
+		}
+
+		mStreamingSignal.notify_one();
+
+		if (mStreamingThreadStarted)
+			mStreamingThread.blockUntilComplete();
+
 		assert(mListeners.empty() && mSources.empty()); // Everything should be destroyed at this point
 		clearContexts();
 
@@ -103,14 +113,18 @@ namespace bs
 
 	void OAAudio::_update()
 	{
-		auto worker = [this]() { updateStreaming(); };
+		updateVoices();
 
-		// If previous task still hasn't completed, just skip streaming this frame, queuing more tasks won't help
-		if (mStreamingTask != nullptr && !mStreamingTask->isComplete())
-			return;
+		// Wake the streaming thread. If it's still busy with the previous update it will simply fold this request
+		// into its current iteration, queueing more requests wouldn't help.
+		{
+			Lock lock(mMutex);
+
+			if (mStreamingThreadStarted)
+				mStreamingUpdatePending = true;
+		}
 
-		mStreamingTask = Task::create("AudioStream", worker, TaskPriority::VeryHigh);
-		TaskScheduler::instance().addTask(mStreamingTask);
+		mStreamingSignal.notify_one();
 
 		Audio::_update();
 	}
@@ -178,6 +192,13 @@ namespace bs
 
 		mStreamingCommandQueue.push_back({ StreamingCommandType::Start, source });
 		mDestroyedSources.erase(source);
+
+		// Delay launching the streaming thread until the first source actually needs it
+		if (!mStreamingThreadStarted)
+		{
+			mStreamingThread = ThreadPool::instance().run("AudioStream", std::bind(&OAAudio::runStreamingThread, this));
+			mStreamingThreadStarted = true;
+		}
 	}
 
 	void OAAudio::stopStreaming(OAAudioSource* source)
@@ -264,6 +285,26 @@ namespace bs
 		mContexts.clear();
 	}
 
+	void OAAudio::runStreamingThread()
+	{
+		while (true)
+		{
+			{
+				Lock lock(mMutex);
+
+				while (!mStreamingUpdatePending && !mStreamingThreadShutdown)
+					mStreamingSignal.wait(lock);
+
+				if (mStreamingThreadShutdown)
+					return;
+
+				mStreamingUpdatePending = false;
+			}
+
+			updateStreaming();
+		}
+	}
+
 	void OAAudio::updateStreaming()
 	{
 		{
@@ -288,7 +329,13 @@ namespace bs
 			mDestroyedSources.clear();
 		}
 
-		for (auto& source : mStreamingSources)
+		// Handle sources with the least amount of queued buffers first. They are the closest to starving, and a long
+		// decode for a healthy source shouldn't be able to cause a dropout in one that's nearly out of data.
+		Vector<OAAudioSource*> sortedSources(mStreamingSources.begin(), mStreamingSources.end());
+		std::sort(sortedSources.begin(), sortedSources.end(),
+			[](OAAudioSource* a, OAAudioSource* b) { return a->getNumQueuedBuffers() < b->getNumQueuedBuffers(); });
+
+		for (auto& source : sortedSources)
 		{
 			// Check if the source got destroyed while streaming
 			{
@@ -303,6 +350,83 @@ namespace bs
 		}
 	}
 
+	void OAAudio::updateVoices()
+	{
+		float timeDelta = gTime().getFrameDelta();
+
+		// No limit, promote any previously virtualized voices and bail
+		if (mMaxRealVoices == 0)
+		{
+			for (auto& source : mSources)
+			{
+				if (source->isVirtual())
+					source->makeReal();
+			}
+
+			return;
+		}
+
+		// Rank playing sources by priority, breaking ties with distance-attenuated volume against the closest listener
+		struct VoiceEntry
+		{
+			OAAudioSource* source;
+			float audibility;
+		};
+
+		Vector<VoiceEntry> playingSources;
+		for (auto& source : mSources)
+		{
+			if (source->getState() != AudioSourceState::Playing)
+				continue;
+
+			float audibility = 0.0f;
+			if (mListeners.empty())
+				audibility = source->getAudibility(Vector3::ZERO);
+			else
+			{
+				for (auto& listener : mListeners)
+					audibility = std::max(audibility, source->getAudibility(listener->getTransform().getPosition()));
+			}
+
+			playingSources.push_back({ source, audibility });
+		}
+
+		std::sort(playingSources.begin(), playingSources.end(),
+			[](const VoiceEntry& a, const VoiceEntry& b)
+		{
+			if (a.source->getPriority() != b.source->getPriority())
+				return a.source->getPriority() > b.source->getPriority();
+
+			return a.audibility > b.audibility;
+		});
+
+		UINT32 numPlaying = (UINT32)playingSources.size();
+		for (UINT32 i = 0; i < numPlaying; i++)
+		{
+			if (i < mMaxRealVoices)
+				playingSources[i].source->makeReal();
+			else
+				playingSources[i].source->makeVirtual();
+		}
+
+		for (auto& source : mSources)
+		{
+			if (!source->isVirtual())
+				continue;
+
+			// Voices that stopped or were paused while virtual don't consume a mixer voice, promote them back so they
+			// don't linger in the virtual state
+			if (source->getState() != AudioSourceState::Playing)
+			{
+				source->makeReal();
+				continue;
+			}
+
+			// Advance playback time so the voice resumes from the right position when promoted
+			source->tickVirtual(timeDelta);
+		}
+	}
+
 	ALenum OAAudio::_getOpenALBufferFormat(UINT32 numChannels, UINT32 bitDepth)
 	{
 		switch (bitDepth)
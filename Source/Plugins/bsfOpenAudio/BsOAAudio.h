@@ -4,6 +4,7 @@
 
 #include "BsOAPrerequisites.h"
 #include "Audio/BsAudio.h"
+#include "Threading/BsThreadPool.h"
 #include "AL/alc.h"
 
 namespace bs
@@ -46,6 +47,9 @@ namespace bs
 		/** @copydoc Audio::getAllDevices */
 		const Vector<AudioDevice>& getAllDevices() const override { return mAllDevices; };
 
+		/** @copydoc Audio::setMaxRealVoices */
+		void setMaxRealVoices(UINT32 numVoices) override { mMaxRealVoices = numVoices; }
+
 		/** @name Internal 
 		 *  @{
 		 */
@@ -123,7 +127,16 @@ namespace bs
 		/** Delete all existing OpenAL contexts. */
 		void clearContexts();
 
-		/** Streams new data to audio sources that require it. */
+		/**
+		 * Worker method for the streaming thread. Sleeps until woken by _update() each frame, or until shut down on
+		 * module destruction.
+		 */
+		void runStreamingThread();
+
+		/**
+		 * Streams new data to audio sources that require it. Sources with the least amount of queued buffers are
+		 * handled first, as they are the closest to starving.
+		 */
 		void updateStreaming();
 
 		/** Starts data streaming for the provided source. */
@@ -132,8 +145,15 @@ namespace bs
 		/** Stops data streaming for the provided source. */
 		void stopStreaming(OAAudioSource* source);
 
+		/**
+		 * Promotes or demotes sources between real and virtual voices, based on the limit set by setMaxRealVoices().
+		 * Virtual voices have their playback time advanced. Should be called once per frame.
+		 */
+		void updateVoices();
+
 		float mVolume = 1.0f;
 		bool mIsPaused = false;
+		UINT32 mMaxRealVoices = 0;
 
 		ALCdevice* mDevice = nullptr;
 		Vector<AudioDevice> mAllDevices;
@@ -148,7 +168,11 @@ namespace bs
 		Vector<StreamingCommand> mStreamingCommandQueue;
 		UnorderedSet<OAAudioSource*> mStreamingSources;
 		UnorderedSet<OAAudioSource*> mDestroyedSources;
-		SPtr<Task> mStreamingTask;
+		HThread mStreamingThread;
+		Signal mStreamingSignal;
+		bool mStreamingThreadStarted = false;
+		bool mStreamingUpdatePending = false;
+		bool mStreamingThreadShutdown = false;
 		mutable Mutex mMutex;
 	};
 
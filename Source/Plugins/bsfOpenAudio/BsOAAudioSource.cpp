@@ -8,7 +8,8 @@
 namespace bs
 {
 	OAAudioSource::OAAudioSource()
-		: mSavedTime(0.0f), mSavedState(AudioSourceState::Stopped), mGloballyPaused(false), mStreamBuffers()
+		: mSavedTime(0.0f), mSavedState(AudioSourceState::Stopped), mGloballyPaused(false), mIsVirtual(false)
+		, mVirtualTime(0.0f), mVirtualState(AudioSourceState::Stopped), mStreamBuffers()
 		, mBusyBuffers(), mStreamProcessedPosition(0), mStreamQueuedPosition(0), mIsStreaming(false)
 	{
 		gOAAudio()._registerSource(this);
@@ -161,6 +162,13 @@ namespace bs
 		if (mGloballyPaused)
 			return;
 
+		// Virtual voices just track state, actual playback starts if the source gets promoted to a real voice
+		if (mIsVirtual)
+		{
+			mVirtualState = AudioSourceState::Playing;
+			return;
+		}
+
 		if(requiresStreaming())
 		{
 			Lock lock(mMutex);
@@ -192,6 +200,12 @@ namespace bs
 
 	void OAAudioSource::pause()
 	{
+		if (mIsVirtual)
+		{
+			mVirtualState = AudioSourceState::Paused;
+			return;
+		}
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -205,6 +219,14 @@ namespace bs
 
 	void OAAudioSource::stop()
 	{
+		if (mIsVirtual)
+		{
+			mVirtualState = AudioSourceState::Stopped;
+			mVirtualTime = 0.0f;
+
+			// Fall through so any paused voice and streaming state gets cleaned up as well
+		}
+
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		for (UINT32 i = 0; i < numContexts; i++)
@@ -260,6 +282,12 @@ namespace bs
 		if (!mAudioClip.isLoaded())
 			return;
 
+		if (mIsVirtual)
+		{
+			mVirtualTime = time;
+			return;
+		}
+
 		AudioSourceState state = getState();
 		stop();
 
@@ -301,6 +329,9 @@ namespace bs
 
 	float OAAudioSource::getTime() const
 	{
+		if (mIsVirtual)
+			return mVirtualTime;
+
 		Lock lock(mMutex);
 
 		auto& contexts = gOAAudio()._getContexts();
@@ -329,6 +360,9 @@ namespace bs
 
 	AudioSourceState OAAudioSource::getState() const
 	{
+		if (mIsVirtual)
+			return mVirtualState;
+
 		ALint state;
 		alGetSourcei(mSourceIDs[0], AL_SOURCE_STATE, &state);
 
@@ -345,6 +379,95 @@ namespace bs
 		}
 	}
 
+	float OAAudioSource::getAudibility(const Vector3& listenerPos) const
+	{
+		if (!is3D())
+			return mVolume;
+
+		// Mirrors OpenAL's default inverse distance clamped attenuation model
+		float distance = mTransform.getPosition().distance(listenerPos);
+		distance = std::max(distance, mMinDistance);
+
+		float denom = mMinDistance + mAttenuation * (distance - mMinDistance);
+		if (denom <= 0.0f)
+			return mVolume;
+
+		return mVolume * (mMinDistance / denom);
+	}
+
+	void OAAudioSource::makeVirtual()
+	{
+		if (mIsVirtual)
+			return;
+
+		AudioSourceState state = getState();
+		float time = state != AudioSourceState::Stopped ? getTime() : 0.0f;
+
+		// Pause the real voice so it stops consuming mixer resources, but keep the buffers and streaming state around
+		// so promoting it back to a real voice stays cheap
+		if (state == AudioSourceState::Playing)
+		{
+			auto& contexts = gOAAudio()._getContexts();
+			UINT32 numContexts = (UINT32)contexts.size();
+			for (UINT32 i = 0; i < numContexts; i++)
+			{
+				if (contexts.size() > 1)
+					alcMakeContextCurrent(contexts[i]);
+
+				alSourcePause(mSourceIDs[i]);
+			}
+		}
+
+		mIsVirtual = true;
+		mVirtualState = state;
+		mVirtualTime = time;
+	}
+
+	void OAAudioSource::makeReal()
+	{
+		if (!mIsVirtual)
+			return;
+
+		AudioSourceState state = mVirtualState;
+		float time = mVirtualTime;
+
+		mIsVirtual = false;
+
+		if (state == AudioSourceState::Stopped)
+			return;
+
+		if (mAudioClip.isLoaded())
+			setTime(std::min(time, mAudioClip->getLength()));
+
+		if (state == AudioSourceState::Playing)
+			play();
+		else
+			pause();
+	}
+
+	void OAAudioSource::tickVirtual(float timeDelta)
+	{
+		if (!mIsVirtual || mVirtualState != AudioSourceState::Playing)
+			return;
+
+		mVirtualTime += timeDelta * mPitch;
+
+		if (!mAudioClip.isLoaded())
+			return;
+
+		float length = mAudioClip->getLength();
+		if (length <= 0.0f)
+			return;
+
+		if (mVirtualTime >= length)
+		{
+			if (mLoop)
+				mVirtualTime = fmod(mVirtualTime, length);
+			else
+				stop(); // Clip finished while virtual
+		}
+	}
+
 	void OAAudioSource::clear()
 	{
 		mSavedState = getState();
@@ -485,6 +608,18 @@ namespace bs
 		streamUnlocked();
 	}
 
+	UINT32 OAAudioSource::getNumQueuedBuffers() const
+	{
+		UINT32 numBuffers = 0;
+		for (auto& entry : mBusyBuffers)
+		{
+			if (entry != 0)
+				numBuffers++;
+		}
+
+		return numBuffers;
+	}
+
 	void OAAudioSource::streamUnlocked()
 	{
 		AudioDataInfo info;
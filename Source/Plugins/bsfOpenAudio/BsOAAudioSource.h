@@ -66,6 +66,27 @@ namespace bs
 	private:
 		friend class OAAudio;
 
+		/**
+		 * Computes how audible this source is to a listener at the provided position, accounting for source volume and
+		 * distance attenuation. Used for ranking sources when voice virtualization is enabled.
+		 */
+		float getAudibility(const Vector3& listenerPos) const;
+
+		/**
+		 * Demotes the source to a virtual voice. Playback state and time keep being tracked so playback can resume
+		 * seamlessly, but the source stops consuming mixer resources. Does nothing if already virtual.
+		 */
+		void makeVirtual();
+
+		/** Promotes a virtual voice back to a real one, resuming playback from the tracked time. */
+		void makeReal();
+
+		/** Advances the tracked playback time of a virtual voice. Handles looping and end-of-clip. */
+		void tickVirtual(float timeDelta);
+
+		/** Checks is the source currently a virtual voice. */
+		bool isVirtual() const { return mIsVirtual; }
+
 		/** Destroys the internal representation of the audio source. */
 		void clear();
 
@@ -78,6 +99,12 @@ namespace bs
 		/** Same as stream(), but without a mutex lock (up to the caller to lock it). */
 		void streamUnlocked();
 
+		/**
+		 * Returns the number of stream buffers currently queued for playback. Only valid while streaming, and meant to
+		 * be called from the streaming thread.
+		 */
+		UINT32 getNumQueuedBuffers() const;
+
 		/** Starts data streaming from the currently attached audio clip. */
 		void startStreaming();
 
@@ -113,6 +140,10 @@ namespace bs
 		AudioSourceState mSavedState;
 		bool mGloballyPaused;
 
+		bool mIsVirtual;
+		float mVirtualTime;
+		AudioSourceState mVirtualState;
+
 		static const UINT32 StreamBufferCount = 3; // Maximum 32
 		UINT32 mStreamBuffers[StreamBufferCount];
 		UINT32 mBusyBuffers[StreamBufferCount];
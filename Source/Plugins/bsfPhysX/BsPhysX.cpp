@@ -291,7 +291,7 @@ namespace bs
 		{
 			// Note: Banshee's task scheduler is pretty low granularity. Consider a better task manager in case PhysX ends
 			// up submitting many tasks.
-			// - PhysX's task manager doesn't seem much lighter either. But perhaps I can at least create a task pool to 
+			// - PhysX's task manager doesn't seem much lighter either. But perhaps I can at least create a task pool to
 			//   avoid allocating them constantly.
 
 			auto runTask = [&]() { physxTask.run(); physxTask.release(); };
@@ -302,8 +302,19 @@ namespace bs
 
 		PxU32 getWorkerCount() const override
 		{
-			return (PxU32)TaskScheduler::instance().getNumWorkers();
+			UINT32 numWorkers = TaskScheduler::instance().getNumWorkers();
+
+			if (mWorkerBudget > 0)
+				numWorkers = std::min(numWorkers, mWorkerBudget);
+
+			return (PxU32)numWorkers;
 		}
+
+		/** @copydoc PHYSICS_INIT_DESC::maxCpuWorkers */
+		void setWorkerBudget(UINT32 budget) { mWorkerBudget = budget; }
+
+	private:
+		UINT32 mWorkerBudget = 0;
 	};
 
 	class PhysXBroadPhaseCallback : public PxBroadPhaseCallback
@@ -483,6 +494,8 @@ namespace bs
 
 		PxSceneDesc sceneDesc(mScale); // TODO - Test out various other parameters provided by scene desc
 		sceneDesc.gravity = toPxVector(input.gravity);
+
+		gPhysXCPUDispatcher.setWorkerBudget(input.maxCpuWorkers);
 		sceneDesc.cpuDispatcher = &gPhysXCPUDispatcher;
 		sceneDesc.filterShader = PhysXFilterShader;
 		sceneDesc.simulationEventCallback = &gPhysXEventCallback;
@@ -517,8 +530,50 @@ namespace bs
 		mFoundation->release();
 	}
 
+	/**
+	 * Splits the provided range into roughly equal chunks and processes them on the task scheduler's worker threads.
+	 * Runs inline on the calling thread when the range is too small to be worth distributing. Blocks until all chunks
+	 * are processed.
+	 */
+	static void processRangeParallel(UINT32 count, UINT32 minEntriesPerTask, std::function<void(UINT32, UINT32)> worker)
+	{
+		UINT32 numTasks = 0;
+		if (minEntriesPerTask > 0)
+			numTasks = count / minEntriesPerTask;
+
+		numTasks = std::min(numTasks, TaskScheduler::instance().getNumWorkers());
+
+		if (numTasks <= 1)
+		{
+			worker(0, count);
+			return;
+		}
+
+		UINT32 entriesPerTask = count / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			UINT32 start = i * entriesPerTask;
+			UINT32 end = (i == (numTasks - 1)) ? count : (start + entriesPerTask);
+
+			tasks.push_back(Task::create("PhysXResults", std::bind(worker, start, end)));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
 	void PhysX::fixedUpdate(float step)
 	{
+		// Apply all queued actor transform writes in a single pass. This happens even when paused so that the writes
+		// aren't deferred indefinitely.
+		for (auto& body : mMovedBodies)
+			body->_applyQueuedMove();
+
+		mMovedBodies.clear();
+
 		if (mPaused)
 			return;
 
@@ -542,23 +597,81 @@ namespace bs
 		PxU32 numActiveTransforms;
 		const PxActiveTransform* activeTransforms = mScene->getActiveTransforms(numActiveTransforms);
 
-		for (PxU32 i = 0; i < numActiveTransforms; i++)
+		struct UpdatedTransform
 		{
-			Rigidbody* rigidbody = static_cast<Rigidbody*>(activeTransforms[i].userData);
+			Rigidbody* rigidbody;
+			Vector3 position;
+			Quaternion rotation;
+		};
 
-			// Note: This should never happen, as actors gets their userData set to null when they're destroyed. However
-			// in some cases PhysX seems to keep those actors alive for a frame or few, and reports their state here. Until
-			// I find out why I need to perform this check.
-			if(activeTransforms[i].actor->userData == nullptr)
-				continue;
+		Vector<UpdatedTransform> updatedTransforms(numActiveTransforms);
+
+		// Convert and validate the reported transforms in parallel. The rigidbody update itself happens serially below,
+		// as it writes to scene objects and triggers user callbacks, neither of which is thread safe.
+		processRangeParallel((UINT32)numActiveTransforms, 1024, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				UpdatedTransform& output = updatedTransforms[i];
 
-			const PxTransform& transform = activeTransforms[i].actor2World;
+				// Note: This should never happen, as actors gets their userData set to null when they're destroyed.
+				// However in some cases PhysX seems to keep those actors alive for a frame or few, and reports their
+				// state here. Until I find out why I need to perform this check.
+				if(activeTransforms[i].actor->userData == nullptr)
+				{
+					output.rigidbody = nullptr;
+					continue;
+				}
+
+				const PxTransform& transform = activeTransforms[i].actor2World;
 
-			// Note: Make this faster, avoid dereferencing Rigidbody and attempt to access pos/rot destination directly,
-			//       use non-temporal writes
-			rigidbody->_setTransform(fromPxVector(transform.p), fromPxQuaternion(transform.q));
+				output.rigidbody = static_cast<Rigidbody*>(activeTransforms[i].userData);
+				output.position = fromPxVector(transform.p);
+				output.rotation = fromPxQuaternion(transform.q);
+			}
+		});
+
+		for (auto& entry : updatedTransforms)
+		{
+			if (entry.rigidbody == nullptr)
+				continue;
+
+			if (mTransformInterpolation)
+			{
+				// Don't apply the transform to the scene object right away, only record it so update() can interpolate
+				// between the two most recent simulated states on every render frame
+				auto iterFind = mInterpolatedBodies.find(entry.rigidbody);
+				if (iterFind == mInterpolatedBodies.end())
+				{
+					InterpolatedBody body;
+					body.prevPosition = entry.position;
+					body.prevRotation = entry.rotation;
+					body.currPosition = entry.position;
+					body.currRotation = entry.rotation;
+					body.appliedPosition = entry.position;
+					body.appliedRotation = entry.rotation;
+					body.refreshed = true;
+
+					mInterpolatedBodies[entry.rigidbody] = body;
+					entry.rigidbody->_setTransform(entry.position, entry.rotation);
+				}
+				else
+				{
+					InterpolatedBody& body = iterFind->second;
+					body.prevPosition = body.currPosition;
+					body.prevRotation = body.currRotation;
+					body.currPosition = entry.position;
+					body.currRotation = entry.rotation;
+					body.refreshed = true;
+				}
+			}
+			else
+				entry.rigidbody->_setTransform(entry.position, entry.rotation);
 		}
 
+		mLastStep = step;
+		mLastSimulationTime = gTime().getTimePrecise();
+
 		// Note: Consider extrapolating for the remaining "simulationAmount" value
 		mUpdateInProgress = false;
 
@@ -567,7 +680,69 @@ namespace bs
 
 	void PhysX::update()
 	{
-		// Note: Potentially interpolate (would mean a one frame delay needs to be introduced)
+		if (!mTransformInterpolation || mInterpolatedBodies.empty())
+			return;
+
+		// Interpolate between the two most recent simulated states, based on how far we are between fixed steps. This
+		// trades up to one fixed step of latency for smooth motion regardless of frame rate.
+		float alpha = 1.0f;
+		if (mLastStep > 0.0f)
+		{
+			float sinceStep = (gTime().getTimePrecise() - mLastSimulationTime) / 1000000.0f;
+			alpha = Math::clamp01(sinceStep / mLastStep);
+		}
+
+		for (auto iter = mInterpolatedBodies.begin(); iter != mInterpolatedBodies.end();)
+		{
+			InterpolatedBody& body = iter->second;
+
+			Vector3 position = Math::lerp(alpha, body.prevPosition, body.currPosition);
+			Quaternion rotation = Quaternion::slerp(alpha, body.prevRotation, body.currRotation);
+
+			// Only touch the scene object when the interpolated state actually moved, so settled or sleeping bodies
+			// don't trigger transform dirty propagation every frame
+			constexpr float POSITION_EPSILON_SQRD = 1e-10f;
+			constexpr float ROTATION_EPSILON = 1e-6f;
+
+			bool moved = position.squaredDistance(body.appliedPosition) > POSITION_EPSILON_SQRD ||
+				fabs(rotation.dot(body.appliedRotation)) < (1.0f - ROTATION_EPSILON);
+
+			if (moved)
+			{
+				iter->first->_setTransform(position, rotation);
+
+				body.appliedPosition = position;
+				body.appliedRotation = rotation;
+			}
+
+			// Once a body stops being reported by the simulation and its latest state has been fully applied, stop
+			// tracking it so sleeping bodies are cost-free
+			if (!body.refreshed && !moved && alpha >= 1.0f)
+			{
+				iter = mInterpolatedBodies.erase(iter);
+				continue;
+			}
+
+			body.refreshed = false;
+			++iter;
+		}
+	}
+
+	void PhysX::setTransformInterpolation(bool enabled)
+	{
+		if (mTransformInterpolation == enabled)
+			return;
+
+		mTransformInterpolation = enabled;
+
+		if (!enabled)
+		{
+			// Snap all tracked bodies to their latest simulated state before dropping the buffers
+			for (auto& entry : mInterpolatedBodies)
+				entry.first->_setTransform(entry.second.currPosition, entry.second.currRotation);
+
+			mInterpolatedBodies.clear();
+		}
 	}
 
 	void PhysX::_reportContactEvent(const ContactEvent& event)
@@ -585,6 +760,26 @@ namespace bs
 		mJointBreakEvents.push_back(event);
 	}
 
+	void PhysX::_queueMovedBody(PhysXRigidbody* body)
+	{
+		mMovedBodies.push_back(body);
+	}
+
+	void PhysX::_clearMovedBody(PhysXRigidbody* body)
+	{
+		auto iterFind = std::find(mMovedBodies.begin(), mMovedBodies.end(), body);
+		if (iterFind != mMovedBodies.end())
+		{
+			*iterFind = mMovedBodies.back();
+			mMovedBodies.pop_back();
+		}
+	}
+
+	void PhysX::_clearInterpolatedBody(PhysXRigidbody* body)
+	{
+		mInterpolatedBodies.erase(body);
+	}
+
 	void PhysX::triggerEvents()
 	{
 		CollisionDataRaw data;
@@ -608,32 +803,76 @@ namespace bs
 			}
 		}
 
-		auto notifyContact = [&](Collider* obj, Collider* other, ContactEventType type, 
-			const Vector<ContactPoint>& points, bool flipNormals = false)
+		// Prepare contact event data in parallel (report mode checks and contact point copies). The callbacks themselves
+		// are dispatched serially below, as they call into user code.
+		struct PreparedContact
 		{
-			data.colliders[0] = obj;
-			data.colliders[1] = other;
-			data.contactPoints = points;
+			bool notifyA = false;
+			bool notifyB = false;
+			CollisionDataRaw dataA;
+			CollisionDataRaw dataB;
+		};
+
+		UINT32 numContactEvents = (UINT32)mContactEvents.size();
+		Vector<PreparedContact> preparedContacts(numContactEvents);
+
+		auto shouldNotify = [](Collider* collider, ContactEventType type)
+		{
+			if (collider == nullptr)
+				return false;
+
+			CollisionReportMode reportMode = collider->getCollisionReportMode();
+
+			if (reportMode == CollisionReportMode::ReportPersistent)
+				return true;
+
+			return reportMode == CollisionReportMode::Report && type != ContactEventType::ContactStay;
+		};
 
-			if(flipNormals)
+		processRangeParallel(numContactEvents, 64, [&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
 			{
-				for (auto& point : data.contactPoints)
-					point.normal = -point.normal;
+				const ContactEvent& entry = mContactEvents[i];
+				PreparedContact& prepared = preparedContacts[i];
+
+				if (shouldNotify(entry.colliderA, entry.type))
+				{
+					prepared.notifyA = true;
+					prepared.dataA.colliders[0] = entry.colliderA;
+					prepared.dataA.colliders[1] = entry.colliderB;
+					prepared.dataA.contactPoints = entry.points;
+
+					// Reported normals point towards the first collider, flip them for its own notification
+					for (auto& point : prepared.dataA.contactPoints)
+						point.normal = -point.normal;
+				}
+
+				if (shouldNotify(entry.colliderB, entry.type))
+				{
+					prepared.notifyB = true;
+					prepared.dataB.colliders[0] = entry.colliderB;
+					prepared.dataB.colliders[1] = entry.colliderA;
+					prepared.dataB.contactPoints = entry.points;
+				}
 			}
+		});
 
+		auto notifyContact = [](Collider* obj, ContactEventType type, const CollisionDataRaw& contactData)
+		{
 			Rigidbody* rigidbody = obj->getRigidbody();
 			if(rigidbody != nullptr)
 			{
 				switch (type)
 				{
 				case ContactEventType::ContactBegin:
-					rigidbody->onCollisionBegin(data);
+					rigidbody->onCollisionBegin(contactData);
 					break;
 				case ContactEventType::ContactStay:
-					rigidbody->onCollisionStay(data);
+					rigidbody->onCollisionStay(contactData);
 					break;
 				case ContactEventType::ContactEnd:
-					rigidbody->onCollisionEnd(data);
+					rigidbody->onCollisionEnd(contactData);
 					break;
 				}
 			}
@@ -642,39 +881,28 @@ namespace bs
 				switch (type)
 				{
 				case ContactEventType::ContactBegin:
-					obj->onCollisionBegin(data);
+					obj->onCollisionBegin(contactData);
 					break;
 				case ContactEventType::ContactStay:
-					obj->onCollisionStay(data);
+					obj->onCollisionStay(contactData);
 					break;
 				case ContactEventType::ContactEnd:
-					obj->onCollisionEnd(data);
+					obj->onCollisionEnd(contactData);
 					break;
 				}
 			}
 		};
 
-		for (auto& entry : mContactEvents)
+		for (UINT32 i = 0; i < numContactEvents; i++)
 		{
-			if (entry.colliderA != nullptr)
-			{
-				CollisionReportMode reportModeA = entry.colliderA->getCollisionReportMode();
-
-				if (reportModeA == CollisionReportMode::ReportPersistent)
-					notifyContact(entry.colliderA, entry.colliderB, entry.type, entry.points, true);
-				else if (reportModeA == CollisionReportMode::Report && entry.type != ContactEventType::ContactStay)
-					notifyContact(entry.colliderA, entry.colliderB, entry.type, entry.points, true);
-			}
+			const ContactEvent& entry = mContactEvents[i];
+			const PreparedContact& prepared = preparedContacts[i];
 
-			if (entry.colliderB != nullptr)
-			{
-				CollisionReportMode reportModeB = entry.colliderB->getCollisionReportMode();
+			if (prepared.notifyA)
+				notifyContact(entry.colliderA, entry.type, prepared.dataA);
 
-				if (reportModeB == CollisionReportMode::ReportPersistent)
-					notifyContact(entry.colliderB, entry.colliderA, entry.type, entry.points, false);
-				else if (reportModeB == CollisionReportMode::Report && entry.type != ContactEventType::ContactStay)
-					notifyContact(entry.colliderB, entry.colliderA, entry.type, entry.points, false);
-			}
+			if (prepared.notifyB)
+				notifyContact(entry.colliderB, entry.type, prepared.dataB);
 		}
 
 		for(auto& entry : mJointBreakEvents)
@@ -189,6 +189,12 @@ namespace bs
 		/** @copydoc Physics::setPaused */
 		void setPaused(bool paused) override;
 
+		/** @copydoc Physics::setTransformInterpolation */
+		void setTransformInterpolation(bool enabled) override;
+
+		/** @copydoc Physics::getTransformInterpolation */
+		bool getTransformInterpolation() const override { return mTransformInterpolation; }
+
 		/** @copydoc Physics::getGravity */
 		Vector3 getGravity() const override;
 
@@ -238,6 +244,18 @@ namespace bs
 		/** Triggered by the PhysX simulation when a joint breaks. */
 		void _reportJointBreakEvent(const JointBreakEvent& event);
 
+		/**
+		 * Registers a rigidbody that has a pending actor transform write. All queued writes are applied to the scene
+		 * in a single pass before the next simulation step.
+		 */
+		void _queueMovedBody(PhysXRigidbody* body);
+
+		/** Removes a rigidbody from the pending transform write queue. Called when the body is destroyed. */
+		void _clearMovedBody(PhysXRigidbody* body);
+
+		/** Removes a rigidbody from the transform interpolation buffer. Called when the body is destroyed. */
+		void _clearInterpolatedBody(PhysXRigidbody* body);
+
 		/** Returns the default PhysX material. */
 		physx::PxMaterial* getDefaultMaterial() const { return mDefaultMaterial; }
 
@@ -288,13 +306,30 @@ namespace bs
 		/** Helper method that checks if the provided geometry overlaps any physics object. */
 		inline bool overlapAny(const physx::PxGeometry& geometry, const physx::PxTransform& tfrm, UINT64 layer) const;
 
+		/** Interpolation state of a single simulated rigidbody, when transform interpolation is enabled. */
+		struct InterpolatedBody
+		{
+			Vector3 prevPosition;
+			Quaternion prevRotation;
+			Vector3 currPosition;
+			Quaternion currRotation;
+			Vector3 appliedPosition; /** Transform last written to the scene object. */
+			Quaternion appliedRotation;
+			bool refreshed; /** True if the body was reported active by the most recent simulation step. */
+		};
+
 		float mTesselationLength = 3.0f;
 		UINT32 mNextRegionIdx = 1;
 		bool mPaused = false;
+		bool mTransformInterpolation = false;
+		float mLastStep = 0.0f;
+		UINT64 mLastSimulationTime = 0;
 
 		Vector<TriggerEvent> mTriggerEvents;
 		Vector<ContactEvent> mContactEvents;
 		Vector<JointBreakEvent> mJointBreakEvents;
+		Vector<PhysXRigidbody*> mMovedBodies;
+		UnorderedMap<Rigidbody*, InterpolatedBody> mInterpolatedBodies;
 		UnorderedMap<UINT32, UINT32> mBroadPhaseRegionHandles;
 
 		physx::PxFoundation* mFoundation = nullptr;
@@ -59,6 +59,11 @@ namespace bs
 
 	PhysXRigidbody::~PhysXRigidbody()
 	{
+		if (mMoveQueued)
+			gPhysX()._clearMovedBody(this);
+
+		gPhysX()._clearInterpolatedBody(this);
+
 		mInternal->userData = nullptr;
 		mInternal->release();
 	}
@@ -68,12 +73,14 @@ namespace bs
 		if (getIsKinematic())
 		{
 			PxTransform target;
-			if (!mInternal->getKinematicTarget(target))
+			if ((mPendingMoveFlags & PendingKinematicTarget) != 0)
+				target = mPendingKinematicTarget;
+			else if (!mInternal->getKinematicTarget(target))
 				target = PxTransform(PxIdentity);
 
 			target.p = toPxVector(position);
 
-			mInternal->setKinematicTarget(target);
+			queueMove(target, PendingKinematicTarget);
 		}
 		else
 		{
@@ -86,12 +93,14 @@ namespace bs
 		if (getIsKinematic())
 		{
 			PxTransform target;
-			if (!mInternal->getKinematicTarget(target))
+			if ((mPendingMoveFlags & PendingKinematicTarget) != 0)
+				target = mPendingKinematicTarget;
+			else if (!mInternal->getKinematicTarget(target))
 				target = PxTransform(PxIdentity);
 
 			target.q = toPxQuaternion(rotation);
 
-			mInternal->setKinematicTarget(target);
+			queueMove(target, PendingKinematicTarget);
 		}
 		else
 		{
@@ -101,17 +110,51 @@ namespace bs
 
 	Vector3 PhysXRigidbody::getPosition() const
 	{
+		if ((mPendingMoveFlags & PendingPose) != 0)
+			return fromPxVector(mPendingPose.p);
+
 		return fromPxVector(mInternal->getGlobalPose().p);
 	}
 
 	Quaternion PhysXRigidbody::getRotation() const
 	{
+		if ((mPendingMoveFlags & PendingPose) != 0)
+			return fromPxQuaternion(mPendingPose.q);
+
 		return fromPxQuaternion(mInternal->getGlobalPose().q);
 	}
 
 	void PhysXRigidbody::setTransform(const Vector3& pos, const Quaternion& rot)
 	{
-		mInternal->setGlobalPose(toPxTransform(pos, rot));
+		queueMove(toPxTransform(pos, rot), PendingPose);
+	}
+
+	void PhysXRigidbody::queueMove(const PxTransform& transform, PendingMoveFlag type)
+	{
+		if (type == PendingPose)
+			mPendingPose = transform;
+		else
+			mPendingKinematicTarget = transform;
+
+		mPendingMoveFlags |= (UINT32)type;
+
+		if (!mMoveQueued)
+		{
+			gPhysX()._queueMovedBody(this);
+			mMoveQueued = true;
+		}
+	}
+
+	void PhysXRigidbody::_applyQueuedMove()
+	{
+		if ((mPendingMoveFlags & PendingPose) != 0)
+			mInternal->setGlobalPose(mPendingPose);
+
+		if ((mPendingMoveFlags & PendingKinematicTarget) != 0)
+			mInternal->setKinematicTarget(mPendingKinematicTarget);
+
+		mPendingMoveFlags = 0;
+		mMoveQueued = false;
 	}
 
 	void PhysXRigidbody::setMass(float mass)
@@ -133,6 +176,10 @@ namespace bs
 	void PhysXRigidbody::setIsKinematic(bool kinematic)
 	{
 		mInternal->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, kinematic);
+
+		// Kinematic targets are invalid on non-kinematic actors, so drop any that are still queued
+		if (!kinematic)
+			mPendingMoveFlags &= ~(UINT32)PendingKinematicTarget;
 	}
 
 	bool PhysXRigidbody::getIsKinematic() const
@@ -157,8 +157,33 @@ namespace bs
 		/** Returns the internal PhysX dynamic actor. */
 		physx::PxRigidDynamic* _getInternal() const { return mInternal; }
 
+		/**
+		 * Applies any queued transform writes to the internal actor. Called by the physics manager in a single pass
+		 * over all moved bodies, before a simulation step.
+		 */
+		void _applyQueuedMove();
+
 	private:
+		/** Type of queued transform writes. */
+		enum PendingMoveFlag
+		{
+			PendingPose = 1 << 0, /**< A full actor pose (teleport). */
+			PendingKinematicTarget = 1 << 1 /**< A kinematic target the actor should be moved towards. */
+		};
+
+		/**
+		 * Queues an actor transform write of the specified type, to be applied in a batch before the next simulation
+		 * step. Getters on this object will reflect the queued value immediately, but scene queries won't until the
+		 * write is applied.
+		 */
+		void queueMove(const physx::PxTransform& transform, PendingMoveFlag type);
+
 		physx::PxRigidDynamic* mInternal;
+
+		physx::PxTransform mPendingPose;
+		physx::PxTransform mPendingKinematicTarget;
+		UINT32 mPendingMoveFlags = 0;
+		bool mMoveQueued = false;
 	};
 
 	/** @} */
@@ -10,9 +10,12 @@
 #include "RenderAPI/BsViewport.h"
 #include "RenderAPI/BsRenderTarget.h"
 #include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsGpuMemoryBudget.h"
+#include "RenderAPI/BsTimerQuery.h"
 #include "Profiling/BsProfilerCPU.h"
 #include "Profiling/BsProfilerGPU.h"
 #include "Utility/BsTime.h"
+#include "Threading/BsTaskScheduler.h"
 #include "Animation/BsAnimationManager.h"
 #include "Animation/BsSkeleton.h"
 #include "Renderer/BsLight.h"
@@ -76,8 +79,17 @@ namespace bs { namespace ct
 			mFeatureSet = RenderBeastFeatureSet::DesktopMacOS;
 		}
 
+		// Blending morph shapes in a compute shader requires load-store buffers. The flag is only ever raised here,
+		// before any renderables are created, so reading it from the simulation thread is safe.
+		mGpuMorphBlendingSupported = mFeatureSet == RenderBeastFeatureSet::Desktop;
+
 		RendererUtility::startUp();
 		GpuResourcePool::startUp();
+
+		// Let budget overruns reclaim memory from the resource pool before anything drastic is needed
+		mMemoryEvictionCallback = GpuMemoryBudget::instance().registerEvictionCallback(
+			[](UINT64 numBytes) { return GpuResourcePool::instance().trim(numBytes); });
+
 		IBLUtility::startUp<RenderBeastIBLUtility>();
 		RendererTextures::startUp();
 
@@ -103,6 +115,7 @@ namespace bs { namespace ct
 		RenderCompositor::registerNodeType<RCNodeFXAA>();
 		RenderCompositor::registerNodeType<RCNodeResolvedSceneDepth>();
 		RenderCompositor::registerNodeType<RCNodeHiZ>();
+		RenderCompositor::registerNodeType<RCNodeOcclusionDepth>();
 		RenderCompositor::registerNodeType<RCNodeSSAO>();
 		RenderCompositor::registerNodeType<RCNodeClusteredForward>();
 		RenderCompositor::registerNodeType<RCNodeSSR>();
@@ -114,6 +127,10 @@ namespace bs { namespace ct
 		// Make sure all tasks finish first
 		processTasks(true);
 
+		mFreeFrameTimers.clear();
+		while (!mActiveFrameTimers.empty())
+			mActiveFrameTimers.pop();
+
 		mScene = nullptr;
 
 		RenderCompositor::cleanUp();
@@ -122,8 +139,13 @@ namespace bs { namespace ct
 
 		bs_delete(mMainViewGroup);
 
+		if (mAuxViewGroup != nullptr)
+			bs_delete(mAuxViewGroup);
+
 		RendererTextures::shutDown();
 		IBLUtility::shutDown();
+
+		GpuMemoryBudget::instance().unregisterEvictionCallback(mMemoryEvictionCallback);
 		GpuResourcePool::shutDown();
 		RendererUtility::shutDown();
 	}
@@ -237,8 +259,10 @@ namespace bs { namespace ct
 
 		mScene->setOptions(mCoreOptions);
 
-		ShadowRendering& shadowRenderer = mMainViewGroup->getShadowRenderer();
-		shadowRenderer.setShadowMapSize(mCoreOptions->shadowMapSize);
+		mMainViewGroup->getShadowRenderer().setShadowMapSize(mCoreOptions->shadowMapSize);
+
+		if (mAuxViewGroup != nullptr)
+			mAuxViewGroup->getShadowRenderer().setShadowMapSize(mCoreOptions->shadowMapSize);
 	}
 
 	ShaderExtensionPointInfo RenderBeast::getShaderExtensionPointInfo(const String& name)
@@ -295,6 +319,9 @@ namespace bs { namespace ct
 		// Sync all dirty sim thread CoreObject data to core thread
 		CoreObjectManager::instance().syncToCore();
 
+		// Make data written to renderer extensions this frame visible to the core thread
+		_syncExtensionData();
+
 		if (mOptionsDirty)
 		{
 			gCoreThread().queueCommand(std::bind(&RenderBeast::syncOptions, this, *mOptions));
@@ -316,6 +343,34 @@ namespace bs { namespace ct
 		gProfilerGPU().beginFrame();
 		gProfilerCPU().beginSample("renderAllCore");
 
+		// Pick up GPU frame time measurements from earlier frames and start timing this one. Used for driving
+		// dynamic resolution scaling. We keep our own queries instead of using ProfilerGPU reports, as consuming
+		// those would steal them from the application.
+		while (!mActiveFrameTimers.empty() && mActiveFrameTimers.front()->isReady())
+		{
+			SPtr<TimerQuery> query = mActiveFrameTimers.front();
+			mActiveFrameTimers.pop();
+
+			float timeMs = query->getTimeMs();
+			if (mGpuFrameTimeMs <= 0.0f)
+				mGpuFrameTimeMs = timeMs;
+			else // Smooth the measurements so a single spiky frame doesn't cause a resolution change
+				mGpuFrameTimeMs += (timeMs - mGpuFrameTimeMs) * 0.25f;
+
+			mFreeFrameTimers.push_back(query);
+		}
+
+		SPtr<TimerQuery> frameTimer;
+		if (!mFreeFrameTimers.empty())
+		{
+			frameTimer = mFreeFrameTimers.back();
+			mFreeFrameTimers.pop_back();
+		}
+		else
+			frameTimer = TimerQuery::create();
+
+		frameTimer->begin();
+
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
 
 		// Note: I'm iterating over all sampler states every frame. If this ends up being a performance
@@ -326,6 +381,18 @@ namespace bs { namespace ct
 		// Update global per-frame hardware buffers
 		mScene->setParamFrameParams(timings.time);
 
+		// Merge newly added or removed static geometry into combined batch meshes
+		mScene->updateStaticBatches();
+
+		// Step velocity-driven objects locally, in place of per-frame transform syncs from the sim thread
+		mScene->extrapolateVelocities(timings.timeDelta);
+
+		// Flush any changed entries to the GPU scene object data buffer, used for GPU-driven culling
+		mScene->updateGpuObjectData();
+
+		// Reduce skinned vertex positions to tight culling bounds on the GPU, and pick up last frame's results
+		mScene->updateSkinnedBounds();
+
 		// Retrieve animation data
 		sceneInfo.renderableReady.resize(sceneInfo.renderables.size(), false);
 		sceneInfo.renderableReady.assign(sceneInfo.renderables.size(), false);
@@ -338,13 +405,9 @@ namespace bs { namespace ct
 		// Update reflection probe array if required
 		updateReflProbeArray();
 
-		// Gather all views
-		for (auto& rtInfo : sceneInfo.renderTargets)
+		// Gather views per render target
+		auto gatherViews = [&sceneInfo](const Vector<Camera*>& cameras, Vector<RendererView*>& views)
 		{
-			Vector<RendererView*> views;
-			SPtr<RenderTarget> target = rtInfo.target;
-			const Vector<Camera*>& cameras = rtInfo.cameras;
-
 			UINT32 numCameras = (UINT32)cameras.size();
 			for (UINT32 i = 0; i < numCameras; i++)
 			{
@@ -352,16 +415,161 @@ namespace bs { namespace ct
 				RendererView* viewInfo = sceneInfo.views[viewIdx];
 				views.push_back(viewInfo);
 			}
+		};
+
+		// Preview views render through a minimal path and refresh in round-robin order. All previews due this frame
+		// are batched into a single view group, sharing one visibility determination and frame setup pass instead of
+		// paying the per-target cost each.
+		auto isPreviewTarget = [&sceneInfo](const RendererRenderTarget& rtInfo)
+		{
+			if (rtInfo.cameras.empty() || rtInfo.target->getProperties().isWindow)
+				return false;
+
+			for (auto& camera : rtInfo.cameras)
+			{
+				UINT32 viewIdx = sceneInfo.cameraToView.at(camera);
+				if (!sceneInfo.views[viewIdx]->getRenderSettings().previewMode)
+					return false;
+			}
 
-			mMainViewGroup->setViews(views.data(), (UINT32)views.size());
+			return true;
+		};
+
+		Vector<const RendererRenderTarget*> normalTargets;
+		Vector<RendererView*> previewViews;
+		for (auto& rtInfo : sceneInfo.renderTargets)
+		{
+			if (!isPreviewTarget(rtInfo))
+			{
+				normalTargets.push_back(&rtInfo);
+				continue;
+			}
+
+			Vector<RendererView*> views;
+			gatherViews(rtInfo.cameras, views);
+
+			for (auto& view : views)
+			{
+				if (requiresRedraw(*view, timings.frameIdx))
+					previewViews.push_back(view);
+			}
+		}
+
+		if (!previewViews.empty())
+		{
+			mMainViewGroup->setViews(previewViews.data(), (UINT32)previewViews.size());
 			mMainViewGroup->determineVisibility(sceneInfo);
+			mMainViewGroup->updateGpuData(sceneInfo);
 
-			// Render everything
 			renderViews(*mMainViewGroup, frameInfo);
+		}
 
-			if(rtInfo.target->getProperties().isWindow)
-				RenderAPI::instance().swapBuffers(rtInfo.target);
+		UINT32 numRenderTargets = (UINT32)normalTargets.size();
+		bool overlappedExtraction = mCoreOptions->overlappedExtraction && numRenderTargets > 1;
+		if (!overlappedExtraction)
+		{
+			for (auto& rtInfoPtr : normalTargets)
+			{
+				const RendererRenderTarget& rtInfo = *rtInfoPtr;
+
+				Vector<RendererView*> views;
+				gatherViews(rtInfo.cameras, views);
+
+				// Skip both the re-render and the present for targets whose on-demand views have nothing new to draw
+				bool needsRedraw = views.empty();
+				for (auto& view : views)
+					needsRedraw |= requiresRedraw(*view, timings.frameIdx);
+
+				if (!needsRedraw)
+					continue;
+
+				mMainViewGroup->setViews(views.data(), (UINT32)views.size());
+				mMainViewGroup->determineVisibility(sceneInfo);
+				mMainViewGroup->updateGpuData(sceneInfo);
+
+				// Render everything
+				renderViews(*mMainViewGroup, frameInfo);
+
+				if(rtInfo.target->getProperties().isWindow)
+					RenderAPI::instance().swapBuffers(rtInfo.target);
+			}
 		}
+		else if (numRenderTargets > 0)
+		{
+			// Pipelined mode: while command recording and submission for the current render target runs on this thread,
+			// visibility determination and render queue generation for the next target runs on a worker, using the
+			// second view group so the two targets never share mutable per-group data.
+			if (mAuxViewGroup == nullptr)
+			{
+				mAuxViewGroup = bs_new<RendererViewGroup>();
+				mAuxViewGroup->getShadowRenderer().setShadowMapSize(mCoreOptions->shadowMapSize);
+			}
+
+			RendererViewGroup* viewGroups[] = { mMainViewGroup, mAuxViewGroup };
+
+			// Prime the pipeline by extracting the first target on this thread
+			{
+				Vector<RendererView*> views;
+				gatherViews(normalTargets[0]->cameras, views);
+
+				viewGroups[0]->setViews(views.data(), (UINT32)views.size());
+				viewGroups[0]->determineVisibility(sceneInfo);
+			}
+
+			SPtr<Task> extractionTask;
+			for (UINT32 i = 0; i < numRenderTargets; i++)
+			{
+				RendererViewGroup* curGroup = viewGroups[i % 2];
+
+				if ((i + 1) < numRenderTargets)
+				{
+					RendererViewGroup* nextGroup = viewGroups[(i + 1) % 2];
+
+					Vector<RendererView*> nextViews;
+					gatherViews(normalTargets[i + 1]->cameras, nextViews);
+
+					auto worker = [nextGroup, nextViews, &sceneInfo]() mutable
+					{
+						nextGroup->setViews(nextViews.data(), (UINT32)nextViews.size());
+						nextGroup->determineVisibility(sceneInfo);
+					};
+
+					extractionTask = Task::create("FrameExtraction", worker);
+					TaskScheduler::instance().addTask(extractionTask);
+				}
+
+				// Skip both the re-render and the present for targets whose on-demand views have nothing new to draw
+				UINT32 numGroupViews = curGroup->getNumViews();
+				bool needsRedraw = numGroupViews == 0;
+				for (UINT32 j = 0; j < numGroupViews; j++)
+					needsRedraw |= requiresRedraw(*curGroup->getView(j), timings.frameIdx);
+
+				if (needsRedraw)
+				{
+					// GPU buffer updates are excluded from the extraction task, which runs CPU culling only. They issue
+					// render API commands and must run on this thread.
+					curGroup->updateGpuData(sceneInfo);
+
+					renderViews(*curGroup, frameInfo);
+
+					const auto& rtInfo = *normalTargets[i];
+					if(rtInfo.target->getProperties().isWindow)
+						RenderAPI::instance().swapBuffers(rtInfo.target);
+				}
+
+				if (extractionTask != nullptr)
+				{
+					extractionTask->wait();
+					extractionTask = nullptr;
+				}
+			}
+		}
+
+		// Allow the resource pool to free any targets that haven't been used in a while
+		GpuResourcePool::instance().update();
+
+		frameTimer->end();
+		mActiveFrameTimers.push(frameTimer);
 
 		gProfilerGPU().endFrame();
 		gProfilerCPU().endSample("renderAllCore");
@@ -377,16 +585,42 @@ namespace bs { namespace ct
 		shadowRenderer.renderShadowMaps(*mScene, viewGroup, frameInfo);
 
 		// Update various buffers required by each renderable
+		UINT32 numViews = viewGroup.getNumViews();
 		UINT32 numRenderables = (UINT32)sceneInfo.renderables.size();
 		for (UINT32 i = 0; i < numRenderables; i++)
 		{
 			if (!visibility.renderables[i])
 				continue;
 
+			// For renderables with a LOD chain, pick a level depending on the largest on-screen size over all views
+			RendererObject* rendererObject = sceneInfo.renderables[i];
+			if (rendererObject->numLodLevels > 1)
+			{
+				const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
+
+				float screenSize = 0.0f;
+				for (UINT32 j = 0; j < numViews; j++)
+				{
+					const RendererViewProperties& viewProps = viewGroup.getView(j)->getProperties();
+
+					// Projected size of the bounds radius, relative to the view height
+					float size;
+					if (viewProps.projType == PT_PERSPECTIVE)
+					{
+						float distance = (bounds.getCenter() - viewProps.viewOrigin).length();
+						size = bounds.getRadius() * viewProps.projTransform[1][1] / std::max(distance, bounds.getRadius());
+					}
+					else
+						size = bounds.getRadius() * viewProps.projTransform[1][1];
+
+					screenSize = std::max(screenSize, size);
+				}
+
+				rendererObject->selectLod(screenSize);
+			}
+
 			mScene->prepareRenderable(i, frameInfo);
 		}
-
-		UINT32 numViews = viewGroup.getNumViews();
 		for (UINT32 i = 0; i < numViews; i++)
 		{
 			RendererView* view = viewGroup.getView(i);
@@ -395,7 +629,12 @@ namespace bs { namespace ct
 			if (settings.overlayOnly)
 				renderOverlay(*view);
 			else
+			{
+				// Note: Must happen before renderView() as it updates the per-view buffer, which renderView() flushes
+				view->_updateResolutionScaling(mGpuFrameTimeMs);
+
 				renderView(viewGroup, *view, frameInfo);
+			}
 		}
 	}
 
@@ -507,7 +746,46 @@ namespace bs { namespace ct
 
 		gProfilerCPU().endSample("RenderOverlay");
 	}
-	
+
+	bool RenderBeast::requiresRedraw(const RendererView& view, UINT64 frameIdx) const
+	{
+		const RenderSettings& settings = view.getRenderSettings();
+
+		// Preview views refresh in round-robin order, spreading the cost of many simultaneous previews across frames.
+		// Views explicitly marked for redraw (settings or transform changed) refresh regardless of their slot.
+		if (settings.previewMode && !settings.overlayOnly)
+		{
+			if (view._needsRedraw())
+				return true;
+
+			UINT32 interval = std::max(mCoreOptions->previewRefreshInterval, 1U);
+			return ((frameIdx + view.getViewIdx()) % interval) == 0;
+		}
+
+		// On-demand drawing relies on all of the view's content sources being able to report changes, which is only
+		// the case for overlay-only views - scene views are always redrawn
+		if (!settings.onDemandDrawing || !settings.overlayOnly)
+			return true;
+
+		if (view._needsRedraw())
+			return true;
+
+		const Camera* camera = view.getSceneCamera();
+		if (camera == nullptr)
+			return true;
+
+		for (auto& extension : mCallbacks)
+		{
+			if (extension->getLocation() != RenderLocation::Overlay)
+				continue;
+
+			if (extension->check(*camera) && extension->checkDirty(*camera))
+				return true;
+		}
+
+		return false;
+	}
+
 	void RenderBeast::updateReflProbeArray()
 	{
 		SceneInfo& sceneInfo = mScene->_getSceneInfo();
@@ -721,6 +999,7 @@ namespace bs { namespace ct
 
 		RendererViewGroup viewGroup(viewPtrs, 6, mCoreOptions->shadowMapSize);
 		viewGroup.determineVisibility(sceneInfo);
+		viewGroup.updateGpuData(sceneInfo);
 
 		FrameInfo frameInfo({ 0.0f, 1.0f / 60.0f, 0 });
 		renderViews(viewGroup, frameInfo);
@@ -72,6 +72,12 @@ namespace bs
 		/** Returns the feature set the renderer is operating on. Core thread only. */
 		RenderBeastFeatureSet getFeatureSet() const { return mFeatureSet; }
 
+		/** @copydoc Renderer::usesGpuMorphBlending */
+		bool usesGpuMorphBlending() const override { return mGpuMorphBlendingSupported; }
+
+		/** Returns the core thread version of the rendering options. Core thread only. */
+		const SPtr<RenderBeastOptions>& getCoreOptions() const { return mCoreOptions; }
+
 		/** @copydoc Renderer::initialize */
 		void initialize() override;
 
@@ -178,6 +184,16 @@ namespace bs
 		 */
 		void renderOverlay(RendererView& view);
 
+		/**
+		 * Checks does the provided view need to be drawn this frame. Always returns true unless the view uses
+		 * on-demand drawing, in which case the view only needs drawing if it was explicitly marked as such, or if
+		 * one of the registered overlay extensions reports new content for it. Preview views only need drawing on
+		 * their round-robin refresh slot, determined from the provided frame index.
+		 *
+		 * @note	Core thread only.
+		 */
+		bool requiresRedraw(const RendererView& view, UINT64 frameIdx) const;
+
 		/**	Creates data used by the renderer on the core thread. */
 		void initializeCore();
 
@@ -189,6 +205,8 @@ namespace bs
 
 		// Core thread only fields
 		RenderBeastFeatureSet mFeatureSet = RenderBeastFeatureSet::Desktop;
+		bool mGpuMorphBlendingSupported = false;
+		UINT32 mMemoryEvictionCallback = 0;
 
 		// Scene data
 		SPtr<RendererScene> mScene;
@@ -198,6 +216,19 @@ namespace bs
 		// Helpers to avoid memory allocations
 		RendererViewGroup* mMainViewGroup = nullptr;
 
+		// Secondary view group used when overlapped extraction is enabled, so extraction for the next render target can
+		// proceed while the previous target's data is still being submitted. Created on first use.
+		RendererViewGroup* mAuxViewGroup = nullptr;
+
+		// Timer queries measuring how long the GPU takes to render a frame, used for driving dynamic resolution
+		// scaling. Queries from previous frames remain in-flight until their results become available, after which
+		// they are recycled.
+		Vector<SPtr<TimerQuery>> mFreeFrameTimers;
+		Queue<SPtr<TimerQuery>> mActiveFrameTimers;
+
+		// Smoothed GPU frame time, in milliseconds. Zero if no measurement is available yet.
+		float mGpuFrameTimeMs = 0.0f;
+
 		// Sim thread only fields
 		SPtr<RenderBeastOptions> mOptions;
 		bool mOptionsDirty = true;
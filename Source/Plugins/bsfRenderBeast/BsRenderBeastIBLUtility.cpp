@@ -86,6 +86,55 @@ namespace bs { namespace ct
 		gRendererUtility().drawScreenQuad();
 	}
 
+	const UINT32 ReflectionCubeImportanceSampleComputeMat::NUM_SAMPLES = 1024;
+	ReflectionCubeImportanceSampleComputeParamDef gReflectionCubeImportanceSampleComputeParamDef;
+
+	// Must match the number of threads in a group as defined by the shader
+	const static UINT32 IMPORTANCE_SAMPLE_TILE_SIZE = 8;
+
+	ReflectionCubeImportanceSampleComputeMat::ReflectionCubeImportanceSampleComputeMat()
+	{
+		mParamBuffer = gReflectionCubeImportanceSampleComputeParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Input", mParamBuffer);
+		mParams->getTextureParam(GPT_COMPUTE_PROGRAM, "gInputTex", mInputTexture);
+		mParams->getLoadStoreTextureParam(GPT_COMPUTE_PROGRAM, "gOutputTex", mOutputTexture);
+	}
+
+	void ReflectionCubeImportanceSampleComputeMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("NUM_SAMPLES", NUM_SAMPLES);
+	}
+
+	void ReflectionCubeImportanceSampleComputeMat::execute(const SPtr<Texture>& source, const SPtr<Texture>& output,
+		UINT32 mip)
+	{
+		auto& srcProps = source->getProperties();
+		UINT32 mipSize = std::max(1U, output->getProperties().getWidth() >> mip);
+
+		mInputTexture.set(source);
+		mOutputTexture.set(output, TextureSurface(mip, 1, 0, 6));
+
+		gReflectionCubeImportanceSampleComputeParamDef.gMipLevel.set(mParamBuffer, mip);
+		gReflectionCubeImportanceSampleComputeParamDef.gNumMips.set(mParamBuffer, srcProps.getNumMipmaps() + 1);
+
+		float width = (float)srcProps.getWidth();
+		float height = (float)srcProps.getHeight();
+
+		// First part of the equation for determining mip level to sample from.
+		// See http://http.developer.nvidia.com/GPUGems3/gpugems3_ch20.html
+		float mipFactor = 0.5f * std::log2(width * height / NUM_SAMPLES);
+		gReflectionCubeImportanceSampleComputeParamDef.gPrecomputedMipFactor.set(mParamBuffer, mipFactor);
+		gReflectionCubeImportanceSampleComputeParamDef.gOutSize.set(mParamBuffer, mipSize);
+
+		bind();
+
+		UINT32 numGroups = Math::divideAndRoundUp(mipSize, IMPORTANCE_SAMPLE_TILE_SIZE);
+
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.dispatchCompute(numGroups, numGroups, 6);
+	}
+
 	IrradianceComputeSHParamDef gIrradianceComputeSHParamDef;
 
 	// TILE_WIDTH * TILE_HEIGHT must be pow2 because of parallel reduction algorithm
@@ -370,7 +419,23 @@ namespace bs { namespace ct
 		gRendererUtility().drawScreenQuad();
 	}
 
+	bool supportsCompute()
+	{
+		return gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
+	}
+
 	void RenderBeastIBLUtility::filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const
+	{
+		SPtr<Texture> scratchCubemap = filterCubemapForSpecularPrepare(cubemap, scratch);
+
+		// We sample the cubemaps using importance sampling to generate roughness
+		UINT32 numMips = cubemap->getProperties().getNumMipmaps();
+		for (UINT32 mip = 1; mip < numMips; mip++)
+			filterCubemapForSpecularMip(cubemap, scratchCubemap, mip);
+	}
+
+	SPtr<Texture> RenderBeastIBLUtility::filterCubemapForSpecularPrepare(const SPtr<Texture>& cubemap,
+		const SPtr<Texture>& scratch) const
 	{
 		auto& props = cubemap->getProperties();
 
@@ -388,14 +453,13 @@ namespace bs { namespace ct
 			scratchCubemap = Texture::create(cubemapDesc);
 		}
 
-		// We sample the cubemaps using importance sampling to generate roughness
 		UINT32 numMips = props.getNumMipmaps();
 
 		// Before importance sampling the cubemaps we first create box filtered versions for each mip level. This helps fix
 		// the aliasing artifacts that would otherwise be noticeable on importance sampled cubemaps. The aliasing happens
-		// because: 
+		// because:
 		//  1. We use the same random samples for all pixels, which appears to duplicate reflections instead of creating
-		//     noise, which is usually more acceptable 
+		//     noise, which is usually more acceptable
 		//  2. Even if we were to use fully random samples we would need a lot to avoid noticeable noise, which isn't
 		//     practical
 
@@ -416,37 +480,46 @@ namespace bs { namespace ct
 			downsampleCubemap(scratchCubemap, sourceMip, scratchCubemap, mip);
 		}
 
-		// Importance sample
-		for (UINT32 mip = 1; mip < numMips; mip++)
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.setRenderTarget(nullptr);
+
+		return scratchCubemap;
+	}
+
+	void RenderBeastIBLUtility::filterCubemapForSpecularMip(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+		UINT32 mip) const
+	{
+		// Importance sample the scratch cubemap into the destination mip level. The compute path filters all six faces
+		// in a single dispatch, but requires the destination to support load-store access.
+		bool useCompute = supportsCompute() && (cubemap->getProperties().getUsage() & TU_LOADSTORE) != 0;
+		if (useCompute)
 		{
-			for (UINT32 face = 0; face < 6; face++)
-			{
-				RENDER_TEXTURE_DESC cubeFaceRTDesc;
-				cubeFaceRTDesc.colorSurfaces[0].texture = cubemap;
-				cubeFaceRTDesc.colorSurfaces[0].face = face;
-				cubeFaceRTDesc.colorSurfaces[0].numFaces = 1;
-				cubeFaceRTDesc.colorSurfaces[0].mipLevel = mip;
+			ReflectionCubeImportanceSampleComputeMat::get()->execute(scratch, cubemap, mip);
+			return;
+		}
 
-				SPtr<RenderTarget> target = RenderTexture::create(cubeFaceRTDesc);
+		for (UINT32 face = 0; face < 6; face++)
+		{
+			RENDER_TEXTURE_DESC cubeFaceRTDesc;
+			cubeFaceRTDesc.colorSurfaces[0].texture = cubemap;
+			cubeFaceRTDesc.colorSurfaces[0].face = face;
+			cubeFaceRTDesc.colorSurfaces[0].numFaces = 1;
+			cubeFaceRTDesc.colorSurfaces[0].mipLevel = mip;
 
-				ReflectionCubeImportanceSampleMat* material = ReflectionCubeImportanceSampleMat::get();
-				material->execute(scratchCubemap, face, mip, target);
-			}
+			SPtr<RenderTarget> target = RenderTexture::create(cubeFaceRTDesc);
+
+			ReflectionCubeImportanceSampleMat* material = ReflectionCubeImportanceSampleMat::get();
+			material->execute(scratch, face, mip, target);
 		}
 
 		RenderAPI& rapi = RenderAPI::instance();
 		rapi.setRenderTarget(nullptr);
 	}
 
-	bool supportsComputeSH()
-	{
-		return gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
-	}
-
 	void RenderBeastIBLUtility::filterCubemapForIrradiance(const SPtr<Texture>& cubemap, const SPtr<Texture>& output) const
 	{
 		SPtr<Texture> coeffTexture;
-		if(supportsComputeSH())
+		if(supportsCompute())
 		{
 			IrradianceComputeSHMat* shCompute = IrradianceComputeSHMat::getVariation(5);
 			IrradianceReduceSHMat* shReduce = IrradianceReduceSHMat::getVariation(5);
@@ -485,7 +558,7 @@ namespace bs { namespace ct
 	void RenderBeastIBLUtility::filterCubemapForIrradiance(const SPtr<Texture>& cubemap, const SPtr<Texture>& output, 
 		UINT32 outputIdx) const
 	{
-		if(supportsComputeSH())
+		if(supportsCompute())
 		{
 			IrradianceComputeSHMat* shCompute = IrradianceComputeSHMat::getVariation(3);
 			IrradianceReduceSHMat* shReduce = IrradianceReduceSHMat::getVariation(3);
@@ -64,6 +64,40 @@ namespace bs { namespace ct
 		GpuParamTexture mInputTexture;
 	};
 
+	BS_PARAM_BLOCK_BEGIN(ReflectionCubeImportanceSampleComputeParamDef)
+		BS_PARAM_BLOCK_ENTRY(int, gMipLevel)
+		BS_PARAM_BLOCK_ENTRY(int, gNumMips)
+		BS_PARAM_BLOCK_ENTRY(float, gPrecomputedMipFactor)
+		BS_PARAM_BLOCK_ENTRY(int, gOutSize)
+	BS_PARAM_BLOCK_END
+
+	extern ReflectionCubeImportanceSampleComputeParamDef gReflectionCubeImportanceSampleComputeParamDef;
+
+	/**
+	 * Compute shader alternative to ReflectionCubeImportanceSampleMat that importance samples all six faces of a
+	 * destination mip level in a single dispatch, sharing the generated sample set between all threads in a group.
+	 */
+	class ReflectionCubeImportanceSampleComputeMat : public RendererMaterial<ReflectionCubeImportanceSampleComputeMat>
+	{
+		RMAT_DEF_CUSTOMIZED("ReflectionCubeImportanceSampleCompute.bsl")
+
+	public:
+		ReflectionCubeImportanceSampleComputeMat();
+
+		/**
+		 * Importance samples the provided texture and outputs the filtered data into the specified mip level of the
+		 * output cubemap. The output cubemap must be created with the load-store flag.
+		 */
+		void execute(const SPtr<Texture>& source, const SPtr<Texture>& output, UINT32 mip);
+
+	private:
+		static const UINT32 NUM_SAMPLES;
+
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamTexture mInputTexture;
+		GpuParamLoadStoreTexture mOutputTexture;
+	};
+
 	/** Vector representing spherical harmonic coefficients for 5 bands. */
 	struct SHVector5
 	{
@@ -352,6 +386,14 @@ namespace bs { namespace ct
 		/** @copydoc IBLUtility::filterCubemapForSpecular */
 		void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const override;
 
+		/** @copydoc IBLUtility::filterCubemapForSpecularPrepare */
+		SPtr<Texture> filterCubemapForSpecularPrepare(const SPtr<Texture>& cubemap,
+			const SPtr<Texture>& scratch) const override;
+
+		/** @copydoc IBLUtility::filterCubemapForSpecularMip */
+		void filterCubemapForSpecularMip(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+			UINT32 mip) const override;
+
 		/** @copydoc IBLUtility::filterCubemapForIrradiance(const SPtr<Texture>&, const SPtr<Texture>&) const */
 		void filterCubemapForIrradiance(const SPtr<Texture>& cubemap, const SPtr<Texture>& output) const override;
 
@@ -43,6 +43,46 @@ namespace bs { namespace ct
 		 * shadows far away, but will never increase the resolution past the provided value.
 		 */
 		UINT32 shadowMapSize = 2048;
+
+		/**
+		 * Determines should visibility determination and render queue generation be performed in parallel, using one
+		 * worker task per view. Reduces frame setup time when many views are rendered (e.g. multiple cameras, shadow
+		 * cascades, reflection probe captures), at the cost of occupying task scheduler workers.
+		 */
+		bool parallelCulling = false;
+
+		/**
+		 * When multiple render targets are rendered in a frame, overlaps visibility determination and render queue
+		 * generation (extraction) for the next target with command recording and submission for the current one.
+		 * Extraction runs on a worker task against a second set of view group data, so enabling this costs extra memory
+		 * (including a second set of shadow maps) and occupies an additional task scheduler worker. Helps when the core
+		 * thread is the bottleneck and worker cores are idle. Has no effect when only a single render target exists.
+		 */
+		bool overlappedExtraction = false;
+
+		/**
+		 * Merges the geometry of static renderables (ObjectMobility::Static, no animation, no LOD chain) that share a
+		 * material into combined vertex/index buffers, with world transforms baked into the vertices. Per-object culling
+		 * is retained, but draws of batched objects that end up adjacent in the render queue require no mesh or material
+		 * state changes between them, and batched objects need no per-object transform updates. Costs extra memory for
+		 * the merged buffers and triggers a rebuild whenever static geometry is added or removed, so it is intended for
+		 * scenes with large amounts of static geometry sharing materials.
+		 */
+		bool staticBatching = false;
+
+		/**
+		 * Minimum radius a radial or spot light must project to on a view, in pixels, in order to be rendered. Distant
+		 * lights below the threshold are culled during visibility determination, so they contribute no light assignment
+		 * cost and render no shadow maps, which is visually negligible at such sizes. Set to zero to disable.
+		 */
+		float minLightScreenRadius = 2.0f;
+
+		/**
+		 * Number of frames over which views with RenderSettings::previewMode enabled refresh, in round-robin order.
+		 * With the default of four, each preview view re-renders once every four frames, spreading the cost of many
+		 * live previews evenly across frames. Views marked for redraw are refreshed regardless of their slot.
+		 */
+		UINT32 previewRefreshInterval = 4;
 	};
 
 	/** @} */
@@ -6,6 +6,8 @@
 #include "Renderer/BsCamera.h"
 #include "Renderer/BsRendererUtility.h"
 #include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "Profiling/BsProfilerGPU.h"
 #include "Utility/BsBitwise.h"
 #include "Mesh/BsMesh.h"
 #include "Material/BsGpuParamsSet.h"
@@ -17,6 +19,7 @@
 #include "Shading/BsPostProcessing.h"
 #include "Shading/BsShadowRendering.h"
 #include "Shading/BsLightGrid.h"
+#include "Shading/BsGpuCulling.h"
 #include "BsRendererView.h"
 #include "BsRenderBeastOptions.h"
 #include "BsRendererScene.h"
@@ -24,6 +27,29 @@
 
 namespace bs { namespace ct
 {
+	namespace
+	{
+		/**
+		 * Checks can the provided queue entry be merged into the same instanced draw as the run of entries started by
+		 * @p first. Assumes the element of @p first was already determined to support instancing.
+		 */
+		bool canMergeInstancedDraw(const RenderQueueElement& first, const RenderQueueElement& other)
+		{
+			const auto* firstElem = static_cast<BeastRenderableElement*>(first.renderElem);
+			const auto* otherElem = static_cast<BeastRenderableElement*>(other.renderElem);
+
+			return other.passIdx == first.passIdx &&
+				otherElem->mesh == firstElem->mesh &&
+				otherElem->subMesh.indexOffset == firstElem->subMesh.indexOffset &&
+				otherElem->subMesh.indexCount == firstElem->subMesh.indexCount &&
+				otherElem->material == firstElem->material &&
+				otherElem->techniqueIdx == firstElem->techniqueIdx &&
+				otherElem->morphVertexDeclaration == nullptr &&
+				otherElem->animType == RenderableAnimType::None &&
+				(!(otherElem->instanceDataParam == nullptr) || !(otherElem->instanceLookupParam == nullptr));
+		}
+	}
+
 	UnorderedMap<StringID, RenderCompositor::NodeType*> RenderCompositor::mNodeTypes;
 
 	RenderCompositor::~RenderCompositor()
@@ -84,6 +110,7 @@ namespace bs { namespace ct
 
 					NodeInfo& nodeInfo = mNodeInfos.back();
 					nodeInfo.node = nodeType->create();
+					nodeInfo.id = nodeId;
 					nodeInfo.lastUseIdx = -1;
 
 					for (auto& depId : depIds)
@@ -144,7 +171,15 @@ namespace bs { namespace ct
 			for (auto& entry : mNodeInfos)
 			{
 				inputs.inputNodes = entry.inputs;
+
+				// Each node gets its own GPU profiler zone so regressions can be pinned to a specific node
+				gProfilerGPU().beginSample(ProfilerString(entry.id.cstr()));
 				entry.node->render(inputs);
+				gProfilerGPU().endSample(ProfilerString(entry.id.cstr()));
+
+				// Nodes may schedule work on the compute queue, and any cross-queue dependencies they didn't resolve
+				// themselves must be resolved before following nodes are allowed to consume their outputs
+				waitOnAsyncCompute();
 
 				activeNodes.push_back(&entry);
 
@@ -178,6 +213,47 @@ namespace bs { namespace ct
 		mIsValid = false;
 	}
 
+	SPtr<CommandBuffer> RenderCompositor::requestAsyncCompute() const
+	{
+		const RenderAPICapabilities& caps = RenderAPI::instance().getCapabilities(0);
+		if (!caps.hasCapability(RSC_ASYNC_COMPUTE))
+			return nullptr;
+
+		// Flush any graphics work recorded so far, so the compute queue submission is able to wait on it
+		RenderAPI::instance().submitCommandBuffer(nullptr);
+
+		if (mAsyncComputeCB == nullptr)
+			mAsyncComputeCB = CommandBuffer::create(GQT_COMPUTE);
+
+		return mAsyncComputeCB;
+	}
+
+	void RenderCompositor::submitAsyncCompute() const
+	{
+		if (mAsyncComputeCB == nullptr)
+			return;
+
+		// Compute work isn't allowed to begin until previously submitted graphics work (e.g. the base pass) finishes
+		// writing its inputs
+		UINT32 syncMask = CommandSyncMask::getGlobalQueueMask(GQT_GRAPHICS, 0);
+		RenderAPI::instance().submitCommandBuffer(mAsyncComputeCB, syncMask);
+
+		mAsyncComputePending = true;
+	}
+
+	void RenderCompositor::waitOnAsyncCompute() const
+	{
+		if (!mAsyncComputePending)
+			return;
+
+		// Submit the main command buffer with a dependency on the compute queue, guaranteeing any graphics work that
+		// follows only executes once the compute results are available
+		UINT32 syncMask = CommandSyncMask::getGlobalQueueMask(GQT_COMPUTE, 0);
+		RenderAPI::instance().submitCommandBuffer(nullptr, syncMask);
+
+		mAsyncComputePending = false;
+	}
+
 	void RCNodeSceneDepth::render(const RenderCompositorNodeInputs& inputs)
 	{
 		GpuResourcePool& resPool = GpuResourcePool::instance();
@@ -314,24 +390,168 @@ namespace bs { namespace ct
 			}
 		}
 
-		// Render all visible opaque elements that use the deferred pipeline
-		const Vector<RenderQueueElement>& opaqueElements = inputs.view.getOpaqueQueue(false)->getSortedElements();
-		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
+		// Render all visible opaque elements that use the deferred pipeline. Consecutive elements whose shader supports
+		// instancing and that share mesh & material state are merged into a single instanced draw. Since the queue is
+		// sorted so that identical state ends up adjacent, this catches most mergeable draws.
+		const RenderQueueElementList opaqueElements = inputs.view.getOpaqueQueue(false)->getSortedElements();
+		UINT32 numOpaqueElements = opaqueElements.size();
+
+		bool gpuCullingSupported = inputs.scene.objectDataBuffer != nullptr &&
+			RenderAPI::instance().getCapabilities(0).hasCapability(RSC_DRAW_INDIRECT);
+
+		for (UINT32 i = 0; i < numOpaqueElements;)
 		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
+			const RenderQueueElement& entry = opaqueElements[i];
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(entry.renderElem);
+
+			bool supportsInstancing = !(renderElem->instanceDataParam == nullptr) ||
+				(gpuCullingSupported && !(renderElem->instanceLookupParam == nullptr));
+
+			UINT32 numInstances = 1;
+			if (supportsInstancing && renderElem->morphVertexDeclaration == nullptr &&
+				renderElem->animType == RenderableAnimType::None)
+			{
+				while (i + numInstances < numOpaqueElements &&
+					canMergeInstancedDraw(entry, opaqueElements[i + numInstances]))
+					numInstances++;
+			}
 
 			SPtr<Material> material = renderElem->material;
 
-			if (iter->applyPass)
-				gRendererUtility().setPass(material, iter->passIdx, renderElem->techniqueIdx);
+			if (entry.applyPass)
+				gRendererUtility().setPass(material, entry.passIdx, renderElem->techniqueIdx);
+
+			// Prefer the GPU-driven path when the shader and backend support it, as it avoids re-generating and
+			// re-uploading per-instance transforms every frame
+			bool gpuDriven = numInstances > 1 && gpuCullingSupported &&
+				!(renderElem->instanceLookupParam == nullptr);
+
+			if (gpuDriven)
+			{
+				// Gather indices into the scene object data buffer for all instances of this run
+				mCullInputIndices.clear();
+				for (UINT32 j = 0; j < numInstances; j++)
+				{
+					const auto* elem = static_cast<BeastRenderableElement*>(opaqueElements[i + j].renderElem);
+					mCullInputIndices.push_back(elem->renderableId);
+				}
+
+				UINT32 curElementCount = mCullInputBuffer != nullptr ?
+					mCullInputBuffer->getProperties().getElementCount() : 0;
+				if (numInstances > curElementCount)
+				{
+					GPU_BUFFER_DESC bufferDesc;
+					bufferDesc.type = GBT_STANDARD;
+					bufferDesc.elementCount = Bitwise::nextPow2(numInstances);
+					bufferDesc.elementSize = 0;
+					bufferDesc.format = BF_32X1U;
+					bufferDesc.usage = GBU_DYNAMIC;
+
+					mCullInputBuffer = GpuBuffer::create(bufferDesc);
+
+					bufferDesc.usage = GBU_STATIC;
+					bufferDesc.randomGpuWrite = true;
+					mCullOutputBuffer = GpuBuffer::create(bufferDesc);
+				}
+
+				if (mCullArgsBuffer == nullptr)
+				{
+					// Compute-writable copy of the draw arguments. Written by the culling shader, then copied into
+					// the actual indirect argument buffer, as the latter cannot be written from a GPU program on all
+					// backends.
+					GPU_BUFFER_DESC bufferDesc;
+					bufferDesc.type = GBT_STANDARD;
+					bufferDesc.elementCount = sizeof(DrawIndexedIndirectArgs) / sizeof(UINT32);
+					bufferDesc.elementSize = 0;
+					bufferDesc.format = BF_32X1U;
+					bufferDesc.randomGpuWrite = true;
+
+					mCullArgsBuffer = GpuBuffer::create(bufferDesc);
+
+					bufferDesc.type = GBT_INDIRECTARGUMENT;
+					bufferDesc.elementCount = 1;
+					bufferDesc.elementSize = sizeof(DrawIndexedIndirectArgs);
+					bufferDesc.format = BF_UNKNOWN;
+					bufferDesc.randomGpuWrite = false;
+
+					mIndirectArgsBuffer = GpuBuffer::create(bufferDesc);
+				}
+
+				mCullInputBuffer->writeData(0, numInstances * sizeof(UINT32), mCullInputIndices.data(), BWT_DISCARD);
+
+				// Pre-fill everything except the instance count, which the culling shader increments
+				DrawIndexedIndirectArgs drawArgs;
+				drawArgs.indexCount = renderElem->subMesh.indexCount;
+				drawArgs.instanceCount = 0;
+				drawArgs.firstIndex = renderElem->subMesh.indexOffset + renderElem->mesh->getIndexOffset();
+				drawArgs.vertexOffset = (INT32)renderElem->mesh->getVertexOffset();
+				drawArgs.firstInstance = 0;
+
+				mCullArgsBuffer->writeData(0, sizeof(drawArgs), &drawArgs, BWT_DISCARD);
+
+				GpuCullMat::get()->execute(inputs.view.getProperties().cullFrustum, numInstances,
+					inputs.scene.objectDataBuffer, mCullInputBuffer, mCullOutputBuffer, mCullArgsBuffer);
+
+				mIndirectArgsBuffer->copyData(*mCullArgsBuffer);
+
+				renderElem->objectDataParam.set(inputs.scene.objectDataBuffer);
+				renderElem->instanceLookupParam.set(mCullOutputBuffer);
+
+				gRendererUtility().setPassParams(renderElem->params, entry.passIdx);
+				gRendererUtility().drawIndirect(renderElem->mesh, renderElem->subMesh, mIndirectArgsBuffer);
+
+				i += numInstances;
+				continue;
+			}
+
+			if (numInstances > 1)
+			{
+				// Gather world transforms of all the instances and upload them to the instance buffer
+				mInstanceData.clear();
+				for (UINT32 j = 0; j < numInstances; j++)
+				{
+					const auto* elem = static_cast<BeastRenderableElement*>(opaqueElements[i + j].renderElem);
+					Renderable* renderable = inputs.scene.renderables[elem->renderableId]->renderable;
 
-			gRendererUtility().setPassParams(renderElem->params, iter->passIdx);
+					mInstanceData.push_back(PerInstanceData());
+					PerInstanceData& instanceData = mInstanceData.back();
+
+					Matrix4 worldTransform = renderable->getMatrix();
+					Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
+
+					instanceData.gMatWorld = worldTransform;
+					instanceData.gMatInvWorld = worldTransform.inverseAffine();
+					instanceData.gMatWorldNoScale = worldNoScaleTransform;
+					instanceData.gMatInvWorldNoScale = worldNoScaleTransform.inverseAffine();
+					instanceData.gWorldDeterminantSign = worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
+				}
+
+				UINT32 size = numInstances * (UINT32)sizeof(PerInstanceData);
+				UINT32 curBufferSize = mInstanceDataBuffer != nullptr ? mInstanceDataBuffer->getSize() : 0;
+				if (size > curBufferSize)
+				{
+					GPU_BUFFER_DESC bufferDesc;
+					bufferDesc.type = GBT_STRUCTURED;
+					bufferDesc.elementCount = Bitwise::nextPow2(numInstances);
+					bufferDesc.elementSize = sizeof(PerInstanceData);
+					bufferDesc.format = BF_UNKNOWN;
+
+					mInstanceDataBuffer = GpuBuffer::create(bufferDesc);
+				}
+
+				mInstanceDataBuffer->writeData(0, size, mInstanceData.data(), BWT_DISCARD);
+				renderElem->instanceDataParam.set(mInstanceDataBuffer);
+			}
+
+			gRendererUtility().setPassParams(renderElem->params, entry.passIdx);
 
 			if(renderElem->morphVertexDeclaration == nullptr)
-				gRendererUtility().draw(renderElem->mesh, renderElem->subMesh);
+				gRendererUtility().draw(renderElem->mesh, renderElem->subMesh, numInstances);
 			else
-				gRendererUtility().drawMorph(renderElem->mesh, renderElem->subMesh, renderElem->morphShapeBuffer, 
+				gRendererUtility().drawMorph(renderElem->mesh, renderElem->subMesh, renderElem->morphShapeBuffer,
 					renderElem->morphVertexDeclaration);
+
+			i += numInstances;
 		}
 
 		// Make sure that any compute shaders are able to read g-buffer by unbinding it
@@ -646,11 +866,22 @@ namespace bs { namespace ct
 			if (output->flattenedLightAccumBuffer)
 				flattenedLightAccumBuffer = output->flattenedLightAccumBuffer->buffer;
 
-			tiledDeferredMat->execute(inputs.view, lightData, gbuffer, output->lightAccumulationTex->texture, 
-				flattenedLightAccumBuffer, msaaCoverage);
+			// When supported, execute the dispatch on a dedicated compute queue, allowing it to overlap any graphics
+			// work submitted before the results are consumed (e.g. light occlusion rasterization below)
+			const RenderCompositor& compositor = inputs.view.getCompositor();
+			SPtr<CommandBuffer> computeCB = compositor.requestAsyncCompute();
+
+			tiledDeferredMat->execute(inputs.view, lightData, gbuffer, output->lightAccumulationTex->texture,
+				flattenedLightAccumBuffer, msaaCoverage, computeCB);
+
+			if (computeCB != nullptr)
+				compositor.submitAsyncCompute();
 
 			if (viewProps.numSamples > 1)
+			{
+				compositor.waitOnAsyncCompute();
 				output->unflatten();
+			}
 
 			// If shadows are disabled we handle all lights through tiled deferred so we can exit immediately
 			if (!inputs.view.getRenderSettings().enableShadows)
@@ -743,6 +974,10 @@ namespace bs { namespace ct
 				const RendererLight& light = *lights[lightIdx];
 				shadowRenderer.renderShadowOcclusion(inputs.view, light, gbuffer);
 
+				// Light accumulation is potentially still being written by the compute queue, and must not be bound
+				// before that work completes. Occlusion rasterization above doesn't touch it and is free to overlap.
+				inputs.view.getCompositor().waitOnAsyncCompute();
+
 				rapi.setRenderTarget(output->renderTarget, FBT_DEPTH | FBT_STENCIL, RT_COLOR0 | RT_DEPTH_STENCIL);
 				StandardDeferred::instance().renderLight(lightType, light, inputs.view, gbuffer,
 					lightOcclusionTex->texture);
@@ -902,10 +1137,21 @@ namespace bs { namespace ct
 			if (sceneColorNode->flattenedSceneColorBuffer)
 				iblInputs.sceneColorBuffer = sceneColorNode->flattenedSceneColorBuffer->buffer;
 
-			material->execute(inputs.view, inputs.scene, inputs.viewGroup.getVisibleReflProbeData(), iblInputs);
+			// Compute-only node, allow it to execute on a dedicated compute queue when one is available
+			const RenderCompositor& compositor = inputs.view.getCompositor();
+			SPtr<CommandBuffer> computeCB = compositor.requestAsyncCompute();
+
+			material->execute(inputs.view, inputs.scene, inputs.viewGroup.getVisibleReflProbeData(), iblInputs,
+				computeCB);
+
+			if (computeCB != nullptr)
+				compositor.submitAsyncCompute();
 
 			if(viewProps.numSamples > 1)
+			{
+				compositor.waitOnAsyncCompute();
 				sceneColorNode->unflatten();
+			}
 		}
 		else // Standard deferred
 		{
@@ -1235,15 +1481,20 @@ namespace bs { namespace ct
 		RenderAPI& rapi = RenderAPI::instance();
 		rapi.setRenderTarget(renderTarget, 0, RT_ALL);
 
+		// Note: The unordered queue contains only order independent blend modes, so its internal draw order doesn't
+		// matter. Drawing it after the distance sorted queue means unordered objects are never attenuated by sorted
+		// ones (e.g. an additive effect seen through alpha blended glass), which is the one deviation from fully
+		// sorted rendering.
 		RenderQueue* queues[] =
 		{
 			inputs.view.getOpaqueQueue(true).get(),
-			inputs.view.getTransparentQueue().get()
+			inputs.view.getTransparentQueue().get(),
+			inputs.view.getUnorderedTransparentQueue().get()
 		};
 
 		for(UINT32 i = 0; i < bs_size(queues); i++)
 		{
-			const Vector<RenderQueueElement>& elements = queues[i]->getSortedElements();
+			const RenderQueueElementList elements = queues[i]->getSortedElements();
 			for (auto iter = elements.begin(); iter != elements.end(); ++iter)
 			{
 				BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
@@ -1354,7 +1605,10 @@ namespace bs { namespace ct
 		rapi.setRenderTarget(target);
 		rapi.setViewport(viewProps.nrmViewRect);
 
-		gRendererUtility().blit(input, Rect2I::EMPTY, viewProps.flipView);
+		// When dynamic resolution scaling rendered the scene at a lower resolution, resample it to the output
+		// viewport with bilinear filtering instead of doing a 1:1 copy
+		const bool rescale = inputs.view.getResolutionScale() != 1.0f;
+		gRendererUtility().blit(input, Rect2I::EMPTY, viewProps.flipView, false, rescale);
 
 		if(viewProps.encodeDepth)
 		{
@@ -1399,6 +1653,9 @@ namespace bs { namespace ct
 		if(viewProps.encodeDepth)
 			deps.push_back(RCNodeResolvedSceneDepth::getNodeId());
 
+		if(view.getRenderSettings().enableOcclusionCulling)
+			deps.push_back(RCNodeOcclusionDepth::getNodeId());
+
 		return deps;
 	}
 
@@ -1927,6 +2184,98 @@ namespace bs { namespace ct
 		return { RCNodeResolvedSceneDepth::getNodeId(), RCNodeGBuffer::getNodeId() };
 	}
 
+	void RCNodeOcclusionDepth::render(const RenderCompositorNodeInputs& inputs)
+	{
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		const RendererViewProperties& viewProps = inputs.view.getProperties();
+
+		RCNodeResolvedSceneDepth* resolvedSceneDepth = static_cast<RCNodeResolvedSceneDepth*>(inputs.inputNodes[0]);
+
+		UINT32 width = viewProps.viewRect.width;
+		UINT32 height = viewProps.viewRect.height;
+
+		UINT32 size = Bitwise::nextPow2(std::max(width, height));
+		UINT32 numMips = PixelUtil::getMaxMipmaps(size, size, 1, PF_R32F);
+		size = 1 << numMips;
+
+		// Only generate mips down to the resolution used for the CPU-side occlusion tests
+		constexpr UINT32 CAPTURE_SIZE = 64;
+
+		UINT32 lastMip = 0;
+		while ((size >> lastMip) > CAPTURE_SIZE)
+			lastMip++;
+
+		mPyramid = resPool.get(POOLED_RENDER_TEXTURE_DESC::create2D(PF_R32F, size, size, TU_RENDERTARGET, 1, false, 1,
+			lastMip));
+
+		Rect2 srcRect = viewProps.nrmViewRect;
+
+		// If viewport size is odd, adjust UV
+		srcRect.width += (viewProps.viewRect.width % 2) * (1.0f / viewProps.viewRect.width);
+		srcRect.height += (viewProps.viewRect.height % 2) * (1.0f / viewProps.viewRect.height);
+
+		const RenderAPIInfo& rapiInfo = RenderAPI::instance().getAPIInfo();
+		bool noTextureViews = !rapiInfo.isFlagSet(RenderAPIFeatureFlag::TextureViews);
+
+		BuildHiZMat* material = BuildHiZMat::getVariation(noTextureViews, true);
+
+		Rect2 destRect(0, 0,
+			viewProps.viewRect.width / (float)size,
+			viewProps.viewRect.height / (float)size);
+
+		RenderAPI& rapi = RenderAPI::instance();
+
+		// First level is just a copy of the depth buffer. Texels outside of the view area are cleared to the nearest
+		// depth, so that any reduction that pulls them in stays conservative (they can never act as occluders).
+		RENDER_TEXTURE_DESC rtDesc;
+		rtDesc.colorSurfaces[0].texture = mPyramid->texture;
+		rtDesc.colorSurfaces[0].mipLevel = 0;
+
+		SPtr<RenderTexture> rt = RenderTexture::create(rtDesc);
+
+		rapi.setRenderTarget(rt);
+		rapi.clearRenderTarget(FBT_COLOR, Color::ZERO);
+		rapi.setViewport(destRect);
+
+		Rect2I srcAreaInt;
+		srcAreaInt.x = (INT32)(srcRect.x * viewProps.viewRect.width);
+		srcAreaInt.y = (INT32)(srcRect.y * viewProps.viewRect.height);
+		srcAreaInt.width = (UINT32)(srcRect.width * viewProps.viewRect.width);
+		srcAreaInt.height = (UINT32)(srcRect.height * viewProps.viewRect.height);
+
+		gRendererUtility().blit(resolvedSceneDepth->output->texture, srcAreaInt);
+		rapi.setViewport(Rect2(0, 0, 1, 1));
+
+		// Generate remaining mip levels using a max reduction
+		for(UINT32 i = 1; i <= lastMip; i++)
+		{
+			rtDesc.colorSurfaces[0].mipLevel = i;
+			rt = RenderTexture::create(rtDesc);
+
+			rapi.setRenderTarget(rt);
+			rapi.clearRenderTarget(FBT_COLOR, Color::ZERO);
+
+			material->execute(mPyramid->texture, i - 1, destRect, destRect, rt);
+		}
+
+		UINT32 validWidth = Math::divideAndRoundUp(width, 1U << lastMip);
+		UINT32 validHeight = Math::divideAndRoundUp(height, 1U << lastMip);
+
+		inputs.view._captureOcclusionDepth(mPyramid->texture, lastMip, validWidth, validHeight);
+	}
+
+	void RCNodeOcclusionDepth::clear()
+	{
+		GpuResourcePool& resPool = GpuResourcePool::instance();
+		resPool.release(mPyramid);
+	}
+
+	SmallVector<StringID, 4> RCNodeOcclusionDepth::getDependencies(const RendererView& view)
+	{
+		// Note: Same as with HiZ, the gbuffer dependency is only here because the base pass renders the depth buffer.
+		return { RCNodeResolvedSceneDepth::getNodeId(), RCNodeGBuffer::getNodeId() };
+	}
+
 	void RCNodeSSAO::render(const RenderCompositorNodeInputs& inputs)
 	{
 		/** Maximum valid depth range within samples in a sample set. In meters. */
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsRenderBeastPrerequisites.h"
+#include "BsRendererObject.h"
 
 namespace bs 
 { 
@@ -81,6 +82,7 @@ namespace ct
 		struct NodeInfo
 		{
 			RenderCompositorNode* node;
+			StringID id;
 			UINT32 lastUseIdx;
 			SmallVector<RenderCompositorNode*, 4> inputs;
 		};
@@ -101,6 +103,31 @@ namespace ct
 		/** Performs rendering using the current render node hierarchy. This is expected to be called once per frame. */
 		void execute(RenderCompositorNodeInputs& inputs) const;
 
+		/**
+		 * Returns a command buffer that compute-only nodes can record their work on, in order to execute it on a
+		 * dedicated compute queue, in parallel with work on the graphics queue. Any graphics work recorded so far is
+		 * flushed so the compute queue is able to synchronize against it. Returns null when the render backend has no
+		 * dedicated compute queue, in which case the caller is expected to record its commands on the main command
+		 * buffer instead.
+		 */
+		SPtr<CommandBuffer> requestAsyncCompute() const;
+
+		/**
+		 * Submits work recorded on the command buffer returned from requestAsyncCompute() to the compute queue. The
+		 * work is guaranteed not to begin until all previously submitted graphics queue work completes. The caller must
+		 * ensure waitOnAsyncCompute() is triggered before any graphics work reads or writes resources used by the
+		 * submitted work.
+		 */
+		void submitAsyncCompute() const;
+
+		/**
+		 * Guarantees all compute queue work submitted through submitAsyncCompute() completes before any subsequently
+		 * submitted graphics queue work begins. Only graphics work submitted between the submit and this call is able
+		 * to overlap the compute queue work. Does nothing if no async compute work is pending. This is called
+		 * automatically after each node's render, but nodes that consume the results themselves must call it manually.
+		 */
+		void waitOnAsyncCompute() const;
+
 	private:
 		/** Clears the render node hierarchy. */
 		void clear();
@@ -108,6 +135,9 @@ namespace ct
 		Vector<NodeInfo> mNodeInfos;
 		bool mIsValid = false;
 
+		mutable SPtr<CommandBuffer> mAsyncComputeCB;
+		mutable bool mAsyncComputePending = false;
+
 		/************************************************************************/
 		/* 							NODE TYPES	                     			*/
 		/************************************************************************/
@@ -210,6 +240,16 @@ namespace ct
 
 		/** @copydoc RenderCompositorNode::clear */
 		void clear() override;
+
+		Vector<PerInstanceData> mInstanceData;
+		SPtr<GpuBuffer> mInstanceDataBuffer;
+
+		// Transient buffers for the GPU-driven culling path
+		Vector<UINT32> mCullInputIndices;
+		SPtr<GpuBuffer> mCullInputBuffer;
+		SPtr<GpuBuffer> mCullOutputBuffer;
+		SPtr<GpuBuffer> mCullArgsBuffer;
+		SPtr<GpuBuffer> mIndirectArgsBuffer;
 	};
 
 	/** Initializes the scene color texture and/or buffer. Does not perform any rendering. */
@@ -550,6 +590,25 @@ namespace ct
 		void clear() override;
 	};
 
+	/**
+	 * Builds a low resolution conservative (farthest) depth buffer from the scene depth and stores it in the view,
+	 * where it is used for occlusion culling during following frames.
+	 */
+	class RCNodeOcclusionDepth : public RenderCompositorNode
+	{
+	public:
+		static StringID getNodeId() { return "OcclusionDepth"; }
+		static SmallVector<StringID, 4> getDependencies(const RendererView& view);
+	protected:
+		/** @copydoc RenderCompositorNode::render */
+		void render(const RenderCompositorNodeInputs& inputs) override;
+
+		/** @copydoc RenderCompositorNode::clear */
+		void clear() override;
+
+		SPtr<PooledRenderTexture> mPyramid;
+	};
+
 	/** Renders screen space ambient occlusion. */
 	class RCNodeSSAO : public RenderCompositorNode
 	{
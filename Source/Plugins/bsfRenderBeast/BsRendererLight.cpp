@@ -141,7 +141,7 @@ namespace bs { namespace ct
 	}
 
 	VisibleLightData::VisibleLightData()
-		:mNumLights{}, mNumShadowedLights{}
+		:mNumLights{}, mNumShadowedLights{}, mLightDataHash(0)
 	{ }
 
 	void VisibleLightData::update(const SceneInfo& sceneInfo, const RendererViewGroup& viewGroup)
@@ -222,6 +222,8 @@ namespace bs { namespace ct
 			}
 		}
 
+		mLightDataHash = bs_hash_data(mVisibleLightData.data(), mVisibleLightData.size() * sizeof(LightData));
+
 		bool supportsStructuredBuffers = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
 		if(supportsStructuredBuffers)
 		{
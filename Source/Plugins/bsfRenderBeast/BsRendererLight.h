@@ -107,6 +107,12 @@ namespace ct
 		/** Returns a GPU bindable buffer containing information about every light. */
 		SPtr<GpuBuffer> getLightBuffer() const { return mLightBuffer; }
 
+		/**
+		 * Returns a hash of the contents of the light buffer. The hash changes whenever the set of visible lights, or
+		 * any parameter of a visible light changes.
+		 */
+		UINT64 getLightDataHash() const { return mLightDataHash; }
+
 		/** 
 		 * Scans the list of lights visible in the view frustum to find the ones influencing the object described by
 		 * the provided bounds. A maximum number of STANDARD_FORWARD_MAX_NUM_LIGHTS will be output. If there are more
@@ -146,6 +152,7 @@ namespace ct
 
 		UINT32 mNumLights[(UINT32)LightType::Count];
 		UINT32 mNumShadowedLights[(UINT32)LightType::Count];
+		UINT64 mLightDataHash;
 
 		// These are rebuilt every call to update()
 		Vector<const RendererLight*> mVisibleLights[(UINT32)LightType::Count];
@@ -15,8 +15,9 @@ namespace bs { namespace ct
 
 	void RendererObject::updatePerObjectBuffer()
 	{
-		Matrix4 worldTransform = renderable->getMatrix();
-		Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
+		// Transforms of statically batched objects are baked into the mesh vertices
+		Matrix4 worldTransform = staticBatched ? Matrix4::IDENTITY : renderable->getMatrix();
+		Matrix4 worldNoScaleTransform = staticBatched ? Matrix4::IDENTITY : renderable->getMatrixNoScale();
 
 		gPerObjectParamDef.gMatWorld.set(perObjectParamBuffer, worldTransform);
 		gPerObjectParamDef.gMatInvWorld.set(perObjectParamBuffer, worldTransform.inverseAffine());
@@ -27,11 +28,27 @@ namespace bs { namespace ct
 
 	void RendererObject::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
 	{
-		Matrix4 worldViewProjMatrix = viewProj * renderable->getMatrix();
+		Matrix4 worldViewProjMatrix = staticBatched ? viewProj : viewProj * renderable->getMatrix();
 
 		gPerCallParamDef.gMatWorldViewProj.set(perCallParamBuffer, worldViewProjMatrix);
 
 		if(flush)
 			perCallParamBuffer->flushToGPU();
 	}
+
+	void RendererObject::selectLod(float screenSize)
+	{
+		UINT32 lodLevel = 0;
+		while (lodLevel + 1 < numLodLevels && screenSize < lodScreenSizes[lodLevel])
+			lodLevel++;
+
+		if (lodLevel == currentLod)
+			return;
+
+		currentLod = lodLevel;
+
+		UINT32 numElements = (UINT32)elements.size();
+		for (UINT32 i = 0; i < numElements; i++)
+			elements[i].subMesh = lodSubMeshes[lodLevel * numElements + i];
+	}
 }}
\ No newline at end of file
@@ -32,6 +32,37 @@ namespace bs { namespace ct
 
 	extern PerCallParamDef gPerCallParamDef;
 
+	/**
+	 * Contains world transform data for a single instance of an instanced draw. Layout must match the entries of the
+	 * gInstanceData structured buffer expected by shaders that support instanced rendering.
+	 */
+	struct PerInstanceData
+	{
+		Matrix4 gMatWorld;
+		Matrix4 gMatInvWorld;
+		Matrix4 gMatWorldNoScale;
+		Matrix4 gMatInvWorldNoScale;
+		float gWorldDeterminantSign;
+		Vector3 padding;
+	};
+
+	/**
+	 * Per-object entry of the persistent scene object data buffer, used for GPU-driven culling and instanced rendering.
+	 * Starts with the same layout as PerInstanceData so vertex shaders can read the transforms directly, followed by
+	 * the object's world space bounding sphere used by the culling compute shader. Layout must match the entries of the
+	 * gObjectData structured buffer expected by GpuCull.bsl and by shaders supporting GPU-driven instancing.
+	 */
+	struct GpuSceneObjectData
+	{
+		Matrix4 gMatWorld;
+		Matrix4 gMatInvWorld;
+		Matrix4 gMatWorldNoScale;
+		Matrix4 gMatInvWorldNoScale;
+		float gWorldDeterminantSign;
+		Vector3 padding;
+		Vector4 gBoundsSphere; /**< .xyz is the sphere center, .w the radius, both in world space. */
+	};
+
 	struct MaterialSamplerOverrides;
 
 	/**
@@ -63,6 +94,12 @@ namespace bs { namespace ct
 		/** Index of the technique in the material to render the element with. */
 		UINT32 techniqueIdx;
 
+		/**
+		 * True if all passes of the element's material blend in an order independent way (e.g. additively), allowing
+		 * the renderer to sort the element for batching instead of by distance.
+		 */
+		bool orderIndependentBlend = false;
+
 		/** Binding indices representing where should the per-camera param block buffer be bound to. */
 		GpuParamBinding perCameraBindings[GPT_COUNT];
 
@@ -102,6 +139,24 @@ namespace bs { namespace ct
 		 */
 		GpuParamBinding lightAndReflProbeParamsParamBlockBinding;
 
+		/**
+		 * Parameter to which to bind a structured buffer of PerInstanceData entries, when the element's shader supports
+		 * instanced rendering. Not set otherwise, in which case the element is never part of an instanced draw.
+		 */
+		GpuParamBuffer instanceDataParam;
+
+		/**
+		 * Parameter to which to bind the persistent scene buffer of GpuSceneObjectData entries, when the element's shader
+		 * supports GPU-driven instanced rendering. Used together with instanceLookupParam.
+		 */
+		GpuParamBuffer objectDataParam;
+
+		/**
+		 * Parameter to which to bind a buffer of indices into the scene object data buffer, one per surviving instance,
+		 * as output by the GPU culling shader. Only set when the element's shader supports GPU-driven instanced rendering.
+		 */
+		GpuParamBuffer instanceLookupParam;
+
 		/** GPU buffer containing element's bone matrices, if it requires any. */
 		SPtr<GpuBuffer> boneMatrixBuffer;
 
@@ -123,17 +178,54 @@ namespace bs { namespace ct
 		/** Updates the per-object GPU buffer according to the currently set properties. */
 		void updatePerObjectBuffer();
 
-		/** 
-		 * Updates the per-call GPU buffer according to the provided parameters. 
-		 * 
+		/**
+		 * Updates the per-call GPU buffer according to the provided parameters.
+		 *
 		 * @param[in]	viewProj	Combined view-projection matrix of the current camera.
 		 * @param[in]	flush		True if the buffer contents should be immediately flushed to the GPU.
 		 */
 		void updatePerCallBuffer(const Matrix4& viewProj, bool flush = true);
 
+		/**
+		 * Picks the level of detail to render the object's mesh with, depending on the on-screen size of the object's
+		 * bounds, as a fraction of the view height. Updates the sub-mesh ranges of all renderable elements when the
+		 * picked level differs from the current one. Only relevant for meshes with a LOD chain.
+		 */
+		void selectLod(float screenSize);
+
 		Renderable* renderable;
 		Vector<BeastRenderableElement> elements;
 
+		/** Sub-meshes of all the levels in the mesh's LOD chain, grouped by level. One entry per element, per level. */
+		Vector<SubMesh> lodSubMeshes;
+
+		/** Screen size thresholds, one per LOD level beyond the base level. */
+		Vector<float> lodScreenSizes;
+
+		/** Number of levels in the mesh's LOD chain. */
+		UINT32 numLodLevels = 1;
+
+		/** LOD level the renderable elements are currently set up for rendering. */
+		UINT32 currentLod = 0;
+
+		/**
+		 * True if the object's world transform has been baked into the vertices of a merged static batch mesh, in which
+		 * case the per-object and per-call buffers are populated with identity world transforms.
+		 */
+		bool staticBatched = false;
+
+		/**
+		 * Compute-readable copy of the mesh vertex stream containing positions and blend weights/indices, as a buffer
+		 * of dwords. Created on demand for skinned renderables, used for the GPU skinned bounds reduction.
+		 */
+		SPtr<GpuBuffer> skinnedVertexData;
+		UINT32 skinnedNumVertices = 0;
+		UINT32 skinnedVertexStride = 0; /**< In dwords. */
+		UINT32 skinnedPositionOffset = 0; /**< In dwords. */
+		UINT32 skinnedBlendIndicesOffset = 0; /**< In dwords. */
+		UINT32 skinnedBlendWeightsOffset = 0; /**< In dwords. */
+		bool skinnedVertexDataChecked = false; /**< True once creation was attempted. Null buffer then means unusable layout. */
+
 		SPtr<GpuParamBlockBuffer> perObjectParamBuffer;
 		SPtr<GpuParamBlockBuffer> perCallParamBuffer;
 	};
@@ -15,7 +15,7 @@ namespace bs { namespace ct
 	ReflProbeParamsParamDef gReflProbeParamsParamDef;
 
 	VisibleReflProbeData::VisibleReflProbeData()
-		:mNumProbes(0)
+		:mNumProbes(0), mProbeDataHash(0)
 	{ }
 
 	void VisibleReflProbeData::update(const SceneInfo& sceneInfo, const RendererViewGroup& viewGroup)
@@ -46,6 +46,9 @@ namespace bs { namespace ct
 
 		mNumProbes = (UINT32)mReflProbeData.size();
 
+		UINT64 oldHash = mProbeDataHash;
+		mProbeDataHash = bs_hash_data(mReflProbeData.data(), mNumProbes * sizeof(ReflProbeData));
+
 		// Move refl. probe data into a GPU buffer
 		bool supportsStructuredBuffers = gRenderBeast()->getFeatureSet() == RenderBeastFeatureSet::Desktop;
 		if(supportsStructuredBuffers)
@@ -58,6 +61,7 @@ namespace bs { namespace ct
 			else
 				curBufferSize = 0;
 
+			bool reallocated = false;
 			if (size > curBufferSize || curBufferSize == 0)
 			{
 				// Allocate at least one block even if no probes, to avoid issues with null buffers
@@ -70,9 +74,11 @@ namespace bs { namespace ct
 				bufferDesc.format = BF_UNKNOWN;
 
 				mProbeBuffer = GpuBuffer::create(bufferDesc);
+				reallocated = true;
 			}
 
-			if (size > 0)
+			// Probes rarely change frame to frame, so skip the upload unless the visible set actually differs
+			if (size > 0 && (reallocated || mProbeDataHash != oldHash))
 				mProbeBuffer->writeData(0, size, mReflProbeData.data(), BWT_DISCARD);
 		}
 	}
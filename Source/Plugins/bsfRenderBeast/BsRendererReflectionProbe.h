@@ -55,10 +55,17 @@ namespace bs { namespace ct
 		/** Returns information about a probe at the specified index. */
 		const ReflProbeData& getProbeData(UINT32 idx) const { return mReflProbeData[idx]; }
 
+		/**
+		 * Returns a hash of the contents of the probe buffer. The hash changes whenever the set of visible probes, or
+		 * any parameter of a visible probe changes.
+		 */
+		UINT64 getProbeDataHash() const { return mProbeDataHash; }
+
 	private:
 		Vector<ReflProbeData> mReflProbeData;
 		SPtr<GpuBuffer> mProbeBuffer;
 		UINT32 mNumProbes;
+		UINT64 mProbeDataHash;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(ReflProbeParamsParamDef)
@@ -7,11 +7,20 @@
 #include "Renderer/BsReflectionProbe.h"
 #include "Renderer/BsRenderer.h"
 #include "Mesh/BsMesh.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
 #include "Material/BsPass.h"
 #include "Material/BsGpuParamsSet.h"
 #include "Utility/BsSamplerOverrides.h"
+#include "Utility/BsBitwise.h"
 #include "BsRenderBeastOptions.h"
 #include "BsRenderBeast.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Shading/BsMorphShapeBlend.h"
+#include "Shading/BsSkinnedBounds.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsVertexData.h"
 
 namespace bs {	namespace ct
 {
@@ -26,7 +35,7 @@ namespace bs {	namespace ct
 	RendererScene::~RendererScene()
 	{
 		for (auto& entry : mInfo.renderables)
-			bs_delete(entry);
+			mRendererObjectAlloc.destruct(entry);
 
 		for (auto& entry : mInfo.views)
 			bs_delete(entry);
@@ -136,6 +145,7 @@ namespace bs {	namespace ct
 
 				mInfo.radialLights.push_back(RendererLight(light));
 				mInfo.radialLightWorldBounds.push_back(light->getBounds());
+				mInfo.radialLightShadowRevisions.push_back(mNextShadowRevision++);
 			}
 			else // Spot
 			{
@@ -144,6 +154,7 @@ namespace bs {	namespace ct
 
 				mInfo.spotLights.push_back(RendererLight(light));
 				mInfo.spotLightWorldBounds.push_back(light->getBounds());
+				mInfo.spotLightShadowRevisions.push_back(mNextShadowRevision++);
 			}
 		}
 	}
@@ -153,9 +164,15 @@ namespace bs {	namespace ct
 		UINT32 lightId = light->getRendererId();
 
 		if (light->getType() == LightType::Radial)
+		{
 			mInfo.radialLightWorldBounds[lightId] = light->getBounds();
+			mInfo.radialLightShadowRevisions[lightId] = mNextShadowRevision++;
+		}
 		else if(light->getType() == LightType::Spot)
+		{
 			mInfo.spotLightWorldBounds[lightId] = light->getBounds();
+			mInfo.spotLightShadowRevisions[lightId] = mNextShadowRevision++;
+		}
 	}
 
 	void RendererScene::unregisterLight(Light* light)
@@ -188,6 +205,7 @@ namespace bs {	namespace ct
 					// Swap current last element with the one we want to erase
 					std::swap(mInfo.radialLights[lightId], mInfo.radialLights[lastLightId]);
 					std::swap(mInfo.radialLightWorldBounds[lightId], mInfo.radialLightWorldBounds[lastLightId]);
+					std::swap(mInfo.radialLightShadowRevisions[lightId], mInfo.radialLightShadowRevisions[lastLightId]);
 
 					lastLight->setRendererId(lightId);
 				}
@@ -195,6 +213,7 @@ namespace bs {	namespace ct
 				// Last element is the one we want to erase
 				mInfo.radialLights.erase(mInfo.radialLights.end() - 1);
 				mInfo.radialLightWorldBounds.erase(mInfo.radialLightWorldBounds.end() - 1);
+				mInfo.radialLightShadowRevisions.erase(mInfo.radialLightShadowRevisions.end() - 1);
 			}
 			else // Spot
 			{
@@ -206,6 +225,7 @@ namespace bs {	namespace ct
 					// Swap current last element with the one we want to erase
 					std::swap(mInfo.spotLights[lightId], mInfo.spotLights[lastLightId]);
 					std::swap(mInfo.spotLightWorldBounds[lightId], mInfo.spotLightWorldBounds[lastLightId]);
+					std::swap(mInfo.spotLightShadowRevisions[lightId], mInfo.spotLightShadowRevisions[lastLightId]);
 
 					lastLight->setRendererId(lightId);
 				}
@@ -213,18 +233,40 @@ namespace bs {	namespace ct
 				// Last element is the one we want to erase
 				mInfo.spotLights.erase(mInfo.spotLights.end() - 1);
 				mInfo.spotLightWorldBounds.erase(mInfo.spotLightWorldBounds.end() - 1);
+				mInfo.spotLightShadowRevisions.erase(mInfo.spotLightShadowRevisions.end() - 1);
 			}
 		}
 	}
 
+	void RendererScene::markShadowedLightsDirty(const Sphere& casterBounds)
+	{
+		// Directional lights are skipped since their cascaded shadow maps are view dependant and not cached
+		for (UINT32 i = 0; i < (UINT32)mInfo.radialLightWorldBounds.size(); i++)
+		{
+			if (mInfo.radialLightWorldBounds[i].intersects(casterBounds))
+				mInfo.radialLightShadowRevisions[i] = mNextShadowRevision++;
+		}
+
+		for (UINT32 i = 0; i < (UINT32)mInfo.spotLightWorldBounds.size(); i++)
+		{
+			if (mInfo.spotLightWorldBounds[i].intersects(casterBounds))
+				mInfo.spotLightShadowRevisions[i] = mNextShadowRevision++;
+		}
+	}
+
 	void RendererScene::registerRenderable(Renderable* renderable)
 	{
 		UINT32 renderableId = (UINT32)mInfo.renderables.size();
 
 		renderable->setRendererId(renderableId);
 
-		mInfo.renderables.push_back(bs_new<RendererObject>());
+		mInfo.renderables.push_back(mRendererObjectAlloc.construct<RendererObject>());
 		mInfo.renderableCullInfos.push_back(CullInfo(renderable->getBounds(), renderable->getLayer()));
+		mInfo.renderableCullBounds.add(renderable->getBounds().getBox());
+		mInfo.renderableCullVersions.push_back(0);
+		mDirtyObjectDataIndices.push_back(renderableId);
+
+		markShadowedLightsDirty(renderable->getBounds().getSphere());
 
 		RendererObject* rendererObject = mInfo.renderables.back();
 		rendererObject->renderable = renderable;
@@ -310,6 +352,26 @@ namespace bs {	namespace ct
 
 				renElement.techniqueIdx = techniqueIdx;
 
+				// Check if the material blends in an order independent way, in which case the renderer may sort the
+				// element for batching instead of by distance
+				if (shaderFlags.isSet(ShaderFlag::Transparent))
+				{
+					UINT32 numPasses = renElement.material->getNumPasses(techniqueIdx);
+
+					bool allCommutative = numPasses > 0;
+					for (UINT32 j = 0; j < numPasses; j++)
+					{
+						SPtr<Pass> pass = renElement.material->getPass(j, techniqueIdx);
+						if (!pass->hasCommutativeBlending())
+						{
+							allCommutative = false;
+							break;
+						}
+					}
+
+					renElement.orderIndependentBlend = allCommutative;
+				}
+
 				// Validate mesh <-> shader vertex bindings
 				if (renElement.material != nullptr)
 				{
@@ -376,6 +438,23 @@ namespace bs {	namespace ct
 					samplerOverrides->refCount++;
 				}
 			}
+
+			// Cache the mesh's LOD chain so a level can be picked each frame without touching the mesh
+			UINT32 numSubMeshes = meshProps.getNumSubMeshes();
+
+			rendererObject->numLodLevels = meshProps.getNumLodLevels();
+			rendererObject->currentLod = 0;
+			rendererObject->lodSubMeshes.clear();
+			rendererObject->lodScreenSizes.clear();
+
+			for (UINT32 lod = 0; lod < rendererObject->numLodLevels; lod++)
+			{
+				for (UINT32 i = 0; i < numSubMeshes; i++)
+					rendererObject->lodSubMeshes.push_back(meshProps.getLodSubMesh(i, lod));
+			}
+
+			for (UINT32 lod = 1; lod < rendererObject->numLodLevels; lod++)
+				rendererObject->lodScreenSizes.push_back(meshProps.getLodScreenSize(lod));
 		}
 
 		// Prepare all parameter bindings
@@ -405,6 +484,16 @@ namespace bs {	namespace ct
 			if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
 				gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", element.boneMatrixBuffer);
 
+			if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gInstanceData"))
+				gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gInstanceData", element.instanceDataParam);
+
+			if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gObjectData") &&
+				gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "gInstanceLookup"))
+			{
+				gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gObjectData", element.objectDataParam);
+				gpuParams->getBufferParam(GPT_VERTEX_PROGRAM, "gInstanceLookup", element.instanceLookupParam);
+			}
+
 			ShaderFlags shaderFlags = shader->getFlags();
 			bool useForwardRendering = shaderFlags.isSet(ShaderFlag::Forward) || shaderFlags.isSet(ShaderFlag::Transparent);
 
@@ -454,23 +543,62 @@ namespace bs {	namespace ct
 					supportsClusteredForward);
 			}
 		}
+
+		if (mOptions->staticBatching && mesh != nullptr && renderable->getMobility() == ObjectMobility::Static &&
+			renderable->getAnimType() == RenderableAnimType::None)
+			mStaticBatchesDirty = true;
 	}
 
 	void RendererScene::updateRenderable(Renderable* renderable)
 	{
 		UINT32 renderableId = renderable->getRendererId();
 
+		if (mInfo.renderables[renderableId]->staticBatched)
+		{
+			// Baked vertices no longer match the new transform, un-batch the object and queue a rebuild
+			restoreStaticBatchedObject(mInfo.renderables[renderableId]);
+			mStaticBatchesDirty = true;
+		}
+
+		// Shadows of lights covering either the previous or the new position of the caster need a re-render
+		Sphere oldBounds = mInfo.renderableCullInfos[renderableId].bounds.getSphere();
+		markShadowedLightsDirty(oldBounds);
+		markShadowedLightsDirty(renderable->getBounds().getSphere());
+
 		mInfo.renderables[renderableId]->updatePerObjectBuffer();
 		mInfo.renderableCullInfos[renderableId].bounds = renderable->getBounds();
+		mInfo.renderableCullBounds.update(renderableId, renderable->getBounds().getBox());
+		mInfo.renderableCullVersions[renderableId]++;
+		mDirtyObjectDataIndices.push_back(renderableId);
+	}
+
+	void RendererScene::extrapolateVelocities(float timeDelta)
+	{
+		const UINT32 numRenderables = (UINT32)mInfo.renderables.size();
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			Renderable* renderable = mInfo.renderables[i]->renderable;
+			if (renderable->_extrapolateTransform(timeDelta))
+				updateRenderable(renderable);
+		}
 	}
 
 	void RendererScene::unregisterRenderable(Renderable* renderable)
 	{
 		UINT32 renderableId = renderable->getRendererId();
+
+		markShadowedLightsDirty(mInfo.renderableCullInfos[renderableId].bounds.getSphere());
 		Renderable* lastRenerable = mInfo.renderables.back()->renderable;
 		UINT32 lastRenderableId = lastRenerable->getRendererId();
 
 		RendererObject* rendererObject = mInfo.renderables[renderableId];
+
+		if (rendererObject->staticBatched)
+		{
+			restoreStaticBatchedObject(rendererObject);
+			mStaticBatchesDirty = true;
+		}
+
 		Vector<BeastRenderableElement>& elements = rendererObject->elements;
 		for (auto& element : elements)
 		{
@@ -495,18 +623,27 @@ namespace bs {	namespace ct
 			// Swap current last element with the one we want to erase
 			std::swap(mInfo.renderables[renderableId], mInfo.renderables[lastRenderableId]);
 			std::swap(mInfo.renderableCullInfos[renderableId], mInfo.renderableCullInfos[lastRenderableId]);
+			mInfo.renderableCullBounds.swap(renderableId, lastRenderableId);
+
+			// The swapped-in entry now refers to a different object as far as cached visibility is concerned
+			mInfo.renderableCullVersions[renderableId] = mInfo.renderableCullVersions[lastRenderableId] + 1;
 
 			lastRenerable->setRendererId(renderableId);
 
 			for (auto& element : elements)
 				element.renderableId = renderableId;
+
+			// Moved entry needs its GPU object data re-uploaded at the new index
+			mDirtyObjectDataIndices.push_back(renderableId);
 		}
 
 		// Last element is the one we want to erase
 		mInfo.renderables.erase(mInfo.renderables.end() - 1);
 		mInfo.renderableCullInfos.erase(mInfo.renderableCullInfos.end() - 1);
+		mInfo.renderableCullBounds.pop();
+		mInfo.renderableCullVersions.erase(mInfo.renderableCullVersions.end() - 1);
 
-		bs_delete(rendererObject);
+		mRendererObjectAlloc.destruct(rendererObject);
 	}
 
 	void RendererScene::registerReflectionProbe(ReflectionProbe* probe)
@@ -629,6 +766,11 @@ namespace bs {	namespace ct
 
 		for (auto& entry : mInfo.views)
 			entry->setStateReductionMode(mOptions->stateReductionMode);
+
+		if (!mOptions->staticBatching && !mStaticBatchedObjects.empty())
+			clearStaticBatches();
+		else if (mOptions->staticBatching && mStaticBatchedObjects.empty())
+			mStaticBatchesDirty = true;
 	}
 
 	RENDERER_VIEW_DESC RendererScene::createViewDesc(Camera* camera) const
@@ -669,7 +811,7 @@ namespace bs {	namespace ct
 		viewDesc.target.numSamples = camera->getMSAACount();
 
 		viewDesc.triggerCallbacks = true;
-		viewDesc.runPostProcessing = true;
+		viewDesc.runPostProcessing = !camera->getRenderSettings()->previewMode;
 		viewDesc.capturingReflections = false;
 
 		viewDesc.cullFrustum = camera->getWorldFrustum();
@@ -856,6 +998,606 @@ namespace bs {	namespace ct
 		gPerFrameParamDef.gTime.set(mPerFrameParamBuffer, time);
 	}
 
+	void RendererScene::updateGpuObjectData()
+	{
+		const RenderAPICapabilities& caps = RenderAPI::instance().getCapabilities(0);
+		if (!caps.hasCapability(RSC_DRAW_INDIRECT))
+		{
+			// Buffer is only consumed by the GPU-driven culling path, which requires indirect draw support
+			mDirtyObjectDataIndices.clear();
+			return;
+		}
+
+		UINT32 numRenderables = (UINT32)mInfo.renderables.size();
+		if (numRenderables == 0)
+		{
+			mDirtyObjectDataIndices.clear();
+			return;
+		}
+
+		UINT32 curElementCount = mInfo.objectDataBuffer != nullptr ?
+			mInfo.objectDataBuffer->getProperties().getElementCount() : 0;
+		if (numRenderables > curElementCount)
+		{
+			GPU_BUFFER_DESC bufferDesc;
+			bufferDesc.type = GBT_STRUCTURED;
+			bufferDesc.elementCount = Bitwise::nextPow2(std::max(numRenderables, 64U));
+			bufferDesc.elementSize = sizeof(GpuSceneObjectData);
+			bufferDesc.format = BF_UNKNOWN;
+			bufferDesc.usage = GBU_DYNAMIC;
+
+			mInfo.objectDataBuffer = GpuBuffer::create(bufferDesc);
+			mRefreshAllObjectData = true;
+		}
+
+		if (!mRefreshAllObjectData && mDirtyObjectDataIndices.empty())
+			return;
+
+		const auto writeEntry = [this](UINT32 idx, GpuSceneObjectData& entry)
+		{
+			Renderable* renderable = mInfo.renderables[idx]->renderable;
+
+			// Transforms of statically batched objects are baked into the mesh vertices
+			bool staticBatched = mInfo.renderables[idx]->staticBatched;
+			Matrix4 worldTransform = staticBatched ? Matrix4::IDENTITY : renderable->getMatrix();
+			Matrix4 worldNoScaleTransform = staticBatched ? Matrix4::IDENTITY : renderable->getMatrixNoScale();
+
+			entry.gMatWorld = worldTransform;
+			entry.gMatInvWorld = worldTransform.inverseAffine();
+			entry.gMatWorldNoScale = worldNoScaleTransform;
+			entry.gMatInvWorldNoScale = worldNoScaleTransform.inverseAffine();
+			entry.gWorldDeterminantSign = worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
+
+			Sphere bounds = mInfo.renderableCullInfos[idx].bounds.getSphere();
+			entry.gBoundsSphere = Vector4(bounds.getCenter().x, bounds.getCenter().y, bounds.getCenter().z,
+				bounds.getRadius());
+		};
+
+		if (mRefreshAllObjectData)
+		{
+			Vector<GpuSceneObjectData> entries(numRenderables);
+			for (UINT32 i = 0; i < numRenderables; i++)
+				writeEntry(i, entries[i]);
+
+			mInfo.objectDataBuffer->writeData(0, numRenderables * sizeof(GpuSceneObjectData), entries.data(),
+				BWT_DISCARD);
+
+			mRefreshAllObjectData = false;
+		}
+		else
+		{
+			// Indices can repeat (e.g. multiple updates of the same renderable in a frame), avoid redundant uploads
+			std::sort(mDirtyObjectDataIndices.begin(), mDirtyObjectDataIndices.end());
+			const auto lastUnique = std::unique(mDirtyObjectDataIndices.begin(), mDirtyObjectDataIndices.end());
+
+			for (auto iter = mDirtyObjectDataIndices.begin(); iter != lastUnique; ++iter)
+			{
+				UINT32 idx = *iter;
+
+				// Entry might have been removed after it was marked dirty
+				if (idx >= numRenderables)
+					continue;
+
+				GpuSceneObjectData entry;
+				writeEntry(idx, entry);
+
+				mInfo.objectDataBuffer->writeData(idx * sizeof(GpuSceneObjectData), sizeof(GpuSceneObjectData),
+					&entry, BWT_NORMAL);
+			}
+		}
+
+		mDirtyObjectDataIndices.clear();
+	}
+
+	/** Checks if two vertex descriptors describe the exact same vertex layout. */
+	static bool hasSameVertexLayout(const SPtr<VertexDataDesc>& a, const SPtr<VertexDataDesc>& b)
+	{
+		if (a == b)
+			return true;
+
+		UINT32 numElements = a->getNumElements();
+		if (numElements != b->getNumElements())
+			return false;
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			if (!(a->getElement(i) == b->getElement(i)))
+				return false;
+		}
+
+		return true;
+	}
+
+	// Upper limit on the size of a single merged batch mesh, to keep bake-time allocations and rebuilds bounded
+	constexpr UINT32 MaxStaticBatchVertices = 1 << 20;
+
+	void RendererScene::updateStaticBatches()
+	{
+		if (!mStaticBatchesDirty)
+			return;
+
+		mStaticBatchesDirty = false;
+
+		// Rebuild from scratch: batches only change when static renderables get added or removed, which is expected
+		// to be rare after level load
+		clearStaticBatches();
+
+		if (!mOptions->staticBatching)
+			return;
+
+		// References a single renderable element to be merged into a batch, along with the range of vertices its
+		// index range touches
+		struct BatchEntry
+		{
+			RendererObject* object;
+			UINT32 elementIdx;
+			UINT32 minVertex;
+			UINT32 maxVertex;
+		};
+
+		// Set of elements sharing a material and vertex layout, to be merged into a single mesh
+		struct Batch
+		{
+			SPtr<Material> material;
+			SPtr<VertexDataDesc> vertexDesc;
+			Vector<BatchEntry> entries;
+			UINT32 numVertices = 0;
+			UINT32 numIndices = 0;
+		};
+
+		// Mesh contents read back from the GPU, cached since multiple objects often share a mesh
+		UnorderedMap<Mesh*, SPtr<MeshData>> meshDataCache;
+		const auto readMeshData = [&meshDataCache](const SPtr<Mesh>& mesh)
+		{
+			auto iterFind = meshDataCache.find(mesh.get());
+			if (iterFind != meshDataCache.end())
+				return iterFind->second;
+
+			const MeshProperties& meshProps = mesh->getProperties();
+			IndexType indexType = mesh->getIndexBuffer()->getProperties().getType();
+
+			SPtr<MeshData> meshData = MeshData::create(meshProps.getNumVertices(), meshProps.getNumIndices(),
+				mesh->getVertexDesc(), indexType);
+			mesh->readData(*meshData);
+
+			meshDataCache[mesh.get()] = meshData;
+			return meshData;
+		};
+
+		Vector<Batch> batches;
+		for (auto& rendererObject : mInfo.renderables)
+		{
+			Renderable* renderable = rendererObject->renderable;
+
+			if (renderable->getMobility() != ObjectMobility::Static)
+				continue;
+
+			if (renderable->getAnimType() != RenderableAnimType::None)
+				continue;
+
+			// Sub-mesh ranges of batched elements are fixed, which would break LOD selection
+			if (rendererObject->numLodLevels > 1)
+				continue;
+
+			SPtr<Mesh> mesh = renderable->getMesh();
+			if (mesh == nullptr || rendererObject->elements.empty())
+				continue;
+
+			// Transforms can only be baked if positions use the expected layout
+			SPtr<VertexDataDesc> vertexDesc = mesh->getVertexDesc();
+			const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+			if (positionElement == nullptr || positionElement->getType() != VET_FLOAT3)
+				continue;
+
+			SPtr<MeshData> meshData = readMeshData(mesh);
+
+			// Determine the range of vertices each element's indices reference, so only that range needs to be copied.
+			// All elements of an object must be batchable, as the object-wide transform buffers are set to identity
+			// once its vertices are baked.
+			UINT32 numElements = (UINT32)rendererObject->elements.size();
+
+			bool allElementsValid = true;
+			Vector<std::pair<UINT32, UINT32>> vertexRanges(numElements);
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				const SubMesh& subMesh = rendererObject->elements[i].subMesh;
+				if (subMesh.indexCount == 0 ||
+					(subMesh.indexOffset + subMesh.indexCount) > meshData->getNumIndices())
+				{
+					allElementsValid = false;
+					break;
+				}
+
+				UINT32 minVertex = std::numeric_limits<UINT32>::max();
+				UINT32 maxVertex = 0;
+				if (meshData->getIndexType() == IT_16BIT)
+				{
+					UINT16* indices = meshData->getIndices16() + subMesh.indexOffset;
+					for (UINT32 j = 0; j < subMesh.indexCount; j++)
+					{
+						minVertex = std::min(minVertex, (UINT32)indices[j]);
+						maxVertex = std::max(maxVertex, (UINT32)indices[j]);
+					}
+				}
+				else
+				{
+					UINT32* indices = meshData->getIndices32() + subMesh.indexOffset;
+					for (UINT32 j = 0; j < subMesh.indexCount; j++)
+					{
+						minVertex = std::min(minVertex, indices[j]);
+						maxVertex = std::max(maxVertex, indices[j]);
+					}
+				}
+
+				if (maxVertex >= meshData->getNumVertices())
+				{
+					allElementsValid = false;
+					break;
+				}
+
+				vertexRanges[i] = std::make_pair(minVertex, maxVertex);
+			}
+
+			if (!allElementsValid)
+				continue;
+
+			// Assign each element to a batch with a matching material and vertex layout
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				BeastRenderableElement& element = rendererObject->elements[i];
+				UINT32 numVertices = vertexRanges[i].second - vertexRanges[i].first + 1;
+
+				Batch* batch = nullptr;
+				for (auto& entry : batches)
+				{
+					if (entry.material != element.material)
+						continue;
+
+					if (!hasSameVertexLayout(entry.vertexDesc, vertexDesc))
+						continue;
+
+					if ((entry.numVertices + numVertices) > MaxStaticBatchVertices)
+						continue;
+
+					batch = &entry;
+					break;
+				}
+
+				if (batch == nullptr)
+				{
+					batches.push_back(Batch());
+
+					batch = &batches.back();
+					batch->material = element.material;
+					batch->vertexDesc = vertexDesc;
+				}
+
+				batch->entries.push_back({ rendererObject, i, vertexRanges[i].first, vertexRanges[i].second });
+				batch->numVertices += numVertices;
+				batch->numIndices += element.subMesh.indexCount;
+			}
+
+			StaticBatchedObject batchedEntry;
+			batchedEntry.object = rendererObject;
+			batchedEntry.originalMesh = mesh;
+
+			for (auto& element : rendererObject->elements)
+				batchedEntry.originalSubMeshes.push_back(element.subMesh);
+
+			mStaticBatchedObjects.push_back(batchedEntry);
+
+			rendererObject->staticBatched = true;
+			rendererObject->updatePerObjectBuffer();
+			mInfo.renderableCullVersions[renderable->getRendererId()]++;
+			mDirtyObjectDataIndices.push_back(renderable->getRendererId());
+		}
+
+		// Merge the geometry of each batch into a combined mesh and point the elements at their range within it
+		for (auto& batch : batches)
+		{
+			SPtr<MeshData> combinedData = MeshData::create(batch.numVertices, batch.numIndices, batch.vertexDesc);
+			UINT32* combinedIndices = combinedData->getIndices32();
+
+			UINT32 vertexOffset = 0;
+			UINT32 indexOffset = 0;
+
+			SPtr<Mesh> batchMesh = Mesh::create(batch.numVertices, batch.numIndices, batch.vertexDesc, MU_STATIC,
+				DOT_TRIANGLE_LIST, IT_32BIT);
+
+			UINT32 numVertexElements = batch.vertexDesc->getNumElements();
+			for (auto& entry : batch.entries)
+			{
+				Renderable* renderable = entry.object->renderable;
+				BeastRenderableElement& element = entry.object->elements[entry.elementIdx];
+				const SubMesh& subMesh = element.subMesh;
+
+				SPtr<MeshData> srcData = readMeshData(renderable->getMesh());
+				UINT32 numVertices = entry.maxVertex - entry.minVertex + 1;
+
+				Matrix4 worldTfrm = renderable->getMatrix();
+				Matrix4 worldNoScaleTfrm = renderable->getMatrixNoScale();
+
+				// Copy the vertices, baking the world transform into positions and rotating the normal/tangent frame
+				// the same way the shaders would have
+				for (UINT32 i = 0; i < numVertexElements; i++)
+				{
+					const VertexElement& vertexElement = batch.vertexDesc->getElement(i);
+
+					UINT32 stride = batch.vertexDesc->getVertexStride(vertexElement.getStreamIdx());
+					UINT32 elementSize = vertexElement.getSize();
+
+					UINT8* src = srcData->getElementData(vertexElement.getSemantic(), vertexElement.getSemanticIdx(),
+						vertexElement.getStreamIdx()) + entry.minVertex * stride;
+					UINT8* dst = combinedData->getElementData(vertexElement.getSemantic(),
+						vertexElement.getSemanticIdx(), vertexElement.getStreamIdx()) + vertexOffset * stride;
+
+					VertexElementSemantic semantic = vertexElement.getSemantic();
+					bool isPosition = semantic == VES_POSITION && vertexElement.getType() == VET_FLOAT3;
+					bool isDirection =
+						(semantic == VES_NORMAL || semantic == VES_TANGENT || semantic == VES_BITANGENT) &&
+						(vertexElement.getType() == VET_FLOAT3 || vertexElement.getType() == VET_FLOAT4);
+
+					for (UINT32 j = 0; j < numVertices; j++)
+					{
+						if (isPosition)
+						{
+							Vector3 position;
+							memcpy(&position, src, sizeof(Vector3));
+
+							position = worldTfrm.multiplyAffine(position);
+							memcpy(dst, &position, sizeof(Vector3));
+						}
+						else if (isDirection)
+						{
+							Vector3 direction;
+							memcpy(&direction, src, sizeof(Vector3));
+
+							direction = worldNoScaleTfrm.multiplyDirection(direction);
+							memcpy(dst, &direction, sizeof(Vector3));
+
+							// Preserve the handedness component of four-component tangents
+							if (elementSize > sizeof(Vector3))
+								memcpy(dst + sizeof(Vector3), src + sizeof(Vector3), elementSize - sizeof(Vector3));
+						}
+						else
+							memcpy(dst, src, elementSize);
+
+						src += stride;
+						dst += stride;
+					}
+				}
+
+				// Copy the indices, rebased to the element's position in the combined vertex buffer
+				if (srcData->getIndexType() == IT_16BIT)
+				{
+					UINT16* srcIndices = srcData->getIndices16() + subMesh.indexOffset;
+					for (UINT32 j = 0; j < subMesh.indexCount; j++)
+						combinedIndices[indexOffset + j] = vertexOffset + ((UINT32)srcIndices[j] - entry.minVertex);
+				}
+				else
+				{
+					UINT32* srcIndices = srcData->getIndices32() + subMesh.indexOffset;
+					for (UINT32 j = 0; j < subMesh.indexCount; j++)
+						combinedIndices[indexOffset + j] = vertexOffset + (srcIndices[j] - entry.minVertex);
+				}
+
+				element.mesh = batchMesh;
+				element.subMesh = SubMesh(indexOffset, subMesh.indexCount, subMesh.drawOp);
+
+				vertexOffset += numVertices;
+				indexOffset += subMesh.indexCount;
+			}
+
+			batchMesh->writeData(*combinedData, true);
+			mStaticBatchMeshes.push_back(batchMesh);
+		}
+	}
+
+	void RendererScene::restoreStaticBatchedObject(RendererObject* rendererObject)
+	{
+		auto iterFind = std::find_if(mStaticBatchedObjects.begin(), mStaticBatchedObjects.end(),
+			[rendererObject](const StaticBatchedObject& entry) { return entry.object == rendererObject; });
+
+		if (iterFind == mStaticBatchedObjects.end())
+			return;
+
+		Vector<BeastRenderableElement>& elements = rendererObject->elements;
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			elements[i].mesh = iterFind->originalMesh;
+			elements[i].subMesh = iterFind->originalSubMeshes[i];
+		}
+
+		rendererObject->staticBatched = false;
+		rendererObject->updatePerObjectBuffer();
+		mInfo.renderableCullVersions[rendererObject->renderable->getRendererId()]++;
+		mDirtyObjectDataIndices.push_back(rendererObject->renderable->getRendererId());
+
+		mStaticBatchedObjects.erase(iterFind);
+	}
+
+	void RendererScene::clearStaticBatches()
+	{
+		while (!mStaticBatchedObjects.empty())
+			restoreStaticBatchedObject(mStaticBatchedObjects.back().object);
+
+		mStaticBatchMeshes.clear();
+	}
+
+	/**
+	 * Creates a compute-readable copy of the vertex stream of a skinned mesh, and records the layout information the
+	 * bounds reduction shader needs to decode it. Leaves the buffer null if the layout isn't usable.
+	 */
+	static void prepareSkinnedVertexData(RendererObject* rendererObject)
+	{
+		rendererObject->skinnedVertexDataChecked = true;
+
+		SPtr<Mesh> mesh = rendererObject->renderable->getMesh();
+		if (mesh == nullptr)
+			return;
+
+		SPtr<VertexData> vertexData = mesh->getVertexData();
+		if (vertexData == nullptr)
+			return;
+
+		const VertexDeclarationProperties& declProps = vertexData->vertexDeclaration->getProperties();
+		const VertexElement* position = declProps.findElementBySemantic(VES_POSITION);
+		const VertexElement* blendIndices = declProps.findElementBySemantic(VES_BLEND_INDICES);
+		const VertexElement* blendWeights = declProps.findElementBySemantic(VES_BLEND_WEIGHTS);
+
+		if (position == nullptr || blendIndices == nullptr || blendWeights == nullptr)
+			return;
+
+		// All relevant elements must come from the same stream, and be dword aligned, so the shader can address them
+		// in a single buffer of dwords
+		if (blendIndices->getStreamIdx() != position->getStreamIdx() ||
+			blendWeights->getStreamIdx() != position->getStreamIdx())
+			return;
+
+		SPtr<VertexBuffer> vertexBuffer = vertexData->getBuffer(position->getStreamIdx());
+		if (vertexBuffer == nullptr)
+			return;
+
+		const VertexBufferProperties& bufferProps = vertexBuffer->getProperties();
+		UINT32 vertexStride = bufferProps.getVertexSize();
+
+		if (vertexStride % 4 != 0 || position->getOffset() % 4 != 0 || blendIndices->getOffset() % 4 != 0 ||
+			blendWeights->getOffset() % 4 != 0)
+			return;
+
+		UINT32 numVertices = bufferProps.getNumVertices();
+		UINT32 sizeBytes = numVertices * vertexStride;
+
+		GPU_BUFFER_DESC bufferDesc;
+		bufferDesc.type = GBT_STANDARD;
+		bufferDesc.elementCount = sizeBytes / 4;
+		bufferDesc.format = BF_32X1F;
+		bufferDesc.usage = GBU_STATIC;
+
+		SPtr<GpuBuffer> copy = GpuBuffer::create(bufferDesc);
+		copy->copyData(*vertexBuffer, 0, 0, sizeBytes, true);
+
+		rendererObject->skinnedVertexData = copy;
+		rendererObject->skinnedNumVertices = numVertices;
+		rendererObject->skinnedVertexStride = vertexStride / 4;
+		rendererObject->skinnedPositionOffset = position->getOffset() / 4;
+		rendererObject->skinnedBlendIndicesOffset = blendIndices->getOffset() / 4;
+		rendererObject->skinnedBlendWeightsOffset = blendWeights->getOffset() / 4;
+	}
+
+	void RendererScene::updateSkinnedBounds()
+	{
+		const RenderAPICapabilities& caps = RenderAPI::instance().getCapabilities(0);
+		if (!caps.hasCapability(RSC_COMPUTE_PROGRAM))
+			return;
+
+		// Apply the results of the reduction dispatched last frame. The GPU had a full frame to finish it, so the
+		// readback doesn't stall.
+		UINT32 prevBufferIdx = mSkinnedBoundsBufferIdx ^ 1;
+		Vector<SkinnedBoundsEntry>& prevEntries = mSkinnedBoundsEntries[prevBufferIdx];
+		if (!prevEntries.empty() && mSkinnedBoundsOutput[prevBufferIdx] != nullptr)
+		{
+			UINT32 numEntries = (UINT32)prevEntries.size();
+
+			Vector<Vector4> results(numEntries * 2);
+			mSkinnedBoundsOutput[prevBufferIdx]->readData(0, numEntries * 2 * sizeof(Vector4), results.data());
+
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				const SkinnedBoundsEntry& entry = prevEntries[i];
+
+				// Entry might have been removed or swapped to a different index since the dispatch
+				if (entry.renderableId >= (UINT32)mInfo.renderables.size() ||
+					mInfo.renderables[entry.renderableId]->renderable != entry.renderable)
+					continue;
+
+				const Vector4& boundsMin = results[i * 2 + 0];
+				const Vector4& boundsMax = results[i * 2 + 1];
+
+				if (boundsMin.x > boundsMax.x) // Degenerate output (e.g. mesh with no vertices)
+					continue;
+
+				// Expand slightly, since the bounds describe the pose from a frame ago
+				Vector3 center = (Vector3(boundsMin) + Vector3(boundsMax)) * 0.5f;
+				Vector3 extents = (Vector3(boundsMax) - Vector3(boundsMin)) * 0.5f * 1.05f;
+
+				AABox worldBox(center - extents, center + extents);
+				worldBox.transformAffine(mInfo.renderables[entry.renderableId]->renderable->getMatrix());
+
+				UINT32 renderableId = entry.renderableId;
+				mInfo.renderableCullInfos[renderableId].bounds =
+					Bounds(worldBox, Sphere(worldBox.getCenter(), worldBox.getRadius()));
+				mInfo.renderableCullBounds.update(renderableId, worldBox);
+				mInfo.renderableCullVersions[renderableId]++;
+
+				// Keep the GPU-driven culling data in sync with the tightened bounds
+				mDirtyObjectDataIndices.push_back(renderableId);
+			}
+
+			prevEntries.clear();
+		}
+
+		// Dispatch this frame's reduction for all skinned renderables
+		Vector<SkinnedBoundsEntry>& curEntries = mSkinnedBoundsEntries[mSkinnedBoundsBufferIdx];
+		curEntries.clear();
+
+		UINT32 numRenderables = (UINT32)mInfo.renderables.size();
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			RendererObject* rendererObject = mInfo.renderables[i];
+			Renderable* renderable = rendererObject->renderable;
+
+			RenderableAnimType animType = renderable->getAnimType();
+			if (animType != RenderableAnimType::Skinned && animType != RenderableAnimType::SkinnedMorph)
+				continue;
+
+			if (renderable->getBoneMatrixBuffer() == nullptr)
+				continue;
+
+			if (!rendererObject->skinnedVertexDataChecked)
+				prepareSkinnedVertexData(rendererObject);
+
+			if (rendererObject->skinnedVertexData == nullptr)
+				continue;
+
+			curEntries.push_back({ i, renderable });
+		}
+
+		if (curEntries.empty())
+		{
+			mSkinnedBoundsBufferIdx = prevBufferIdx;
+			return;
+		}
+
+		UINT32 numEntries = (UINT32)curEntries.size();
+		SPtr<GpuBuffer>& outputBuffer = mSkinnedBoundsOutput[mSkinnedBoundsBufferIdx];
+
+		UINT32 curCapacity = outputBuffer != nullptr ? outputBuffer->getProperties().getElementCount() : 0;
+		if (numEntries * 2 > curCapacity)
+		{
+			GPU_BUFFER_DESC bufferDesc;
+			bufferDesc.type = GBT_STANDARD;
+			bufferDesc.elementCount = Bitwise::nextPow2(numEntries * 2);
+			bufferDesc.format = BF_32X4F;
+			bufferDesc.usage = GBU_STATIC;
+			bufferDesc.randomGpuWrite = true;
+
+			outputBuffer = GpuBuffer::create(bufferDesc);
+		}
+
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			RendererObject* rendererObject = mInfo.renderables[curEntries[i].renderableId];
+
+			SkinnedBoundsMat::get()->execute(rendererObject->skinnedNumVertices, rendererObject->skinnedVertexStride,
+				rendererObject->skinnedPositionOffset, rendererObject->skinnedBlendIndicesOffset,
+				rendererObject->skinnedBlendWeightsOffset, rendererObject->skinnedVertexData,
+				curEntries[i].renderable->getBoneMatrixBuffer(), outputBuffer, i);
+		}
+
+		mSkinnedBoundsBufferIdx = prevBufferIdx;
+	}
+
 	void RendererScene::prepareRenderable(UINT32 idx, const FrameInfo& frameInfo)
 	{
 		if (mInfo.renderableReady[idx])
@@ -864,7 +1606,31 @@ namespace bs {	namespace ct
 		// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
 		if(frameInfo.animData != nullptr)
 			mInfo.renderables[idx]->renderable->updateAnimationBuffers(*frameInfo.animData);
-		
+
+		// If the morph shapes are blended on the GPU, re-run the blend for elements whose weights changed
+		Renderable* renderable = mInfo.renderables[idx]->renderable;
+		const SPtr<GpuBuffer>& morphBlendOutput = renderable->getMorphBlendOutputBuffer();
+		if (morphBlendOutput != nullptr && !mInfo.renderables[idx]->elements.empty())
+		{
+			// The morph buffers are shared by all of the renderable's elements, so a single blend covers them all
+			BeastRenderableElement& firstElement = mInfo.renderables[idx]->elements[0];
+			if (firstElement.morphShapeVersion != renderable->getMorphShapeVersion())
+			{
+				UINT32 numVertices = morphBlendOutput->getProperties().getElementCount();
+
+				MorphShapeBlendMat* blendMat = MorphShapeBlendMat::get();
+				blendMat->execute(renderable->getMorphDeltaBuffer(), renderable->getMorphVertexRangeBuffer(),
+					renderable->getMorphWeightBuffer(), numVertices, morphBlendOutput);
+
+				// Compute shaders cannot write to vertex buffers directly, so blend into an intermediate buffer
+				// and copy the result over
+				renderable->getMorphShapeBuffer()->copyData(*morphBlendOutput);
+
+				for (auto& element : mInfo.renderables[idx]->elements)
+					element.morphShapeVersion = renderable->getMorphShapeVersion();
+			}
+		}
+
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
 		for (auto& element : mInfo.renderables[idx]->elements)
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "BsRenderBeastPrerequisites.h"
+#include "RenderAPI/BsSubMesh.h"
+#include "Allocators/BsPoolAlloc.h"
 #include "BsRendererLight.h"
 #include "BsRendererView.h"
+#include "BsRendererObject.h"
 #include "Shading/BsLightProbes.h"
 #include "Utility/BsSamplerOverrides.h"
 
@@ -34,6 +37,14 @@ namespace bs
 		// Renderables
 		Vector<RendererObject*> renderables;
 		Vector<CullInfo> renderableCullInfos;
+		PackedCullBounds renderableCullBounds;
+
+		/**
+		 * Version number per renderable, incremented whenever anything relevant for culling the renderable changes
+		 * (bounds, transform, element set). Used by views to invalidate temporally cached visibility results.
+		 */
+		Vector<UINT32> renderableCullVersions;
+		SPtr<GpuBuffer> objectDataBuffer; /**< Persistent GPU copy of per-renderable GpuSceneObjectData entries. */
 
 		// Lights
 		Vector<RendererLight> directionalLights;
@@ -41,6 +52,8 @@ namespace bs
 		Vector<RendererLight> spotLights;
 		Vector<Sphere> radialLightWorldBounds;
 		Vector<Sphere> spotLightWorldBounds;
+		Vector<UINT32> radialLightShadowRevisions;
+		Vector<UINT32> spotLightShadowRevisions;
 
 		// Reflection probes
 		Vector<RendererReflectionProbe> reflProbes;
@@ -143,6 +156,36 @@ namespace bs
 		/** Updates global per frame parameter buffers with new values. To be called at the start of every frame. */
 		void setParamFrameParams(float time);
 
+		/**
+		 * Flushes any changed per-renderable entries to the GPU scene object data buffer. Only maintains the buffer
+		 * on backends that support indirect draws, as it is used solely by the GPU-driven culling path. To be called
+		 * once per frame, before any views are rendered.
+		 */
+		void updateGpuObjectData();
+
+		/**
+		 * Merges the geometry of eligible static renderables that share a material into combined batch meshes, with
+		 * world transforms baked into the vertices. Does nothing unless static geometry changed since the last call, or
+		 * static batching was toggled through the renderer options. To be called once per frame, before any views are
+		 * rendered.
+		 */
+		void updateStaticBatches();
+
+		/**
+		 * Advances velocity-driven renderables along their registered trajectory and refreshes their culling and shadow
+		 * information. Such objects move every frame without any transform sync from the simulation thread, see
+		 * Renderable::setVelocity(). To be called once per frame, before any views are rendered.
+		 */
+		void extrapolateVelocities(float timeDelta);
+
+		/**
+		 * Computes tight world bounds for skinned renderables by reducing their skinned vertex positions on the GPU,
+		 * and applies the results of the previous frame's reduction to the culling arrays. The readback is one frame
+		 * latent, so the applied bounds are slightly expanded to cover pose changes since the reduced frame. Requires
+		 * compute shader support, does nothing otherwise. To be called once per frame, before any views are rendered.
+		 */
+		void updateSkinnedBounds();
+
 		/**
 		 * Performs necessary steps to make a renderable ready for rendering. This must be called at least once every frame,
 		 * for every renderable that will be drawn. Multiple calls for the same renderable during a single frame will result
@@ -159,17 +202,63 @@ namespace bs
 		/** Creates a renderer view descriptor for the particular camera. */
 		RENDERER_VIEW_DESC createViewDesc(Camera* camera) const;
 
-		/** 
+		/**
 		 * Find the render target the camera belongs to and adds it to the relevant list. If the camera was previously
 		 * registered with some other render target it will be removed from it and added to the new target.
 		 */
 		void updateCameraRenderTargets(Camera* camera, bool remove = false);
 
+		/**
+		 * Assigns a new shadow revision to all lights whose bounds intersect the provided shadow caster bounds,
+		 * signaling that any cached shadow maps for those lights need to be re-rendered.
+		 */
+		void markShadowedLightsDirty(const Sphere& casterBounds);
+
+		/**
+		 * Points the elements of a statically batched object back to their original mesh and sub-mesh ranges, and
+		 * restores its per-object transform buffers. Does nothing if the object isn't batched.
+		 */
+		void restoreStaticBatchedObject(RendererObject* rendererObject);
+
+		/** Restores all statically batched objects and frees the merged batch meshes. */
+		void clearStaticBatches();
+
 		SceneInfo mInfo;
 		SPtr<GpuParamBlockBuffer> mPerFrameParamBuffer;
 		UnorderedMap<SamplerOverrideKey, MaterialSamplerOverrides*> mSamplerOverrides;
 
 		SPtr<RenderBeastOptions> mOptions;
+		UINT32 mNextShadowRevision = 1; // 0 is reserved for "no revision assigned"
+
+		Vector<UINT32> mDirtyObjectDataIndices;
+		bool mRefreshAllObjectData = true;
+
+		/** Pool for RendererObject proxies, which level streaming can register and unregister in large bursts. */
+		PoolAlloc<sizeof(RendererObject), 128, alignof(RendererObject)> mRendererObjectAlloc;
+
+		/** Original mesh and sub-mesh ranges of an object whose elements were redirected to a merged batch mesh. */
+		struct StaticBatchedObject
+		{
+			RendererObject* object;
+			SPtr<Mesh> originalMesh;
+			Vector<SubMesh> originalSubMeshes;
+		};
+
+		Vector<StaticBatchedObject> mStaticBatchedObjects;
+		Vector<SPtr<Mesh>> mStaticBatchMeshes;
+		bool mStaticBatchesDirty = false;
+
+		/** Identifies a renderable whose skinned bounds reduction was dispatched in a previous frame. */
+		struct SkinnedBoundsEntry
+		{
+			UINT32 renderableId;
+			Renderable* renderable; /**< Used only for identity checks, never dereferenced. */
+		};
+
+		// Double-buffered so results of the reduction dispatched last frame can be read back without a GPU sync
+		SPtr<GpuBuffer> mSkinnedBoundsOutput[2];
+		Vector<SkinnedBoundsEntry> mSkinnedBoundsEntries[2];
+		UINT32 mSkinnedBoundsBufferIdx = 0;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(PerFrameParamDef)
@@ -10,12 +10,21 @@
 #include "BsRendererLight.h"
 #include "BsRendererScene.h"
 #include "BsRenderBeast.h"
+#include "BsRenderBeastOptions.h"
+#include "Math/BsSIMD.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
 
 namespace bs { namespace ct
 {
 	PerCameraParamDef gPerCameraParamDef;
 	SkyboxParamDef gSkyboxParamDef;
 
+	// Number of slices the temporal visibility cache is split into for stale-checking. One slice gets re-tested every
+	// frame regardless of its cached state, so every cached entry is re-validated at least this often (in frames).
+	static constexpr UINT32 VIS_CACHE_STALE_SLICES = 32;
+
 	SkyboxMat::SkyboxMat()
 	{
 		if(mParams->hasTexture(GPT_FRAGMENT_PROGRAM, "gSkyTex"))
@@ -70,13 +79,17 @@ namespace bs { namespace ct
 	}
 
 	RendererView::RendererView()
-		: mCamera(nullptr), mRenderSettingsHash(0), mViewIdx(-1)
+		: mCamera(nullptr), mRenderSettingsHash(0), mViewIdx(-1), mRedraw(true), mResolutionScale(1.0f)
+		, mCullFrustumPacketDirty(true), mVisCacheOrigin(BsZero), mVisCacheLayers(0), mVisCacheFrameIdx(0)
+		, mVisCacheValid(false)
 	{
 		mParamBuffer = gPerCameraParamDef.createBuffer();
 	}
 
 	RendererView::RendererView(const RENDERER_VIEW_DESC& desc)
 		: mProperties(desc), mTargetDesc(desc.target), mCamera(desc.sceneCamera), mRenderSettingsHash(0), mViewIdx(-1)
+		, mRedraw(true), mResolutionScale(1.0f), mCullFrustumPacketDirty(true), mVisCacheOrigin(BsZero)
+		, mVisCacheLayers(0), mVisCacheFrameIdx(0), mVisCacheValid(false)
 	{
 		mParamBuffer = gPerCameraParamDef.createBuffer();
 		mProperties.prevViewProjTransform = mProperties.viewProjTransform;
@@ -94,6 +107,9 @@ namespace bs { namespace ct
 			transparentStateReduction = StateReduction::Distance; // Transparent object MUST be sorted by distance
 
 		mTransparentQueue = bs_shared_ptr_new<RenderQueue>(transparentStateReduction);
+
+		// Holds transparent objects whose blending is order independent, so they can always be sorted for batching
+		mUnorderedTransparentQueue = bs_shared_ptr_new<RenderQueue>(StateReduction::Material);
 	}
 
 	void RendererView::setRenderSettings(const SPtr<RenderSettings>& settings)
@@ -104,7 +120,18 @@ namespace bs { namespace ct
 		if (settings != nullptr)
 			*mRenderSettings = *settings;
 
+		if (mRenderSettings->previewMode)
+		{
+			// Previews render through a minimal path, force off anything expensive regardless of the other settings
+			mRenderSettings->enableShadows = false;
+			mRenderSettings->enableIndirectLighting = false;
+			mRenderSettings->ambientOcclusion.enabled = false;
+			mRenderSettings->screenSpaceReflections.enabled = false;
+			mRenderSettings->enableFXAA = false;
+		}
+
 		mRenderSettingsHash++;
+		mRedraw = true;
 
 		// Update compositor hierarchy (Note: Needs to be called even when viewport size (or other information) changes,
 		// but we're currently calling it here as all such calls are followed by setRenderSettings.
@@ -120,6 +147,9 @@ namespace bs { namespace ct
 		mProperties.projTransform = proj;
 		mProperties.cullFrustum = worldFrustum;
 		mProperties.viewProjTransform = proj * view;
+
+		mCullFrustumPacketDirty = true;
+		mRedraw = true;
 	}
 
 	void RendererView::setView(const RENDERER_VIEW_DESC& desc)
@@ -129,10 +159,62 @@ namespace bs { namespace ct
 		mProperties.viewProjTransform = desc.projTransform * desc.viewTransform;
 		mProperties.prevViewProjTransform = Matrix4::IDENTITY;
 		mTargetDesc = desc.target;
+		mRedraw = true;
+		mResolutionScale = 1.0f;
+		mCullFrustumPacketDirty = true;
+		mVisCacheValid = false;
 
 		setStateReductionMode(desc.stateReduction);
 	}
 
+	void RendererView::_updateResolutionScaling(float gpuFrameTimeMs)
+	{
+		const DynamicResolutionSettings& settings = mRenderSettings->dynamicResolution;
+		if (!settings.enabled)
+		{
+			_setResolutionScale(1.0f);
+			return;
+		}
+
+		float scale = mResolutionScale;
+		if (gpuFrameTimeMs > 0.0f && settings.targetFrameTimeMs > 0.0f)
+		{
+			float ratio = settings.targetFrameTimeMs / gpuFrameTimeMs;
+
+			// When over budget reduce the resolution proportionally to the overshoot so the target is reached within
+			// a frame or two. When under budget recover gradually instead, with a dead zone in-between so the scale
+			// doesn't oscillate around the target.
+			if (ratio < 0.97f)
+				scale *= Math::sqrt(ratio);
+			else if (ratio > 1.15f)
+				scale += 0.02f;
+		}
+
+		_setResolutionScale(Math::clamp(scale, settings.minResolutionScale, settings.maxResolutionScale));
+	}
+
+	void RendererView::_setResolutionScale(float scale)
+	{
+		scale = Math::clamp(scale, 0.1f, 1.0f);
+		if (Math::approxEquals(scale, mResolutionScale))
+			return;
+
+		mResolutionScale = scale;
+
+		const Rect2I& nativeRect = mTargetDesc.viewRect;
+
+		Rect2I scaledRect;
+		scaledRect.x = Math::floorToInt(nativeRect.x * scale);
+		scaledRect.y = Math::floorToInt(nativeRect.y * scale);
+		scaledRect.width = std::max(1U, (UINT32)(nativeRect.width * scale));
+		scaledRect.height = std::max(1U, (UINT32)(nativeRect.height * scale));
+
+		mProperties.viewRect = scaledRect;
+		mRedraw = true;
+
+		updatePerViewBuffer();
+	}
+
 	void RendererView::beginFrame()
 	{
 		// Note: inverse view-projection can be cached, it doesn't change every frame
@@ -155,10 +237,13 @@ namespace bs { namespace ct
 		mDeferredOpaqueQueue->clear();
 		mForwardOpaqueQueue->clear();
 		mTransparentQueue->clear();
+		mUnorderedTransparentQueue->clear();
+
+		mRedraw = false;
 	}
 
 	void RendererView::determineVisible(const Vector<RendererObject*>& renderables, const Vector<CullInfo>& cullInfos,
-		Vector<bool>* visibility)
+		const PackedCullBounds& cullBounds, const Vector<UINT32>& cullVersions, Vector<bool>* visibility)
 	{
 		mVisibility.renderables.clear();
 		mVisibility.renderables.resize(renderables.size(), false);
@@ -166,7 +251,16 @@ namespace bs { namespace ct
 		if (mRenderSettings->overlayOnly)
 			return;
 
-		calculateVisibility(cullInfos, mVisibility.renderables);
+		updateVisibilityCache(cullInfos, cullVersions, mVisibility.renderables);
+
+		// Pull in the occlusion depth captured during a previous frame, if enabled and available
+		bool occlusionCulling = mRenderSettings->enableOcclusionCulling && mOcclusionData.captured;
+		bool unorderedTransparency = mRenderSettings->enableOrderIndependentTransparency;
+		if (occlusionCulling && !mOcclusionData.ready)
+		{
+			mOcclusionData.texture->readData(*mOcclusionData.depthData);
+			mOcclusionData.ready = true;
+		}
 
 		// Update per-object param buffers and queue render elements
 		for(UINT32 i = 0; i < (UINT32)cullInfos.size(); i++)
@@ -174,6 +268,12 @@ namespace bs { namespace ct
 			if (!mVisibility.renderables[i])
 				continue;
 
+			if (occlusionCulling && isOccluded(cullInfos[i].bounds.getBox()))
+			{
+				mVisibility.renderables[i] = false;
+				continue;
+			}
+
 			const AABox& boundingBox = cullInfos[i].bounds.getBox();
 			float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
 
@@ -183,7 +283,12 @@ namespace bs { namespace ct
 				ShaderFlags shaderFlags = renderElem.material->getShader()->getFlags();
 
 				if (shaderFlags.isSet(ShaderFlag::Transparent))
-					mTransparentQueue->add(&renderElem, distanceToCamera);
+				{
+					if (unorderedTransparency && renderElem.orderIndependentBlend)
+						mUnorderedTransparentQueue->add(&renderElem, distanceToCamera);
+					else
+						mTransparentQueue->add(&renderElem, distanceToCamera);
+				}
 				else if (shaderFlags.isSet(ShaderFlag::Forward))
 					mForwardOpaqueQueue->add(&renderElem, distanceToCamera);
 				else
@@ -204,6 +309,7 @@ namespace bs { namespace ct
 		mForwardOpaqueQueue->sort();
 		mDeferredOpaqueQueue->sort();
 		mTransparentQueue->sort();
+		mUnorderedTransparentQueue->sort();
 	}
 
 	void RendererView::determineVisible(const Vector<RendererLight>& lights, const Vector<Sphere>& bounds, 
@@ -239,6 +345,29 @@ namespace bs { namespace ct
 
 		calculateVisibility(bounds, *perViewVisibility);
 
+		// Cull lights whose projected influence is too small to meaningfully contribute. Frustum-visible but sub-pixel
+		// lights otherwise still pay full light assignment cost and can trigger shadow map renders.
+		const float minScreenRadius = gRenderBeast()->getCoreOptions()->minLightScreenRadius;
+		if (minScreenRadius > 0.0f)
+		{
+			// Same screen-space radius approximation used by the shadow system for shadow map sizing
+			const float screenScaleX = mProperties.projTransform[0][0] * mProperties.viewRect.width * 0.5f;
+			const float screenScaleY = mProperties.projTransform[1][1] * mProperties.viewRect.height * 0.5f;
+			const float screenScale = std::max(screenScaleX, screenScaleY);
+
+			for (UINT32 i = 0; i < (UINT32)lights.size(); i++)
+			{
+				if (!(*perViewVisibility)[i])
+					continue;
+
+				const float depth = mProperties.viewProjTransform.multiply(Vector4(bounds[i].getCenter(), 1.0f)).w;
+				const float screenRadius = bounds[i].getRadius() / std::max(depth, 1.0f) * screenScale;
+
+				if (screenRadius < minScreenRadius)
+					(*perViewVisibility)[i] = false;
+			}
+		}
+
 		if(visibility != nullptr)
 		{
 			for (UINT32 i = 0; i < (UINT32)lights.size(); i++)
@@ -250,6 +379,134 @@ namespace bs { namespace ct
 		}
 	}
 
+	void RendererView::updateVisibilityCache(const Vector<CullInfo>& cullInfos, const Vector<UINT32>& cullVersions,
+		Vector<bool>& visibility)
+	{
+		const UINT32 count = (UINT32)cullInfos.size();
+		const Vector<Plane>& planes = mProperties.cullFrustum.getPlanes();
+
+		const Matrix4& viewTf = mProperties.viewTransform;
+		Vector3 viewAxes[3] =
+		{
+			Vector3(viewTf[0][0], viewTf[0][1], viewTf[0][2]),
+			Vector3(viewTf[1][0], viewTf[1][1], viewTf[1][2]),
+			Vector3(viewTf[2][0], viewTf[2][1], viewTf[2][2])
+		};
+
+		bool fullCull = !mVisCacheValid || count != (UINT32)mVisCache.size() ||
+			mProperties.visibleLayers != mVisCacheLayers;
+
+		if (!fullCull)
+		{
+			// Conservative bound on how much any frustum plane could have moved relative to an object: the camera
+			// translation, plus the camera rotation (in radians) multiplied by the object's distance from the camera
+			const float transDelta = (mProperties.viewOrigin - mVisCacheOrigin).length();
+
+			float rotDelta = 0.0f;
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				float axisDot = Math::clamp(viewAxes[i].dot(mVisCacheViewAxes[i]), -1.0f, 1.0f);
+				rotDelta = std::max(rotDelta, Math::acos(axisDot).valueRadians());
+			}
+
+			const bool cameraMoved = transDelta > 0.0f || rotDelta > 0.0f;
+
+			mVisCacheRetests.clear();
+			for (UINT32 i = 0; i < count; i++)
+			{
+				VisibilityCacheEntry& entry = mVisCache[i];
+
+				// Object state changed, or its turn in the rotating stale-check slice came up
+				bool retest = entry.version != cullVersions[i] ||
+					((i + mVisCacheFrameIdx) % VIS_CACHE_STALE_SLICES) == 0;
+
+				if (!retest && cameraMoved)
+				{
+					const Sphere& bounds = cullInfos[i].bounds.getSphere();
+					float distance = (bounds.getCenter() - mVisCacheOrigin).length() + bounds.getRadius();
+
+					entry.margin -= transDelta + rotDelta * distance;
+					if (entry.margin <= 0.0f)
+						retest = true;
+				}
+
+				if (retest)
+					mVisCacheRetests.push_back(i);
+			}
+
+			// Large camera jump (or mass object movement) invalidated most of the cache, a full re-cull is cheaper
+			if ((UINT32)mVisCacheRetests.size() * 2 > count)
+				fullCull = true;
+		}
+
+		if (fullCull)
+		{
+			mVisCache.resize(count);
+			for (UINT32 i = 0; i < count; i++)
+			{
+				VisibilityCacheEntry& entry = mVisCache[i];
+				entry.visible = cullWithMargin(cullInfos[i], planes, entry.margin);
+				entry.version = cullVersions[i];
+			}
+
+			mVisCacheValid = true;
+			mVisCacheLayers = mProperties.visibleLayers;
+		}
+		else
+		{
+			for (UINT32 idx : mVisCacheRetests)
+			{
+				VisibilityCacheEntry& entry = mVisCache[idx];
+				entry.visible = cullWithMargin(cullInfos[idx], planes, entry.margin);
+				entry.version = cullVersions[idx];
+			}
+		}
+
+		mVisCacheOrigin = mProperties.viewOrigin;
+		for (UINT32 i = 0; i < 3; i++)
+			mVisCacheViewAxes[i] = viewAxes[i];
+
+		mVisCacheFrameIdx++;
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			if (mVisCache[i].visible)
+				visibility[i] = true;
+		}
+	}
+
+	bool RendererView::cullWithMargin(const CullInfo& cullInfo, const Vector<Plane>& planes, float& margin) const
+	{
+		if ((cullInfo.layer & mProperties.visibleLayers) == 0)
+		{
+			// Camera movement can't change the layer test, only a version bump can
+			margin = std::numeric_limits<float>::max();
+			return false;
+		}
+
+		const AABox& box = cullInfo.bounds.getBox();
+		const Vector3 center = box.getCenter();
+		const Vector3 extents = box.getHalfSize();
+
+		float minDist = std::numeric_limits<float>::max();
+		for (auto& plane : planes)
+		{
+			// Distance from the plane, offset by the effective radius of the box along the plane normal. The box is
+			// fully on the negative side of the plane (and therefore outside the frustum) when negative.
+			float dist = center.dot(plane.normal) - plane.d;
+			float radius = extents.x * fabs(plane.normal.x) + extents.y * fabs(plane.normal.y) +
+				extents.z * fabs(plane.normal.z);
+
+			minDist = std::min(minDist, dist + radius);
+		}
+
+		// Either the distance until the box starts touching the nearest frustum plane (when inside), or the distance
+		// until it stops being separated by the most separating plane (when outside)
+		margin = fabs(minDist);
+
+		return minDist >= 0.0f;
+	}
+
 	void RendererView::calculateVisibility(const Vector<CullInfo>& cullInfos, Vector<bool>& visibility) const
 	{
 		UINT64 cameraLayers = mProperties.visibleLayers;
@@ -275,24 +532,99 @@ namespace bs { namespace ct
 		}
 	}
 
-	void RendererView::calculateVisibility(const Vector<Sphere>& bounds, Vector<bool>& visibility) const
+	void RendererView::calculateVisibility(const Vector<CullInfo>& cullInfos, const PackedCullBounds& cullBounds,
+		Vector<bool>& visibility) const
 	{
+		UINT64 cameraLayers = mProperties.visibleLayers;
+		const Vector<Plane>& planes = mProperties.cullFrustum.getPlanes();
+		UINT32 numPlanes = (UINT32)planes.size();
+
+		constexpr UINT32 LANES = 4;
+		UINT32 count = (UINT32)cullInfos.size();
+		UINT32 numBatches = count / LANES;
+
+		for (UINT32 batch = 0; batch < numBatches; batch++)
+		{
+			UINT32 base = batch * LANES;
+
+			auto cx = simd::load_u<simd::float32x4>(&cullBounds.centerX[base]);
+			auto cy = simd::load_u<simd::float32x4>(&cullBounds.centerY[base]);
+			auto cz = simd::load_u<simd::float32x4>(&cullBounds.centerZ[base]);
+
+			auto ex = simd::load_u<simd::float32x4>(&cullBounds.extentX[base]);
+			auto ey = simd::load_u<simd::float32x4>(&cullBounds.extentY[base]);
+			auto ez = simd::load_u<simd::float32x4>(&cullBounds.extentZ[base]);
+
+			simd::mask_float32x4 inside = simd::cmp_eq(cx, cx);
+			for (UINT32 j = 0; j < numPlanes; j++)
+			{
+				const Plane& plane = planes[j];
+
+				simd::float32x4 nx = simd::splat(plane.normal.x);
+				simd::float32x4 ny = simd::splat(plane.normal.y);
+				simd::float32x4 nz = simd::splat(plane.normal.z);
+
+				// Distance from the plane, offset by the effective radius of the box along the plane normal. The box
+				// is fully on the negative side of the plane (and therefore outside the frustum) when negative.
+				simd::float32x4 dot = simd::add(simd::add(
+					simd::mul(cx, nx), simd::mul(cy, ny)), simd::mul(cz, nz));
+				simd::float32x4 dist = simd::sub(dot, plane.d);
+
+				simd::float32x4 radius = simd::add(simd::add(
+					simd::mul(ex, simd::abs(nx)), simd::mul(ey, simd::abs(ny))), simd::mul(ez, simd::abs(nz)));
+
+				inside = simd::bit_and(inside, simd::cmp_ge(simd::add(dist, radius), 0.0f));
+			}
+
+			SIMDPP_ALIGN(16) UINT32 laneMask[LANES];
+			simd::store(laneMask, simd::bit_cast<simd::uint32x4>(inside.unmask()));
+
+			for (UINT32 lane = 0; lane < LANES; lane++)
+			{
+				UINT32 i = base + lane;
+				if (laneMask[lane] != 0 && (cullInfos[i].layer & cameraLayers) != 0)
+					visibility[i] = true;
+			}
+		}
+
+		// Scalar remainder for arrays that aren't a multiple of the SIMD width
 		const ConvexVolume& worldFrustum = mProperties.cullFrustum;
+		for (UINT32 i = numBatches * LANES; i < count; i++)
+		{
+			if ((cullInfos[i].layer & cameraLayers) == 0)
+				continue;
+
+			if (worldFrustum.intersects(cullInfos[i].bounds.getBox()))
+				visibility[i] = true;
+		}
+	}
+
+	void RendererView::calculateVisibility(const Vector<Sphere>& bounds, Vector<bool>& visibility) const
+	{
+		if (mCullFrustumPacketDirty)
+		{
+			mCullFrustumPacket.build(mProperties.cullFrustum);
+			mCullFrustumPacketDirty = false;
+		}
 
 		for (UINT32 i = 0; i < (UINT32)bounds.size(); i++)
 		{
-			if (worldFrustum.intersects(bounds[i]))
+			if (mCullFrustumPacket.intersects(bounds[i]))
 				visibility[i] = true;
 		}
 	}
 
 	void RendererView::calculateVisibility(const Vector<AABox>& bounds, Vector<bool>& visibility) const
 	{
-		const ConvexVolume& worldFrustum = mProperties.cullFrustum;
+		if (mCullFrustumPacketDirty)
+		{
+			mCullFrustumPacket.build(mProperties.cullFrustum);
+			mCullFrustumPacketDirty = false;
+		}
 
 		for (UINT32 i = 0; i < (UINT32)bounds.size(); i++)
 		{
-			if (worldFrustum.intersects(bounds[i]))
+			if (mCullFrustumPacket.intersects(bounds[i]))
 				visibility[i] = true;
 		}
 	}
@@ -458,7 +790,7 @@ namespace bs { namespace ct
 		Vector2 nearFar(mProperties.nearPlane, mProperties.farPlane);
 		gPerCameraParamDef.gNearFar.set(mParamBuffer, nearFar);
 
-		const Rect2I& viewRect = mTargetDesc.viewRect;
+		const Rect2I& viewRect = mProperties.viewRect;
 
 		Vector4I viewportRect;
 		viewportRect[0] = viewRect.x;
@@ -481,13 +813,15 @@ namespace bs { namespace ct
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 		const RenderAPIInfo& rapiInfo = rapi.getAPIInfo();
-		const Rect2I& viewRect = mTargetDesc.viewRect;
-		
+		const Rect2I& viewRect = mProperties.viewRect;
+
 		float halfWidth = viewRect.width * 0.5f;
 		float halfHeight = viewRect.height * 0.5f;
 
-		float rtWidth = mTargetDesc.targetWidth != 0 ? (float)mTargetDesc.targetWidth : 20.0f;
-		float rtHeight = mTargetDesc.targetHeight != 0 ? (float)mTargetDesc.targetHeight : 20.0f;
+		// Target dimensions are scaled together with the view rectangle, as intermediate targets the scene renders
+		// into are allocated at the scaled size
+		float rtWidth = mTargetDesc.targetWidth != 0 ? (float)mTargetDesc.targetWidth * mResolutionScale : 20.0f;
+		float rtHeight = mTargetDesc.targetHeight != 0 ? (float)mTargetDesc.targetHeight * mResolutionScale : 20.0f;
 
 		Vector4 ndcToUV;
 		ndcToUV.x = halfWidth / rtWidth;
@@ -502,12 +836,118 @@ namespace bs { namespace ct
 		return ndcToUV;
 	}
 
-	void RendererView::updateLightGrid(const VisibleLightData& visibleLightData, 
+	void RendererView::updateLightGrid(const VisibleLightData& visibleLightData,
 		const VisibleReflProbeData& visibleReflProbeData)
 	{
 		mLightGrid.updateGrid(*this, visibleLightData, visibleReflProbeData, !mRenderSettings->enableLighting);
 	}
 
+	void RendererView::_captureOcclusionDepth(const SPtr<Texture>& source, UINT32 srcMip, UINT32 validWidth,
+		UINT32 validHeight) const
+	{
+		const TextureProperties& srcProps = source->getProperties();
+		UINT32 size = std::max(1U, srcProps.getWidth() >> srcMip);
+
+		if (mOcclusionData.texture == nullptr || mOcclusionData.texture->getProperties().getWidth() != size)
+		{
+			TEXTURE_DESC texDesc;
+			texDesc.type = TEX_TYPE_2D;
+			texDesc.width = size;
+			texDesc.height = size;
+			texDesc.format = PF_R32F;
+			texDesc.usage = TU_CPUREADABLE;
+
+			mOcclusionData.texture = Texture::create(texDesc);
+
+			mOcclusionData.depthData = bs_shared_ptr_new<PixelData>(size, size, 1, PF_R32F);
+			mOcclusionData.depthData->allocateInternalBuffer();
+		}
+
+		TEXTURE_COPY_DESC copyDesc;
+		copyDesc.srcMip = srcMip;
+
+		source->copy(mOcclusionData.texture, copyDesc);
+
+		mOcclusionData.viewProjTransform = mProperties.viewProjTransform;
+		mOcclusionData.validWidth = validWidth;
+		mOcclusionData.validHeight = validHeight;
+		mOcclusionData.captured = true;
+		mOcclusionData.ready = false;
+	}
+
+	bool RendererView::isOccluded(const AABox& bounds) const
+	{
+		if (mOcclusionData.validWidth == 0 || mOcclusionData.validHeight == 0)
+			return false;
+
+		RenderAPI& rapi = RenderAPI::instance();
+		const RenderAPIInfo& rapiInfo = rapi.getAPIInfo();
+
+		Vector2 ndcZToDeviceZ = getNDCZToDeviceZ();
+
+		// Row order of the read-back depth relative to NDC depends on the API's NDC and UV conventions (the same
+		// relationship the rasterizer used when the depth buffer was generated)
+		float ySign = (rapiInfo.isFlagSet(RenderAPIFeatureFlag::UVYAxisUp) ||
+			rapiInfo.isFlagSet(RenderAPIFeatureFlag::NDCYAxisDown)) ? 1.0f : -1.0f;
+
+		if (mProperties.flipView)
+			ySign = -ySign;
+
+		float minU = std::numeric_limits<float>::max();
+		float maxU = -std::numeric_limits<float>::max();
+		float minV = std::numeric_limits<float>::max();
+		float maxV = -std::numeric_limits<float>::max();
+		float minDepth = std::numeric_limits<float>::max();
+
+		for (UINT32 i = 0; i < 8; i++)
+		{
+			Vector3 corner = bounds.getCorner((AABox::Corner)i);
+			Vector4 clip = mOcclusionData.viewProjTransform.multiply(Vector4(corner.x, corner.y, corner.z, 1.0f));
+
+			// Bounds reach behind the near plane, assume visible
+			if (clip.w < 1e-4f)
+				return false;
+
+			float invW = 1.0f / clip.w;
+			float ndcX = clip.x * invW;
+			float ndcY = clip.y * invW;
+			float deviceZ = (clip.z * invW + ndcZToDeviceZ.y) * ndcZToDeviceZ.x;
+
+			minDepth = std::min(minDepth, deviceZ);
+
+			float u = ndcX * 0.5f + 0.5f;
+			float v = ySign * ndcY * 0.5f + 0.5f;
+
+			minU = std::min(minU, u);
+			maxU = std::max(maxU, u);
+			minV = std::min(minV, v);
+			maxV = std::max(maxV, v);
+		}
+
+		// Bounds extend past the view edge, where no occluder information is available, assume visible
+		if (minU < 0.0f || maxU > 1.0f || minV < 0.0f || maxV > 1.0f)
+			return false;
+
+		UINT32 x0 = (UINT32)(minU * mOcclusionData.validWidth);
+		UINT32 x1 = std::min(mOcclusionData.validWidth - 1, (UINT32)(maxU * mOcclusionData.validWidth));
+		UINT32 y0 = (UINT32)(minV * mOcclusionData.validHeight);
+		UINT32 y1 = std::min(mOcclusionData.validHeight - 1, (UINT32)(maxV * mOcclusionData.validHeight));
+
+		const PixelData& depthData = *mOcclusionData.depthData;
+		auto* depths = (const float*)depthData.getData();
+		UINT32 rowPitch = depthData.getRowPitch();
+
+		// Find the farthest potential occluder over the covered area
+		float farthestOccluder = 0.0f;
+		for (UINT32 y = y0; y <= y1; y++)
+		{
+			for (UINT32 x = x0; x <= x1; x++)
+				farthestOccluder = std::max(farthestOccluder, depths[y * rowPitch + x]);
+		}
+
+		return minDepth > farthestOccluder;
+	}
+
 	RendererViewGroup::RendererViewGroup()
 		:mShadowRenderer(2048)
 	{ }
@@ -551,10 +991,6 @@ namespace bs { namespace ct
 		mVisibility.renderables.resize(sceneInfo.renderables.size(), false);
 		mVisibility.renderables.assign(sceneInfo.renderables.size(), false);
 
-		for(UINT32 i = 0; i < numViews; i++)
-			mViews[i]->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos, &mVisibility.renderables);
-
-		// Calculate light visibility for all views
 		UINT32 numRadialLights = (UINT32)sceneInfo.radialLights.size();
 		mVisibility.radialLights.resize(numRadialLights, false);
 		mVisibility.radialLights.assign(numRadialLights, false);
@@ -563,16 +999,73 @@ namespace bs { namespace ct
 		mVisibility.spotLights.resize(numSpotLights, false);
 		mVisibility.spotLights.assign(numSpotLights, false);
 
-		for (UINT32 i = 0; i < numViews; i++)
+		bool parallelCulling = gRenderBeast()->getCoreOptions()->parallelCulling && numViews > 1;
+		if (parallelCulling)
 		{
-			if (mViews[i]->getRenderSettings().overlayOnly)
-				continue;
+			// Culling and render queue generation only touches per-view data, so farm each view out to a worker task and
+			// merge the per-view visibility into the group masks once all tasks are done.
+			SmallVector<SPtr<Task>, 8> tasks;
+			tasks.reserve(numViews);
+
+			for (UINT32 i = 0; i < numViews; i++)
+			{
+				RendererView* view = mViews[i];
+				auto worker = [view, &sceneInfo]()
+				{
+					view->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos,
+						sceneInfo.renderableCullBounds, sceneInfo.renderableCullVersions);
+
+					if (!view->getRenderSettings().overlayOnly)
+					{
+						view->determineVisible(sceneInfo.radialLights, sceneInfo.radialLightWorldBounds,
+							LightType::Radial);
+
+						view->determineVisible(sceneInfo.spotLights, sceneInfo.spotLightWorldBounds,
+							LightType::Spot);
+					}
+				};
+
+				tasks.push_back(Task::create("ViewCulling", worker));
+				TaskScheduler::instance().addTask(tasks.back());
+			}
 
-			mViews[i]->determineVisible(sceneInfo.radialLights, sceneInfo.radialLightWorldBounds, LightType::Radial,
-				&mVisibility.radialLights);
+			for (auto& task : tasks)
+				task->wait();
 
-			mViews[i]->determineVisible(sceneInfo.spotLights, sceneInfo.spotLightWorldBounds, LightType::Spot,
-				&mVisibility.spotLights);
+			for (UINT32 i = 0; i < numViews; i++)
+			{
+				const VisibilityInfo& viewVisibility = mViews[i]->getVisibilityMasks();
+
+				for (UINT32 j = 0; j < (UINT32)viewVisibility.renderables.size(); j++)
+					mVisibility.renderables[j] = mVisibility.renderables[j] || viewVisibility.renderables[j];
+
+				if (mViews[i]->getRenderSettings().overlayOnly)
+					continue;
+
+				for (UINT32 j = 0; j < numRadialLights; j++)
+					mVisibility.radialLights[j] = mVisibility.radialLights[j] || viewVisibility.radialLights[j];
+
+				for (UINT32 j = 0; j < numSpotLights; j++)
+					mVisibility.spotLights[j] = mVisibility.spotLights[j] || viewVisibility.spotLights[j];
+			}
+		}
+		else
+		{
+			for(UINT32 i = 0; i < numViews; i++)
+				mViews[i]->determineVisible(sceneInfo.renderables, sceneInfo.renderableCullInfos,
+					sceneInfo.renderableCullBounds, sceneInfo.renderableCullVersions, &mVisibility.renderables);
+
+			for (UINT32 i = 0; i < numViews; i++)
+			{
+				if (mViews[i]->getRenderSettings().overlayOnly)
+					continue;
+
+				mViews[i]->determineVisible(sceneInfo.radialLights, sceneInfo.radialLightWorldBounds, LightType::Radial,
+					&mVisibility.radialLights);
+
+				mViews[i]->determineVisible(sceneInfo.spotLights, sceneInfo.spotLightWorldBounds, LightType::Spot,
+					&mVisibility.spotLights);
+			}
 		}
 
 		// Calculate refl. probe visibility for all views
@@ -591,6 +1084,11 @@ namespace bs { namespace ct
 
 			mViews[i]->calculateVisibility(sceneInfo.reflProbeWorldBounds, mVisibility.reflProbes);
 		}
+	}
+
+	void RendererViewGroup::updateGpuData(const SceneInfo& sceneInfo)
+	{
+		UINT32 numViews = (UINT32)mViews.size();
 
 		// Organize light and refl. probe visibility infomation in a more GPU friendly manner
 
@@ -8,6 +8,7 @@
 #include "Renderer/BsRenderSettings.h"
 #include "Math/BsBounds.h"
 #include "Math/BsConvexVolume.h"
+#include "Math/BsConvexVolumePacket.h"
 #include "Shading/BsLightGrid.h"
 #include "Shading/BsShadowRendering.h"
 #include "BsRendererView.h"
@@ -195,6 +196,34 @@ namespace bs { namespace ct
 		Vector<bool> reflProbes;
 	};
 
+	/**
+	 * Contains a low resolution conservative (farthest) version of the view's depth buffer, captured during a previous
+	 * frame, along with the information required to project object bounds onto it. Used for occlusion culling.
+	 */
+	struct OcclusionDepthData
+	{
+		/** Small CPU-readable texture holding the farthest depth of each pixel block. */
+		SPtr<Texture> texture;
+
+		/** CPU-side copy of the texture contents. Only valid when @p ready is true. */
+		SPtr<PixelData> depthData;
+
+		/** View-projection transform of the view at the time the depth was captured. */
+		Matrix4 viewProjTransform = Matrix4::IDENTITY;
+
+		/** Number of texels covering the view area, horizontally. */
+		UINT32 validWidth = 0;
+
+		/** Number of texels covering the view area, vertically. */
+		UINT32 validHeight = 0;
+
+		/** True if the texture contains valid depth information. */
+		bool captured = false;
+
+		/** True if @p depthData contains a copy of the texture contents. */
+		bool ready = false;
+	};
+
 	/** Information used for culling an object against a view. */
 	struct CullInfo
 	{
@@ -206,6 +235,79 @@ namespace bs { namespace ct
 		UINT64 layer;
 	};
 
+	/**
+	 * Structure-of-arrays storage for world bounds of a set of objects. Stores box centers and extents in contiguous
+	 * per-component arrays so that multiple bounds can be tested at once using SIMD instructions. Entries are expected
+	 * to be kept in sync with an external array of objects (e.g. CullInfo).
+	 */
+	struct PackedCullBounds
+	{
+		/** Appends bounds for a new object at the end of the arrays. */
+		void add(const AABox& bounds)
+		{
+			Vector3 center = bounds.getCenter();
+			Vector3 extents = bounds.getHalfSize();
+
+			centerX.push_back(center.x);
+			centerY.push_back(center.y);
+			centerZ.push_back(center.z);
+
+			extentX.push_back(extents.x);
+			extentY.push_back(extents.y);
+			extentZ.push_back(extents.z);
+		}
+
+		/** Updates bounds of the object at the specified index. */
+		void update(UINT32 idx, const AABox& bounds)
+		{
+			Vector3 center = bounds.getCenter();
+			Vector3 extents = bounds.getHalfSize();
+
+			centerX[idx] = center.x;
+			centerY[idx] = center.y;
+			centerZ[idx] = center.z;
+
+			extentX[idx] = extents.x;
+			extentY[idx] = extents.y;
+			extentZ[idx] = extents.z;
+		}
+
+		/** Swaps bounds of the two objects at the specified indices. */
+		void swap(UINT32 a, UINT32 b)
+		{
+			std::swap(centerX[a], centerX[b]);
+			std::swap(centerY[a], centerY[b]);
+			std::swap(centerZ[a], centerZ[b]);
+
+			std::swap(extentX[a], extentX[b]);
+			std::swap(extentY[a], extentY[b]);
+			std::swap(extentZ[a], extentZ[b]);
+		}
+
+		/** Removes the bounds entry at the end of the arrays. */
+		void pop()
+		{
+			centerX.pop_back();
+			centerY.pop_back();
+			centerZ.pop_back();
+
+			extentX.pop_back();
+			extentY.pop_back();
+			extentZ.pop_back();
+		}
+
+		/** Returns the number of stored bounds. */
+		UINT32 size() const { return (UINT32)centerX.size(); }
+
+		Vector<float> centerX;
+		Vector<float> centerY;
+		Vector<float> centerZ;
+
+		Vector<float> extentX;
+		Vector<float> extentY;
+		Vector<float> extentZ;
+	};
+
 	/**	Renderer information specific to a single render target. */
 	struct RendererRenderTarget
 	{
@@ -239,6 +341,16 @@ namespace bs { namespace ct
 		/** Returns the scene camera this object is based of. This can be null for manually constructed renderer cameras. */
 		Camera* getSceneCamera() const { return mCamera; }
 
+		/**
+		 * Notifies the view that something relevant to its output changed and it must be drawn this frame. Only
+		 * relevant for views using on-demand drawing (see RenderSettings::onDemandDrawing), all other views are
+		 * redrawn every frame regardless. The flag is cleared when the view finishes rendering.
+		 */
+		void _notifyNeedsRedraw() { mRedraw = true; }
+
+		/** Checks has the view been explicitly marked as requiring a redraw, since the last time it was drawn. */
+		bool _needsRedraw() const { return mRedraw; }
+
 		/** Prepares render targets for rendering. When done call endFrame(). */
 		void beginFrame();
 
@@ -259,6 +371,14 @@ namespace bs { namespace ct
 		 */
 		const SPtr<RenderQueue>& getTransparentQueue() const { return mTransparentQueue; }
 
+		/** 
+		 * Returns a render queue containing transparent objects whose blend mode is order independent, sorted by 
+		 * material for batching instead of by distance. Only populated when order independent transparency is enabled 
+		 * in the render settings, otherwise such objects end up in the regular transparent queue. Make sure to call 
+		 * determineVisible() beforehand if view or object transforms changed since the last time it was called.
+		 */
+		const SPtr<RenderQueue>& getUnorderedTransparentQueue() const { return mUnorderedTransparentQueue; }
+
 		/** Returns the compositor in charge of rendering for this view. */
 		const RenderCompositor& getCompositor() const { return mCompositor; }
 
@@ -268,6 +388,11 @@ namespace bs { namespace ct
 		 * @param[in]	renderables			A set of renderable objects to iterate over and determine visibility for.
 		 * @param[in]	cullInfos			A set of world bounds & other information relevant for culling the provided
 		 *									renderable objects. Must be the same size as the @p renderables array.
+		 * @param[in]	cullBounds			Packed representation of the world bounds in @p cullInfos, used for testing
+		 *									multiple bounds at once. Must be the same size as the @p renderables array.
+		 * @param[in]	cullVersions		Per-renderable version numbers that are incremented whenever cull-relevant
+		 *									state of a renderable changes. Used for temporally caching visibility results
+		 *									across frames. Must be the same size as the @p renderables array.
 		 * @param[out]	visibility			Output parameter that will have the true bit set for any visible renderable
 		 *									object. If the bit for an object is already set to true, the method will never
 		 *									change it to false which allows the same bitfield to be provided to multiple
@@ -277,7 +402,7 @@ namespace bs { namespace ct
 		 *									retrieved by calling getVisibilityMask().
 		 */
 		void determineVisible(const Vector<RendererObject*>& renderables, const Vector<CullInfo>& cullInfos,
-			Vector<bool>* visibility = nullptr);
+			const PackedCullBounds& cullBounds, const Vector<UINT32>& cullVersions, Vector<bool>* visibility = nullptr);
 
 		/**
 		 * Calculates the visibility masks for all the lights of the provided type.
@@ -303,6 +428,15 @@ namespace bs { namespace ct
 		 */
 		void calculateVisibility(const Vector<CullInfo>& cullInfos, Vector<bool>& visibility) const;
 
+		/**
+		 * Culls the provided set of bounds against the current frustum and outputs a set of visibility flags determining
+		 * which entry is or isn't visible by this view. Equivalent to the CullInfo variant of this method, but uses the
+		 * packed bounds representation to test multiple bounds per iteration using SIMD instructions. @p cullInfos is
+		 * only used for layer filtering. All inputs must be arrays of the same size.
+		 */
+		void calculateVisibility(const Vector<CullInfo>& cullInfos, const PackedCullBounds& cullBounds,
+			Vector<bool>& visibility) const;
+
 		/**
 		 * Culls the provided set of bounds against the current frustum and outputs a set of visibility flags determining
 		 * which entry is or isn't visible by this view. Both inputs must be arrays of the same size.
@@ -350,6 +484,31 @@ namespace bs { namespace ct
 		 */
 		Vector4 getNDCToUV() const;
 
+		/**
+		 * Returns the scale at which the 3D scene portion of the view is currently being rendered, relative to the
+		 * output target resolution. Controlled by RenderSettings::dynamicResolution.
+		 */
+		float getResolutionScale() const { return mResolutionScale; }
+
+		/**
+		 * Adjusts the resolution scale of the view based on the measured GPU frame time, according to the view's
+		 * RenderSettings::dynamicResolution settings. To be called by the renderer once per frame, before the view is
+		 * rendered.
+		 *
+		 * @param[in]	gpuFrameTimeMs	Time the GPU took to render the last measured frame, in milliseconds. Provide
+		 *								zero or less if no measurement is available, in which case the current scale
+		 *								is kept.
+		 */
+		void _updateResolutionScaling(float gpuFrameTimeMs);
+
+		/**
+		 * Sets the scale at which the 3D scene portion of the view is rendered and recalculates the view rectangle
+		 * scene rendering occurs in. Intermediate render targets are allocated at the scaled size and the result is
+		 * resampled to the output target at the end of the frame. Overlays are unaffected and always render at the
+		 * output resolution.
+		 */
+		void _setResolutionScale(float scale);
+
 		/** Returns an index of this view within the parent view group. */
 		UINT32 getViewIdx() const { return mViewIdx; }
 
@@ -376,12 +535,56 @@ namespace bs { namespace ct
 		 */
 		static Vector2 getNDCZToViewZ(const Matrix4& projMatrix);
 
-		/** 
-		 * Returns a value that can be used for tranforming a depth value in NDC, to a depth value in device Z ([0, 1] 
-		 * range using this formula: (NDCZ + y) * x. 
+		/**
+		 * Returns a value that can be used for tranforming a depth value in NDC, to a depth value in device Z ([0, 1]
+		 * range using this formula: (NDCZ + y) * x.
 		 */
 		static Vector2 getNDCZToDeviceZ();
+
+		/**
+		 * Stores a low resolution conservative (farthest) version of the view's depth buffer, to be used for occlusion
+		 * culling during following frames. To be called by the render compositor once the scene depth is available.
+		 *
+		 * @param[in]	source			Texture containing the farthest-depth pyramid to capture from.
+		 * @param[in]	srcMip			Mip level of @p source to capture. Must be square, with a power of two size.
+		 * @param[in]	validWidth		Number of texels of the mip level covering the view area, horizontally.
+		 * @param[in]	validHeight		Number of texels of the mip level covering the view area, vertically.
+		 */
+		void _captureOcclusionDepth(const SPtr<Texture>& source, UINT32 srcMip, UINT32 validWidth,
+			UINT32 validHeight) const;
 	private:
+		/**
+		 * Checks if the provided world space bounds are fully hidden behind geometry recorded in the occlusion depth
+		 * buffer captured during a previous frame. The test is conservative - it can report a hidden object as visible,
+		 * but a visible object will only be reported as hidden if the captured depth is out of date (e.g. an occluder
+		 * moved away since the capture). Occlusion depth data must be available and read back before calling this.
+		 */
+		bool isOccluded(const AABox& bounds) const;
+
+		/** Cached visibility state of a single renderable, as seen by this view. See updateVisibilityCache(). */
+		struct VisibilityCacheEntry
+		{
+			float margin;
+			UINT32 version;
+			bool visible;
+		};
+
+		/**
+		 * Calculates per-renderable visibility like calculateVisibility(), but re-uses results cached from previous
+		 * frames where possible. Only objects whose cull version changed, objects whose margin to the frustum planes was
+		 * exhausted by camera movement, and a small rotating slice of potentially stale entries are re-tested each
+		 * frame. Falls back to a full re-cull when camera movement invalidates the majority of the cache.
+		 */
+		void updateVisibilityCache(const Vector<CullInfo>& cullInfos, const Vector<UINT32>& cullVersions,
+			Vector<bool>& visibility);
+
+		/**
+		 * Tests the provided bounds against the view frustum and the visible layer mask. Returns true if visible, and
+		 * outputs the margin - the minimum world-space distance the object (or the camera) needs to move before the
+		 * result of the test can change.
+		 */
+		bool cullWithMargin(const CullInfo& cullInfo, const Vector<Plane>& planes, float& margin) const;
+
 		RendererViewProperties mProperties;
 		RENDERER_VIEW_TARGET_DESC mTargetDesc;
 		Camera* mCamera;
@@ -389,6 +592,7 @@ namespace bs { namespace ct
 		SPtr<RenderQueue> mDeferredOpaqueQueue;
 		SPtr<RenderQueue> mForwardOpaqueQueue;
 		SPtr<RenderQueue> mTransparentQueue;
+		SPtr<RenderQueue> mUnorderedTransparentQueue;
 
 		RenderCompositor mCompositor;
 		SPtr<RenderSettings> mRenderSettings;
@@ -398,6 +602,25 @@ namespace bs { namespace ct
 		VisibilityInfo mVisibility;
 		LightGrid mLightGrid;
 		UINT32 mViewIdx;
+		bool mRedraw;
+		float mResolutionScale;
+
+		// Packed frustum planes, lazily rebuilt when the view transform changes. Built on first use within a frame and
+		// then shared by all sphere/box visibility queries against the view frustum.
+		mutable ConvexVolumePacket mCullFrustumPacket;
+		mutable bool mCullFrustumPacketDirty;
+
+		// Temporal visibility cache, see updateVisibilityCache()
+		Vector<VisibilityCacheEntry> mVisCache;
+		Vector<UINT32> mVisCacheRetests;
+		Vector3 mVisCacheOrigin;
+		Vector3 mVisCacheViewAxes[3];
+		UINT64 mVisCacheLayers;
+		UINT32 mVisCacheFrameIdx;
+		bool mVisCacheValid;
+
+		// Written by the render compositor mid-frame, which only has non-const access to the view
+		mutable OcclusionDepthData mOcclusionData;
 	};
 
 	/** Contains one or multiple RendererView%s that are in some way related. */
@@ -427,14 +650,14 @@ namespace bs { namespace ct
 		const VisibilityInfo& getVisibilityInfo() const { return mVisibility; }
 
 		/**
-		 * Returns information about lights visible from this group of views. Only valid after a call to 
-		 * determineVisibility().
+		 * Returns information about lights visible from this group of views. Only valid after a call to
+		 * updateGpuData().
 		 */
 		const VisibleLightData& getVisibleLightData() const { return mVisibleLightData; }
 
 		/**
-		 * Returns information about refl. probes visible from this group of views. Only valid after a call to 
-		 * determineVisibility().
+		 * Returns information about refl. probes visible from this group of views. Only valid after a call to
+		 * updateGpuData().
 		 */
 		const VisibleReflProbeData& getVisibleReflProbeData() const { return mVisibleReflProbeData; }
 
@@ -444,13 +667,23 @@ namespace bs { namespace ct
 		/** Returns the object responsible for rendering shadows for this view group. */
 		const ShadowRendering& getShadowRenderer() const { return mShadowRenderer; }
 
-		/** 
+		/**
 		 * Updates visibility information for the provided scene objects, from the perspective of all views in this group,
 		 * and updates the render queues of each individual view. Use getVisibilityInfo() to retrieve the calculated
 		 * visibility information.
+		 *
+		 * Performs CPU work only, so it may run on a worker thread. Call updateGpuData() on the core thread afterwards
+		 * to make the results available to the GPU.
 		 */
 		void determineVisibility(const SceneInfo& sceneInfo);
 
+		/**
+		 * Uploads information about visible lights and refl. probes to GPU buffers and builds the light grid of each
+		 * individual view, based on the results of the last determineVisibility() call. Issues render API commands and
+		 * must therefore be called from the core thread, before the group is rendered.
+		 */
+		void updateGpuData(const SceneInfo& sceneInfo);
+
 	private:
 		Vector<RendererView*> mViews;
 		VisibilityInfo mVisibility;
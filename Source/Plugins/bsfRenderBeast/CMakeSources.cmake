@@ -32,6 +32,9 @@ set(BS_RENDERBEAST_INC_SHADING
 	"Shading/BsLightProbes.h"
 	"Shading/BsShadowRendering.h"
 	"Shading/BsPostProcessing.h"
+	"Shading/BsMorphShapeBlend.h"
+	"Shading/BsGpuCulling.h"
+	"Shading/BsSkinnedBounds.h"
 )
 
 set(BS_RENDERBEAST_SRC_SHADING
@@ -41,6 +44,17 @@ set(BS_RENDERBEAST_SRC_SHADING
 	"Shading/BsLightProbes.cpp"
 	"Shading/BsShadowRendering.cpp"
 	"Shading/BsPostProcessing.cpp"
+	"Shading/BsMorphShapeBlend.cpp"
+	"Shading/BsGpuCulling.cpp"
+	"Shading/BsSkinnedBounds.cpp"
+)
+
+set(BS_RENDERBEAST_INC_PARTICLES
+	"Particles/BsGpuParticleSimulation.h"
+)
+
+set(BS_RENDERBEAST_SRC_PARTICLES
+	"Particles/BsGpuParticleSimulation.cpp"
 )
 
 set(BS_RENDERBEAST_INC_UTILITY
@@ -57,6 +71,7 @@ set(BS_RENDERBEAST_SRC_UTILITY
 
 source_group("" FILES ${BS_RENDERBEAST_INC_NOFILTER} ${BS_RENDERBEAST_SRC_NOFILTER})
 source_group("Shading" FILES ${BS_RENDERBEAST_INC_SHADING} ${BS_RENDERBEAST_SRC_SHADING})
+source_group("Particles" FILES ${BS_RENDERBEAST_INC_PARTICLES} ${BS_RENDERBEAST_SRC_PARTICLES})
 source_group("Utility" FILES ${BS_RENDERBEAST_INC_UTILITY} ${BS_RENDERBEAST_SRC_UTILITY})
 
 set(BS_RENDERBEAST_SRC
@@ -64,6 +79,8 @@ set(BS_RENDERBEAST_SRC
 	${BS_RENDERBEAST_SRC_NOFILTER}
 	${BS_RENDERBEAST_INC_SHADING}
 	${BS_RENDERBEAST_SRC_SHADING}
+	${BS_RENDERBEAST_INC_PARTICLES}
+	${BS_RENDERBEAST_SRC_PARTICLES}
 	${BS_RENDERBEAST_INC_UTILITY}
 	${BS_RENDERBEAST_SRC_UTILITY}
 )
\ No newline at end of file
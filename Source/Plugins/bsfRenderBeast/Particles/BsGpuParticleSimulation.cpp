@@ -0,0 +1,158 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGpuParticleSimulation.h"
+#include "RenderAPI/BsGpuBuffer.h"
+
+namespace bs { namespace ct
+{
+	GpuParticleInjectParamDef gGpuParticleInjectParamDef;
+	GpuParticleSimulateParamDef gGpuParticleSimulateParamDef;
+
+	/** Number of threads in a single thread group of the particle compute shaders. */
+	const static UINT32 NUM_THREADS = 64;
+
+	GpuParticleSystem::GpuParticleSystem(UINT32 capacity)
+		:mCapacity(capacity)
+	{
+		GPU_BUFFER_DESC stateDesc;
+		stateDesc.type = GBT_STANDARD;
+		stateDesc.elementCount = capacity;
+		stateDesc.format = BF_32X4F;
+		stateDesc.usage = GBU_STATIC;
+		stateDesc.randomGpuWrite = true;
+
+		// All particles start off dead (zero remaining lifetime)
+		Vector<Vector4> initialState(capacity, Vector4::ZERO);
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			mPositionAndLife[i] = GpuBuffer::create(stateDesc);
+			mPositionAndLife[i]->writeData(0, capacity * sizeof(Vector4), initialState.data(), BWT_DISCARD);
+
+			mVelocity[i] = GpuBuffer::create(stateDesc);
+			mVelocity[i]->writeData(0, capacity * sizeof(Vector4), initialState.data(), BWT_DISCARD);
+		}
+
+		GPU_BUFFER_DESC deadListDesc;
+		deadListDesc.type = GBT_STANDARD;
+		deadListDesc.elementCount = capacity;
+		deadListDesc.format = BF_32X1U;
+		deadListDesc.usage = GBU_STATIC;
+		deadListDesc.randomGpuWrite = true;
+
+		mDeadList = GpuBuffer::create(deadListDesc);
+
+		Vector<UINT32> deadIndices(capacity);
+		for (UINT32 i = 0; i < capacity; i++)
+			deadIndices[i] = i;
+
+		mDeadList->writeData(0, capacity * sizeof(UINT32), deadIndices.data(), BWT_DISCARD);
+
+		GPU_BUFFER_DESC counterDesc;
+		counterDesc.type = GBT_STANDARD;
+		counterDesc.elementCount = 1;
+		counterDesc.format = BF_32X1U;
+		counterDesc.usage = GBU_STATIC;
+		counterDesc.randomGpuWrite = true;
+
+		mDeadCounter = GpuBuffer::create(counterDesc);
+		mDeadCounter->writeData(0, sizeof(UINT32), &capacity, BWT_DISCARD);
+	}
+
+	void GpuParticleSystem::simulate(const GpuParticleSpawnInfo* spawnInfos, UINT32 numSpawn,
+		const Vector3& acceleration, float timeDelta)
+	{
+		// Inject new particles into the buffers the simulation will read from this frame
+		if (numSpawn > 0)
+		{
+			if (mSpawnInfoBuffer == nullptr || mSpawnInfoBuffer->getProperties().getElementCount() < numSpawn)
+			{
+				GPU_BUFFER_DESC spawnDesc;
+				spawnDesc.type = GBT_STRUCTURED;
+				spawnDesc.elementCount = numSpawn;
+				spawnDesc.elementSize = sizeof(GpuParticleSpawnInfo);
+				spawnDesc.format = BF_UNKNOWN;
+				spawnDesc.usage = GBU_DYNAMIC;
+
+				mSpawnInfoBuffer = GpuBuffer::create(spawnDesc);
+			}
+
+			mSpawnInfoBuffer->writeData(0, numSpawn * sizeof(GpuParticleSpawnInfo), spawnInfos, BWT_DISCARD);
+
+			GpuParticleInjectMat::get()->execute(mSpawnInfoBuffer, numSpawn, mPositionAndLife[mReadBufferIdx],
+				mVelocity[mReadBufferIdx], mDeadCounter, mDeadList);
+		}
+
+		const UINT32 writeBufferIdx = (mReadBufferIdx + 1) % 2;
+
+		GpuParticleSimulateMat::get()->execute(mPositionAndLife[mReadBufferIdx], mVelocity[mReadBufferIdx],
+			mPositionAndLife[writeBufferIdx], mVelocity[writeBufferIdx], mDeadCounter, mDeadList, mCapacity,
+			acceleration, timeDelta);
+
+		mReadBufferIdx = writeBufferIdx;
+	}
+
+	GpuParticleInjectMat::GpuParticleInjectMat()
+	{
+		mParamBuffer = gGpuParticleInjectParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gSpawnInfos", mSpawnInfosParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gPositionAndLife", mPositionAndLifeParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gVelocity", mVelocityParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDeadCounter", mDeadCounterParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDeadList", mDeadListParam);
+	}
+
+	void GpuParticleInjectMat::execute(const SPtr<GpuBuffer>& spawnInfos, UINT32 numSpawn,
+		const SPtr<GpuBuffer>& positionAndLife, const SPtr<GpuBuffer>& velocity, const SPtr<GpuBuffer>& deadCounter,
+		const SPtr<GpuBuffer>& deadList)
+	{
+		mSpawnInfosParam.set(spawnInfos);
+		mPositionAndLifeParam.set(positionAndLife);
+		mVelocityParam.set(velocity);
+		mDeadCounterParam.set(deadCounter);
+		mDeadListParam.set(deadList);
+
+		gGpuParticleInjectParamDef.gNumSpawned.set(mParamBuffer, numSpawn);
+
+		RenderAPI& rapi = RenderAPI::instance();
+
+		bind();
+		rapi.dispatchCompute(Math::divideAndRoundUp(numSpawn, NUM_THREADS));
+	}
+
+	GpuParticleSimulateMat::GpuParticleSimulateMat()
+	{
+		mParamBuffer = gGpuParticleSimulateParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gInPositionAndLife", mInPositionAndLifeParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gInVelocity", mInVelocityParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutPositionAndLife", mOutPositionAndLifeParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutVelocity", mOutVelocityParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDeadCounter", mDeadCounterParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDeadList", mDeadListParam);
+	}
+
+	void GpuParticleSimulateMat::execute(const SPtr<GpuBuffer>& inPositionAndLife, const SPtr<GpuBuffer>& inVelocity,
+		const SPtr<GpuBuffer>& outPositionAndLife, const SPtr<GpuBuffer>& outVelocity,
+		const SPtr<GpuBuffer>& deadCounter, const SPtr<GpuBuffer>& deadList, UINT32 numParticles,
+		const Vector3& acceleration, float timeDelta)
+	{
+		mInPositionAndLifeParam.set(inPositionAndLife);
+		mInVelocityParam.set(inVelocity);
+		mOutPositionAndLifeParam.set(outPositionAndLife);
+		mOutVelocityParam.set(outVelocity);
+		mDeadCounterParam.set(deadCounter);
+		mDeadListParam.set(deadList);
+
+		gGpuParticleSimulateParamDef.gNumParticles.set(mParamBuffer, numParticles);
+		gGpuParticleSimulateParamDef.gTimeDelta.set(mParamBuffer, timeDelta);
+		gGpuParticleSimulateParamDef.gAcceleration.set(mParamBuffer, acceleration);
+
+		RenderAPI& rapi = RenderAPI::instance();
+
+		bind();
+		rapi.dispatchCompute(Math::divideAndRoundUp(numParticles, NUM_THREADS));
+	}
+}}
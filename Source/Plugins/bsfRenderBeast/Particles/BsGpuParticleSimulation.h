@@ -0,0 +1,137 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Contains the initial state of a single newly spawned GPU particle. Must match the SpawnInfo structure in
+	 * GpuParticleInject.bsl.
+	 */
+	struct GpuParticleSpawnInfo
+	{
+		Vector3 position;
+		float lifetime;
+		Vector3 velocity;
+		float padding;
+	};
+
+	/**
+	 * Contains all state of a single GPU simulated particle system. Particle state lives in double-buffered GPU buffers
+	 * and free particle slots are tracked in a GPU-resident dead list, so the particle count never needs to be read back
+	 * to the CPU.
+	 */
+	class GpuParticleSystem
+	{
+	public:
+		/** Constructs a new system with enough space for @p capacity particles. All particles start off dead. */
+		GpuParticleSystem(UINT32 capacity);
+
+		/** Returns the maximum number of particles the system can contain. */
+		UINT32 getCapacity() const { return mCapacity; }
+
+		/**
+		 * Spawns new particles and advances the simulation by the specified amount of time. Expired particles return
+		 * their slots to the dead list, and spawned particles consume them, entirely on the GPU. Core thread only.
+		 *
+		 * @param[in]	spawnInfos		Initial state of the particles to spawn. Can be null if @p numSpawn is zero.
+		 * @param[in]	numSpawn		Number of particles to spawn. Spawns that exceed the remaining capacity are
+		 *								dropped.
+		 * @param[in]	acceleration	Constant acceleration to apply to all particles, in units per second squared.
+		 * @param[in]	timeDelta		Time to advance the simulation by, in seconds.
+		 */
+		void simulate(const GpuParticleSpawnInfo* spawnInfos, UINT32 numSpawn, const Vector3& acceleration,
+			float timeDelta);
+
+		/** Returns the buffer containing current particle positions (.xyz) and remaining lifetimes (.w). */
+		const SPtr<GpuBuffer>& getPositionAndLifeBuffer() const { return mPositionAndLife[mReadBufferIdx]; }
+
+		/** Returns the buffer containing current particle velocities (.xyz). */
+		const SPtr<GpuBuffer>& getVelocityBuffer() const { return mVelocity[mReadBufferIdx]; }
+
+	private:
+		UINT32 mCapacity;
+		UINT32 mReadBufferIdx = 0;
+
+		SPtr<GpuBuffer> mPositionAndLife[2];
+		SPtr<GpuBuffer> mVelocity[2];
+		SPtr<GpuBuffer> mDeadList;
+		SPtr<GpuBuffer> mDeadCounter;
+		SPtr<GpuBuffer> mSpawnInfoBuffer;
+	};
+
+	BS_PARAM_BLOCK_BEGIN(GpuParticleInjectParamDef)
+		BS_PARAM_BLOCK_ENTRY(int, gNumSpawned)
+	BS_PARAM_BLOCK_END
+
+	extern GpuParticleInjectParamDef gGpuParticleInjectParamDef;
+
+	/** Inserts newly spawned particles into a GPU particle system, consuming free slots from the dead list. */
+	class GpuParticleInjectMat : public RendererMaterial<GpuParticleInjectMat>
+	{
+		RMAT_DEF("GpuParticleInject.bsl")
+
+	public:
+		GpuParticleInjectMat();
+
+		/**
+		 * Executes the material, injecting @p numSpawn particles described by @p spawnInfos into the particle state
+		 * buffers.
+		 */
+		void execute(const SPtr<GpuBuffer>& spawnInfos, UINT32 numSpawn, const SPtr<GpuBuffer>& positionAndLife,
+			const SPtr<GpuBuffer>& velocity, const SPtr<GpuBuffer>& deadCounter, const SPtr<GpuBuffer>& deadList);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mSpawnInfosParam;
+		GpuParamBuffer mPositionAndLifeParam;
+		GpuParamBuffer mVelocityParam;
+		GpuParamBuffer mDeadCounterParam;
+		GpuParamBuffer mDeadListParam;
+	};
+
+	BS_PARAM_BLOCK_BEGIN(GpuParticleSimulateParamDef)
+		BS_PARAM_BLOCK_ENTRY(int, gNumParticles)
+		BS_PARAM_BLOCK_ENTRY(float, gTimeDelta)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gAcceleration)
+	BS_PARAM_BLOCK_END
+
+	extern GpuParticleSimulateParamDef gGpuParticleSimulateParamDef;
+
+	/**
+	 * Advances the state of all particles in a GPU particle system by a single time step, appending expired particle
+	 * slots to the dead list.
+	 */
+	class GpuParticleSimulateMat : public RendererMaterial<GpuParticleSimulateMat>
+	{
+		RMAT_DEF("GpuParticleSimulate.bsl")
+
+	public:
+		GpuParticleSimulateMat();
+
+		/** Executes the material, reading particle state from the input buffers and writing it to the output buffers. */
+		void execute(const SPtr<GpuBuffer>& inPositionAndLife, const SPtr<GpuBuffer>& inVelocity,
+			const SPtr<GpuBuffer>& outPositionAndLife, const SPtr<GpuBuffer>& outVelocity,
+			const SPtr<GpuBuffer>& deadCounter, const SPtr<GpuBuffer>& deadList, UINT32 numParticles,
+			const Vector3& acceleration, float timeDelta);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mInPositionAndLifeParam;
+		GpuParamBuffer mInVelocityParam;
+		GpuParamBuffer mOutPositionAndLifeParam;
+		GpuParamBuffer mOutVelocityParam;
+		GpuParamBuffer mDeadCounterParam;
+		GpuParamBuffer mDeadListParam;
+	};
+
+	/** @} */
+}}
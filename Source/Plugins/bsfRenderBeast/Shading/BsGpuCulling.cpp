@@ -0,0 +1,54 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsGpuCulling.h"
+#include "RenderAPI/BsGpuBuffer.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 CULL_THREADGROUP_SIZE = 64;
+
+	GpuCullParamDef gGpuCullParamDef;
+
+	GpuCullMat::GpuCullMat()
+	{
+		mParamBuffer = gGpuCullParamDef.createBuffer();
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gObjectData", mObjectDataParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gInputIndices", mInputIndicesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutputIndices", mOutputIndicesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDrawArgs", mDrawArgsParam);
+	}
+
+	void GpuCullMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", CULL_THREADGROUP_SIZE);
+	}
+
+	void GpuCullMat::execute(const ConvexVolume& frustum, UINT32 numInstances, const SPtr<GpuBuffer>& objectData,
+		const SPtr<GpuBuffer>& inputIndices, const SPtr<GpuBuffer>& outputIndices, const SPtr<GpuBuffer>& drawArgs)
+	{
+		const Vector<Plane>& planes = frustum.getPlanes();
+		assert(planes.size() == 6);
+
+		for (UINT32 i = 0; i < 6; i++)
+		{
+			const Plane& plane = planes[i];
+			Vector4 packedPlane(plane.normal.x, plane.normal.y, plane.normal.z, plane.d);
+
+			gGpuCullParamDef.gFrustumPlanes.set(mParamBuffer, packedPlane, i);
+		}
+
+		gGpuCullParamDef.gNumInstances.set(mParamBuffer, (INT32)numInstances);
+
+		mObjectDataParam.set(objectData);
+		mInputIndicesParam.set(inputIndices);
+		mOutputIndicesParam.set(outputIndices);
+		mDrawArgsParam.set(drawArgs);
+
+		bind();
+
+		UINT32 numGroups = Math::divideAndRoundUp(numInstances, CULL_THREADGROUP_SIZE);
+		RenderAPI::instance().dispatchCompute(numGroups);
+	}
+}}
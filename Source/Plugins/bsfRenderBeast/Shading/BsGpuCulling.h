@@ -0,0 +1,59 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+#include "Math/BsConvexVolume.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(GpuCullParamDef)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Vector4, gFrustumPlanes, 6)
+		BS_PARAM_BLOCK_ENTRY(INT32, gNumInstances)
+	BS_PARAM_BLOCK_END
+
+	extern GpuCullParamDef gGpuCullParamDef;
+
+	/**
+	 * Shader that frustum culls a set of scene objects on the GPU and compacts the survivors into an instance lookup
+	 * buffer, incrementing the instance count of an indirect draw argument buffer for each survivor.
+	 */
+	class GpuCullMat : public RendererMaterial<GpuCullMat>
+	{
+		RMAT_DEF_CUSTOMIZED("GpuCull.bsl");
+
+	public:
+		GpuCullMat();
+
+		/**
+		 * Executes the culling shader, testing the bounding spheres of the provided objects against the frustum.
+		 *
+		 * @param[in]	frustum			World space frustum to cull against. Must consist of exactly six planes.
+		 * @param[in]	numInstances	Number of entries in @p inputIndices to process.
+		 * @param[in]	objectData		Buffer of GpuSceneObjectData entries for the entire scene.
+		 * @param[in]	inputIndices	Indices into @p objectData of the objects to test, one per instance.
+		 * @param[in]	outputIndices	Buffer to receive the indices of the objects that passed the test, compacted
+		 *								to the front. Must be able to hold @p numInstances entries.
+		 * @param[in]	drawArgs		Buffer laid out as DrawIndexedIndirectArgs whose instance count entry gets
+		 *								incremented for every object that passes the test. The caller is expected to
+		 *								initialize the buffer, including setting the instance count to zero.
+		 */
+		void execute(const ConvexVolume& frustum, UINT32 numInstances, const SPtr<GpuBuffer>& objectData,
+			const SPtr<GpuBuffer>& inputIndices, const SPtr<GpuBuffer>& outputIndices, const SPtr<GpuBuffer>& drawArgs);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mObjectDataParam;
+		GpuParamBuffer mInputIndicesParam;
+		GpuParamBuffer mOutputIndicesParam;
+		GpuParamBuffer mDrawArgsParam;
+	};
+
+	/** @} */
+}}
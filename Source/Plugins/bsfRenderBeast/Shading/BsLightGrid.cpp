@@ -228,11 +228,24 @@ namespace bs { namespace ct
 		gridProbeIndices = mGridProbeIndices;
 	}
 
+	/**
+	 * Grid that last wrote to the (shared) output buffers owned by the grid materials. The previous assignment of a
+	 * grid may only be reused if no other grid has overwritten those buffers in the meantime.
+	 */
+	static LightGrid* sLastUpdatedGrid = nullptr;
+
 	LightGrid::LightGrid()
+		:mLastLightDataHash(0), mLastProbeDataHash(0)
 	{
 		mGridParamBuffer = gLightGridParamDefDef.createBuffer();
 	}
 
+	LightGrid::~LightGrid()
+	{
+		if (sLastUpdatedGrid == this)
+			sLastUpdatedGrid = nullptr;
+	}
+
 	void LightGrid::updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData,
 		bool noLighting)
 	{
@@ -246,6 +259,16 @@ namespace bs { namespace ct
 		gridSize[1] = (height + CELL_XY_SIZE - 1) / CELL_XY_SIZE;
 		gridSize[2] = NUM_Z_SUBDIVIDES;
 
+		// Cells are defined in view space, so the existing assignment remains valid as long as the camera, the grid
+		// dimensions and the visible light & probe sets are all unchanged, in which case the buffer clears and both
+		// compute dispatches can be skipped.
+		UINT64 lightDataHash = noLighting ? 0 : lightData.getLightDataHash();
+		UINT64 probeDataHash = probeData.getProbeDataHash();
+
+		if (sLastUpdatedGrid == this && gridSize == mLastGridSize && viewProps.viewProjTransform == mLastViewProj &&
+			lightDataHash == mLastLightDataHash && probeDataHash == mLastProbeDataHash)
+			return;
+
 		Vector4I lightCount;
 		Vector2I lightStrides;
 		if (!noLighting)
@@ -292,6 +315,12 @@ namespace bs { namespace ct
 		LightGridLLReductionMat* reductionMat = LightGridLLReductionMat::get();
 		reductionMat->setParams(gridSize, mGridParamBuffer, lightLLHeads, lightLL, probeLLHeads, probeLL);
 		reductionMat->execute(view);
+
+		mLastLightDataHash = lightDataHash;
+		mLastProbeDataHash = probeDataHash;
+		mLastGridSize = gridSize;
+		mLastViewProj = viewProps.viewProjTransform;
+		sLastUpdatedGrid = this;
 	}
 
 	void LightGrid::getOutputs(SPtr<GpuBuffer>& gridLightOffsetsAndSize, SPtr<GpuBuffer>& gridLightIndices,
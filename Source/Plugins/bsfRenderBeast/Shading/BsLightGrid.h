@@ -125,9 +125,13 @@ namespace bs { namespace ct
 	{
 	public:
 		LightGrid();
+		~LightGrid();
 
-		/** Updates the light grid from the provided view. */
-		void updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData, 
+		/**
+		 * Updates the light grid from the provided view. If neither the camera nor the visible light and reflection
+		 * probe sets have changed since the last call the existing assignment is reused and the update is skipped.
+		 */
+		void updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData,
 			bool noLighting);
 
 		/** 
@@ -152,6 +156,11 @@ namespace bs { namespace ct
 
 	private:
 		SPtr<GpuParamBlockBuffer> mGridParamBuffer;
+
+		UINT64 mLastLightDataHash;
+		UINT64 mLastProbeDataHash;
+		Vector3I mLastGridSize;
+		Matrix4 mLastViewProj;
 	};
 
 	/** @} */
@@ -11,6 +11,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsSkybox.h"
 #include "Utility/BsRendererTextures.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs { namespace ct 
 {
@@ -180,6 +181,40 @@ namespace bs { namespace ct
 		}
 	}
 
+	/**
+	 * Splits the provided range into multiple chunks and executes the worker across multiple task scheduler threads.
+	 * Blocks until all chunks have been processed. No task will receive less than @p minEntriesPerTask entries.
+	 */
+	static void processRangeParallel(UINT32 count, UINT32 minEntriesPerTask, std::function<void(UINT32, UINT32)> worker)
+	{
+		UINT32 numTasks = 0;
+		if (minEntriesPerTask > 0)
+			numTasks = count / minEntriesPerTask;
+
+		numTasks = std::min(numTasks, TaskScheduler::instance().getNumWorkers());
+
+		if (numTasks <= 1)
+		{
+			worker(0, count);
+			return;
+		}
+
+		UINT32 entriesPerTask = count / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			UINT32 start = i * entriesPerTask;
+			UINT32 end = (i == (numTasks - 1)) ? count : (start + entriesPerTask);
+
+			tasks.push_back(Task::create("LightProbes", std::bind(worker, start, end)));
+			TaskScheduler::instance().addTask(tasks.back());
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
 	/** Hash value generator for std::pair<INT32, INT32>. */
 	struct pair_hash
 	{
@@ -327,25 +362,31 @@ namespace bs { namespace ct
 		UINT32 numTetrahedra = (UINT32)mTetrahedronInfos.size();
 
 		bool* validTets = (bool*)bs_stack_alloc(sizeof(bool) * numTetrahedra);
-		mNumValidTetrahedra = 0;
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
+		processRangeParallel(numTetrahedra, 1024, [this, validTets](UINT32 start, UINT32 end)
 		{
-			const TetrahedronData& entry = mTetrahedronInfos[i];
+			for (UINT32 i = start; i < end; i++)
+			{
+				const TetrahedronData& entry = mTetrahedronInfos[i];
 
-			const Vector3& P1 = mTempTetrahedronPositions[entry.volume.vertices[0]];
-			const Vector3& P2 = mTempTetrahedronPositions[entry.volume.vertices[1]];
-			const Vector3& P3 = mTempTetrahedronPositions[entry.volume.vertices[2]];
-			const Vector3& P4 = mTempTetrahedronPositions[entry.volume.vertices[3]];
+				const Vector3& P1 = mTempTetrahedronPositions[entry.volume.vertices[0]];
+				const Vector3& P2 = mTempTetrahedronPositions[entry.volume.vertices[1]];
+				const Vector3& P3 = mTempTetrahedronPositions[entry.volume.vertices[2]];
+				const Vector3& P4 = mTempTetrahedronPositions[entry.volume.vertices[3]];
 
-			Vector3 E1 = P1 - P4;
-			Vector3 E2 = P2 - P4;
-			Vector3 E3 = P3 - P4;
+				Vector3 E1 = P1 - P4;
+				Vector3 E2 = P2 - P4;
+				Vector3 E3 = P3 - P4;
 
-			// If tetrahedron is co-planar just ignore it, shader will use some other nearby one instead. We can't
-			// handle coplanar tetrahedrons because the matrix is not invertible, and for nearly co-planar ones the
-			// math breaks down because of precision issues.
-			validTets[i] = fabs(Vector3::dot(Vector3::normalize(Vector3::cross(E1, E2)), E3)) > 0.0001f;
+				// If tetrahedron is co-planar just ignore it, shader will use some other nearby one instead. We can't
+				// handle coplanar tetrahedrons because the matrix is not invertible, and for nearly co-planar ones the
+				// math breaks down because of precision issues.
+				validTets[i] = fabs(Vector3::dot(Vector3::normalize(Vector3::cross(E1, E2)), E3)) > 0.0001f;
+			}
+		});
 
+		mNumValidTetrahedra = 0;
+		for (UINT32 i = 0; i < numTetrahedra; i++)
+		{
 			if (validTets[i])
 				mNumValidTetrahedra++;
 		}
@@ -937,11 +978,14 @@ namespace bs { namespace ct
 				}
 
 				// Generate face data
+				UINT32 faceStartIdx = (UINT32)faces.size();
+				faces.resize(faceStartIdx + numOuterFaces);
+
 				for (UINT32 i = 0; i < numOuterFaces; ++i)
 				{
 					const TetrahedronFace& face = volume.outerFaces[i];
 
-					TetrahedronFaceData faceData;
+					TetrahedronFaceData& faceData = faces[faceStartIdx + i];
 					faceData.tetrahedron = face.tetrahedron;
 
 					for (UINT32 j = 0; j < 3; j++)
@@ -961,151 +1005,160 @@ namespace bs { namespace ct
 						{
 							// Note: Not searching for opposite neighbor here. If tet. has multiple free faces then we
 							// can't just pick the first one
-							innerTet.neighbors[j] = (UINT32)volume.tetrahedra.size() + (UINT32)faces.size();
+							innerTet.neighbors[j] = (UINT32)volume.tetrahedra.size() + faceStartIdx + i;
 							break;
 						}
 					}
+				}
 
-					// We need a way to project a point outside the tetrahedron volume onto an outer face, then calculate
-					// triangle's barycentric coordinates. Use use the per-vertex normals to extrude the triangle face into
-					// infinity.
-
-					// Our point can be represented as:
-					// p == a (p0 + t*v0) + b (p1 + t*v1) + c (p2 + t*v2)
-					//
-					// where a, b and c are barycentric coordinates,
-					// p0, p1, p2 are the corners of the face
-					// v0, v1, v2 are the vertex normals, per corner
-					// t is the distance from the triangle to the point
-					//
-					// Essentially we're calculating the corners of a bigger triangle that's "t" units away from the
-					// face, and its corners lie along the per-vertex normals. Point "p" will lie on that triangle, for which
-					// we can then calculate barycentric coordinates normally.
-					//
-					// First we substitute: c = 1 - a - b
-					// p == a (p0 + t v0) + b (p1 + t v1) + (1 - a - b) (p2 + t v2)
-					// p == a (p0 + t v0) + b (p1 + t v1) + (p2 + t v2) - a (p2 + t v2) - b (p2 + t v2)
-					// p == a (p0 - p2 + t v0 - t v2) + b (p1 - p2 + t v1 - t v2) + (p2 + t v2)
-					//
-					// And move everything to one side:
-					// p - p2 - t v2 == a (p0 - p2 + t ( v0 - v2)) + b (p1 - p2 + t ( v1 - v2))
-					// a (p0 - p2 + t ( v0 - v2)) + b (p1 - p2 + t ( v1 - v2)) - (p - p2 - t v2) == 0
-					//
-					// We rewrite it using:
-					// Ap = p0 - p2
-					// Av = v0 - v2
-					// Bp = p1 - p2
-					// Bv = v1 - v2
-					// Cp = p - p2
-					// Cv = -v2
-					//
-					// Which yields:
-					// a (Ap + t Av) + b (Bp + t Bv) - (Cp + t Cv) == 0
-					//
-					// Which can be written in matrix form:
-					//
-					// M = {Ap + t Av, Bp + t Bv, Cp + t Cv}
-					//       a      0
-					// M * [ b ] = [0]
-					//      -1      0
-					//
-					// From that we can tell that matrix M cannot be inverted, because if we multiply the zero vector with the
-					// inverted matrix the result would be zero, and not [a, b, -1]. Since the matrix cannot be inverted
-					// det(M) == 0.
-					//
-					// We can use that fact to calculate "t". After we have "t" we can calculate barycentric coordinates
-					// normally.
-					//
-					// Solving equation det(M) == 0 yields a cubic in form:
-					// p t^3 + q t^2 + r t + s = 0
-					//
-					// We'll convert this to monic form, by dividing by p:
-					// t^3 + q/p t^2 + r/p t + s/p = 0
-					//
-					// Or if p ends up being zero, we end up with a quadratic instead:
-					// q t^2 + r t + s = 0
-					// 
-					// We want to create a matrix that when multiplied with the position, yields us the three coefficients,
-					// which we can then use to solve for "t". For this we create a 4x3 matrix, where each row represents
-					// a solution for one of the coefficients. We factor contributons to each coefficient whether they depend on
-					// position x, y, z, or don't depend on position (row columns, in that order respectively).
-
-					const Vector3& p0 = positions[faceData.innerVertices[0]];
-					const Vector3& p1 = positions[faceData.innerVertices[1]];
-					const Vector3& p2 = positions[faceData.innerVertices[2]];
-
-					const Vector3& v0 = faceVertices[faceData.innerVertices[0]].normal;
-					const Vector3& v1 = faceVertices[faceData.innerVertices[1]].normal;
-					const Vector3& v2 = faceVertices[faceData.innerVertices[2]].normal;
-
-					float p =
-							v2.x * v1.y * v0.z -
-							v1.x * v2.y * v0.z -
-							v2.x * v0.y * v1.z +
-							v0.x * v2.y * v1.z +
-							v1.x * v0.y * v2.z -
-							v0.x * v1.y * v2.z;
-						
-					float qx = -v1.y * v0.z + v2.y * v0.z + v0.y * v1.z - v2.y * v1.z - v0.y * v2.z + v1.y * v2.z;
-					float qy = v1.x * v0.z - v2.x * v0.z - v0.x * v1.z + v2.x * v1.z + v0.x * v2.z - v1.x * v2.z;
-					float qz = -v1.x * v0.y + v2.x * v0.y + v0.x * v1.y - v2.x * v1.y - v0.x * v2.y + v1.x * v2.y;
-					float qw = v2.y * v1.z * p0.x - v1.y * v2.z * p0.x - v2.y * v0.z * p1.x + v0.y * v2.z * p1.x + 
-						v1.y * v0.z * p2.x - v0.y * v1.z * p2.x - v2.x * v1.z * p0.y + v1.x * v2.z * p0.y + 
-						v2.x * v0.z * p1.y - v0.x * v2.z * p1.y - v1.x * v0.z * p2.y + v0.x * v1.z * p2.y + 
-						v2.x * v1.y * p0.z - v1.x * v2.y * p0.z - v2.x * v0.y * p1.z + v0.x * v2.y * p1.z + 
-						v1.x * v0.y * p2.z - v0.x * v1.y * p2.z;
-
-					float rx = v1.z * p0.y - v2.z * p0.y - v0.z * p1.y + v2.z * p1.y + v0.z * p2.y - v1.z * p2.y -
-						v1.y * p0.z + v2.y * p0.z + v0.y * p1.z - v2.y * p1.z - v0.y * p2.z + v1.y * p2.z;
-					float ry = -v1.z * p0.x + v2.z * p0.x + v0.z * p1.x - v2.z * p1.x - v0.z * p2.x + v1.z * p2.x +
-						v1.x * p0.z - v2.x * p0.z - v0.x * p1.z + v2.x * p1.z + v0.x * p2.z - v1.x * p2.z;
-					float rz = v1.y * p0.x - v2.y * p0.x - v0.y * p1.x + v2.y * p1.x + v0.y * p2.x - v1.y * p2.x -
-						v1.x * p0.y + v2.x * p0.y + v0.x * p1.y - v2.x * p1.y - v0.x * p2.y + v1.x * p2.y;
-					float rw = v2.z * p1.x * p0.y - v1.z * p2.x * p0.y - v2.z * p0.x * p1.y + v0.z * p2.x * p1.y +
-						v1.z * p0.x * p2.y - v0.z * p1.x * p2.y - v2.y * p1.x * p0.z + v1.y * p2.x * p0.z +
-						v2.x * p1.y * p0.z - v1.x * p2.y * p0.z + v2.y * p0.x * p1.z - v0.y * p2.x * p1.z -
-						v2.x * p0.y * p1.z + v0.x * p2.y * p1.z - v1.y * p0.x * p2.z + v0.y * p1.x * p2.z +
-						v1.x * p0.y * p2.z - v0.x * p1.y * p2.z;
-
-					float sx = -p1.y * p0.z + p2.y * p0.z + p0.y * p1.z - p2.y * p1.z - p0.y * p2.z + p1.y * p2.z;
-					float sy = p1.x * p0.z - p2.x * p0.z - p0.x * p1.z + p2.x * p1.z + p0.x * p2.z - p1.x * p2.z;
-					float sz = -p1.x * p0.y + p2.x * p0.y + p0.x * p1.y - p2.x * p1.y - p0.x * p2.y + p1.x * p2.y;
-					float sw = p2.x * p1.y * p0.z - p1.x * p2.y * p0.z - p2.x * p0.y * p1.z + 
-						p0.x * p2.y * p1.z + p1.x * p0.y * p2.z - p0.x * p1.y * p2.z;
-
-					faceData.transform[0][0] = qx;
-					faceData.transform[0][1] = qy;
-					faceData.transform[0][2] = qz;
-					faceData.transform[0][3] = qw;
-
-					faceData.transform[1][0] = rx;
-					faceData.transform[1][1] = ry;
-					faceData.transform[1][2] = rz;
-					faceData.transform[1][3] = rw;
-
-					faceData.transform[2][0] = sx;
-					faceData.transform[2][1] = sy;
-					faceData.transform[2][2] = sz;
-					faceData.transform[2][3] = sw;
-
-					// Unused
-					faceData.transform[3][0] = 0.0f;
-					faceData.transform[3][1] = 0.0f;
-					faceData.transform[3][2] = 0.0f;
-					faceData.transform[3][3] = 0.0f;
-
-					if (fabs(p) > 0.00001f)
-					{
-						faceData.transform = faceData.transform * (1.0f / p);
-						faceData.quadratic = false;
-					}
-					else // Quadratic
+				// Generate face transforms. Each face is independent of the others so the work is split across
+				// multiple threads.
+				processRangeParallel(numOuterFaces, 128,
+					[&faces, &positions, faceStartIdx](UINT32 rangeStart, UINT32 rangeEnd)
+				{
+					for (UINT32 i = rangeStart; i < rangeEnd; ++i)
 					{
-						faceData.quadratic = true;
+						TetrahedronFaceData& faceData = faces[faceStartIdx + i];
+
+						// We need a way to project a point outside the tetrahedron volume onto an outer face, then calculate
+						// triangle's barycentric coordinates. Use use the per-vertex normals to extrude the triangle face into
+						// infinity.
+
+						// Our point can be represented as:
+						// p == a (p0 + t*v0) + b (p1 + t*v1) + c (p2 + t*v2)
+						//
+						// where a, b and c are barycentric coordinates,
+						// p0, p1, p2 are the corners of the face
+						// v0, v1, v2 are the vertex normals, per corner
+						// t is the distance from the triangle to the point
+						//
+						// Essentially we're calculating the corners of a bigger triangle that's "t" units away from the
+						// face, and its corners lie along the per-vertex normals. Point "p" will lie on that triangle, for which
+						// we can then calculate barycentric coordinates normally.
+						//
+						// First we substitute: c = 1 - a - b
+						// p == a (p0 + t v0) + b (p1 + t v1) + (1 - a - b) (p2 + t v2)
+						// p == a (p0 + t v0) + b (p1 + t v1) + (p2 + t v2) - a (p2 + t v2) - b (p2 + t v2)
+						// p == a (p0 - p2 + t v0 - t v2) + b (p1 - p2 + t v1 - t v2) + (p2 + t v2)
+						//
+						// And move everything to one side:
+						// p - p2 - t v2 == a (p0 - p2 + t ( v0 - v2)) + b (p1 - p2 + t ( v1 - v2))
+						// a (p0 - p2 + t ( v0 - v2)) + b (p1 - p2 + t ( v1 - v2)) - (p - p2 - t v2) == 0
+						//
+						// We rewrite it using:
+						// Ap = p0 - p2
+						// Av = v0 - v2
+						// Bp = p1 - p2
+						// Bv = v1 - v2
+						// Cp = p - p2
+						// Cv = -v2
+						//
+						// Which yields:
+						// a (Ap + t Av) + b (Bp + t Bv) - (Cp + t Cv) == 0
+						//
+						// Which can be written in matrix form:
+						//
+						// M = {Ap + t Av, Bp + t Bv, Cp + t Cv}
+						//       a      0
+						// M * [ b ] = [0]
+						//      -1      0
+						//
+						// From that we can tell that matrix M cannot be inverted, because if we multiply the zero vector with the
+						// inverted matrix the result would be zero, and not [a, b, -1]. Since the matrix cannot be inverted
+						// det(M) == 0.
+						//
+						// We can use that fact to calculate "t". After we have "t" we can calculate barycentric coordinates
+						// normally.
+						//
+						// Solving equation det(M) == 0 yields a cubic in form:
+						// p t^3 + q t^2 + r t + s = 0
+						//
+						// We'll convert this to monic form, by dividing by p:
+						// t^3 + q/p t^2 + r/p t + s/p = 0
+						//
+						// Or if p ends up being zero, we end up with a quadratic instead:
+						// q t^2 + r t + s = 0
+						// 
+						// We want to create a matrix that when multiplied with the position, yields us the three coefficients,
+						// which we can then use to solve for "t". For this we create a 4x3 matrix, where each row represents
+						// a solution for one of the coefficients. We factor contributons to each coefficient whether they depend on
+						// position x, y, z, or don't depend on position (row columns, in that order respectively).
+
+						const Vector3& p0 = positions[faceData.innerVertices[0]];
+						const Vector3& p1 = positions[faceData.innerVertices[1]];
+						const Vector3& p2 = positions[faceData.innerVertices[2]];
+
+						const Vector3& v0 = faceData.normals[0];
+						const Vector3& v1 = faceData.normals[1];
+						const Vector3& v2 = faceData.normals[2];
+
+						float p =
+								v2.x * v1.y * v0.z -
+								v1.x * v2.y * v0.z -
+								v2.x * v0.y * v1.z +
+								v0.x * v2.y * v1.z +
+								v1.x * v0.y * v2.z -
+								v0.x * v1.y * v2.z;
+							
+						float qx = -v1.y * v0.z + v2.y * v0.z + v0.y * v1.z - v2.y * v1.z - v0.y * v2.z + v1.y * v2.z;
+						float qy = v1.x * v0.z - v2.x * v0.z - v0.x * v1.z + v2.x * v1.z + v0.x * v2.z - v1.x * v2.z;
+						float qz = -v1.x * v0.y + v2.x * v0.y + v0.x * v1.y - v2.x * v1.y - v0.x * v2.y + v1.x * v2.y;
+						float qw = v2.y * v1.z * p0.x - v1.y * v2.z * p0.x - v2.y * v0.z * p1.x + v0.y * v2.z * p1.x + 
+							v1.y * v0.z * p2.x - v0.y * v1.z * p2.x - v2.x * v1.z * p0.y + v1.x * v2.z * p0.y + 
+							v2.x * v0.z * p1.y - v0.x * v2.z * p1.y - v1.x * v0.z * p2.y + v0.x * v1.z * p2.y + 
+							v2.x * v1.y * p0.z - v1.x * v2.y * p0.z - v2.x * v0.y * p1.z + v0.x * v2.y * p1.z + 
+							v1.x * v0.y * p2.z - v0.x * v1.y * p2.z;
+
+						float rx = v1.z * p0.y - v2.z * p0.y - v0.z * p1.y + v2.z * p1.y + v0.z * p2.y - v1.z * p2.y -
+							v1.y * p0.z + v2.y * p0.z + v0.y * p1.z - v2.y * p1.z - v0.y * p2.z + v1.y * p2.z;
+						float ry = -v1.z * p0.x + v2.z * p0.x + v0.z * p1.x - v2.z * p1.x - v0.z * p2.x + v1.z * p2.x +
+							v1.x * p0.z - v2.x * p0.z - v0.x * p1.z + v2.x * p1.z + v0.x * p2.z - v1.x * p2.z;
+						float rz = v1.y * p0.x - v2.y * p0.x - v0.y * p1.x + v2.y * p1.x + v0.y * p2.x - v1.y * p2.x -
+							v1.x * p0.y + v2.x * p0.y + v0.x * p1.y - v2.x * p1.y - v0.x * p2.y + v1.x * p2.y;
+						float rw = v2.z * p1.x * p0.y - v1.z * p2.x * p0.y - v2.z * p0.x * p1.y + v0.z * p2.x * p1.y +
+							v1.z * p0.x * p2.y - v0.z * p1.x * p2.y - v2.y * p1.x * p0.z + v1.y * p2.x * p0.z +
+							v2.x * p1.y * p0.z - v1.x * p2.y * p0.z + v2.y * p0.x * p1.z - v0.y * p2.x * p1.z -
+							v2.x * p0.y * p1.z + v0.x * p2.y * p1.z - v1.y * p0.x * p2.z + v0.y * p1.x * p2.z +
+							v1.x * p0.y * p2.z - v0.x * p1.y * p2.z;
+
+						float sx = -p1.y * p0.z + p2.y * p0.z + p0.y * p1.z - p2.y * p1.z - p0.y * p2.z + p1.y * p2.z;
+						float sy = p1.x * p0.z - p2.x * p0.z - p0.x * p1.z + p2.x * p1.z + p0.x * p2.z - p1.x * p2.z;
+						float sz = -p1.x * p0.y + p2.x * p0.y + p0.x * p1.y - p2.x * p1.y - p0.x * p2.y + p1.x * p2.y;
+						float sw = p2.x * p1.y * p0.z - p1.x * p2.y * p0.z - p2.x * p0.y * p1.z + 
+							p0.x * p2.y * p1.z + p1.x * p0.y * p2.z - p0.x * p1.y * p2.z;
+
+						faceData.transform[0][0] = qx;
+						faceData.transform[0][1] = qy;
+						faceData.transform[0][2] = qz;
+						faceData.transform[0][3] = qw;
+
+						faceData.transform[1][0] = rx;
+						faceData.transform[1][1] = ry;
+						faceData.transform[1][2] = rz;
+						faceData.transform[1][3] = rw;
+
+						faceData.transform[2][0] = sx;
+						faceData.transform[2][1] = sy;
+						faceData.transform[2][2] = sz;
+						faceData.transform[2][3] = sw;
+
+						// Unused
+						faceData.transform[3][0] = 0.0f;
+						faceData.transform[3][1] = 0.0f;
+						faceData.transform[3][2] = 0.0f;
+						faceData.transform[3][3] = 0.0f;
+
+						if (fabs(p) > 0.00001f)
+						{
+							faceData.transform = faceData.transform * (1.0f / p);
+							faceData.quadratic = false;
+						}
+						else // Quadratic
+						{
+							faceData.quadratic = true;
+						}
 					}
-
-					faces.push_back(faceData);
-				}
+				});
 			}
 			else
 			{
@@ -1131,58 +1184,62 @@ namespace bs { namespace ct
 
 			// Generate matrices
 			UINT32 numOutputTets = (UINT32)volume.tetrahedra.size();
-			tetrahedra.reserve(numOutputTets);
+			UINT32 tetStartIdx = (UINT32)tetrahedra.size();
+			tetrahedra.resize(tetStartIdx + numOutputTets);
 
-			//// For inner tetrahedrons
-			for(UINT32 i = 0; i < (UINT32)numOutputTets; ++i)
+			//// For inner tetrahedrons. Matrix generation for each tetrahedron is independent of the others so the
+			//// work is split across multiple threads.
+			processRangeParallel(numOutputTets, 512,
+				[&tetrahedra, &positions, &volume, tetStartIdx](UINT32 rangeStart, UINT32 rangeEnd)
 			{
-				TetrahedronData entry;
-				entry.volume = volume.tetrahedra[i];
-
-				// Generate a matrix that can be used for calculating barycentric coordinates
-				// To determine a point within a tetrahedron, using barycentric coordinates, we use:
-				// P = (P1 - P4) * a + (P2 - P4) * b + (P3 - P4) * c + P4
-				//
-				// Where P1, P2, P3, P4 are the corners of the tetrahedron.
-				//
-				// Expanded for each coordinate this is:
-				// x = (x1 - x4) * a + (x2 - x4) * b + (x3 - x4) * c + x4
-				// y = (y1 - y4) * a + (y2 - y4) * b + (y3 - y4) * c + y4
-				// z = (z1 - z4) * a + (z2 - z4) * b + (z3 - z4) * c + z4
-				//
-				// In matrix form this is:
-				//                                      a
-				// P = [P1 - P4, P2 - P4, P3 - P4, P4] [b]
-				//                                      c
-				//                                      1
-				//
-				// Solved for barycentric coordinates:
-				//  a
-				// [b] = Minv * P 
-				//  c
-				//  1
-				//
-				// Where Minv is the inverse of the matrix above.
-
-				const Vector3& P1 = positions[volume.tetrahedra[i].vertices[0]];
-				const Vector3& P2 = positions[volume.tetrahedra[i].vertices[1]];
-				const Vector3& P3 = positions[volume.tetrahedra[i].vertices[2]];
-				const Vector3& P4 = positions[volume.tetrahedra[i].vertices[3]];
+				for(UINT32 i = rangeStart; i < rangeEnd; ++i)
+				{
+					TetrahedronData& entry = tetrahedra[tetStartIdx + i];
+					entry.volume = volume.tetrahedra[i];
 
-				Vector3 E1 = P1 - P4;
-				Vector3 E2 = P2 - P4;
-				Vector3 E3 = P3 - P4;
+					// Generate a matrix that can be used for calculating barycentric coordinates
+					// To determine a point within a tetrahedron, using barycentric coordinates, we use:
+					// P = (P1 - P4) * a + (P2 - P4) * b + (P3 - P4) * c + P4
+					//
+					// Where P1, P2, P3, P4 are the corners of the tetrahedron.
+					//
+					// Expanded for each coordinate this is:
+					// x = (x1 - x4) * a + (x2 - x4) * b + (x3 - x4) * c + x4
+					// y = (y1 - y4) * a + (y2 - y4) * b + (y3 - y4) * c + y4
+					// z = (z1 - z4) * a + (z2 - z4) * b + (z3 - z4) * c + z4
+					//
+					// In matrix form this is:
+					//                                      a
+					// P = [P1 - P4, P2 - P4, P3 - P4, P4] [b]
+					//                                      c
+					//                                      1
+					//
+					// Solved for barycentric coordinates:
+					//  a
+					// [b] = Minv * P 
+					//  c
+					//  1
+					//
+					// Where Minv is the inverse of the matrix above.
 
-				Matrix4 mat;
-				mat.setColumn(0, Vector4(E1, 0.0f));
-				mat.setColumn(1, Vector4(E2, 0.0f));
-				mat.setColumn(2, Vector4(E3, 0.0f));
-				mat.setColumn(3, Vector4(P4, 1.0f));
+					const Vector3& P1 = positions[volume.tetrahedra[i].vertices[0]];
+					const Vector3& P2 = positions[volume.tetrahedra[i].vertices[1]];
+					const Vector3& P3 = positions[volume.tetrahedra[i].vertices[2]];
+					const Vector3& P4 = positions[volume.tetrahedra[i].vertices[3]];
 
-				entry.transform = mat.inverse();
+					Vector3 E1 = P1 - P4;
+					Vector3 E2 = P2 - P4;
+					Vector3 E3 = P3 - P4;
 
-				tetrahedra.push_back(entry);
-			}
+					Matrix4 mat;
+					mat.setColumn(0, Vector4(E1, 0.0f));
+					mat.setColumn(1, Vector4(E2, 0.0f));
+					mat.setColumn(2, Vector4(E3, 0.0f));
+					mat.setColumn(3, Vector4(P4, 1.0f));
+
+					entry.transform = mat.inverse();
+				}
+			});
 		}
 		bs_frame_clear();
 	}
@@ -0,0 +1,39 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsMorphShapeBlend.h"
+#include "RenderAPI/BsGpuBuffer.h"
+
+namespace bs { namespace ct
+{
+	MorphShapeBlendParamDef gMorphShapeBlendParamDef;
+
+	/** Number of threads in a single thread group of the blend shader. */
+	const static UINT32 NUM_THREADS = 64;
+
+	MorphShapeBlendMat::MorphShapeBlendMat()
+	{
+		mParamBuffer = gMorphShapeBlendParamDef.createBuffer();
+
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gDeltas", mDeltasParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gVertexRanges", mVertexRangesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gWeights", mWeightsParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutput", mOutputParam);
+	}
+
+	void MorphShapeBlendMat::execute(const SPtr<GpuBuffer>& deltas, const SPtr<GpuBuffer>& vertexRanges,
+		const SPtr<GpuBuffer>& weights, UINT32 numVertices, const SPtr<GpuBuffer>& output)
+	{
+		mDeltasParam.set(deltas);
+		mVertexRangesParam.set(vertexRanges);
+		mWeightsParam.set(weights);
+		mOutputParam.set(output);
+
+		gMorphShapeBlendParamDef.gNumVertices.set(mParamBuffer, numVertices);
+
+		RenderAPI& rapi = RenderAPI::instance();
+
+		bind();
+		rapi.dispatchCompute(Math::divideAndRoundUp(numVertices, NUM_THREADS));
+	}
+}}
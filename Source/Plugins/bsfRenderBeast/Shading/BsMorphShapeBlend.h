@@ -0,0 +1,55 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(MorphShapeBlendParamDef)
+		BS_PARAM_BLOCK_ENTRY(int, gNumVertices)
+	BS_PARAM_BLOCK_END
+
+	extern MorphShapeBlendParamDef gMorphShapeBlendParamDef;
+
+	/**
+	 * Blends all morph shapes of a renderable according to their current weights and outputs vertices laid out
+	 * identically to the morph vertex stream. The output buffer is then meant to be copied into the renderable's
+	 * morph shape vertex buffer.
+	 */
+	class MorphShapeBlendMat : public RendererMaterial<MorphShapeBlendMat>
+	{
+		RMAT_DEF("MorphShapeBlend.bsl")
+
+	public:
+		MorphShapeBlendMat();
+
+		/**
+		 * Executes the material, blending all morph shapes into the output buffer.
+		 *
+		 * @param[in]	deltas			Buffer containing vertex deltas of all shapes, grouped per target vertex.
+		 * @param[in]	vertexRanges	Buffer containing the range of delta entries belonging to each vertex.
+		 * @param[in]	weights			Buffer containing the current blend weight of every shape.
+		 * @param[in]	numVertices		Number of vertices in the output buffer.
+		 * @param[in]	output			Buffer to output the blended vertices to. Must be created with random GPU writes
+		 *								enabled, with one 32-bit 4D float element per vertex.
+		 */
+		void execute(const SPtr<GpuBuffer>& deltas, const SPtr<GpuBuffer>& vertexRanges, const SPtr<GpuBuffer>& weights,
+			UINT32 numVertices, const SPtr<GpuBuffer>& output);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mDeltasParam;
+		GpuParamBuffer mVertexRangesParam;
+		GpuParamBuffer mWeightsParam;
+		GpuParamBuffer mOutputParam;
+	};
+
+	/** @} */
+}}
@@ -1009,12 +1009,20 @@ namespace bs { namespace ct
 		rapi.setViewport(Rect2(0, 0, 1, 1));
 	}
 
-	BuildHiZMat* BuildHiZMat::getVariation(bool noTextureViews)
+	BuildHiZMat* BuildHiZMat::getVariation(bool noTextureViews, bool farZ)
 	{
 		if (noTextureViews)
-			return get(getVariation<true>());
-		
-		return get(getVariation<false>());
+		{
+			if (farZ)
+				return get(getVariation<true, true>());
+
+			return get(getVariation<true, false>());
+		}
+
+		if (farZ)
+			return get(getVariation<false, true>());
+
+		return get(getVariation<false, false>());
 	}
 
 	FXAAParamDef gFXAAParamDef;
@@ -533,12 +533,13 @@ namespace bs { namespace ct
 		RMAT_DEF("PPBuildHiZ.bsl");
 
 		/** Helper method used for initializing variations of this material. */
-		template<bool noTextureViews>
+		template<bool noTextureViews, bool farZ>
 		static const ShaderVariation& getVariation()
 		{
 			static ShaderVariation variation = ShaderVariation(
 			Vector<ShaderVariation::Param>{
 				ShaderVariation::Param("NO_TEXTURE_VIEWS", noTextureViews),
+				ShaderVariation::Param("FAR_Z", farZ),
 			});
 
 			return variation;
@@ -559,13 +560,15 @@ namespace bs { namespace ct
 		void execute(const SPtr<Texture>& source, UINT32 srcMip, const Rect2& srcRect, const Rect2& dstRect,
 			const SPtr<RenderTexture>& output);
 
-		/** 
+		/**
 		 * Returns the material variation matching the provided parameters.
 		 *
 		 * @param	noTextureViews		Specify as true if the current render backend doesn't support texture views, in
 		 *								which case the implementation falls back on using a simpler version of the shader.
+		 * @param	farZ				If true each entry of the generated mip level will contain the farthest depth of
+		 *								the relevant pixel block, instead of the nearest.
 		 */
-		static BuildHiZMat* getVariation(bool noTextureViews);
+		static BuildHiZMat* getVariation(bool noTextureViews, bool farZ = false);
 	private:
 		GpuParamTexture mInputTexture;
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
@@ -768,18 +768,22 @@ namespace bs { namespace ct
 
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
+		mStaticShadowMaps.clear();
 		mShadowCubemaps.clear();
 
+		mCachedSpotShadows.clear();
+		mCachedRadialShadows.clear();
+
 		mShadowMapSize = size;
 	}
 
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, 
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Shadow maps of non-movable spot and radial lights are cached and only re-rendered when the light or an
+		// intersecting shadow caster changes, as tracked through scene shadow revisions. A further improvement would be
+		// to split such lights into a fully static map affected only by static geometry, plus per-object shadow maps for
+		// dynamic objects, so caster movement only requires a small subset of geometry to be redrawn.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -886,14 +890,34 @@ namespace bs { namespace ct
 				++iter;
 		}
 		
-		for(auto iter = mShadowCubemaps.begin(); iter != mShadowCubemaps.end();)
+		for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size();)
 		{
-			if (iter->getLastUsedCounter() >= MAX_UNUSED_FRAMES)
-				iter = mShadowCubemaps.erase(iter);
+			if (mShadowCubemaps[i].getLastUsedCounter() >= MAX_UNUSED_FRAMES)
+			{
+				mShadowCubemaps.erase(mShadowCubemaps.begin() + i);
+
+				// Patch up texture indices of cached shadows referencing the moved cubemaps
+				for (auto iter = mCachedRadialShadows.begin(); iter != mCachedRadialShadows.end();)
+				{
+					UINT32& textureIdx = iter->second.shadowInfo.textureIdx;
+					if (textureIdx == i)
+					{
+						iter = mCachedRadialShadows.erase(iter);
+						continue;
+					}
+
+					if (textureIdx > i)
+						textureIdx--;
+
+					++iter;
+				}
+			}
 			else
-				++iter;
+				++i;
 		}
 
+		updateShadowMapCache();
+
 		// Render shadow maps
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.directionalLights.size(); ++i)
 		{
@@ -912,16 +936,115 @@ namespace bs { namespace ct
 		for(auto& entry : mSpotLightShadowOptions)
 		{
 			UINT32 lightIdx = entry.lightIdx;
+
+			if (tryReuseCachedShadowMap(sceneInfo.spotLights[lightIdx], LightType::Spot, entry,
+				sceneInfo.spotLightShadowRevisions[lightIdx]))
+				continue;
+
 			renderSpotShadowMap(sceneInfo.spotLights[lightIdx], entry, scene, frameInfo);
 		}
 
 		for (auto& entry : mRadialLightShadowOptions)
 		{
 			UINT32 lightIdx = entry.lightIdx;
+
+			if (tryReuseCachedShadowMap(sceneInfo.radialLights[lightIdx], LightType::Radial, entry,
+				sceneInfo.radialLightShadowRevisions[lightIdx]))
+				continue;
+
 			renderRadialShadowMap(sceneInfo.radialLights[lightIdx], entry, scene, frameInfo);
 		}
 	}
 
+	bool ShadowRendering::tryReuseCachedShadowMap(const RendererLight& rendererLight, LightType lightType,
+		const ShadowMapOptions& options, UINT32 revision)
+	{
+		Light* light = rendererLight.internal;
+
+		// Only lights guaranteed not to move can have their shadow maps persisted across frames
+		if (light->getMobility() == ObjectMobility::Movable)
+			return false;
+
+		auto& cache = lightType == LightType::Spot ? mCachedSpotShadows : mCachedRadialShadows;
+		auto iterFind = cache.find(light);
+		if (iterFind == cache.end())
+			return false;
+
+		CachedShadowMap& cached = iterFind->second;
+		if (cached.revision != revision || cached.mapSize != options.mapSize)
+			return false;
+
+		cached.lastUsedCounter = 0;
+
+		// Register the cached shadow as if it was rendered this frame
+		ShadowInfo shadowInfo = cached.shadowInfo;
+		shadowInfo.lightIdx = options.lightIdx; // Renderer ids can change as other lights get unregistered
+		shadowInfo.fadePerView = options.fadePercents;
+
+		LightShadows& lightShadows = lightType == LightType::Spot
+			? mSpotLightShadows[options.lightIdx]
+			: mRadialLightShadows[options.lightIdx];
+
+		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = shadowInfo;
+		lightShadows.numShadows++;
+
+		return true;
+	}
+
+	void ShadowRendering::updateShadowMapCache()
+	{
+		// Evict cached shadow maps that haven't been needed in a while
+		auto ageCache = [](UnorderedMap<const Light*, CachedShadowMap>& cache)
+		{
+			for (auto iter = cache.begin(); iter != cache.end();)
+			{
+				if (iter->second.lastUsedCounter >= MAX_UNUSED_FRAMES)
+					iter = cache.erase(iter);
+				else
+				{
+					iter->second.lastUsedCounter++;
+					++iter;
+				}
+			}
+		};
+
+		ageCache(mCachedSpotShadows);
+		ageCache(mCachedRadialShadows);
+
+		// Reserve cubemaps containing cached shadow maps, so they don't get claimed by other lights this frame
+		for (auto& entry : mCachedRadialShadows)
+			mShadowCubemaps[entry.second.shadowInfo.textureIdx].markAsUsed();
+
+		// Individual atlas slots cannot be deallocated, so a static atlas is only reclaimed as a whole, once no cached
+		// shadows reference it anymore
+		Vector<bool> referenced(mStaticShadowMaps.size(), false);
+		for (auto& entry : mCachedSpotShadows)
+			referenced[entry.second.shadowInfo.textureIdx] = true;
+
+		for (UINT32 i = 0; i < (UINT32)mStaticShadowMaps.size(); i++)
+		{
+			if (!referenced[i])
+				mStaticShadowMaps[i].clear();
+		}
+
+		for (UINT32 i = 0; i < (UINT32)mStaticShadowMaps.size();)
+		{
+			if (mStaticShadowMaps[i].getLastUsedCounter() >= MAX_UNUSED_FRAMES)
+			{
+				mStaticShadowMaps.erase(mStaticShadowMaps.begin() + i);
+
+				// Patch up texture indices of cached shadows referencing the moved atlases
+				for (auto& entry : mCachedSpotShadows)
+				{
+					if (entry.second.shadowInfo.textureIdx > i)
+						entry.second.shadowInfo.textureIdx--;
+				}
+			}
+			else
+				++i;
+		}
+	}
+
 	/**
 	 * Generates a frustum from the provided view-projection matrix.
 	 * 
@@ -1125,7 +1248,12 @@ namespace bs { namespace ct
 				SPtr<Texture> shadowMap;
 				UINT32 shadowMapFace = 0;
 				if(!isCSM)
-					shadowMap = mDynamicShadowMaps[shadowInfo->textureIdx].getTexture();
+				{
+					if (shadowInfo->isStatic)
+						shadowMap = mStaticShadowMaps[shadowInfo->textureIdx].getTexture();
+					else
+						shadowMap = mDynamicShadowMaps[shadowInfo->textureIdx].getTexture();
+				}
 				else
 				{
 					shadowMap = mCascadedShadowMaps[shadowInfo->textureIdx].getTexture();
@@ -1359,32 +1487,52 @@ namespace bs { namespace ct
 		mapInfo.fadePerView = options.fadePercents;
 		mapInfo.lightIdx = options.lightIdx;
 		mapInfo.cascadeIdx = -1;
+		mapInfo.isStatic = light->getMobility() != ObjectMobility::Movable;
+
+		Vector<ShadowMapAtlas>& shadowMaps = mapInfo.isStatic ? mStaticShadowMaps : mDynamicShadowMaps;
 
 		bool foundSpace = false;
-		for (UINT32 i = 0; i < (UINT32)mDynamicShadowMaps.size(); i++)
+		if (mapInfo.isStatic)
 		{
-			ShadowMapAtlas& atlas = mDynamicShadowMaps[i];
-
-			if (atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER))
+			// Re-render into the existing slot if the light already has one of matching size. If the size changed the
+			// old slot is abandoned and gets reclaimed once its atlas holds no more cached shadows.
+			auto iterFind = mCachedSpotShadows.find(light);
+			if (iterFind != mCachedSpotShadows.end() && iterFind->second.mapSize == options.mapSize)
 			{
-				mapInfo.textureIdx = i;
+				mapInfo.area = iterFind->second.shadowInfo.area;
+				mapInfo.textureIdx = iterFind->second.shadowInfo.textureIdx;
 
 				foundSpace = true;
-				break;
 			}
 		}
 
 		if (!foundSpace)
 		{
-			mapInfo.textureIdx = (UINT32)mDynamicShadowMaps.size();
-			mDynamicShadowMaps.push_back(ShadowMapAtlas(MAX_ATLAS_SIZE));
+			for (UINT32 i = 0; i < (UINT32)shadowMaps.size(); i++)
+			{
+				ShadowMapAtlas& atlas = shadowMaps[i];
+
+				if (atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER))
+				{
+					mapInfo.textureIdx = i;
+
+					foundSpace = true;
+					break;
+				}
+			}
+		}
+
+		if (!foundSpace)
+		{
+			mapInfo.textureIdx = (UINT32)shadowMaps.size();
+			shadowMaps.push_back(ShadowMapAtlas(MAX_ATLAS_SIZE));
 
-			ShadowMapAtlas& atlas = mDynamicShadowMaps.back();
+			ShadowMapAtlas& atlas = shadowMaps.back();
 			atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER);
 		}
 
 		mapInfo.updateNormArea(MAX_ATLAS_SIZE);
-		ShadowMapAtlas& atlas = mDynamicShadowMaps[mapInfo.textureIdx];
+		ShadowMapAtlas& atlas = shadowMaps[mapInfo.textureIdx];
 
 		RenderAPI& rapi = RenderAPI::instance();
 		rapi.setRenderTarget(atlas.getTarget());
@@ -1442,6 +1590,15 @@ namespace bs { namespace ct
 
 		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = mapInfo;
 		lightShadows.numShadows++;
+
+		if (mapInfo.isStatic)
+		{
+			CachedShadowMap& cached = mCachedSpotShadows[light];
+			cached.revision = scene.getSceneInfo().spotLightShadowRevisions[options.lightIdx];
+			cached.mapSize = options.mapSize;
+			cached.shadowInfo = mapInfo;
+			cached.lastUsedCounter = 0;
+		}
 	}
 
 	void ShadowRendering::renderRadialShadowMap(const RendererLight& rendererLight, 
@@ -1459,16 +1616,31 @@ namespace bs { namespace ct
 		mapInfo.area = Rect2I(0, 0, options.mapSize, options.mapSize);
 		mapInfo.updateNormArea(options.mapSize);
 
-		for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size(); i++)
+		// Non-movable lights re-render into their existing cubemap, whose slot was reserved by updateShadowMapCache()
+		bool isStatic = light->getMobility() != ObjectMobility::Movable;
+		if (isStatic)
 		{
-			ShadowCubemap& cubemap = mShadowCubemaps[i];
+			auto iterFind = mCachedRadialShadows.find(light);
+			if (iterFind != mCachedRadialShadows.end() && iterFind->second.mapSize == options.mapSize)
+			{
+				mapInfo.textureIdx = iterFind->second.shadowInfo.textureIdx;
+				mShadowCubemaps[mapInfo.textureIdx].markAsUsed();
+			}
+		}
 
-			if (!cubemap.isUsed() && cubemap.getSize() == options.mapSize)
+		if (mapInfo.textureIdx == (UINT32)-1)
+		{
+			for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size(); i++)
 			{
-				mapInfo.textureIdx = i;
-				cubemap.markAsUsed();
+				ShadowCubemap& cubemap = mShadowCubemaps[i];
 
-				break;
+				if (!cubemap.isUsed() && cubemap.getSize() == options.mapSize)
+				{
+					mapInfo.textureIdx = i;
+					cubemap.markAsUsed();
+
+					break;
+				}
 			}
 		}
 
@@ -1641,6 +1813,15 @@ namespace bs { namespace ct
 
 		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = mapInfo;
 		lightShadows.numShadows++;
+
+		if (isStatic)
+		{
+			CachedShadowMap& cached = mCachedRadialShadows[light];
+			cached.revision = scene.getSceneInfo().radialLightShadowRevisions[options.lightIdx];
+			cached.mapSize = options.mapSize;
+			cached.shadowInfo = mapInfo;
+			cached.lastUsedCounter = 0;
+		}
 	}
 
 	void ShadowRendering::calcShadowMapProperties(const RendererLight& light, const RendererViewGroup& viewGroup, 
@@ -376,6 +376,7 @@ namespace bs { namespace ct
 		Rect2I area; /**< Area of the shadow map in pixels, relative to its source texture. */
 		Rect2 normArea; /**< Normalized shadow map area in [0, 1] range. */
 		UINT32 textureIdx; /**< Index of the texture the shadow map is stored in. */
+		bool isStatic = false; /**< True if the map resides in the persistent (static) atlas list. Spot lights only. */
 
 		float depthNear; /**< Distance to the near plane. */
 		float depthFar; /**< Distance to the far plane. */
@@ -532,6 +533,15 @@ namespace bs { namespace ct
 		{
 			SmallVector<LightShadows, 6> viewShadows;
 		};
+
+		/** Contains a shadow map of a non-movable light whose contents can be re-used across frames. */
+		struct CachedShadowMap
+		{
+			UINT32 revision = 0; /**< Scene shadow revision the map contents were rendered with. */
+			UINT32 mapSize = 0; /**< Size of the cached map, in pixels. */
+			ShadowInfo shadowInfo; /**< Shadow information recorded when the map was last rendered. */
+			UINT32 lastUsedCounter = 0; /**< Number of frames since the cached map was last needed. */
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -556,9 +566,25 @@ namespace bs { namespace ct
 			const FrameInfo& frameInfo);
 
 		/** Renders shadow maps for the provided radial light. */
-		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene, 
+		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
 			const FrameInfo& frameInfo);
 
+		/**
+		 * Attempts to re-use a previously rendered shadow map for the provided spot or radial light. Succeeds only for
+		 * non-movable lights whose cached map matches the current scene shadow revision and required map size. On
+		 * success the cached shadow is registered as if it was rendered this frame and true is returned. On failure
+		 * the caller is expected to render the shadow map from scratch.
+		 */
+		bool tryReuseCachedShadowMap(const RendererLight& light, LightType lightType, const ShadowMapOptions& options,
+			UINT32 revision);
+
+		/**
+		 * Ages cached shadow maps, evicts those that haven't been used for a while and reclaims any persistent atlases
+		 * and cubemaps no longer referenced by the cache. Expected to be called once per frame, after the non-cached
+		 * shadow textures have been cleared but before any shadow map rendering takes place.
+		 */
+		void updateShadowMapCache();
+
 		/** 
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
 		 * that can be used for fading out small shadow maps.
@@ -666,9 +692,13 @@ namespace bs { namespace ct
 		UINT32 mShadowMapSize;
 
 		Vector<ShadowMapAtlas> mDynamicShadowMaps;
+		Vector<ShadowMapAtlas> mStaticShadowMaps;
 		Vector<ShadowCascadedMap> mCascadedShadowMaps;
 		Vector<ShadowCubemap> mShadowCubemaps;
 
+		UnorderedMap<const Light*, CachedShadowMap> mCachedSpotShadows;
+		UnorderedMap<const Light*, CachedShadowMap> mCachedRadialShadows;
+
 		Vector<ShadowInfo> mShadowInfos;
 
 		Vector<LightShadows> mSpotLightShadows;
@@ -0,0 +1,46 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsSkinnedBounds.h"
+#include "RenderAPI/BsGpuBuffer.h"
+
+namespace bs { namespace ct
+{
+	static const UINT32 BOUNDS_THREADGROUP_SIZE = 256;
+
+	SkinnedBoundsParamDef gSkinnedBoundsParamDef;
+
+	SkinnedBoundsMat::SkinnedBoundsMat()
+	{
+		mParamBuffer = gSkinnedBoundsParamDef.createBuffer();
+		mParams->setParamBlockBuffer("Params", mParamBuffer);
+
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gVertexData", mVertexDataParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gBoneMatrices", mBoneMatricesParam);
+		mParams->getBufferParam(GPT_COMPUTE_PROGRAM, "gOutput", mOutputParam);
+	}
+
+	void SkinnedBoundsMat::_initDefines(ShaderDefines& defines)
+	{
+		defines.set("THREADGROUP_SIZE", BOUNDS_THREADGROUP_SIZE);
+	}
+
+	void SkinnedBoundsMat::execute(UINT32 numVertices, UINT32 vertexStride, UINT32 positionOffset,
+		UINT32 blendIndicesOffset, UINT32 blendWeightsOffset, const SPtr<GpuBuffer>& vertexData,
+		const SPtr<GpuBuffer>& boneMatrices, const SPtr<GpuBuffer>& output, UINT32 outputIdx)
+	{
+		gSkinnedBoundsParamDef.gNumVertices.set(mParamBuffer, numVertices);
+		gSkinnedBoundsParamDef.gVertexStride.set(mParamBuffer, vertexStride);
+		gSkinnedBoundsParamDef.gPositionOffset.set(mParamBuffer, positionOffset);
+		gSkinnedBoundsParamDef.gBlendIndicesOffset.set(mParamBuffer, blendIndicesOffset);
+		gSkinnedBoundsParamDef.gBlendWeightsOffset.set(mParamBuffer, blendWeightsOffset);
+		gSkinnedBoundsParamDef.gOutputIdx.set(mParamBuffer, outputIdx);
+
+		mVertexDataParam.set(vertexData);
+		mBoneMatricesParam.set(boneMatrices);
+		mOutputParam.set(output);
+
+		bind();
+
+		RenderAPI::instance().dispatchCompute(1);
+	}
+}}
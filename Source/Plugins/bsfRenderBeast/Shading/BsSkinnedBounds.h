@@ -0,0 +1,66 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Renderer/BsRendererMaterial.h"
+#include "Renderer/BsParamBlocks.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(SkinnedBoundsParamDef)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gNumVertices)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gVertexStride)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gPositionOffset)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gBlendIndicesOffset)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gBlendWeightsOffset)
+		BS_PARAM_BLOCK_ENTRY(UINT32, gOutputIdx)
+	BS_PARAM_BLOCK_END
+
+	extern SkinnedBoundsParamDef gSkinnedBoundsParamDef;
+
+	/**
+	 * Shader that applies skinning to the vertices of a mesh and reduces the resulting positions to a tight local
+	 * space axis aligned box, used for tightening culling bounds of animated objects.
+	 */
+	class SkinnedBoundsMat : public RendererMaterial<SkinnedBoundsMat>
+	{
+		RMAT_DEF_CUSTOMIZED("SkinnedBounds.bsl");
+
+	public:
+		SkinnedBoundsMat();
+
+		/**
+		 * Executes the reduction for a single skinned mesh, using one thread group striding over all of its vertices.
+		 *
+		 * @param[in]	numVertices			Number of vertices in the mesh.
+		 * @param[in]	vertexStride		Size of a single vertex in the vertex data buffer, in dwords.
+		 * @param[in]	positionOffset		Offset to the position element within a vertex, in dwords.
+		 * @param[in]	blendIndicesOffset	Offset to the blend indices element within a vertex, in dwords. The element
+		 *									is expected to contain four indices packed as bytes.
+		 * @param[in]	blendWeightsOffset	Offset to the blend weights element within a vertex, in dwords. The element
+		 *									is expected to contain four floats.
+		 * @param[in]	vertexData			Compute-readable copy of the mesh vertex stream, as a buffer of dwords.
+		 * @param[in]	boneMatrices		Bone matrices of the current pose, three float4 rows per bone, laid out the
+		 *									same as for regular skinned rendering.
+		 * @param[in]	output				Buffer receiving the reduced bounds, two float4 entries (minimum and
+		 *									maximum corner) per object.
+		 * @param[in]	outputIdx			Index of the object's entry pair in @p output.
+		 */
+		void execute(UINT32 numVertices, UINT32 vertexStride, UINT32 positionOffset, UINT32 blendIndicesOffset,
+			UINT32 blendWeightsOffset, const SPtr<GpuBuffer>& vertexData, const SPtr<GpuBuffer>& boneMatrices,
+			const SPtr<GpuBuffer>& output, UINT32 outputIdx);
+
+	private:
+		SPtr<GpuParamBlockBuffer> mParamBuffer;
+		GpuParamBuffer mVertexDataParam;
+		GpuParamBuffer mBoneMatricesParam;
+		GpuParamBuffer mOutputParam;
+	};
+
+	/** @} */
+}}
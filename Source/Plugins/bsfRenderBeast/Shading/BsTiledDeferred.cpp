@@ -38,9 +38,9 @@ namespace bs { namespace ct
 		defines.set("TILE_SIZE", TILE_SIZE);
 	}
 
-	void TiledDeferredLightingMat::execute(const RendererView& view, const VisibleLightData& lightData, 
+	void TiledDeferredLightingMat::execute(const RendererView& view, const VisibleLightData& lightData,
 		const GBufferTextures& gbuffer, const SPtr<Texture>& lightAccumTex, const SPtr<GpuBuffer>& lightAccumBuffer,
-		const SPtr<Texture>& msaaCoverage)
+		const SPtr<Texture>& msaaCoverage, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		const RendererViewProperties& viewProps = view.getProperties();
 		const RenderSettings& settings = view.getRenderSettings();
@@ -112,8 +112,8 @@ namespace bs { namespace ct
 		UINT32 numTilesX = (UINT32)Math::ceilToInt(width / (float)TILE_SIZE);
 		UINT32 numTilesY = (UINT32)Math::ceilToInt(height / (float)TILE_SIZE);
 
-		bind();
-		RenderAPI::instance().dispatchCompute(numTilesX, numTilesY);
+		bind(commandBuffer);
+		RenderAPI::instance().dispatchCompute(numTilesX, numTilesY, 1, commandBuffer);
 	}
 
 	TiledDeferredLightingMat* TiledDeferredLightingMat::getVariation(UINT32 msaaCount)
@@ -201,8 +201,8 @@ namespace bs { namespace ct
 		defines.set("TILE_SIZE", TILE_SIZE);
 	}
 
-	void TiledDeferredImageBasedLightingMat::execute(const RendererView& view, const SceneInfo& sceneInfo, 
-		const VisibleReflProbeData& probeData, const Inputs& inputs)
+	void TiledDeferredImageBasedLightingMat::execute(const RendererView& view, const SceneInfo& sceneInfo,
+		const VisibleReflProbeData& probeData, const Inputs& inputs, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		const RendererViewProperties& viewProps = view.getProperties();
 		UINT32 width = viewProps.viewRect.width;
@@ -253,8 +253,8 @@ namespace bs { namespace ct
 		UINT32 numTilesX = (UINT32)Math::ceilToInt(width / (float)TILE_SIZE);
 		UINT32 numTilesY = (UINT32)Math::ceilToInt(height / (float)TILE_SIZE);
 
-		bind();
-		RenderAPI::instance().dispatchCompute(numTilesX, numTilesY);
+		bind(commandBuffer);
+		RenderAPI::instance().dispatchCompute(numTilesX, numTilesY, 1, commandBuffer);
 	}
 
 	TiledDeferredImageBasedLightingMat* TiledDeferredImageBasedLightingMat::getVariation(UINT32 msaaCount)
@@ -46,9 +46,14 @@ namespace bs { namespace ct
 	public:
 		TiledDeferredLightingMat();
 
-		/** Binds the material for rendering, sets up parameters and executes it. */
+		/**
+		 * Binds the material for rendering, sets up parameters and executes it. If a command buffer is provided all
+		 * commands are queued on it instead of the main command buffer, allowing the dispatch to be scheduled on a
+		 * separate (e.g. compute) queue.
+		 */
 		void execute(const RendererView& view, const VisibleLightData& lightData, const GBufferTextures& gbuffer,
-			const SPtr<Texture>& lightAccumTex, const SPtr<GpuBuffer>& lightAccumBuffer, const SPtr<Texture>& msaaCoverage);
+			const SPtr<Texture>& lightAccumTex, const SPtr<GpuBuffer>& lightAccumBuffer, const SPtr<Texture>& msaaCoverage,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** Returns the material variation matching the provided parameters. */
 		static TiledDeferredLightingMat* getVariation(UINT32 msaaCount);
@@ -125,9 +130,13 @@ namespace bs { namespace ct
 
 		TiledDeferredImageBasedLightingMat();
 
-		/** Binds the material for rendering, sets up parameters and executes it. */
-		void execute(const RendererView& view, const SceneInfo& sceneInfo, const VisibleReflProbeData& probeData, 
-			const Inputs& inputs);
+		/**
+		 * Binds the material for rendering, sets up parameters and executes it. If a command buffer is provided all
+		 * commands are queued on it instead of the main command buffer, allowing the dispatch to be scheduled on a
+		 * separate (e.g. compute) queue.
+		 */
+		void execute(const RendererView& view, const SceneInfo& sceneInfo, const VisibleReflProbeData& probeData,
+			const Inputs& inputs, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** Returns the material variation matching the provided parameters. */
 		static TiledDeferredImageBasedLightingMat* getVariation(UINT32 msaaCount);
@@ -7,8 +7,10 @@
 
 namespace bs { namespace ct
 {
+	const UINT32 GpuResourcePool::MAX_UNUSED_FRAMES = 60;
+
 	PooledRenderTexture::PooledRenderTexture(GpuResourcePool* pool)
-		:mPool(pool), mIsFree(false)
+		:mPool(pool), mIsFree(false), mLastUsedFrame(0)
 	{ }
 
 	PooledRenderTexture::~PooledRenderTexture()
@@ -18,7 +20,7 @@ namespace bs { namespace ct
 	}
 
 	PooledStorageBuffer::PooledStorageBuffer(GpuResourcePool* pool)
-		:mPool(pool), mIsFree(false)
+		:mPool(pool), mIsFree(false), mLastUsedFrame(0)
 	{ }
 
 	PooledStorageBuffer::~PooledStorageBuffer()
@@ -36,14 +38,12 @@ namespace bs { namespace ct
 			buffer.second.lock()->mPool = nullptr;
 	}
 
-	SPtr<PooledRenderTexture> GpuResourcePool::get(const POOLED_RENDER_TEXTURE_DESC& desc)
+	SPtr<PooledRenderTexture> GpuResourcePool::get(const POOLED_RENDER_TEXTURE_DESC& desc, bool allowLargerMatch)
 	{
-		for (auto& texturePair : mTextures)
+		// Look for an exact match first
+		for (UINT32 i = 0; i < (UINT32)mFreeTextures.size(); i++)
 		{
-			SPtr<PooledRenderTexture> textureData = texturePair.second.lock();
-
-			if (!textureData->mIsFree)
-				continue;
+			SPtr<PooledRenderTexture> textureData = mFreeTextures[i];
 
 			if (textureData->texture == nullptr)
 				continue;
@@ -51,6 +51,42 @@ namespace bs { namespace ct
 			if (matches(textureData->texture, desc))
 			{
 				textureData->mIsFree = false;
+				mFreeTextures.erase(mFreeTextures.begin() + i);
+
+				return textureData;
+			}
+		}
+
+		// No exact match, look for the smallest larger texture (within a reasonable amount of wasted memory)
+		if (allowLargerMatch)
+		{
+			UINT32 bestIdx = (UINT32)-1;
+			UINT32 bestArea = std::numeric_limits<UINT32>::max();
+			for (UINT32 i = 0; i < (UINT32)mFreeTextures.size(); i++)
+			{
+				SPtr<PooledRenderTexture> textureData = mFreeTextures[i];
+
+				if (textureData->texture == nullptr)
+					continue;
+
+				if (!matches(textureData->texture, desc, true))
+					continue;
+
+				const TextureProperties& texProps = textureData->texture->getProperties();
+				UINT32 area = texProps.getWidth() * texProps.getHeight();
+				if (area < bestArea)
+				{
+					bestIdx = i;
+					bestArea = area;
+				}
+			}
+
+			if (bestIdx != (UINT32)-1)
+			{
+				SPtr<PooledRenderTexture> textureData = mFreeTextures[bestIdx];
+				textureData->mIsFree = false;
+				mFreeTextures.erase(mFreeTextures.begin() + bestIdx);
+
 				return textureData;
 			}
 		}
@@ -102,12 +138,9 @@ namespace bs { namespace ct
 
 	SPtr<PooledStorageBuffer> GpuResourcePool::get(const POOLED_STORAGE_BUFFER_DESC& desc)
 	{
-		for (auto& bufferPair : mBuffers)
+		for (UINT32 i = 0; i < (UINT32)mFreeBuffers.size(); i++)
 		{
-			SPtr<PooledStorageBuffer> bufferData = bufferPair.second.lock();
-
-			if (!bufferData->mIsFree)
-				continue;
+			SPtr<PooledStorageBuffer> bufferData = mFreeBuffers[i];
 
 			if (bufferData->buffer == nullptr)
 				continue;
@@ -115,6 +148,8 @@ namespace bs { namespace ct
 			if (matches(bufferData->buffer, desc))
 			{
 				bufferData->mIsFree = false;
+				mFreeBuffers.erase(mFreeBuffers.begin() + i);
+
 				return bufferData;
 			}
 		}
@@ -136,24 +171,125 @@ namespace bs { namespace ct
 
 	void GpuResourcePool::release(const SPtr<PooledRenderTexture>& texture)
 	{
-		auto iterFind = mTextures.find(texture.get());
-		iterFind->second.lock()->mIsFree = true;
+		if (texture->mIsFree)
+			return;
+
+		texture->mIsFree = true;
+		texture->mLastUsedFrame = mCurrentFrame;
+		mFreeTextures.push_back(texture);
 	}
 
 	void GpuResourcePool::release(const SPtr<PooledStorageBuffer>& buffer)
 	{
-		auto iterFind = mBuffers.find(buffer.get());
-		iterFind->second.lock()->mIsFree = true;
+		if (buffer->mIsFree)
+			return;
+
+		buffer->mIsFree = true;
+		buffer->mLastUsedFrame = mCurrentFrame;
+		mFreeBuffers.push_back(buffer);
 	}
 
-	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
+	void GpuResourcePool::update()
+	{
+		mCurrentFrame++;
+
+		// Note: Only destroying entries the pool is the sole owner of. Entries some external code still references are
+		// kept in the free list so they remain reusable, and are re-evaluated once those references are gone.
+		for (auto iter = mFreeTextures.begin(); iter != mFreeTextures.end();)
+		{
+			if ((*iter).use_count() == 1 && (mCurrentFrame - (*iter)->mLastUsedFrame) >= MAX_UNUSED_FRAMES)
+				iter = mFreeTextures.erase(iter);
+			else
+				++iter;
+		}
+
+		for (auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end();)
+		{
+			if ((*iter).use_count() == 1 && (mCurrentFrame - (*iter)->mLastUsedFrame) >= MAX_UNUSED_FRAMES)
+				iter = mFreeBuffers.erase(iter);
+			else
+				++iter;
+		}
+	}
+
+	UINT64 GpuResourcePool::trim(UINT64 numBytes)
+	{
+		// Sort so the least recently used entries are destroyed first. The free lists carry no meaningful order
+		// otherwise - lookups scan them in full.
+		std::sort(mFreeTextures.begin(), mFreeTextures.end(),
+			[](const SPtr<PooledRenderTexture>& a, const SPtr<PooledRenderTexture>& b)
+		{
+			return a->mLastUsedFrame < b->mLastUsedFrame;
+		});
+
+		std::sort(mFreeBuffers.begin(), mFreeBuffers.end(),
+			[](const SPtr<PooledStorageBuffer>& a, const SPtr<PooledStorageBuffer>& b)
+		{
+			return a->mLastUsedFrame < b->mLastUsedFrame;
+		});
+
+		UINT64 freedBytes = 0;
+		for (auto iter = mFreeTextures.begin(); iter != mFreeTextures.end() && freedBytes < numBytes;)
+		{
+			// Only entries the pool is the sole owner of can actually be destroyed
+			if ((*iter).use_count() == 1)
+			{
+				const TextureProperties& props = (*iter)->texture->getProperties();
+
+				UINT64 textureBytes = 0;
+				for (UINT32 mip = 0; mip <= props.getNumMipmaps(); mip++)
+				{
+					UINT32 mipWidth, mipHeight, mipDepth;
+					PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mip,
+						mipWidth, mipHeight, mipDepth);
+
+					textureBytes += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, props.getFormat());
+				}
+
+				textureBytes *= props.getNumFaces();
+
+				if (props.getNumSamples() > 1)
+					textureBytes *= props.getNumSamples();
+
+				freedBytes += textureBytes;
+				iter = mFreeTextures.erase(iter);
+			}
+			else
+				++iter;
+		}
+
+		for (auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end() && freedBytes < numBytes;)
+		{
+			if ((*iter).use_count() == 1)
+			{
+				freedBytes += (*iter)->buffer->getSize();
+				iter = mFreeBuffers.erase(iter);
+			}
+			else
+				++iter;
+		}
+
+		return freedBytes;
+	}
+
+	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc, bool allowLarger)
 	{
 		const TextureProperties& texProps = texture->getProperties();
 
-		bool match = texProps.getTextureType() == desc.type 
-			&& texProps.getFormat() == desc.format 
-			&& texProps.getWidth() == desc.width 
-			&& texProps.getHeight() == desc.height
+		bool sizeMatch;
+		if (allowLarger && desc.type == TEX_TYPE_2D)
+		{
+			// Accept a larger texture, as long as no more than half of its area would end up wasted
+			sizeMatch = texProps.getWidth() >= desc.width
+				&& texProps.getHeight() >= desc.height
+				&& texProps.getWidth() * texProps.getHeight() <= desc.width * desc.height * 2;
+		}
+		else
+			sizeMatch = texProps.getWidth() == desc.width && texProps.getHeight() == desc.height;
+
+		bool match = texProps.getTextureType() == desc.type
+			&& texProps.getFormat() == desc.format
+			&& sizeMatch
 			&& (texProps.getUsage() & desc.flag) == desc.flag
 			&& (
 				(desc.type == TEX_TYPE_2D 
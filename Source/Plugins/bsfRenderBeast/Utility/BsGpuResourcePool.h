@@ -31,6 +31,7 @@ namespace bs { namespace ct
 
 		GpuResourcePool* mPool;
 		bool mIsFree;
+		UINT32 mLastUsedFrame;
 	};
 
 	/**	Contains data about a single storage buffer in the GPU resource pool. */
@@ -46,9 +47,10 @@ namespace bs { namespace ct
 
 		GpuResourcePool* mPool;
 		bool mIsFree;
+		UINT32 mLastUsedFrame;
 	};
 
-	/** 
+	/**
 	 * Contains a pool of textures and buffers meant to accommodate reuse of such resources for the main purpose of using
 	 * them as write targets on the GPU.
 	 */
@@ -61,9 +63,14 @@ namespace bs { namespace ct
 		 * Attempts to find the unused render texture with the specified parameters in the pool, or creates a new texture
 		 * otherwise. When done with the texture make sure to call release(const POOLED_RENDER_TEXTURE_DESC&).
 		 *
-		 * @param[in]	desc		Descriptor structure that describes what kind of texture to retrieve.
+		 * @param[in]	desc				Descriptor structure that describes what kind of texture to retrieve.
+		 * @param[in]	allowLargerMatch	If true, an unused two dimensional texture larger than the requested size may
+		 *									be returned, if no exact match is available. Reduces the total number of
+		 *									allocated textures, but is only safe if the caller renders to and samples from
+		 *									an explicitly specified sub-region, rather than assuming the texture is
+		 *									exactly of the requested size.
 		 */
-		SPtr<PooledRenderTexture> get(const POOLED_RENDER_TEXTURE_DESC& desc);
+		SPtr<PooledRenderTexture> get(const POOLED_RENDER_TEXTURE_DESC& desc, bool allowLargerMatch = false);
 
 		/**
 		 * Attempts to find the unused storage buffer with the specified parameters in the pool, or creates a new buffer
@@ -93,6 +100,19 @@ namespace bs { namespace ct
 		 */
 		void release(const SPtr<PooledStorageBuffer>& buffer);
 
+		/**
+		 * Destroys any pooled resources that haven't been requested for a certain number of frames, freeing up their
+		 * memory. Should be called once per frame.
+		 */
+		void update();
+
+		/**
+		 * Destroys currently unused pooled resources, least recently used first, until roughly @p numBytes of memory has
+		 * been released or no unused resources remain. Used for reclaiming memory when the GPU memory budget is
+		 * exceeded. Returns the estimated number of bytes actually released.
+		 */
+		UINT64 trim(UINT64 numBytes);
+
 	private:
 		friend struct PooledRenderTexture;
 		friend struct PooledStorageBuffer;
@@ -111,11 +131,14 @@ namespace bs { namespace ct
 
 		/**
 		 * Checks does the provided texture match the parameters.
-		 * 
-		 * @param[in]	desc	Descriptor structure that describes what kind of texture to match.
-		 * @return				True if the texture matches the descriptor, false otherwise.
+		 *
+		 * @param[in]	desc		Descriptor structure that describes what kind of texture to match.
+		 * @param[in]	allowLarger	If true, a two dimensional texture larger than the requested size (but no more than
+		 *							twice the requested area) is also considered a match.
+		 * @return					True if the texture matches the descriptor, false otherwise.
 		 */
-		static bool matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
+		static bool matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc,
+			bool allowLarger = false);
 
 		/**
 		 * Checks does the provided buffer match the parameters.
@@ -127,6 +150,14 @@ namespace bs { namespace ct
 
 		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
 		Map<PooledStorageBuffer*, std::weak_ptr<PooledStorageBuffer>> mBuffers;
+
+		// Strong references to released resources, so they remain allocated for potential reuse even if no external
+		// references remain. Entries not reused within MAX_UNUSED_FRAMES are destroyed by update().
+		Vector<SPtr<PooledRenderTexture>> mFreeTextures;
+		Vector<SPtr<PooledStorageBuffer>> mFreeBuffers;
+		UINT32 mCurrentFrame = 0;
+
+		static const UINT32 MAX_UNUSED_FRAMES;
 	};
 
 	/** Structure used for creating a new pooled render texture. */
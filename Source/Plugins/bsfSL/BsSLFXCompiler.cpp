@@ -18,6 +18,7 @@
 #include "Renderer/BsRendererManager.h"
 #include "FileSystem/BsFileSystem.h"
 #include "FileSystem/BsDataStream.h"
+#include "Threading/BsTaskScheduler.h"
 
 #define XSC_ENABLE_LANGUAGE_EXT 1
 #include "Xsc/Xsc.h"
@@ -1655,8 +1656,103 @@ namespace bs
 		return output;
 	}
 
+	void BSLFXCompiler::mergeShaderDesc(SHADER_DESC& dest, const SHADER_DESC& source)
+	{
+		// Data parameters, with their default values copied over and indices remapped
+		for (auto& entry : source.dataParams)
+		{
+			if (dest.dataParams.find(entry.first) != dest.dataParams.end())
+				continue;
+
+			SHADER_DATA_PARAM_DESC desc = entry.second;
+			if (desc.defaultValueIdx != (UINT32)-1)
+			{
+				UINT32 defaultValueSize = Shader::getDataParamSize(desc.type);
+
+				UINT32 remappedIdx = (UINT32)dest.dataDefaultValues.size();
+				dest.dataDefaultValues.resize(remappedIdx + defaultValueSize);
+				memcpy(&dest.dataDefaultValues[remappedIdx], &source.dataDefaultValues[desc.defaultValueIdx],
+					defaultValueSize);
+
+				desc.defaultValueIdx = remappedIdx;
+			}
+
+			dest.dataParams[entry.first] = desc;
+		}
+
+		// Object parameters. New entries are copied as-is, existing ones only receive any new GPU variable names,
+		// same as SHADER_DESC::addParameter() would do.
+		auto mergeObjectParam = [](Map<String, SHADER_OBJECT_PARAM_DESC>& destMap,
+			const SHADER_OBJECT_PARAM_DESC& param, UINT32 remappedDefaultIdx)
+		{
+			auto iterFind = destMap.find(param.name);
+			if (iterFind == destMap.end())
+			{
+				SHADER_OBJECT_PARAM_DESC desc = param;
+				desc.defaultValueIdx = remappedDefaultIdx;
+
+				destMap[param.name] = desc;
+			}
+			else
+			{
+				SHADER_OBJECT_PARAM_DESC& desc = iterFind->second;
+
+				// Same name but different properties, ignore the param
+				if (desc.type != param.type || desc.rendererSemantic != param.rendererSemantic)
+					return;
+
+				for (auto& gpuVariableName : param.gpuVariableNames)
+				{
+					auto iterName = std::find(desc.gpuVariableNames.begin(), desc.gpuVariableNames.end(),
+						gpuVariableName);
+
+					if (iterName == desc.gpuVariableNames.end())
+						desc.gpuVariableNames.push_back(gpuVariableName);
+				}
+			}
+		};
+
+		for (auto& entry : source.textureParams)
+		{
+			UINT32 defaultValueIdx = (UINT32)-1;
+			bool isNew = dest.textureParams.find(entry.first) == dest.textureParams.end();
+			if (isNew && entry.second.defaultValueIdx != (UINT32)-1)
+			{
+				defaultValueIdx = (UINT32)dest.textureDefaultValues.size();
+				dest.textureDefaultValues.push_back(source.textureDefaultValues[entry.second.defaultValueIdx]);
+			}
+
+			mergeObjectParam(dest.textureParams, entry.second, defaultValueIdx);
+		}
+
+		for (auto& entry : source.samplerParams)
+		{
+			UINT32 defaultValueIdx = (UINT32)-1;
+			bool isNew = dest.samplerParams.find(entry.first) == dest.samplerParams.end();
+			if (isNew && entry.second.defaultValueIdx != (UINT32)-1)
+			{
+				defaultValueIdx = (UINT32)dest.samplerDefaultValues.size();
+				dest.samplerDefaultValues.push_back(source.samplerDefaultValues[entry.second.defaultValueIdx]);
+			}
+
+			mergeObjectParam(dest.samplerParams, entry.second, defaultValueIdx);
+		}
+
+		for (auto& entry : source.bufferParams)
+			mergeObjectParam(dest.bufferParams, entry.second, (UINT32)-1);
+
+		for (auto& entry : source.paramBlocks)
+		{
+			if (dest.paramBlocks.find(entry.first) == dest.paramBlocks.end())
+				dest.paramBlocks[entry.first] = entry.second;
+		}
+
+		for (auto& technique : source.techniques)
+			dest.techniques.push_back(technique);
+	}
+
 	BSLFXCompileResult BSLFXCompiler::compileTechniques(
-		const Vector<std::pair<ASTFXNode*, ShaderMetaData>>& shaderMetaData, const String& source, 
+		const Vector<std::pair<ASTFXNode*, ShaderMetaData>>& shaderMetaData, const String& source,
 		const UnorderedMap<String, String>& defines, SHADER_DESC& shaderDesc, Vector<String>& includes)
 	{
 		BSLFXCompileResult output;
@@ -1745,9 +1841,19 @@ namespace bs
 				}
 			}
 
-			// For every variation, re-parse the file with relevant defines
-			for (auto& variation : variations)
+			// For every variation, re-parse the file with relevant defines and compile its techniques. Individual
+			// variations don't depend on each other until their outputs are merged, so they are distributed across
+			// the task scheduler's worker threads.
+			UINT32 numVariations = (UINT32)variations.size();
+
+			Vector<BSLFXCompileResult> variationOutputs(numVariations);
+			Vector<SHADER_DESC> variationDescs(numVariations);
+			Vector<UnorderedSet<String>> variationIncludes(numVariations);
+
+			auto compileVariation = [&](UINT32 idx)
 			{
+				const ShaderVariation& variation = variations[idx];
+
 				UnorderedMap<String, String> globalDefines = defines;
 				UnorderedMap<String, String> variationDefines = variation.getDefines().getAll();
 
@@ -1755,9 +1861,9 @@ namespace bs
 					globalDefines[define.first] = define.second;
 
 				ParseState* variationParseState = parseStateCreate();
-				output = parseFX(variationParseState, source.c_str(), globalDefines);
+				variationOutputs[idx] = parseFX(variationParseState, source.c_str(), globalDefines);
 
-				if (!output.errorMessage.empty())
+				if (!variationOutputs[idx].errorMessage.empty())
 					parseStateDelete(variationParseState);
 				else
 				{
@@ -1772,12 +1878,42 @@ namespace bs
 						rawCode = rawCode->next;
 					}
 
-					output = compileTechniques(variationParseState, entry.second.name, codeBlocks, variation, includeSet, 
-						shaderDesc);
+					variationOutputs[idx] = compileTechniques(variationParseState, entry.second.name, codeBlocks,
+						variation, variationIncludes[idx], variationDescs[idx]);
+				}
+			};
 
-					if (!output.errorMessage.empty())
-						return output;
+			if (numVariations > 1 && TaskScheduler::instancePtr() != nullptr)
+			{
+				Vector<SPtr<Task>> tasks;
+				for (UINT32 i = 0; i < numVariations; i++)
+				{
+					SPtr<Task> task = Task::create("BSLVariation", std::bind(compileVariation, i));
+					tasks.push_back(task);
+
+					TaskScheduler::instance().addTask(task);
 				}
+
+				for (auto& task : tasks)
+					task->wait();
+			}
+			else
+			{
+				for (UINT32 i = 0; i < numVariations; i++)
+					compileVariation(i);
+			}
+
+			// Merge the per-variation outputs, in variation order, so the result matches what serial compilation
+			// would have produced
+			for (UINT32 i = 0; i < numVariations; i++)
+			{
+				if (!variationOutputs[i].errorMessage.empty())
+					return variationOutputs[i];
+
+				mergeShaderDesc(shaderDesc, variationDescs[i]);
+
+				for (auto& include : variationIncludes[i])
+					includeSet.insert(include);
 			}
 		}
 
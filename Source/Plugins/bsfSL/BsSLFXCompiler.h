@@ -282,10 +282,17 @@ namespace bs
 		 *								registered with.
 		 * @return						A result object containing an error message if not successful.
 		 */
-		static BSLFXCompileResult compileTechniques(ParseState* parseState, const String& name, 
-			const Vector<String>& codeBlocks, const ShaderVariation& variation, UnorderedSet<String>& includes, 
+		static BSLFXCompileResult compileTechniques(ParseState* parseState, const String& name,
+			const Vector<String>& codeBlocks, const ShaderVariation& variation, UnorderedSet<String>& includes,
 			SHADER_DESC& shaderDesc);
 
+		/**
+		 * Merges parameters, parameter blocks, default values and techniques from @p source into @p dest. Parameters
+		 * already registered in @p dest are ignored, mirroring the behavior of registering variation parameters one
+		 * variation at a time. Default value indices are remapped as the values are copied.
+		 */
+		static void mergeShaderDesc(SHADER_DESC& dest, const SHADER_DESC& source);
+
 		/**
 		 * Converts a null-terminated string into a standard string, and eliminates quotes that are assumed to be at the 
 		 * first and last index.
@@ -104,9 +104,13 @@ namespace bs { namespace ct
 			if (buffers[i] == nullptr)
 				break;
 
-			if(buffers[i]->mState == VulkanCmdBuffer::State::Ready)
+			if(buffers[i]->mState == VulkanCmdBuffer::State::Ready && buffers[i]->mIsSecondary == secondary)
 			{
-				buffers[i]->begin();
+				// Secondary buffers can't begin recording until a render target is assigned, since their commands
+				// record within the render pass instance of the primary they execute on
+				if (!secondary)
+					buffers[i]->begin();
+
 				return buffers[i];
 			}
 		}
@@ -115,7 +119,9 @@ namespace bs { namespace ct
 			"Too many command buffers allocated. Increment BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY to a higher value. ");
 
 		buffers[i] = createBuffer(queueFamily, secondary);
-		buffers[i]->begin();
+
+		if (!secondary)
+			buffers[i]->begin();
 
 		return buffers[i];
 	}
@@ -187,7 +193,7 @@ namespace bs { namespace ct
 	}
 
 	VulkanCmdBuffer::VulkanCmdBuffer(VulkanDevice& device, UINT32 id, VkCommandPool pool, UINT32 queueFamily, bool secondary)
-		: mId(id), mQueueFamily(queueFamily), mState(State::Ready), mDevice(device), mPool(pool)
+		: mId(id), mQueueFamily(queueFamily), mState(State::Ready), mIsSecondary(secondary), mDevice(device), mPool(pool)
 		, mIntraQueueSemaphore(nullptr), mInterQueueSemaphores(), mNumUsedInterQueueSemaphores(0)
 		, mFramebuffer(nullptr), mRenderTargetWidth(0)
 		, mRenderTargetHeight(0), mRenderTargetReadOnlyFlags(0), mRenderTargetLoadMask(RT_NONE), mGlobalQueueIdx(-1)
@@ -290,6 +296,7 @@ namespace bs { namespace ct
 	void VulkanCmdBuffer::begin()
 	{
 		assert(mState == State::Ready);
+		assert(!mIsSecondary);
 
 		VkCommandBufferBeginInfo beginInfo;
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -317,6 +324,112 @@ namespace bs { namespace ct
 		mState = State::RecordingDone;
 	}
 
+	void VulkanCmdBuffer::beginSecondary()
+	{
+		assert(mState == State::Ready);
+		assert(mIsSecondary);
+
+		if (mFramebuffer == nullptr)
+		{
+			LOGWRN("Attempting to begin a secondary command buffer but no render target is bound to the command buffer.");
+			return;
+		}
+
+		// All load, read and clear variants of the same framebuffer's render pass are compatible, so the variant the
+		// primary buffer ends up beginning the pass with doesn't need to be known here
+		VkCommandBufferInheritanceInfo inheritanceInfo;
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.pNext = nullptr;
+		inheritanceInfo.renderPass = mFramebuffer->getRenderPass(RT_NONE, RT_NONE, CLEAR_NONE);
+		inheritanceInfo.subpass = 0;
+		inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+		inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+		inheritanceInfo.queryFlags = 0;
+		inheritanceInfo.pipelineStatistics = 0;
+
+		VkCommandBufferBeginInfo beginInfo;
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.pNext = nullptr;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+		beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+		VkResult result = vkBeginCommandBuffer(mCmdBuffer, &beginInfo);
+		assert(result == VK_SUCCESS);
+
+		// Commands record within the render pass instance of the primary buffer this buffer executes on
+		mState = State::RecordingRenderPass;
+	}
+
+	void VulkanCmdBuffer::endSecondary()
+	{
+		assert(mState == State::RecordingRenderPass);
+		assert(mIsSecondary);
+
+		// No render pass instance is active on this buffer itself, so recording can end directly
+		VkResult result = vkEndCommandBuffer(mCmdBuffer);
+		assert(result == VK_SUCCESS);
+
+		mState = State::RecordingDone;
+	}
+
+	void VulkanCmdBuffer::executeSecondary(VulkanCmdBuffer& secondary)
+	{
+		assert(!mIsSecondary);
+		assert(secondary.mIsSecondary);
+		assert(secondary.mState == State::RecordingDone);
+
+		if (mFramebuffer == nullptr)
+		{
+			LOGWRN("Attempting to execute a secondary command buffer but no render target is bound to the command buffer.");
+			return;
+		}
+
+		// Register the secondary's resources so they remain alive until this buffer is done executing. Note this only
+		// handles lifetime - any layout transitions queued while recording the secondary are not replayed.
+		for (auto& entry : secondary.mResources)
+			registerResource(entry.first, entry.second.flags);
+
+		for (auto& entry : secondary.mBuffers)
+			registerResource(static_cast<VulkanBuffer*>(entry.first), entry.second.accessFlags,
+				entry.second.useHandle.flags);
+
+		for (auto& entry : secondary.mImages)
+		{
+			ImageInfo& imageInfo = secondary.mImageInfos[entry.second];
+			registerResource(entry.first, imageInfo.useHandle.flags);
+		}
+
+		mAppendedSecondaries.push_back(&secondary);
+
+		// Secondary buffer contents require their own render pass instance, so interrupt the current pass if any
+		if (isInRenderPass())
+			endRenderPass();
+
+		executeLayoutTransitions();
+
+		RenderSurfaceMask readMask = getFBReadMask();
+
+		// Load existing attachment contents, as the secondary continues rendering into the current target
+		VkRenderPassBeginInfo renderPassBeginInfo;
+		renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+		renderPassBeginInfo.pNext = nullptr;
+		renderPassBeginInfo.framebuffer = mFramebuffer->getFramebuffer(RT_ALL, readMask, CLEAR_NONE);
+		renderPassBeginInfo.renderPass = mFramebuffer->getRenderPass(RT_ALL, readMask, CLEAR_NONE);
+		renderPassBeginInfo.renderArea.offset.x = 0;
+		renderPassBeginInfo.renderArea.offset.y = 0;
+		renderPassBeginInfo.renderArea.extent.width = mRenderTargetWidth;
+		renderPassBeginInfo.renderArea.extent.height = mRenderTargetHeight;
+		renderPassBeginInfo.clearValueCount = 0;
+		renderPassBeginInfo.pClearValues = nullptr;
+
+		vkCmdBeginRenderPass(mCmdBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+		VkCommandBuffer secondaryHandle = secondary.getHandle();
+		vkCmdExecuteCommands(mCmdBuffer, 1, &secondaryHandle);
+
+		vkCmdEndRenderPass(mCmdBuffer);
+	}
+
 	void VulkanCmdBuffer::beginRenderPass()
 	{
 		assert(mState == State::Recording);
@@ -807,6 +920,12 @@ namespace bs { namespace ct
 		mImageInfos.clear();
 		mSubresourceInfoStorage.clear();
 		mPassTouchedSubresourceInfos.clear();
+
+		// This buffer is done executing, so any secondary buffers executed on it can be recycled as well
+		for (auto& entry : mAppendedSecondaries)
+			entry->reset();
+
+		mAppendedSecondaries.clear();
 	}
 
 	void VulkanCmdBuffer::setRenderTarget(const SPtr<RenderTarget>& rt, UINT32 readOnlyFlags, 
@@ -1485,7 +1604,12 @@ namespace bs { namespace ct
 		bindGpuParams();
 
 		if (!isInRenderPass())
-			beginRenderPass();
+		{
+			if (mIsSecondary)
+				beginSecondary();
+			else
+				beginRenderPass();
+		}
 
 		if (mGfxPipelineRequiresBind)
 		{
@@ -1524,7 +1648,12 @@ namespace bs { namespace ct
 		bindGpuParams();
 
 		if (!isInRenderPass())
-			beginRenderPass();
+		{
+			if (mIsSecondary)
+				beginSecondary();
+			else
+				beginRenderPass();
+		}
 
 		if (mGfxPipelineRequiresBind)
 		{
@@ -2388,8 +2517,34 @@ namespace bs { namespace ct
 		mBuffer = pool.getBuffer(queueFamily, mIsSecondary);
 	}
 
+	void VulkanCommandBuffer::appendSecondary(VulkanCommandBuffer& secondary)
+	{
+		assert(secondary.mIsSecondary);
+
+		VulkanCmdBuffer* secondaryBuffer = secondary.mBuffer;
+		if (secondaryBuffer->isInRenderPass())
+			secondaryBuffer->endSecondary();
+
+		if (!secondaryBuffer->isReadyForSubmit()) // Nothing was recorded in the buffer
+			return;
+
+		mBuffer->executeSecondary(*secondaryBuffer);
+
+		// The primary buffer owns the secondary until it is done executing, and will recycle it. Give the secondary
+		// command buffer a fresh internal buffer so it can immediately record a new set of commands.
+		secondary.mBuffer = nullptr;
+		secondary.acquireNewBuffer();
+	}
+
 	void VulkanCommandBuffer::submit(UINT32 syncMask)
 	{
+		if (mIsSecondary)
+		{
+			LOGWRN("Cannot submit a secondary command buffer directly. Use RenderAPI::addCommands() to append it to a \
+				primary command buffer instead.");
+			return;
+		}
+
 		// Ignore myself
 		syncMask &= ~mIdMask;
 
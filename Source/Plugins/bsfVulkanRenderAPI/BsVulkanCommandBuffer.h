@@ -122,12 +122,31 @@ namespace bs { namespace ct
 		/** Returns the index of the device this command buffer will execute on. */
 		UINT32 getDeviceIdx() const;
 
-		/** Makes the command buffer ready to start recording commands. */
+		/** Makes the command buffer ready to start recording commands. Primary command buffers only. */
 		void begin();
 
 		/** Ends command buffer command recording (as started with begin()). */
 		void end();
 
+		/**
+		 * Makes a secondary command buffer ready to start recording commands. The commands will record within the render
+		 * pass instance of the primary command buffer the secondary is eventually executed on, so a render target must be
+		 * assigned through setRenderTarget() before this is called. Called automatically on first draw.
+		 */
+		void beginSecondary();
+
+		/** Ends command recording on a secondary command buffer (as started with beginSecondary()). */
+		void endSecondary();
+
+		/**
+		 * Appends the commands recorded on the provided secondary command buffer to this (primary) command buffer. The
+		 * secondary buffer must have finished recording. Note that any layout transitions queued while recording the
+		 * secondary buffer are not replayed - resources used by the secondary buffer must already be in the layouts its
+		 * descriptor sets expect (e.g. by binding them on this buffer beforehand). The secondary buffer is kept alive
+		 * until this buffer is done executing.
+		 */
+		void executeSecondary(VulkanCmdBuffer& secondary);
+
 		/** Begins render pass recording. Must be called within begin()/end() calls. */
 		void beginRenderPass();
 
@@ -470,6 +489,7 @@ namespace bs { namespace ct
 		UINT32 mId;
 		UINT32 mQueueFamily;
 		State mState;
+		bool mIsSecondary;
 		VulkanDevice& mDevice;
 		VkCommandPool mPool;
 		VkCommandBuffer mCmdBuffer;
@@ -526,6 +546,7 @@ namespace bs { namespace ct
 		Vector<VulkanEvent*> mQueuedEvents;
 		Vector<VulkanQuery*> mQueuedQueryResets;
 		UnorderedSet<VulkanSwapChain*> mSwapChains;
+		Vector<VulkanCmdBuffer*> mAppendedSecondaries;
 	};
 
 	/** CommandBuffer implementation for Vulkan. */
@@ -540,9 +561,16 @@ namespace bs { namespace ct
 		 */
 		void submit(UINT32 syncMask);
 
-		/** 
-		 * Returns the internal command buffer. 
-		 * 
+		/**
+		 * Appends the commands recorded on the provided secondary command buffer to this (primary) command buffer,
+		 * finishing the secondary's recording if still in progress. The secondary acquires a new internal buffer and may
+		 * immediately begin recording a new set of commands.
+		 */
+		void appendSecondary(VulkanCommandBuffer& secondary);
+
+		/**
+		 * Returns the internal command buffer.
+		 *
 		 * @note	This buffer will change after a submit() call.
 		 */
 		VulkanCmdBuffer* getInternal() const { return mBuffer; }
@@ -5,6 +5,8 @@
 #include "BsVulkanCommandBuffer.h"
 #include "Managers/BsVulkanDescriptorManager.h"
 #include "Managers/BsVulkanQueryManager.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
 
 #define VMA_IMPLEMENTATION
 #include "ThirdParty/vk_mem_alloc.h"
@@ -12,7 +14,8 @@
 namespace bs { namespace ct
 {
 	VulkanDevice::VulkanDevice(VkPhysicalDevice device, UINT32 deviceIdx)
-		: mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx), mQueueInfos()
+		: mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx)
+		, mPipelineCache(VK_NULL_HANDLE), mQueueInfos()
 	{
 		// Set to default
 		for (UINT32 i = 0; i < GQT_COUNT; i++)
@@ -154,6 +157,8 @@ namespace bs { namespace ct
 
 		vmaCreateAllocator(&allocatorCI, &mAllocator);
 
+		loadPipelineCache();
+
 		// Create pools/managers
 		mCommandBufferPool = bs_new<VulkanCmdBufferPool>(*this);
 		mQueryPool = bs_new<VulkanQueryPool>(*this);
@@ -181,11 +186,100 @@ namespace bs { namespace ct
 
 		// Needs to happen after query pool & command buffer pool shutdown, to ensure their resources are destroyed
 		bs_delete(mResourceManager);
-		
+
+		if(mPipelineCache != VK_NULL_HANDLE)
+		{
+			savePipelineCache();
+			vkDestroyPipelineCache(mLogicalDevice, mPipelineCache, gVulkanAllocator);
+		}
+
 		vmaDestroyAllocator(mAllocator);
 		vkDestroyDevice(mLogicalDevice, gVulkanAllocator);
 	}
 
+	void VulkanDevice::loadPipelineCache()
+	{
+		Vector<UINT8> initialData;
+
+		Path cachePath = getPipelineCachePath();
+		if(FileSystem::exists(cachePath))
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(cachePath, true);
+			if(stream != nullptr)
+			{
+				initialData.resize((UINT32)stream->size());
+				stream->read(initialData.data(), initialData.size());
+			}
+		}
+
+		// Validate the header before handing the data to the driver. The driver performs the same check, but this way
+		// we can cleanly discard caches written by a different device or an updated driver.
+		if(!initialData.empty())
+		{
+			struct PipelineCacheHeader
+			{
+				UINT32 length;
+				UINT32 version;
+				UINT32 vendorID;
+				UINT32 deviceID;
+				UINT8 uuid[VK_UUID_SIZE];
+			};
+
+			bool valid = initialData.size() >= sizeof(PipelineCacheHeader);
+			if(valid)
+			{
+				PipelineCacheHeader header;
+				memcpy(&header, initialData.data(), sizeof(header));
+
+				valid = header.version == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+					header.vendorID == mDeviceProperties.vendorID &&
+					header.deviceID == mDeviceProperties.deviceID &&
+					memcmp(header.uuid, mDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+			}
+
+			if(!valid)
+				initialData.clear();
+		}
+
+		VkPipelineCacheCreateInfo cacheCI;
+		cacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		cacheCI.pNext = nullptr;
+		cacheCI.flags = 0;
+		cacheCI.initialDataSize = initialData.size();
+		cacheCI.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+		VkResult result = vkCreatePipelineCache(mLogicalDevice, &cacheCI, gVulkanAllocator, &mPipelineCache);
+		assert(result == VK_SUCCESS);
+	}
+
+	void VulkanDevice::savePipelineCache() const
+	{
+		size_t size = 0;
+		VkResult result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &size, nullptr);
+		if(result != VK_SUCCESS || size == 0)
+			return;
+
+		Vector<UINT8> data((UINT32)size);
+		result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &size, data.data());
+		if(result != VK_SUCCESS)
+			return;
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(getPipelineCachePath());
+		if(stream != nullptr)
+			stream->write(data.data(), size);
+	}
+
+	Path VulkanDevice::getPipelineCachePath() const
+	{
+		// Key the file by vendor and device, so caches of multiple GPUs in the system don't overwrite each other. Driver
+		// version changes are handled through the header check in loadPipelineCache().
+		Path path = FileSystem::getTempDirectoryPath();
+		path.setFilename("bsfVulkanPipelineCache_" + toString(mDeviceProperties.vendorID) + "_" +
+			toString(mDeviceProperties.deviceID) + ".bin");
+
+		return path;
+	}
+
 	void VulkanDevice::waitIdle() const
 	{
 		VkResult result = vkDeviceWaitIdle(mLogicalDevice);
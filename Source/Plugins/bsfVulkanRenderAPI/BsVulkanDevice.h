@@ -84,6 +84,13 @@ namespace bs { namespace ct
 		/** Returns a manager that can be used for allocating Vulkan objects wrapped as managed resources. */
 		VulkanResourceManager& getResourceManager() const { return *mResourceManager; }
 
+		/**
+		 * Returns the pipeline cache used for all pipeline creation on this device. The cache is persisted to disk
+		 * between application runs, and is internally synchronized, meaning it may be used for creating pipelines from
+		 * multiple threads simultaneously.
+		 */
+		VkPipelineCache getPipelineCache() const { return mPipelineCache; }
+
 		/** 
 		 * Allocates memory for the provided image, and binds it to the image. Returns null if it cannot find memory
 		 * with the specified flags.
@@ -111,10 +118,23 @@ namespace bs { namespace ct
 		/** Marks the device as a primary device. */
 		void setIsPrimary() { mIsPrimary = true; }
 
+		/**
+		 * Creates the pipeline cache, priming it with data previously written by savePipelineCache(), if such data
+		 * exists and was generated by a compatible device and driver.
+		 */
+		void loadPipelineCache();
+
+		/** Serializes the contents of the pipeline cache to disk, to be reused on the next application run. */
+		void savePipelineCache() const;
+
+		/** Returns the path of the file in which the pipeline cache is persisted for this particular device. */
+		Path getPipelineCachePath() const;
+
 		VkPhysicalDevice mPhysicalDevice;
 		VkDevice mLogicalDevice;
 		bool mIsPrimary;
 		UINT32 mDeviceIdx;
+		VkPipelineCache mPipelineCache;
 
 		VulkanCmdBufferPool* mCommandBufferPool;
 		VulkanQueryPool* mQueryPool;
@@ -30,9 +30,11 @@ namespace bs { namespace ct
 		GpuParamBlockBuffer::initialize();
 	}
 
-	void VulkanGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
+	void VulkanGpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 offset, UINT32 size, UINT32 queueIdx)
 	{
-		mBuffer->writeData(0, mSize, data, BWT_DISCARD, queueIdx);
+		// Discarding the whole buffer is only valid if we're also writing the whole buffer
+		BufferWriteType writeType = (offset == 0 && size == mSize) ? BWT_DISCARD : BWT_NORMAL;
+		mBuffer->writeData(offset, size, data + offset, writeType, queueIdx);
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
 	}
@@ -41,6 +41,7 @@ namespace bs { namespace ct
 					entry->destroy();
 
 				mPerDeviceData[i].perSetData[j].sets.~Vector<VulkanDescriptorSet*>();
+				mPerDeviceData[i].perSetData[j].cachedSets.~SetCache();
 			}
 		}
 	}
@@ -126,6 +127,7 @@ namespace bs { namespace ct
 
 				PerSetData& perSetData = mPerDeviceData[i].perSetData[j];
 				new (&perSetData.sets) Vector<VulkanDescriptorSet*>();
+				new (&perSetData.cachedSets) SetCache();
 
 				perSetData.writeSetInfos = mAlloc.alloc<VkWriteDescriptorSet>(numBindingsPerSet);
 				perSetData.writeInfos = mAlloc.alloc<WriteInfo>(numBindingsPerSet);
@@ -525,6 +527,45 @@ namespace bs { namespace ct
 		return mParamInfo->getNumSets();
 	}
 
+	::std::size_t VulkanGpuParams::SetContentsHash::operator()(const Vector<UINT64>& contents) const
+	{
+		std::size_t hash = 0;
+		for (auto& entry : contents)
+			hash_combine(hash, entry);
+
+		return hash;
+	}
+
+	void VulkanGpuParams::buildSetContents(const PerSetData& data, Vector<UINT64>& contents)
+	{
+		contents.clear();
+
+		for (UINT32 i = 0; i < data.numElements; i++)
+		{
+			const VkWriteDescriptorSet& writeSetInfo = data.writeSetInfos[i];
+			const WriteInfo& writeInfo = data.writeInfos[i];
+
+			switch (writeSetInfo.descriptorType)
+			{
+			case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+			case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+			case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+			case VK_DESCRIPTOR_TYPE_SAMPLER:
+				contents.push_back((UINT64)writeInfo.image.sampler);
+				contents.push_back((UINT64)writeInfo.image.imageView);
+				contents.push_back((UINT64)writeInfo.image.imageLayout);
+				break;
+			case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+			case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+				contents.push_back((UINT64)writeInfo.buffer.buffer);
+				break;
+			default: // Texel buffer views
+				contents.push_back((UINT64)writeInfo.bufferView);
+				break;
+			}
+		}
+	}
+
 	void VulkanGpuParams::prepareForBind(VulkanCmdBuffer& buffer, VkDescriptorSet* sets)
 	{
 		UINT32 deviceIdx = buffer.getDeviceIdx();
@@ -766,33 +807,60 @@ namespace bs { namespace ct
 			if (!mSetsDirty[i]) // Set not dirty, just use the last one we wrote (this is fine even across multiple command buffers)
 				continue;
 
-			// Set is dirty, we need to update
-			//// Use latest unless already used, otherwise try to find an unused one
-			if(perSetData.latestSet->isBound()) // Checking this is okay, because it's only modified below when we call registerResource, which is under the same lock as this
+			// Set is dirty, check if a set with identical contents was written earlier and reuse it if so. Such a set is
+			// safe to bind even if currently in use by the GPU, as its contents never change while it remains cached.
+			buildSetContents(perSetData, mSetContentsScratch);
+
+			auto iterFind = perSetData.cachedSets.find(mSetContentsScratch);
+			if (iterFind != perSetData.cachedSets.end())
 			{
-				perSetData.latestSet = nullptr;
+				perSetData.latestSet = iterFind->second;
+				mSetsDirty[i] = false;
+				continue;
+			}
 
+			// No set with such contents exists, we need to write one
+			//// Prefer allocating new sets up to a limit, so sets with recently used contents remain available for reuse,
+			//// after which recycle an unused one
+			perSetData.latestSet = nullptr;
+
+			if ((UINT32)perSetData.sets.size() >= MAX_CACHED_SETS)
+			{
 				for(auto& entry : perSetData.sets)
 				{
-					if(!entry->isBound())
+					if(!entry->isBound()) // Checking this is okay, because it's only modified below when we call registerResource, which is under the same lock as this
 					{
 						perSetData.latestSet = entry;
 						break;
 					}
 				}
 
-				// Cannot find an empty set, allocate a new one
-				if (perSetData.latestSet == nullptr)
+				if (perSetData.latestSet != nullptr)
 				{
-					VulkanDescriptorLayout* layout = vkParamInfo.getLayout(deviceIdx, i);
-					perSetData.latestSet = descManager.createSet(layout);
-					perSetData.sets.push_back(perSetData.latestSet);
+					// Rewriting the set invalidates whatever contents it held previously
+					for (auto iter = perSetData.cachedSets.begin(); iter != perSetData.cachedSets.end(); ++iter)
+					{
+						if (iter->second == perSetData.latestSet)
+						{
+							perSetData.cachedSets.erase(iter);
+							break;
+						}
+					}
 				}
 			}
 
+			// Cannot find an empty set, allocate a new one
+			if (perSetData.latestSet == nullptr)
+			{
+				VulkanDescriptorLayout* layout = vkParamInfo.getLayout(deviceIdx, i);
+				perSetData.latestSet = descManager.createSet(layout);
+				perSetData.sets.push_back(perSetData.latestSet);
+			}
+
 			// Note: Currently I write to the entire set at once, but it might be beneficial to remember only the exact
 			// entries that were updated, and only write to them individually.
 			perSetData.latestSet->write(perSetData.writeSetInfos, perSetData.numElements);
+			perSetData.cachedSets[mSetContentsScratch] = perSetData.latestSet;
 
 			mSetsDirty[i] = false;
 		}
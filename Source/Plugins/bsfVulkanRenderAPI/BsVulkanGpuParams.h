@@ -62,11 +62,22 @@ namespace bs { namespace ct
 			VkBufferView bufferView;
 		};
 
+		/** Creates a hash from the handles of all objects bound to a single descriptor set. */
+		class SetContentsHash
+		{
+		public:
+			::std::size_t operator()(const Vector<UINT64>& contents) const;
+		};
+
+		/** Maps descriptor set binding contents to sets that were previously written with those exact contents. */
+		typedef UnorderedMap<Vector<UINT64>, VulkanDescriptorSet*, SetContentsHash> SetCache;
+
 		/** All GPU param data related to a single descriptor set. */
 		struct PerSetData
 		{
 			VulkanDescriptorSet* latestSet;
 			Vector<VulkanDescriptorSet*> sets;
+			SetCache cachedSets;
 
 			VkWriteDescriptorSet* writeSetInfos;
 			WriteInfo* writeInfos;
@@ -93,9 +104,18 @@ namespace bs { namespace ct
 		/** @copydoc GpuParams::initialize */
 		void initialize() override;
 
+		/**
+		 * Generates a list of handles of all objects currently written to the bindings of the provided set. Used as a key
+		 * for looking up descriptor sets that were previously written with identical contents.
+		 */
+		static void buildSetContents(const PerSetData& data, Vector<UINT64>& contents);
+
+		static const UINT32 MAX_CACHED_SETS = 32;
+
 		PerDeviceData mPerDeviceData[BS_MAX_DEVICES];
 		GpuDeviceFlags mDeviceMask;
 		bool* mSetsDirty;
+		Vector<UINT64> mSetContentsScratch;
 
 		GroupAlloc mAlloc;
 		Mutex mMutex;
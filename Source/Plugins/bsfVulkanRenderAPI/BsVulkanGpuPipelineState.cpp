@@ -478,7 +478,8 @@ namespace bs { namespace ct
 		VkDevice vkDevice = mPerDeviceData[deviceIdx].device->getLogical();
 
 		VkPipeline pipeline;
-		VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &mPipelineInfo, gVulkanAllocator, &pipeline);
+		VkResult result = vkCreateGraphicsPipelines(vkDevice, device->getPipelineCache(), 1, &mPipelineInfo,
+			gVulkanAllocator, &pipeline);
 		assert(result == VK_SUCCESS);
 
 		// Restore previous stencil op states
@@ -571,8 +572,8 @@ namespace bs { namespace ct
 			pipelineCI.layout = descManager.getPipelineLayout(layouts, numLayouts);
 
 			VkPipeline pipeline;
-			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), VK_NULL_HANDLE, 1, &pipelineCI,
-														gVulkanAllocator, &pipeline);
+			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), devices[i]->getPipelineCache(), 1,
+														&pipelineCI, gVulkanAllocator, &pipeline);
 			assert(result == VK_SUCCESS);
 
 
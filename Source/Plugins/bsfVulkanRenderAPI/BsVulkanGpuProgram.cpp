@@ -61,7 +61,7 @@ namespace bs { namespace ct
 			desc.language = "vksl";
 			desc.source = mSource;
 
-			mBytecode = compileBytecode(desc);
+			mBytecode = GpuProgramManager::instance().getBytecode(desc, VULKAN_COMPILER_ID, VULKAN_COMPILER_VERSION);
 		}
 
 		mCompileMessages = mBytecode->messages;
@@ -441,11 +441,9 @@ namespace bs { namespace ct
 				VulkanDevice& device = *rapi._getDevice(mMappedDeviceIdx);
 
 				VulkanCommandBufferManager& cbManager = gVulkanCBManager();
-				GpuQueueType queueType;
-				UINT32 localQueueIdx = CommandSyncMask::getQueueIdxAndType(mMappedGlobalQueueIdx, queueType);
 
 				VulkanBuffer* buffer = mBuffers[mMappedDeviceIdx];
-				VulkanTransferBuffer* transferCB = cbManager.getTransferBuffer(mMappedDeviceIdx, queueType, localQueueIdx);
+				VulkanTransferBuffer* transferCB = cbManager.getUploadBuffer(mMappedDeviceIdx, mMappedGlobalQueueIdx);
 
 				// If the buffer is used in any way on the GPU, we need to wait for that use to finish before
 				// we issue our copy
@@ -529,7 +529,18 @@ namespace bs { namespace ct
 
 	void VulkanRenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
 	{
-		BS_EXCEPT(NotImplementedException, "Secondary command buffers not implemented");
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (secondary == nullptr)
+		{
+			LOGWRN("Cannot append commands because no secondary command buffer was provided.");
+			return;
+		}
+
+		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		VulkanCommandBuffer* secondaryCB = static_cast<VulkanCommandBuffer*>(secondary.get());
+
+		cb->appendSecondary(*secondaryCB);
 	}
 
 	void VulkanRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
@@ -684,6 +695,11 @@ namespace bs { namespace ct
 
 			caps.setCapability(RSC_COMPUTE_PROGRAM);
 
+			// Dedicated compute queues are only populated for families without graphics support, meaning compute
+			// command buffers submitted to them can execute in parallel with the graphics queue
+			if (device->getNumQueues(GQT_COMPUTE) > 0)
+				caps.setCapability(RSC_ASYNC_COMPUTE);
+
 			caps.setNumTextureUnits(GPT_FRAGMENT_PROGRAM, deviceLimits.maxPerStageDescriptorSampledImages);
 			caps.setNumTextureUnits(GPT_VERTEX_PROGRAM, deviceLimits.maxPerStageDescriptorSampledImages);
 			caps.setNumTextureUnits(GPT_COMPUTE_PROGRAM, deviceLimits.maxPerStageDescriptorSampledImages);
@@ -1255,11 +1255,9 @@ namespace bs { namespace ct
 				VulkanDevice& device = *rapi._getDevice(mMappedDeviceIdx);
 
 				VulkanCommandBufferManager& cbManager = gVulkanCBManager();
-				GpuQueueType queueType;
-				UINT32 localQueueIdx = CommandSyncMask::getQueueIdxAndType(mMappedGlobalQueueIdx, queueType);
 
 				VulkanImage* image = mImages[mMappedDeviceIdx];
-				VulkanTransferBuffer* transferCB = cbManager.getTransferBuffer(mMappedDeviceIdx, queueType, localQueueIdx);
+				VulkanTransferBuffer* transferCB = cbManager.getUploadBuffer(mMappedDeviceIdx, mMappedGlobalQueueIdx);
 
 				VulkanImageSubresource* subresource = image->getSubresource(mMappedFace, mMappedMip);
 				VkImageLayout curLayout = subresource->getLayout();
@@ -235,6 +235,26 @@ namespace bs { namespace ct
 		return transferBuffer;
 	}
 
+	VulkanTransferBuffer* VulkanCommandBufferManager::getUploadBuffer(UINT32 deviceIdx, UINT32 globalQueueIdx)
+	{
+		GpuQueueType queueType;
+		UINT32 localQueueIdx = CommandSyncMask::getQueueIdxAndType(globalQueueIdx, queueType);
+
+		// Global queue index of zero means the caller didn't care about a specific queue, in which case prefer the
+		// dedicated transfer queue if the device has one
+		if (globalQueueIdx == 0)
+		{
+			SPtr<VulkanDevice> device = mRapi._getDevice(deviceIdx);
+			if (device->getNumQueues(GQT_UPLOAD) > 0)
+			{
+				queueType = GQT_UPLOAD;
+				localQueueIdx = 0;
+			}
+		}
+
+		return getTransferBuffer(deviceIdx, queueType, localQueueIdx);
+	}
+
 	void VulkanCommandBufferManager::flushTransferBuffers(UINT32 deviceIdx)
 	{
 		assert(deviceIdx < mNumDevices);
@@ -120,6 +120,14 @@ namespace bs { namespace ct
 		 */
 		VulkanTransferBuffer* getTransferBuffer(UINT32 deviceIdx, GpuQueueType type, UINT32 queueIdx);
 
+		/**
+		 * Returns a transfer command buffer to use for upload (CPU to GPU copy) operations. If the caller didn't request
+		 * a specific queue and the device has a dedicated transfer queue, the upload is routed to it so the copy overlaps
+		 * with graphics and compute work instead of stalling it. Cross-queue synchronization and queue family ownership
+		 * transfers are handled automatically on command buffer submission.
+		 */
+		VulkanTransferBuffer* getUploadBuffer(UINT32 deviceIdx, UINT32 globalQueueIdx);
+
 		/** Submits all transfer command buffers, ensuring all queued transfer operations get executed. */
 		void flushTransferBuffers(UINT32 deviceIdx);
 
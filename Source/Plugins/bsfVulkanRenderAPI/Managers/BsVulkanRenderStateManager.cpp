@@ -17,7 +17,7 @@ namespace bs { namespace ct
 		return samplerState;
 	}
 
-	SPtr<GraphicsPipelineState> VulkanRenderStateManager::_createGraphicsPipelineState(
+	SPtr<GraphicsPipelineState> VulkanRenderStateManager::createGraphicsPipelineStateInternal(
 		const PIPELINE_STATE_DESC& desc, GpuDeviceFlags deviceMask) const
 	{
 		SPtr<VulkanGraphicsPipelineState> pipelineState =
@@ -19,9 +19,9 @@ namespace bs { namespace ct
 		SPtr<SamplerState> createSamplerStateInternal(const SAMPLER_STATE_DESC& desc,
 			GpuDeviceFlags deviceMask) const override;
 
-		/** @copydoc RenderStateManager::_createGraphicsPipelineState */
-		SPtr<GraphicsPipelineState> _createGraphicsPipelineState(const PIPELINE_STATE_DESC& desc,
-			GpuDeviceFlags deviceMask = GDF_DEFAULT) const override;
+		/** @copydoc RenderStateManager::createGraphicsPipelineStateInternal */
+		SPtr<GraphicsPipelineState> createGraphicsPipelineStateInternal(const PIPELINE_STATE_DESC& desc,
+			GpuDeviceFlags deviceMask) const override;
 
 		/** @copydoc RenderStateManager::_createComputePipelineState */
 		SPtr<ComputePipelineState> _createComputePipelineState(const SPtr<GpuProgram>& program,